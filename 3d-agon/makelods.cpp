@@ -0,0 +1,104 @@
+// g++ -O3 -pthread -o makelods makelods.cpp
+//
+// Build the LODs of an OBJ file offline (see simplify.h) and save each of them next to it, as
+// <name>_lod1.obj, <name>_lod2.obj, ..., with the materials of the file in <name>_lods.mtl.
+//
+// Usage: ./makelods file.obj [max_lods] [min_triangles]
+
+#include <chrono>
+#include <string>
+
+#include "geometry.h"
+#include "objimporter.h"
+#include "texturing.h"
+#include "simplify.h"
+
+static void writeVec3(FILE* file, const char* keyword, const Vec3f& v) {
+    fprintf(file, "%s %g %g %g\n", keyword, v.x, v.y, v.z);
+}
+
+static bool writeMtl(const std::string& path, const std::vector<ObjMaterial>& materials) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+    for (const ObjMaterial& material : materials) {
+        fprintf(file, "newmtl %s\n", material.name.c_str());
+        writeVec3(file, "Ka", material.ambient);
+        writeVec3(file, "Kd", material.diffuse);
+        writeVec3(file, "Ks", material.specular);
+        writeVec3(file, "Ke", material.emissive);
+        fprintf(file, "Ns %g\nNi %g\nd %g\nillum %d\n", material.shininess, material.ior, material.opacity, material.illum);
+        if (!material.diffuse_map.empty()) fprintf(file, "map_Kd %s\n", material.diffuse_map.c_str());
+        fprintf(file, "\n");
+    }
+    return fclose(file) == 0;
+}
+
+// Write the triangles of a LOD batch by batch, each batch with the material it was made from.
+static bool writeLod(const std::string& path, const std::string& mtlName, const struct Mesh* lod,
+                     const std::vector<ObjMaterial>& materials) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+    fprintf(file, "# %d triangles, error %g\n", lod->num_triangles, lod->lod_error);
+    if (!materials.empty()) fprintf(file, "mtllib %s\n", mtlName.c_str());
+    for (int i = 0; i < lod->num_vertices; ++i) {
+        fprintf(file, "v %.9g %.9g %.9g\n", lod->vertices[i].x, lod->vertices[i].y, lod->vertices[i].z);
+    }
+    for (int i = 0; lod->uvs && i < lod->num_vertices; ++i) {
+        fprintf(file, "vt %.9g %.9g\n", lod->uvs[i].u, 1 - lod->uvs[i].v);  // ParseObj inverts the V-axis
+    }
+    for (int b = 0; b < lod->num_batches; ++b) {
+        const struct MeshBatch* batch = &lod->batches[b];
+        if (batch->material >= 0) fprintf(file, "usemtl %s\n", materials[batch->material].name.c_str());
+        for (int t = batch->first_triangle; t < batch->first_triangle + batch->num_triangles; ++t) {
+            const int* v = &lod->vertex_indices[t * 3];
+            if (lod->uvs) fprintf(file, "f %d/%d %d/%d %d/%d\n", v[0] + 1, v[0] + 1, v[1] + 1, v[1] + 1, v[2] + 1, v[2] + 1);
+            else fprintf(file, "f %d %d %d\n", v[0] + 1, v[1] + 1, v[2] + 1);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s file.obj [max_lods] [min_triangles]\n", argv[0]);
+        return 1;
+    }
+    std::string objFilePath = argv[1];
+    int maxLods = argc > 2 ? atoi(argv[2]) : 8;
+    int minTriangles = argc > 3 ? atoi(argv[3]) : 16;
+
+    ObjData meshData = ParseObj(objFilePath);
+    struct Mesh mesh;
+    create_mesh(&mesh, meshData, NULL, NULL);
+    if (mesh.num_triangles == 0) {
+        fprintf(stderr, "Error: No triangles in %s\n", objFilePath.c_str());
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    create_lods(&mesh, maxLods, minTriangles);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::string base = objFilePath.substr(0, objFilePath.rfind(".obj") == std::string::npos ? objFilePath.size() : objFilePath.rfind(".obj"));
+    size_t slash = base.find_last_of("/\\");
+    std::string mtlName = base.substr(slash == std::string::npos ? 0 : slash + 1) + "_lods.mtl";
+    if (!meshData.materials.empty() && !writeMtl(base + "_lods.mtl", meshData.materials)) {
+        fprintf(stderr, "Error: Unable to write %s_lods.mtl\n", base.c_str());
+    }
+
+    printf("LOD  triangles  vertices   error       file\n");
+    printf("%3d  %9d  %8d   %-10g  %s\n", 0, mesh.num_triangles, mesh.num_vertices, 0.0, objFilePath.c_str());
+    for (int i = 0; i < mesh.num_lods; ++i) {
+        const struct Mesh* lod = &mesh.lods[i];
+        std::string path = base + "_lod" + std::to_string(i + 1) + ".obj";
+        if (!writeLod(path, mtlName, lod, meshData.materials)) {
+            fprintf(stderr, "Error: Unable to write %s\n", path.c_str());
+            continue;
+        }
+        printf("%3d  %9d  %8d   %-10g  %s\n", i + 1, lod->num_triangles, lod->num_vertices, lod->lod_error, path.c_str());
+    }
+    printf("%d LODs built in %.1f ms\n", mesh.num_lods, ms);
+
+    destroy_mesh_geometry(&mesh);
+    return 0;
+}
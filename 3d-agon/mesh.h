@@ -2,13 +2,31 @@
 
 #include "_types.h"
 
+// A range of triangles drawn with the same texture.
+struct MeshBatch {
+    int first_triangle;
+    int num_triangles;
+    const struct texture* texture;
+    int material;  // index of the material in the ObjData the mesh was made from, -1 if none
+};
+
 struct Mesh {
-    struct point3f* vertices;
+    struct point3f* vertices;  // in object space
+    int num_vertices;
+    int* position_indices;  // per vertex, index of its position in the OBJ file (NULL for a LOD); vertices on a texture seam share it
     int* vertex_indices;
     struct vec3f* normals;
     int* normal_indices;
     struct uv2f* uvs;
     int* uv_indices;
     int num_triangles;
-    struct texture* texture;
+    struct point3f bbox_min, bbox_max;  // bounding box of the vertices
+    struct texture* texture;  // used by the triangles whose material has no texture
+    struct MeshBatch* batches;  // cover all the triangles, in order
+    int num_batches;
+    struct texture** material_textures;  // the other textures used by the batches, owned by the mesh
+    int num_material_textures;
+    struct Mesh* lods;  // simplified versions of the mesh, from the most to the least detailed (see simplify.h)
+    int num_lods;
+    float lod_error;  // for a LOD, distance (in object space) by which it departs from the full mesh
 };
\ No newline at end of file
@@ -12,10 +12,46 @@ struct Object {
     Matrix44f transform;
 };
 
+// Compute the object-to-world matrix from the object's scale, rotation (Euler angles in radians,
+// applied around x, then y, then z) and position. Call it whenever one of these changes.
+void object_update_transform(struct Object* object) {
+    float cx = cosf(object->rotation.x), sx = sinf(object->rotation.x);
+    float cy = cosf(object->rotation.y), sy = sinf(object->rotation.y);
+    float cz = cosf(object->rotation.z), sz = sinf(object->rotation.z);
+    Matrix44f scale(
+        object->scale.x, 0, 0, 0,
+        0, object->scale.y, 0, 0,
+        0, 0, object->scale.z, 0,
+        0, 0, 0, 1);
+    Matrix44f rotate_x(
+        1, 0, 0, 0,
+        0, cx, sx, 0,
+        0, -sx, cx, 0,
+        0, 0, 0, 1);
+    Matrix44f rotate_y(
+        cy, 0, -sy, 0,
+        0, 1, 0, 0,
+        sy, 0, cy, 0,
+        0, 0, 0, 1);
+    Matrix44f rotate_z(
+        cz, sz, 0, 0,
+        -sz, cz, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1);
+    Matrix44f translate(
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        object->position.x, object->position.y, object->position.z, 1);
+    // Points are row vectors: the leftmost matrix is applied first
+    object->transform = scale * rotate_x * rotate_y * rotate_z * translate;
+}
+
 void object_init(struct Object* object, struct Mesh* mesh, struct point3f position, struct vec3f rotation, struct vec3f scale) {
     object->mesh = mesh;
     object->position = position;
     object->rotation = rotation;
     object->scale = scale;
     object->transform = matrix_identity();
+    object_update_transform(object);
 }
\ No newline at end of file
@@ -11,10 +11,47 @@
 #include <vector>
 #include <deque>
 #include <string>
+#include <thread>
+#include <functional>
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <unordered_map>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "geometry.h"
 
+// The parameters of a material of an MTL file (only the common ones are read).
+struct ObjMaterial {
+    std::string name;
+    Vec3f ambient = Vec3f(1);      // Ka
+    Vec3f diffuse = Vec3f(0.8f);   // Kd
+    Vec3f specular = Vec3f(0);     // Ks
+    Vec3f emissive = Vec3f(0);     // Ke
+    float shininess = 0;           // Ns
+    float ior = 1;                 // Ni
+    float opacity = 1;             // d (or 1 - Tr)
+    int illum = 2;
+    std::string diffuse_map;       // map_Kd, as written in the MTL file
+};
+
+// A range of triangles using the same material and belonging to the same group ("g" or "o").
+struct ObjBatch {
+    int material;                  // index in ObjData::materials, -1 if the triangles have none
+    int group;                     // index in ObjData::groups, -1 if the triangles have none
+    uint32_t first_triangle;
+    uint32_t num_triangles;
+};
+
 struct ObjData {
     std::vector<Vec3f> vertices;
     std::vector<uint32_t> vertex_indices;
@@ -22,6 +59,11 @@ struct ObjData {
     std::vector<uint32_t> normal_indices;
     std::vector<Vec2f> uvs;
     std::vector<uint32_t> uv_indices;
+    std::vector<ObjMaterial> materials;
+    std::vector<std::string> groups;
+    // The triangles are sorted so that all the triangles using a material are contiguous, and
+    // batches cover them all, in order. A renderer can set up each material once per batch.
+    std::vector<ObjBatch> batches;
 };
 
 struct FaceVertex {
@@ -37,65 +79,598 @@ struct FaceGroup {
 
 std::deque<FaceGroup> face_groups;
 
-void ParseFaceVertex(const std::string& tuple, FaceVertex& face_vertex) {
-	std::istringstream stream(tuple);
-	std::string part;
-	std::getline(stream, part, '/');
-	face_vertex.vertex_index = std::stoi(part) - 1;
-	if (std::getline(stream, part, '/') && !part.empty()) {
-		face_vertex.st_coord_index = std::stoi(part) - 1;
-	}
-	if (std::getline(stream, part, '/') && !part.empty()) {
-		face_vertex.normal_index = std::stoi(part) - 1;
-	}
+// The parser maps the file in memory, splits it into chunks that end on a line boundary, and
+// parses the chunks in parallel. Numbers are read with the hand-written parsers below rather
+// than with streams: they only accept what OBJ exporters write, but they are an order of
+// magnitude faster. The chunks are then merged, which is where the relative (negative)
+// indices, which refer to the elements declared before the face, get resolved.
+
+inline const char* SkipSpaces(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
 }
 
-void ProcessFace(const std::vector<std::string>& tuples, std::vector<FaceVertex>& face_vertices) {
-	assert(tuples.size() == 3);
-	for (const auto& tuple : tuples) {
-		FaceVertex face_vertex;
-		ParseFaceVertex(tuple, face_vertex);
-		face_vertices.push_back(face_vertex);
-	}
+inline bool IsDigit(char c) { return static_cast<unsigned>(c - '0') < 10; }
+
+// Parse [+-]digits[.digits][(e|E)[+-]digits]. Return the first character after the number,
+// or p if there's no number. Only the first 19 significant digits are used, which is
+// plenty for a float.
+inline const char* ParseFloat(const char* p, const char* end, float& value) {
+    static const double powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+    uint64_t mantissa = 0;
+    int num_digits = 0, exponent = 0;
+    const char* digits = p;
+    for (; p < end && IsDigit(*p); ++p) {
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            num_digits += mantissa != 0;
+        }
+        else ++exponent;
+    }
+    bool has_digits = p != digits;
+    if (p < end && *p == '.') {
+        digits = ++p;
+        for (; p < end && IsDigit(*p); ++p) {
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                num_digits += mantissa != 0;
+                --exponent;
+            }
+        }
+        has_digits |= p != digits;
+    }
+    if (!has_digits) return start;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '-' || *q == '+')) negative_exponent = *q++ == '-';
+        int e = 0;
+        for (digits = q; q < end && IsDigit(*q); ++q) {
+            if (e < 10000) e = e * 10 + (*q - '0');
+        }
+        if (q != digits) {
+            exponent += negative_exponent ? -e : e;
+            p = q;
+        }
+    }
+    double d = static_cast<double>(mantissa);
+    if (exponent < 0) d = exponent >= -22 ? d / powers_of_ten[-exponent] : d * std::pow(10.0, exponent);
+    else if (exponent > 0) d = exponent <= 22 ? d * powers_of_ten[exponent] : d * std::pow(10.0, exponent);
+    value = static_cast<float>(negative ? -d : d);
+    return p;
+}
+
+inline const char* ParseInt(const char* p, const char* end, int64_t& value) {
+    const char* start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+    const char* digits = p;
+    int64_t v = 0;
+    for (; p < end && IsDigit(*p); ++p) {
+        if (v < (int64_t(1) << 40)) v = v * 10 + (*p - '0');
+    }
+    if (p == digits) return start;
+    value = negative ? -v : v;
+    return p;
 }
 
-ObjData ParseObj(const std::string& filename) {
+// A "usemtl", "g" or "o" line. The triangles that follow use this material or belong to this
+// group. A chunk doesn't know the material and group it starts with, so they are resolved
+// when the chunks are merged.
+struct ObjStateChange {
+    uint32_t triangle;   // number of triangles in the chunk before the line
+    bool material;       // "usemtl" (otherwise "g" or "o")
+    std::string name;
+};
+
+// What one thread produces for one chunk of the file. A relative index can refer to an
+// element declared in a previous chunk, so it is stored relative to the first element of
+// the chunk (it may be negative) and its position is recorded so the merge can fix it up.
+struct ObjChunk {
     ObjData data;
-    std::ifstream ifs(filename);
-    std::string line;
-    while (std::getline(ifs, line)) {
-        std::istringstream stream(line);
-        std::string type;
-        stream >> type;
-        if (type == "v") {
+    std::vector<size_t> relative_vertex_indices;
+    std::vector<size_t> relative_uv_indices;
+    std::vector<size_t> relative_normal_indices;
+    std::vector<ObjStateChange> state_changes;
+    std::vector<std::string> material_libraries;
+    std::vector<std::pair<size_t, uint32_t>> polygons;  // first corner and size of the faces with more than 3 vertices
+};
+
+// If the line starts with the keyword followed by a space (or nothing), return what follows,
+// without leading and trailing spaces. Otherwise return nullptr.
+inline const char* MatchKeyword(const char* p, const char* eol, const char* keyword, const char*& arg_end) {
+    size_t n = strlen(keyword);
+    if (static_cast<size_t>(eol - p) < n || memcmp(p, keyword, n) != 0) return nullptr;
+    p += n;
+    if (p < eol && *p != ' ' && *p != '\t' && *p != '\r') return nullptr;
+    p = SkipSpaces(p, eol);
+    arg_end = eol;
+    while (arg_end > p && (arg_end[-1] == ' ' || arg_end[-1] == '\t' || arg_end[-1] == '\r')) --arg_end;
+    return p;
+}
+
+// Parse one v/vt/vn index of a face vertex. OBJ indices start at 1, negative indices count
+// back from the last element declared so far.
+inline const char* ParseFaceIndex(const char* p, const char* end, size_t count, int64_t& index, bool& relative) {
+    int64_t i = 0;
+    const char* q = ParseInt(p, end, i);
+    if (q == p || i == 0) return p;
+    relative = i < 0;
+    index = relative ? static_cast<int64_t>(count) + i : i - 1;
+    return q;
+}
+
+inline void AddFaceIndex(int64_t index, bool relative, std::vector<uint32_t>& indices, std::vector<size_t>& relative_indices) {
+    if (relative) relative_indices.push_back(indices.size());
+    indices.push_back(static_cast<uint32_t>(index));
+}
+
+void ParseObjChunk(const char* p, const char* end, ObjChunk& chunk) {
+    struct Corner {
+        int64_t index[3];
+        bool relative[3];
+        bool has[3];
+    };
+    std::vector<Corner> face;
+    ObjData& data = chunk.data;
+    while (p < end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        if (!eol) eol = end;
+        p = SkipSpaces(p, eol);
+        if (eol - p > 1 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
             Vec3f v;
-            stream >> v.x >> v.y >> v.z;
+            p = ParseFloat(SkipSpaces(p + 2, eol), eol, v.x);
+            p = ParseFloat(SkipSpaces(p, eol), eol, v.y);
+            p = ParseFloat(SkipSpaces(p, eol), eol, v.z);
             data.vertices.push_back(v);
-        } else if (type == "vt") {
+        }
+        else if (eol - p > 2 && p[0] == 'v' && p[1] == 't' && (p[2] == ' ' || p[2] == '\t')) {
             Vec2f st;
-            stream >> st.x >> st.y;
+            p = ParseFloat(SkipSpaces(p + 3, eol), eol, st.x);
+            p = ParseFloat(SkipSpaces(p, eol), eol, st.y);
             st.y = 1.0f - st.y;  // Invert the V-axis
             data.uvs.push_back(st);
-        } else if (type == "vn") {
+        }
+        else if (eol - p > 2 && p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t')) {
             Vec3f n;
-            stream >> n.x >> n.y >> n.z;
+            p = ParseFloat(SkipSpaces(p + 3, eol), eol, n.x);
+            p = ParseFloat(SkipSpaces(p, eol), eol, n.y);
+            p = ParseFloat(SkipSpaces(p, eol), eol, n.z);
             data.normals.push_back(n);
-        } else if (type == "f") {
-            std::vector<std::string> face;
-            std::string tuple;
-            while (stream >> tuple) {
-                FaceVertex fv;
-                ParseFaceVertex(tuple, fv);
-                data.vertex_indices.push_back(fv.vertex_index);
-                if (fv.st_coord_index != -1) {
-                    data.uv_indices.push_back(fv.st_coord_index);
+        }
+        else if (eol - p > 1 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+            const size_t counts[3] = {data.vertices.size(), data.uvs.size(), data.normals.size()};
+            face.clear();
+            p = SkipSpaces(p + 2, eol);
+            while (p < eol && *p != '#') {
+                Corner c{};
+                const char* q = ParseFaceIndex(p, eol, counts[0], c.index[0], c.relative[0]);
+                if (q == p) break;  // malformed face, keep the corners read so far
+                c.has[0] = true;
+                for (int k = 1; k < 3 && q < eol && *q == '/'; ++k) {
+                    const char* r = ParseFaceIndex(q + 1, eol, counts[k], c.index[k], c.relative[k]);
+                    c.has[k] = r != q + 1;
+                    q = r == q + 1 ? q + 1 : r;
                 }
-                if (fv.normal_index != -1) {
-                    data.normal_indices.push_back(fv.normal_index);
+                face.push_back(c);
+                p = SkipSpaces(q, eol);
+            }
+            // Polygons are split into a fan of triangles for now. Their vertices may be in another
+            // chunk, so the polygons that aren't convex are triangulated again after the merge.
+            if (face.size() > 3) chunk.polygons.emplace_back(data.vertex_indices.size(), static_cast<uint32_t>(face.size()));
+            for (size_t i = 2; i < face.size(); ++i) {
+                const Corner* triangle[3] = {&face[0], &face[i - 1], &face[i]};
+                for (const Corner* c : triangle) {
+                    AddFaceIndex(c->index[0], c->relative[0], data.vertex_indices, chunk.relative_vertex_indices);
+                    if (c->has[1]) AddFaceIndex(c->index[1], c->relative[1], data.uv_indices, chunk.relative_uv_indices);
+                    if (c->has[2]) AddFaceIndex(c->index[2], c->relative[2], data.normal_indices, chunk.relative_normal_indices);
+                }
+            }
+        }
+        else if (eol > p && (p[0] == 'u' || p[0] == 'g' || p[0] == 'o' || p[0] == 'm')) {
+            const char* arg_end;
+            const char* arg;
+            uint32_t num_triangles = static_cast<uint32_t>(data.vertex_indices.size() / 3);
+            if ((arg = MatchKeyword(p, eol, "usemtl", arg_end))) {
+                chunk.state_changes.push_back({num_triangles, true, std::string(arg, arg_end)});
+            }
+            else if ((arg = MatchKeyword(p, eol, "g", arg_end)) || (arg = MatchKeyword(p, eol, "o", arg_end))) {
+                chunk.state_changes.push_back({num_triangles, false, arg == arg_end ? "default" : std::string(arg, arg_end)});
+            }
+            else if ((arg = MatchKeyword(p, eol, "mtllib", arg_end))) {
+                // one or more file names separated by spaces
+                while (arg < arg_end) {
+                    const char* name_end = arg;
+                    while (name_end < arg_end && *name_end != ' ' && *name_end != '\t') ++name_end;
+                    chunk.material_libraries.emplace_back(arg, name_end);
+                    arg = SkipSpaces(name_end, arg_end);
                 }
             }
         }
+        p = eol + 1;
+    }
+}
+
+template<typename T>
+void AppendChunk(std::vector<T>& dst, size_t offset, const std::vector<T>& src) {
+    if (!src.empty()) memcpy(dst.data() + offset, src.data(), src.size() * sizeof(T));
+}
+
+void AppendIndices(std::vector<uint32_t>& dst, size_t offset, const std::vector<uint32_t>& src,
+                   const std::vector<size_t>& relative_indices, size_t base) {
+    AppendChunk(dst, offset, src);
+    for (size_t i : relative_indices) dst[offset + i] += static_cast<uint32_t>(base);
+}
+
+// Triangulate a polygon with the ear clipping method. The polygon is projected onto the plane of
+// the two axes its normal (computed with Newell's method) is the most perpendicular to. An ear
+// is a convex corner whose triangle contains no other vertex of the polygon: cutting it off
+// leaves a polygon with one vertex less. Convex polygons, by far the most common, are split into
+// a fan directly, which is also what ear clipping gives for them since ears are searched in order
+// from the second vertex. The n - 2 triangles are written as positions in the polygon.
+void TriangulatePolygon(const Vec3f* positions, const uint32_t* indices, uint32_t n, uint32_t* triangles) {
+    Vec3f normal;
+    for (uint32_t i = 0; i < n; ++i) {
+        const Vec3f& a = positions[indices[i]];
+        const Vec3f& b = positions[indices[(i + 1) % n]];
+        normal.x += (a.y - b.y) * (a.z + b.z);
+        normal.y += (a.z - b.z) * (a.x + b.x);
+        normal.z += (a.x - b.x) * (a.y + b.y);
+    }
+    const float abs_normal[3] = {std::fabs(normal.x), std::fabs(normal.y), std::fabs(normal.z)};
+    int axis = abs_normal[0] > abs_normal[1] ? (abs_normal[0] > abs_normal[2] ? 0 : 2) : (abs_normal[1] > abs_normal[2] ? 1 : 2);
+    // (axis + 1, axis + 2) keeps the orientation: the polygon turns counter-clockwise if normal[axis] > 0
+    int u = (axis + 1) % 3, v = (axis + 2) % 3;
+    float sign = (&normal.x)[axis] < 0 ? -1.f : 1.f;
+    auto area = [&](uint32_t a, uint32_t b, uint32_t c) {
+        const float* pa = &positions[indices[a]].x;
+        const float* pb = &positions[indices[b]].x;
+        const float* pc = &positions[indices[c]].x;
+        return sign * ((pb[u] - pa[u]) * (pc[v] - pa[v]) - (pb[v] - pa[v]) * (pc[u] - pa[u]));
+    };
+    auto same_position = [&](uint32_t a, uint32_t b) {
+        const Vec3f& pa = positions[indices[a]];
+        const Vec3f& pb = positions[indices[b]];
+        return pa.x == pb.x && pa.y == pb.y && pa.z == pb.z;
+    };
+
+    bool convex = true;
+    for (uint32_t i = 0; i < n && convex; ++i) convex = area((i + n - 1) % n, i, (i + 1) % n) >= 0;
+    if (convex) {
+        for (uint32_t j = 0; j < n - 2; ++j) {
+            triangles[j * 3] = 0;
+            triangles[j * 3 + 1] = j + 1;
+            triangles[j * 3 + 2] = j + 2;
+        }
+        return;
+    }
+
+    std::vector<uint32_t> remaining(n);
+    for (uint32_t i = 0; i < n; ++i) remaining[i] = i;
+    uint32_t num_triangles = 0, i = 1;
+    while (remaining.size() > 3) {
+        uint32_t m = static_cast<uint32_t>(remaining.size());
+        // Without any ear (the polygon intersects itself), the corner we started from is cut anyway
+        for (uint32_t tries = 0; tries < m; ++tries, i = (i + 1) % m) {
+            uint32_t a = remaining[(i + m - 1) % m], b = remaining[i], c = remaining[(i + 1) % m];
+            if (area(a, b, c) <= 0) continue;
+            bool is_ear = true;
+            for (uint32_t k = 0; k < m && is_ear; ++k) {
+                uint32_t p = remaining[k];
+                // skip the corners of the triangle and their duplicates
+                if (same_position(p, a) || same_position(p, b) || same_position(p, c)) continue;
+                is_ear = !(area(a, b, p) >= 0 && area(b, c, p) >= 0 && area(c, a, p) >= 0);
+            }
+            if (is_ear) break;
+        }
+        triangles[num_triangles * 3] = remaining[(i + m - 1) % m];
+        triangles[num_triangles * 3 + 1] = remaining[i];
+        triangles[num_triangles * 3 + 2] = remaining[(i + 1) % m];
+        num_triangles++;
+        remaining.erase(remaining.begin() + i);
+        if (i == remaining.size()) i = 0;
+    }
+    triangles[num_triangles * 3] = remaining[0];
+    triangles[num_triangles * 3 + 1] = remaining[1];
+    triangles[num_triangles * 3 + 2] = remaining[2];
+}
+
+// Triangulate the polygons of a chunk again, now that all the positions are known. The corners
+// of a chunk start at first_corner in data. The fan made by the parser gives the polygon back:
+// corner 0 starts every triangle, triangle j - 1 has corner j as its second corner, and the last
+// corner is the third corner of the last triangle. The polygon has n - 2 triangles either way,
+// so they are replaced in place. The texture coordinate and normal indices follow, unless some
+// faces don't have any (they are then not used by the renderer).
+void TriangulatePolygons(ObjData& data, const std::vector<std::pair<size_t, uint32_t>>& polygons, size_t first_corner) {
+    const bool has_uvs = data.uv_indices.size() == data.vertex_indices.size();
+    const bool has_normals = data.normal_indices.size() == data.vertex_indices.size();
+    std::vector<uint32_t> corners, indices, triangles, remapped;
+    for (const auto& [first, n] : polygons) {
+        size_t offset = first_corner + first;
+        corners.resize(n);
+        indices.resize(n);
+        triangles.resize((n - 2) * 3);
+        corners[0] = 0;
+        for (uint32_t j = 1; j < n - 1; ++j) corners[j] = (j - 1) * 3 + 1;
+        corners[n - 1] = (n - 3) * 3 + 2;
+        bool valid = true;
+        for (uint32_t j = 0; j < n; ++j) {
+            indices[j] = data.vertex_indices[offset + corners[j]];
+            valid &= indices[j] < data.vertices.size();
+        }
+        if (!valid) continue;  // keep the fan
+        TriangulatePolygon(data.vertices.data(), indices.data(), n, triangles.data());
+        auto remap = [&](std::vector<uint32_t>& array) {
+            remapped.resize(triangles.size());
+            for (size_t j = 0; j < triangles.size(); ++j) remapped[j] = array[offset + corners[triangles[j]]];
+            std::copy(remapped.begin(), remapped.end(), array.begin() + offset);
+        };
+        remap(data.vertex_indices);
+        if (has_uvs) remap(data.uv_indices);
+        if (has_normals) remap(data.normal_indices);
+    }
+}
+
+// Read the materials of an MTL file and add them to materials.
+bool LoadMtl(const std::string& filename, std::vector<ObjMaterial>& materials) {
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs) {
+        std::cerr << "Warning: Unable to open the material library " << filename << std::endl;
+        return false;
+    }
+    std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    const char* p = contents.data();
+    const char* end = p + contents.size();
+    ObjMaterial* material = nullptr;
+    auto parse_color = [](const char* p, const char* end, Vec3f& c) {
+        p = ParseFloat(p, end, c.x);
+        c.y = c.z = c.x;  // a single value sets the 3 channels
+        p = ParseFloat(SkipSpaces(p, end), end, c.y);
+        ParseFloat(SkipSpaces(p, end), end, c.z);
+    };
+    while (p < end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        if (!eol) eol = end;
+        p = SkipSpaces(p, eol);
+        const char* arg_end;
+        const char* arg;
+        if ((arg = MatchKeyword(p, eol, "newmtl", arg_end))) {
+            materials.emplace_back();
+            material = &materials.back();
+            material->name.assign(arg, arg_end);
+        }
+        else if (!material) {}  // nothing can come before the first material
+        else if ((arg = MatchKeyword(p, eol, "Ka", arg_end))) parse_color(arg, arg_end, material->ambient);
+        else if ((arg = MatchKeyword(p, eol, "Kd", arg_end))) parse_color(arg, arg_end, material->diffuse);
+        else if ((arg = MatchKeyword(p, eol, "Ks", arg_end))) parse_color(arg, arg_end, material->specular);
+        else if ((arg = MatchKeyword(p, eol, "Ke", arg_end))) parse_color(arg, arg_end, material->emissive);
+        else if ((arg = MatchKeyword(p, eol, "Ns", arg_end))) ParseFloat(arg, arg_end, material->shininess);
+        else if ((arg = MatchKeyword(p, eol, "Ni", arg_end))) ParseFloat(arg, arg_end, material->ior);
+        else if ((arg = MatchKeyword(p, eol, "d", arg_end))) ParseFloat(arg, arg_end, material->opacity);
+        else if ((arg = MatchKeyword(p, eol, "Tr", arg_end))) {
+            float transparency = 0;
+            ParseFloat(arg, arg_end, transparency);
+            material->opacity = 1 - transparency;
+        }
+        else if ((arg = MatchKeyword(p, eol, "illum", arg_end))) {
+            int64_t illum = material->illum;
+            ParseInt(arg, arg_end, illum);
+            material->illum = static_cast<int>(illum);
+        }
+        else if ((arg = MatchKeyword(p, eol, "map_Kd", arg_end))) {
+            // options (-s, -o, etc.) come before the file name, which is the last argument
+            const char* name = arg_end;
+            while (name > arg && name[-1] != ' ' && name[-1] != '\t') --name;
+            material->diffuse_map.assign(name, arg_end);
+        }
+        p = eol + 1;
+    }
+    return true;
+}
+
+// Find the material and the group of each triangle, then sort the triangles so that each
+// material, and within a material each group, forms a contiguous range. Materials and groups
+// are sorted in the order in which they first appear in the file: when the file already has
+// them in contiguous ranges, which is generally the case, the triangles don't move.
+void BuildBatches(ObjData& data, const std::vector<uint32_t>& chunk_triangles,
+                  const std::vector<std::vector<ObjStateChange>>& state_changes) {
+    uint32_t num_triangles = static_cast<uint32_t>(data.vertex_indices.size() / 3);
+    std::unordered_map<std::string, int> material_ids, group_ids;
+    for (size_t i = 0; i < data.materials.size(); ++i) material_ids.emplace(data.materials[i].name, (int)i);
+    // rank of each material and group, in order of first use, and the reverse mappings
+    std::vector<int> material_rank(data.materials.size(), -1), rank_material, rank_group;
+    std::vector<uint64_t> keys(num_triangles);
+    uint32_t material = 0, group = 0;  // rank + 1, 0 if none
+    uint32_t triangle = 0;
+    auto fill = [&](uint32_t end) {
+        uint64_t key = uint64_t(material) << 32 | group;
+        for (; triangle < end && triangle < num_triangles; ++triangle) keys[triangle] = key;
+    };
+    for (size_t c = 0; c < state_changes.size(); ++c) {
+        uint32_t chunk_begin = triangle;
+        for (const ObjStateChange& change : state_changes[c]) {
+            fill(chunk_begin + change.triangle);
+            if (change.material) {
+                auto it = material_ids.find(change.name);
+                if (it == material_ids.end()) {
+                    std::cerr << "Warning: Material " << change.name << " is not defined" << std::endl;
+                    it = material_ids.emplace(change.name, (int)data.materials.size()).first;
+                    data.materials.emplace_back();
+                    data.materials.back().name = change.name;
+                    material_rank.push_back(-1);
+                }
+                if (material_rank[it->second] == -1) {
+                    material_rank[it->second] = (int)rank_material.size();
+                    rank_material.push_back(it->second);
+                }
+                material = material_rank[it->second] + 1;
+            }
+            else {
+                auto it = group_ids.emplace(change.name, (int)data.groups.size());
+                if (it.second) {
+                    data.groups.push_back(change.name);
+                    rank_group.push_back(it.first->second);
+                }
+                group = it.first->second + 1;
+            }
+        }
+        fill(chunk_begin + chunk_triangles[c]);
+    }
+
+    if (!std::is_sorted(keys.begin(), keys.end())) {
+        std::vector<uint32_t> order(num_triangles);
+        for (uint32_t i = 0; i < num_triangles; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        auto permute = [&](std::vector<uint32_t>& indices) {
+            // faces without texture coordinates or normals make these arrays shorter, and the
+            // renderer ignores them, so only full arrays are sorted
+            if (indices.size() != 3 * size_t(num_triangles)) return;
+            std::vector<uint32_t> sorted(indices.size());
+            for (uint32_t i = 0; i < num_triangles; ++i) memcpy(&sorted[3 * i], &indices[3 * order[i]], 3 * sizeof(uint32_t));
+            indices.swap(sorted);
+        };
+        permute(data.vertex_indices);
+        permute(data.uv_indices);
+        permute(data.normal_indices);
+        std::vector<uint64_t> sorted_keys(num_triangles);
+        for (uint32_t i = 0; i < num_triangles; ++i) sorted_keys[i] = keys[order[i]];
+        keys.swap(sorted_keys);
+    }
+
+    for (uint32_t i = 0; i < num_triangles; ++i) {
+        if (i > 0 && keys[i] == keys[i - 1]) {
+            data.batches.back().num_triangles++;
+            continue;
+        }
+        uint32_t m = uint32_t(keys[i] >> 32), g = uint32_t(keys[i]);
+        data.batches.push_back({m ? rank_material[m - 1] : -1, g ? rank_group[g - 1] : -1, i, 1});
+    }
+}
+
+// num_threads = 0 uses one thread per core for files larger than a few MB.
+ObjData ParseObj(const std::string& filename, size_t num_threads = 0) {
+    ObjData data;
+#ifdef _WIN32
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs) {
+        std::cerr << "Error: Unable to open " << filename << std::endl;
+        return data;
+    }
+    std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    const char* file = contents.data();
+    size_t size = contents.size();
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) == -1) {
+        std::cerr << "Error: Unable to open " << filename << std::endl;
+        if (fd != -1) close(fd);
+        return data;
+    }
+    size_t size = st.st_size;
+    void* mapping = size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Error: Unable to map " << filename << std::endl;
+        return data;
+    }
+    const char* file = static_cast<const char*>(mapping);
+    if (size) madvise(mapping, size, MADV_SEQUENTIAL);
+#endif
+
+    // Use one chunk per thread, but don't bother splitting files smaller than a few MB
+    size_t num_chunks = num_threads;
+    if (num_chunks == 0) {
+        num_chunks = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), size >> 22));
+    }
+    std::vector<const char*> bounds(num_chunks + 1, file + size);
+    bounds[0] = file;
+    for (size_t i = 1; i < num_chunks; ++i) {
+        const char* p = std::max(bounds[i - 1], file + size * i / num_chunks);
+        const char* eol = static_cast<const char*>(memchr(p, '\n', file + size - p));
+        bounds[i] = eol ? eol + 1 : file + size;
+    }
+
+    std::vector<ObjChunk> chunks(num_chunks);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_chunks; ++i) {
+        threads.emplace_back(ParseObjChunk, bounds[i], bounds[i + 1], std::ref(chunks[i]));
+    }
+    ParseObjChunk(bounds[0], bounds[1], chunks[0]);
+    for (auto& thread : threads) thread.join();
+
+#ifndef _WIN32
+    if (size) munmap(mapping, size);
+#endif
+
+    // The material libraries are relative to the OBJ file
+    std::string directory = filename.substr(0, filename.find_last_of("/\\") + 1);
+    std::vector<ObjMaterial> materials;
+    std::vector<uint32_t> chunk_triangles(num_chunks);
+    std::vector<std::vector<ObjStateChange>> state_changes(num_chunks);
+    std::vector<std::vector<std::pair<size_t, uint32_t>>> polygons(num_chunks);
+    for (size_t i = 0; i < num_chunks; ++i) {
+        for (const std::string& library : chunks[i].material_libraries) LoadMtl(directory + library, materials);
+        chunk_triangles[i] = static_cast<uint32_t>(chunks[i].data.vertex_indices.size() / 3);
+        state_changes[i].swap(chunks[i].state_changes);
+        polygons[i].swap(chunks[i].polygons);
+    }
+
+    if (num_chunks == 1 && chunks[0].relative_vertex_indices.empty() &&
+        chunks[0].relative_uv_indices.empty() && chunks[0].relative_normal_indices.empty()) {
+        data = std::move(chunks[0].data);
+        TriangulatePolygons(data, polygons[0], 0);
+        data.materials.swap(materials);
+        BuildBatches(data, chunk_triangles, state_changes);
+        return data;
+    }
+
+    // Merge the chunks, each thread copies its chunk to its place in the final arrays
+    struct Offsets { size_t vertices, uvs, normals, vertex_indices, uv_indices, normal_indices; };
+    std::vector<Offsets> offsets(num_chunks + 1);
+    offsets[0] = {};
+    for (size_t i = 0; i < num_chunks; ++i) {
+        const ObjData& d = chunks[i].data;
+        offsets[i + 1] = {
+            offsets[i].vertices + d.vertices.size(), offsets[i].uvs + d.uvs.size(),
+            offsets[i].normals + d.normals.size(), offsets[i].vertex_indices + d.vertex_indices.size(),
+            offsets[i].uv_indices + d.uv_indices.size(), offsets[i].normal_indices + d.normal_indices.size()};
+    }
+    data.vertices.resize(offsets[num_chunks].vertices);
+    data.uvs.resize(offsets[num_chunks].uvs);
+    data.normals.resize(offsets[num_chunks].normals);
+    data.vertex_indices.resize(offsets[num_chunks].vertex_indices);
+    data.uv_indices.resize(offsets[num_chunks].uv_indices);
+    data.normal_indices.resize(offsets[num_chunks].normal_indices);
+    auto merge = [&](size_t i) {
+        ObjChunk& chunk = chunks[i];
+        const Offsets& o = offsets[i];
+        AppendChunk(data.vertices, o.vertices, chunk.data.vertices);
+        AppendChunk(data.uvs, o.uvs, chunk.data.uvs);
+        AppendChunk(data.normals, o.normals, chunk.data.normals);
+        AppendIndices(data.vertex_indices, o.vertex_indices, chunk.data.vertex_indices, chunk.relative_vertex_indices, o.vertices);
+        AppendIndices(data.uv_indices, o.uv_indices, chunk.data.uv_indices, chunk.relative_uv_indices, o.uvs);
+        AppendIndices(data.normal_indices, o.normal_indices, chunk.data.normal_indices, chunk.relative_normal_indices, o.normals);
+        chunk = ObjChunk();
+    };
+    threads.clear();
+    for (size_t i = 1; i < num_chunks; ++i) threads.emplace_back(merge, i);
+    merge(0);
+    for (auto& thread : threads) thread.join();
+
+    // All the positions are known now, the polygons can be triangulated (in parallel too)
+    threads.clear();
+    for (size_t i = 1; i < num_chunks; ++i) {
+        threads.emplace_back(TriangulatePolygons, std::ref(data), std::cref(polygons[i]), offsets[i].vertex_indices);
     }
-    ifs.close();
+    TriangulatePolygons(data, polygons[0], offsets[0].vertex_indices);
+    for (auto& thread : threads) thread.join();
+    data.materials.swap(materials);
+    BuildBatches(data, chunk_triangles, state_changes);
     return data;
 }
@@ -0,0 +1,524 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "texturing.h"
+
+// Mesh simplification with quadric error metrics (Garland and Heckbert, "Surface Simplification
+// Using Quadric Error Metrics"). Each position of the mesh gets the sum of the squared distances to
+// the planes of the triangles around it, stored as a symmetric 4x4 matrix (a quadric). We then
+// repeatedly collapse the edge whose collapse moves the surface the least according to these
+// quadrics, merging the quadrics of the two ends, and take a snapshot of the mesh (a LOD) every time
+// the number of triangles drops by half.
+//
+// The collapses are half-edge collapses: one end of the edge moves onto the other, so the LODs only
+// use vertices of the full mesh and keep their texture coordinates. A position can be shared by
+// several vertices with different texture coordinates (a texture seam, see dedup_corners). We call
+// the vertices at the same position a group, and collapse groups rather than vertices: each vertex
+// of the group that goes away becomes the vertex of the other group it shares a triangle with.
+// Collapses that would tear the texture along a seam, flip a triangle, or make the surface
+// non-manifold are rejected. The open borders of the mesh are held in place by planes perpendicular
+// to the triangles along them.
+#define LOD_REDUCTION 0.5f         // each LOD has about half the triangles of the previous one
+#define LOD_BOUNDARY_WEIGHT 10.0   // weight of the border planes, relative to the triangle planes
+#define LOD_MIN_NORMAL_COS 0.2f    // a collapse may not rotate a triangle's normal by more than ~78 degrees
+
+struct quadric {
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;  // plane ax + by + cz + d = 0
+    double weight;  // sum of the weights of the planes
+};
+
+static void quadric_add_plane(struct quadric* q, double a, double b, double c, double d, double w) {
+    q->a2 += w * a * a; q->ab += w * a * b; q->ac += w * a * c; q->ad += w * a * d;
+    q->b2 += w * b * b; q->bc += w * b * c; q->bd += w * b * d;
+    q->c2 += w * c * c; q->cd += w * c * d;
+    q->d2 += w * d * d;
+    q->weight += w;
+}
+
+static void quadric_add(struct quadric* q, const struct quadric* r) {
+    q->a2 += r->a2; q->ab += r->ab; q->ac += r->ac; q->ad += r->ad;
+    q->b2 += r->b2; q->bc += r->bc; q->bd += r->bd;
+    q->c2 += r->c2; q->cd += r->cd;
+    q->d2 += r->d2;
+    q->weight += r->weight;
+}
+
+// Weighted sum of the squared distances from p to the planes of the quadric.
+static double quadric_error(const struct quadric* q, const struct point3f* p) {
+    double x = p->x, y = p->y, z = p->z;
+    double e = q->a2 * x * x + q->b2 * y * y + q->c2 * z * z + q->d2 +
+               2 * (q->ab * x * y + q->ac * x * z + q->ad * x + q->bc * y * z + q->bd * y + q->cd * z);
+    return MAX(e, 0.0);
+}
+
+// Move the group "from" onto the group "to". The stamps are those of the two groups when the
+// collapse was queued: a collapse whose groups changed since is out of date and is skipped.
+struct collapse {
+    double cost;
+    int from, to;
+    int from_stamp, to_stamp;
+};
+
+struct simplifier {
+    const struct Mesh* mesh;
+    int* indices;                 // vertex indices of the triangles, updated by the collapses
+    unsigned char* alive;         // per triangle
+    int num_alive;
+    int num_groups;
+    int* group;                   // per vertex, its position group
+    int* representative;          // per group, one of its vertices
+    struct quadric* quadrics;     // per group
+    int* stamps;                  // per group, incremented every time the group changes
+    unsigned char* removed;       // per group
+    int** triangles;              // per group, the triangles around it (some may be dead)
+    int* num_triangles;
+    int* max_triangles;
+    int* marks;                   // per group, to find the distinct neighbors of a group
+    int mark;
+    int* map;                     // per vertex, the vertex it becomes during a collapse
+    struct collapse* heap;        // min-heap of the candidate collapses
+    int heap_size, heap_capacity;
+};
+
+static int heap_push(struct simplifier* s, const struct collapse* c) {
+    if (s->heap_size == s->heap_capacity) {
+        int capacity = MAX(64, s->heap_capacity * 2);
+        struct collapse* heap = (struct collapse*)realloc(s->heap, capacity * sizeof(struct collapse));
+        if (!heap) return 0;
+        s->heap = heap;
+        s->heap_capacity = capacity;
+    }
+    int i = s->heap_size++;
+    while (i > 0 && s->heap[(i - 1) / 2].cost > c->cost) {
+        s->heap[i] = s->heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    s->heap[i] = *c;
+    return 1;
+}
+
+static struct collapse heap_pop(struct simplifier* s) {
+    struct collapse top = s->heap[0];
+    struct collapse last = s->heap[--s->heap_size];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= s->heap_size) break;
+        if (child + 1 < s->heap_size && s->heap[child + 1].cost < s->heap[child].cost) child++;
+        if (s->heap[child].cost >= last.cost) break;
+        s->heap[i] = s->heap[child];
+        i = child;
+    }
+    if (s->heap_size > 0) s->heap[i] = last;
+    return top;
+}
+
+static inline const struct point3f* group_position(const struct simplifier* s, int t, int k) {
+    return &s->mesh->vertices[s->indices[t * 3 + k]];
+}
+
+static inline int triangle_has_group(const struct simplifier* s, int t, int g) {
+    return s->group[s->indices[t * 3]] == g || s->group[s->indices[t * 3 + 1]] == g || s->group[s->indices[t * 3 + 2]] == g;
+}
+
+static inline struct vec3f triangle_normal(const struct point3f* p0, const struct point3f* p1, const struct point3f* p2) {
+    float ex = p1->x - p0->x, ey = p1->y - p0->y, ez = p1->z - p0->z;
+    float fx = p2->x - p0->x, fy = p2->y - p0->y, fz = p2->z - p0->z;
+    struct vec3f n = {ey * fz - ez * fy, ez * fx - ex * fz, ex * fy - ey * fx};
+    return n;
+}
+
+static int add_group_triangle(struct simplifier* s, int g, int t) {
+    if (s->num_triangles[g] == s->max_triangles[g]) {
+        int capacity = MAX(8, s->max_triangles[g] * 2);
+        int* triangles = (int*)realloc(s->triangles[g], capacity * sizeof(int));
+        if (!triangles) return 0;
+        s->triangles[g] = triangles;
+        s->max_triangles[g] = capacity;
+    }
+    s->triangles[g][s->num_triangles[g]++] = t;
+    return 1;
+}
+
+static int queue_collapse(struct simplifier* s, int from, int to) {
+    struct quadric q = s->quadrics[from];
+    quadric_add(&q, &s->quadrics[to]);
+    struct collapse c;
+    c.cost = quadric_error(&q, &s->mesh->vertices[s->representative[to]]);
+    c.from = from;
+    c.to = to;
+    c.from_stamp = s->stamps[from];
+    c.to_stamp = s->stamps[to];
+    return heap_push(s, &c);
+}
+
+// Queue the collapses of g onto its neighbors and, if both_ways, of its neighbors onto g.
+static int queue_group_collapses(struct simplifier* s, int g, int both_ways) {
+    s->mark++;
+    for (int i = 0; i < s->num_triangles[g]; ++i) {
+        int t = s->triangles[g][i];
+        if (!s->alive[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+            int n = s->group[s->indices[t * 3 + k]];
+            if (n == g || s->marks[n] == s->mark) continue;
+            s->marks[n] = s->mark;
+            if (!queue_collapse(s, g, n) || (both_ways && !queue_collapse(s, n, g))) return 0;
+        }
+    }
+    return 1;
+}
+
+// Try to collapse the group "from" onto the group "to". Return 0 if the collapse isn't allowed.
+static int collapse_groups(struct simplifier* s, int from, int to) {
+    const int* list = s->triangles[from];
+    const int count = s->num_triangles[from];
+
+    // Map each vertex of "from" to the vertex of "to" it shares a triangle with
+    int num_shared = 0;
+    for (int i = 0; i < count; ++i) {
+        int t = list[i];
+        if (!s->alive[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+            if (s->group[s->indices[t * 3 + k]] == from) s->map[s->indices[t * 3 + k]] = -1;
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        int t = list[i];
+        if (!s->alive[t] || !triangle_has_group(s, t, to)) continue;
+        int v = -1, u = -1;
+        for (int k = 0; k < 3; ++k) {
+            int w = s->indices[t * 3 + k];
+            if (s->group[w] == to) v = w;
+            if (s->group[w] == from) u = w;
+        }
+        if (s->map[u] == -1) s->map[u] = v;
+        num_shared++;
+    }
+    if (num_shared == 0) return 0;  // the edge is gone
+
+    // A vertex of "from" that shares no triangle with "to" is on the other side of a texture seam
+    // that "to" isn't on: moving it would tear the texture. The triangles that survive the collapse
+    // must not flip or fold.
+    for (int i = 0; i < count; ++i) {
+        int t = list[i];
+        if (!s->alive[t] || triangle_has_group(s, t, to)) continue;
+        const struct point3f* p[3];
+        const struct point3f* q[3];
+        for (int k = 0; k < 3; ++k) {
+            int w = s->indices[t * 3 + k];
+            p[k] = q[k] = &s->mesh->vertices[w];
+            if (s->group[w] != from) continue;
+            if (s->map[w] == -1) return 0;
+            q[k] = &s->mesh->vertices[s->map[w]];
+        }
+        struct vec3f n0 = triangle_normal(p[0], p[1], p[2]);
+        struct vec3f n1 = triangle_normal(q[0], q[1], q[2]);
+        float d = n0.x * n1.x + n0.y * n1.y + n0.z * n1.z;
+        float l0 = n0.x * n0.x + n0.y * n0.y + n0.z * n0.z;
+        float l1 = n1.x * n1.x + n1.y * n1.y + n1.z * n1.z;
+        if (l1 == 0 || d <= LOD_MIN_NORMAL_COS * sqrtf(l0 * l1)) return 0;
+    }
+
+    // Link condition: the two groups may only have in common the neighbors of the triangles along
+    // the edge, otherwise the collapse pinches the surface
+    const int from_mark = ++s->mark;
+    for (int i = 0; i < count; ++i) {
+        int t = list[i];
+        if (!s->alive[t]) continue;
+        for (int k = 0; k < 3; ++k) s->marks[s->group[s->indices[t * 3 + k]]] = from_mark;
+    }
+    const int common_mark = ++s->mark;
+    int num_common = 0;
+    for (int i = 0; i < s->num_triangles[to]; ++i) {
+        int t = s->triangles[to][i];
+        if (!s->alive[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+            int n = s->group[s->indices[t * 3 + k]];
+            if (n == from || n == to || s->marks[n] != from_mark) continue;
+            s->marks[n] = common_mark;
+            num_common++;
+        }
+    }
+    if (num_common > num_shared) return 0;
+
+    // Collapse: the triangles along the edge go away, the others move to "to"
+    for (int i = 0; i < count; ++i) {
+        int t = list[i];
+        if (!s->alive[t]) continue;
+        if (triangle_has_group(s, t, to)) {
+            s->alive[t] = 0;
+            s->num_alive--;
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            int w = s->indices[t * 3 + k];
+            if (s->group[w] == from) s->indices[t * 3 + k] = s->map[w];
+        }
+        if (!add_group_triangle(s, to, t)) return 0;
+    }
+    quadric_add(&s->quadrics[to], &s->quadrics[from]);
+    s->removed[from] = 1;
+    s->stamps[to]++;
+    free(s->triangles[from]);
+    s->triangles[from] = NULL;
+    s->num_triangles[from] = s->max_triangles[from] = 0;
+
+    // Drop the dead triangles from the list of "to"
+    int n = 0;
+    for (int i = 0; i < s->num_triangles[to]; ++i) {
+        if (s->alive[s->triangles[to][i]]) s->triangles[to][n++] = s->triangles[to][i];
+    }
+    s->num_triangles[to] = n;
+    return 1;
+}
+
+// Make a LOD out of the triangles still alive: they keep their batch and their order, then are
+// reordered for the vertex cache and their vertices renumbered, like in create_mesh.
+static int snapshot_lod(const struct simplifier* s, struct Mesh* lod, float error) {
+    const struct Mesh* mesh = s->mesh;
+    memset(lod, 0, sizeof(struct Mesh));
+    lod->texture = mesh->texture;
+    lod->lod_error = error;
+    lod->num_triangles = s->num_alive;
+    lod->vertex_indices = (int*)malloc(MAX(1, 3 * s->num_alive) * sizeof(int));
+    lod->batches = (struct MeshBatch*)malloc(MAX(1, mesh->num_batches) * sizeof(struct MeshBatch));
+    int* remap = (int*)malloc(mesh->num_vertices * sizeof(int));
+    if (!lod->vertex_indices || !lod->batches || !remap) {
+        free(remap);
+        destroy_mesh_geometry(lod);
+        return 0;
+    }
+    int n = 0;
+    for (int b = 0; b < mesh->num_batches; ++b) {
+        const struct MeshBatch* batch = &mesh->batches[b];
+        int first = n;
+        for (int t = batch->first_triangle; t < batch->first_triangle + batch->num_triangles; ++t) {
+            if (!s->alive[t]) continue;
+            memcpy(&lod->vertex_indices[3 * n], &s->indices[3 * t], 3 * sizeof(int));
+            n++;
+        }
+        if (n == first) continue;
+        struct MeshBatch* lod_batch = &lod->batches[lod->num_batches++];
+        *lod_batch = *batch;
+        lod_batch->first_triangle = first;
+        lod_batch->num_triangles = n - first;
+        tipsify(lod->vertex_indices + first * 3, n - first, mesh->num_vertices, VERTEX_CACHE_SIZE);
+    }
+
+    memset(remap, 0xff, mesh->num_vertices * sizeof(int));
+    for (int i = 0; i < 3 * n; ++i) {
+        int v = lod->vertex_indices[i];
+        if (remap[v] == -1) remap[v] = lod->num_vertices++;
+        lod->vertex_indices[i] = remap[v];
+    }
+    lod->vertices = (struct point3f*)malloc(MAX(1, lod->num_vertices) * sizeof(struct point3f));
+    lod->uvs = mesh->uvs ? (struct uv2f*)malloc(MAX(1, lod->num_vertices) * sizeof(struct uv2f)) : NULL;
+    if (!lod->vertices || (mesh->uvs && !lod->uvs)) {
+        free(remap);
+        destroy_mesh_geometry(lod);
+        return 0;
+    }
+    lod->bbox_min.x = lod->bbox_min.y = lod->bbox_min.z = INFINITY;
+    lod->bbox_max.x = lod->bbox_max.y = lod->bbox_max.z = -INFINITY;
+    for (int v = 0; v < mesh->num_vertices; ++v) {
+        if (remap[v] == -1) continue;
+        const struct point3f* p = &mesh->vertices[v];
+        lod->vertices[remap[v]] = *p;
+        if (mesh->uvs) lod->uvs[remap[v]] = mesh->uvs[v];
+        lod->bbox_min.x = MIN(lod->bbox_min.x, p->x);
+        lod->bbox_min.y = MIN(lod->bbox_min.y, p->y);
+        lod->bbox_min.z = MIN(lod->bbox_min.z, p->z);
+        lod->bbox_max.x = MAX(lod->bbox_max.x, p->x);
+        lod->bbox_max.y = MAX(lod->bbox_max.y, p->y);
+        lod->bbox_max.z = MAX(lod->bbox_max.z, p->z);
+    }
+    free(remap);
+    return 1;
+}
+
+// Group the vertices by position index or, for a mesh that has none, by position with an open
+// addressing hash table. Welding the positions the OBJ file doesn't share would glue together
+// separate surfaces that touch (the two sides of a double-sided mesh for example). Return the
+// number of groups.
+static int group_positions(const struct Mesh* mesh, int* group, int* representative) {
+    if (mesh->position_indices) {
+        int max_index = -1;
+        for (int v = 0; v < mesh->num_vertices; ++v) max_index = MAX(max_index, mesh->position_indices[v]);
+        int* groups = (int*)malloc((max_index + 1) * sizeof(int) + 1);
+        if (!groups) return -1;
+        memset(groups, 0xff, (max_index + 1) * sizeof(int));
+        int num_groups = 0;
+        for (int v = 0; v < mesh->num_vertices; ++v) {
+            int* g = &groups[mesh->position_indices[v]];
+            if (*g == -1) {
+                *g = num_groups;
+                representative[num_groups++] = v;
+            }
+            group[v] = *g;
+        }
+        free(groups);
+        return num_groups;
+    }
+
+    uint32_t table_size = 16;
+    while (table_size < 2 * (uint32_t)mesh->num_vertices) table_size <<= 1;
+    int* table = (int*)malloc(table_size * sizeof(int));
+    if (!table) return -1;
+    memset(table, 0xff, table_size * sizeof(int));
+    int num_groups = 0;
+    for (int v = 0; v < mesh->num_vertices; ++v) {
+        const struct point3f* p = &mesh->vertices[v];
+        uint32_t bits[3];
+        memcpy(bits, p, sizeof(bits));
+        uint32_t slot = hash_corner(((uint64_t)bits[0] << 32 | bits[1]) ^ (uint64_t)bits[2] * 0x9e3779b97f4a7c15ULL) & (table_size - 1);
+        while (table[slot] != -1) {
+            const struct point3f* q = &mesh->vertices[representative[table[slot]]];
+            if (q->x == p->x && q->y == p->y && q->z == p->z) break;
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot] == -1) {
+            table[slot] = num_groups;
+            representative[num_groups++] = v;
+        }
+        group[v] = table[slot];
+    }
+    free(table);
+    return num_groups;
+}
+
+static void destroy_simplifier(struct simplifier* s) {
+    if (s->triangles) {
+        for (int g = 0; g < s->num_groups; ++g) free(s->triangles[g]);
+    }
+    free(s->indices);
+    free(s->alive);
+    free(s->group);
+    free(s->representative);
+    free(s->quadrics);
+    free(s->stamps);
+    free(s->removed);
+    free(s->triangles);
+    free(s->num_triangles);
+    free(s->max_triangles);
+    free(s->marks);
+    free(s->map);
+    free(s->heap);
+}
+
+static int init_simplifier(struct simplifier* s, const struct Mesh* mesh) {
+    memset(s, 0, sizeof(struct simplifier));
+    s->mesh = mesh;
+    const int nt = mesh->num_triangles, nv = mesh->num_vertices;
+    s->indices = (int*)malloc(MAX(1, 3 * nt) * sizeof(int));
+    s->alive = (unsigned char*)malloc(MAX(1, nt));
+    s->group = (int*)malloc(MAX(1, nv) * sizeof(int));
+    s->map = (int*)malloc(MAX(1, nv) * sizeof(int));
+    s->representative = (int*)malloc(MAX(1, nv) * sizeof(int));
+    if (!s->indices || !s->alive || !s->group || !s->map || !s->representative) return 0;
+    s->num_groups = group_positions(mesh, s->group, s->representative);
+    if (s->num_groups < 0) return 0;
+    const int ng = s->num_groups;
+    s->quadrics = (struct quadric*)calloc(MAX(1, ng), sizeof(struct quadric));
+    s->stamps = (int*)calloc(MAX(1, ng), sizeof(int));
+    s->removed = (unsigned char*)calloc(MAX(1, ng), 1);
+    s->triangles = (int**)calloc(MAX(1, ng), sizeof(int*));
+    s->num_triangles = (int*)calloc(MAX(1, ng), sizeof(int));
+    s->max_triangles = (int*)calloc(MAX(1, ng), sizeof(int));
+    s->marks = (int*)calloc(MAX(1, ng), sizeof(int));
+    if (!s->quadrics || !s->stamps || !s->removed || !s->triangles || !s->num_triangles || !s->max_triangles || !s->marks) return 0;
+
+    // Triangles with two corners at the same position have no area and are dropped right away
+    memcpy(s->indices, mesh->vertex_indices, 3 * nt * sizeof(int));
+    for (int t = 0; t < nt; ++t) {
+        int g0 = s->group[s->indices[t * 3]], g1 = s->group[s->indices[t * 3 + 1]], g2 = s->group[s->indices[t * 3 + 2]];
+        s->alive[t] = g0 != g1 && g1 != g2 && g2 != g0;
+        if (!s->alive[t]) continue;
+        s->num_alive++;
+        if (!add_group_triangle(s, g0, t) || !add_group_triangle(s, g1, t) || !add_group_triangle(s, g2, t)) return 0;
+    }
+
+    // The quadric of a group sums the planes of its triangles, weighted by their area, and the
+    // planes along the border edges (edges with a single triangle)
+    for (int t = 0; t < nt; ++t) {
+        if (!s->alive[t]) continue;
+        struct vec3f n = triangle_normal(group_position(s, t, 0), group_position(s, t, 1), group_position(s, t, 2));
+        double length = sqrt((double)n.x * n.x + (double)n.y * n.y + (double)n.z * n.z);
+        if (length == 0) continue;
+        double a = n.x / length, b = n.y / length, c = n.z / length;
+        const struct point3f* p0 = group_position(s, t, 0);
+        double d = -(a * p0->x + b * p0->y + c * p0->z);
+        for (int k = 0; k < 3; ++k) quadric_add_plane(&s->quadrics[s->group[s->indices[t * 3 + k]]], a, b, c, d, length / 2);
+
+        for (int k = 0; k < 3; ++k) {
+            int ga = s->group[s->indices[t * 3 + k]], gb = s->group[s->indices[t * 3 + (k + 1) % 3]];
+            int shared = 0;
+            for (int i = 0; i < s->num_triangles[ga] && shared < 2; ++i) shared += triangle_has_group(s, s->triangles[ga][i], gb);
+            if (shared > 1) continue;
+            const struct point3f* pa = group_position(s, t, k);
+            const struct point3f* pb = group_position(s, t, (k + 1) % 3);
+            double ex = pb->x - pa->x, ey = pb->y - pa->y, ez = pb->z - pa->z;
+            // The border plane contains the edge and is perpendicular to the triangle
+            double bx = ey * c - ez * b, by = ez * a - ex * c, bz = ex * b - ey * a;
+            double bl = sqrt(bx * bx + by * by + bz * bz);
+            if (bl == 0) continue;
+            bx /= bl; by /= bl; bz /= bl;
+            double bd = -(bx * pa->x + by * pa->y + bz * pa->z);
+            double w = (ex * ex + ey * ey + ez * ez) * LOD_BOUNDARY_WEIGHT;
+            quadric_add_plane(&s->quadrics[ga], bx, by, bz, bd, w);
+            quadric_add_plane(&s->quadrics[gb], bx, by, bz, bd, w);
+        }
+    }
+
+    for (int g = 0; g < ng; ++g) {
+        if (s->num_triangles[g] > 0 && !queue_group_collapses(s, g, 0)) return 0;
+    }
+    return 1;
+}
+
+// Build up to max_lods LODs of the mesh, each with about half the triangles of the previous one,
+// stopping before going below min_triangles triangles or when the mesh can't be simplified any
+// further. The error of a LOD is the largest root mean square distance, over all the collapses
+// made so far, between a moved position and the planes of the triangles of the full mesh it
+// stands for. Return the number of LODs.
+static int create_lods(struct Mesh* mesh, int max_lods, int min_triangles) {
+    for (int i = 0; i < mesh->num_lods; ++i) destroy_mesh_geometry(&mesh->lods[i]);
+    free(mesh->lods);
+    mesh->lods = NULL;
+    mesh->num_lods = 0;
+    if (max_lods <= 0 || mesh->num_triangles == 0) return 0;
+
+    mesh->lods = (struct Mesh*)calloc(max_lods, sizeof(struct Mesh));
+    struct simplifier s;
+    if (!mesh->lods || !init_simplifier(&s, mesh)) {
+        fprintf(stderr, "Error: Unable to allocate memory for the LODs\n");
+        if (mesh->lods) destroy_simplifier(&s);
+        free(mesh->lods);
+        mesh->lods = NULL;
+        return 0;
+    }
+
+    double max_error = 0;
+    int previous = mesh->num_triangles;
+    while (mesh->num_lods < max_lods) {
+        int target = (int)(previous * LOD_REDUCTION);
+        if (target < min_triangles) break;
+        while (s.num_alive > target && s.heap_size > 0) {
+            struct collapse c = heap_pop(&s);
+            if (s.removed[c.from] || s.removed[c.to] || s.stamps[c.from] != c.from_stamp || s.stamps[c.to] != c.to_stamp) continue;
+            double weight = s.quadrics[c.from].weight + s.quadrics[c.to].weight;
+            if (!collapse_groups(&s, c.from, c.to)) continue;
+            if (weight > 0) max_error = MAX(max_error, c.cost / weight);
+            if (!queue_group_collapses(&s, c.to, 1)) s.heap_size = 0;
+        }
+        // Stop when the collapses left are all rejected
+        if (s.num_alive > previous - (previous - target) / 2) break;
+        if (!snapshot_lod(&s, &mesh->lods[mesh->num_lods], (float)sqrt(max_error))) break;
+        mesh->num_lods++;
+        previous = s.num_alive;
+    }
+    destroy_simplifier(&s);
+    return mesh->num_lods;
+}
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include <assert.h>
 
 #include "_types.h"
@@ -12,7 +13,39 @@
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
-#define Z_THRESHOLD 0.000001f
+
+// Edge functions are evaluated with integers, on vertices snapped to 1/256th of a pixel. They are
+// then exact, which means stepping from one block of pixels to the next by adding a constant gives
+// exactly the value we'd get evaluating them from scratch, and pixels lying exactly on an edge
+// shared by two triangles go to only one of them (top-left rule). Triangles with vertices further
+// than GUARD_BAND pixels from the screen are skipped so that the edge functions can't overflow.
+#define SUBPIXEL_BITS 8
+#define SUBPIXEL_SCALE (1 << SUBPIXEL_BITS)
+#define GUARD_BAND ((float)(1 << 20))
+#define BLOCK_SIZE 4
+#define BLOCK_PIXELS (BLOCK_SIZE * BLOCK_SIZE)
+
+// Hierarchical depth buffer. We keep the largest depth of each block of pixels, and the largest
+// depth of each tile of HIZ_TILE_SIZE x HIZ_TILE_SIZE pixels. A triangle whose nearest point is
+// further than the largest depth of every tile it overlaps is hidden and is skipped altogether,
+// and blocks further than their largest depth are skipped while rasterizing.
+#define HIZ_TILE_SIZE 32
+#define HIZ_TILE_BLOCKS (HIZ_TILE_SIZE / BLOCK_SIZE)
+// The depth interpolated at a pixel can be a few ulps smaller than the smallest vertex depth
+// because of rounding errors. The triangle's nearest depth is scaled by this amount to stay conservative.
+#define HIZ_EPSILON 1e-5f
+
+// Fixed-point rasterization (context->fixed_point). Only the setup of each triangle uses floats:
+// the per-pixel depth and texture coordinates are evaluated with integers. 1/z, u/z and v/z being
+// affine in screen space, they are evaluated exactly from integer plane equations. z is then
+// computed from 1/z with a table of reciprocals, and u and v by multiplying u/z and v/z by z.
+// The depth buffer and the hierarchical depth buffer of this path hold integer depths, and the
+// mip level and the texture filtering are computed with integers too (see shade_fixed).
+#define FIXED_Q_BITS 40      // fractional bits of 1/z
+#define FIXED_UV_BITS 30     // fractional bits of u/z and v/z
+#define FIXED_Z_BITS 16      // fractional bits of z and of the perspective-correct u and v
+#define FIXED_LOD_BITS 8     // fractional bits of the mip level
+#define RECIP_TABLE_BITS 8   // the table has 2^RECIP_TABLE_BITS + 1 entries
 
 struct image {
     int width;
@@ -20,8 +53,30 @@ struct image {
     unsigned char* data; // rgba2222 format
 };
 
+// Textures are stored as a chain of mip levels, each half the size of the previous one, down to
+// 1x1. Texels are stored in tiles of TEXTURE_TILE_SIZE x TEXTURE_TILE_SIZE texels (16 bytes), so
+// that neighboring texels in both directions, which is what filtering reads, share cache lines.
+#define TEXTURE_TILE_SIZE 4
+#define MAX_MIP_LEVELS 16
+
+enum texture_filter {
+    TEXTURE_FILTER_NEAREST,    // nearest texel of the full resolution level
+    TEXTURE_FILTER_BILINEAR,   // 4 texels of the full resolution level
+    TEXTURE_FILTER_TRILINEAR   // 4 texels of the two levels closest to the pixel footprint
+};
+
+struct mip_level {
+    int width, height;
+    int tiles_x;  // number of tiles in a row
+    unsigned char* data;  // rgba2222 format, tiled
+};
+
 struct texture {
     struct image* image_ptr;
+    enum texture_filter filter;
+    int num_levels;
+    struct mip_level levels[MAX_MIP_LEVELS];
+    unsigned char* mip_data;  // storage of all the levels
 };
 
 struct extent {
@@ -40,7 +95,23 @@ struct context {
     struct screen_coordinates screen_coordinates;
     float* depth_buffer;
     unsigned char* color_buffer; // rgba2222 format
+    float* block_zmax;  // largest depth of each BLOCK_SIZE x BLOCK_SIZE block
+    float* tile_zmax;  // largest depth of each HIZ_TILE_SIZE x HIZ_TILE_SIZE tile
+    int* tile_zmax_count;  // number of blocks of the tile whose largest depth is the tile's
+    // The same buffers for the fixed-point path, with FIXED_Z_BITS fractional bits
+    int32_t* depth_buffer_fixed;
+    int32_t* block_zmax_fixed;
+    int32_t* tile_zmax_fixed;
+    int num_blocks_x, num_blocks_y;
+    int num_tiles_x, num_tiles_y;
+    int front_to_back;  // render the meshes sorted front to back (improves occlusion culling)
+    int cull_back_faces;  // skip the triangles facing away from the camera
+    int fixed_point;  // use the fixed-point rasterization path
+    float lod_pixel_error;  // largest error, in pixels, of the LOD used to draw a mesh (0 to always draw the full mesh)
+    int num_triangles_drawn;  // triangles of the meshes (or their LOD) drawn by the last call to render
     float world_to_cam[16];
+    struct point3f* vertex_buffer;  // camera space vertices of the mesh being drawn (see vertex_pass)
+    int vertex_buffer_size;
 };
 
 static inline void point_mat_mult(const struct point3f* const p, const float* m, struct point3f* xp) {
@@ -50,6 +121,75 @@ static inline void point_mat_mult(const struct point3f* const p, const float* m,
     xp->z = m[2] * p->x + m[6] * p->y + m[10] * p->z + m[14];
 }
 
+// m = a * b. Points are row vectors (p' = p * m), so m applies a first, then b.
+static inline void mat_mult(const float* a, const float* b, float* m) {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            m[i * 4 + j] = a[i * 4] * b[j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + a[i * 4 + 3] * b[12 + j];
+        }
+    }
+}
+
+// f(x, y) = a * x + b * y + c at the center of pixel (x, y), with f in fixed point.
+struct fixed_plane {
+    int64_t a, b, c;
+};
+
+// Set up the plane equation of the values f[k] at the vertices (fx[k], fy[k]) (sub-pixel
+// coordinates), with frac_bits fractional bits.
+static void fixed_plane_setup(const int64_t* fx, const int64_t* fy, const float* f, int frac_bits, struct fixed_plane* plane) {
+    double x0 = (double)fx[0] / SUBPIXEL_SCALE, y0 = (double)fy[0] / SUBPIXEL_SCALE;
+    double dx1 = (double)fx[1] / SUBPIXEL_SCALE - x0, dy1 = (double)fy[1] / SUBPIXEL_SCALE - y0;
+    double dx2 = (double)fx[2] / SUBPIXEL_SCALE - x0, dy2 = (double)fy[2] / SUBPIXEL_SCALE - y0;
+    double df1 = (double)f[1] - f[0], df2 = (double)f[2] - f[0];
+    double det = dx1 * dy2 - dx2 * dy1;
+    double a = (df1 * dy2 - df2 * dy1) / det;
+    double b = (df2 * dx1 - df1 * dx2) / det;
+    double c = f[0] + a * (0.5 - x0) + b * (0.5 - y0);
+    double scale = ldexp(1.0, frac_bits);
+    plane->a = llround(a * scale);
+    plane->b = llround(b * scale);
+    plane->c = llround(c * scale);
+}
+
+static inline int64_t fixed_plane_eval(const struct fixed_plane* plane, int x, int y) {
+    return plane->a * x + plane->b * y + plane->c;
+}
+
+// Depth z in the depth buffer of the fixed-point path, rounded down
+static inline int32_t fixed_depth(float z) {
+    return (int32_t)(z * (1 << FIXED_Z_BITS));
+}
+
+// Texture coordinates with FIXED_Z_BITS fractional bits
+struct fixed_uv {
+    int64_t u, v;
+};
+
+// recip_table[i] = 2^31 / (1 + i / 2^RECIP_TABLE_BITS), rounded
+static uint32_t recip_table[(1 << RECIP_TABLE_BITS) + 1];
+
+static void init_recip_table(void) {
+    for (int i = 0; i <= (1 << RECIP_TABLE_BITS); ++i) {
+        recip_table[i] = (uint32_t)llround(ldexp(1.0, 31) / (1.0 + (double)i / (1 << RECIP_TABLE_BITS)));
+    }
+}
+
+// Return z = 1 / q with FIXED_Z_BITS fractional bits, where q = 1/z has FIXED_Q_BITS fractional
+// bits and is positive. q = m * 2^n with m in [1, 2): 1/m is read from the table, linearly
+// interpolated using the 16 bits of m following the RECIP_TABLE_BITS bits of the index.
+static inline int64_t fixed_recip(int64_t q) {
+    const int n = 63 - __builtin_clzll(q);
+    const int mantissa_bits = RECIP_TABLE_BITS + 16;
+    uint64_t m = n >= mantissa_bits ? (uint64_t)q >> (n - mantissa_bits) : (uint64_t)q << (mantissa_bits - n);
+    int i = (int)(m >> 16) - (1 << RECIP_TABLE_BITS);
+    int64_t f = m & 0xffff;
+    int64_t r = (recip_table[i] * (0x10000 - f) + recip_table[i + 1] * f) >> 16;  // 1/m with 31 fractional bits
+    // z = 2^FIXED_Q_BITS / q = (1/m) * 2^(FIXED_Q_BITS - n)
+    const int shift = FIXED_Q_BITS + FIXED_Z_BITS - 31 - n;
+    return shift >= 0 ? r << shift : r >> -shift;
+}
+
 void set_texture(struct image* const image, const char* filename, int width, int height) {
     // Open the file in binary read mode
     FILE* file = fopen(filename, "rb");
@@ -84,6 +224,72 @@ void set_texture(struct image* const image, const char* filename, int width, int
     fclose(file);
 }
 
+static inline int texel_offset(const struct mip_level* level, int x, int y) {
+    return ((y / TEXTURE_TILE_SIZE) * level->tiles_x + x / TEXTURE_TILE_SIZE) * TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE +
+        (y % TEXTURE_TILE_SIZE) * TEXTURE_TILE_SIZE + x % TEXTURE_TILE_SIZE;
+}
+
+// The four 2-bit channels of an rgba2222 texel
+static inline int texel_channel(unsigned char texel, int c) {
+    return (texel >> (2 * c)) & 0b11;
+}
+
+// Allocate the mip levels of the texture, copy the image to the first one, and compute each of
+// the others by averaging blocks of 2x2 texels of the previous level.
+static void build_mip_chain(struct texture* texture) {
+    const struct image* image = texture->image_ptr;
+    size_t total_size = 0;
+    int width = image->width, height = image->height, num_levels = 0;
+    while (num_levels < MAX_MIP_LEVELS) {
+        struct mip_level* level = &texture->levels[num_levels++];
+        level->width = width;
+        level->height = height;
+        level->tiles_x = (width + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+        int tiles_y = (height + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+        total_size += (size_t)level->tiles_x * tiles_y * TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE;
+        if (width == 1 && height == 1) break;
+        width = MAX(1, width / 2);
+        height = MAX(1, height / 2);
+    }
+
+    texture->mip_data = (unsigned char*)calloc(total_size, 1);
+    if (!texture->mip_data) {
+        fprintf(stderr, "Error: Unable to allocate memory for texture mip levels\n");
+        return;
+    }
+    texture->num_levels = num_levels;
+
+    unsigned char* data = texture->mip_data;
+    for (int l = 0; l < num_levels; ++l) {
+        struct mip_level* level = &texture->levels[l];
+        level->data = data;
+        data += (size_t)level->tiles_x * ((level->height + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE) *
+            TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE;
+        for (int y = 0; y < level->height; ++y) {
+            for (int x = 0; x < level->width; ++x) {
+                unsigned char texel;
+                if (l == 0) {
+                    texel = image->data[y * image->width + x];
+                }
+                else {
+                    const struct mip_level* prev = &texture->levels[l - 1];
+                    int x0 = 2 * x, x1 = MIN(2 * x + 1, prev->width - 1);
+                    int y0 = 2 * y, y1 = MIN(2 * y + 1, prev->height - 1);
+                    unsigned char t[4] = {
+                        prev->data[texel_offset(prev, x0, y0)], prev->data[texel_offset(prev, x1, y0)],
+                        prev->data[texel_offset(prev, x0, y1)], prev->data[texel_offset(prev, x1, y1)]};
+                    texel = 0;
+                    for (int c = 0; c < 4; ++c) {
+                        int sum = texel_channel(t[0], c) + texel_channel(t[1], c) + texel_channel(t[2], c) + texel_channel(t[3], c);
+                        texel |= ((sum + 2) / 4) << (2 * c);
+                    }
+                }
+                level->data[texel_offset(level, x, y)] = texel;
+            }
+        }
+    }
+}
+
 struct texture* create_texture(const char* textureFilename, int textureWidth, int textureHeight) {
     // Allocate memory for the texture
     struct texture* new_texture = (struct texture*)malloc(sizeof(struct texture));
@@ -104,82 +310,307 @@ struct texture* create_texture(const char* textureFilename, int textureWidth, in
     new_texture->image_ptr->data = NULL;
     set_texture(new_texture->image_ptr, textureFilename, textureWidth, textureHeight);
 
+    new_texture->filter = TEXTURE_FILTER_TRILINEAR;
+    new_texture->num_levels = 0;
+    new_texture->mip_data = NULL;
+    if (new_texture->image_ptr->data) build_mip_chain(new_texture);
+
     return new_texture;
 }
 
-static void create_mesh(struct context* const context, struct Mesh* const mesh, const ObjData& objData, struct texture* texture) {
-    // Determine the number of vertices and triangles
-    size_t num_vertices = objData.vertices.size();
-    size_t num_faces = objData.vertex_indices.size();
-    mesh->num_triangles = num_faces / 3;
+// Indexed mesh builder. The OBJ file gives each corner of a triangle a position index and a
+// texture coordinate index. We turn each distinct (position, texture coordinate) pair into a vertex
+// of its own, so that a single index buffer addresses the positions and the texture coordinates
+// (vertices on a texture seam are duplicated). The pairs are deduplicated with an open addressing
+// hash table.
+#define VERTEX_CACHE_SIZE 16
 
-    // Allocate memory for vertices and transform them in place
-    mesh->vertices = (struct point3f*)malloc(num_vertices * sizeof(struct point3f));
-    if (!mesh->vertices) {
-        fprintf(stderr, "Error: Unable to allocate memory for mesh vertices\n");
+static inline uint32_t hash_corner(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return (uint32_t)key;
+}
+
+// Return the number of unique vertices. unique[i] is the (position, uv) index pair of the vertex i.
+static int dedup_corners(const uint32_t* position_indices, const uint32_t* uv_indices, int num_corners,
+                         int* indices, uint32_t (*unique)[2]) {
+    uint32_t table_size = 16;
+    while (table_size < 2 * (uint32_t)num_corners) table_size <<= 1;
+    int* table = (int*)malloc(table_size * sizeof(int));
+    memset(table, 0xff, table_size * sizeof(int));
+    int num_unique = 0;
+    for (int i = 0; i < num_corners; ++i) {
+        uint32_t pi = position_indices[i], ti = uv_indices ? uv_indices[i] : 0;
+        uint32_t slot = hash_corner((uint64_t)pi << 32 | ti) & (table_size - 1);
+        while (table[slot] != -1 && (unique[table[slot]][0] != pi || unique[table[slot]][1] != ti)) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot] == -1) {
+            table[slot] = num_unique;
+            unique[num_unique][0] = pi;
+            unique[num_unique][1] = ti;
+            num_unique++;
+        }
+        indices[i] = table[slot];
+    }
+    free(table);
+    return num_unique;
+}
+
+// Tipsify (Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced
+// Overdraw"). We fan around a vertex, emitting all its remaining triangles, then move on to the
+// vertex of the last triangles that will still be in a FIFO cache of cache_size vertices and has
+// the fewest triangles left, falling back to recently used vertices, then to the next vertex in
+// index order, when there is none. It runs in linear time and gives an average cache miss ratio
+// close to what much slower methods get. Triangles are reordered in place.
+static void tipsify(int* indices, int num_triangles, int num_vertices, int cache_size) {
+    int* live = (int*)calloc(num_vertices, sizeof(int));              // triangles left per vertex
+    int* offsets = (int*)malloc((num_vertices + 1) * sizeof(int));    // adjacency lists
+    int* adjacency = (int*)malloc(3 * num_triangles * sizeof(int));
+    int* cache_time = (int*)calloc(num_vertices, sizeof(int));
+    int* dead_end = (int*)malloc(3 * num_triangles * sizeof(int));
+    int* candidates = (int*)malloc(3 * num_triangles * sizeof(int));
+    char* emitted = (char*)calloc(num_triangles, 1);
+    int* output = (int*)malloc(3 * num_triangles * sizeof(int));
+
+    for (int i = 0; i < 3 * num_triangles; ++i) live[indices[i]]++;
+    offsets[0] = 0;
+    for (int v = 0; v < num_vertices; ++v) offsets[v + 1] = offsets[v] + live[v];
+    for (int i = 0; i < 3 * num_triangles; ++i) adjacency[offsets[indices[i]]++] = i / 3;
+    for (int v = num_vertices; v > 0; --v) offsets[v] = offsets[v - 1];
+    offsets[0] = 0;
+
+    int time = cache_size + 1, num_dead_end = 0, num_output = 0, cursor = 1;
+    int fanning = num_vertices ? 0 : -1;
+    while (fanning >= 0) {
+        int num_candidates = 0;
+        for (int a = offsets[fanning]; a < offsets[fanning + 1]; ++a) {
+            int t = adjacency[a];
+            if (emitted[t]) continue;
+            for (int k = 0; k < 3; ++k) {
+                int v = indices[3 * t + k];
+                output[num_output++] = v;
+                dead_end[num_dead_end++] = v;
+                candidates[num_candidates++] = v;
+                live[v]--;
+                if (time - cache_time[v] > cache_size) cache_time[v] = time++;
+            }
+            emitted[t] = 1;
+        }
+        // Pick the next fanning vertex
+        int best = -1, best_priority = -1;
+        for (int c = 0; c < num_candidates; ++c) {
+            int v = candidates[c];
+            if (live[v] <= 0) continue;
+            int priority = 0;
+            if (time - cache_time[v] + 2 * live[v] <= cache_size) priority = time - cache_time[v];
+            if (priority > best_priority) {
+                best_priority = priority;
+                best = v;
+            }
+        }
+        while (best == -1 && num_dead_end > 0) {
+            int v = dead_end[--num_dead_end];
+            if (live[v] > 0) best = v;
+        }
+        while (best == -1 && cursor < num_vertices) {
+            if (live[cursor] > 0) best = cursor;
+            cursor++;
+        }
+        fanning = best;
+    }
+    memcpy(indices, output, 3 * num_triangles * sizeof(int));
+
+    free(live);
+    free(offsets);
+    free(adjacency);
+    free(cache_time);
+    free(dead_end);
+    free(candidates);
+    free(emitted);
+    free(output);
+}
+
+// Find the texture of each batch of triangles of the OBJ file. material_textures (which can be
+// NULL) holds the texture of each material of objData, NULL for the materials without one, which
+// use the default texture. Consecutive batches with the same material (they differ by group only) are merged.
+static int create_batches(struct Mesh* const mesh, const ObjData& objData, struct texture* const* material_textures) {
+    int num_batches = 0;
+    mesh->batches = (struct MeshBatch*)malloc(MAX(1, (int)objData.batches.size()) * sizeof(struct MeshBatch));
+    if (!mesh->batches) return 0;
+    for (const ObjBatch& b : objData.batches) {
+        const struct texture* texture = mesh->texture;
+        if (material_textures && b.material >= 0 && material_textures[b.material]) texture = material_textures[b.material];
+        int first = (int)b.first_triangle;
+        int num = MIN((int)b.num_triangles, mesh->num_triangles - first);
+        if (num <= 0) continue;
+        if (num_batches > 0 && mesh->batches[num_batches - 1].material == b.material) {
+            mesh->batches[num_batches - 1].num_triangles += num;
+            continue;
+        }
+        mesh->batches[num_batches].first_triangle = first;
+        mesh->batches[num_batches].num_triangles = num;
+        mesh->batches[num_batches].texture = texture;
+        mesh->batches[num_batches].material = b.material;
+        num_batches++;
+    }
+    // An ObjData that wasn't built by ParseObj may have no batches
+    if (num_batches == 0 && mesh->num_triangles > 0) {
+        mesh->batches[0].first_triangle = 0;
+        mesh->batches[0].num_triangles = mesh->num_triangles;
+        mesh->batches[0].texture = mesh->texture;
+        mesh->batches[0].material = -1;
+        num_batches = 1;
+    }
+    mesh->num_batches = num_batches;
+    return 1;
+}
+
+static void create_mesh(struct Mesh* const mesh, const ObjData& objData, struct texture* texture, struct texture* const* material_textures) {
+    int num_corners = (int)objData.vertex_indices.size();
+    mesh->num_triangles = num_corners / 3;
+    num_corners = mesh->num_triangles * 3;
+    // A file where some faces have texture coordinates and others don't is treated as having none
+    const int has_uvs = !objData.uvs.empty() && objData.uv_indices.size() == objData.vertex_indices.size();
+    if (!objData.uvs.empty() && !has_uvs) {
+        fprintf(stderr, "Warning: Ignoring the texture coordinates, not every face has some\n");
+    }
+    mesh->normals = NULL;
+    mesh->normal_indices = NULL;
+    mesh->position_indices = NULL;
+    mesh->uv_indices = NULL;  // the texture coordinates use vertex_indices
+    mesh->texture = texture;
+    mesh->batches = NULL;
+    mesh->num_batches = 0;
+    mesh->lods = NULL;
+    mesh->num_lods = 0;
+    mesh->lod_error = 0;
+    // The textures of the materials belong to the mesh from now on
+    mesh->material_textures = NULL;
+    mesh->num_material_textures = 0;
+    if (material_textures) {
+        mesh->material_textures = (struct texture**)malloc(MAX(1, (int)objData.materials.size()) * sizeof(struct texture*));
+        if (mesh->material_textures) {
+            for (size_t i = 0; i < objData.materials.size(); ++i) {
+                struct texture* t = material_textures[i];
+                int known = !t || t == texture;
+                for (int j = 0; j < mesh->num_material_textures && !known; ++j) known = mesh->material_textures[j] == t;
+                if (!known) mesh->material_textures[mesh->num_material_textures++] = t;
+            }
+        }
+    }
+
+    // Build the index buffer and the unique vertices
+    mesh->vertex_indices = (int*)malloc(num_corners * sizeof(int));
+    uint32_t (*unique)[2] = (uint32_t (*)[2])malloc(num_corners * sizeof(*unique));
+    if (!mesh->vertex_indices || !unique || !create_batches(mesh, objData, material_textures)) {
+        fprintf(stderr, "Error: Unable to allocate memory for the mesh indices\n");
+        free(mesh->vertex_indices);
+        free(unique);
+        mesh->vertex_indices = NULL;
+        mesh->num_triangles = 0;
+        mesh->num_batches = 0;
         return;
     }
+    int num_vertices = dedup_corners(objData.vertex_indices.data(), has_uvs ? objData.uv_indices.data() : NULL,
+                                     num_corners, mesh->vertex_indices, unique);
 
-    for (size_t i = 0; i < num_vertices; ++i) {
-        struct point3f temp_point = { objData.vertices[i].x, objData.vertices[i].y, objData.vertices[i].z };
-        point_mat_mult(&temp_point, context->world_to_cam, &mesh->vertices[i]);
+    // Reorder the triangles of each batch for vertex cache locality (the triangles don't move from
+    // one batch to another), then renumber the vertices in the order the triangles first use them
+    // so that the vertices are also read mostly sequentially
+    for (int i = 0; i < mesh->num_batches; ++i) {
+        const struct MeshBatch* batch = &mesh->batches[i];
+        tipsify(mesh->vertex_indices + batch->first_triangle * 3, batch->num_triangles, num_vertices, VERTEX_CACHE_SIZE);
+    }
+    int* remap = (int*)malloc(num_vertices * sizeof(int));
+    memset(remap, 0xff, num_vertices * sizeof(int));
+    int next = 0;
+    for (int i = 0; i < num_corners; ++i) {
+        int v = mesh->vertex_indices[i];
+        if (remap[v] == -1) remap[v] = next++;
+        mesh->vertex_indices[i] = remap[v];
     }
 
-    // Allocate memory for face vertex uv_indices and copy data
-    mesh->vertex_indices = (int*)malloc(num_faces * sizeof(int));
-    if (!mesh->vertex_indices) {
-        fprintf(stderr, "Error: Unable to allocate memory for face vertex uv_indices\n");
+    // Allocate memory for vertices (in object space, they are transformed at render time)
+    mesh->vertices = (struct point3f*)malloc(num_vertices * sizeof(struct point3f));
+    mesh->uvs = has_uvs ? (struct uv2f*)malloc(num_vertices * sizeof(struct uv2f)) : NULL;
+    mesh->position_indices = (int*)malloc(num_vertices * sizeof(int));
+    if (!mesh->vertices || (has_uvs && !mesh->uvs) || !mesh->position_indices) {
+        fprintf(stderr, "Error: Unable to allocate memory for mesh vertices\n");
         free(mesh->vertices);
+        free(mesh->uvs);
+        free(mesh->position_indices);
+        free(mesh->vertex_indices);
+        free(unique);
+        free(remap);
+        mesh->vertices = NULL;
+        mesh->uvs = NULL;
+        mesh->position_indices = NULL;
+        mesh->vertex_indices = NULL;
+        mesh->num_triangles = 0;
         return;
     }
-    memcpy(mesh->vertex_indices, objData.vertex_indices.data(), num_faces * sizeof(int));
-
-    // Allocate and copy texture coordinates and uv_indices, if available
-    if (!objData.uvs.empty()) {
-        size_t num_uvs = objData.uvs.size();
-        mesh->uvs = (struct uv2f*)malloc(num_uvs * sizeof(struct uv2f));
-        if (!mesh->uvs) {
-            fprintf(stderr, "Error: Unable to allocate memory for texture coordinates\n");
-            free(mesh->vertices);
-            free(mesh->vertex_indices);
-            return;
-        }
-
-        for (size_t i = 0; i < num_uvs; ++i) {
-            mesh->uvs[i].u = objData.uvs[i].x;
-            mesh->uvs[i].v = objData.uvs[i].y;
+    for (int i = 0; i < num_vertices; ++i) {
+        const Vec3f& p = objData.vertices[unique[i][0]];
+        struct point3f* v = &mesh->vertices[remap[i]];
+        v->x = p.x;
+        v->y = p.y;
+        v->z = p.z;
+        mesh->position_indices[remap[i]] = (int)unique[i][0];
+        if (has_uvs) {
+            mesh->uvs[remap[i]].u = objData.uvs[unique[i][1]].x;
+            mesh->uvs[remap[i]].v = objData.uvs[unique[i][1]].y;
         }
+    }
+    mesh->num_vertices = num_vertices;
+    free(unique);
+    free(remap);
 
-        size_t num_uv_indices = objData.uv_indices.size();
-        mesh->uv_indices = (int*)malloc(num_uv_indices * sizeof(int));
-        if (!mesh->uv_indices) {
-            fprintf(stderr, "Error: Unable to allocate memory for texture uv_indices\n");
-            free(mesh->vertices);
-            free(mesh->vertex_indices);
-            free(mesh->uvs);
-            return;
-        }
-        memcpy(mesh->uv_indices, objData.uv_indices.data(), num_uv_indices * sizeof(int));
-    } else {
-        mesh->uvs = nullptr;
-        mesh->uv_indices = nullptr;
+    // Compute the bounding box of the mesh, used to reject meshes outside of the viewing frustum
+    mesh->bbox_min.x = mesh->bbox_min.y = mesh->bbox_min.z = INFINITY;
+    mesh->bbox_max.x = mesh->bbox_max.y = mesh->bbox_max.z = -INFINITY;
+    for (int i = 0; i < num_vertices; ++i) {
+        const struct point3f* v = &mesh->vertices[i];
+        mesh->bbox_min.x = MIN(mesh->bbox_min.x, v->x);
+        mesh->bbox_min.y = MIN(mesh->bbox_min.y, v->y);
+        mesh->bbox_min.z = MIN(mesh->bbox_min.z, v->z);
+        mesh->bbox_max.x = MAX(mesh->bbox_max.x, v->x);
+        mesh->bbox_max.y = MAX(mesh->bbox_max.y, v->y);
+        mesh->bbox_max.z = MAX(mesh->bbox_max.z, v->z);
     }
+}
 
-    // Assign the pre-created texture to the mesh
-    mesh->texture = texture;
+static void destroy_texture(struct texture* texture) {
+	if (!texture) return;
+	free(texture->image_ptr->data);
+	free(texture->image_ptr);
+	free(texture->mip_data);
+	free(texture);
 }
 
-static void destroy_mesh(struct Mesh* mesh) {
+// Free the arrays of the mesh and its LODs, but not the textures, which the LODs share with the mesh.
+static void destroy_mesh_geometry(struct Mesh* mesh) {
 	free(mesh->vertices);
+	free(mesh->position_indices);
 	free(mesh->vertex_indices);
 	free(mesh->uvs);
 	free(mesh->uv_indices);
-	free(mesh->texture->image_ptr->data);
-	free(mesh->texture->image_ptr);
-	free(mesh->texture);
+	free(mesh->batches);
+	for (int i = 0; i < mesh->num_lods; ++i) destroy_mesh_geometry(&mesh->lods[i]);
+	free(mesh->lods);
+	mesh->lods = NULL;
+	mesh->num_lods = 0;
+}
+
+static inline void destroy_mesh(struct Mesh* mesh) {
+	destroy_mesh_geometry(mesh);
+	destroy_texture(mesh->texture);
+	for (int i = 0; i < mesh->num_material_textures; ++i) destroy_texture(mesh->material_textures[i]);
+	free(mesh->material_textures);
 }
 
-static void context_init(struct context* context, const Camera& camera) {
+static inline void context_init(struct context* context, const Camera& camera) {
     context->extent.width = context->extent.width;  // Keep window width
     context->extent.height = context->extent.height;  // Keep window height
     
@@ -197,12 +628,60 @@ static void context_init(struct context* context, const Camera& camera) {
     context->screen_coordinates.l = -context->screen_coordinates.r;
     context->screen_coordinates.b = -context->screen_coordinates.t;
 
+    context->front_to_back = 1;
+    context->cull_back_faces = 1;
+    context->fixed_point = 0;
+    context->lod_pixel_error = 1;
+    context->num_triangles_drawn = 0;
+
     // Set the world-to-camera matrix using the camera's transformation
     Matrix44f worldToCamera = camera.getWorldToCameraMatrix();
     memcpy(context->world_to_cam, &worldToCamera, sizeof(worldToCamera));
+
+    context->vertex_buffer = NULL;
+    context->vertex_buffer_size = 0;
+
+    init_recip_table();
 }
 
-static void prepare_buffers(struct context* context) {
+// Set the depth buffer and the largest depths of the blocks and tiles to the far plane value
+template<typename Depth>
+static void clear_depth(struct context* context, Depth* depth_buffer, Depth* block_zmax, Depth* tile_zmax, Depth zfar) {
+    int array_size = context->extent.width * context->extent.height;
+    for (int i = 0; i < array_size; ++i) {
+        depth_buffer[i] = zfar;
+    }
+    for (int i = 0; i < context->num_blocks_x * context->num_blocks_y; ++i) {
+        block_zmax[i] = zfar;
+    }
+    for (int ty = 0; ty < context->num_tiles_y; ++ty) {
+        for (int tx = 0; tx < context->num_tiles_x; ++tx) {
+            int bw = MIN(HIZ_TILE_BLOCKS, context->num_blocks_x - tx * HIZ_TILE_BLOCKS);
+            int bh = MIN(HIZ_TILE_BLOCKS, context->num_blocks_y - ty * HIZ_TILE_BLOCKS);
+            tile_zmax[ty * context->num_tiles_x + tx] = zfar;
+            context->tile_zmax_count[ty * context->num_tiles_x + tx] = bw * bh;
+        }
+    }
+}
+
+// Called before rendering each frame. The loops are simple enough for the compiler to vectorize.
+// Only the depth buffers of the path being used are cleared.
+static void clear_buffers(struct context* context) {
+    int array_size = context->extent.width * context->extent.height;
+
+    // Initialize color buffer to 0x00 (transparent)
+    memset(context->color_buffer, 0x00, array_size);
+
+    if (context->fixed_point) {
+        clear_depth(context, context->depth_buffer_fixed, context->block_zmax_fixed, context->tile_zmax_fixed,
+                    fixed_depth(context->zfar));
+    }
+    else {
+        clear_depth(context, context->depth_buffer, context->block_zmax, context->tile_zmax, context->zfar);
+    }
+}
+
+static inline void prepare_buffers(struct context* context) {
     int array_size = context->extent.width * context->extent.height;
 
     // Allocate memory for depth buffer
@@ -220,19 +699,36 @@ static void prepare_buffers(struct context* context) {
         return;
     }
 
-    // Initialize color buffer to 0x00 (transparent)
-    memset(context->color_buffer, 0x00, array_size);
-
-    // Initialize depth buffer to the far plane value
-    for (int i = 0; i < array_size; ++i) {
-        context->depth_buffer[i] = context->zfar;
+    // Allocate memory for the hierarchical depth buffer
+    context->num_blocks_x = (context->extent.width + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    context->num_blocks_y = (context->extent.height + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    context->num_tiles_x = (context->extent.width + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE;
+    context->num_tiles_y = (context->extent.height + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE;
+    context->block_zmax = (float*)malloc(sizeof(float) * context->num_blocks_x * context->num_blocks_y);
+    context->tile_zmax = (float*)malloc(sizeof(float) * context->num_tiles_x * context->num_tiles_y);
+    context->tile_zmax_count = (int*)malloc(sizeof(int) * context->num_tiles_x * context->num_tiles_y);
+    context->depth_buffer_fixed = (int32_t*)malloc(sizeof(int32_t) * array_size);
+    context->block_zmax_fixed = (int32_t*)malloc(sizeof(int32_t) * context->num_blocks_x * context->num_blocks_y);
+    context->tile_zmax_fixed = (int32_t*)malloc(sizeof(int32_t) * context->num_tiles_x * context->num_tiles_y);
+    if (!context->block_zmax || !context->tile_zmax || !context->tile_zmax_count ||
+        !context->depth_buffer_fixed || !context->block_zmax_fixed || !context->tile_zmax_fixed) {
+        fprintf(stderr, "Error: Unable to allocate memory for hierarchical depth buffer\n");
+        free(context->depth_buffer);
+        free(context->color_buffer);
+        free(context->block_zmax);
+        free(context->tile_zmax);
+        free(context->tile_zmax_count);
+        free(context->depth_buffer_fixed);
+        free(context->block_zmax_fixed);
+        free(context->tile_zmax_fixed);
+        return;
     }
+
+    clear_buffers(context);
 }
 
+// p must be in front of the near clipping plane (see clip_polygon)
 static inline void persp_divide(struct point3f* p, const float znear) {
-    if (p->z > -Z_THRESHOLD) {
-        p->z = -Z_THRESHOLD;  // Prevent division by zero or extremely small values
-    }
     float inv_z = 1.0f / -p->z;  // Calculate the inverse of z once
     p->x = p->x * inv_z * znear;
     p->y = p->y * inv_z * znear;
@@ -263,112 +759,658 @@ static inline float edge(const struct point3f* const a, const struct point3f* co
     return (test->x - a->x) * (b->y - a->y) - (test->y - a->y) * (b->x - a->x);
 }
 
-static void shade(const struct texture* texture, struct uv2f uv, unsigned char* ci) {
-    if (texture->image_ptr != NULL) {
-        const struct image* const image = texture->image_ptr;
-        float u = uv.u;
-        float v = uv.v;
+// E(x, y) = a * x + b * y + c at the center of pixel (x, y), positive inside the triangle.
+// bias is 0 for top and left edges and 1 otherwise, and is already subtracted from c.
+struct edge_eq {
+    int64_t a, b, c;
+    int64_t bias;
+};
 
+// Set up the edge function of the edge going from (ax, ay) to (bx, by) (fixed-point raster coordinates).
+static inline void edge_setup(int64_t ax, int64_t ay, int64_t bx, int64_t by, struct edge_eq* const e) {
+    int64_t dx = bx - ax, dy = by - ay;
+    e->a = dy * SUBPIXEL_SCALE;
+    e->b = -dx * SUBPIXEL_SCALE;
+    e->c = (dy - dx) * (SUBPIXEL_SCALE / 2) - ax * dy + ay * dx;
+    // The interior is on the right of a left edge (dy > 0, y points down) and below a top edge
+    // (horizontal edge with dx < 0). Samples lying on any other edge are not covered.
+    int top_left = (dy > 0) || (dy == 0 && dx < 0);
+    e->bias = top_left ? 0 : 1;
+    e->c -= e->bias;
+}
+
+// Accumulate the channels of the texels of level surrounding (u, v), weighted by the bilinear
+// filter weights times weight. Texture coordinates are clamped to the edge of the texture.
+static inline void sample_bilinear(const struct mip_level* level, float u, float v, float weight, float* channels) {
+    float x = u * level->width - 0.5f;
+    float y = v * level->height - 0.5f;
+    float fx = floorf(x), fy = floorf(y);
+    float tx = x - fx, ty = y - fy;
+    int x0 = MIN(MAX((int)fx, 0), level->width - 1), x1 = MIN(MAX((int)fx + 1, 0), level->width - 1);
+    int y0 = MIN(MAX((int)fy, 0), level->height - 1), y1 = MIN(MAX((int)fy + 1, 0), level->height - 1);
+    unsigned char t[4] = {
+        level->data[texel_offset(level, x0, y0)], level->data[texel_offset(level, x1, y0)],
+        level->data[texel_offset(level, x0, y1)], level->data[texel_offset(level, x1, y1)]};
+    float w[4] = {(1 - tx) * (1 - ty) * weight, tx * (1 - ty) * weight, (1 - tx) * ty * weight, tx * ty * weight};
+    for (int c = 0; c < 4; ++c) {
+        channels[c] += texel_channel(t[0], c) * w[0] + texel_channel(t[1], c) * w[1] +
+                       texel_channel(t[2], c) * w[2] + texel_channel(t[3], c) * w[3];
+    }
+}
+
+// Shade a pixel. lod is the mip level matching the pixel footprint (log2 of the number of texels
+// covered by the pixel along its largest side, see quad_lod).
+static void shade(const struct texture* texture, struct uv2f uv, float lod, unsigned char* ci) {
+    if (texture->num_levels == 0) return;
+
+    const struct mip_level* level = &texture->levels[0];
+    if (texture->filter == TEXTURE_FILTER_NEAREST) {
         // Convert normalized coordinates to texel coordinates
         struct point2i texel;
-		texel.x = (int)fminf(u * image->width, image->width - 1);
-		texel.y = (int)fminf(v * image->height, image->height - 1);
+        texel.x = (int)fminf(uv.u * level->width, level->width - 1);
+        texel.y = (int)fminf(uv.v * level->height, level->height - 1);
 
         // Get the color from the texture at the texel position
-        unsigned char texel_color = image->data[texel.y * image->width + texel.x]; // rgba2222 format
+        *ci = level->data[texel_offset(level, texel.x, texel.y)]; // rgba2222 format
+        return;
+    }
+
+    float channels[4] = {0, 0, 0, 0};
+    if (texture->filter == TEXTURE_FILTER_BILINEAR || lod <= 0) {
+        sample_bilinear(level, uv.u, uv.v, 1, channels);
+    }
+    else {
+        lod = MIN(lod, texture->num_levels - 1);
+        int l = MIN((int)lod, texture->num_levels - 2);
+        float t = lod - l;
+        if (l < 0) l = 0, t = 0;  // single level texture
+        sample_bilinear(&texture->levels[l], uv.u, uv.v, 1 - t, channels);
+        if (t > 0) sample_bilinear(&texture->levels[l + 1], uv.u, uv.v, t, channels);
+    }
+
+    // Quantize back to rgba2222
+    unsigned char color = 0;
+    for (int c = 0; c < 4; ++c) {
+        color |= MIN((int)(channels[c] + 0.5f), 3) << (2 * c);
+    }
+    *ci = color;
+}
+
+// The mip level to use for the 2x2 pixels of a quad, from the differences between the texture
+// coordinates of horizontally and vertically adjacent pixels (like GPUs, which always shade
+// pixels by groups of 2x2). uv holds the texture coordinates of the top-left, top-right,
+// bottom-left and bottom-right pixels.
+static inline float quad_lod(const struct texture* texture, const struct uv2f* uv) {
+    if (texture->filter != TEXTURE_FILTER_TRILINEAR || texture->num_levels == 0) return 0;
+    float width = texture->levels[0].width, height = texture->levels[0].height;
+    float dudx = (uv[1].u - uv[0].u) * width, dvdx = (uv[1].v - uv[0].v) * height;
+    float dudy = (uv[2].u - uv[0].u) * width, dvdy = (uv[2].v - uv[0].v) * height;
+    float rho2 = MAX(dudx * dudx + dvdx * dvdx, dudy * dudy + dvdy * dvdy);
+    float lod = 0.5f * log2f(rho2);
+    // Also catches NaNs, from pixels of the quad lying far outside of the triangle
+    return lod > 0 ? lod : 0;
+}
+
+// Fixed-point version of sample_bilinear: u and v have FIXED_Z_BITS fractional bits, the filter
+// weights 8 and weight FIXED_LOD_BITS, so that channels holds the channels times 2^24.
+static inline void sample_bilinear_fixed(const struct mip_level* level, int64_t u, int64_t v, int weight, int* channels) {
+    int64_t x = u * level->width - (1 << (FIXED_Z_BITS - 1));
+    int64_t y = v * level->height - (1 << (FIXED_Z_BITS - 1));
+    int64_t fx = x >> FIXED_Z_BITS, fy = y >> FIXED_Z_BITS;
+    int tx = (int)(x >> (FIXED_Z_BITS - 8)) & 0xff, ty = (int)(y >> (FIXED_Z_BITS - 8)) & 0xff;
+    int x0 = (int)MIN(MAX(fx, 0), level->width - 1), x1 = (int)MIN(MAX(fx + 1, 0), level->width - 1);
+    int y0 = (int)MIN(MAX(fy, 0), level->height - 1), y1 = (int)MIN(MAX(fy + 1, 0), level->height - 1);
+    unsigned char t[4] = {
+        level->data[texel_offset(level, x0, y0)], level->data[texel_offset(level, x1, y0)],
+        level->data[texel_offset(level, x0, y1)], level->data[texel_offset(level, x1, y1)]};
+    int w[4] = {(256 - tx) * (256 - ty) * weight, tx * (256 - ty) * weight, (256 - tx) * ty * weight, tx * ty * weight};
+    for (int c = 0; c < 4; ++c) {
+        channels[c] += texel_channel(t[0], c) * w[0] + texel_channel(t[1], c) * w[1] +
+                       texel_channel(t[2], c) * w[2] + texel_channel(t[3], c) * w[3];
+    }
+}
+
+// Fixed-point version of shade: the texture coordinates have FIXED_Z_BITS fractional bits and
+// lod FIXED_LOD_BITS.
+static void shade_fixed(const struct texture* texture, struct fixed_uv uv, int lod, unsigned char* ci) {
+    if (texture->num_levels == 0) return;
+
+    const struct mip_level* level = &texture->levels[0];
+    if (texture->filter == TEXTURE_FILTER_NEAREST) {
+        struct point2i texel;
+        texel.x = (int)MIN(MAX((uv.u * level->width) >> FIXED_Z_BITS, 0), level->width - 1);
+        texel.y = (int)MIN(MAX((uv.v * level->height) >> FIXED_Z_BITS, 0), level->height - 1);
+        *ci = level->data[texel_offset(level, texel.x, texel.y)];
+        return;
+    }
+
+    const int one = 1 << FIXED_LOD_BITS;
+    int channels[4] = {0, 0, 0, 0};
+    if (texture->filter == TEXTURE_FILTER_BILINEAR || lod <= 0) {
+        sample_bilinear_fixed(level, uv.u, uv.v, one, channels);
+    }
+    else {
+        lod = MIN(lod, (texture->num_levels - 1) << FIXED_LOD_BITS);
+        int l = MIN(lod >> FIXED_LOD_BITS, texture->num_levels - 2);
+        int t = lod - (l << FIXED_LOD_BITS);
+        if (l < 0) l = 0, t = 0;  // single level texture
+        sample_bilinear_fixed(&texture->levels[l], uv.u, uv.v, one - t, channels);
+        if (t > 0) sample_bilinear_fixed(&texture->levels[l + 1], uv.u, uv.v, t, channels);
+    }
+
+    // Quantize back to rgba2222
+    unsigned char color = 0;
+    for (int c = 0; c < 4; ++c) {
+        color |= MIN((channels[c] + (1 << 23)) >> 24, 3) << (2 * c);
+    }
+    *ci = color;
+}
+
+// Fixed-point version of quad_lod, returning the mip level with FIXED_LOD_BITS fractional bits.
+// log2(2^n * (1 + f)), with f in [0, 1), is approximated by n + f + 0.347 * f * (1 - f), which is
+// off by 0.01 at most with 8 bits of f.
+static inline int quad_lod_fixed(const struct texture* texture, const struct fixed_uv* uv) {
+    if (texture->filter != TEXTURE_FILTER_TRILINEAR || texture->num_levels == 0) return 0;
+    const int64_t width = texture->levels[0].width, height = texture->levels[0].height;
+    // Pixels of the quad far outside of the triangle can have huge texture coordinates: the
+    // differences are clamped so that neither the products nor the sums of their squares overflow
+    const int64_t dmax = INT32_MAX;
+    int64_t d[4] = {uv[1].u - uv[0].u, uv[1].v - uv[0].v, uv[2].u - uv[0].u, uv[2].v - uv[0].v};
+    for (int k = 0; k < 4; ++k) {
+        d[k] = MIN(MAX(d[k], -dmax), dmax) * (k % 2 ? height : width);
+        d[k] = MIN(MAX(d[k], -dmax), dmax);
+    }
+    // 2 * FIXED_Z_BITS fractional bits
+    uint64_t rho2 = MAX((uint64_t)(d[0] * d[0]) + (uint64_t)(d[1] * d[1]), (uint64_t)(d[2] * d[2]) + (uint64_t)(d[3] * d[3]));
+    if (rho2 == 0) return 0;
+    const int n = 63 - __builtin_clzll(rho2);
+    const int one = 1 << FIXED_LOD_BITS;
+    int f = (int)((n >= FIXED_LOD_BITS ? rho2 >> (n - FIXED_LOD_BITS) : rho2 << (FIXED_LOD_BITS - n)) & (one - 1));
+    f += (f * (one - f) * 89) >> (2 * FIXED_LOD_BITS);  // 89 = 0.347 * 2^FIXED_LOD_BITS
+    int lod = ((n - 2 * FIXED_Z_BITS) * one + f) / 2;
+    return lod > 0 ? lod : 0;
+}
+
+// Update the largest depth of the block whose top-left pixel is (bx, by) after the pixel(s) that had
+// it were written to, and the largest depth of the tile containing it if needed. Depth is float or
+// int32_t, for the floating-point and the fixed-point paths.
+template<typename Depth>
+static inline void hiz_update(struct context* context, const Depth* depth_buffer, Depth* block_zmax_buffer,
+                              Depth* tile_zmax, int bx, int by) {
+    int width = context->extent.width;
+    int xend = MIN(bx + BLOCK_SIZE, width), yend = MIN(by + BLOCK_SIZE, context->extent.height);
+    Depth zmax = 0;
+    for (int y = by; y < yend; ++y) {
+        for (int x = bx; x < xend; ++x) {
+            zmax = MAX(zmax, depth_buffer[y * width + x]);
+        }
+    }
+
+    Depth* block_zmax = &block_zmax_buffer[(by / BLOCK_SIZE) * context->num_blocks_x + bx / BLOCK_SIZE];
+    int tile_index = (by / HIZ_TILE_SIZE) * context->num_tiles_x + bx / HIZ_TILE_SIZE;
+    Depth old_zmax = *block_zmax;
+    *block_zmax = zmax;
+    // Depths only ever decrease: the tile's largest depth only changes once none of its blocks has it anymore
+    if (zmax < old_zmax && old_zmax == tile_zmax[tile_index] && --context->tile_zmax_count[tile_index] == 0) {
+        int bx0 = (bx / HIZ_TILE_SIZE) * HIZ_TILE_BLOCKS, by0 = (by / HIZ_TILE_SIZE) * HIZ_TILE_BLOCKS;
+        int bx1 = MIN(bx0 + HIZ_TILE_BLOCKS, context->num_blocks_x);
+        int by1 = MIN(by0 + HIZ_TILE_BLOCKS, context->num_blocks_y);
+        zmax = 0;
+        int count = 0;
+        for (int j = by0; j < by1; ++j) {
+            for (int i = bx0; i < bx1; ++i) {
+                Depth block_z = block_zmax_buffer[j * context->num_blocks_x + i];
+                if (block_z > zmax) zmax = block_z, count = 0;
+                count += block_z == zmax;
+            }
+        }
+        tile_zmax[tile_index] = zmax;
+        context->tile_zmax_count[tile_index] = count;
+    }
+}
 
-        // Store the color in the destination buffer
-        *ci = texel_color;
+// Returns 1 if a triangle whose nearest depth is z_min is hidden in every tile of the pixel region [x0, x1] x [y0, y1].
+template<typename Depth>
+static inline int hiz_occluded(const struct context* context, const Depth* tile_zmax, int x0, int y0, int x1, int y1, Depth z_min) {
+    for (int ty = y0 / HIZ_TILE_SIZE; ty <= y1 / HIZ_TILE_SIZE; ++ty) {
+        for (int tx = x0 / HIZ_TILE_SIZE; tx <= x1 / HIZ_TILE_SIZE; ++tx) {
+            if (z_min < tile_zmax[ty * context->num_tiles_x + tx]) return 0;
+        }
     }
+    return 1;
 }
 
-static inline void rasterize(int x0, int y0, int x1, int y1, 
+static inline void rasterize(int x0, int y0, int x1, int y1, float z_min,
                              const struct point3f* const p0, const struct point3f* const p1, const struct point3f* const p2, 
                              const struct uv2f* const uv0, const struct uv2f* const uv1, const struct uv2f* const uv2,
-                             const struct Mesh* const mesh,
+                             const struct texture* const texture,
                              struct context* context) {
-    float inv_area = 1.0f / edge(p0, p1, p2);  // Precompute the inverse of the area
-    struct point3f pixel, sample;
-    pixel.y = y0;
-
-    for (int j = y0, row = y0 * context->extent.width; j <= y1; ++j, pixel.y += 1, row += context->extent.width) {
-        pixel.x = x0;
-        for (int i = x0, index = row + x0; i <= x1; ++i, pixel.x += 1, ++index) {
-            sample.x = pixel.x + 0.5f;
-            sample.y = pixel.y + 0.5f;
-
-            float w0 = edge(p1, p2, &sample) * inv_area;
-            float w1 = edge(p2, p0, &sample) * inv_area;
-            float w2 = edge(p0, p1, &sample) * inv_area;
-
-            if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
-                float one_over_z = w0 / p0->z + w1 / p1->z + w2 / p2->z;
-                float z = 1.0f / one_over_z;
-
-                // Z-buffer test
-                if (z < context->depth_buffer[index]) {
-                    context->depth_buffer[index] = z;
-
-                    // Interpolate the texture coordinates
-                    struct uv2f uv;
-                    uv.u = (uv0->u * w0 + uv1->u * w1 + uv2->u * w2) * z;
-                    uv.v = (uv0->v * w0 + uv1->v * w1 + uv2->v * w2) * z;
-
-                    // Shade the pixel and update the color buffer
-                    shade(mesh->texture, uv, &context->color_buffer[index]);
+    const struct point3f* p[3] = {p0, p1, p2};
+    const struct uv2f* uv[3] = {uv0, uv1, uv2};
+
+    // Snap the vertices to the sub-pixel grid
+    int64_t fx[3], fy[3];
+    for (int k = 0; k < 3; ++k) {
+        if (fabsf(p[k]->x) > GUARD_BAND || fabsf(p[k]->y) > GUARD_BAND) return;
+        fx[k] = (int64_t)floorf(p[k]->x * SUBPIXEL_SCALE + 0.5f);
+        fy[k] = (int64_t)floorf(p[k]->y * SUBPIXEL_SCALE + 0.5f);
+    }
+
+    int64_t area = (fx[2] - fx[0]) * (fy[1] - fy[0]) - (fy[2] - fy[0]) * (fx[1] - fx[0]);
+    if (area == 0) return;
+    // Front faces (counter-clockwise in the OBJ file) have a positive area in raster space, y
+    // pointing down. Unless back faces are culled, swap two vertices of back-facing triangles so
+    // that the edge functions are positive inside.
+    if (area < 0 && context->cull_back_faces) return;
+    if (area < 0) {
+        int64_t tx = fx[1], ty = fy[1];
+        fx[1] = fx[2], fy[1] = fy[2], fx[2] = tx, fy[2] = ty;
+        const struct point3f* tp = p[1]; p[1] = p[2]; p[2] = tp;
+        const struct uv2f* tuv = uv[1]; uv[1] = uv[2]; uv[2] = tuv;
+        area = -area;
+    }
+    float inv_area = 1.0f / area;  // Precompute the inverse of the area
+    float inv_z[3] = {1.0f / p[0]->z, 1.0f / p[1]->z, 1.0f / p[2]->z};
+
+    // Plane equations of 1/z, u/z and v/z for the fixed-point path
+    struct fixed_plane q_plane, u_plane, v_plane;
+    const int32_t zq_max = fixed_depth(context->zfar), zq_min = fixed_depth(z_min);
+    if (context->fixed_point) {
+        float u[3] = {uv[0]->u, uv[1]->u, uv[2]->u}, v[3] = {uv[0]->v, uv[1]->v, uv[2]->v};
+        fixed_plane_setup(fx, fy, inv_z, FIXED_Q_BITS, &q_plane);
+        fixed_plane_setup(fx, fy, u, FIXED_UV_BITS, &u_plane);
+        fixed_plane_setup(fx, fy, v, FIXED_UV_BITS, &v_plane);
+    }
+
+    struct edge_eq e[3];
+    edge_setup(fx[1], fy[1], fx[2], fy[2], &e[0]);
+    edge_setup(fx[2], fy[2], fx[0], fy[0], &e[1]);
+    edge_setup(fx[0], fy[0], fx[1], fy[1], &e[2]);
+
+    // Offset of each pixel of a block relative to the block's top-left pixel. The edge functions
+    // being linear, their smallest and largest values over a block are found by adding the smallest
+    // and largest offsets to their value at the top-left pixel.
+    int64_t offsets[3][BLOCK_PIXELS], min_offset[3], max_offset[3], e_row[3];
+    for (int k = 0; k < 3; ++k) {
+        for (int j = 0; j < BLOCK_PIXELS; ++j) {
+            offsets[k][j] = e[k].a * (j % BLOCK_SIZE) + e[k].b * (j / BLOCK_SIZE);
+        }
+        min_offset[k] = MIN(0, e[k].a * (BLOCK_SIZE - 1)) + MIN(0, e[k].b * (BLOCK_SIZE - 1));
+        max_offset[k] = MAX(0, e[k].a * (BLOCK_SIZE - 1)) + MAX(0, e[k].b * (BLOCK_SIZE - 1));
+    }
+
+    // Align the bounding box on the block grid
+    x0 &= ~(BLOCK_SIZE - 1);
+    y0 &= ~(BLOCK_SIZE - 1);
+    for (int k = 0; k < 3; ++k) e_row[k] = e[k].a * x0 + e[k].b * y0 + e[k].c;
+
+    for (int by = y0; by <= y1; by += BLOCK_SIZE) {
+        int64_t eb[3] = {e_row[0], e_row[1], e_row[2]};
+        for (int bx = x0; bx <= x1; bx += BLOCK_SIZE) {
+            // Trivial reject: the block is entirely outside one of the edges
+            int reject = (eb[0] + max_offset[0] < 0) | (eb[1] + max_offset[1] < 0) | (eb[2] + max_offset[2] < 0);
+            // Trivial accept: the block is entirely inside the three edges
+            int accept = (eb[0] + min_offset[0] >= 0) & (eb[1] + min_offset[1] >= 0) & (eb[2] + min_offset[2] >= 0);
+            const int block_index = (by / BLOCK_SIZE) * context->num_blocks_x + bx / BLOCK_SIZE;
+            // Skip the block if the triangle is behind everything drawn so far in it
+            int visible = context->fixed_point ? zq_min < context->block_zmax_fixed[block_index]
+                                               : z_min < context->block_zmax[block_index];
+            if (!reject && visible) {
+                // Evaluate the edge functions of the 16 pixels of the block at once, and build
+                // a mask of the covered pixels (pixels outside the bounding box are masked out)
+                int64_t w[3][BLOCK_PIXELS];
+                unsigned int mask = 0;
+                for (int j = 0; j < BLOCK_PIXELS; ++j) {
+                    w[0][j] = eb[0] + offsets[0][j];
+                    w[1][j] = eb[1] + offsets[1][j];
+                    w[2][j] = eb[2] + offsets[2][j];
+                    unsigned int inside = accept | ((w[0][j] | w[1][j] | w[2][j]) >= 0);
+                    mask |= (inside & (bx + j % BLOCK_SIZE <= x1) & (by + j / BLOCK_SIZE <= y1)) << j;
+                }
+                // The block's largest depth only changes if we overwrite a pixel that had it
+                int update_hiz = 0;
+                // Pixels are shaded by quads of 2x2 pixels. The depth and texture coordinates
+                // are computed for the 4 pixels of a quad, even those that are not covered, to
+                // get the texture coordinate derivatives.
+                for (int q = 0; q < 4; ++q) {
+                    const int first = (q / 2) * 2 * BLOCK_SIZE + (q % 2) * 2;
+                    const int quad[4] = {first, first + 1, first + BLOCK_SIZE, first + BLOCK_SIZE + 1};
+                    unsigned int quad_mask = mask & ((0x3u | 0x3u << BLOCK_SIZE) << first);
+                    if (!quad_mask) continue;
+
+                    if (context->fixed_point) {
+                        int32_t zq[4];
+                        struct fixed_uv uvq[4];
+                        for (int k = 0; k < 4; ++k) {
+                            const int px = bx + quad[k] % BLOCK_SIZE, py = by + quad[k] / BLOCK_SIZE;
+                            int64_t q = fixed_plane_eval(&q_plane, px, py);
+                            // 1/z can only be negative or close to 0 for pixels of the quad outside of the triangle
+                            zq[k] = q > 0 ? (int32_t)MIN(fixed_recip(q), zq_max) : zq_max;
+                            // u/z * z: FIXED_UV_BITS + FIXED_Z_BITS fractional bits, back to FIXED_Z_BITS
+                            uvq[k].u = (fixed_plane_eval(&u_plane, px, py) * zq[k]) >> FIXED_UV_BITS;
+                            uvq[k].v = (fixed_plane_eval(&v_plane, px, py) * zq[k]) >> FIXED_UV_BITS;
+                        }
+                        int lod = quad_lod_fixed(texture, uvq);
+
+                        for (int k = 0; k < 4; ++k) {
+                            const int j = quad[k];
+                            if (!(quad_mask & (1u << j))) continue;
+                            int index = (by + j / BLOCK_SIZE) * context->extent.width + bx + j % BLOCK_SIZE;
+                            if (zq[k] < context->depth_buffer_fixed[index]) {
+                                update_hiz |= context->depth_buffer_fixed[index] == context->block_zmax_fixed[block_index];
+                                context->depth_buffer_fixed[index] = zq[k];
+                                shade_fixed(texture, uvq[k], lod, &context->color_buffer[index]);
+                            }
+                        }
+                        continue;
+                    }
+
+                    float z[4];
+                    struct uv2f uvi[4];
+                    for (int k = 0; k < 4; ++k) {
+                        const int j = quad[k];
+                        float w0 = (w[0][j] + e[0].bias) * inv_area;
+                        float w1 = (w[1][j] + e[1].bias) * inv_area;
+                        float w2 = (w[2][j] + e[2].bias) * inv_area;
+
+                        float one_over_z = w0 * inv_z[0] + w1 * inv_z[1] + w2 * inv_z[2];
+                        z[k] = 1.0f / one_over_z;
+
+                        // Interpolate the texture coordinates
+                        uvi[k].u = (uv[0]->u * w0 + uv[1]->u * w1 + uv[2]->u * w2) * z[k];
+                        uvi[k].v = (uv[0]->v * w0 + uv[1]->v * w1 + uv[2]->v * w2) * z[k];
+                    }
+                    float lod = quad_lod(texture, uvi);
+
+                    for (int k = 0; k < 4; ++k) {
+                        const int j = quad[k];
+                        if (!(quad_mask & (1u << j))) continue;
+                        int index = (by + j / BLOCK_SIZE) * context->extent.width + bx + j % BLOCK_SIZE;
+
+                        // Z-buffer test
+                        if (z[k] < context->depth_buffer[index]) {
+                            update_hiz |= context->depth_buffer[index] == context->block_zmax[block_index];
+                            context->depth_buffer[index] = z[k];
+
+                            // Shade the pixel and update the color buffer
+                            shade(texture, uvi[k], lod, &context->color_buffer[index]);
+                        }
+                    }
+                }
+                if (update_hiz && context->fixed_point) {
+                    hiz_update(context, context->depth_buffer_fixed, context->block_zmax_fixed, context->tile_zmax_fixed, bx, by);
+                }
+                else if (update_hiz) {
+                    hiz_update(context, context->depth_buffer, context->block_zmax, context->tile_zmax, bx, by);
                 }
             }
+            for (int k = 0; k < 3; ++k) eb[k] += e[k].a * BLOCK_SIZE;
+        }
+        for (int k = 0; k < 3; ++k) e_row[k] += e[k].b * BLOCK_SIZE;
+    }
+}
+
+// A vertex being clipped: camera space position and texture coordinates.
+struct clip_vertex {
+    struct point3f p;
+    struct uv2f uv;
+};
+
+// A clipping plane a * x + b * y + c * z + d = 0 in camera space. Points for which
+// a * x + b * y + c * z + d >= 0 are inside.
+struct plane {
+    float a, b, c, d;
+};
+
+#define NUM_FRUSTUM_PLANES 6
+#define NEAR_PLANE 0
+#define FAR_PLANE 1
+// Clipping a triangle against the near and far planes gives a polygon with at most 5 vertices
+#define MAX_CLIP_VERTICES 5
+
+static inline float plane_distance(const struct plane* plane, const struct point3f* p) {
+    return plane->a * p->x + plane->b * p->y + plane->c * p->z + plane->d;
+}
+
+// The six planes of the viewing frustum in camera space (the camera looks down the negative z-axis).
+// A point (x, y, z) projects inside the screen window [l, r] x [b, t] if l <= x * znear / -z <= r, etc.
+static void frustum_planes(const struct context* context, struct plane* planes) {
+    const struct screen_coordinates* sc = &context->screen_coordinates;
+    const float n = context->znear;
+    const struct plane frustum[NUM_FRUSTUM_PLANES] = {
+        {0, 0, -1, -n},            // near: z <= -znear
+        {0, 0, 1, context->zfar},  // far: z >= -zfar
+        {n, 0, sc->l, 0},          // left
+        {-n, 0, -sc->r, 0},        // right
+        {0, n, sc->b, 0},          // bottom
+        {0, -n, -sc->t, 0}         // top
+    };
+    memcpy(planes, frustum, sizeof(frustum));
+}
+
+// Test the bounding box of a mesh, transformed to camera space by model_view, against the viewing
+// frustum. Returns 0 if the mesh is entirely outside of one of the planes. Otherwise, needs_clipping
+// is set to 1 if the box straddles the near or far plane, in which case the triangles of the mesh
+// need to be clipped, and depth is set to the depth of the nearest corner of the box.
+static int mesh_in_frustum(const struct plane* planes, const struct Mesh* mesh, const float* model_view,
+                           int* needs_clipping, float* depth) {
+    struct point3f corners[8];
+    *depth = INFINITY;
+    for (int k = 0; k < 8; ++k) {
+        struct point3f corner;
+        corner.x = (k & 1) ? mesh->bbox_max.x : mesh->bbox_min.x;
+        corner.y = (k & 2) ? mesh->bbox_max.y : mesh->bbox_min.y;
+        corner.z = (k & 4) ? mesh->bbox_max.z : mesh->bbox_min.z;
+        point_mat_mult(&corner, model_view, &corners[k]);
+        *depth = MIN(*depth, -corners[k].z);
+    }
+
+    *needs_clipping = 0;
+    for (int i = 0; i < NUM_FRUSTUM_PLANES; ++i) {
+        int num_inside = 0;
+        for (int k = 0; k < 8; ++k) {
+            num_inside += plane_distance(&planes[i], &corners[k]) >= 0;
+        }
+        if (num_inside == 0) return 0;
+        if (num_inside < 8 && (i == NEAR_PLANE || i == FAR_PLANE)) *needs_clipping = 1;
+    }
+    return 1;
+}
+
+// Clip a convex polygon against a plane (one step of the Sutherland-Hodgman algorithm). Positions
+// and texture coordinates are interpolated linearly along the edges crossing the plane, which is
+// correct since clipping happens in camera space, before the perspective divide. Returns the
+// number of vertices written to out (at most n + 1).
+static int clip_polygon(const struct plane* plane, const struct clip_vertex* in, int n, struct clip_vertex* out) {
+    int num_out = 0;
+    for (int i = 0; i < n; ++i) {
+        const struct clip_vertex* a = &in[i];
+        const struct clip_vertex* b = &in[(i + 1) % n];
+        float da = plane_distance(plane, &a->p);
+        float db = plane_distance(plane, &b->p);
+        if (da >= 0) out[num_out++] = *a;
+        if ((da >= 0) != (db >= 0)) {
+            float t = da / (da - db);
+            struct clip_vertex* v = &out[num_out++];
+            v->p.x = a->p.x + t * (b->p.x - a->p.x);
+            v->p.y = a->p.y + t * (b->p.y - a->p.y);
+            v->p.z = a->p.z + t * (b->p.z - a->p.z);
+            v->uv.u = a->uv.u + t * (b->uv.u - a->uv.u);
+            v->uv.v = a->uv.v + t * (b->uv.v - a->uv.v);
         }
     }
+    return num_out;
 }
 
-void render(struct context* context, int num_meshes, const struct Mesh** const meshes) {
+// Project a triangle lying between the near and far planes and rasterize it.
+static void draw_triangle(struct context* context, const struct texture* texture,
+                          const struct clip_vertex* v0, const struct clip_vertex* v1, const struct clip_vertex* v2) {
     float bbox[4];
     int x0, x1, y0, y1;
 
+    struct point3f p0 = v0->p;
+    struct point3f p1 = v1->p;
+    struct point3f p2 = v2->p;
+
+    persp_divide(&p0, context->znear);
+    persp_divide(&p1, context->znear);
+    persp_divide(&p2, context->znear);
+    to_raster(context->screen_coordinates, context->extent, &p0);
+    to_raster(context->screen_coordinates, context->extent, &p1);
+    to_raster(context->screen_coordinates, context->extent, &p2);
+
+    tri_bbox(&p0, &p1, &p2, bbox);
+
+    if (bbox[0] > context->extent.width - 1 || bbox[2] < 0 || bbox[1] > context->extent.height - 1 || bbox[3] < 0)
+        return;
+
+    x0 = MAX(0, (int)bbox[0]);
+    y0 = MAX(0, (int)bbox[1]);
+    x1 = MIN(context->extent.width - 1, (int)bbox[2]);
+    y1 = MIN(context->extent.height - 1, (int)bbox[3]);
+
+    // Skip the triangle if it is hidden in all the tiles it overlaps
+    float z_min = MIN(MIN(p0.z, p1.z), p2.z) * (1 - HIZ_EPSILON);
+    if (context->fixed_point ? hiz_occluded(context, context->tile_zmax_fixed, x0, y0, x1, y1, fixed_depth(z_min))
+                             : hiz_occluded(context, context->tile_zmax, x0, y0, x1, y1, z_min))
+        return;
+
+    struct uv2f uv0 = v0->uv;
+    struct uv2f uv1 = v1->uv;
+    struct uv2f uv2 = v2->uv;
+
+    uv0.u /= p0.z;
+    uv0.v /= p0.z;
+    uv1.u /= p1.z;
+    uv1.v /= p1.z;
+    uv2.u /= p2.z;
+    uv2.v /= p2.z;
+
+    rasterize(x0, y0, x1, y1, z_min, &p0, &p1, &p2, &uv0, &uv1, &uv2, texture, context);
+}
+
+// Transform the vertices of a mesh to camera space, into context->vertex_buffer.
+static void vertex_pass(struct context* context, const struct Mesh* mesh, const float* model_view) {
+    if (context->vertex_buffer_size < mesh->num_vertices) {
+        free(context->vertex_buffer);
+        context->vertex_buffer = (struct point3f*)malloc(mesh->num_vertices * sizeof(struct point3f));
+        context->vertex_buffer_size = mesh->num_vertices;
+    }
+    for (int i = 0; i < mesh->num_vertices; ++i) {
+        point_mat_mult(&mesh->vertices[i], model_view, &context->vertex_buffer[i]);
+    }
+}
+
+struct mesh_depth {
+    float depth;
+    int index;
+};
+
+// Pick the least detailed LOD of the mesh whose error, projected on the screen at the depth of the
+// front of the mesh's bounding box, is at most context->lod_pixel_error pixels. The smaller the
+// mesh on the screen, the coarser the LOD. A pixel at depth z covers 2 * t * z / (znear * height)
+// units, scaled by the largest scale of the model-view matrix.
+static const struct Mesh* select_lod(const struct context* context, const struct Mesh* mesh, const float* model_view, float depth) {
+    if (mesh->num_lods == 0 || context->lod_pixel_error <= 0 || depth <= context->znear) return mesh;
+    float scale = 0;
+    for (int i = 0; i < 3; ++i) {
+        const float* row = &model_view[i * 4];
+        scale = MAX(scale, row[0] * row[0] + row[1] * row[1] + row[2] * row[2]);
+    }
+    float pixels_per_unit = sqrtf(scale) * context->znear * context->extent.height / (2 * context->screen_coordinates.t * depth);
+    const struct Mesh* lod = mesh;
+    for (int i = 0; i < mesh->num_lods && mesh->lods[i].lod_error * pixels_per_unit <= context->lod_pixel_error; ++i) {
+        lod = &mesh->lods[i];
+    }
+    return lod;
+}
+
+static int compare_mesh_depth(const void* a, const void* b) {
+    const struct mesh_depth* ma = (const struct mesh_depth*)a;
+    const struct mesh_depth* mb = (const struct mesh_depth*)b;
+    if (ma->depth != mb->depth) return ma->depth < mb->depth ? -1 : 1;
+    return ma->index - mb->index;
+}
+
+// Render the meshes. model_matrices[i] is the object-to-world matrix of meshes[i] (row-major, like
+// world_to_cam). If model_matrices is NULL, the meshes are drawn as they are in world space.
+void render(struct context* context, int num_meshes, const struct Mesh** const meshes, const float* const* model_matrices) {
+    struct plane planes[NUM_FRUSTUM_PLANES];
+    frustum_planes(context, planes);
+
+    float* model_view = (float*)malloc(sizeof(float) * 16 * num_meshes);
     for (int i = 0; i < num_meshes; ++i) {
-        const struct Mesh* const mesh = meshes[i];
-        const int* vi = mesh->vertex_indices;
-        const int* sti = mesh->uv_indices;
-
-        for (int j = 0; j < mesh->num_triangles; ++j, vi += 3, sti += 3) {
-            struct point3f p0 = mesh->vertices[vi[0]];
-            struct point3f p1 = mesh->vertices[vi[1]];
-            struct point3f p2 = mesh->vertices[vi[2]];
-
-            persp_divide(&p0, context->znear);
-            persp_divide(&p1, context->znear);
-            persp_divide(&p2, context->znear);
-            to_raster(context->screen_coordinates, context->extent, &p0);
-            to_raster(context->screen_coordinates, context->extent, &p1);
-            to_raster(context->screen_coordinates, context->extent, &p2);
-
-            tri_bbox(&p0, &p1, &p2, bbox);
-
-            if (bbox[0] > context->extent.width - 1 || bbox[2] < 0 || bbox[1] > context->extent.height - 1 || bbox[3] < 0)
-                continue;
-
-            x0 = MAX(0, (int)bbox[0]);
-            y0 = MAX(0, (int)bbox[1]);
-            x1 = MIN(context->extent.width - 1, (int)bbox[2]);
-            y1 = MIN(context->extent.height - 1, (int)bbox[3]);
-
-            struct uv2f uv0 = mesh->uvs[sti[0]];
-            struct uv2f uv1 = mesh->uvs[sti[1]];
-            struct uv2f uv2 = mesh->uvs[sti[2]];
-
-            uv0.u /= p0.z;
-            uv0.v /= p0.z;
-            uv1.u /= p1.z;
-            uv1.v /= p1.z;
-            uv2.u /= p2.z;
-            uv2.v /= p2.z;
-
-            rasterize(x0, y0, x1, y1, &p0, &p1, &p2, &uv0, &uv1, &uv2, mesh, context);
+        if (model_matrices) mat_mult(model_matrices[i], context->world_to_cam, &model_view[i * 16]);
+        else memcpy(&model_view[i * 16], context->world_to_cam, sizeof(context->world_to_cam));
+    }
+
+    // Reject the meshes outside of the viewing frustum, and sort the others by the depth of the
+    // front of their bounding box, so that the ones in front are drawn first and those they hide
+    // get rejected by the hierarchical depth test
+    struct mesh_depth* order = (struct mesh_depth*)malloc(sizeof(struct mesh_depth) * num_meshes);
+    int* needs_clipping = (int*)malloc(sizeof(int) * num_meshes);
+    int num_visible = 0;
+    for (int i = 0; i < num_meshes; ++i) {
+        float depth;
+        if (!mesh_in_frustum(planes, meshes[i], &model_view[i * 16], &needs_clipping[i], &depth)) continue;
+        order[num_visible].index = i;
+        order[num_visible].depth = depth;
+        num_visible++;
+    }
+    if (context->front_to_back) qsort(order, num_visible, sizeof(struct mesh_depth), compare_mesh_depth);
+
+    context->num_triangles_drawn = 0;
+    for (int i = 0; i < num_visible; ++i) {
+        const float* const mesh_model_view = &model_view[order[i].index * 16];
+        const struct Mesh* const mesh = select_lod(context, meshes[order[i].index], mesh_model_view, order[i].depth);
+        const int clip = needs_clipping[order[i].index];
+
+        vertex_pass(context, mesh, mesh_model_view);
+        const struct point3f* const vertices = context->vertex_buffer;
+        context->num_triangles_drawn += mesh->num_triangles;
+
+        // The texture is bound once per batch rather than looked up for each triangle
+        for (int b = 0; b < mesh->num_batches; ++b) {
+            const struct MeshBatch* const batch = &mesh->batches[b];
+            const struct texture* const texture = batch->texture;
+            const int* vi = mesh->vertex_indices + batch->first_triangle * 3;
+
+            for (int j = 0; j < batch->num_triangles; ++j, vi += 3) {
+                struct clip_vertex v[MAX_CLIP_VERTICES], clipped[MAX_CLIP_VERTICES];
+                for (int k = 0; k < 3; ++k) {
+                    v[k].p = vertices[vi[k]];
+                    if (mesh->uvs) v[k].uv = mesh->uvs[vi[k]];
+                    else v[k].uv.u = v[k].uv.v = 0;
+                }
+
+                if (!clip) {
+                    draw_triangle(context, texture, &v[0], &v[1], &v[2]);
+                    continue;
+                }
+
+                // Clip the triangle against the near and far planes, and draw the resulting polygon as a fan
+                int n = clip_polygon(&planes[NEAR_PLANE], v, 3, clipped);
+                n = clip_polygon(&planes[FAR_PLANE], clipped, n, v);
+                for (int k = 2; k < n; ++k) {
+                    draw_triangle(context, texture, &v[0], &v[k - 1], &v[k]);
+                }
+            }
         }
     }
+
+    free(order);
+    free(needs_clipping);
+    free(model_view);
 }
 
 void cleanup(struct context* context) {
 	free(context->depth_buffer);
+	free(context->color_buffer);
+	free(context->block_zmax);
+	free(context->tile_zmax);
+	free(context->tile_zmax_count);
+	free(context->depth_buffer_fixed);
+	free(context->block_zmax_fixed);
+	free(context->tile_zmax_fixed);
+	free(context->vertex_buffer);
 }
\ No newline at end of file
@@ -1,5 +1,10 @@
+// g++ -O3 -pthread -o x11viewer x11viewer.cpp -lX11 -lXext
+
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <unistd.h>
 #include <iostream>
 #include <vector>
@@ -7,12 +12,104 @@
 #include <cstdint>
 #include <array>
 #include <chrono>
+#include <thread>
+#include <cstring>
+#include <algorithm>
 
 #include "geometry.h" 
 #include "objimporter.h"
 #include "Camera.h"
 #include "texturing.h"
 #include "object.h"
+#include "simplify.h"
+
+// Decode the rgba2222 pixel format
+std::array<uint8_t, 4> decode_pixel(uint8_t pixel) {
+    uint8_t a = (pixel >> 6) & 0b11;
+    uint8_t b = (pixel >> 4) & 0b11;
+    uint8_t g = (pixel >> 2) & 0b11;
+    uint8_t r = pixel & 0b11;
+
+    // Map the 2-bit values to 8-bit color values
+    static const uint8_t mapping[4] = {0, 85, 170, 255};
+
+    return {mapping[r], mapping[g], mapping[b], mapping[a]};
+}
+
+// A pixel has only 256 possible values: decode all of them once into a table of ARGB colors.
+struct Palette {
+    uint32_t argb[256];
+
+    Palette() {
+        for (int i = 0; i < 256; ++i) {
+            std::array<uint8_t, 4> rgba = decode_pixel(i);
+            argb[i] = (rgba[3] << 24) | (rgba[0] << 16) | (rgba[1] << 8) | rgba[2];
+        }
+    }
+};
+
+// Convert num_pixels rgba2222 pixels to ARGB with one table lookup per pixel. The loop is unrolled
+// so that several independent loads are in flight at once.
+void convertToARGB(const uint8_t* src, uint32_t* dst, int num_pixels) {
+    static const Palette palette;
+    const uint32_t* lut = palette.argb;
+    int i = 0;
+    for (; i + 8 <= num_pixels; i += 8) {
+        dst[i] = lut[src[i]];
+        dst[i + 1] = lut[src[i + 1]];
+        dst[i + 2] = lut[src[i + 2]];
+        dst[i + 3] = lut[src[i + 3]];
+        dst[i + 4] = lut[src[i + 4]];
+        dst[i + 5] = lut[src[i + 5]];
+        dst[i + 6] = lut[src[i + 6]];
+        dst[i + 7] = lut[src[i + 7]];
+    }
+    for (; i < num_pixels; ++i) {
+        dst[i] = lut[src[i]];
+    }
+}
+
+// Statistics of the frames rendered since the last report.
+struct FrameStats {
+    int frames = 0;
+    double render_ms = 0, present_ms = 0, min_ms = 1e9, max_ms = 0;
+    long triangles = 0;  // drawn (LODs make it vary with the distance to the camera)
+
+    void add(double render, double present, int num_triangles) {
+        frames++;
+        triangles += num_triangles;
+        render_ms += render;
+        present_ms += present;
+        min_ms = std::min(min_ms, render + present);
+        max_ms = std::max(max_ms, render + present);
+    }
+
+    void print(const char* label) const {
+        if (frames == 0) return;
+        double frame_ms = (render_ms + present_ms) / frames;
+        fprintf(stderr, "%s%d frames, frame %.2f ms (min %.2f, max %.2f), render %.2f ms, present %.2f ms, %.1f fps, %ld triangles\n",
+                label, frames, frame_ms, min_ms, max_ms, render_ms / frames, present_ms / frames, 1000.0 / frame_ms,
+                triangles / frames);
+    }
+};
+
+// Render one frame: animate the objects, clear the buffers, then transform and rasterize the meshes.
+// The objects spin around the y axis at half a radian per second, on top of their own rotation
+// (which is left untouched).
+void renderFrame(struct context* context, int num_objects, const struct Object* objects, float time) {
+    std::vector<struct Object> posed(objects, objects + num_objects);
+    std::vector<const struct Mesh*> meshes(num_objects);
+    std::vector<const float*> model_matrices(num_objects);
+    for (int i = 0; i < num_objects; ++i) {
+        posed[i].rotation.y += time * 0.5f;
+        object_update_transform(&posed[i]);
+        meshes[i] = posed[i].mesh;
+        model_matrices[i] = &posed[i].transform[0][0];
+    }
+
+    clear_buffers(context);
+    render(context, num_objects, meshes.data(), model_matrices.data());
+}
 
 class X11Viewer {
 public:
@@ -34,36 +131,83 @@ public:
 
         XMapWindow(display, window);
 
-        // Create the XImage for drawing
-        image = XCreateImage(display, DefaultVisual(display, screen), DefaultDepth(display, screen), ZPixmap, 0,
-                             (char*)malloc(width * height * 4), width, height, 32, 0);
+        // Create the XImage for drawing. If the X server runs on this machine, the image lives in
+        // memory shared with the server (MIT-SHM extension) and presenting it copies nothing
+        // through the X socket. Otherwise we fall back to a regular XImage and XPutImage.
+        image = nullptr;
+        use_shm = XShmQueryExtension(display);
+        if (use_shm) {
+            image = XShmCreateImage(display, DefaultVisual(display, screen), DefaultDepth(display, screen), ZPixmap,
+                                    nullptr, &shm_info, width, height);
+            if (image) {
+                shm_info.shmid = shmget(IPC_PRIVATE, image->bytes_per_line * image->height, IPC_CREAT | 0600);
+                shm_info.shmaddr = image->data = (char*)shmat(shm_info.shmid, nullptr, 0);
+                shm_info.readOnly = False;
+                if (shm_info.shmid < 0 || shm_info.shmaddr == (char*)-1 || !XShmAttach(display, &shm_info)) {
+                    std::cerr << "MIT-SHM unavailable, using XPutImage\n";
+                    if (shm_info.shmaddr != (char*)-1) shmdt(shm_info.shmaddr);
+                    if (shm_info.shmid >= 0) shmctl(shm_info.shmid, IPC_RMID, nullptr);
+                    image->data = nullptr;
+                    XDestroyImage(image);
+                    image = nullptr;
+                }
+                else {
+                    XSync(display, False);
+                    // The segment is destroyed once both processes have detached from it
+                    shmctl(shm_info.shmid, IPC_RMID, nullptr);
+                }
+            }
+            use_shm = image != nullptr;
+        }
+        if (!image) {
+            image = XCreateImage(display, DefaultVisual(display, screen), DefaultDepth(display, screen), ZPixmap, 0,
+                                 (char*)malloc(width * height * 4), width, height, 32, 0);
+        }
     }
 
     // Destructor to clean up resources
     ~X11Viewer() {
+        if (use_shm) {
+            XShmDetach(display, &shm_info);
+            shmdt(shm_info.shmaddr);
+            image->data = nullptr;
+        }
         XFreeGC(display, gc);
         XDestroyWindow(display, window);
         XDestroyImage(image); // Free the XImage
         XCloseDisplay(display);
     }
 
-    void mainLoop(struct context* context, int num_meshes, struct Mesh** meshes) {
+    // Render and display frames until 'q' is pressed. If target_fps is not 0, frames are paced
+    // to target_fps. Frame times are reported on stderr once per second.
+    void mainLoop(struct context* context, int num_objects, struct Object* objects, int target_fps) {
+        using clock = std::chrono::steady_clock;
+        const auto frame_period = std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(target_fps > 0 ? 1.0 / target_fps : 0));
+        const auto start = clock::now();
+        auto next_frame = start, last_report = start;
+        FrameStats stats;
+
         while (true) {
-            // auto start = std::chrono::high_resolution_clock::now();
+            auto frame_start = clock::now();
+            float time = std::chrono::duration<float>(frame_start - start).count();
 
             // Render the scene
-            render(context, num_meshes, (const struct Mesh** const)meshes);
+            renderFrame(context, num_objects, objects, time);
+            auto render_end = clock::now();
 
             // Draw the buffer to the X11 window
             drawBufferToWindow(context);
-
-            // auto end = std::chrono::high_resolution_clock::now();
-            // std::chrono::duration<double> elapsed = end - start;
-            // double render_time_ms = elapsed.count() * 1000.0;
-            // double fps = 1000.0 / render_time_ms;
-
-            // // Output the timing information
-            // std::cout << "Render Time: " << render_time_ms << " ms, FPS: " << fps << std::endl;
+            auto present_end = clock::now();
+
+            stats.add(std::chrono::duration<double, std::milli>(render_end - frame_start).count(),
+                      std::chrono::duration<double, std::milli>(present_end - render_end).count(),
+                      context->num_triangles_drawn);
+            if (present_end - last_report >= std::chrono::seconds(1)) {
+                stats.print("");
+                stats = FrameStats();
+                last_report = present_end;
+            }
 
             // Handle events in a non-blocking manner
             while (XPending(display) > 0) {
@@ -76,6 +220,13 @@ public:
                     }
                 }
             }
+
+            // Wait for the next frame. If we are late, don't try to catch up.
+            if (target_fps > 0) {
+                next_frame += frame_period;
+                if (next_frame < clock::now()) next_frame = clock::now();
+                std::this_thread::sleep_until(next_frame);
+            }
         }
     }
 
@@ -87,45 +238,139 @@ private:
     GC gc; // Graphics context
     int width, height;
     XImage* image; // XImage to store the pixel data
+    bool use_shm;
+    XShmSegmentInfo shm_info;
 
-    // Decode the rgba2222 pixel format
-    std::array<uint8_t, 4> decode_pixel(uint8_t pixel) {
-        uint8_t a = (pixel >> 6) & 0b11;
-        uint8_t b = (pixel >> 4) & 0b11;
-        uint8_t g = (pixel >> 2) & 0b11;
-        uint8_t r = pixel & 0b11;
+    // Draw the entire buffer to the X11 window
+    void drawBufferToWindow(struct context* context) {
+        convertToARGB(context->color_buffer, (uint32_t*)image->data, context->extent.width * context->extent.height);
 
-        // Map the 2-bit values to 8-bit color values
-        static const uint8_t mapping[4] = {0, 85, 170, 255};
+        if (use_shm) {
+            XShmPutImage(display, window, gc, image, 0, 0, 0, 0, width, height, False);
+            // Wait for the server to be done reading the image before we overwrite it with the next frame
+            XSync(display, False);
+        }
+        else {
+            // Put the image data to the window in one go
+            XPutImage(display, window, gc, image, 0, 0, 0, 0, width, height);
 
-        return {mapping[r], mapping[g], mapping[b], mapping[a]};
+            // Flush the output to make sure everything is drawn
+            XFlush(display);
+        }
     }
+};
 
-    // Draw the entire buffer to the X11 window using XPutImage
-    void drawBufferToWindow(struct context* context) {
-        uint32_t* image_data = (uint32_t*)image->data;
-
-        for (int y = 0; y < context->extent.height; ++y) {
-            for (int x = 0; x < context->extent.width; ++x) {
-                uint8_t pixel = context->color_buffer[y * context->extent.width + x];
-                std::array<uint8_t, 4> rgba = decode_pixel(pixel);
-
-                // Convert the RGBA array to a single 32-bit color value (ARGB format)
-                uint32_t color = (rgba[3] << 24) | (rgba[0] << 16) | (rgba[1] << 8) | rgba[2];
+// Render num_frames frames to memory without opening a window, and report the frame times.
+// The scene is animated as if the frames were 1/60th of a second apart. The present time is
+// the time spent converting the frame to ARGB, the only part of presenting that doesn't need X.
+void runHeadless(struct context* context, int num_objects, struct Object* objects, int num_frames) {
+    const int num_pixels = context->extent.width * context->extent.height;
+    std::vector<uint32_t> argb(num_pixels);
+    FrameStats stats;
+    for (int i = 0; i < num_frames; ++i) {
+        auto frame_start = std::chrono::steady_clock::now();
+        renderFrame(context, num_objects, objects, i / 60.0f);
+        auto render_end = std::chrono::steady_clock::now();
+        convertToARGB(context->color_buffer, argb.data(), num_pixels);
+        auto frame_end = std::chrono::steady_clock::now();
+        stats.add(std::chrono::duration<double, std::milli>(render_end - frame_start).count(),
+                  std::chrono::duration<double, std::milli>(frame_end - render_end).count(),
+                  context->num_triangles_drawn);
+    }
+    stats.print("headless: ");
+}
 
-                image_data[y * context->extent.width + x] = color;
+// Render num_frames frames with both the floating-point and the fixed-point rasterization paths,
+// and report how many pixels differ: pixels covered by one path only, pixels of different colors,
+// and the largest relative difference between the depths of the pixels covered by both.
+void comparePaths(struct context* context, int num_objects, struct Object* objects, int num_frames) {
+    const int num_pixels = context->extent.width * context->extent.height;
+    std::vector<unsigned char> color(num_pixels);
+    std::vector<float> depth(num_pixels);
+    long covered = 0, coverage_mismatches = 0, color_mismatches = 0;
+    float max_depth_error = 0;
+    for (int i = 0; i < num_frames; ++i) {
+        context->fixed_point = 0;
+        renderFrame(context, num_objects, objects, i / 60.0f);
+        memcpy(color.data(), context->color_buffer, num_pixels);
+        memcpy(depth.data(), context->depth_buffer, num_pixels * sizeof(float));
+        context->fixed_point = 1;
+        renderFrame(context, num_objects, objects, i / 60.0f);
+        const int32_t zfar_fixed = fixed_depth(context->zfar);
+        for (int j = 0; j < num_pixels; ++j) {
+            bool covered_float = depth[j] < context->zfar, covered_fixed = context->depth_buffer_fixed[j] < zfar_fixed;
+            covered += covered_float;
+            coverage_mismatches += covered_float != covered_fixed;
+            color_mismatches += color[j] != context->color_buffer[j];
+            if (covered_float && covered_fixed) {
+                float z = (float)context->depth_buffer_fixed[j] / (1 << FIXED_Z_BITS);
+                max_depth_error = std::max(max_depth_error, fabsf(z - depth[j]) / depth[j]);
             }
         }
+    }
+    fprintf(stderr, "compare: %d frames, %ld covered pixels, %ld coverage mismatches, %ld color mismatches, "
+            "max relative depth error %g\n", num_frames, covered, coverage_mismatches, color_mismatches, max_depth_error);
+}
 
-        // Put the image data to the window in one go
-        XPutImage(display, window, gc, image, 0, 0, 0, 0, width, height);
+// Load the diffuse texture of each material. The viewer only reads the rgba2222 format, so the
+// map_Kd file name is used with the .rgba2 extension, in the directory of the OBJ file. The
+// textures are square, their size is found from the size of the file. Returns the texture of each
+// material (NULL if it has none), a texture shared by several materials is only loaded once.
+std::vector<struct texture*> loadMaterialTextures(const ObjData& data, const std::string& objFilePath,
+                                                  const std::string& defaultTexturePath, struct texture* defaultTexture) {
+    std::string directory = objFilePath.substr(0, objFilePath.find_last_of('/') + 1);
+    std::vector<struct texture*> textures(data.materials.size(), nullptr);
+    std::vector<std::pair<std::string, struct texture*>> loaded = {{defaultTexturePath, defaultTexture}};
+    for (size_t i = 0; i < data.materials.size(); ++i) {
+        std::string map = data.materials[i].diffuse_map;
+        if (map.empty()) continue;
+        map = map.substr(map.find_last_of("/\\") + 1);
+        std::string path = directory + map.substr(0, map.find_last_of('.')) + ".rgba2";
+        auto it = std::find_if(loaded.begin(), loaded.end(), [&](const auto& t) { return t.first == path; });
+        if (it != loaded.end()) {
+            textures[i] = it->second;
+            continue;
+        }
+        std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+        if (!ifs) {
+            fprintf(stderr, "Warning: No texture %s for material %s\n", path.c_str(), data.materials[i].name.c_str());
+            continue;
+        }
+        int size = static_cast<int>(std::lround(std::sqrt(static_cast<double>(ifs.tellg()))));
+        textures[i] = create_texture(path.c_str(), size, size);
+        loaded.emplace_back(path, textures[i]);
+    }
+    return textures;
+}
 
-        // Flush the output to make sure everything is drawn
-        XFlush(display);
+// usage: x11viewer [-headless N] [-fps F] [-fixed] [-no-cull] [-compare N] [obj texture texture_size]
+//   -headless N  render N frames to memory without X and report the frame times
+//   -fps F       limit the frame rate to F frames per second (default 60, 0 for no limit)
+//   -fixed       use the fixed-point rasterization path
+//   -no-cull     draw the back faces too (for the meshes wound the other way, like heavytank3.obj)
+//   -compare N   render N frames with the floating-point and the fixed-point paths and compare them
+int main(int argc, char** argv) {
+    int headless_frames = 0;
+    int compare_frames = 0;
+    int target_fps = 60;
+    bool fixed_point = false;
+    bool cull_back_faces = true;
+    int num_lods = 0;
+    float lod_pixel_error = 1;
+    float camera_distance = 10;
+    std::vector<const char*> positional;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-headless") == 0 && i + 1 < argc) headless_frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-fps") == 0 && i + 1 < argc) target_fps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-fixed") == 0) fixed_point = true;
+        else if (strcmp(argv[i], "-no-cull") == 0) cull_back_faces = false;
+        else if (strcmp(argv[i], "-compare") == 0 && i + 1 < argc) compare_frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-lods") == 0 && i + 1 < argc) num_lods = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-lod-error") == 0 && i + 1 < argc) lod_pixel_error = atof(argv[++i]);
+        else if (strcmp(argv[i], "-distance") == 0 && i + 1 < argc) camera_distance = atof(argv[++i]);
+        else positional.push_back(argv[i]);
     }
-};
 
-int main() {
     // Set the window dimensions
     // int windowWidth = 1600;
     // int windowHeight = 900;
@@ -136,11 +381,8 @@ int main() {
     int windowWidth = 640;
     int windowHeight = 320;
 
-    // Create the X11 viewer with the specified dimensions
-    X11Viewer viewer(windowWidth, windowHeight);
-
     // Initialize the camera
-    Vec3f cameraPosition(0, 0, 10);
+    Vec3f cameraPosition(0, 0, camera_distance);
     float cameraFOV = 45.0f;
     float nearClip = 1.0f;
     float farClip = 1000.0f;
@@ -153,6 +395,9 @@ int main() {
     context.extent.height = windowHeight;
     context_init(&context, camera); // Pass the camera object to context_init
     prepare_buffers(&context);
+    context.fixed_point = fixed_point;
+    context.cull_back_faces = cull_back_faces;
+    context.lod_pixel_error = lod_pixel_error;
 
     // Set up the mesh data
     int num_meshes = 1;
@@ -165,21 +410,55 @@ int main() {
     // std::string objFilePath = "objects/jet.obj";
     std::string objFilePath = "objects/cube.obj";
     // std::string objFilePath = "objects/wolf_map.obj";
+    std::string textureFilePath = "objects/blenderaxes.rgba2";
+    int textureSize = 34;
+    if (positional.size() >= 3) {
+        objFilePath = positional[0];
+        textureFilePath = positional[1];
+        textureSize = atoi(positional[2]);
+    }
 
     ObjData meshData = ParseObj(objFilePath);
     // struct texture* my_texture = create_texture("objects/jet.rgba2", 512, 512);
-    struct texture* my_texture = create_texture("objects/blenderaxes.rgba2", 34, 34);
+    struct texture* my_texture = create_texture(textureFilePath.c_str(), textureSize, textureSize);
     // struct texture* my_texture = create_texture("objects/wolf_tex.rgba2", 160, 160);
 
-    create_mesh(&context, meshes[0], meshData, my_texture);
+    // The materials with a texture of their own use it, the others use the texture given above
+    std::vector<struct texture*> materialTextures = loadMaterialTextures(meshData, objFilePath, textureFilePath, my_texture);
+    create_mesh(meshes[0], meshData, my_texture, materialTextures.data());
+
+    // Simplified versions of the mesh, drawn instead of it when it is small on the screen
+    if (num_lods > 0) {
+        auto lods_start = std::chrono::steady_clock::now();
+        create_lods(meshes[0], num_lods, 16);
+        fprintf(stderr, "LOD 0: %d triangles\n", meshes[0]->num_triangles);
+        for (int i = 0; i < meshes[0]->num_lods; ++i) {
+            const struct Mesh* lod = &meshes[0]->lods[i];
+            fprintf(stderr, "LOD %d: %d triangles (%.1f%%), %d vertices, error %g\n", i + 1, lod->num_triangles,
+                    100.0 * lod->num_triangles / meshes[0]->num_triangles, lod->num_vertices, lod->lod_error);
+        }
+        fprintf(stderr, "LODs built in %.1f ms\n",
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - lods_start).count());
+    }
 
     // Set up some objects
     int num_objects = 1;
     struct Object* objects = (struct Object*)malloc(sizeof(struct Object) * num_objects);
     object_init(&objects[0], meshes[0], {0, 0, 0}, {0, 0, 0}, {1, 1, 1});
 
-    // Enter the main loop, passing the context and meshes for rendering
-    viewer.mainLoop(&context, num_meshes, meshes);
+    if (compare_frames > 0) {
+        comparePaths(&context, num_objects, objects, compare_frames);
+    }
+    else if (headless_frames > 0) {
+        runHeadless(&context, num_objects, objects, headless_frames);
+    }
+    else {
+        // Create the X11 viewer with the specified dimensions
+        X11Viewer viewer(windowWidth, windowHeight);
+
+        // Enter the main loop, passing the context and objects for rendering
+        viewer.mainLoop(&context, num_objects, objects, target_fps);
+    }
 
     // Cleanup
     cleanup(&context);
@@ -188,7 +467,7 @@ int main() {
         free(meshes[i]);
     }
     free(meshes);
+    free(objects);
 
     return 0;
 }
-
@@ -5,7 +5,7 @@
 // Download the raytracetransform.cpp, geometry.h and teapot.geo file to a folder.
 // Open a shell/terminal, and run the following command where the files are saved:
 //
-// c++ -std=c++11 -o teapot -O3 teapot.cpp
+// c++ -std=c++11 -o teapot -O3 -pthread teapot.cpp
 //
 // Run with: ./shading. Open the file ./out.png in Photoshop or any program
 // reading PPM files.
@@ -30,6 +30,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <vector>
 #include <utility>
@@ -39,6 +40,8 @@
 #include <cmath>
 #include <sstream>
 #include <chrono>
+#include <thread>
+#include <algorithm>
 
 #include <random>
 
@@ -280,6 +283,12 @@ public:
         std::cerr << "Number of triangles in this mesh: " << numTris << std::endl;
         std::cerr << BBox[0] << ", " << BBox[1] << std::endl;
     }
+    size_t memoryUsage() const
+    {
+        uint32_t numVerts = *std::max_element(trisIndex.get(), trisIndex.get() + numTris * 3) + 1;
+        return numTris * 3 * sizeof(uint32_t) + numVerts * sizeof(Vec3f) +
+            (isSingleVertAttr ? numVerts : numTris * 3) * (sizeof(Vec3f) + sizeof(Vec2f));
+    }
     // member variables
     uint32_t numTris;                         // number of triangles
     std::unique_ptr<Vec3f []> P;              // triangles vertex position
@@ -386,7 +395,7 @@ void render(
     }
     auto timeEnd = std::chrono::high_resolution_clock::now();
     auto passedTime = std::chrono::duration<double, std::milli>(timeEnd - timeStart).count();
-    fprintf(stderr, "\rDone: %.2f (sec)\n", passedTime / 1000);
+    fprintf(stderr, "\rDone: %.2f (sec), %.3f Mrays/s\n", passedTime / 1000, options.width * options.height / (passedTime * 1000));
 
     // save framebuffer to file
     float gamma = 1;
@@ -465,52 +474,517 @@ Vec3f dVBezier(const Vec3f *controlPoints, const float &u, const float &v)
 }
 
 // [comment]
-// Generate a poly-mesh Utah teapot out of Bezier patches
+// The Bernstein basis functions of the cubic Bezier curve and their derivatives, tabulated at
+// t = 0, 1/divs, 2/divs, ..., 1. All the patches tessellated with the same number of divisions
+// share one table: evaluating a point and its derivatives then only takes multiplications by
+// the control points, with no polynomial to evaluate.
+// [/comment]
+struct BezierBasis
+{
+    BezierBasis(uint32_t divs_) : divs(divs_), B(4 * (divs_ + 1)), dB(4 * (divs_ + 1))
+    {
+        for (uint32_t i = 0; i <= divs; ++i) {
+            float t = i / (float)divs;
+            B[i * 4    ] = (1 - t) * (1 - t) * (1 - t);
+            B[i * 4 + 1] = 3 * t * (1 - t) * (1 - t);
+            B[i * 4 + 2] = 3 * t * t * (1 - t);
+            B[i * 4 + 3] = t * t * t;
+            dB[i * 4    ] = -3 * (1 - t) * (1 - t);
+            dB[i * 4 + 1] = 3 * (1 - t) * (1 - t) - 6 * t * (1 - t);
+            dB[i * 4 + 2] = 6 * t * (1 - t) - 3 * t * t;
+            dB[i * 4 + 3] = 3 * t * t;
+        }
+    }
+    uint32_t divs;
+    std::vector<float> B, dB;
+};
+
+// [comment]
+// Evaluate the patch positions and normals on the (divs + 1) x (divs + 1) grid of the basis
+// (P[(divs + 1) * j + i] is the point at u = i / divs, v = j / divs). In matrix form, the patch is
+// P(u, v) = B(v)^T G B(u) where G is the 4x4 matrix of control points. For each column of the
+// grid we compute G B(u) and G dB(u) once: these are the control points of the curves along v
+// of the patch and of its u derivative. Each grid point then costs three 4-term sums (the
+// position and the two derivatives) instead of the 5 + 5 + 5 curve evaluations of
+// evalBezierPatch, dUBezier and dVBezier.
 // [/comment]
-void createPolyTeapot(const Matrix44f& o2w, std::vector<std::unique_ptr<Object>> &objects)
+void evalBezierPatchGrid(const Vec3f *controlPoints, const BezierBasis &basis, Vec3f *P, Vec3f *N)
+{
+    uint32_t divs = basis.divs;
+    for (uint32_t i = 0; i <= divs; ++i) {
+        const float *bu = &basis.B[i * 4], *dbu = &basis.dB[i * 4];
+        Vec3f uCurve[4], duCurve[4];
+        for (uint32_t r = 0; r < 4; ++r) {
+            const Vec3f *row = controlPoints + 4 * r;
+            uCurve[r] = row[0] * bu[0] + row[1] * bu[1] + row[2] * bu[2] + row[3] * bu[3];
+            duCurve[r] = row[0] * dbu[0] + row[1] * dbu[1] + row[2] * dbu[2] + row[3] * dbu[3];
+        }
+        for (uint32_t j = 0; j <= divs; ++j) {
+            const float *bv = &basis.B[j * 4], *dbv = &basis.dB[j * 4];
+            uint32_t k = (divs + 1) * j + i;
+            P[k] = uCurve[0] * bv[0] + uCurve[1] * bv[1] + uCurve[2] * bv[2] + uCurve[3] * bv[3];
+            Vec3f dU = duCurve[0] * bv[0] + duCurve[1] * bv[1] + duCurve[2] * bv[2] + duCurve[3] * bv[3];
+            Vec3f dV = uCurve[0] * dbv[0] + uCurve[1] * dbv[1] + uCurve[2] * dbv[2] + uCurve[3] * dbv[3];
+            N[k] = dU.crossProduct(dV).normalize();
+        }
+    }
+}
+
+// [comment]
+// Call func(begin, end) on blocks of the range [0, count), one block per core.
+// [/comment]
+template<typename Func>
+void parallelFor(uint32_t count, const Func& func)
+{
+    uint32_t numThreads = std::min(std::max(1u, std::thread::hardware_concurrency()), count);
+    if (numThreads <= 1) {
+        func(0u, count);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < numThreads; ++i) {
+        threads.emplace_back(func, count * i / numThreads, count * (i + 1) / numThreads);
+    }
+    func(0u, count / numThreads);
+    for (auto& thread : threads) thread.join();
+}
+
+// [comment]
+// How to tessellate the patches. With maxError 0, every patch is divided into divs x divs quads.
+// Otherwise each patch gets the number of divisions (a power of 2, at most maxDivs) that keeps the
+// tessellation within maxError of the surface: a distance in world units or, if screenSpace is
+// true, in pixels for the camera of the render options, so that the patches far from the camera
+// get fewer triangles.
+// [/comment]
+struct TessellationOptions
 {
     uint32_t divs = 8;
-    std::unique_ptr<Vec3f []> P(new Vec3f[(divs + 1) * (divs + 1)]);
-    std::unique_ptr<uint32_t []> nvertices(new uint32_t[divs * divs]);
-    std::unique_ptr<uint32_t []> vertices(new uint32_t[divs * divs * 4]);
-    std::unique_ptr<Vec3f []> N(new Vec3f[(divs + 1) * (divs + 1)]);
-    std::unique_ptr<Vec2f []> st(new Vec2f[(divs + 1) * (divs + 1)]);
-
-    // face connectivity - all patches are subdivided the same way so there
-    // share the same topology and uvs
-    for (uint16_t j = 0, k = 0; j < divs; ++j) {
-        for (uint16_t i = 0; i < divs; ++i, ++k) {
-            nvertices[k] = 4;
-            vertices[k * 4    ] = (divs + 1) * j + i;
-            vertices[k * 4 + 1] = (divs + 1) * j + i + 1;
-            vertices[k * 4 + 2] = (divs + 1) * (j + 1) + i + 1;
-            vertices[k * 4 + 3] = (divs + 1) * (j + 1) + i;
-        }
-    }
-
-    Vec3f controlPoints[16];
-    for (int np = 0; np < kTeapotNumPatches; ++np) { // kTeapotNumPatches
-        // set the control points for the current patch
+    float maxError = 0;
+    bool screenSpace = false;
+    uint32_t maxDivs = 64;
+};
+
+// [comment]
+// Number of divisions for the flat triangles of the tessellation to be within maxError of the
+// patch. The distance between a surface and its piecewise linear interpolation over triangles of
+// parametric size h is at most h^2 / 8 * (M_uu + 2 M_uv + M_vv), where the M's bound the second
+// derivatives (Filip, Magedson and Markot, "Surface algorithms using bounds on derivatives"). For a
+// bicubic patch these are bounded by the second differences of the control points: |P_uu| is at
+// most 6 times the largest |G[r][c] - 2 G[r][c + 1] + G[r][c + 2]|, |P_uv| 9 times the largest
+// |G[r][c] - G[r][c + 1] - G[r + 1][c] + G[r + 1][c + 1]|. The result is rounded up to a power of 2
+// so that the edges of neighboring patches can be stitched (see stitchPatchEdge).
+// [/comment]
+uint32_t bezierPatchDivs(const Vec3f *controlPoints, float maxError, uint32_t maxDivs)
+{
+    float duu = 0, dvv = 0, duv = 0;
+    for (uint32_t a = 0; a < 4; ++a) {
+        for (uint32_t b = 0; b < 2; ++b) {
+            duu = std::max(duu, (controlPoints[4 * a + b] - 2 * controlPoints[4 * a + b + 1] + controlPoints[4 * a + b + 2]).length());
+            dvv = std::max(dvv, (controlPoints[4 * b + a] - 2 * controlPoints[4 * (b + 1) + a] + controlPoints[4 * (b + 2) + a]).length());
+        }
+    }
+    for (uint32_t r = 0; r < 3; ++r) {
+        for (uint32_t c = 0; c < 3; ++c) {
+            duv = std::max(duv, (controlPoints[4 * r + c] - controlPoints[4 * r + c + 1] -
+                controlPoints[4 * (r + 1) + c] + controlPoints[4 * (r + 1) + c + 1]).length());
+        }
+    }
+    float n = std::sqrt((6 * duu + 18 * duv + 6 * dvv) / (8 * maxError));
+    uint32_t divs = 1;
+    while (divs < n && divs < maxDivs) divs *= 2;
+    return divs;
+}
+
+// [comment]
+// The boundary curves of a patch, as indices of control points: v = 0, u = 1, v = 1 and u = 0.
+// Grid point i along edge e is P[patchEdgeIndex(e, i, divs)].
+// [/comment]
+static const uint32_t kPatchEdges[4][4] = {{0, 1, 2, 3}, {3, 7, 11, 15}, {12, 13, 14, 15}, {0, 4, 8, 12}};
+
+inline
+bool samePoint(const Vec3f &a, const Vec3f &b)
+{ return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+inline
+uint32_t patchEdgeIndex(uint32_t edge, uint32_t i, uint32_t divs)
+{
+    switch (edge) {
+        case 0: return i;
+        case 1: return (divs + 1) * i + divs;
+        case 2: return (divs + 1) * divs + i;
+        default: return (divs + 1) * i;
+    }
+}
+
+// [comment]
+// Two patches sharing an edge with different numbers of divisions would leave cracks between
+// them: the finer patch has vertices on the curve where the coarser one has a straight segment.
+// We move these vertices onto the segments of the coarser patch. Since both numbers of divisions
+// are powers of 2, the vertices of the coarser patch are also vertices of the finer one.
+// [/comment]
+void stitchPatchEdge(Vec3f *P, uint32_t divs, uint32_t edge, uint32_t edgeDivs)
+{
+    uint32_t step = divs / edgeDivs;
+    for (uint32_t i = 0; i <= divs; ++i) {
+        if (i % step == 0) continue;
+        uint32_t i0 = i - i % step;
+        float t = (i % step) / (float)step;
+        P[patchEdgeIndex(edge, i, divs)] = mix(P[patchEdgeIndex(edge, i0, divs)], P[patchEdgeIndex(edge, i0 + step, divs)], t);
+    }
+}
+
+// [comment]
+// Generate a poly-mesh Utah teapot out of Bezier patches. The patches are independent of each
+// other and are tessellated in parallel, one mesh per patch.
+// [/comment]
+void createPolyTeapot(
+    const Matrix44f& o2w,
+    std::vector<std::unique_ptr<Object>> &objects,
+    const TessellationOptions &tessellation = TessellationOptions(),
+    const Options &options = Options())
+{
+    // the control points of the patches, in world space for the adaptive tessellation
+    std::vector<Vec3f> controlPoints(kTeapotNumPatches * 16);
+    for (uint32_t np = 0; np < kTeapotNumPatches; ++np) {
+        for (uint32_t i = 0; i < 16; ++i) {
+            Vec3f cp(teapotVertices[teapotPatches[np][i] - 1][0],
+                     teapotVertices[teapotPatches[np][i] - 1][1],
+                     teapotVertices[teapotPatches[np][i] - 1][2]);
+            o2w.multVecMatrix(cp, controlPoints[np * 16 + i]);
+        }
+    }
+
+    // number of divisions of each patch
+    std::vector<uint32_t> divs(kTeapotNumPatches, tessellation.divs);
+    if (tessellation.maxError > 0) {
+        Vec3f cameraPosition;
+        options.cameraToWorld.multVecMatrix(Vec3f(0), cameraPosition);
+        float pixelSize = 2 * tan(deg2rad(options.fov * 0.5)) / options.height;  // at distance 1
+        for (uint32_t np = 0; np < kTeapotNumPatches; ++np) {
+            float maxError = tessellation.maxError;
+            if (tessellation.screenSpace) {
+                // the patch lies in the convex hull of its control points: none of its points is
+                // closer to the camera than the closest control point
+                float distance = kInfinity;
+                for (uint32_t i = 0; i < 16; ++i)
+                    distance = std::min(distance, (controlPoints[np * 16 + i] - cameraPosition).length());
+                maxError *= pixelSize * std::max(distance, options.bias);
+            }
+            divs[np] = bezierPatchDivs(&controlPoints[np * 16], maxError, tessellation.maxDivs);
+        }
+    }
+
+    // an edge shared by two patches is divided as many times as in the coarser of the two
+    std::vector<uint32_t> edgeDivs(kTeapotNumPatches * 4);
+    for (uint32_t np = 0; np < kTeapotNumPatches; ++np) {
+        for (uint32_t e = 0; e < 4; ++e) {
+            edgeDivs[np * 4 + e] = divs[np];
+            if (tessellation.maxError <= 0) continue;
+            const Vec3f *cp = &controlPoints[np * 16];
+            for (uint32_t nq = 0; nq < kTeapotNumPatches; ++nq) {
+                for (uint32_t f = 0; f < 4 && nq != np; ++f) {
+                    const Vec3f *cq = &controlPoints[nq * 16];
+                    bool same = true, reversed = true;
+                    for (uint32_t i = 0; i < 4; ++i) {
+                        same = same && samePoint(cp[kPatchEdges[e][i]], cq[kPatchEdges[f][i]]);
+                        reversed = reversed && samePoint(cp[kPatchEdges[e][i]], cq[kPatchEdges[f][3 - i]]);
+                    }
+                    if (same || reversed)
+                        edgeDivs[np * 4 + e] = std::min(edgeDivs[np * 4 + e], divs[nq]);
+                }
+            }
+        }
+    }
+
+    // one basis table per number of divisions
+    std::vector<std::unique_ptr<BezierBasis>> bases(*std::max_element(divs.begin(), divs.end()) + 1);
+    for (uint32_t np = 0; np < kTeapotNumPatches; ++np) {
+        if (!bases[divs[np]]) bases[divs[np]].reset(new BezierBasis(divs[np]));
+    }
+
+    std::vector<std::unique_ptr<TriangleMesh>> meshes(kTeapotNumPatches);
+    parallelFor(kTeapotNumPatches, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t np = begin; np < end; ++np) {
+            uint32_t n = divs[np];
+            std::unique_ptr<Vec3f []> P(new Vec3f[(n + 1) * (n + 1)]);
+            std::unique_ptr<uint32_t []> nvertices(new uint32_t[n * n]);
+            std::unique_ptr<uint32_t []> vertices(new uint32_t[n * n * 4]);
+            std::unique_ptr<Vec3f []> N(new Vec3f[(n + 1) * (n + 1)]);
+            std::unique_ptr<Vec2f []> st(new Vec2f[(n + 1) * (n + 1)]);
+
+            // face connectivity
+            for (uint32_t j = 0, k = 0; j < n; ++j) {
+                for (uint32_t i = 0; i < n; ++i, ++k) {
+                    nvertices[k] = 4;
+                    vertices[k * 4    ] = (n + 1) * j + i;
+                    vertices[k * 4 + 1] = (n + 1) * j + i + 1;
+                    vertices[k * 4 + 2] = (n + 1) * (j + 1) + i + 1;
+                    vertices[k * 4 + 3] = (n + 1) * (j + 1) + i;
+                }
+            }
+
+            // generate grid (in object space, the mesh applies o2w)
+            Vec3f cp[16];
+            for (uint32_t i = 0; i < 16; ++i)
+                cp[i] = Vec3f(teapotVertices[teapotPatches[np][i] - 1][0],
+                              teapotVertices[teapotPatches[np][i] - 1][1],
+                              teapotVertices[teapotPatches[np][i] - 1][2]);
+            evalBezierPatchGrid(cp, *bases[n], P.get(), N.get());
+            for (uint32_t e = 0; e < 4; ++e) {
+                if (edgeDivs[np * 4 + e] < n) stitchPatchEdge(P.get(), n, e, edgeDivs[np * 4 + e]);
+            }
+            for (uint32_t j = 0, k = 0; j <= n; ++j) {
+                for (uint32_t i = 0; i <= n; ++i, ++k) {
+                    st[k].x = i / (float)n;
+                    st[k].y = j / (float)n;
+                }
+            }
+
+            meshes[np].reset(new TriangleMesh(o2w, n * n, nvertices, vertices, P, N, st));
+        }
+    });
+
+    for (auto& mesh : meshes) objects.push_back(std::move(mesh));
+}
+
+// [comment]
+// Evaluate the position and the two partial derivatives of a patch at (u, v), in the matrix form
+// of evalBezierPatchGrid.
+// [/comment]
+void evalBezierPatchDerivs(const Vec3f *controlPoints, float u, float v, Vec3f &P, Vec3f &dU, Vec3f &dV)
+{
+    float bu[4] = {(1 - u) * (1 - u) * (1 - u), 3 * u * (1 - u) * (1 - u), 3 * u * u * (1 - u), u * u * u};
+    float dbu[4] = {-3 * (1 - u) * (1 - u), 3 * (1 - u) * (1 - u) - 6 * u * (1 - u), 6 * u * (1 - u) - 3 * u * u, 3 * u * u};
+    float bv[4] = {(1 - v) * (1 - v) * (1 - v), 3 * v * (1 - v) * (1 - v), 3 * v * v * (1 - v), v * v * v};
+    float dbv[4] = {-3 * (1 - v) * (1 - v), 3 * (1 - v) * (1 - v) - 6 * v * (1 - v), 6 * v * (1 - v) - 3 * v * v, 3 * v * v};
+    Vec3f uCurve[4], duCurve[4];
+    for (uint32_t r = 0; r < 4; ++r) {
+        const Vec3f *row = controlPoints + 4 * r;
+        uCurve[r] = row[0] * bu[0] + row[1] * bu[1] + row[2] * bu[2] + row[3] * bu[3];
+        duCurve[r] = row[0] * dbu[0] + row[1] * dbu[1] + row[2] * dbu[2] + row[3] * dbu[3];
+    }
+    P = uCurve[0] * bv[0] + uCurve[1] * bv[1] + uCurve[2] * bv[2] + uCurve[3] * bv[3];
+    dU = duCurve[0] * bv[0] + duCurve[1] * bv[1] + duCurve[2] * bv[2] + duCurve[3] * bv[3];
+    dV = uCurve[0] * dbv[0] + uCurve[1] * dbv[1] + uCurve[2] * dbv[2] + uCurve[3] * dbv[3];
+}
+
+// [comment]
+// Split the cubic curve made of the points P[0], P[stride], P[2 * stride] and P[3 * stride] at
+// t = 0.5 with de Casteljau's algorithm. The control points of the two halves are written with
+// the same stride.
+// [/comment]
+void splitBezierCurve(const Vec3f *P, uint32_t stride, Vec3f *left, Vec3f *right)
+{
+    Vec3f p01 = (P[0] + P[stride]) * 0.5, p12 = (P[stride] + P[2 * stride]) * 0.5, p23 = (P[2 * stride] + P[3 * stride]) * 0.5;
+    Vec3f p012 = (p01 + p12) * 0.5, p123 = (p12 + p23) * 0.5;
+    Vec3f p0123 = (p012 + p123) * 0.5;
+    left[0] = P[0], left[stride] = p01, left[2 * stride] = p012, left[3 * stride] = p0123;
+    right[0] = p0123, right[stride] = p123, right[2 * stride] = p23, right[3 * stride] = P[3 * stride];
+}
+
+// [comment]
+// Split a patch into its four quarters: children[2 * b + a] covers u in [a / 2, (a + 1) / 2] and
+// v in [b / 2, (b + 1) / 2]. The rows (curves along u) are split first, then the columns.
+// [/comment]
+void splitBezierPatch(const Vec3f *controlPoints, Vec3f (*children)[16])
+{
+    Vec3f left[16], right[16];
+    for (uint32_t r = 0; r < 4; ++r)
+        splitBezierCurve(controlPoints + 4 * r, 1, left + 4 * r, right + 4 * r);
+    for (uint32_t c = 0; c < 4; ++c) {
+        splitBezierCurve(left + c, 4, children[0] + c, children[2] + c);
+        splitBezierCurve(right + c, 4, children[1] + c, children[3] + c);
+    }
+}
+
+// [comment]
+// A Bezier patch intersected directly, without tessellation. A patch lies in the convex hull of
+// its control points, and so does each of the sub-patches de Casteljau's algorithm splits it
+// into: the bounding boxes of the control points of the sub-patches make a hierarchy of bounding
+// volumes (a quadtree over the parametric domain) that rays traverse like a BVH. The upper levels
+// of the hierarchy are built the first time a ray reaches them and are kept, the lower levels are
+// computed on the fly. Once a sub-patch is small enough, the hit is found with Newton's method
+// (Martin, Cohen, Fish and Shirley, "Practical Ray Tracing of Trimmed NURBS Surfaces"): the ray
+// is the intersection of two planes, and we look for the (u, v) where the patch point lies on
+// both, starting from the center of the sub-patch. If Newton's method doesn't converge to a
+// point of the sub-patch, we split it further, down to kMaxDepth levels.
+//
+// Memory is a few dozen nodes per patch at most, whatever the accuracy: tessellating the patches
+// finely enough for close-ups would take millions of triangles. Note that the nodes are cached by
+// intersect() (which is const): this is fine since render() is single-threaded.
+// [/comment]
+class BezierPatch : public Object
+{
+public:
+    BezierPatch(const Matrix44f &o2w, const Vec3f *controlPoints) : Object(o2w)
+    {
+        // the control points are kept in world space (a Bezier patch is affine invariant)
         for (uint32_t i = 0; i < 16; ++i)
-            controlPoints[i][0] = teapotVertices[teapotPatches[np][i] - 1][0],
-            controlPoints[i][1] = teapotVertices[teapotPatches[np][i] - 1][1],
-            controlPoints[i][2] = teapotVertices[teapotPatches[np][i] - 1][2];
-
-        // generate grid
-        for (uint16_t j = 0, k = 0; j <= divs; ++j) {
-            float v = j / (float)divs;
-            for (uint16_t i = 0; i <= divs; ++i, ++k) {
-                float u = i / (float)divs;
-                P[k] = evalBezierPatch(controlPoints, u, v);
-                Vec3f dU = dUBezier(controlPoints, u, v);
-                Vec3f dV = dVBezier(controlPoints, u, v);
-                N[k] = dU.crossProduct(dV).normalize();
-                st[k].x = u;
-                st[k].y = v;
+            objectToWorld.multVecMatrix(controlPoints[i], root.controlPoints[i]);
+        root.computeBounds();
+        BBox[0] = root.bounds[0];
+        BBox[1] = root.bounds[1];
+    }
+    bool intersect(const Vec3f &orig, const Vec3f &dir, float &tNear, uint32_t &index, Vec2f &uv) const
+    {
+        // the ray as the intersection of two planes (through orig) that contain dir
+        Ray ray;
+        ray.orig = orig;
+        ray.dir = dir;
+        ray.invDir = Vec3f(1 / dir.x, 1 / dir.y, 1 / dir.z);
+        ray.n1 = (std::fabs(dir.x) > std::fabs(dir.y) && std::fabs(dir.x) > std::fabs(dir.z)) ?
+            Vec3f(dir.y, -dir.x, 0) : Vec3f(0, dir.z, -dir.y);
+        ray.n1.normalize();
+        ray.n2 = ray.n1.crossProduct(dir).normalize();
+        index = 0;
+        return intersectNode(root, 0, 0, 0, 1, ray, tNear, uv);
+    }
+    void getSurfaceProperties(
+        const Vec3f &hitPoint,
+        const Vec3f &viewDirection,
+        const uint32_t &index,
+        const Vec2f &uv,
+        Vec3f &hitNormal,
+        Vec2f &hitTextureCoordinates) const
+    {
+        // the normal is not defined where the patch degenerates to a point (the top of the lid
+        // for example): we take it slightly inside the patch
+        Vec3f P, dU, dV;
+        evalBezierPatchDerivs(root.controlPoints, clamp(1e-4, 1 - 1e-4, uv.x), clamp(1e-4, 1 - 1e-4, uv.y), P, dU, dV);
+        hitNormal = dU.crossProduct(dV).normalize();
+        hitTextureCoordinates = uv;
+    }
+    void displayInfo() const
+    {
+        std::cerr << "Bezier patch, " << numCachedNodes << " cached nodes" << std::endl;
+        std::cerr << BBox[0] << ", " << BBox[1] << std::endl;
+    }
+    static const uint32_t kCachedDepth = 3;    // levels of the hierarchy that are kept (at most 85 nodes)
+    static const uint32_t kMaxDepth = 10;      // sub-patches of 1/1024th of the patch in u and v
+    static const uint32_t kNewtonIterations = 8;
+    static constexpr float kNewtonTolerance = 1e-5; // distance (world units) between the ray and the hit point
+    struct Node
+    {
+        void computeBounds()
+        {
+            bounds[0] = bounds[1] = controlPoints[0];
+            for (uint32_t i = 1; i < 16; ++i) {
+                for (uint8_t a = 0; a < 3; ++a) {
+                    bounds[0][a] = std::min(bounds[0][a], controlPoints[i][a]);
+                    bounds[1][a] = std::max(bounds[1][a], controlPoints[i][a]);
+                }
+            }
+        }
+        Vec3f controlPoints[16];
+        Vec3f bounds[2];
+        mutable std::unique_ptr<Node []> children;  // the 4 quarters, built the first time a ray needs them
+    };
+    Node root;
+    mutable uint32_t numCachedNodes = 1;
+private:
+    struct Ray
+    {
+        Vec3f orig, dir, invDir;
+        Vec3f n1, n2;
+    };
+    static bool intersectBounds(const Ray &ray, const Vec3f *bounds, float tNear)
+    {
+        float tmin = 0, tmax = tNear;
+        for (uint8_t a = 0; a < 3; ++a) {
+            float t0 = (bounds[0][a] - ray.orig[a]) * ray.invDir[a];
+            float t1 = (bounds[1][a] - ray.orig[a]) * ray.invDir[a];
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+        }
+        return tmin <= tmax;
+    }
+    // [comment]
+    // Solve for the (u, v) where the patch point lies on the two planes of the ray, starting from
+    // (u, v). The distances to the planes are F(u, v) = (n1.(P - orig), n2.(P - orig)), and each
+    // step solves the 2x2 system J (du, dv) = -F where J is made of the plane normals dotted with
+    // the partial derivatives of the patch.
+    // [/comment]
+    bool newton(const Ray &ray, float &u, float &v, float &t) const
+    {
+        for (uint32_t i = 0; i < kNewtonIterations; ++i) {
+            Vec3f P, dU, dV;
+            evalBezierPatchDerivs(root.controlPoints, u, v, P, dU, dV);
+            Vec3f d = P - ray.orig;
+            float f1 = ray.n1.dotProduct(d), f2 = ray.n2.dotProduct(d);
+            if (std::fabs(f1) + std::fabs(f2) < kNewtonTolerance) {
+                t = ray.dir.dotProduct(d);
+                return true;
+            }
+            float j11 = ray.n1.dotProduct(dU), j12 = ray.n1.dotProduct(dV);
+            float j21 = ray.n2.dotProduct(dU), j22 = ray.n2.dotProduct(dV);
+            float det = j11 * j22 - j12 * j21;
+            if (det == 0) return false;
+            u -= (j22 * f1 - j12 * f2) / det;
+            v -= (j11 * f2 - j21 * f1) / det;
+        }
+        return false;
+    }
+    bool intersectNode(const Node &node, uint32_t depth, float u0, float v0, float size, const Ray &ray, float &tNear, Vec2f &uv) const
+    {
+        if (!intersectBounds(ray, node.bounds, tNear)) return false;
+        if (depth >= kCachedDepth) {
+            float u = u0 + size / 2, v = v0 + size / 2, t;
+            const float margin = size * 1e-3;  // so that hits on the sides of sub-patches are not missed
+            if (newton(ray, u, v, t) &&
+                u >= u0 - margin && u <= u0 + size + margin && v >= v0 - margin && v <= v0 + size + margin) {
+                if (t <= 0 || t >= tNear) return false;
+                tNear = t;
+                uv.x = clamp(0, 1, u);
+                uv.y = clamp(0, 1, v);
+                return true;
+            }
+            if (depth == kMaxDepth) return false;
+        }
+        const Node *children;
+        Node split[4];
+        if (depth < kCachedDepth) {
+            if (!node.children) {
+                std::unique_ptr<Node []> quarters(new Node[4]);
+                Vec3f controlPoints[4][16];
+                splitBezierPatch(node.controlPoints, controlPoints);
+                for (uint32_t k = 0; k < 4; ++k) {
+                    std::copy(controlPoints[k], controlPoints[k] + 16, quarters[k].controlPoints);
+                    quarters[k].computeBounds();
+                }
+                node.children = std::move(quarters);
+                numCachedNodes += 4;
             }
+            children = node.children.get();
         }
+        else {
+            Vec3f controlPoints[4][16];
+            splitBezierPatch(node.controlPoints, controlPoints);
+            for (uint32_t k = 0; k < 4; ++k) {
+                std::copy(controlPoints[k], controlPoints[k] + 16, split[k].controlPoints);
+                split[k].computeBounds();
+            }
+            children = split;
+        }
+        bool hit = false;
+        for (uint32_t k = 0; k < 4; ++k)
+            hit |= intersectNode(children[k], depth + 1, u0 + (k & 1) * size / 2, v0 + (k >> 1) * size / 2, size / 2, ray, tNear, uv);
+        return hit;
+    }
+};
 
-        objects.push_back(std::unique_ptr<TriangleMesh>(new TriangleMesh(o2w, divs * divs, nvertices, vertices, P, N, st)));
+// [comment]
+// The Utah teapot as Bezier patches, rendered without tessellation
+// [/comment]
+void createPatchTeapot(const Matrix44f& o2w, std::vector<std::unique_ptr<Object>> &objects)
+{
+    for (uint32_t np = 0; np < kTeapotNumPatches; ++np) {
+        Vec3f controlPoints[16];
+        for (uint32_t i = 0; i < 16; ++i)
+            controlPoints[i] = Vec3f(teapotVertices[teapotPatches[np][i] - 1][0],
+                                     teapotVertices[teapotPatches[np][i] - 1][1],
+                                     teapotVertices[teapotPatches[np][i] - 1][2]);
+        objects.push_back(std::unique_ptr<BezierPatch>(new BezierPatch(o2w, controlPoints)));
     }
 }
 
@@ -544,9 +1018,9 @@ Vec3f curveData[curveNumPts] = {
 };
 
 // [comment]
-// Generate a thin cylinder centred around a Bezier curve
+// Generate a thin cylinder centred around a Bezier curve (curveNumPts points, curveData by default)
 // [/comment]
-void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects)
+void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects, const Vec3f *points = curveData)
 {
     uint32_t ndivs = 16;
     uint32_t ncurves = 1 + (curveNumPts - 4) / 3;
@@ -556,10 +1030,10 @@ void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects)
     std::unique_ptr<Vec2f []> st(new Vec2f[(ndivs + 1) * ndivs * ncurves + 1]);
     for (uint32_t i = 0; i < ncurves; ++i) {
         for (uint32_t j = 0; j < ndivs; ++j) {
-            pts[0] = curveData[i * 3];
-            pts[1] = curveData[i * 3 + 1];
-            pts[2] = curveData[i * 3 + 2];
-            pts[3] = curveData[i * 3 + 3];
+            pts[0] = points[i * 3];
+            pts[1] = points[i * 3 + 1];
+            pts[2] = points[i * 3 + 2];
+            pts[3] = points[i * 3 + 3];
             float s = j / (float)ndivs;
             Vec3f pt = evalBezierCurve(pts, s);
             Vec3f tangent = derivBezier(pts, s).normalize();
@@ -611,8 +1085,8 @@ void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects)
             }
         }
     }
-    P[(ndivs + 1) * ndivs * ncurves] = curveData[curveNumPts - 1];
-    N[(ndivs + 1) * ndivs * ncurves] = (curveData[curveNumPts - 2] - curveData[curveNumPts - 1]).normalize();
+    P[(ndivs + 1) * ndivs * ncurves] = points[curveNumPts - 1];
+    N[(ndivs + 1) * ndivs * ncurves] = (points[curveNumPts - 2] - points[curveNumPts - 1]).normalize();
     st[(ndivs + 1) * ndivs * ncurves] = Vec2f(1, 0.5);
     uint32_t numFaces = ndivs * ndivs * ncurves;
     std::unique_ptr<uint32_t []> verts(new uint32_t[numFaces]);
@@ -647,6 +1121,362 @@ void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects)
 }
 
 
+// [comment]
+// Bezier curves rendered without converting them to meshes, for hair-like content. Each cubic
+// segment is intersected directly with the method of Nakamaru and Ohno ("Ray Tracing for Curves
+// Primitive"), the one pbrt uses: the control points are transformed to a coordinate system
+// where the ray starts at the origin and runs along the z-axis, then the segment is split
+// recursively. A sub-segment is skipped as soon as the bounding box of its control points,
+// grown by the radius of the curve, doesn't contain the origin (the ray). Once it is flat
+// enough, the sub-segment is approximated by the line joining its end points: the point of the
+// curve closest to the ray is found along this line and we have a hit if it is closer to the ray
+// than the radius of the curve at that point.
+//
+// The curve is a flat ribbon that always faces the ray. With kCurveTube, its normal is bent
+// across the ribbon as if it was the section of a tube, which makes it look round. The segments
+// are put in a bounding volume hierarchy whose leaves test an oriented bounding box (aligned with
+// the segment chord) before the exact test: thin curves that run diagonally have very loose
+// axis-aligned boxes.
+// [/comment]
+enum CurveType { kCurveRibbon, kCurveTube };
+
+class BezierCurves : public Object
+{
+public:
+    // [comment]
+    // The curves have numPointsPerCurve points each (3 * n + 1 for n segments). The radius of
+    // each curve decreases linearly from rootRadius to tipRadius.
+    // [/comment]
+    BezierCurves(
+        const Matrix44f &o2w,
+        uint32_t numCurves,
+        uint32_t numPointsPerCurve,
+        const Vec3f *points,
+        float rootRadius,
+        float tipRadius,
+        CurveType curveType = kCurveTube) : Object(o2w), type(curveType)
+    {
+        uint32_t numSegmentsPerCurve = (numPointsPerCurve - 1) / 3;
+        numSegments = numCurves * numSegmentsPerCurve;
+        segments = std::unique_ptr<Segment []>(new Segment[numSegments]);
+        for (uint32_t c = 0, n = 0; c < numCurves; ++c) {
+            for (uint32_t i = 0; i < numSegmentsPerCurve; ++i, ++n) {
+                Segment &segment = segments[n];
+                for (uint32_t k = 0; k < 4; ++k)
+                    objectToWorld.multVecMatrix(points[c * numPointsPerCurve + i * 3 + k], segment.cp[k]);
+                segment.u[0] = i / float(numSegmentsPerCurve);
+                segment.u[1] = (i + 1) / float(numSegmentsPerCurve);
+                segment.radius[0] = rootRadius + (tipRadius - rootRadius) * segment.u[0];
+                segment.radius[1] = rootRadius + (tipRadius - rootRadius) * segment.u[1];
+                segment.computeBounds();
+            }
+        }
+        std::unique_ptr<uint32_t []> ids(new uint32_t[numSegments]);
+        for (uint32_t i = 0; i < numSegments; ++i) ids[i] = i;
+        nodes.resize(1);
+        buildNode(0, ids.get(), 0, numSegments);
+        // reorder the segments the way the leaves reference them
+        std::unique_ptr<Segment []> sorted(new Segment[numSegments]);
+        for (uint32_t i = 0; i < numSegments; ++i) sorted[i] = segments[ids[i]];
+        segments = std::move(sorted);
+        BBox[0] = nodes[0].bounds[0];
+        BBox[1] = nodes[0].bounds[1];
+    }
+    bool intersect(const Vec3f &orig, const Vec3f &dir, float &tNear, uint32_t &index, Vec2f &uv) const
+    {
+        // the ray space: the ray runs along the z-axis (dx, dy, dir is a right-handed frame)
+        Ray ray;
+        ray.orig = orig;
+        ray.dir = dir;
+        ray.invDir = Vec3f(1 / dir.x, 1 / dir.y, 1 / dir.z);
+        ray.dx = (std::fabs(dir.x) > std::fabs(dir.y)) ? Vec3f(-dir.z, 0, dir.x) : Vec3f(0, dir.z, -dir.y);
+        ray.dx.normalize();
+        ray.dy = dir.crossProduct(ray.dx);
+        bool isect = false;
+        uint32_t stack[64], stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize) {
+            const Node &node = nodes[stack[--stackSize]];
+            if (!intersectBounds(ray, node.bounds, tNear)) continue;
+            if (node.numSegments == 0) {
+                stack[stackSize++] = node.offset;
+                stack[stackSize++] = node.offset + 1;
+                continue;
+            }
+            for (uint32_t i = node.offset; i < node.offset + node.numSegments; ++i) {
+                const Segment &segment = segments[i];
+                if (!intersectOrientedBounds(ray, segment, tNear)) continue;
+                Vec3f cp[4];
+                for (uint32_t k = 0; k < 4; ++k) {
+                    Vec3f p = segment.cp[k] - orig;
+                    cp[k] = Vec3f(p.dotProduct(ray.dx), p.dotProduct(ray.dy), p.dotProduct(dir));
+                }
+                if (intersectSegment(segment, cp, 0, 1, segment.maxDepth, tNear, uv)) {
+                    index = i;
+                    isect = true;
+                }
+            }
+        }
+        return isect;
+    }
+    void getSurfaceProperties(
+        const Vec3f &hitPoint,
+        const Vec3f &viewDirection,
+        const uint32_t &index,
+        const Vec2f &uv,
+        Vec3f &hitNormal,
+        Vec2f &hitTextureCoordinates) const
+    {
+        const Segment &segment = segments[index];
+        float u = (uv.x - segment.u[0]) / (segment.u[1] - segment.u[0]);
+        Vec3f tangent = derivBezier(segment.cp, u).normalize();
+        // the ribbon faces the ray
+        hitNormal = -viewDirection - tangent * tangent.dotProduct(-viewDirection);
+        hitNormal.normalize();
+        if (type == kCurveTube) {
+            // v goes across the ribbon, from one side of the tube (-90 degrees) to the other
+            float sinTheta = clamp(-1, 1, 2 * uv.y - 1);
+            Vec3f side = tangent.crossProduct(-viewDirection).normalize();
+            hitNormal = hitNormal * sqrtf(1 - sinTheta * sinTheta) + side * sinTheta;
+        }
+        hitTextureCoordinates = uv;
+    }
+    void displayInfo() const
+    {
+        std::cerr << "Number of curve segments: " << numSegments << ", BVH nodes: " << nodes.size() << std::endl;
+        std::cerr << BBox[0] << ", " << BBox[1] << std::endl;
+    }
+    size_t memoryUsage() const { return numSegments * sizeof(Segment) + nodes.size() * sizeof(Node); }
+    static const uint32_t kMaxSegmentsPerLeaf = 2;
+    static const uint32_t kMaxSplitDepth = 10;
+private:
+    struct Segment
+    {
+        void computeBounds()
+        {
+            float maxRadius = std::max(radius[0], radius[1]);
+            // axis-aligned bounds (for the BVH)
+            bounds[0] = bounds[1] = cp[0];
+            for (uint32_t k = 1; k < 4; ++k) {
+                for (uint8_t a = 0; a < 3; ++a) {
+                    bounds[0][a] = std::min(bounds[0][a], cp[k][a]);
+                    bounds[1][a] = std::max(bounds[1][a], cp[k][a]);
+                }
+            }
+            bounds[0] = bounds[0] - maxRadius;
+            bounds[1] = bounds[1] + maxRadius;
+            // oriented bounds: the first axis along the chord, the second one toward the inner
+            // control points, so that the box is tight for planar segments
+            axis[0] = cp[3] - cp[0];
+            if (axis[0].dotProduct(axis[0]) == 0) axis[0] = Vec3f(1, 0, 0);
+            axis[0].normalize();
+            Vec3f inner = (cp[1] + cp[2]) * 0.5 - cp[0];
+            axis[1] = inner - axis[0] * axis[0].dotProduct(inner);
+            if (axis[1].dotProduct(axis[1]) < 1e-12) axis[1] = std::fabs(axis[0].x) > 0.9 ? Vec3f(0, 1, 0) : Vec3f(1, 0, 0);
+            axis[1] = (axis[1] - axis[0] * axis[0].dotProduct(axis[1])).normalize();
+            axis[2] = axis[0].crossProduct(axis[1]);
+            for (uint8_t a = 0; a < 3; ++a) {
+                extent[0][a] = extent[1][a] = cp[0].dotProduct(axis[a]);
+                for (uint32_t k = 1; k < 4; ++k) {
+                    float d = cp[k].dotProduct(axis[a]);
+                    extent[0][a] = std::min(extent[0][a], d);
+                    extent[1][a] = std::max(extent[1][a], d);
+                }
+                extent[0][a] -= maxRadius;
+                extent[1][a] += maxRadius;
+            }
+            // [comment]
+            // Number of times the segment must be split before it can be replaced by a line, to
+            // within 1/20th of its radius: it depends on the second differences of the control
+            // points (see pbrt, section 3.7).
+            // [/comment]
+            float L0 = 0;
+            for (uint32_t k = 0; k < 2; ++k) {
+                Vec3f d = cp[k] - cp[k + 1] * 2 + cp[k + 2];
+                L0 = std::max(L0, std::max(std::fabs(d.x), std::max(std::fabs(d.y), std::fabs(d.z))));
+            }
+            float eps = std::max(std::min(radius[0], radius[1]), maxRadius * 0.1f) * 0.1f;
+            maxDepth = 0;
+            if (L0 > 0 && eps > 0) {
+                float r0 = 0.5f * std::log2(1.41421356237f * 6.f * L0 / (8.f * eps));
+                maxDepth = (uint32_t)clamp(0, kMaxSplitDepth, std::ceil(r0));
+            }
+        }
+        Vec3f cp[4];
+        float u[2];       // parametric range of the segment along its curve
+        float radius[2];
+        Vec3f bounds[2];
+        Vec3f axis[3];
+        Vec3f extent[2];  // oriented bounds (along axis[0], axis[1] and axis[2])
+        uint32_t maxDepth;
+    };
+    struct Node
+    {
+        Vec3f bounds[2];
+        uint32_t offset;       // the first child node (the second one follows it), or the first segment
+        uint32_t numSegments;  // 0 for an interior node
+    };
+    struct Ray
+    {
+        Vec3f orig, dir, invDir;
+        Vec3f dx, dy;
+    };
+    // [comment]
+    // Build the BVH by splitting the segments at the median of their centers, along the axis
+    // where the centers are the most spread out.
+    // [/comment]
+    void buildNode(uint32_t nodeIndex, uint32_t *ids, uint32_t first, uint32_t count)
+    {
+        Vec3f bounds[2] = {kInfinity, -kInfinity}, centers[2] = {kInfinity, -kInfinity};
+        for (uint32_t i = first; i < first + count; ++i) {
+            const Segment &segment = segments[ids[i]];
+            Vec3f center = (segment.bounds[0] + segment.bounds[1]) * 0.5;
+            for (uint8_t a = 0; a < 3; ++a) {
+                bounds[0][a] = std::min(bounds[0][a], segment.bounds[0][a]);
+                bounds[1][a] = std::max(bounds[1][a], segment.bounds[1][a]);
+                centers[0][a] = std::min(centers[0][a], center[a]);
+                centers[1][a] = std::max(centers[1][a], center[a]);
+            }
+        }
+        nodes[nodeIndex].bounds[0] = bounds[0];
+        nodes[nodeIndex].bounds[1] = bounds[1];
+        if (count <= kMaxSegmentsPerLeaf) {
+            nodes[nodeIndex].offset = first;
+            nodes[nodeIndex].numSegments = count;
+            return;
+        }
+        Vec3f spread = centers[1] - centers[0];
+        uint8_t axis = (spread.x > spread.y && spread.x > spread.z) ? 0 : (spread.y > spread.z) ? 1 : 2;
+        uint32_t mid = first + count / 2;
+        std::nth_element(ids + first, ids + mid, ids + first + count, [&](uint32_t a, uint32_t b) {
+            return segments[a].bounds[0][axis] + segments[a].bounds[1][axis] <
+                   segments[b].bounds[0][axis] + segments[b].bounds[1][axis];
+        });
+        // the two children are stored next to each other
+        uint32_t left = nodes.size();
+        nodes.resize(left + 2);
+        nodes[nodeIndex].offset = left;
+        nodes[nodeIndex].numSegments = 0;
+        buildNode(left, ids, first, mid - first);
+        buildNode(left + 1, ids, mid, first + count - mid);
+    }
+    static bool intersectBounds(const Ray &ray, const Vec3f *bounds, float tNear)
+    {
+        float tmin = 0, tmax = tNear;
+        for (uint8_t a = 0; a < 3; ++a) {
+            float t0 = (bounds[0][a] - ray.orig[a]) * ray.invDir[a];
+            float t1 = (bounds[1][a] - ray.orig[a]) * ray.invDir[a];
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+        }
+        return tmin <= tmax;
+    }
+    static bool intersectOrientedBounds(const Ray &ray, const Segment &segment, float tNear)
+    {
+        float tmin = 0, tmax = tNear;
+        for (uint8_t a = 0; a < 3; ++a) {
+            float o = ray.orig.dotProduct(segment.axis[a]), d = ray.dir.dotProduct(segment.axis[a]);
+            if (d == 0) {
+                if (o < segment.extent[0][a] || o > segment.extent[1][a]) return false;
+                continue;
+            }
+            float t0 = (segment.extent[0][a] - o) / d;
+            float t1 = (segment.extent[1][a] - o) / d;
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+        }
+        return tmin <= tmax;
+    }
+    // [comment]
+    // cp are the control points of the part of the segment over [u0, u1], in ray space
+    // [/comment]
+    bool intersectSegment(const Segment &segment, const Vec3f *cp, float u0, float u1, uint32_t depth, float &tNear, Vec2f &uv) const
+    {
+        float maxRadius = std::max(segment.radius[0] + (segment.radius[1] - segment.radius[0]) * u0,
+                                   segment.radius[0] + (segment.radius[1] - segment.radius[0]) * u1);
+        Vec3f lo = cp[0], hi = cp[0];
+        for (uint32_t k = 1; k < 4; ++k) {
+            for (uint8_t a = 0; a < 3; ++a) {
+                lo[a] = std::min(lo[a], cp[k][a]);
+                hi[a] = std::max(hi[a], cp[k][a]);
+            }
+        }
+        if (lo.x - maxRadius > 0 || hi.x + maxRadius < 0 || lo.y - maxRadius > 0 || hi.y + maxRadius < 0 ||
+            hi.z + maxRadius < 0 || lo.z - maxRadius > tNear)
+            return false;
+
+        if (depth > 0) {
+            Vec3f left[4], right[4];
+            splitBezierCurve(cp, 1, left, right);
+            float um = (u0 + u1) * 0.5;
+            bool hitLeft = intersectSegment(segment, left, u0, um, depth - 1, tNear, uv);
+            bool hitRight = intersectSegment(segment, right, um, u1, depth - 1, tNear, uv);
+            return hitLeft || hitRight;
+        }
+
+        // the origin must lie between the lines perpendicular to the curve at the end points of
+        // the sub-segment (the neighbouring sub-segments cover what is beyond)
+        if ((cp[1].x - cp[0].x) * -cp[0].x + (cp[1].y - cp[0].y) * -cp[0].y < 0) return false;
+        if ((cp[2].x - cp[3].x) * -cp[3].x + (cp[2].y - cp[3].y) * -cp[3].y < 0) return false;
+
+        // closest point to the origin along the line from cp[0] to cp[3]
+        float dx = cp[3].x - cp[0].x, dy = cp[3].y - cp[0].y;
+        float denom = dx * dx + dy * dy;
+        if (denom == 0) return false;
+        float w = clamp(0, 1, -(cp[0].x * dx + cp[0].y * dy) / denom);
+        float u = u0 + (u1 - u0) * w;
+        float radius = segment.radius[0] + (segment.radius[1] - segment.radius[0]) * u;
+        Vec3f pcRay = evalBezierCurve(cp, w);
+        float dist2 = pcRay.x * pcRay.x + pcRay.y * pcRay.y;
+        if (dist2 > radius * radius) return false;
+        float t = pcRay.z;
+        if (t <= 0 || t >= tNear) return false;
+        // signed distance from the curve to the ray, across the ribbon
+        Vec3f tangent = derivBezier(cp, w);
+        float side = tangent.x * -pcRay.y - tangent.y * -pcRay.x;
+        float dist = std::sqrt(dist2);
+        tNear = t;
+        uv.x = segment.u[0] + (segment.u[1] - segment.u[0]) * u;
+        uv.y = 0.5 + ((side > 0) ? dist : -dist) / (2 * radius);
+        return true;
+    }
+    CurveType type;
+    uint32_t numSegments;
+    std::unique_ptr<Segment []> segments;
+    std::vector<Node> nodes;
+};
+
+// [comment]
+// Hair-like content for the curve benchmark: numCurves copies of curveData, randomly rotated
+// about the y-axis, scaled and moved over a disk. The first copy is curveData itself.
+// [/comment]
+std::unique_ptr<Vec3f []> createHairCurves(uint32_t numCurves)
+{
+    std::unique_ptr<Vec3f []> points(new Vec3f[numCurves * curveNumPts]);
+    std::mt19937 gen(2015);
+    std::uniform_real_distribution<float> dis(0, 1);
+    for (uint32_t c = 0; c < numCurves; ++c) {
+        float angle = 0, scale = 1, x = 0, z = 0;
+        if (c > 0) {
+            angle = 2 * M_PI * dis(gen);
+            scale = 0.4 + 0.6 * dis(gen);
+            float r = 1.5 * std::sqrt(dis(gen)), theta = 2 * M_PI * dis(gen);
+            x = r * cos(theta);
+            z = r * sin(theta);
+        }
+        for (uint32_t i = 0; i < curveNumPts; ++i) {
+            const Vec3f &p = curveData[i];
+            points[c * curveNumPts + i] = Vec3f(
+                x + scale * (p.x * cos(angle) + p.z * sin(angle)),
+                scale * p.y,
+                z + scale * (p.z * cos(angle) - p.x * sin(angle)));
+        }
+    }
+    return points;
+}
+
 // [comment]
 // In the main function of the program, we create the scene (create objects and lights)
 // as well as set the options for the render (image widht and height, maximum recursion
@@ -654,11 +1484,26 @@ void createCurveGeometry(std::vector<std::unique_ptr<Object>> &objects)
 // [/comment]
 int main(int argc, char **argv)
 {
-    // loading gemetry
-    std::vector<std::unique_ptr<Object>> objects;
-
-    createPolyTeapot(Matrix44f(1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1), objects);
-    //createCurveGeometry(objects);
+    // [comment]
+    // Tessellation options: -divs N divides every patch into N x N quads (8 by default), -error E
+    // and -pixel-error E tessellate each patch adaptively, to within E world units or E pixels.
+    // -patches renders the patches directly, without tessellating them. -curve mesh|ribbon|tube
+    // renders -curves N Bezier curves instead of the teapot, either converted to tubes made of
+    // quads or intersected directly (see BezierCurves).
+    // [/comment]
+    TessellationOptions tessellation;
+    bool patches = false;
+    const char *curve = nullptr;
+    uint32_t numCurves = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-patches")) patches = true;
+        else if (i == argc - 1) break;
+        else if (!strcmp(argv[i], "-curve")) curve = argv[++i];
+        else if (!strcmp(argv[i], "-curves")) numCurves = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "-divs")) tessellation.divs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-error")) tessellation.maxError = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-pixel-error")) tessellation.maxError = atof(argv[++i]), tessellation.screenSpace = true;
+    }
 
     // lights
     std::vector<std::unique_ptr<Light>> lights;
@@ -672,12 +1517,56 @@ int main(int argc, char **argv)
 
     // to render the teapot
     options.cameraToWorld = Matrix44f(0.897258, 0, -0.441506, 0, -0.288129, 0.757698, -0.585556, 0, 0.334528, 0.652606, 0.679851, 0, 5.439442, 11.080794, 10.381341, 1);
-    
-    // to render the curve as geometry
-    //options.cameraToWorld = Matrix44f(0.707107, 0, -0.707107, 0, -0.369866, 0.85229, -0.369866, 0, 0.60266, 0.523069, 0.60266, 0, 2.634, 3.178036, 2.262122, 1);
+
+    // loading gemetry
+    std::vector<std::unique_ptr<Object>> objects;
+
+    const Matrix44f teapotToWorld(1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1);
+    if (curve) {
+        // to render the curve as geometry
+        options.cameraToWorld = Matrix44f(0.707107, 0, -0.707107, 0, -0.369866, 0.85229, -0.369866, 0, 0.60266, 0.523069, 0.60266, 0, 2.634, 3.178036, 2.262122, 1);
+        std::unique_ptr<Vec3f []> points = createHairCurves(numCurves);
+        size_t bytes = 0;
+        if (!strcmp(curve, "mesh")) {
+            for (uint32_t c = 0; c < numCurves; ++c) {
+                createCurveGeometry(objects, points.get() + c * curveNumPts);
+                bytes += static_cast<const TriangleMesh *>(objects.back().get())->memoryUsage();
+            }
+        }
+        else {
+            CurveType type = strcmp(curve, "ribbon") ? kCurveTube : kCurveRibbon;
+            std::unique_ptr<BezierCurves> curves(new BezierCurves(Matrix44f::kIdentity, numCurves, curveNumPts, points.get(), 0.1, 0, type));
+            bytes = curves->memoryUsage();
+            objects.push_back(std::move(curves));
+        }
+        fprintf(stderr, "Curves: %u curves as %s (%.1f KB)\n", numCurves, curve, bytes / 1024.);
+    }
+    else if (patches) {
+        createPatchTeapot(teapotToWorld, objects);
+    }
+    else {
+        auto timeStart = std::chrono::high_resolution_clock::now();
+        createPolyTeapot(teapotToWorld, objects, tessellation, options);
+        auto timeEnd = std::chrono::high_resolution_clock::now();
+        uint32_t numTris = 0;
+        size_t bytes = 0;
+        for (const auto &object : objects) {
+            const TriangleMesh *mesh = static_cast<const TriangleMesh *>(object.get());
+            numTris += mesh->numTris;
+            bytes += mesh->memoryUsage();
+        }
+        fprintf(stderr, "Tessellation: %u triangles in %.2f ms (%.1f KB)\n", numTris,
+            std::chrono::duration<double, std::milli>(timeEnd - timeStart).count(), bytes / 1024.);
+    }
 
     // finally, render
     render(options, objects, lights);
+    if (patches) {
+        uint32_t numNodes = 0;
+        for (const auto &object : objects) numNodes += static_cast<const BezierPatch *>(object.get())->numCachedNodes;
+        fprintf(stderr, "Bezier patches: %u patches, %u cached nodes (%.1f KB)\n", (uint32_t)objects.size(), numNodes,
+            numNodes * sizeof(BezierPatch::Node) / 1024.);
+    }
 
     return 0;
 }
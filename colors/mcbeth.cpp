@@ -33,7 +33,11 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdio>
+#include <cstdint>
+#include <cassert>
 #include <cmath>
+#include <algorithm>
+#include <vector>
 
 // [comment]
 // Color Matching Function: 380-730x5
@@ -111,49 +115,136 @@ void spectrumToXYZ(int colorIndex, float& X, float& Y, float& Z)
     Z /= S;
 }
 
-class Image
+// [comment]
+// How the channels of the pixels are arranged in memory: interleaved (r g b r g b ..., the way
+// the PPM format stores them) or planar (all the red values of the image, then all the green
+// values, then all the blue values). With the planar layout each channel of a row is a
+// contiguous array of floats, which is what SIMD instructions want.
+// [/comment]
+enum ImageLayout { kInterleaved, kPlanar };
+
+// [comment]
+// A w x h RGB image in memory that the view doesn't own. The value of channel c of the pixel
+// (x, y) is at data[y * rowStride + c * planeStride + x * kPixelStride]: sub-images and rows of
+// an image are views of the same memory, nothing is copied.
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageView
 {
 public:
-    Image(const int &w, const int &h) : width(w), height(h)
+    static const unsigned int kNumChannels = 3;
+    static const unsigned int kPixelStride = (layout == kInterleaved) ? kNumChannels : 1;
+    ImageView() : w(0), h(0), rowStride(0), planeStride(0), data(nullptr) {}
+    ImageView(T *_data, const unsigned int &_w, const unsigned int &_h, const size_t &_rowStride, const size_t &_planeStride) :
+        w(_w), h(_h), rowStride(_rowStride), planeStride(_planeStride), data(_data) {}
+    T& operator () (const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    {
+        assert(x < w && y < h && c < kNumChannels);
+        return data[y * rowStride + c * planeStride + x * kPixelStride];
+    }
+    // the values of channel c along row y, kPixelStride apart
+    T* scanline(const unsigned int &y, const unsigned int &c = 0) const
+    { return data + y * rowStride + c * planeStride; }
+    ImageView view(const unsigned int &x, const unsigned int &y, const unsigned int &_w, const unsigned int &_h) const
     {
-        imageData = new float [w * h * 3];
+        assert(x + _w <= w && y + _h <= h);
+        return ImageView(data + y * rowStride + x * kPixelStride, _w, _h, rowStride, planeStride);
     }
-    ~Image()
+    ImageView rowView(const unsigned int &y) const { return view(0, y, w, 1); }
+    // set every pixel to values (one value per channel)
+    void fill(const T *values) const
+    {
+        for (unsigned int y = 0; y < h; ++y) {
+            for (unsigned int c = 0; c < kNumChannels; ++c) {
+                T *row = scanline(y, c);
+                for (unsigned int x = 0; x < w; ++x) row[x * kPixelStride] = values[c];
+            }
+        }
+    }
+    unsigned int w, h;
+    size_t rowStride, planeStride; // in number of values
+    T *data;
+};
+
+// [comment]
+// An image that owns its pixels. Every row (of every plane with the planar layout) starts on a
+// 64-byte boundary, the size of a cache line and of an AVX-512 register: rows are padded to a
+// multiple of 64 bytes, which is why the distance between rows (the stride) can be larger than
+// the width. Copying an image is expensive, so images can be moved but not copied (copy() makes
+// a copy explicitly).
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageBuffer : public ImageView<T, layout>
+{
+public:
+    static const size_t kAlignment = 64;
+    ImageBuffer() : memory(nullptr) {}
+    ImageBuffer(const unsigned int &_w, const unsigned int &_h) : memory(nullptr)
     {
-        delete [] imageData;
+        const unsigned int numChannels = ImageView<T, layout>::kNumChannels;
+        const size_t valuesPerLine = kAlignment / sizeof(T);
+        size_t rowSize = (layout == kInterleaved) ? _w * numChannels : _w;
+        rowSize = (rowSize + valuesPerLine - 1) / valuesPerLine * valuesPerLine;
+        size_t size = rowSize * _h * ((layout == kInterleaved) ? 1 : numChannels);
+        memory = new char[size * sizeof(T) + kAlignment - 1]; // this throws an exception if bad_alloc
+        T *data = reinterpret_cast<T *>((reinterpret_cast<uintptr_t>(memory) + kAlignment - 1) & ~(uintptr_t)(kAlignment - 1));
+        std::fill(data, data + size, T(0));
+        static_cast<ImageView<T, layout> &>(*this) =
+            ImageView<T, layout>(data, _w, _h, rowSize, (layout == kInterleaved) ? 1 : rowSize * _h);
     }
-    void setPixel(const float *pixelValues, const int &x, const int &y)
+    ImageBuffer(const ImageBuffer &) = delete;
+    ImageBuffer& operator = (const ImageBuffer &) = delete;
+    ImageBuffer(ImageBuffer &&img) : ImageView<T, layout>(img), memory(img.memory)
     {
-        imageData[(y * width + x) * 3] = pixelValues[0];
-        imageData[(y * width + x) * 3 + 1] = pixelValues[1];
-        imageData[(y * width + x) * 3 + 2] = pixelValues[2];
+        img.memory = nullptr;
+        static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
     }
-    void saveToPpm(const char *filename)
+    ImageBuffer& operator = (ImageBuffer &&img)
     {
-        float gamma = 1;
-        std::ofstream ofs;
-        ofs.open(filename);
-        ofs << "P6\n" << width << " " << height << "\n255\n";
-        float *pixel = imageData;
-        for (int j = 0; j < height; ++j) {
-            for (int i = 0; i < width; ++i) {
-                unsigned char r = (unsigned char)(std::max(0.f, std::min(255.f, powf(pixel[0], 1 / gamma) * 255 + 0.5f)));
-                unsigned char g = (unsigned char)(std::max(0.f, std::min(255.f, powf(pixel[1], 1 / gamma) * 255 + 0.5f)));
-                unsigned char b = (unsigned char)(std::max(0.f, std::min(255.f, powf(pixel[2], 1 / gamma) * 255 + 0.5f)));
-                ofs << r << g << b;
-                pixel += 3;
-            }
+        if (this != &img) {
+            delete [] memory;
+            static_cast<ImageView<T, layout> &>(*this) = img;
+            memory = img.memory;
+            img.memory = nullptr;
+            static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
         }
-        ofs.close();
+        return *this;
     }
-    void readPpm(const char *filename)
+    ~ImageBuffer() { delete [] memory; }
+    ImageBuffer copy() const
     {
-        /* TO DO */
+        ImageBuffer img(this->w, this->h);
+        size_t size = this->rowStride * this->h * ((layout == kInterleaved) ? 1 : ImageView<T, layout>::kNumChannels);
+        std::copy(this->data, this->data + size, img.data);
+        return img;
     }
-    float *imageData;
-    int width, height;
+private:
+    char *memory;
 };
 
+// [comment]
+// Save an image to a PPM file (with gamma correction)
+// [/comment]
+template<ImageLayout layout>
+void saveToPpm(const ImageView<float, layout> &img, const char *filename)
+{
+    float gamma = 1;
+    std::ofstream ofs;
+    ofs.open(filename, std::ios::binary);
+    ofs << "P6\n" << img.w << " " << img.h << "\n255\n";
+    const unsigned int stride = ImageView<float, layout>::kPixelStride;
+    std::vector<unsigned char> bytes(img.w * 3);
+    for (unsigned int j = 0; j < img.h; ++j) {
+        for (unsigned int c = 0; c < 3; ++c) {
+            const float *row = img.scanline(j, c);
+            for (unsigned int i = 0; i < img.w; ++i)
+                bytes[i * 3 + c] = (unsigned char)(std::max(0.f, std::min(255.f, powf(row[i * stride], 1 / gamma) * 255 + 0.5f)));
+        }
+        ofs.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    }
+    ofs.close();
+}
+
 int main(int argc, char **argv)
 {
     // [comment]
@@ -177,20 +268,17 @@ int main(int argc, char **argv)
     int patchSize = 64;
     int width = patchSize * 6;
     int height = patchSize * 4;
-    Image image(width, height);
+    ImageBuffer<float, kPlanar> image(width, height);
     for (int j = 0; j < 4; ++j) {
         int offsetj = j * patchSize;
         for (int i = 0; i < 6; ++i) {
             int offseti = i * patchSize;
-            for (int jj = 0; jj < patchSize; ++jj) {
-                for (int ii = 0; ii < patchSize; ++ii) {
-                    image.setPixel(rgb[j * 6 + i], offseti + ii, offsetj + jj); 
-                }
-            }
+            // each bucket is a view of the image
+            image.view(offseti, offsetj, patchSize, patchSize).fill(rgb[j * 6 + i]);
         }
     }
 
-    image.saveToPpm("./mcbeth.ppm");
+    saveToPpm(image, "./mcbeth.ppm");
 
     return 0;
 }
\ No newline at end of file
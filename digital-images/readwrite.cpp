@@ -10,7 +10,7 @@
 // You can use c++ if you don't use clang++
 //
 // Run with: ./readwrite. Open the resulting image (ppm) in Photoshop or any program
-// reading PPM files.
+// reading PPM files. The center of the image is also saved to crop.ppm.
 //[/compile]
 //[ignore]
 // Copyright (C) 2016  www.scratchapixel.com
@@ -32,41 +32,126 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
+#include <cstdint>
 #include <fstream>
 #include <cassert>
 #include <exception>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 // [comment]
-// The main Image class
+// How the channels of the pixels are arranged in memory: interleaved (r g b r g b ..., the way
+// the PPM format stores them) or planar (all the red values of the image, then all the green
+// values, then all the blue values). With the planar layout each channel of a row is a
+// contiguous array of floats, which is what SIMD instructions want.
 // [/comment]
-class Image
+enum ImageLayout { kInterleaved, kPlanar };
+
+// [comment]
+// A w x h RGB image in memory that the view doesn't own. The value of channel c of the pixel
+// (x, y) is at data[y * rowStride + c * planeStride + x * kPixelStride]: sub-images and rows of
+// an image are views of the same memory, nothing is copied.
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageView
 {
 public:
-    
-    struct Rgb
+    static const unsigned int kNumChannels = 3;
+    static const unsigned int kPixelStride = (layout == kInterleaved) ? kNumChannels : 1;
+    ImageView() : w(0), h(0), rowStride(0), planeStride(0), data(nullptr) {}
+    ImageView(T *_data, const unsigned int &_w, const unsigned int &_h, const size_t &_rowStride, const size_t &_planeStride) :
+        w(_w), h(_h), rowStride(_rowStride), planeStride(_planeStride), data(_data) {}
+    T& operator () (const unsigned int &x, const unsigned int &y, const unsigned int &c) const
     {
-        Rgb() : r(0), g(0), b(0)  {}
-        Rgb(float rr) : r(rr), g(rr), b(rr) {}
-        Rgb(float rr, float gg, float bb) : r(rr), g(gg), b(bb) {}
-        float r, g, b;
-    };
-    
-    Image() : w(0), h(0), pixels(nullptr) {}
-    Image(const unsigned int &_w, const unsigned int &_h) :
-        w(_w), h(_h), pixels(nullptr)
+        assert(x < w && y < h && c < kNumChannels);
+        return data[y * rowStride + c * planeStride + x * kPixelStride];
+    }
+    // the values of channel c along row y, kPixelStride apart
+    T* scanline(const unsigned int &y, const unsigned int &c = 0) const
+    { return data + y * rowStride + c * planeStride; }
+    ImageView view(const unsigned int &x, const unsigned int &y, const unsigned int &_w, const unsigned int &_h) const
+    {
+        assert(x + _w <= w && y + _h <= h);
+        return ImageView(data + y * rowStride + x * kPixelStride, _w, _h, rowStride, planeStride);
+    }
+    ImageView rowView(const unsigned int &y) const { return view(0, y, w, 1); }
+    // set every pixel to values (one value per channel)
+    void fill(const T *values) const
     {
-        pixels = new Rgb[w * h];
-        for (int i = 0; i < w * h; ++i) pixels[i] = 0;
+        for (unsigned int y = 0; y < h; ++y) {
+            for (unsigned int c = 0; c < kNumChannels; ++c) {
+                T *row = scanline(y, c);
+                for (unsigned int x = 0; x < w; ++x) row[x * kPixelStride] = values[c];
+            }
+        }
     }
-    ~Image() { if (pixels != nullptr) delete [] pixels; }
     unsigned int w, h;
-    Rgb *pixels;
+    size_t rowStride, planeStride; // in number of values
+    T *data;
+};
+
+// [comment]
+// An image that owns its pixels. Every row (of every plane with the planar layout) starts on a
+// 64-byte boundary, the size of a cache line and of an AVX-512 register: rows are padded to a
+// multiple of 64 bytes, which is why the distance between rows (the stride) can be larger than
+// the width. Copying an image is expensive, so images can be moved but not copied (copy() makes
+// a copy explicitly).
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageBuffer : public ImageView<T, layout>
+{
+public:
+    static const size_t kAlignment = 64;
+    ImageBuffer() : memory(nullptr) {}
+    ImageBuffer(const unsigned int &_w, const unsigned int &_h) : memory(nullptr)
+    {
+        const unsigned int numChannels = ImageView<T, layout>::kNumChannels;
+        const size_t valuesPerLine = kAlignment / sizeof(T);
+        size_t rowSize = (layout == kInterleaved) ? _w * numChannels : _w;
+        rowSize = (rowSize + valuesPerLine - 1) / valuesPerLine * valuesPerLine;
+        size_t size = rowSize * _h * ((layout == kInterleaved) ? 1 : numChannels);
+        memory = new char[size * sizeof(T) + kAlignment - 1]; // this throws an exception if bad_alloc
+        T *data = reinterpret_cast<T *>((reinterpret_cast<uintptr_t>(memory) + kAlignment - 1) & ~(uintptr_t)(kAlignment - 1));
+        std::fill(data, data + size, T(0));
+        static_cast<ImageView<T, layout> &>(*this) =
+            ImageView<T, layout>(data, _w, _h, rowSize, (layout == kInterleaved) ? 1 : rowSize * _h);
+    }
+    ImageBuffer(const ImageBuffer &) = delete;
+    ImageBuffer& operator = (const ImageBuffer &) = delete;
+    ImageBuffer(ImageBuffer &&img) : ImageView<T, layout>(img), memory(img.memory)
+    {
+        img.memory = nullptr;
+        static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
+    }
+    ImageBuffer& operator = (ImageBuffer &&img)
+    {
+        if (this != &img) {
+            delete [] memory;
+            static_cast<ImageView<T, layout> &>(*this) = img;
+            memory = img.memory;
+            img.memory = nullptr;
+            static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
+        }
+        return *this;
+    }
+    ~ImageBuffer() { delete [] memory; }
+    ImageBuffer copy() const
+    {
+        ImageBuffer img(this->w, this->h);
+        size_t size = this->rowStride * this->h * ((layout == kInterleaved) ? 1 : ImageView<T, layout>::kNumChannels);
+        std::copy(this->data, this->data + size, img.data);
+        return img;
+    }
+private:
+    char *memory;
 };
 
 // [comment]
 // Save an image to PPM image file
 // [/comment]
-void savePPM(const Image &img, const char *filename)
+template<ImageLayout layout>
+void savePPM(const ImageView<float, layout> &img, const char *filename)
 {
     if (img.w == 0 || img.h == 0) { fprintf(stderr, "Can't save an empty image\n"); return; }
     std::ofstream ofs;
@@ -74,13 +159,16 @@ void savePPM(const Image &img, const char *filename)
         ofs.open(filename, std::ios::binary); // need to spec. binary mode for Windows users
         if (ofs.fail()) throw("Can't open output file");
         ofs << "P6\n" << img.w << " " << img.h << "\n255\n";
-        unsigned char r, g, b;
-        // loop over each pixel in the image, clamp and convert to byte format
-        for (int i = 0; i < img.w * img.h; ++i) {
-            r = static_cast<unsigned char>(std::min(1.f, img.pixels[i].r) * 255);
-            g = static_cast<unsigned char>(std::min(1.f, img.pixels[i].g) * 255);
-            b = static_cast<unsigned char>(std::min(1.f, img.pixels[i].b) * 255);
-            ofs << r << g << b;
+        const unsigned int stride = ImageView<float, layout>::kPixelStride;
+        std::vector<unsigned char> bytes(img.w * 3);
+        // loop over each row of the image, clamp and convert to byte format
+        for (unsigned int y = 0; y < img.h; ++y) {
+            for (unsigned int c = 0; c < 3; ++c) {
+                const float *row = img.scanline(y, c);
+                for (unsigned int x = 0; x < img.w; ++x)
+                    bytes[x * 3 + c] = static_cast<unsigned char>(std::min(1.f, row[x * stride]) * 255);
+            }
+            ofs.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
         }
         ofs.close();
     }
@@ -91,13 +179,14 @@ void savePPM(const Image &img, const char *filename)
 }
 
 // [comment]
-// Read a PPM image file
+// Read a PPM image file, in an image with the given layout
 // [/comment]
-Image readPPM(const char *filename)
+template<ImageLayout layout>
+ImageBuffer<float, layout> readPPM(const char *filename)
 {
     std::ifstream ifs;
     ifs.open(filename, std::ios::binary); // need to spec. binary mode for Windows users
-    Image img;
+    ImageBuffer<float, layout> img;
     try {
         if (ifs.fail()) { throw("Can't open input file"); }
         std::string header;
@@ -105,16 +194,17 @@ Image readPPM(const char *filename)
         ifs >> header;
         if (strcmp(header.c_str(), "P6") != 0) throw("Can't read input file");
         ifs >> w >> h >> b;
-        img.w = w; img.h = h;
-        img.pixels = new Image::Rgb[w * h]; // this is throw an exception if bad_alloc
+        img = ImageBuffer<float, layout>(w, h);
         ifs.ignore(256, '\n'); // skip empty lines in necessary until we get to the binary data
-        unsigned char pix[3];
-        // read each pixel one by one and convert bytes to floats
-        for (int i = 0; i < w * h; ++i) {
-            ifs.read(reinterpret_cast<char *>(pix), 3);
-            img.pixels[i].r = pix[0] / 255.f;
-            img.pixels[i].g = pix[1] / 255.f;
-            img.pixels[i].b = pix[2] / 255.f;
+        const unsigned int stride = ImageView<float, layout>::kPixelStride;
+        std::vector<unsigned char> bytes(w * 3);
+        // read the image row by row and convert bytes to floats
+        for (int y = 0; y < h; ++y) {
+            ifs.read(reinterpret_cast<char *>(bytes.data()), bytes.size());
+            for (unsigned int c = 0; c < 3; ++c) {
+                float *row = img.scanline(y, c);
+                for (int x = 0; x < w; ++x) row[x * stride] = bytes[x * 3 + c] / 255.f;
+            }
         }
         ifs.close();
     }
@@ -131,8 +221,13 @@ Image readPPM(const char *filename)
 // [/comment]
 int main(int argc, char **argv)
 {
-    Image I = readPPM("./xmas.ppm");
+    ImageBuffer<float, kPlanar> I = readPPM<kPlanar>("./xmas.ppm");
     savePPM(I, "./out.ppm");
+
+    // [comment]
+    // A sub-image is a view of the image: saving the center of the image doesn't copy anything
+    // [/comment]
+    savePPM(I.view(I.w / 4, I.h / 4, I.w / 2, I.h / 2), "./crop.ppm");
   
     return 0;
 }
\ No newline at end of file
@@ -11,6 +11,11 @@
 //
 // clang++ -std=c++14 -o acceleration acceleration.cpp -O3 -DACCEL_GRID
 //
+// Add -DSIMULATE_VERTEX_CACHE to count the vertex reads that would miss a small cache (this
+// slows down the render, so the render time isn't meaningful then), and -DKEEP_SOURCE_ORDER to
+// disable the mesh layout optimization (see Mesh::optimizeLayout()) and compare the number of
+// simulated vertex cache misses.
+//
 // You can use c++ if you don't use clang++
 //
 // Run with: ./acceleration. Open the file ./image.png in Photoshop or any program
@@ -43,6 +48,9 @@
 #include <cmath>
 #include <chrono>
 #include <queue>
+#include <algorithm>
+#include <cstring>
+#include <thread>
 
 #ifndef M_PI
 #define M_PI (3.14159265358979323846)
@@ -57,6 +65,53 @@ std::atomic<uint32_t> numRayTriangleIntersections(0);
 std::atomic<uint32_t> numRayBBoxTests(0);
 std::atomic<uint32_t> numRayBoundingVolumeTests(0);
 
+#ifdef SIMULATE_VERTEX_CACHE
+// [comment]
+// A simple cache simulator (set associative with LRU replacement and 64 bytes lines). It is
+// fed with the address of the vertices read by the ray-triangle intersection test, and counts
+// how many of these reads would miss. It is kept small (4KB) because the teapot itself is
+// small: what matters here is how the number of misses changes when the memory layout of
+// the meshes changes. Note that it isn't thread safe (the render loop isn't multithreaded).
+// [/comment]
+class CacheSimulator
+{
+public:
+    CacheSimulator(uint32_t size = 4096, uint32_t ways = 4) :
+        numSets(size / (kLineSize * ways)), numWays(ways),
+        tags(numSets * ways, ~uint64_t(0)), lastUse(numSets * ways, 0)
+    {}
+    void access(const void* p, size_t size)
+    {
+        uint64_t first = reinterpret_cast<uintptr_t>(p) / kLineSize;
+        uint64_t last = (reinterpret_cast<uintptr_t>(p) + size - 1) / kLineSize;
+        for (uint64_t line = first; line <= last; ++line) touch(line);
+    }
+    uint64_t numAccesses = { 0 };
+    uint64_t numMisses = { 0 };
+private:
+    static const uint32_t kLineSize = 64;
+    void touch(uint64_t line)
+    {
+        numAccesses++;
+        size_t set = (line % numSets) * numWays, lru = set;
+        for (size_t i = set; i < set + numWays; ++i) {
+            if (tags[i] == line) {
+                lastUse[i] = numAccesses;
+                return;
+            }
+            if (lastUse[i] < lastUse[lru]) lru = i;
+        }
+        numMisses++;
+        tags[lru] = line;
+        lastUse[lru] = numAccesses;
+    }
+    uint32_t numSets, numWays;
+    std::vector<uint64_t> tags, lastUse;
+};
+
+CacheSimulator vertexCache;
+#endif
+
 template<typename T>
 class Vec3
 {
@@ -246,6 +301,107 @@ public:
     uint32_t test;
 };
 
+// [comment]
+// Call func(begin, end) on blocks of the range [0, count), one block per core. Ranges smaller
+// than minPerThread items per thread are processed by the calling thread alone: starting threads
+// would cost more than the work itself.
+// [/comment]
+template<typename Func>
+void parallelFor(uint32_t count, uint32_t minPerThread, const Func& func)
+{
+    uint32_t numThreads = std::min(std::max(1u, std::thread::hardware_concurrency()), count / std::max(1u, minPerThread));
+    if (numThreads <= 1) {
+        func(0u, count);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < numThreads; ++i) {
+        threads.emplace_back(func, uint32_t(uint64_t(count) * i / numThreads), uint32_t(uint64_t(count) * (i + 1) / numThreads));
+    }
+    func(0u, uint32_t(count / numThreads));
+    for (auto& thread : threads) thread.join();
+}
+
+// [comment]
+// Triangulate a polygon with the ear clipping method. The polygon is projected onto the plane of
+// the two axes its normal is the most perpendicular to (the normal is computed with Newell's
+// method, which gives a sensible result for non-planar and non-convex polygons). An ear is a
+// convex corner whose triangle doesn't contain any other vertex of the polygon: it can be cut
+// off, leaving a polygon with one vertex less. Convex polygons, by far the most common, are
+// split into a fan directly, which is also what ear clipping gives for them since ears are
+// searched in order starting from the second vertex. The numVerts - 2 triangles are written to
+// triangles as positions in the polygon's vertex list (0 to numVerts - 1).
+// [/comment]
+void triangulatePolygon(const Vec3f* verts, const uint32_t* indices, uint32_t numVerts, uint32_t* triangles)
+{
+    Vec3f N(0);
+    for (uint32_t i = 0; i < numVerts; ++i) {
+        const Vec3f& a = verts[indices[i]];
+        const Vec3f& b = verts[indices[(i + 1) % numVerts]];
+        N.x += (a.y - b.y) * (a.z + b.z);
+        N.y += (a.z - b.z) * (a.x + b.x);
+        N.z += (a.x - b.x) * (a.y + b.y);
+    }
+    uint32_t axis = (std::fabs(N.x) > std::fabs(N.y)) ? (std::fabs(N.x) > std::fabs(N.z) ? 0 : 2) : (std::fabs(N.y) > std::fabs(N.z) ? 1 : 2);
+    // (axis + 1, axis + 2) keeps the orientation: the polygon is counter-clockwise if N[axis] > 0
+    float sign = N[axis] < 0 ? -1.f : 1.f;
+    auto area = [&](uint32_t a, uint32_t b, uint32_t c)
+    {
+        const Vec3f& pa = verts[indices[a]], & pb = verts[indices[b]], & pc = verts[indices[c]];
+        uint32_t u = (axis + 1) % 3, v = (axis + 2) % 3;
+        return sign * ((pb[u] - pa[u]) * (pc[v] - pa[v]) - (pb[v] - pa[v]) * (pc[u] - pa[u]));
+    };
+
+    auto samePosition = [&](uint32_t a, uint32_t b)
+    {
+        const Vec3f& pa = verts[indices[a]], & pb = verts[indices[b]];
+        return pa.x == pb.x && pa.y == pb.y && pa.z == pb.z;
+    };
+
+    bool convex = true;
+    for (uint32_t i = 0; i < numVerts && convex; ++i) {
+        convex = area((i + numVerts - 1) % numVerts, i, (i + 1) % numVerts) >= 0;
+    }
+    if (convex) {
+        for (uint32_t j = 0; j < numVerts - 2; ++j) {
+            triangles[j * 3] = 0;
+            triangles[j * 3 + 1] = j + 1;
+            triangles[j * 3 + 2] = j + 2;
+        }
+        return;
+    }
+
+    std::vector<uint32_t> remaining(numVerts);
+    for (uint32_t i = 0; i < numVerts; ++i) remaining[i] = i;
+    uint32_t numTris = 0, i = 1;
+    while (remaining.size() > 3) {
+        uint32_t m = remaining.size();
+        // if there's no ear (the polygon intersects itself), the corner we started from is cut anyway
+        for (uint32_t tries = 0; tries < m; ++tries, i = (i + 1) % m) {
+            uint32_t a = remaining[(i + m - 1) % m], b = remaining[i], c = remaining[(i + 1) % m];
+            if (area(a, b, c) <= 0) continue;
+            bool isEar = true;
+            for (uint32_t k = 0; k < m && isEar; ++k) {
+                uint32_t p = remaining[k];
+                // skip the vertices of the triangle, and their duplicates (polygons with holes
+                // connected to the outline have some)
+                if (samePosition(p, a) || samePosition(p, b) || samePosition(p, c)) continue;
+                isEar = !(area(a, b, p) >= 0 && area(b, c, p) >= 0 && area(c, a, p) >= 0);
+            }
+            if (isEar) break;
+        }
+        triangles[numTris * 3] = remaining[(i + m - 1) % m];
+        triangles[numTris * 3 + 1] = remaining[i];
+        triangles[numTris * 3 + 2] = remaining[(i + 1) % m];
+        numTris++;
+        remaining.erase(remaining.begin() + i);
+        if (i == remaining.size()) i = 0;
+    }
+    triangles[numTris * 3] = remaining[0];
+    triangles[numTris * 3 + 1] = remaining[1];
+    triangles[numTris * 3 + 2] = remaining[2];
+}
+
 class Mesh : public GeomPrimitive
 {
 public:
@@ -263,28 +419,39 @@ public:
             matPointMult(objectToWorld, vertexPool[i]);
             bbox.extendBy(vertexPool[i]);
         }
-        // compute total number of triangles
+        // compute total number of triangles, and where the vertices of each face start
+        std::vector<uint32_t> polygonOffsets(numPolygons + 1, 0);
         for (uint32_t i = 0; i < numPolygons; ++i) {
             assert(polygonNumVertsArray[i] >= 3);
             numTriangles += polygonNumVertsArray[i] - 2;
+            polygonOffsets[i + 1] = polygonOffsets[i] + polygonNumVertsArray[i];
         }
         // create array to store the triangle indices in the vertex pool
         // !! use resize() here and not reserve() -- which only affects capacity but doesn't change size of the vector
         triangleIndicesInVertexPool.resize(numTriangles * 3);
         mailbox.resize(numTriangles); // should all be initialized with 0
-        // for each face
-        for (uint32_t i = 0, offset = 0, currTriangleIndex = 0; i < numPolygons; ++i) {
-            // for each triangle in the face
-            for (uint32_t j = 0; j < polygonNumVertsArray[i] - 2; ++j) {
-                triangleIndicesInVertexPool[currTriangleIndex] = polygonIndicesInVertexPool[offset];
-                triangleIndicesInVertexPool[currTriangleIndex + 1] = polygonIndicesInVertexPool[offset + j + 1];
-                triangleIndicesInVertexPool[currTriangleIndex + 2] = polygonIndicesInVertexPool[offset + j + 2];
-                currTriangleIndex += 3;
+        // [comment]
+        // Triangulate the faces. A face with n vertices gives n - 2 triangles, so the triangles of
+        // face i start at triangle polygonOffsets[i] - 2 * i, and the faces can be triangulated
+        // in parallel. Large meshes are split across the cores.
+        // [/comment]
+        parallelFor(numPolygons, 4096, [&](uint32_t begin, uint32_t end)
+        {
+            std::vector<uint32_t> triangles;
+            for (uint32_t i = begin; i < end; ++i) {
+                const uint32_t* polygon = &polygonIndicesInVertexPool[polygonOffsets[i]];
+                uint32_t* dst = &triangleIndicesInVertexPool[(polygonOffsets[i] - 2 * i) * 3];
+                triangles.resize((polygonNumVertsArray[i] - 2) * 3);
+                triangulatePolygon(vertexPool.data(), polygon, polygonNumVertsArray[i], triangles.data());
+                for (uint32_t j = 0; j < triangles.size(); ++j) dst[j] = polygon[triangles[j]];
             }
-            offset += polygonNumVertsArray[i];
-        }
+        });
+#ifndef KEEP_SOURCE_ORDER
+        optimizeLayout();
+#endif
     }
     bool intersect(const Vec3f&, const Vec3f&, float& t) const;
+    void optimizeLayout();
     uint32_t numTriangles = { 0 };
     std::vector<uint32_t> triangleIndicesInVertexPool;
     std::vector<Vec3f> vertexPool;
@@ -295,6 +462,68 @@ public:
     mutable std::vector<uint32_t> mailbox;
 };
 
+inline uint32_t expandBits(uint32_t v)
+{
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+// [comment]
+// 30 bits Morton code of a point whose coordinates are in the range [0,1]
+// [/comment]
+inline uint32_t mortonCode(const Vec3f& p)
+{
+    uint32_t x = static_cast<uint32_t>(std::min(std::max(p.x * 1024.f, 0.f), 1023.f));
+    uint32_t y = static_cast<uint32_t>(std::min(std::max(p.y * 1024.f, 0.f), 1023.f));
+    uint32_t z = static_cast<uint32_t>(std::min(std::max(p.z * 1024.f, 0.f), 1023.f));
+    return (expandBits(x) << 2) | (expandBits(y) << 1) | expandBits(z);
+}
+
+// [comment]
+// Sort the triangles by the Morton code of their centroid. Morton codes follow a space
+// filling curve, so triangles that are close to each other in space end up close to each
+// other in memory. This matters when a ray only tests the triangles of a small region of
+// space (which is what the acceleration structures are for). Then renumber the vertices in
+// the order in which the triangles use them for the first time, so that reading the
+// triangles in order reads the vertex pool almost sequentially. The triangles themselves
+// are unchanged, so the image is the same.
+// [/comment]
+void Mesh::optimizeLayout()
+{
+    Vec3f extent = bbox[1] - bbox[0];
+    Vec3f scale(extent.x > 0 ? 1 / extent.x : 0, extent.y > 0 ? 1 / extent.y : 0, extent.z > 0 ? 1 / extent.z : 0);
+    std::vector<std::pair<uint32_t, uint32_t>> keys(numTriangles); // Morton code, triangle index
+    for (uint32_t i = 0; i < numTriangles; ++i) {
+        Vec3f centroid = (vertexPool[triangleIndicesInVertexPool[i * 3]] +
+            vertexPool[triangleIndicesInVertexPool[i * 3 + 1]] +
+            vertexPool[triangleIndicesInVertexPool[i * 3 + 2]]) * (1 / 3.f);
+        Vec3f p = centroid - bbox[0];
+        keys[i] = std::make_pair(mortonCode(Vec3f(p.x * scale.x, p.y * scale.y, p.z * scale.z)), i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    const uint32_t kUnused = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> sortedIndices(numTriangles * 3), remap(vertexPool.size(), kUnused);
+    uint32_t numUsedVerts = 0;
+    for (uint32_t i = 0; i < numTriangles; ++i) {
+        for (uint32_t j = 0; j < 3; ++j) {
+            uint32_t index = triangleIndicesInVertexPool[keys[i].second * 3 + j];
+            if (remap[index] == kUnused) remap[index] = numUsedVerts++;
+            sortedIndices[i * 3 + j] = remap[index];
+        }
+    }
+    // vertices not used by any triangle go at the end
+    for (auto& index : remap) if (index == kUnused) index = numUsedVerts++;
+    std::vector<Vec3f> sortedVerts(vertexPool.size());
+    for (uint32_t i = 0; i < vertexPool.size(); ++i) sortedVerts[remap[i]] = vertexPool[i];
+
+    triangleIndicesInVertexPool.swap(sortedIndices);
+    vertexPool.swap(sortedVerts);
+}
+
 // use Moller-Trumbor method
 bool rayTriangleIntersect(
     const Vec3f& orig, const Vec3f& dir,
@@ -302,6 +531,11 @@ bool rayTriangleIntersect(
     float& t, float& u, float& v)
 {
     numRayTriangleTests++;
+#ifdef SIMULATE_VERTEX_CACHE
+    vertexCache.access(&v0, sizeof(Vec3f));
+    vertexCache.access(&v1, sizeof(Vec3f));
+    vertexCache.access(&v2, sizeof(Vec3f));
+#endif
     Vec3f v0v1 = v1 - v0;
     Vec3f v0v2 = v2 - v0;
     Vec3f pvec = cross(dir, v0v2);
@@ -405,46 +639,86 @@ Vec3f dVBezier(const Vec3f* controlPoints, float u, float v)
     return derivBezier(uCurve, v);
 }
 
+// [comment]
+// The Bernstein basis functions of the cubic Bezier curve tabulated at t = 0, 1/divs, ..., 1.
+// All the patches are tessellated with the same number of divisions and share the table.
+// [/comment]
+struct BezierBasis
+{
+    BezierBasis(uint32_t divs_) : divs(divs_), B(4 * (divs_ + 1))
+    {
+        for (uint32_t i = 0; i <= divs; ++i) {
+            float t = i / (float)divs;
+            B[i * 4] = (1 - t) * (1 - t) * (1 - t);
+            B[i * 4 + 1] = 3 * t * (1 - t) * (1 - t);
+            B[i * 4 + 2] = 3 * t * t * (1 - t);
+            B[i * 4 + 3] = t * t * t;
+        }
+    }
+    uint32_t divs;
+    std::vector<float> B;
+};
+
+// [comment]
+// Evaluate the patch on the (divs + 1) x (divs + 1) grid of the basis, P[(divs + 1) * y + x] being
+// the point at u = x / divs, v = y / divs. The curves along v of each column (the control points
+// times the basis at u) are computed once per column rather than once per point: this gives
+// the same points as evalBezierPatch for a fraction of the work.
+// [/comment]
+void evalBezierPatchGrid(const Vec3f* controlPoints, const BezierBasis& basis, Vec3f* P)
+{
+    uint32_t divs = basis.divs;
+    for (uint32_t x = 0; x <= divs; ++x) {
+        const float* bu = &basis.B[x * 4];
+        Vec3f uCurve[4];
+        for (size_t i = 0; i < 4; ++i) {
+            const Vec3f* row = controlPoints + 4 * i;
+            uCurve[i] = row[0] * bu[0] + row[1] * bu[1] + row[2] * bu[2] + row[3] * bu[3];
+        }
+        for (uint32_t y = 0; y <= divs; ++y) {
+            const float* bv = &basis.B[y * 4];
+            P[(divs + 1) * y + x] = uCurve[0] * bv[0] + uCurve[1] * bv[1] + uCurve[2] * bv[2] + uCurve[3] * bv[3];
+        }
+    }
+}
+
+// [comment]
+// The patches are tessellated in parallel, each into its own mesh.
+// [/comment]
 std::vector<std::unique_ptr<const Mesh>> createUtahTeapot()
 {
     Matrix44f rotate90(1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1);
-    std::vector<std::unique_ptr<const Mesh>> meshes;
-    uint32_t width = 8, height = 8;
-    uint32_t numPolygons = width * height;
+    std::vector<std::unique_ptr<const Mesh>> meshes(kTeapotNumPatches);
+    uint32_t divs = 8;
+    uint32_t numPolygons = divs * divs;
     std::vector<uint32_t> polyNumVertsArray(numPolygons, 4);
     std::vector<uint32_t> polyIndicesInVertPool(numPolygons * 4);
     // set indices 
-    for (uint32_t y = 0, offset = 0; y < height; ++y) {
-        for (uint32_t x = 0; x < width; ++x, offset += 4) {
+    for (uint32_t y = 0, offset = 0; y < divs; ++y) {
+        for (uint32_t x = 0; x < divs; ++x, offset += 4) {
             // counter-clockwise to get the normal pointing in the right direction
-            polyIndicesInVertPool[offset] = (width + 1) * y + x;
-            polyIndicesInVertPool[offset + 3] = (width + 1) * y + x + 1;
-            polyIndicesInVertPool[offset + 2] = (width + 1) * (y + 1) + x + 1;
-            polyIndicesInVertPool[offset + 1] = (width + 1) * (y + 1) + x;
+            polyIndicesInVertPool[offset] = (divs + 1) * y + x;
+            polyIndicesInVertPool[offset + 3] = (divs + 1) * y + x + 1;
+            polyIndicesInVertPool[offset + 2] = (divs + 1) * (y + 1) + x + 1;
+            polyIndicesInVertPool[offset + 1] = (divs + 1) * (y + 1) + x;
         }
     }
-    Vec3f controlPoints[16];
-    for (uint32_t i = 0; i < kTeapotNumPatches; ++i) {
-        std::vector<Vec3f> vertPool((width + 1) * (height + 1));
-        for (uint32_t j = 0; j < 16; ++j) {
-            controlPoints[j].x = teapotVertices[teapotPatches[i][j] - 1][0],
-                controlPoints[j].y = teapotVertices[teapotPatches[i][j] - 1][1],
-                controlPoints[j].z = teapotVertices[teapotPatches[i][j] - 1][2];
-        }
-        for (uint32_t y = 0, currVertIndex = 0; y <= height; ++y) {
-            float v = y / (float)height;
-            for (uint32_t x = 0; x <= width; ++x, ++currVertIndex) {
-                float u = x / (float)width;
-                vertPool[currVertIndex] = evalBezierPatch(controlPoints, u, v);
-                matVecMult(rotate90, vertPool[currVertIndex]);
-                Vec3f dU = dUBezier(controlPoints, u, v);
-                Vec3f dV = dVBezier(controlPoints, u, v);
-                Vec3f N = cross(dU, dV);
+    BezierBasis basis(divs);
+    parallelFor(kTeapotNumPatches, 1, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i) {
+            Vec3f controlPoints[16];
+            for (uint32_t j = 0; j < 16; ++j) {
+                controlPoints[j].x = teapotVertices[teapotPatches[i][j] - 1][0],
+                    controlPoints[j].y = teapotVertices[teapotPatches[i][j] - 1][1],
+                    controlPoints[j].z = teapotVertices[teapotPatches[i][j] - 1][2];
             }
+            std::vector<Vec3f> vertPool((divs + 1) * (divs + 1));
+            evalBezierPatchGrid(controlPoints, basis, vertPool.data());
+            for (auto& vert : vertPool) matVecMult(rotate90, vert);
+            meshes[i].reset(new Mesh(numPolygons, polyNumVertsArray, polyIndicesInVertPool, vertPool));
         }
-
-        meshes.emplace_back(new Mesh(numPolygons, polyNumVertsArray, polyIndicesInVertPool, vertPool));
-    }
+    });
 
     return meshes;
 }
@@ -909,7 +1183,7 @@ Grid::Grid(std::vector<std::unique_ptr<const Mesh>>& m) : AccelerationStructure(
     }
     // Create the grid
     Vec3f size = bbox[1] - bbox[0];
-    float cubeRoot = std::powf(totalNumTriangles / (size.x * size.y * size.z), 1. / 3.f);
+    float cubeRoot = std::pow(totalNumTriangles / (size.x * size.y * size.z), 1. / 3.f);
     for (uint8_t i = 0; i < 3; ++i) {
         resolution[i] = std::floor(size[i] * cubeRoot);
         if (resolution[i] < 1) resolution[i] = 1;
@@ -1156,6 +1430,10 @@ int main(int argc, char** argv)
     std::cout << "Total number of ray-boundvolume tests       | " << numRayBoundingVolumeTests << std::endl;
     std::cout << "Total number of ray-triangles tests         | " << numRayTriangleTests << std::endl;
     std::cout << "Total number of ray-triangles intersections | " << numRayTriangleIntersections << std::endl;
+#ifdef SIMULATE_VERTEX_CACHE
+    std::cout << "Vertex cache misses (simulated, 4KB)        | " << vertexCache.numMisses << " (" <<
+        100.f * vertexCache.numMisses / std::max<uint64_t>(1, vertexCache.numAccesses) << "%)" << std::endl;
+#endif
 
     return 0;
 }
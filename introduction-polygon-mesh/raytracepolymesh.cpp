@@ -8,7 +8,8 @@
 // c++ -o raytracepolymesh raytracepolymesh.cpp -std=c++11 -O3
 //
 // Run with: ./raytracepolygonmesh. Open the file ./out.0000.png in Photoshop or any program
-// reading PPM files.
+// reading PPM files. You can also pass the mesh file to render: ./raytracepolygonmesh cow.geoc 64
+// renders a clustered mesh (see convertgeometry.cpp) with a cache of 64 KB for the clusters.
 //[/compile]
 //[ignore]
 // Copyright (C) 2012  www.scratchapixel.com
@@ -32,12 +33,23 @@
 #include <cstdlib>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <utility>
 #include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <cmath>
 #include <sstream>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <algorithm>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <chrono>
 
 #include "geometry.h"
@@ -100,69 +112,99 @@ bool rayTriangleIntersect(
     return true;
 }
 
+// [comment]
+// A vertex of an indexed mesh: the index of its position, and the value of its other attributes.
+// Two vertices are the same if all their attributes are bitwise identical.
+// [/comment]
+struct MeshVertex
+{
+    uint32_t vertIndex;
+    Vec3f normal;
+    Vec2f st;
+    bool operator == (const MeshVertex &v) const
+    {
+        return vertIndex == v.vertIndex &&
+            memcmp(&normal, &v.normal, sizeof(Vec3f)) == 0 &&
+            memcmp(&st, &v.st, sizeof(Vec2f)) == 0;
+    }
+};
+
+struct MeshVertexHash
+{
+    size_t operator () (const MeshVertex &v) const
+    {
+        uint32_t bits[5];
+        memcpy(bits, &v.normal, sizeof(Vec3f));
+        memcpy(bits + 3, &v.st, sizeof(Vec2f));
+        uint64_t h = v.vertIndex;
+        for (uint32_t i = 0; i < 5; ++i) h = (h ^ bits[i]) * 0x100000001b3ULL;
+        return size_t(h ^ (h >> 32));
+    }
+};
+
 class TriangleMesh : public Object
 {
 public:
     // Build a triangle mesh from a face index array and a vertex index array
     TriangleMesh(
         const uint32_t nfaces,
-        const std::unique_ptr<uint32_t []> &faceIndex,
-        const std::unique_ptr<uint32_t []> &vertsIndex,
-        const std::unique_ptr<Vec3f []> &verts,
-        std::unique_ptr<Vec3f []> &normals,
-        std::unique_ptr<Vec2f []> &st) :
+        const uint32_t *faceIndex,
+        const uint32_t *vertsIndex,
+        const Vec3f *verts,
+        const Vec3f *normals,
+        const Vec2f *st) :
         numTris(0)
     {
-        uint32_t k = 0, maxVertIndex = 0;
+        uint32_t numFaceVerts = 0;
         // find out how many triangles we need to create for this mesh
         for (uint32_t i = 0; i < nfaces; ++i) {
             numTris += faceIndex[i] - 2;
-            for (uint32_t j = 0; j < faceIndex[i]; ++j)
-                if (vertsIndex[k + j] > maxVertIndex)
-                    maxVertIndex = vertsIndex[k + j];
-            k += faceIndex[i];
+            numFaceVerts += faceIndex[i];
         }
-        maxVertIndex += 1;
-        
-        // allocate memory to store the position of the mesh vertices
-        P = std::unique_ptr<Vec3f []>(new Vec3f[maxVertIndex]);
-        for (uint32_t i = 0; i < maxVertIndex; ++i) {
-            P[i] = verts[i];
-        }
-        
-        // allocate memory to store triangle indices
-        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
-        uint32_t l = 0;
+
         // [comment]
-        // Generate the triangle index array
-        // Keep in mind that there is generally 1 vertex attribute for each vertex of each face.
-        // So for example if you have 2 quads, you only have 6 vertices but you have 2 * 4
-        // vertex attributes (that is 8 normals, 8 texture coordinates, etc.). So the easiest
-        // lazziest method in our triangle mesh, is to create a new array for each supported
-        // vertex attribute (st, normals, etc.) whose size is equal to the number of triangles
-        // multiplied by 3, and then set the value of the vertex attribute at each vertex
-        // of each triangle using the input array (normals[], st[], etc.)
+        // Build an indexed mesh. Keep in mind that there is generally 1 vertex attribute for each
+        // vertex of each face. So for example if you have 2 quads, you only have 6 vertices but you
+        // have 2 * 4 vertex attributes (that is 8 normals, 8 texture coordinates, etc.). Vertices
+        // sharing a position but not their normal or texture coordinates (along a hard edge or a
+        // texture seam) need to be split. So we create one mesh vertex for each distinct (position,
+        // normal, texture coordinates) tuple, which we find with a hash table. Each attribute is then
+        // stored once per mesh vertex rather than once per triangle vertex, and a single index array
+        // gives the position, normal and texture coordinates of the vertices of each triangle.
         // [/comment]
-        N = std::unique_ptr<Vec3f []>(new Vec3f[numTris * 3]);
-        texCoordinates = std::unique_ptr<Vec2f []>(new Vec2f[numTris * 3]);
-        for (uint32_t i = 0, k = 0; i < nfaces; ++i) { // for each  face
+        std::unordered_map<MeshVertex, uint32_t, MeshVertexHash> vertexMap;
+        std::vector<uint32_t> firstFaceVert; // the face vertex each mesh vertex was created from
+        std::unique_ptr<uint32_t []> meshVertIndex(new uint32_t[numFaceVerts]);
+        for (uint32_t i = 0; i < numFaceVerts; ++i) {
+            MeshVertex v = {vertsIndex[i], normals[i], st[i]};
+            auto inserted = vertexMap.insert(std::make_pair(v, (uint32_t)firstFaceVert.size()));
+            if (inserted.second) firstFaceVert.push_back(i);
+            meshVertIndex[i] = inserted.first->second;
+        }
+        numVerts = firstFaceVert.size();
+
+        // allocate memory to store the position, normal and texture coordinates of the mesh vertices
+        P = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        N = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        texCoordinates = std::unique_ptr<Vec2f []>(new Vec2f[numVerts]);
+        for (uint32_t i = 0; i < numVerts; ++i) {
+            uint32_t faceVert = firstFaceVert[i];
+            P[i] = verts[vertsIndex[faceVert]];
+            N[i] = normals[faceVert];
+            texCoordinates[i] = st[faceVert];
+        }
+
+        // generate the triangle index array
+        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
+        for (uint32_t i = 0, k = 0, l = 0; i < nfaces; ++i) { // for each  face
             for (uint32_t j = 0; j < faceIndex[i] - 2; ++j) { // for each triangle in the face
-                trisIndex[l] = vertsIndex[k];
-                trisIndex[l + 1] = vertsIndex[k + j + 1];
-                trisIndex[l + 2] = vertsIndex[k + j + 2];
-                N[l] = normals[k];
-                N[l + 1] = normals[k + j + 1];
-                N[l + 2] = normals[k + j + 2];
-                texCoordinates[l] = st[k];
-                texCoordinates[l + 1] = st[k + j + 1];
-                texCoordinates[l + 2] = st[k + j + 2];
+                trisIndex[l] = meshVertIndex[k];
+                trisIndex[l + 1] = meshVertIndex[k + j + 1];
+                trisIndex[l + 2] = meshVertIndex[k + j + 2];
                 l += 3;
-            }                                                                                                                                                                                                                                
+            }
             k += faceIndex[i];
         }
-        // you can use move if the input geometry is already triangulated
-        //N = std::move(normals); // transfer ownership
-        //sts = std::move(st); // transfer ownership
     }
     // Test if the ray interesests this triangle mesh
     bool intersect(const Vec3f &orig, const Vec3f &dir, float &tNear, uint32_t &triIndex, Vec2f &uv) const
@@ -202,25 +244,26 @@ public:
         hitNormal.normalize();
         
         // texture coordinates
-        const Vec2f &st0 = texCoordinates[triIndex * 3];
-        const Vec2f &st1 = texCoordinates[triIndex * 3 + 1];
-        const Vec2f &st2 = texCoordinates[triIndex * 3 + 2];
+        const Vec2f &st0 = texCoordinates[trisIndex[triIndex * 3]];
+        const Vec2f &st1 = texCoordinates[trisIndex[triIndex * 3 + 1]];
+        const Vec2f &st2 = texCoordinates[trisIndex[triIndex * 3 + 2]];
         hitTextureCoordinates = (1 - uv.x - uv.y) * st0 + uv.x * st1 + uv.y * st2;
 
         // vertex normal
         /*
-        const Vec3f &n0 = N[triIndex * 3];
-        const Vec3f &n1 = N[triIndex * 3 + 1];
-        const Vec3f &n2 = N[triIndex * 3 + 2];
+        const Vec3f &n0 = N[trisIndex[triIndex * 3]];
+        const Vec3f &n1 = N[trisIndex[triIndex * 3 + 1]];
+        const Vec3f &n2 = N[trisIndex[triIndex * 3 + 2]];
         hitNormal = (1 - uv.x - uv.y) * n0 + uv.x * n1 + uv.y * n2;
         */
     }
     // member variables
     uint32_t numTris;                         // number of triangles
-    std::unique_ptr<Vec3f []> P;              // triangles vertex position
+    uint32_t numVerts;                        // number of vertices
+    std::unique_ptr<Vec3f []> P;              // vertex positions
     std::unique_ptr<uint32_t []> trisIndex;   // vertex index array
-    std::unique_ptr<Vec3f []> N;              // triangles vertex normals
-    std::unique_ptr<Vec2f []> texCoordinates; // triangles texture coordinates
+    std::unique_ptr<Vec3f []> N;              // vertex normals
+    std::unique_ptr<Vec2f []> texCoordinates; // vertex texture coordinates
 };
 
 TriangleMesh* generatePolyShphere(float rad, uint32_t divs)
@@ -289,11 +332,155 @@ TriangleMesh* generatePolyShphere(float rad, uint32_t divs)
         vid = numV;
     }
     
-    return new TriangleMesh(npolys, faceIndex, vertsIndex, P, N, st);
+    return new TriangleMesh(npolys, faceIndex.get(), vertsIndex.get(), P.get(), N.get(), st.get());
+}
+
+// [comment]
+// Binary version of the geo file (geob), see polygon-mesh/convertgeometry.cpp. The header gives
+// the offset of each array from the start of the file, so loading the mesh is just mapping the
+// file in memory and adding these offsets to the address of the mapping, there's nothing to parse.
+// Only the index arrays need decoding when the file is compressed.
+// [/comment]
+static const char kGeoBinMagic[4] = {'G', 'E', 'O', 'B'};
+static const uint32_t kGeoBinVersion = 1;
+static const uint32_t kGeoBinCompressedIndices = 1;
+
+struct GeoBinHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numFaces;
+    uint32_t vertsIndexArraySize;
+    uint32_t vertsArraySize;
+    uint64_t faceIndexOffset, faceIndexBytes;
+    uint64_t vertsIndexOffset, vertsIndexBytes;
+    uint64_t vertsOffset;
+    uint64_t normalsOffset;
+    uint64_t stOffset;
+};
+
+struct MappedFile
+{
+    MappedFile(const char *file)
+    {
+#ifdef _WIN32
+        std::ifstream ifs(file, std::ios::binary);
+        if (ifs.fail()) return;
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data = (const uint8_t*)contents.data();
+        size = contents.size();
+#else
+        int fd = open(file, O_RDONLY);
+        struct stat st;
+        if (fd == -1) return;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data = (const uint8_t*)mapping;
+                size = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data) munmap((void*)data, size);
+#endif
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::string contents;
+#endif
+};
+
+// decode the delta encoded, variable length indices of a compressed file
+bool decodeIndices(const uint8_t *p, const uint8_t *end, uint32_t count, uint32_t *indices)
+{
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t v = 0;
+        for (uint32_t shift = 0; ; shift += 7) {
+            if (p == end || shift > 28) return false;
+            uint8_t byte = *p++;
+            v |= uint32_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        prev += (v >> 1) ^ (0u - (v & 1));
+        indices[i] = prev;
+    }
+    return true;
+}
+
+TriangleMesh* loadPolyMeshFromBinaryFile(const char *file)
+{
+    MappedFile mapped(file);
+    const GeoBinHeader *header = (const GeoBinHeader*)mapped.data;
+    if (mapped.size < sizeof(GeoBinHeader) || memcmp(header->magic, kGeoBinMagic, 4) != 0 ||
+        header->version != kGeoBinVersion) {
+        std::cerr << "Error: " << file << " is not a geob file" << std::endl;
+        return nullptr;
+    }
+    // check that the arrays are within the file
+    bool compressed = header->flags & kGeoBinCompressedIndices;
+    uint64_t faceIndexBytes = compressed ? header->faceIndexBytes : header->numFaces * sizeof(uint32_t);
+    uint64_t vertsIndexBytes = compressed ? header->vertsIndexBytes : header->vertsIndexArraySize * sizeof(uint32_t);
+    const uint64_t arrays[5][2] = {
+        {header->faceIndexOffset, faceIndexBytes},
+        {header->vertsIndexOffset, vertsIndexBytes},
+        {header->vertsOffset, header->vertsArraySize * sizeof(Vec3f)},
+        {header->normalsOffset, header->vertsIndexArraySize * sizeof(Vec3f)},
+        {header->stOffset, header->vertsIndexArraySize * sizeof(Vec2f)}};
+    for (uint32_t i = 0; i < 5; ++i) {
+        if (arrays[i][0] % 4 != 0 || arrays[i][0] > mapped.size || arrays[i][1] > mapped.size - arrays[i][0]) {
+            std::cerr << "Error: " << file << " is truncated" << std::endl;
+            return nullptr;
+        }
+    }
+    const uint32_t *faceIndex = (const uint32_t*)(mapped.data + header->faceIndexOffset);
+    const uint32_t *vertsIndex = (const uint32_t*)(mapped.data + header->vertsIndexOffset);
+    std::unique_ptr<uint32_t []> decodedFaceIndex, decodedVertsIndex;
+    if (compressed) {
+        decodedFaceIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->numFaces]);
+        decodedVertsIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->vertsIndexArraySize]);
+        if (!decodeIndices(mapped.data + header->faceIndexOffset, mapped.data + header->faceIndexOffset + faceIndexBytes,
+                           header->numFaces, decodedFaceIndex.get()) ||
+            !decodeIndices(mapped.data + header->vertsIndexOffset, mapped.data + header->vertsIndexOffset + vertsIndexBytes,
+                           header->vertsIndexArraySize, decodedVertsIndex.get())) {
+            std::cerr << "Error: " << file << " is corrupted" << std::endl;
+            return nullptr;
+        }
+        faceIndex = decodedFaceIndex.get();
+        vertsIndex = decodedVertsIndex.get();
+    }
+    // the constructor reads the indices without checking them
+    uint64_t numFaceVerts = 0;
+    bool valid = true;
+    for (uint32_t i = 0; i < header->numFaces; ++i) {
+        valid &= faceIndex[i] >= 3;
+        numFaceVerts += faceIndex[i];
+    }
+    valid &= numFaceVerts == header->vertsIndexArraySize;
+    for (uint32_t i = 0; i < header->vertsIndexArraySize; ++i)
+        valid &= vertsIndex[i] < header->vertsArraySize;
+    if (!valid) {
+        std::cerr << "Error: " << file << " is corrupted" << std::endl;
+        return nullptr;
+    }
+
+    return new TriangleMesh(header->numFaces, faceIndex, vertsIndex,
+        (const Vec3f*)(mapped.data + header->vertsOffset),
+        (const Vec3f*)(mapped.data + header->normalsOffset),
+        (const Vec2f*)(mapped.data + header->stOffset));
 }
 
 TriangleMesh* loadPolyMeshFromFile(const char *file)
 {
+    const char *ext = strrchr(file, '.');
+    if (ext && strcmp(ext, ".geob") == 0) return loadPolyMeshFromBinaryFile(file);
     std::ifstream ifs;
     try {
         ifs.open(file);
@@ -333,7 +520,7 @@ TriangleMesh* loadPolyMeshFromFile(const char *file)
             ss >> st[i].x >> st[i].y;
         }
         
-        return new TriangleMesh(numFaces, faceIndex, vertsIndex, verts, normals, st);
+        return new TriangleMesh(numFaces, faceIndex.get(), vertsIndex.get(), verts.get(), normals.get(), st.get());
     }
     catch (...) {
         ifs.close();
@@ -343,6 +530,279 @@ TriangleMesh* loadPolyMeshFromFile(const char *file)
     return nullptr;
 }
 
+// [comment]
+// Clustered meshes (geoc files, see convertgeometry.cpp). The triangles of the mesh are
+// stored in clusters, small indexed meshes grouping triangles that are close to each other in
+// space. Only the table of clusters (which contains their bounding box) is loaded in memory.
+// A cluster is read from the file the first time a ray hits its bounding box, and kept in
+// a cache which can hold at most a given number of bytes. When the cache is full, the least
+// recently used clusters are removed from memory to make room for the new one (a cluster
+// larger than the cache is still loaded, on its own). This makes it possible to render
+// meshes that are larger than the memory available, as long as the clusters the rays need
+// at any given time fit in the cache. Rays that go through nearby pixels generally hit the
+// same clusters, so most of the requests are cache hits.
+// [/comment]
+static const char kGeoClusterMagic[4] = {'G', 'E', 'O', 'C'};
+static const uint32_t kGeoClusterVersion = 1;
+
+struct GeoClusterHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t numClusters;
+    uint32_t numTris;
+    uint64_t clusterTableOffset;
+};
+
+struct GeoClusterInfo
+{
+    Vec3f bboxMin, bboxMax;
+    uint32_t numVerts;
+    uint32_t numTris;
+    uint64_t vertsOffset;   // then normals, texture coordinates and triangle indices
+    uint64_t bytes;
+};
+
+inline uint64_t align16(uint64_t offset) { return (offset + 15) & ~uint64_t(15); }
+
+// the number of bytes of a cluster in the file, padding between the arrays included
+uint64_t clusterBytes(const GeoClusterInfo &info)
+{
+    uint64_t normalsOffset = align16(info.numVerts * sizeof(Vec3f));
+    uint64_t stOffset = align16(normalsOffset + info.numVerts * sizeof(Vec3f));
+    uint64_t trisOffset = align16(stOffset + info.numVerts * sizeof(Vec2f));
+    return trisOffset + info.numTris * 3 * sizeof(uint32_t);
+}
+
+struct Cluster
+{
+    uint32_t numVerts;
+    uint32_t numTris;
+    std::unique_ptr<Vec3f []> P;              // vertex positions
+    std::unique_ptr<Vec3f []> N;              // vertex normals
+    std::unique_ptr<Vec2f []> texCoordinates; // vertex texture coordinates
+    std::unique_ptr<uint32_t []> trisIndex;   // vertex index array
+};
+
+struct ClusterCacheStats
+{
+    uint64_t numRequests = 0;
+    uint64_t numPageFaults = 0;    // requests for a cluster which wasn't in memory
+    uint64_t numEvictions = 0;
+    uint64_t bytesRead = 0;
+    uint64_t peakBytes = 0;
+};
+
+class ClusterCache
+{
+public:
+    ClusterCache(const char *file, const std::vector<GeoClusterInfo> &clusterTable, uint64_t budget) :
+        ifs(file, std::ios::binary), table(clusterTable), maxBytes(budget), entries(clusterTable.size())
+    {}
+    // [comment]
+    // The clusters are returned as shared pointers so that a cluster evicted from the cache
+    // while it is being used is only deleted once it is not used anymore.
+    // [/comment]
+    std::shared_ptr<const Cluster> fetch(uint32_t index)
+    {
+        stats.numRequests++;
+        Entry &entry = entries[index];
+        if (entry.cluster) {
+            lru.splice(lru.begin(), lru, entry.lruPosition);
+            return entry.cluster;
+        }
+        stats.numPageFaults++;
+        const GeoClusterInfo &info = table[index];
+        while (!lru.empty() && numBytes + info.bytes > maxBytes) {
+            Entry &victim = entries[lru.back()];
+            victim.cluster.reset();
+            numBytes -= table[lru.back()].bytes;
+            lru.pop_back();
+            stats.numEvictions++;
+        }
+        std::shared_ptr<Cluster> cluster = readCluster(info);
+        if (!cluster) return nullptr;
+        lru.push_front(index);
+        entry.cluster = cluster;
+        entry.lruPosition = lru.begin();
+        numBytes += info.bytes;
+        stats.bytesRead += info.bytes;
+        stats.peakBytes = std::max(stats.peakBytes, numBytes);
+        return cluster;
+    }
+    ClusterCacheStats stats;
+private:
+    std::shared_ptr<Cluster> readCluster(const GeoClusterInfo &info)
+    {
+        std::unique_ptr<char []> data(new char[info.bytes]);
+        ifs.clear();
+        ifs.seekg(info.vertsOffset);
+        if (!ifs.read(data.get(), info.bytes)) {
+            std::cerr << "Error: unable to read cluster at offset " << info.vertsOffset << std::endl;
+            return nullptr;
+        }
+        std::shared_ptr<Cluster> cluster(new Cluster);
+        cluster->numVerts = info.numVerts;
+        cluster->numTris = info.numTris;
+        cluster->P = std::unique_ptr<Vec3f []>(new Vec3f[info.numVerts]);
+        cluster->N = std::unique_ptr<Vec3f []>(new Vec3f[info.numVerts]);
+        cluster->texCoordinates = std::unique_ptr<Vec2f []>(new Vec2f[info.numVerts]);
+        cluster->trisIndex = std::unique_ptr<uint32_t []>(new uint32_t[info.numTris * 3]);
+        uint64_t offset = 0;
+        memcpy(cluster->P.get(), data.get() + offset, info.numVerts * sizeof(Vec3f));
+        offset = align16(offset + info.numVerts * sizeof(Vec3f));
+        memcpy(cluster->N.get(), data.get() + offset, info.numVerts * sizeof(Vec3f));
+        offset = align16(offset + info.numVerts * sizeof(Vec3f));
+        memcpy(cluster->texCoordinates.get(), data.get() + offset, info.numVerts * sizeof(Vec2f));
+        offset = align16(offset + info.numVerts * sizeof(Vec2f));
+        memcpy(cluster->trisIndex.get(), data.get() + offset, info.numTris * 3 * sizeof(uint32_t));
+        for (uint32_t i = 0; i < info.numTris * 3; ++i) {
+            if (cluster->trisIndex[i] >= info.numVerts) {
+                std::cerr << "Error: cluster at offset " << info.vertsOffset << " is corrupted" << std::endl;
+                return nullptr;
+            }
+        }
+        return cluster;
+    }
+    struct Entry
+    {
+        std::shared_ptr<Cluster> cluster;
+        std::list<uint32_t>::iterator lruPosition;
+    };
+    std::ifstream ifs;
+    const std::vector<GeoClusterInfo> &table;
+    uint64_t maxBytes;
+    uint64_t numBytes = 0;
+    std::vector<Entry> entries;
+    std::list<uint32_t> lru;   // the clusters in memory, most recently used first
+};
+
+// ray-box intersection (slab method), returns the distance to the entry point of the box
+bool rayBoxIntersect(const Vec3f &orig, const Vec3f &invDir, const Vec3f &bmin, const Vec3f &bmax, float &t)
+{
+    float tmin = 0, tmax = kInfinity;
+    for (uint8_t i = 0; i < 3; ++i) {
+        float t0 = (bmin[i] - orig[i]) * invDir[i];
+        float t1 = (bmax[i] - orig[i]) * invDir[i];
+        if (t0 > t1) std::swap(t0, t1);
+        tmin = std::max(tmin, t0);
+        tmax = std::min(tmax, t1);
+        if (tmin > tmax) return false;
+    }
+    t = tmin;
+    return true;
+}
+
+class ClusteredMesh : public Object
+{
+public:
+    ClusteredMesh(const char *file, std::vector<GeoClusterInfo> &clusterTable, uint64_t cacheBudget) :
+        table(std::move(clusterTable)), cache(file, table, cacheBudget), firstTri(table.size())
+    {
+        for (uint32_t i = 0; i < table.size(); ++i) {
+            firstTri[i] = numTris;
+            numTris += table[i].numTris;
+        }
+    }
+    // [comment]
+    // Visit the clusters whose bounding box the ray intersects from front to back, and stop as
+    // soon as the closest intersection found so far is in front of the next box. This avoids
+    // loading the clusters hidden behind the first surface the ray hits.
+    // [/comment]
+    bool intersect(const Vec3f &orig, const Vec3f &dir, float &tNear, uint32_t &triIndex, Vec2f &uv) const
+    {
+        Vec3f invDir(1 / dir.x, 1 / dir.y, 1 / dir.z);
+        std::vector<std::pair<float, uint32_t>> &hits = boxHits;
+        hits.clear();
+        for (uint32_t i = 0; i < table.size(); ++i) {
+            float tBox;
+            if (rayBoxIntersect(orig, invDir, table[i].bboxMin, table[i].bboxMax, tBox) && tBox < tNear)
+                hits.push_back(std::make_pair(tBox, i));
+        }
+        std::sort(hits.begin(), hits.end());
+        bool isect = false;
+        for (const auto &hit : hits) {
+            if (hit.first > tNear) break;
+            std::shared_ptr<const Cluster> cluster = cache.fetch(hit.second);
+            if (!cluster) continue;
+            for (uint32_t i = 0, j = 0; i < cluster->numTris; ++i, j += 3) {
+                const Vec3f &v0 = cluster->P[cluster->trisIndex[j]];
+                const Vec3f &v1 = cluster->P[cluster->trisIndex[j + 1]];
+                const Vec3f &v2 = cluster->P[cluster->trisIndex[j + 2]];
+                float t = kInfinity, u, v;
+                if (rayTriangleIntersect(orig, dir, v0, v1, v2, t, u, v) && t < tNear) {
+                    tNear = t;
+                    uv.x = u;
+                    uv.y = v;
+                    triIndex = firstTri[hit.second] + i;
+                    isect = true;
+                }
+            }
+        }
+
+        return isect;
+    }
+    void getSurfaceProperties(
+        const Vec3f &hitPoint,
+        const Vec3f &viewDirection,
+        const uint32_t &triIndex,
+        const Vec2f &uv,
+        Vec3f &hitNormal,
+        Vec2f &hitTextureCoordinates) const
+    {
+        uint32_t clusterIndex = std::upper_bound(firstTri.begin(), firstTri.end(), triIndex) - firstTri.begin() - 1;
+        std::shared_ptr<const Cluster> cluster = cache.fetch(clusterIndex);
+        if (!cluster) return;
+        const uint32_t *tri = &cluster->trisIndex[(triIndex - firstTri[clusterIndex]) * 3];
+        // face normal
+        const Vec3f &v0 = cluster->P[tri[0]];
+        const Vec3f &v1 = cluster->P[tri[1]];
+        const Vec3f &v2 = cluster->P[tri[2]];
+        hitNormal = (v1 - v0).crossProduct(v2 - v0);
+        hitNormal.normalize();
+
+        // texture coordinates
+        const Vec2f &st0 = cluster->texCoordinates[tri[0]];
+        const Vec2f &st1 = cluster->texCoordinates[tri[1]];
+        const Vec2f &st2 = cluster->texCoordinates[tri[2]];
+        hitTextureCoordinates = (1 - uv.x - uv.y) * st0 + uv.x * st1 + uv.y * st2;
+    }
+    // member variables
+    uint32_t numTris = 0;
+    std::vector<GeoClusterInfo> table;        // the bounding box of each cluster and where it is in the file
+    mutable ClusterCache cache;
+    std::vector<uint32_t> firstTri;           // index of the first triangle of each cluster
+    mutable std::vector<std::pair<float, uint32_t>> boxHits;
+};
+
+ClusteredMesh* loadClusteredMesh(const char *file, uint64_t cacheBudget)
+{
+    std::ifstream ifs(file, std::ios::binary);
+    GeoClusterHeader header;
+    if (!ifs.read((char*)&header, sizeof(header)) || memcmp(header.magic, kGeoClusterMagic, 4) != 0 ||
+        header.version != kGeoClusterVersion) {
+        std::cerr << "Error: " << file << " is not a geoc file" << std::endl;
+        return nullptr;
+    }
+    ifs.seekg(0, std::ios::end);
+    uint64_t fileSize = ifs.tellg();
+    std::vector<GeoClusterInfo> table(header.numClusters);
+    ifs.seekg(header.clusterTableOffset);
+    if (!ifs.read((char*)table.data(), table.size() * sizeof(GeoClusterInfo))) {
+        std::cerr << "Error: " << file << " is truncated" << std::endl;
+        return nullptr;
+    }
+    // check that the clusters are within the file
+    for (const auto &info : table) {
+        if (info.vertsOffset > fileSize || info.bytes > fileSize - info.vertsOffset || info.bytes != clusterBytes(info)) {
+            std::cerr << "Error: " << file << " is corrupted" << std::endl;
+            return nullptr;
+        }
+    }
+
+    return new ClusteredMesh(file, table, cacheBudget);
+}
+
 bool trace(
     const Vec3f &orig, const Vec3f &dir,
     const std::vector<std::unique_ptr<Object>> &objects,
@@ -454,11 +914,31 @@ int main(int argc, char **argv)
     options.fov = 50.0393;
 #if 1
     std::vector<std::unique_ptr<Object>> objects;
-    TriangleMesh *mesh = loadPolyMeshFromFile("./cow.geo");
-    if (mesh != nullptr) objects.push_back(std::unique_ptr<Object>(mesh));
+    const char *file = argc > 1 ? argv[1] : "./cow.geo";
+    const char *ext = strrchr(file, '.');
+    ClusteredMesh *clusteredMesh = nullptr;
+    if (ext && strcmp(ext, ".geoc") == 0) {
+        uint64_t cacheBudget = (argc > 2 ? atoll(argv[2]) : 64) * 1024;
+        clusteredMesh = loadClusteredMesh(file, cacheBudget);
+        if (clusteredMesh != nullptr) objects.push_back(std::unique_ptr<Object>(clusteredMesh));
+    }
+    else {
+        TriangleMesh *mesh = loadPolyMeshFromFile(file);
+        if (mesh != nullptr) objects.push_back(std::unique_ptr<Object>(mesh));
+    }
     
     // finally, render
     render(options, objects, 0);
+
+    if (clusteredMesh != nullptr) {
+        const ClusterCacheStats &stats = clusteredMesh->cache.stats;
+        fprintf(stderr, "Clusters: %u, requests: %llu, page faults: %llu (%.2f%%), evictions: %llu\n",
+            (uint32_t)clusteredMesh->table.size(), (unsigned long long)stats.numRequests,
+            (unsigned long long)stats.numPageFaults, 100.0 * stats.numPageFaults / std::max<uint64_t>(1, stats.numRequests),
+            (unsigned long long)stats.numEvictions);
+        fprintf(stderr, "Bytes read: %llu, peak cache size: %llu bytes\n",
+            (unsigned long long)stats.bytesRead, (unsigned long long)stats.peakBytes);
+    }
 #else
     for (uint32_t i = 0; i < 10; ++i) {
         int divs = 5 + i;
@@ -32,13 +32,23 @@
 #include <cstdlib>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <utility>
 #include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <cmath>
 #include <sstream>
+#include <cstring>
+#include <iterator>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <chrono>
+#include <thread>
 
 #include "geometry.h"
 
@@ -203,6 +213,209 @@ bool rayTriangleIntersect(
     return (t > 0) ? true : false;
 }
 
+// [comment]
+// Call func(begin, end) on blocks of the range [0, count), one block per core. Ranges smaller
+// than minPerThread items per thread are processed by the calling thread alone: starting threads
+// would cost more than the work itself.
+// [/comment]
+template<typename Func>
+void parallelFor(uint32_t count, uint32_t minPerThread, const Func& func)
+{
+    uint32_t numThreads = std::min(std::max(1u, std::thread::hardware_concurrency()), count / std::max(1u, minPerThread));
+    if (numThreads <= 1) {
+        func(0u, count);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < numThreads; ++i) {
+        threads.emplace_back(func, uint32_t(uint64_t(count) * i / numThreads), uint32_t(uint64_t(count) * (i + 1) / numThreads));
+    }
+    func(0u, uint32_t(count / numThreads));
+    for (auto& thread : threads) thread.join();
+}
+
+// [comment]
+// Triangulate a polygon with the ear clipping method. The polygon is projected onto the plane of
+// the two axes its normal is the most perpendicular to (the normal is computed with Newell's
+// method, which gives a sensible result for non-planar and non-convex polygons). An ear is a
+// convex corner whose triangle doesn't contain any other vertex of the polygon: it can be cut
+// off, leaving a polygon with one vertex less. Convex polygons, by far the most common, are
+// split into a fan directly, which is also what ear clipping gives for them since ears are
+// searched in order starting from the second vertex. The numVerts - 2 triangles are written to
+// triangles as positions in the polygon's vertex list (0 to numVerts - 1).
+// [/comment]
+void triangulatePolygon(const Vec3f* verts, const uint32_t* indices, uint32_t numVerts, uint32_t* triangles)
+{
+    Vec3f N(0);
+    for (uint32_t i = 0; i < numVerts; ++i) {
+        const Vec3f& a = verts[indices[i]];
+        const Vec3f& b = verts[indices[(i + 1) % numVerts]];
+        N.x += (a.y - b.y) * (a.z + b.z);
+        N.y += (a.z - b.z) * (a.x + b.x);
+        N.z += (a.x - b.x) * (a.y + b.y);
+    }
+    uint32_t axis = (std::fabs(N.x) > std::fabs(N.y)) ? (std::fabs(N.x) > std::fabs(N.z) ? 0 : 2) : (std::fabs(N.y) > std::fabs(N.z) ? 1 : 2);
+    // (axis + 1, axis + 2) keeps the orientation: the polygon is counter-clockwise if N[axis] > 0
+    float sign = N[axis] < 0 ? -1.f : 1.f;
+    auto area = [&](uint32_t a, uint32_t b, uint32_t c)
+    {
+        const Vec3f& pa = verts[indices[a]], & pb = verts[indices[b]], & pc = verts[indices[c]];
+        uint32_t u = (axis + 1) % 3, v = (axis + 2) % 3;
+        return sign * ((pb[u] - pa[u]) * (pc[v] - pa[v]) - (pb[v] - pa[v]) * (pc[u] - pa[u]));
+    };
+
+    auto samePosition = [&](uint32_t a, uint32_t b)
+    {
+        const Vec3f& pa = verts[indices[a]], & pb = verts[indices[b]];
+        return pa.x == pb.x && pa.y == pb.y && pa.z == pb.z;
+    };
+
+    bool convex = true;
+    for (uint32_t i = 0; i < numVerts && convex; ++i) {
+        convex = area((i + numVerts - 1) % numVerts, i, (i + 1) % numVerts) >= 0;
+    }
+    if (convex) {
+        for (uint32_t j = 0; j < numVerts - 2; ++j) {
+            triangles[j * 3] = 0;
+            triangles[j * 3 + 1] = j + 1;
+            triangles[j * 3 + 2] = j + 2;
+        }
+        return;
+    }
+
+    std::vector<uint32_t> remaining(numVerts);
+    for (uint32_t i = 0; i < numVerts; ++i) remaining[i] = i;
+    uint32_t numTris = 0, i = 1;
+    while (remaining.size() > 3) {
+        uint32_t m = remaining.size();
+        // if there's no ear (the polygon intersects itself), the corner we started from is cut anyway
+        for (uint32_t tries = 0; tries < m; ++tries, i = (i + 1) % m) {
+            uint32_t a = remaining[(i + m - 1) % m], b = remaining[i], c = remaining[(i + 1) % m];
+            if (area(a, b, c) <= 0) continue;
+            bool isEar = true;
+            for (uint32_t k = 0; k < m && isEar; ++k) {
+                uint32_t p = remaining[k];
+                // skip the vertices of the triangle, and their duplicates (polygons with holes
+                // connected to the outline have some)
+                if (samePosition(p, a) || samePosition(p, b) || samePosition(p, c)) continue;
+                isEar = !(area(a, b, p) >= 0 && area(b, c, p) >= 0 && area(c, a, p) >= 0);
+            }
+            if (isEar) break;
+        }
+        triangles[numTris * 3] = remaining[(i + m - 1) % m];
+        triangles[numTris * 3 + 1] = remaining[i];
+        triangles[numTris * 3 + 2] = remaining[(i + 1) % m];
+        numTris++;
+        remaining.erase(remaining.begin() + i);
+        if (i == remaining.size()) i = 0;
+    }
+    triangles[numTris * 3] = remaining[0];
+    triangles[numTris * 3 + 1] = remaining[1];
+    triangles[numTris * 3 + 2] = remaining[2];
+}
+
+// [comment]
+// Compute a normal for each face vertex, for meshes that come without normals. The normal of a
+// vertex is the average of the normals of the faces sharing the vertex, weighted by the angle of
+// each face at the vertex (so that the result doesn't depend on how the faces are split into
+// triangles). The faces whose normal makes an angle greater than creaseAngle (in degrees) with
+// the normal of the face the vertex belongs to are left out: the edges sharper than the crease
+// angle stay hard (a cube keeps flat faces) while the others are smoothed (a sphere looks round).
+// The faces, then the face vertices, are processed in parallel.
+// [/comment]
+void computeSmoothNormals(
+    const uint32_t nfaces,
+    const uint32_t *faceIndex,
+    const uint32_t *vertsIndex,
+    const Vec3f *verts,
+    const float creaseAngle,
+    Vec3f *normals)
+{
+    std::vector<uint32_t> faceOffsets(nfaces + 1, 0);
+    for (uint32_t i = 0; i < nfaces; ++i) faceOffsets[i + 1] = faceOffsets[i] + faceIndex[i];
+    uint32_t numFaceVerts = faceOffsets[nfaces], numVerts = 0;
+    for (uint32_t i = 0; i < numFaceVerts; ++i) numVerts = std::max(numVerts, vertsIndex[i] + 1);
+
+    // the normal of each face (with Newell's method) and the angle of the face at each of its vertices
+    std::vector<Vec3f> faceNormals(nfaces);
+    std::vector<float> angles(numFaceVerts);
+    std::vector<uint32_t> faceOf(numFaceVerts);
+    parallelFor(nfaces, 4096, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t *face = vertsIndex + faceOffsets[i];
+            uint32_t n = faceIndex[i];
+            Vec3f N(0);
+            for (uint32_t j = 0; j < n; ++j) {
+                const Vec3f &a = verts[face[j]], &b = verts[face[(j + 1) % n]];
+                N.x += (a.y - b.y) * (a.z + b.z);
+                N.y += (a.z - b.z) * (a.x + b.x);
+                N.z += (a.x - b.x) * (a.y + b.y);
+            }
+            faceNormals[i] = N.normalize();
+            for (uint32_t j = 0; j < n; ++j) {
+                Vec3f e0 = verts[face[(j + n - 1) % n]] - verts[face[j]];
+                Vec3f e1 = verts[face[(j + 1) % n]] - verts[face[j]];
+                float len = e0.length() * e1.length();
+                angles[faceOffsets[i] + j] = len > 0 ? std::acos(clamp(-1, 1, e0.dotProduct(e1) / len)) : 0;
+                faceOf[faceOffsets[i] + j] = i;
+            }
+        }
+    });
+
+    // list the face vertices of each vertex
+    std::vector<uint32_t> vertOffsets(numVerts + 1, 0), vertFaceVerts(numFaceVerts);
+    for (uint32_t i = 0; i < numFaceVerts; ++i) vertOffsets[vertsIndex[i] + 1]++;
+    for (uint32_t i = 0; i < numVerts; ++i) vertOffsets[i + 1] += vertOffsets[i];
+    std::vector<uint32_t> next(vertOffsets.begin(), vertOffsets.end() - 1);
+    for (uint32_t i = 0; i < numFaceVerts; ++i) vertFaceVerts[next[vertsIndex[i]]++] = i;
+
+    float cosCreaseAngle = std::cos(deg2rad(creaseAngle));
+    parallelFor(numFaceVerts, 16384, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i) {
+            const Vec3f &Nf = faceNormals[faceOf[i]];
+            Vec3f N(0);
+            for (uint32_t k = vertOffsets[vertsIndex[i]]; k < vertOffsets[vertsIndex[i] + 1]; ++k) {
+                uint32_t j = vertFaceVerts[k];
+                const Vec3f &Nj = faceNormals[faceOf[j]];
+                if (Nf.dotProduct(Nj) >= cosCreaseAngle) N += Nj * angles[j];
+            }
+            normals[i] = N.length() > 0 ? N.normalize() : Nf;
+        }
+    });
+}
+
+// [comment]
+// A vertex of an indexed mesh: the index of its position, and the value of its other attributes.
+// Two vertices are the same if all their attributes are bitwise identical.
+// [/comment]
+struct MeshVertex
+{
+    uint32_t vertIndex;
+    Vec3f normal;
+    Vec2f st;
+    bool operator == (const MeshVertex &v) const
+    {
+        return vertIndex == v.vertIndex &&
+            memcmp(&normal, &v.normal, sizeof(Vec3f)) == 0 &&
+            memcmp(&st, &v.st, sizeof(Vec2f)) == 0;
+    }
+};
+
+struct MeshVertexHash
+{
+    size_t operator () (const MeshVertex &v) const
+    {
+        uint32_t bits[5];
+        memcpy(bits, &v.normal, sizeof(Vec3f));
+        memcpy(bits + 3, &v.st, sizeof(Vec2f));
+        uint64_t h = v.vertIndex;
+        for (uint32_t i = 0; i < 5; ++i) h = (h ^ bits[i]) * 0x100000001b3ULL;
+        return size_t(h ^ (h >> 32));
+    }
+};
+
 class TriangleMesh : public Object
 {
 public:
@@ -210,66 +423,91 @@ public:
     TriangleMesh(
         const Matrix44f &o2w,
         const uint32_t nfaces,
-        const std::unique_ptr<uint32_t []> &faceIndex,
-        const std::unique_ptr<uint32_t []> &vertsIndex,
-        const std::unique_ptr<Vec3f []> &verts,
-        std::unique_ptr<Vec3f []> &normals,
-        std::unique_ptr<Vec2f []> &st) :
+        const uint32_t *faceIndex,
+        const uint32_t *vertsIndex,
+        const Vec3f *verts,
+        const Vec3f *normals,
+        const Vec2f *st,
+        const float creaseAngle = 60) :
         Object(o2w),
         numTris(0)
     {
         this->name = "trianglemesh";
-        uint32_t k = 0, maxVertIndex = 0;
-        // find out how many triangles we need to create for this mesh
+        // find out how many triangles we need to create for this mesh, and where the vertices of
+        // each face start
+        std::vector<uint32_t> faceOffsets(nfaces + 1, 0);
         for (uint32_t i = 0; i < nfaces; ++i) {
             numTris += faceIndex[i] - 2;
-            for (uint32_t j = 0; j < faceIndex[i]; ++j)
-                if (vertsIndex[k + j] > maxVertIndex)
-                    maxVertIndex = vertsIndex[k + j];
-            k += faceIndex[i];
+            faceOffsets[i + 1] = faceOffsets[i] + faceIndex[i];
         }
-        maxVertIndex += 1;
-        
-        // allocate memory to store the position of the mesh vertices
-        P = std::unique_ptr<Vec3f []>(new Vec3f[maxVertIndex]);
-        for (uint32_t i = 0; i < maxVertIndex; ++i) {
-            // [comment]
-            // Transforming vertices to world space
-            // [/comment]
-            objectToWorld.multVecMatrix(verts[i], P[i]);
+        uint32_t numFaceVerts = faceOffsets[nfaces];
+
+        // meshes without normals get smooth normals (texture coordinates default to 0)
+        std::unique_ptr<Vec3f []> smoothNormals;
+        if (normals == nullptr) {
+            smoothNormals = std::unique_ptr<Vec3f []>(new Vec3f[numFaceVerts]);
+            computeSmoothNormals(nfaces, faceIndex, vertsIndex, verts, creaseAngle, smoothNormals.get());
+            normals = smoothNormals.get();
         }
-        
-        // allocate memory to store triangle indices
-        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
-        uint32_t l = 0;
-        N = std::unique_ptr<Vec3f []>(new Vec3f[numTris * 3]);
-        sts = std::unique_ptr<Vec2f []>(new Vec2f[numTris * 3]);
+
+        // [comment]
+        // Build an indexed mesh. Keep in mind that there is generally 1 vertex attribute for each
+        // vertex of each face. So for example if you have 2 quads, you only have 6 vertices but you
+        // have 2 * 4 vertex attributes (that is 8 normals, 8 texture coordinates, etc.). Vertices
+        // sharing a position but not their normal or texture coordinates (along a hard edge or a
+        // texture seam) need to be split. So we create one mesh vertex for each distinct (position,
+        // normal, texture coordinates) tuple, which we find with a hash table. Each attribute is then
+        // stored once per mesh vertex rather than once per triangle vertex, and a single index array
+        // gives the position, normal and texture coordinates of the vertices of each triangle.
+        // [/comment]
+        std::unordered_map<MeshVertex, uint32_t, MeshVertexHash> vertexMap;
+        std::vector<uint32_t> firstFaceVert; // the face vertex each mesh vertex was created from
+        std::unique_ptr<uint32_t []> meshVertIndex(new uint32_t[numFaceVerts]);
+        for (uint32_t i = 0; i < numFaceVerts; ++i) {
+            MeshVertex v = {vertsIndex[i], normals[i], st ? st[i] : Vec2f(0)};
+            auto inserted = vertexMap.insert(std::make_pair(v, (uint32_t)firstFaceVert.size()));
+            if (inserted.second) firstFaceVert.push_back(i);
+            meshVertIndex[i] = inserted.first->second;
+        }
+        numVerts = firstFaceVert.size();
+
+        // allocate memory to store the position, normal and texture coordinates of the mesh vertices
+        P = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        N = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        sts = std::unique_ptr<Vec2f []>(new Vec2f[numVerts]);
         // [comment]
-        // Computing the transpse of the object-to-world inverse matrix
+        // Computing the transpose of the object-to-world inverse matrix
         // [/comment]
         Matrix44f transformNormals = worldToObject.transpose();
-        // generate the triangle index array and set normals and st coordinates
-        for (uint32_t i = 0, k = 0; i < nfaces; ++i) { // for each  face
-            for (uint32_t j = 0; j < faceIndex[i] - 2; ++j) { // for each triangle in the face
-                trisIndex[l] = vertsIndex[k];
-                trisIndex[l + 1] = vertsIndex[k + j + 1];
-                trisIndex[l + 2] = vertsIndex[k + j + 2];
-                // [comment]
-                // Transforming normals
-                // [/comment]
-                transformNormals.multDirMatrix(normals[k], N[l]);
-                transformNormals.multDirMatrix(normals[k + j + 1], N[l + 1]);
-                transformNormals.multDirMatrix(normals[k + j + 2], N[l + 2]);
-                N[l].normalize();
-                N[l + 1].normalize();
-                N[l + 2].normalize();
-                sts[l] = st[k];
-                sts[l + 1] = st[k + j + 1];
-                sts[l + 2] = st[k + j + 2];
-                l += 3;
-            }                                                                                                                                                                                                                                
-            k += faceIndex[i];
+        for (uint32_t i = 0; i < numVerts; ++i) {
+            uint32_t faceVert = firstFaceVert[i];
+            // [comment]
+            // Transforming vertices and normals to world space
+            // [/comment]
+            objectToWorld.multVecMatrix(verts[vertsIndex[faceVert]], P[i]);
+            transformNormals.multDirMatrix(normals[faceVert], N[i]);
+            N[i].normalize();
+            sts[i] = st ? st[faceVert] : Vec2f(0);
         }
+
+        // [comment]
+        // Generate the triangle index array. The faces are split with ear clipping, so non-convex
+        // faces are triangulated correctly. A face with n vertices gives n - 2 triangles: the
+        // triangles of face i start at triangle faceOffsets[i] - 2 * i, so the faces can be
+        // triangulated in parallel.
+        // [/comment]
+        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
+        parallelFor(nfaces, 4096, [&](uint32_t begin, uint32_t end)
+        {
+            std::vector<uint32_t> triangles;
+            for (uint32_t i = begin; i < end; ++i) { // for each face
+                uint32_t k = faceOffsets[i];
+                triangles.resize((faceIndex[i] - 2) * 3);
+                triangulatePolygon(verts, vertsIndex + k, faceIndex[i], triangles.data());
+                uint32_t *dst = &trisIndex[(k - 2 * i) * 3];
+                for (uint32_t j = 0; j < triangles.size(); ++j) dst[j] = meshVertIndex[k + triangles[j]];
+            }
+        });
     }
     // Test if the ray interesests this triangle mesh
     bool intersect(const Vec3f &orig, const Vec3f &dir, float &tNear, uint32_t &triIndex, Vec2f &uv) const
@@ -303,9 +541,9 @@ public:
     {
         if (smoothShading) {
             // vertex normal
-            const Vec3f &n0 = N[triIndex * 3];
-            const Vec3f &n1 = N[triIndex * 3 + 1];
-            const Vec3f &n2 = N[triIndex * 3 + 2];
+            const Vec3f &n0 = N[trisIndex[triIndex * 3]];
+            const Vec3f &n1 = N[trisIndex[triIndex * 3 + 1]];
+            const Vec3f &n2 = N[trisIndex[triIndex * 3 + 2]];
             hitNormal = (1 - uv.x - uv.y) * n0 + uv.x * n1 + uv.y * n2;
         }
         else {
@@ -320,22 +558,167 @@ public:
         hitNormal.normalize();
 
         // texture coordinates
-        const Vec2f &st0 = sts[triIndex * 3];
-        const Vec2f &st1 = sts[triIndex * 3 + 1];
-        const Vec2f &st2 = sts[triIndex * 3 + 2];
+        const Vec2f &st0 = sts[trisIndex[triIndex * 3]];
+        const Vec2f &st1 = sts[trisIndex[triIndex * 3 + 1]];
+        const Vec2f &st2 = sts[trisIndex[triIndex * 3 + 2]];
         hitTextureCoordinates = (1 - uv.x - uv.y) * st0 + uv.x * st1 + uv.y * st2;
     }
     // member variables
     uint32_t numTris;                       // number of triangles
-    std::unique_ptr<Vec3f []> P;            // triangles vertex position
+    uint32_t numVerts;                      // number of vertices
+    std::unique_ptr<Vec3f []> P;            // vertex positions
     std::unique_ptr<uint32_t []> trisIndex; // vertex index array
-    std::unique_ptr<Vec3f []> N;            // triangles vertex normals
-    std::unique_ptr<Vec2f []> sts;          // triangles texture coordinates
+    std::unique_ptr<Vec3f []> N;            // vertex normals
+    std::unique_ptr<Vec2f []> sts;          // vertex texture coordinates
     bool smoothShading = true;              // smooth shading by default
 };
 
+// [comment]
+// Binary version of the geo file (geob), see polygon-mesh/convertgeometry.cpp. The header gives
+// the offset of each array from the start of the file, so loading the mesh is just mapping the
+// file in memory and adding these offsets to the address of the mapping, there's nothing to parse.
+// Only the index arrays need decoding when the file is compressed.
+// [/comment]
+static const char kGeoBinMagic[4] = {'G', 'E', 'O', 'B'};
+static const uint32_t kGeoBinVersion = 1;
+static const uint32_t kGeoBinCompressedIndices = 1;
+
+struct GeoBinHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numFaces;
+    uint32_t vertsIndexArraySize;
+    uint32_t vertsArraySize;
+    uint64_t faceIndexOffset, faceIndexBytes;
+    uint64_t vertsIndexOffset, vertsIndexBytes;
+    uint64_t vertsOffset;
+    uint64_t normalsOffset;
+    uint64_t stOffset;
+};
+
+struct MappedFile
+{
+    MappedFile(const char *file)
+    {
+#ifdef _WIN32
+        std::ifstream ifs(file, std::ios::binary);
+        if (ifs.fail()) return;
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data = (const uint8_t*)contents.data();
+        size = contents.size();
+#else
+        int fd = open(file, O_RDONLY);
+        struct stat st;
+        if (fd == -1) return;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data = (const uint8_t*)mapping;
+                size = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data) munmap((void*)data, size);
+#endif
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::string contents;
+#endif
+};
+
+// decode the delta encoded, variable length indices of a compressed file
+bool decodeIndices(const uint8_t *p, const uint8_t *end, uint32_t count, uint32_t *indices)
+{
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t v = 0;
+        for (uint32_t shift = 0; ; shift += 7) {
+            if (p == end || shift > 28) return false;
+            uint8_t byte = *p++;
+            v |= uint32_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        prev += (v >> 1) ^ (0u - (v & 1));
+        indices[i] = prev;
+    }
+    return true;
+}
+
+TriangleMesh* loadPolyMeshFromBinaryFile(const char *file, const Matrix44f &o2w)
+{
+    MappedFile mapped(file);
+    const GeoBinHeader *header = (const GeoBinHeader*)mapped.data;
+    if (mapped.size < sizeof(GeoBinHeader) || memcmp(header->magic, kGeoBinMagic, 4) != 0 ||
+        header->version != kGeoBinVersion) {
+        std::cerr << "Error: " << file << " is not a geob file" << std::endl;
+        return nullptr;
+    }
+    // check that the arrays are within the file
+    bool compressed = header->flags & kGeoBinCompressedIndices;
+    uint64_t faceIndexBytes = compressed ? header->faceIndexBytes : header->numFaces * sizeof(uint32_t);
+    uint64_t vertsIndexBytes = compressed ? header->vertsIndexBytes : header->vertsIndexArraySize * sizeof(uint32_t);
+    const uint64_t arrays[5][2] = {
+        {header->faceIndexOffset, faceIndexBytes},
+        {header->vertsIndexOffset, vertsIndexBytes},
+        {header->vertsOffset, header->vertsArraySize * sizeof(Vec3f)},
+        {header->normalsOffset, header->vertsIndexArraySize * sizeof(Vec3f)},
+        {header->stOffset, header->vertsIndexArraySize * sizeof(Vec2f)}};
+    for (uint32_t i = 0; i < 5; ++i) {
+        if (arrays[i][0] % 4 != 0 || arrays[i][0] > mapped.size || arrays[i][1] > mapped.size - arrays[i][0]) {
+            std::cerr << "Error: " << file << " is truncated" << std::endl;
+            return nullptr;
+        }
+    }
+    const uint32_t *faceIndex = (const uint32_t*)(mapped.data + header->faceIndexOffset);
+    const uint32_t *vertsIndex = (const uint32_t*)(mapped.data + header->vertsIndexOffset);
+    std::unique_ptr<uint32_t []> decodedFaceIndex, decodedVertsIndex;
+    if (compressed) {
+        decodedFaceIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->numFaces]);
+        decodedVertsIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->vertsIndexArraySize]);
+        if (!decodeIndices(mapped.data + header->faceIndexOffset, mapped.data + header->faceIndexOffset + faceIndexBytes,
+                           header->numFaces, decodedFaceIndex.get()) ||
+            !decodeIndices(mapped.data + header->vertsIndexOffset, mapped.data + header->vertsIndexOffset + vertsIndexBytes,
+                           header->vertsIndexArraySize, decodedVertsIndex.get())) {
+            std::cerr << "Error: " << file << " is corrupted" << std::endl;
+            return nullptr;
+        }
+        faceIndex = decodedFaceIndex.get();
+        vertsIndex = decodedVertsIndex.get();
+    }
+    // the constructor reads the indices without checking them
+    uint64_t numFaceVerts = 0;
+    bool valid = true;
+    for (uint32_t i = 0; i < header->numFaces; ++i) {
+        valid &= faceIndex[i] >= 3;
+        numFaceVerts += faceIndex[i];
+    }
+    valid &= numFaceVerts == header->vertsIndexArraySize;
+    for (uint32_t i = 0; i < header->vertsIndexArraySize; ++i)
+        valid &= vertsIndex[i] < header->vertsArraySize;
+    if (!valid) {
+        std::cerr << "Error: " << file << " is corrupted" << std::endl;
+        return nullptr;
+    }
+
+    return new TriangleMesh(o2w, header->numFaces, faceIndex, vertsIndex,
+        (const Vec3f*)(mapped.data + header->vertsOffset),
+        (const Vec3f*)(mapped.data + header->normalsOffset),
+        (const Vec2f*)(mapped.data + header->stOffset));
+}
+
 TriangleMesh* loadPolyMeshFromFile(const char *file, const Matrix44f &o2w)
 {
+    const char *ext = strrchr(file, '.');
+    if (ext && strcmp(ext, ".geob") == 0) return loadPolyMeshFromBinaryFile(file, o2w);
     std::ifstream ifs;
     try {
         ifs.open(file);
@@ -369,13 +752,16 @@ TriangleMesh* loadPolyMeshFromFile(const char *file, const Matrix44f &o2w)
         for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
             ss >> normals[i].x >> normals[i].y >> normals[i].z;
         }
+        // a file without normals (and texture coordinates) gets smooth normals
+        if (ss.fail()) normals.reset();
         // reading st coordinates
         std::unique_ptr<Vec2f []> st(new Vec2f[vertsIndexArraySize]);
         for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
             ss >> st[i].x >> st[i].y;
         }
+        if (ss.fail()) st.reset();
         
-        return new TriangleMesh(o2w, numFaces, faceIndex, vertsIndex, verts, normals, st);
+        return new TriangleMesh(o2w, numFaces, faceIndex.get(), vertsIndex.get(), verts.get(), normals.get(), st.get());
     }
     catch (...) {
         ifs.close();
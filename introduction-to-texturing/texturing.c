@@ -11,6 +11,13 @@
 #include <assert.h>
 #include <math.h> // For fminf and fmaxf
 
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
 struct point2i { int x, y; };
 struct point2f { float x, y; };
 struct point3f { float x, y, z; };
@@ -18,10 +25,33 @@ struct normal3f { float x, y, z; };
 struct color3f { float x, y, z; };
 struct texcoord2f { float s, t; };
 
+// Textures are stored as a chain of mip levels, each half the size of the previous one, down to
+// 1x1. Texels are stored in tiles of TEXTURE_TILE_SIZE x TEXTURE_TILE_SIZE texels, so that the
+// neighboring texels read by the bilinear filter, vertically as well as horizontally, are close
+// to each other in memory.
+#define TEXTURE_TILE_SIZE 4
+#define MAX_MIP_LEVELS 16
+
+enum texture_filter {
+	TEXTURE_FILTER_NEAREST,    // nearest texel of the full resolution level
+	TEXTURE_FILTER_BILINEAR,   // 4 texels of the full resolution level
+	TEXTURE_FILTER_TRILINEAR   // 4 texels of the two levels closest to the pixel footprint
+};
+
+struct mip_level {
+	int width, height;
+	int tiles_x; // number of tiles in a row
+	unsigned char* data; // RGB, tiled
+};
+
 struct image {
 	int width;
 	int height;
 	unsigned char* data;
+	enum texture_filter filter;
+	int num_levels;
+	struct mip_level levels[MAX_MIP_LEVELS];
+	unsigned char* mip_data; // storage of all the levels
 };
 
 struct shader {
@@ -78,6 +108,58 @@ static inline void point_mat_mult(const struct point3f* const p, const float* m,
     xp->z = z;
 }
 
+static inline int texel_offset(const struct mip_level* level, int x, int y) {
+	return (((y / TEXTURE_TILE_SIZE) * level->tiles_x + x / TEXTURE_TILE_SIZE) * TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE +
+		(y % TEXTURE_TILE_SIZE) * TEXTURE_TILE_SIZE + x % TEXTURE_TILE_SIZE) * 3;
+}
+
+// Allocate the mip levels, copy the image to the first one, and compute each of the others by
+// averaging blocks of 2x2 texels of the previous level.
+static void build_mip_chain(struct image* const image) {
+	size_t total_size = 0;
+	int width = image->width, height = image->height, num_levels = 0;
+	while (num_levels < MAX_MIP_LEVELS) {
+		struct mip_level* level = &image->levels[num_levels++];
+		level->width = width;
+		level->height = height;
+		level->tiles_x = (width + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+		int tiles_y = (height + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+		total_size += (size_t)level->tiles_x * tiles_y * TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE * 3;
+		if (width == 1 && height == 1) break;
+		width = max(1, width / 2);
+		height = max(1, height / 2);
+	}
+
+	image->mip_data = (unsigned char*)calloc(total_size, 1);
+	image->num_levels = num_levels;
+	unsigned char* data = image->mip_data;
+	for (int l = 0; l < num_levels; ++l) {
+		struct mip_level* level = &image->levels[l];
+		level->data = data;
+		data += (size_t)level->tiles_x * ((level->height + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE) *
+			TEXTURE_TILE_SIZE * TEXTURE_TILE_SIZE * 3;
+		for (int y = 0; y < level->height; ++y) {
+			for (int x = 0; x < level->width; ++x) {
+				unsigned char* texel = level->data + texel_offset(level, x, y);
+				if (l == 0) {
+					memcpy(texel, image->data + (y * image->width + x) * 3, 3);
+					continue;
+				}
+				const struct mip_level* prev = &image->levels[l - 1];
+				int x0 = 2 * x, x1 = min(2 * x + 1, prev->width - 1);
+				int y0 = 2 * y, y1 = min(2 * y + 1, prev->height - 1);
+				const unsigned char* t00 = prev->data + texel_offset(prev, x0, y0);
+				const unsigned char* t10 = prev->data + texel_offset(prev, x1, y0);
+				const unsigned char* t01 = prev->data + texel_offset(prev, x0, y1);
+				const unsigned char* t11 = prev->data + texel_offset(prev, x1, y1);
+				for (int c = 0; c < 3; ++c) {
+					texel[c] = (t00[c] + t10[c] + t01[c] + t11[c] + 2) / 4;
+				}
+			}
+		}
+	}
+}
+
 void set_texture(struct image* const image, const char* filename) {
 	FILE* file = fopen(filename, "rb");
 	char format[3];
@@ -89,6 +171,8 @@ void set_texture(struct image* const image, const char* filename) {
 	image->data = (unsigned char*)malloc(image->width * image->height * 3);
 	fread(image->data, 3, image->width * image->height, file);
 	fclose(file);
+	image->filter = TEXTURE_FILTER_TRILINEAR;
+	build_mip_chain(image);
 }
 
 static void create_mesh(struct context* const context, struct mesh* const mesh) {
@@ -153,6 +237,7 @@ static void destroy_mesh(struct mesh* mesh) {
 		if (mesh->shader->color.image_ptr->data != NULL) {
 			free(mesh->shader->color.image_ptr->data);
 		}
+		free(mesh->shader->color.image_ptr->mip_data);
 		free(mesh->shader->color.image_ptr);
 	}
 	free(mesh);
@@ -237,19 +322,60 @@ static inline float edge(const struct point3f* const a, const struct point3f* co
 	return (test->x - a->x) * (b->y - a->y) - (test->y - a->y) * (b->x - a->x);
 }
 
-static void shade(const struct shader* shader, struct texcoord2f st, struct color3f* ci) {
+// Accumulate the texels of level surrounding (s, t) weighted by the bilinear filter weights
+// times weight. The texture repeats in both directions.
+static inline void sample_bilinear(const struct mip_level* level, float s, float t, float weight, float* rgb) {
+	float x = s * level->width - 0.5f;
+	float y = t * level->height - 0.5f;
+	float fx = floorf(x), fy = floorf(y);
+	float tx = x - fx, ty = y - fy;
+	int x0 = (int)fx % level->width, y0 = (int)fy % level->height;
+	if (x0 < 0) x0 += level->width;
+	if (y0 < 0) y0 += level->height;
+	int x1 = (x0 + 1) % level->width, y1 = (y0 + 1) % level->height;
+	const unsigned char* t00 = level->data + texel_offset(level, x0, y0);
+	const unsigned char* t10 = level->data + texel_offset(level, x1, y0);
+	const unsigned char* t01 = level->data + texel_offset(level, x0, y1);
+	const unsigned char* t11 = level->data + texel_offset(level, x1, y1);
+	float w00 = (1 - tx) * (1 - ty) * weight, w10 = tx * (1 - ty) * weight;
+	float w01 = (1 - tx) * ty * weight, w11 = tx * ty * weight;
+	for (int c = 0; c < 3; ++c) {
+		rgb[c] += t00[c] * w00 + t10[c] * w10 + t01[c] * w01 + t11[c] * w11;
+	}
+}
+
+// lod is the mip level matching the pixel footprint (see quad_lod).
+static void shade(const struct shader* shader, struct texcoord2f st, float lod, struct color3f* ci) {
 	if (shader->color.image_ptr != NULL) {
 		const struct image* const image = shader->color.image_ptr;
 		float s = st.s - floor(st.s);
 		float t = ceil(st.t) - st.t;
-		struct point2i texel;
-		texel.x = (int)fminf(s * image->width, image->width - 1);
-		texel.y = (int)fminf(t * image->height, image->height - 1);
-		unsigned char texel_color[3];
-		memcpy(texel_color, image->data + (texel.y * image->width + texel.x) * 3, 3);
-		ci->x = texel_color[0] / 255.f;
-		ci->y = texel_color[1] / 255.f;
-		ci->z = texel_color[2] / 255.f;
+		const struct mip_level* level = &image->levels[0];
+		if (image->filter == TEXTURE_FILTER_NEAREST) {
+			struct point2i texel;
+			texel.x = (int)fminf(s * level->width, level->width - 1);
+			texel.y = (int)fminf(t * level->height, level->height - 1);
+			unsigned char texel_color[3];
+			memcpy(texel_color, level->data + texel_offset(level, texel.x, texel.y), 3);
+			ci->x = texel_color[0] / 255.f;
+			ci->y = texel_color[1] / 255.f;
+			ci->z = texel_color[2] / 255.f;
+			return;
+		}
+		float rgb[3] = {0, 0, 0};
+		if (image->filter == TEXTURE_FILTER_BILINEAR || lod <= 0 || image->num_levels == 1) {
+			sample_bilinear(level, s, t, 1, rgb);
+		}
+		else {
+			lod = fminf(lod, image->num_levels - 1);
+			int l = min((int)lod, image->num_levels - 2);
+			float f = lod - l;
+			sample_bilinear(&image->levels[l], s, t, 1 - f, rgb);
+			if (f > 0) sample_bilinear(&image->levels[l + 1], s, t, f, rgb);
+		}
+		ci->x = rgb[0] / 255.f;
+		ci->y = rgb[1] / 255.f;
+		ci->z = rgb[2] / 255.f;
 		return;
 	}
 	ci->x = shader->color.constant_value.x;
@@ -257,43 +383,79 @@ static void shade(const struct shader* shader, struct texcoord2f st, struct colo
 	ci->z = shader->color.constant_value.z;
 }
 
+// The mip level to use for a quad of 2x2 pixels, from the differences between the texture
+// coordinates of horizontally and vertically adjacent pixels. st holds the texture coordinates
+// at the center of the top-left, top-right and bottom-left pixels.
+static inline float quad_lod(const struct shader* shader, const struct texcoord2f* st) {
+	const struct image* const image = shader->color.image_ptr;
+	if (image == NULL || image->filter != TEXTURE_FILTER_TRILINEAR) return 0;
+	float dsdx = (st[1].s - st[0].s) * image->width, dtdx = (st[1].t - st[0].t) * image->height;
+	float dsdy = (st[2].s - st[0].s) * image->width, dtdy = (st[2].t - st[0].t) * image->height;
+	float rho2 = fmaxf(dsdx * dsdx + dtdx * dtdx, dsdy * dsdy + dtdy * dtdy);
+	float lod = 0.5f * log2f(rho2);
+	// Also catches NaNs, from pixels of the quad lying far outside of the triangle
+	return lod > 0 ? lod : 0;
+}
+
 static inline void rasterize(int x0, int y0, int x1, int y1, 
 							 const struct point3f* const p0, const struct point3f* const p1, const struct point3f* const p2, 
 							 const struct texcoord2f* const st0, const struct texcoord2f* const st1, const struct texcoord2f* const st2,
 							 const struct mesh* const mesh,
 							 struct context* context) {
 	float area = edge(p0, p1, p2);
-	float rcp_num_samples = 1.f / num_samples;
 	struct point3f pixel, sample;
-	pixel.y = y0;
-	for (int j = y0, row = y0 * context->extent.width; j <= y1; ++j, pixel.y += 1, row += context->extent.width) {
-		pixel.x = x0;
-		for (int i = x0, index = row + x0; i <= x1; ++i, pixel.x += 1, ++index) {
-			for (int k = 0; k < num_samples; ++k) {
-				sample.x = pixel.x + sample_pattern[k].x;
-				sample.y = pixel.y + sample_pattern[k].y;
-				
-				float w0 = edge(p1, p2, &sample);
-				float w1 = edge(p2, p0, &sample);
-				float w2 = edge(p0, p1, &sample);
-				
-				if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
-					w0 /= area, w1 /= area, w2 /= area;
-					float one_over_z = w0 / p0->z + w1 / p1->z + w2 / p2->z;
-					float z = 1 / one_over_z;
-
-					if (z < context->depth_buffer[index * num_samples + k]) {
-						context->depth_buffer[index * num_samples + k] = z;
-
-						struct texcoord2f st;
-						st.s = st0->s * w0 + st1->s * w1 + st2->s * w2;
-						st.t = st0->t * w0 + st1->t * w1 + st2->t * w2;
-						st.s *= z;
-						st.t *= z;
-						shade(mesh->shader, st, &context->color_buffer[index * num_samples + k]);
+	// Pixels are processed by quads of 2x2 pixels, aligned on even coordinates. The texture
+	// coordinates are computed at the center of the pixels of the quad, covered or not, to
+	// select the mip level.
+	x0 &= ~1;
+	y0 &= ~1;
+	for (int qy = y0; qy <= y1; qy += 2) {
+		for (int qx = x0; qx <= x1; qx += 2) {
+			struct texcoord2f quad_st[3];
+			for (int k = 0; k < 3; ++k) {
+				pixel.x = qx + (k & 1) + 0.5f;
+				pixel.y = qy + (k >> 1) + 0.5f;
+				float w0 = edge(p1, p2, &pixel) / area;
+				float w1 = edge(p2, p0, &pixel) / area;
+				float w2 = edge(p0, p1, &pixel) / area;
+				float z = 1 / (w0 / p0->z + w1 / p1->z + w2 / p2->z);
+				quad_st[k].s = (st0->s * w0 + st1->s * w1 + st2->s * w2) * z;
+				quad_st[k].t = (st0->t * w0 + st1->t * w1 + st2->t * w2) * z;
+			}
+			float lod = quad_lod(mesh->shader, quad_st);
+
+			for (int j = qy; j <= min(qy + 1, y1); ++j) {
+				pixel.y = j;
+				for (int i = qx; i <= min(qx + 1, x1); ++i) {
+					pixel.x = i;
+					int index = j * context->extent.width + i;
+					for (int k = 0; k < num_samples; ++k) {
+						sample.x = pixel.x + sample_pattern[k].x;
+						sample.y = pixel.y + sample_pattern[k].y;
+						
+						float w0 = edge(p1, p2, &sample);
+						float w1 = edge(p2, p0, &sample);
+						float w2 = edge(p0, p1, &sample);
+						
+						if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
+							w0 /= area, w1 /= area, w2 /= area;
+							float one_over_z = w0 / p0->z + w1 / p1->z + w2 / p2->z;
+							float z = 1 / one_over_z;
+
+							if (z < context->depth_buffer[index * num_samples + k]) {
+								context->depth_buffer[index * num_samples + k] = z;
+
+								struct texcoord2f st;
+								st.s = st0->s * w0 + st1->s * w1 + st2->s * w2;
+								st.t = st0->t * w0 + st1->t * w1 + st2->t * w2;
+								st.s *= z;
+								st.t *= z;
+								shade(mesh->shader, st, lod, &context->color_buffer[index * num_samples + k]);
+							}
+						}
 					}
 				}
-			}		
+			}
 		}
 	}
 }
@@ -321,7 +483,7 @@ void render(struct context* context, int num_meshes, const struct mesh** const m
 			x0 = max(0, (int)bbox[0]);
 			y0 = max(0, (int)bbox[1]);
 			x1 = min(context->extent.width - 1, (int)bbox[2]);
-			y1 = min(context->extent.width - 1, (int)bbox[3]);
+			y1 = min(context->extent.height - 1, (int)bbox[3]);
 			
 			struct texcoord2f st0 = mesh->st.coords[sti[0]];
 			struct texcoord2f st1 = mesh->st.coords[sti[1]];
@@ -7,7 +7,7 @@
 //
 // c++ -O3 -o mcintegration mcintegration.cpp -std=c++11
 //
-// Run with: ./mcintegration. Open the file ./out.png in Photoshop or any program
+// Run with: ./mcintegration [uniform|stratified|sobol] [npasses]. Open the file ./mcbeth.ppm in Photoshop or any program
 // reading PPM files.
 //[/compile]
 //[ignore]
@@ -32,6 +32,9 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
 #include <signal.h>
 
 const float colorMatchingFunc[3][72] =
@@ -85,18 +88,85 @@ void XYZtoRGB(const float &X, const float &Y, const float &Z, float &r, float &g
 constexpr float lambdaMin = 380, lambdaMax = 730;
 constexpr uint32_t nbins = 36;
 constexpr uint32_t N = 32;
+constexpr uint32_t npatches = 24;
  
 inline float linerp(const float *f, const short &i, const float &t, const int &max) 
 { return f[i] * (1 - t) + f[std::min(max, i + 1)] * t; } 
 
 // [comment]
-// Monte Carlo integration of the McBeth chart spectrum profiles.
+// The three color matching functions are sampled at the same wavelengths, thus share the same
+// interpolation weights. We interleave them so that one lookup returns (xbar, ybar, zbar, ybar):
+// the lerp is then done on 4 lanes at once, which the compiler turns into a single SIMD operation.
+// The last lane is used to accumulate the normalization factor S (the integral of ybar).
 // [/comment]
-void monteCarloIntegration(const short &curveIndex, float &X, float &Y, float &Z) 
+alignas(16) float colorMatchingFunc4[2 * nbins][4];
+
+void interleaveColorMatchingFunc()
+{
+    for (uint32_t i = 0; i < 2 * nbins; ++i) {
+        colorMatchingFunc4[i][0] = colorMatchingFunc[0][i];
+        colorMatchingFunc4[i][1] = colorMatchingFunc[1][i];
+        colorMatchingFunc4[i][2] = colorMatchingFunc[2][i];
+        colorMatchingFunc4[i][3] = colorMatchingFunc[1][i];
+    }
+}
+
+// [comment]
+// How the wavelengths are chosen. Uniform is plain Monte Carlo (drand48). Stratified divides
+// [lambdaMin, lambdaMax] into N strata and places one random sample in each of them. Sobol uses
+// the first dimension of the Sobol sequence (the base 2 radical inverse) randomized with a
+// per-patch XOR scramble, so that successive passes keep extending the same low-discrepancy
+// sequence rather than starting a new one.
+// [/comment]
+enum SamplingStrategy { kUniform = 0, kStratified, kSobol };
+
+inline float sobol(uint32_t i, const uint32_t &scramble)
 {
-    float S = 0; // sum, used to normalize XYZ values
-    for (int i = 0; i < N; ++i) { 
-        float lambda = drand48() * (lambdaMax - lambdaMin); 
+    i = (i << 16) | (i >> 16);
+    i = ((i & 0x00ff00ff) << 8) | ((i & 0xff00ff00) >> 8);
+    i = ((i & 0x0f0f0f0f) << 4) | ((i & 0xf0f0f0f0) >> 4);
+    i = ((i & 0x33333333) << 2) | ((i & 0xcccccccc) >> 2);
+    i = ((i & 0x55555555) << 1) | ((i & 0xaaaaaaaa) >> 1);
+    i ^= scramble;
+    // keep 24 bits so that the result is strictly less than 1 in single precision
+    return (i >> 8) * (1.f / (1 << 24));
+}
+
+void generateSamples(const SamplingStrategy &strategy, const uint32_t &pass, const uint32_t &scramble, float *u)
+{
+    switch (strategy) {
+        default:
+        case kUniform:
+            for (uint32_t i = 0; i < N; ++i) u[i] = drand48();
+            break;
+        case kStratified:
+            for (uint32_t i = 0; i < N; ++i) u[i] = (i + drand48()) / N;
+            break;
+        case kSobol:
+            for (uint32_t i = 0; i < N; ++i) u[i] = sobol(pass * N + i, scramble);
+            break;
+    }
+}
+
+// [comment]
+// Running sums of the Monte Carlo estimator for one patch. They are accumulated over all the
+// passes so that the estimate is progressively refined. Doubles are used because the number of
+// samples grows without bound.
+// [/comment]
+struct SpectralSums
+{
+    double X = 0, Y = 0, Z = 0, S = 0;
+};
+
+// [comment]
+// Monte Carlo integration of the McBeth chart spectrum profiles. The N samples of a pass
+// are given as numbers in [0,1) which are remapped to wavelengths in [lambdaMin, lambdaMax].
+// [/comment]
+void monteCarloIntegration(const short &curveIndex, const float *u, SpectralSums &sums) 
+{
+    alignas(16) float sum[4] = {0, 0, 0, 0}; // X, Y, Z, S
+    for (uint32_t i = 0; i < N; ++i) { 
+        float lambda = u[i] * (lambdaMax - lambdaMin); 
         float b = lambda / 10; 
         short j = (short)b; 
         float t = b - j; 
@@ -105,84 +175,188 @@ void monteCarloIntegration(const short &curveIndex, float &X, float &Y, float &Z
         b = lambda / 5; 
         j = (short)b; 
         t = b - j; 
-        X += linerp(colorMatchingFunc[0], j, t, 2 * nbins - 1) * fx;
-        Y += linerp(colorMatchingFunc[1], j, t, 2 * nbins - 1) * fx;
-        Z += linerp(colorMatchingFunc[2], j, t, 2 * nbins - 1) * fx;
-        S += linerp(colorMatchingFunc[1], j, t, 2 * nbins - 1);
+        const float *c0 = colorMatchingFunc4[j];
+        const float *c1 = colorMatchingFunc4[std::min(2 * (int)nbins - 1, j + 1)];
+        const float w[4] = {fx, fx, fx, 1};
+        for (int k = 0; k < 4; ++k) {
+            sum[k] += (c0[k] * (1 - t) + c1[k] * t) * w[k];
+        }
     } 
-    // sum, normalization factor
-    S *= (lambdaMax - lambdaMin) / N; 
-    // integral = (b-a) * 1/N * sum_{i=0}^{N-1} f(X_i) and normalize
-    X *= (lambdaMax - lambdaMin) / N / S; 
-    Y *= (lambdaMax - lambdaMin) / N / S; 
-    Z *= (lambdaMax - lambdaMin) / N / S; 
+    sums.X += sum[0];
+    sums.Y += sum[1];
+    sums.Z += sum[2];
+    sums.S += sum[3];
+}
+
+// [comment]
+// The estimate is: integral = (b-a) * 1/n * sum_{i=0}^{n-1} f(X_i), normalized by the integral
+// of ybar (computed with the same samples). The factor (b-a)/n cancels out.
+// [/comment]
+void estimateXYZ(const SpectralSums &sums, float &X, float &Y, float &Z)
+{
+    X = sums.X / sums.S;
+    Y = sums.Y / sums.S;
+    Z = sums.Z / sums.S;
+}
+
+// [comment]
+// Deterministic conversion of the spectrum to XYZ, the same as in colors/mcbeth.cpp. We use
+// it as a reference to check the result of the Monte Carlo integration. Note that this is a
+// sum over the 36 tabulated wavelengths while Monte Carlo integrates the interpolated curves,
+// so the error eventually levels off at the (small) difference between the two.
+// [/comment]
+void spectrumToXYZ(int colorIndex, float& X, float& Y, float& Z)
+{
+    float S = 0;
+    for (int i = 0; i < 36; ++i) {
+        X += colorMatchingFunc[0][i * 2] * spectralData[colorIndex][i];
+        Y += colorMatchingFunc[1][i * 2] * spectralData[colorIndex][i];
+        Z += colorMatchingFunc[2][i * 2] * spectralData[colorIndex][i];
+        S += colorMatchingFunc[1][i * 2];
+    }
+    X /= S;
+    Y /= S;
+    Z /= S;
+}
+
+// [comment]
+// Exact integral of the interpolated curves (what Monte Carlo actually converges to). On each 5 nm
+// interval both the spectrum and the color matching functions are linear, so their product is a
+// quadratic which Simpson's rule integrates exactly. The interval width cancels out in the ratio.
+// [/comment]
+void exactXYZ(int colorIndex, float& X, float& Y, float& Z)
+{
+    auto spectrum = [&] (float k) { return linerp(spectralData[colorIndex], (short)(k / 2), k / 2 - (short)(k / 2), nbins - 1); };
+    double sum[4] = {0, 0, 0, 0};
+    for (uint32_t k = 0; k < 2 * nbins - 2; ++k) {
+        float f0 = spectrum(k), fm = spectrum(k + 0.5f), f1 = spectrum(k + 1);
+        for (int c = 0; c < 4; ++c) {
+            float c0 = colorMatchingFunc4[k][c], c1 = colorMatchingFunc4[k + 1][c];
+            float w0 = (c < 3) ? f0 : 1, wm = (c < 3) ? fm : 1, w1 = (c < 3) ? f1 : 1;
+            sum[c] += c0 * w0 + 4 * 0.5f * (c0 + c1) * wm + c1 * w1;
+        }
+    }
+    X = sum[0] / sum[3];
+    Y = sum[1] / sum[3];
+    Z = sum[2] / sum[3];
 }
 
-float *pixels = nullptr;
 constexpr uint32_t squareSize = 64;
 constexpr uint32_t width = squareSize * 6, height = squareSize * 4; // 6 columns, 4 rows
+float patchColors[npatches][3];
 uint32_t npasses = 0;
 
 // [comment]
-// The program has been interrupted (ctrl+c), save the result to file
+// Every pixel of a square integrates the same curve, so we only store one color per patch
+// and expand the patches into an image when it's saved.
 // [/comment]
-void handler(int s) 
-{ 
+void saveImage()
+{
     printf("Saving image after %d passes\n", npasses); 
     std::ofstream ofs; 
-    ofs.open("./mcbeth.ppm"); 
+    ofs.open("./mcbeth.ppm", std::ios::binary); 
     ofs << "P6\n" << width << " " << height << "\n255\n"; 
-    for (uint32_t i = 0; i < width * height; ++i) { 
-        unsigned char r, g, b; 
-        r = (unsigned char)(std::min(1.f, pixels[i * 3]) * 255);
-        g = (unsigned char)(std::min(1.f, pixels[i * 3 + 1]) * 255);
-        b = (unsigned char)(std::min(1.f, pixels[i * 3 + 2]) * 255);
-        ofs << r << g << b; 
+    for (uint32_t y = 0; y < height; ++y) { 
+        short row = (short)(y / squareSize); 
+        for (uint32_t x = 0; x < width; ++x) { 
+            short column = (short)(x / squareSize); 
+            const float *c = patchColors[row * 6 + column];
+            unsigned char r, g, b; 
+            r = (unsigned char)(std::min(1.f, c[0]) * 255);
+            g = (unsigned char)(std::min(1.f, c[1]) * 255);
+            b = (unsigned char)(std::min(1.f, c[2]) * 255);
+            ofs << r << g << b; 
+        }
     } 
     ofs.close(); 
+}
+
+// [comment]
+// The program has been interrupted (ctrl+c), save the result to file
+// [/comment]
+void handler(int s) 
+{ 
+    saveImage();
     exit(0); 
 } 
  
+// [comment]
+// Usage: ./mcintegration [uniform|stratified|sobol] [npasses]. If npasses is not
+// specified (or 0) the program runs until it's interrupted.
+// [/comment]
 int main(int argc, char **argv) 
 {
-    float *buffer = new float[3 * width * height];
-    memset(buffer, 0x0, sizeof(float) * width * height * 3);
-    pixels = new float[3 * width * height];
+    SamplingStrategy strategy = kSobol;
+    if (argc > 1) {
+        if (!strcmp(argv[1], "uniform")) strategy = kUniform;
+        else if (!strcmp(argv[1], "stratified")) strategy = kStratified;
+        else if (!strcmp(argv[1], "sobol")) strategy = kSobol;
+        else {
+            fprintf(stderr, "Unknown sampling strategy %s (uniform, stratified or sobol)\n", argv[1]);
+            return 1;
+        }
+    }
+    uint32_t maxpasses = (argc > 2) ? atoi(argv[2]) : 0;
+
+    interleaveColorMatchingFunc();
+
+    float reference[npatches][3], exact[npatches][3];
+    uint32_t scrambles[npatches];
+    SpectralSums sums[npatches];
+    for (uint32_t i = 0; i < npatches; ++i) {
+        reference[i][0] = reference[i][1] = reference[i][2] = 0;
+        spectrumToXYZ(i, reference[i][0], reference[i][1], reference[i][2]);
+        exactXYZ(i, exact[i][0], exact[i][1], exact[i][2]);
+        scrambles[i] = (uint32_t)(drand48() * 4294967296.0);
+    }
+
     struct sigaction sigIntHandler;
     sigIntHandler.sa_handler = handler; 
     sigemptyset(&sigIntHandler.sa_mask); 
     sigIntHandler.sa_flags = 0; 
     sigaction(SIGINT, &sigIntHandler, NULL); 
-    uint32_t pixIndex;
+    float prevError = 0;
     // [comment]
     // Type ctrl+c in the shell where the program is running to stop it.
     // [/comment]
-    while (1) { 
-        for (int y = 0, pixIndex = 0; y < height; ++y) { 
-            short row = (short)(y / squareSize); 
-            for (int x = 0; x < width; ++x, pixIndex++) { 
-                short column = (short)(x / squareSize); 
-                // compute each pixel of the square
-                float X = 0, Y = 0, Z = 0; 
-                monteCarloIntegration(row * 6 + column, X, Y, Z); 
-                float r, g, b; 
-                XYZtoRGB(X, Y, Z, r, g, b); 
-                buffer[pixIndex * 3] += r;
-                buffer[pixIndex * 3 + 1] += g;
-                buffer[pixIndex * 3 + 2] += b;
-            } 
+    while (maxpasses == 0 || npasses < maxpasses) { 
+        double error = 0, errorExact = 0;
+        for (uint32_t i = 0; i < npatches; ++i) {
+            alignas(16) float u[N];
+            generateSamples(strategy, npasses, scrambles[i], u);
+            monteCarloIntegration(i, u, sums[i]);
+            float xyz[3]; 
+            estimateXYZ(sums[i], xyz[0], xyz[1], xyz[2]);
+            for (int c = 0; c < 3; ++c) {
+                error += (xyz[c] - reference[i][c]) * (xyz[c] - reference[i][c]);
+                errorExact += (xyz[c] - exact[i][c]) * (xyz[c] - exact[i][c]);
+            }
+            float r, g, b; 
+            XYZtoRGB(xyz[0], xyz[1], xyz[2], r, g, b); 
+            static float gamma = 1 / 2.2;
+            patchColors[i][0] = powf(r, gamma);
+            patchColors[i][1] = powf(g, gamma);
+            patchColors[i][2] = powf(b, gamma);
         } 
         npasses++;
-        static float gamma = 1 / 2.2;
-        for (uint32_t i = 0; i < width * height; ++i) { 
-            pixels[i * 3] = powf(buffer[i * 3] / npasses, gamma);
-            pixels[i * 3 + 1] = powf(buffer[i * 3 + 1] / npasses, gamma);
-            pixels[i * 3 + 2] = powf(buffer[i * 3 + 2] / npasses, gamma);
-        } 
-        printf("npasses %3d (num samples %5d)\n", npasses, npasses * N);
+        float rmsError = sqrt(error / (3 * npatches));
+        float rmsErrorExact = sqrt(errorExact / (3 * npatches));
+        printf("npasses %3d (num samples %5d) rms error %f (exact %e)", npasses, npasses * N, rmsError, rmsErrorExact);
+        // [comment]
+        // Each time the number of samples doubles, estimate the convergence rate k such that
+        // error ~ n^-k, using the exact integral as a reference. Expect k = 0.5 for uniform and
+        // stratified sampling (each pass is stratified independently, which lowers the error but
+        // not the rate) and close to 1 for Sobol.
+        // [/comment]
+        if ((npasses & (npasses - 1)) == 0) {
+            if (npasses > 1 && rmsErrorExact > 0)
+                printf(" convergence n^%.2f", -log2(prevError / rmsErrorExact));
+            prevError = rmsErrorExact;
+        }
+        printf("\n");
     } 
-    delete [] pixels; 
-    delete [] buffer;
+
+    saveImage();
 
     return 0;
 }
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <iostream>
 #include <fstream>
+#include <iterator>
 
 #include <math.h>
 #include <cmath>
@@ -17,6 +18,21 @@
 #include <string>
 #include <sstream>
 #include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 uint32_t image_width = 640;
 uint32_t image_height = 480;
@@ -84,39 +100,34 @@ struct FaceVertex {
 	}
 };
 
-void ParseFaceVertex(const std::string& tuple, FaceVertex& face_vertex) {
-	std::istringstream stream(tuple);
-	std::string part;
-
-	std::getline(stream, part, '/');
-    assert(!part.empty());
-	face_vertex.vertex_index = std::stoi(part) - 1;
-
-    if (std::getline(stream, part, '/') && !part.empty()) {
-        face_vertex.st_coord_index = std::stoi(part) - 1;
-    }
-
-    if (std::getline(stream, part, '/') && !part.empty()) {
-        face_vertex.normal_index = std::stoi(part) - 1;
-    }
-}
-
-void ProcessFace(const std::vector<std::string>& tuples, 
-				 std::vector<FaceVertex>& face_vertices) {
-	assert(tuples.size() == 3);
-	for (const auto& tuple : tuples) {
-		FaceVertex face_vertex;
-		ParseFaceVertex(tuple, face_vertex);
-		face_vertices.push_back(face_vertex);
-	}
-}
-
 std::vector<Vec3f> vertices, normals;
 std::vector<Vec2f> tex_coordinates;
 
+/**
+ * The parameters of a material as defined in an MTL file. OBJ files reference
+ * one or more MTL files with "mtllib", and the "usemtl" lines select the
+ * material of the faces that follow. We only read the parameters that are
+ * common to all exporters.
+ */
+struct Material {
+	std::string name;
+	Vec3f ambient{1};          // Ka
+	Vec3f diffuse{0.8f};       // Kd
+	Vec3f specular{0};         // Ks
+	Vec3f emissive{0};         // Ke
+	float shininess{0};        // Ns
+	float ior{1};              // Ni
+	float opacity{1};          // d (or 1 - Tr)
+	int illum{2};
+	std::string diffuse_map;   // map_Kd
+};
+
+std::vector<Material> materials;
+
 struct FaceGroup {
 	std::vector<FaceVertex> face_vertices;
 	std::string name;
+	int material{-1};  // index in materials, -1 if the faces have none
 };
 
 /**
@@ -131,54 +142,752 @@ struct FaceGroup {
  */
 std::deque<FaceGroup> face_groups;
 
-void ParseObj(const char* file) {
-	std::ifstream ifs(file);
-	std::string line;
-	face_groups.emplace_back();
-	FaceGroup* cur_face_group = &face_groups.back();
-	while (std::getline(ifs, line)) {
-		std::istringstream stream(line);
-		std::string type;
-		stream >> type;
-		if (type == "v") {
+/**
+ * The file is mapped in memory and split into chunks that end on a line
+ * boundary. The chunks are parsed in parallel with the hand-written number
+ * parsers below, which only accept what OBJ exporters write but are an order
+ * of magnitude faster than going through streams. The chunks are then merged
+ * in order. This is where relative (negative) indices, which refer to the
+ * elements declared before the face, are resolved, and where the face groups
+ * are rebuilt: a chunk doesn't know whether the group it starts in already
+ * has faces, so it only records where the "g" lines and the first "v" line
+ * following some faces are, and the merge applies the same rules as if the
+ * file was read line by line.
+ */
+inline const char* SkipSpaces(const char* p, const char* end) {
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+	return p;
+}
+
+inline bool IsDigit(char c) { return static_cast<unsigned>(c - '0') < 10; }
+
+// Parse [+-]digits[.digits][(e|E)[+-]digits]. Return the first character after
+// the number, or p if there's no number. Only the first 19 significant digits
+// are used, which is plenty for a float.
+inline const char* ParseFloat(const char* p, const char* end, float& value) {
+	static const double powers_of_ten[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	const char* start = p;
+	bool negative = false;
+	if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+	uint64_t mantissa = 0;
+	int num_digits = 0, exponent = 0;
+	const char* digits = p;
+	for (; p < end && IsDigit(*p); ++p) {
+		if (num_digits < 19) {
+			mantissa = mantissa * 10 + (*p - '0');
+			num_digits += mantissa != 0;
+		}
+		else ++exponent;
+	}
+	bool has_digits = p != digits;
+	if (p < end && *p == '.') {
+		digits = ++p;
+		for (; p < end && IsDigit(*p); ++p) {
+			if (num_digits < 19) {
+				mantissa = mantissa * 10 + (*p - '0');
+				num_digits += mantissa != 0;
+				--exponent;
+			}
+		}
+		has_digits |= p != digits;
+	}
+	if (!has_digits) return start;
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		const char* q = p + 1;
+		bool negative_exponent = false;
+		if (q < end && (*q == '-' || *q == '+')) negative_exponent = *q++ == '-';
+		int e = 0;
+		for (digits = q; q < end && IsDigit(*q); ++q) {
+			if (e < 10000) e = e * 10 + (*q - '0');
+		}
+		if (q != digits) {
+			exponent += negative_exponent ? -e : e;
+			p = q;
+		}
+	}
+	double d = static_cast<double>(mantissa);
+	if (exponent < 0) d = exponent >= -22 ? d / powers_of_ten[-exponent] : d * std::pow(10.0, exponent);
+	else if (exponent > 0) d = exponent <= 22 ? d * powers_of_ten[exponent] : d * std::pow(10.0, exponent);
+	value = static_cast<float>(negative ? -d : d);
+	return p;
+}
+
+inline const char* ParseInt(const char* p, const char* end, int64_t& value) {
+	const char* start = p;
+	bool negative = false;
+	if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+	const char* digits = p;
+	int64_t v = 0;
+	for (; p < end && IsDigit(*p); ++p) {
+		if (v < (int64_t(1) << 40)) v = v * 10 + (*p - '0');
+	}
+	if (p == digits) return start;
+	value = negative ? -v : v;
+	return p;
+}
+
+struct GroupEvent {
+	size_t face_vertex;  // number of face vertices in the chunk before the event
+	bool vertex_break;   // "v" line following faces
+	bool use_material;   // "usemtl" line (the name is the material's name)
+	std::string name;
+};
+
+// What one thread produces for one chunk of the file. A relative index can
+// refer to an element declared in a previous chunk, so it is stored relative
+// to the first element of the chunk (it may be negative) and its position is
+// recorded so the merge can fix it up.
+struct ObjChunk {
+	std::vector<Vec3f> vertices, normals;
+	std::vector<Vec2f> tex_coordinates;
+	std::vector<FaceVertex> face_vertices;
+	std::vector<GroupEvent> group_events;
+	std::vector<std::pair<size_t, int>> relative_indices;  // face vertex, 0: vertex, 1: st, 2: normal
+	std::vector<std::string> material_libraries;
+	std::vector<std::pair<size_t, uint32_t>> polygons;  // first face vertex and size of the faces with more than 3 vertices
+};
+
+// If the line starts with the keyword followed by a space (or nothing),
+// return what follows, without leading and trailing spaces, and set arg_end.
+// Otherwise return nullptr.
+inline const char* MatchKeyword(const char* p, const char* eol, const char* keyword, const char*& arg_end) {
+	size_t n = strlen(keyword);
+	if (static_cast<size_t>(eol - p) < n || memcmp(p, keyword, n) != 0) return nullptr;
+	p += n;
+	if (p < eol && *p != ' ' && *p != '\t' && *p != '\r') return nullptr;
+	p = SkipSpaces(p, eol);
+	arg_end = eol;
+	while (arg_end > p && (arg_end[-1] == ' ' || arg_end[-1] == '\t' || arg_end[-1] == '\r')) --arg_end;
+	return p;
+}
+
+// Parse one v/vt/vn index of a face vertex. OBJ indices start at 1, negative
+// indices count back from the last element declared so far.
+inline const char* ParseFaceIndex(const char* p, const char* end, size_t count, int& index, bool& relative) {
+	int64_t i = 0;
+	const char* q = ParseInt(p, end, i);
+	if (q == p || i == 0) return p;
+	relative = i < 0;
+	index = static_cast<int>(relative ? static_cast<int64_t>(count) + i : i - 1);
+	return q;
+}
+
+void ParseObjChunk(const char* p, const char* end, ObjChunk& chunk) {
+	std::vector<FaceVertex> face;
+	std::vector<uint8_t> face_relative;
+	bool faces_since_vertex = true;
+	while (p < end) {
+		const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+		if (!eol) eol = end;
+		p = SkipSpaces(p, eol);
+		if (eol - p > 1 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
 			Vec3f v;
-			stream >> v.x >> v.y >> v.z;
-			vertices.push_back(v);
-			if (cur_face_group->face_vertices.size() != 0) [[unlikely]] {
-				face_groups.emplace_back();
-				cur_face_group = &face_groups.back();
+			p = ParseFloat(SkipSpaces(p + 2, eol), eol, v.x);
+			p = ParseFloat(SkipSpaces(p, eol), eol, v.y);
+			p = ParseFloat(SkipSpaces(p, eol), eol, v.z);
+			chunk.vertices.push_back(v);
+			if (faces_since_vertex) [[unlikely]] {
+				chunk.group_events.push_back({chunk.face_vertices.size(), true, false, {}});
+				faces_since_vertex = false;
 			}
 		}
-		else if (type == "vt") {
+		else if (eol - p > 2 && p[0] == 'v' && p[1] == 't' && (p[2] == ' ' || p[2] == '\t')) {
 			Vec2f st;
-			stream >> st.x >> st.y;
-			tex_coordinates.push_back(st);
+			p = ParseFloat(SkipSpaces(p + 3, eol), eol, st.x);
+			p = ParseFloat(SkipSpaces(p, eol), eol, st.y);
+			chunk.tex_coordinates.push_back(st);
 		}
-		else if (type == "vn") {
+		else if (eol - p > 2 && p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t')) {
 			Vec3f n;
-			stream >> n.x >> n.y >> n.z;
-			normals.push_back(n);
+			p = ParseFloat(SkipSpaces(p + 3, eol), eol, n.x);
+			p = ParseFloat(SkipSpaces(p, eol), eol, n.y);
+			p = ParseFloat(SkipSpaces(p, eol), eol, n.z);
+			chunk.normals.push_back(n);
+		}
+		else if (eol - p > 1 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+			const size_t counts[3] = {chunk.vertices.size(), chunk.tex_coordinates.size(), chunk.normals.size()};
+			face.clear();
+			face_relative.clear();
+			p = SkipSpaces(p + 2, eol);
+			while (p < eol && *p != '#') {
+				FaceVertex fv;
+				int* indices[3] = {&fv.vertex_index, &fv.st_coord_index, &fv.normal_index};
+				bool relative[3] = {};
+				const char* q = ParseFaceIndex(p, eol, counts[0], *indices[0], relative[0]);
+				if (q == p) break;  // malformed face, keep the face vertices read so far
+				for (int k = 1; k < 3 && q < eol && *q == '/'; ++k) {
+					const char* r = ParseFaceIndex(q + 1, eol, counts[k], *indices[k], relative[k]);
+					q = r == q + 1 ? q + 1 : r;
+				}
+				face.push_back(fv);
+				face_relative.push_back(relative[0] | relative[1] << 1 | relative[2] << 2);
+				p = SkipSpaces(q, eol);
+			}
+			// Polygons are split into a fan of triangles for now. The positions
+			// of the vertices may be in another chunk, so the polygons that
+			// aren't convex are triangulated again once the chunks are merged
+			if (face.size() > 3)
+				chunk.polygons.emplace_back(chunk.face_vertices.size(), static_cast<uint32_t>(face.size()));
+			for (size_t i = 2; i < face.size(); ++i) {
+				const size_t triangle[3] = {0, i - 1, i};
+				for (size_t n : triangle) {
+					for (int k = 0; k < 3; ++k) {
+						if (face_relative[n] & (1 << k)) [[unlikely]]
+							chunk.relative_indices.emplace_back(chunk.face_vertices.size(), k);
+					}
+					chunk.face_vertices.push_back(face[n]);
+				}
+			}
+			faces_since_vertex |= face.size() > 2;
 		}
-		else if (type  == "f") {
-			std::vector<std::string> face;
-			std::string tuple;
-			while (stream >> tuple)
-				face.push_back(tuple);
-			ProcessFace(face, cur_face_group->face_vertices);
+		else if (eol > p && p[0] == 'g' && (eol - p == 1 || p[1] == ' ' || p[1] == '\t' || p[1] == '\r')) {
+			const char* name = SkipSpaces(p + 1, eol);
+			const char* name_end = name;
+			while (name_end < eol && *name_end != ' ' && *name_end != '\t' && *name_end != '\r') ++name_end;
+			chunk.group_events.push_back({chunk.face_vertices.size(), false, false, std::string(name, name_end)});
 		}
-		else if (type == "g") {
+		else if (eol > p && (p[0] == 'u' || p[0] == 'm')) {
+			const char* arg_end;
+			const char* arg;
+			if ((arg = MatchKeyword(p, eol, "usemtl", arg_end)))
+				chunk.group_events.push_back({chunk.face_vertices.size(), false, true, std::string(arg, arg_end)});
+			else if ((arg = MatchKeyword(p, eol, "mtllib", arg_end))) {
+				while (arg < arg_end) {
+					const char* name_end = arg;
+					while (name_end < arg_end && *name_end != ' ' && *name_end != '\t') ++name_end;
+					chunk.material_libraries.emplace_back(arg, name_end);
+					arg = SkipSpaces(name_end, arg_end);
+				}
+			}
+		}
+		p = eol + 1;
+	}
+}
+
+/**
+ * Call func(begin, end) on blocks of [0, count), one block per core. Small
+ * ranges (less than min_per_thread items per thread) are processed by the
+ * calling thread alone, starting threads would cost more than the work.
+ */
+template<typename Func>
+void ParallelFor(size_t count, size_t min_per_thread, const Func& func) {
+	size_t num_threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count / std::max<size_t>(1, min_per_thread));
+	if (num_threads <= 1) {
+		func(size_t(0), count);
+		return;
+	}
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < num_threads; ++i)
+		threads.emplace_back(func, count * i / num_threads, count * (i + 1) / num_threads);
+	func(size_t(0), count / num_threads);
+	for (auto& thread : threads)
+		thread.join();
+}
+
+/**
+ * Triangulate a polygon with the ear clipping method. The polygon is
+ * projected onto the plane of the two axes its normal is the most
+ * perpendicular to (the normal is computed with Newell's method, which works
+ * for non-planar and non-convex polygons). An ear is a convex corner whose
+ * triangle contains no other vertex of the polygon: it can be cut off, which
+ * leaves a polygon with one vertex less. Convex polygons, by far the most
+ * common, are split into a fan directly. This is also what ear clipping gives
+ * for them, since we look for ears in order starting from the second vertex.
+ * The n - 2 triangles are written as positions in the polygon (0 to n - 1).
+ */
+void TriangulatePolygon(const Vec3f* positions, const int* indices, uint32_t n, uint32_t* triangles) {
+	Vec3f normal;
+	for (uint32_t i = 0; i < n; ++i) {
+		const Vec3f& a = positions[indices[i]];
+		const Vec3f& b = positions[indices[(i + 1) % n]];
+		normal.x += (a.y - b.y) * (a.z + b.z);
+		normal.y += (a.z - b.z) * (a.x + b.x);
+		normal.z += (a.x - b.x) * (a.y + b.y);
+	}
+	const float abs_normal[3] = {std::fabs(normal.x), std::fabs(normal.y), std::fabs(normal.z)};
+	int axis = abs_normal[0] > abs_normal[1] ? (abs_normal[0] > abs_normal[2] ? 0 : 2) : (abs_normal[1] > abs_normal[2] ? 1 : 2);
+	// (axis + 1, axis + 2) keeps the orientation: the polygon turns counter-clockwise if normal[axis] > 0
+	int u = (axis + 1) % 3, v = (axis + 2) % 3;
+	float sign = (&normal.x)[axis] < 0 ? -1.f : 1.f;
+	auto Area = [&](uint32_t a, uint32_t b, uint32_t c) {
+		const float* pa = &positions[indices[a]].x;
+		const float* pb = &positions[indices[b]].x;
+		const float* pc = &positions[indices[c]].x;
+		return sign * ((pb[u] - pa[u]) * (pc[v] - pa[v]) - (pb[v] - pa[v]) * (pc[u] - pa[u]));
+	};
+	auto SamePosition = [&](uint32_t a, uint32_t b) {
+		const Vec3f& pa = positions[indices[a]];
+		const Vec3f& pb = positions[indices[b]];
+		return pa.x == pb.x && pa.y == pb.y && pa.z == pb.z;
+	};
+
+	bool convex = true;
+	for (uint32_t i = 0; i < n && convex; ++i)
+		convex = Area((i + n - 1) % n, i, (i + 1) % n) >= 0;
+	if (convex) {
+		for (uint32_t j = 0; j < n - 2; ++j) {
+			triangles[j * 3] = 0;
+			triangles[j * 3 + 1] = j + 1;
+			triangles[j * 3 + 2] = j + 2;
+		}
+		return;
+	}
+
+	std::vector<uint32_t> remaining(n);
+	for (uint32_t i = 0; i < n; ++i) remaining[i] = i;
+	uint32_t num_triangles = 0, i = 1;
+	while (remaining.size() > 3) {
+		uint32_t m = static_cast<uint32_t>(remaining.size());
+		// Without any ear (the polygon intersects itself), the corner we
+		// started from is cut anyway
+		for (uint32_t tries = 0; tries < m; ++tries, i = (i + 1) % m) {
+			uint32_t a = remaining[(i + m - 1) % m], b = remaining[i], c = remaining[(i + 1) % m];
+			if (Area(a, b, c) <= 0) continue;
+			bool is_ear = true;
+			for (uint32_t k = 0; k < m && is_ear; ++k) {
+				uint32_t p = remaining[k];
+				// Skip the corners of the triangle and their duplicates
+				// (polygons whose holes are connected to the outline have some)
+				if (SamePosition(p, a) || SamePosition(p, b) || SamePosition(p, c)) continue;
+				is_ear = !(Area(a, b, p) >= 0 && Area(b, c, p) >= 0 && Area(c, a, p) >= 0);
+			}
+			if (is_ear) break;
+		}
+		triangles[num_triangles * 3] = remaining[(i + m - 1) % m];
+		triangles[num_triangles * 3 + 1] = remaining[i];
+		triangles[num_triangles * 3 + 2] = remaining[(i + 1) % m];
+		num_triangles++;
+		remaining.erase(remaining.begin() + i);
+		if (i == remaining.size()) i = 0;
+	}
+	triangles[num_triangles * 3] = remaining[0];
+	triangles[num_triangles * 3 + 1] = remaining[1];
+	triangles[num_triangles * 3 + 2] = remaining[2];
+}
+
+/**
+ * Triangulate the polygons of a chunk again, now that the positions of their
+ * vertices are known. The fan made by the parser gives the n vertices of the
+ * polygon back: vertex 0 starts every triangle, and triangle j - 1 holds
+ * vertex j as its second vertex (the last one is the third vertex of the last
+ * triangle). The polygon has the same number of triangles either way, so
+ * they are replaced in place.
+ */
+void TriangulateChunkPolygons(ObjChunk& chunk) {
+	std::vector<FaceVertex> polygon;
+	std::vector<int> indices;
+	std::vector<uint32_t> triangles;
+	for (const auto& [first, n] : chunk.polygons) {
+		FaceVertex* fan = &chunk.face_vertices[first];
+		polygon.resize(n);
+		indices.resize(n);
+		triangles.resize((n - 2) * 3);
+		polygon[0] = fan[0];
+		for (uint32_t j = 1; j < n - 1; ++j) polygon[j] = fan[(j - 1) * 3 + 1];
+		polygon[n - 1] = fan[(n - 3) * 3 + 2];
+		bool valid = true;
+		for (uint32_t j = 0; j < n; ++j) {
+			indices[j] = polygon[j].vertex_index;
+			valid &= indices[j] >= 0 && static_cast<size_t>(indices[j]) < vertices.size();
+		}
+		if (!valid) continue;  // keep the fan
+		TriangulatePolygon(vertices.data(), indices.data(), n, triangles.data());
+		for (uint32_t j = 0; j < triangles.size(); ++j) fan[j] = polygon[triangles[j]];
+	}
+}
+
+/**
+ * Most OBJ files come without normals. Compute a normal for the face
+ * vertices that have none. The normal of a vertex is the average of the
+ * normals of the triangles sharing the vertex, weighted by the angle of each
+ * triangle at the vertex, which makes the result independent of how the
+ * polygons were split into triangles. The triangles whose normal makes an
+ * angle greater than crease_angle (in degrees) with the triangle the face
+ * vertex belongs to are left out, so that sharp edges stay sharp. The
+ * triangles, then the face vertices, are processed in parallel. Face vertices
+ * of the same vertex that get the same normal share it.
+ */
+void GenerateNormals(float crease_angle) {
+	std::vector<FaceVertex*> corners;
+	bool missing = false;
+	for (auto& group : face_groups) {
+		for (auto& fv : group.face_vertices) {
+			corners.push_back(&fv);
+			missing |= fv.normal_index == -1;
+		}
+	}
+	if (!missing) return;
+
+	size_t num_triangles = corners.size() / 3;
+	std::vector<Vec3f> triangle_normals(num_triangles);
+	std::vector<float> angles(corners.size());
+	ParallelFor(num_triangles, 16384, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			const Vec3f* p[3];
+			for (int k = 0; k < 3; ++k) p[k] = &vertices[corners[i * 3 + k]->vertex_index];
+			Vec3f n = (*p[1] - *p[0]).Cross(*p[2] - *p[0]);
+			triangle_normals[i] = n.Dot(n) > 0 ? n.normalize() : n;
+			for (int k = 0; k < 3; ++k) {
+				Vec3f e0 = *p[(k + 2) % 3] - *p[k], e1 = *p[(k + 1) % 3] - *p[k];
+				float len = std::sqrt(e0.Dot(e0) * e1.Dot(e1));
+				angles[i * 3 + k] = len > 0 ? std::acos(std::clamp(e0.Dot(e1) / len, -1.f, 1.f)) : 0;
+			}
+		}
+	});
+
+	// The face vertices of each vertex
+	std::vector<size_t> offsets(vertices.size() + 1, 0), vertex_corners(corners.size());
+	for (const FaceVertex* fv : corners) offsets[fv->vertex_index + 1]++;
+	for (size_t i = 0; i < vertices.size(); ++i) offsets[i + 1] += offsets[i];
+	std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+	for (size_t i = 0; i < corners.size(); ++i) vertex_corners[next[corners[i]->vertex_index]++] = i;
+
+	float cos_crease_angle = std::cos(crease_angle * static_cast<float>(M_PI) / 180);
+	std::vector<Vec3f> corner_normals(corners.size());
+	ParallelFor(corners.size(), 16384, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			if (corners[i]->normal_index != -1) continue;
+			const Vec3f& triangle_normal = triangle_normals[i / 3];
+			Vec3f n;
+			size_t v = corners[i]->vertex_index;
+			for (size_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+				size_t j = vertex_corners[k];
+				if (triangle_normal.Dot(triangle_normals[j / 3]) >= cos_crease_angle)
+					n = n + triangle_normals[j / 3] * angles[j];
+			}
+			corner_normals[i] = n.Dot(n) > 0 ? n.normalize() : triangle_normal;
+		}
+	});
+
+	for (size_t v = 0; v < vertices.size(); ++v) {
+		size_t first_normal = normals.size();
+		for (size_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+			size_t i = vertex_corners[k];
+			if (corners[i]->normal_index != -1) continue;
+			const Vec3f& n = corner_normals[i];
+			size_t j = first_normal;
+			while (j < normals.size() && !(normals[j].x == n.x && normals[j].y == n.y && normals[j].z == n.z)) ++j;
+			if (j == normals.size()) normals.push_back(n);
+			corners[i]->normal_index = static_cast<int>(j);
+		}
+	}
+}
+
+/**
+ * Read the materials of an MTL file and add them to materials. An MTL file
+ * is small, so we don't bother with mapping it or parsing it in parallel.
+ */
+void LoadMtl(const std::string& file) {
+	std::ifstream ifs(file, std::ios::binary);
+	if (!ifs) {
+		std::cerr << "Warning: Unable to open the material library " << file << std::endl;
+		return;
+	}
+	std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+	const char* p = contents.data();
+	const char* end = p + contents.size();
+	Material* material = nullptr;
+	auto ParseColor = [](const char* p, const char* end, Vec3f& c) {
+		p = ParseFloat(p, end, c.x);
+		c.y = c.z = c.x;  // a single value sets the 3 channels
+		p = ParseFloat(SkipSpaces(p, end), end, c.y);
+		ParseFloat(SkipSpaces(p, end), end, c.z);
+	};
+	while (p < end) {
+		const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+		if (!eol) eol = end;
+		p = SkipSpaces(p, eol);
+		const char* arg_end;
+		const char* arg;
+		if ((arg = MatchKeyword(p, eol, "newmtl", arg_end))) {
+			materials.emplace_back();
+			material = &materials.back();
+			material->name.assign(arg, arg_end);
+		}
+		else if (!material) {}  // nothing can come before the first material
+		else if ((arg = MatchKeyword(p, eol, "Ka", arg_end))) ParseColor(arg, arg_end, material->ambient);
+		else if ((arg = MatchKeyword(p, eol, "Kd", arg_end))) ParseColor(arg, arg_end, material->diffuse);
+		else if ((arg = MatchKeyword(p, eol, "Ks", arg_end))) ParseColor(arg, arg_end, material->specular);
+		else if ((arg = MatchKeyword(p, eol, "Ke", arg_end))) ParseColor(arg, arg_end, material->emissive);
+		else if ((arg = MatchKeyword(p, eol, "Ns", arg_end))) ParseFloat(arg, arg_end, material->shininess);
+		else if ((arg = MatchKeyword(p, eol, "Ni", arg_end))) ParseFloat(arg, arg_end, material->ior);
+		else if ((arg = MatchKeyword(p, eol, "d", arg_end))) ParseFloat(arg, arg_end, material->opacity);
+		else if ((arg = MatchKeyword(p, eol, "Tr", arg_end))) {
+			float transparency = 0;
+			ParseFloat(arg, arg_end, transparency);
+			material->opacity = 1 - transparency;
+		}
+		else if ((arg = MatchKeyword(p, eol, "illum", arg_end))) {
+			int64_t illum = material->illum;
+			ParseInt(arg, arg_end, illum);
+			material->illum = static_cast<int>(illum);
+		}
+		else if ((arg = MatchKeyword(p, eol, "map_Kd", arg_end))) {
+			// The options (-s, -o, etc.) come before the file name
+			const char* name = arg_end;
+			while (name > arg && name[-1] != ' ' && name[-1] != '\t') --name;
+			material->diffuse_map.assign(name, arg_end);
+		}
+		p = eol + 1;
+	}
+}
+
+// Return the index of the material in materials. An undefined material gets
+// the default parameters, so that the faces using it can still be rendered.
+int FindMaterial(const std::string& name) {
+	for (size_t i = 0; i < materials.size(); ++i) {
+		if (materials[i].name == name) return static_cast<int>(i);
+	}
+	std::cerr << "Warning: Material " << name << " is not defined" << std::endl;
+	materials.emplace_back();
+	materials.back().name = name;
+	return static_cast<int>(materials.size() - 1);
+}
+
+// num_threads = 0 uses one thread per core for files larger than a few MB.
+// crease_angle is used to compute the normals the file doesn't provide.
+void ParseObj(const char* file, size_t num_threads = 0, float crease_angle = 60) {
+#ifdef _WIN32
+	std::ifstream ifs(file, std::ios::binary);
+	if (!ifs) {
+		std::cerr << "Error: Unable to open " << file << std::endl;
+		return;
+	}
+	std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+	const char* data = contents.data();
+	size_t size = contents.size();
+#else
+	int fd = open(file, O_RDONLY);
+	struct stat st;
+	if (fd == -1 || fstat(fd, &st) == -1) {
+		std::cerr << "Error: Unable to open " << file << std::endl;
+		if (fd != -1) close(fd);
+		return;
+	}
+	size_t size = st.st_size;
+	void* mapping = size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+	close(fd);
+	if (mapping == MAP_FAILED) {
+		std::cerr << "Error: Unable to map " << file << std::endl;
+		return;
+	}
+	const char* data = static_cast<const char*>(mapping);
+	if (size) madvise(mapping, size, MADV_SEQUENTIAL);
+#endif
+
+	size_t num_chunks = num_threads;
+	if (num_chunks == 0) {
+		num_chunks = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), size >> 22));
+	}
+	std::vector<const char*> bounds(num_chunks + 1, data + size);
+	bounds[0] = data;
+	for (size_t i = 1; i < num_chunks; ++i) {
+		const char* p = std::max(bounds[i - 1], data + size * i / num_chunks);
+		const char* eol = static_cast<const char*>(memchr(p, '\n', data + size - p));
+		bounds[i] = eol ? eol + 1 : data + size;
+	}
+
+	std::vector<ObjChunk> chunks(num_chunks);
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < num_chunks; ++i)
+		threads.emplace_back(ParseObjChunk, bounds[i], bounds[i + 1], std::ref(chunks[i]));
+	ParseObjChunk(bounds[0], bounds[1], chunks[0]);
+	for (auto& thread : threads)
+		thread.join();
+
+#ifndef _WIN32
+	if (size) munmap(mapping, size);
+#endif
+
+	// The material libraries are relative to the OBJ file
+	std::string path(file);
+	std::string directory = path.substr(0, path.find_last_of("/\\") + 1);
+	for (const auto& chunk : chunks) {
+		for (const auto& library : chunk.material_libraries)
+			LoadMtl(directory + library);
+	}
+
+	for (auto& chunk : chunks) {
+		const int bases[3] = {
+			static_cast<int>(vertices.size()),
+			static_cast<int>(tex_coordinates.size()),
+			static_cast<int>(normals.size())};
+		for (const auto& [n, k] : chunk.relative_indices) {
+			FaceVertex& fv = chunk.face_vertices[n];
+			(k == 0 ? fv.vertex_index : k == 1 ? fv.st_coord_index : fv.normal_index) += bases[k];
+		}
+		vertices.insert(vertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+		tex_coordinates.insert(tex_coordinates.end(), chunk.tex_coordinates.begin(), chunk.tex_coordinates.end());
+		normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+	}
+
+	// All the positions are known now, the polygons can be triangulated
+	threads.clear();
+	for (size_t i = 1; i < num_chunks; ++i)
+		threads.emplace_back(TriangulateChunkPolygons, std::ref(chunks[i]));
+	TriangulateChunkPolygons(chunks[0]);
+	for (auto& thread : threads)
+		thread.join();
+
+	face_groups.emplace_back();
+	FaceGroup* cur_face_group = &face_groups.back();
+	for (auto& chunk : chunks) {
+		size_t begin = 0;
+		auto append_faces = [&](size_t end) {
+			cur_face_group->face_vertices.insert(cur_face_group->face_vertices.end(),
+				chunk.face_vertices.begin() + begin, chunk.face_vertices.begin() + end);
+			begin = end;
+		};
+		for (const auto& event : chunk.group_events) {
+			append_faces(event.face_vertex);
+			// A group keeps the material of the faces before it, and a
+			// "usemtl" line starts a new group that keeps the name of the
+			// current group, so that each group has a single material
 			if (cur_face_group->face_vertices.size() != 0) {
+				const FaceGroup& prev = face_groups.back();
 				face_groups.emplace_back();
+				face_groups.back().material = prev.material;
+				if (event.use_material)
+					face_groups.back().name = prev.name;
 				cur_face_group = &face_groups.back();
 			}
-			stream >> cur_face_group->name;
+			if (event.use_material)
+				cur_face_group->material = FindMaterial(event.name);
+			else if (!event.vertex_break && !event.name.empty())
+				cur_face_group->name = event.name;
 		}
+		append_faces(chunk.face_vertices.size());
+		chunk = ObjChunk();
 	}
+
+	GenerateNormals(crease_angle);
+
 	std::cerr << face_groups.size() << std::endl;
 	for (const auto& group : face_groups) {
 		std::cerr << group.name << " " << group.face_vertices.size() / 3 << std::endl;
 	}
-	ifs.close();
+}
+
+/**
+ * A simple cache simulator: set associative with LRU replacement and 64 bytes
+ * lines. We feed it the addresses the renderer reads, and it counts how many
+ * of these reads would miss. The default size is much smaller than a real L1
+ * cache because our test meshes are small: what matters is how the misses
+ * change when we change the memory layout of the mesh.
+ */
+class CacheSimulator {
+public:
+	CacheSimulator(uint32_t size = 4096, uint32_t ways = 4)
+		: num_sets(size / (kLineSize * ways)), num_ways(ways),
+		  tags(num_sets * ways, ~uint64_t(0)), last_use(num_sets * ways, 0) {}
+	void Access(const void* p, size_t size) {
+		uint64_t first = reinterpret_cast<uintptr_t>(p) / kLineSize;
+		uint64_t last = (reinterpret_cast<uintptr_t>(p) + size - 1) / kLineSize;
+		for (uint64_t line = first; line <= last; ++line) Touch(line);
+	}
+	uint64_t num_accesses{0};
+	uint64_t num_misses{0};
+private:
+	static constexpr uint32_t kLineSize = 64;
+	void Touch(uint64_t line) {
+		num_accesses++;
+		size_t set = (line % num_sets) * num_ways, lru = set;
+		for (size_t i = set; i < set + num_ways; ++i) {
+			if (tags[i] == line) {
+				last_use[i] = num_accesses;
+				return;
+			}
+			if (last_use[i] < last_use[lru]) lru = i;
+		}
+		num_misses++;
+		tags[lru] = line;
+		last_use[lru] = num_accesses;
+	}
+	uint32_t num_sets, num_ways;
+	std::vector<uint64_t> tags, last_use;
+};
+
+/**
+ * The memory accesses of DoSomeWork() for one ray: the three vertices of
+ * every triangle, in the order the triangles are stored.
+ */
+void SimulateVertexFetches(CacheSimulator& cache) {
+	for (const auto& group : face_groups) {
+		for (const auto& fv : group.face_vertices)
+			cache.Access(&vertices[fv.vertex_index], sizeof(Vec3f));
+	}
+}
+
+inline uint32_t ExpandBits(uint32_t v) {
+	v = (v * 0x00010001u) & 0xFF0000FFu;
+	v = (v * 0x00000101u) & 0x0F00F00Fu;
+	v = (v * 0x00000011u) & 0xC30C30C3u;
+	v = (v * 0x00000005u) & 0x49249249u;
+	return v;
+}
+
+// 30 bits Morton code of a point whose coordinates are in [0,1]
+inline uint32_t MortonCode(float x, float y, float z) {
+	auto quantize = [](float c) { return static_cast<uint32_t>(std::min(std::max(c * 1024.f, 0.f), 1023.f)); };
+	return ExpandBits(quantize(x)) << 2 | ExpandBits(quantize(y)) << 1 | ExpandBits(quantize(z));
+}
+
+/**
+ * Meshes often come with their triangles in a random order (as far as space
+ * is concerned), and the vertices they use are spread all over the vertex
+ * arrays. We sort the triangles of each group by the Morton code of their
+ * centroid, which follows a space filling curve: triangles that are close in
+ * space end up close in memory. We then renumber the vertices, normals and
+ * texture coordinates in the order the triangles first use them, so that
+ * reading the triangles in order reads the vertex arrays almost sequentially.
+ * The groups keep their triangles, so the image doesn't change.
+ */
+void OptimizeMeshLayout() {
+	Vec3f bbox_min(std::numeric_limits<float>::max()), bbox_max(-std::numeric_limits<float>::max());
+	for (const auto& v : vertices) {
+		bbox_min = Vec3f(std::min(bbox_min.x, v.x), std::min(bbox_min.y, v.y), std::min(bbox_min.z, v.z));
+		bbox_max = Vec3f(std::max(bbox_max.x, v.x), std::max(bbox_max.y, v.y), std::max(bbox_max.z, v.z));
+	}
+	Vec3f extent = bbox_max - bbox_min;
+	Vec3f scale(extent.x > 0 ? 1 / extent.x : 0, extent.y > 0 ? 1 / extent.y : 0, extent.z > 0 ? 1 / extent.z : 0);
+
+	for (auto& group : face_groups) {
+		size_t num_triangles = group.face_vertices.size() / 3;
+		std::vector<std::pair<uint32_t, uint32_t>> keys(num_triangles); // Morton code, triangle
+		for (size_t i = 0; i < num_triangles; ++i) {
+			const FaceVertex* fv = &group.face_vertices[i * 3];
+			Vec3f c = (vertices[fv[0].vertex_index] + vertices[fv[1].vertex_index] + vertices[fv[2].vertex_index]) * (1.f / 3) - bbox_min;
+			keys[i] = {MortonCode(c.x * scale.x, c.y * scale.y, c.z * scale.z), static_cast<uint32_t>(i)};
+		}
+		std::sort(keys.begin(), keys.end());
+		std::vector<FaceVertex> sorted(group.face_vertices.size());
+		for (size_t i = 0; i < num_triangles; ++i)
+			std::copy_n(&group.face_vertices[keys[i].second * 3], 3, &sorted[i * 3]);
+		group.face_vertices = std::move(sorted);
+	}
+
+	// Renumber the elements of an array in the order they are first used
+	auto renumber = [](auto& array, auto index_of) {
+		std::vector<int> remap(array.size(), -1);
+		int next = 0;
+		for (auto& group : face_groups) {
+			for (auto& fv : group.face_vertices) {
+				int& index = index_of(fv);
+				if (index < 0) continue;
+				if (remap[index] == -1) remap[index] = next++;
+				index = remap[index];
+			}
+		}
+		for (auto& r : remap) if (r == -1) r = next++; // keep the unused elements
+		std::remove_reference_t<decltype(array)> reordered(array.size());
+		for (size_t i = 0; i < array.size(); ++i) reordered[remap[i]] = array[i];
+		array = std::move(reordered);
+	};
+	renumber(vertices, [](FaceVertex& fv) -> int& { return fv.vertex_index; });
+	renumber(normals, [](FaceVertex& fv) -> int& { return fv.normal_index; });
+	renumber(tex_coordinates, [](FaceVertex& fv) -> int& { return fv.st_coord_index; });
 }
 
 template<typename T>
@@ -292,7 +1001,25 @@ void DoSomeWork() {
 }
 
 int main() {
+	auto start = std::chrono::high_resolution_clock::now();
 	ParseObj("./zombie.obj");
+	auto stop = std::chrono::high_resolution_clock::now();
+	std::cout << "Parse time: " << std::chrono::duration<double, std::milli>(stop - start).count() << " ms." << std::endl;
+	for (size_t i = 0; i < materials.size(); ++i) {
+		size_t num_tris = 0;
+		for (const auto& group : face_groups) {
+			if (group.material == static_cast<int>(i)) num_tris += group.face_vertices.size() / 3;
+		}
+		std::cout << "Material " << materials[i].name << ": " << num_tris << " triangles";
+		if (!materials[i].diffuse_map.empty()) std::cout << ", texture " << materials[i].diffuse_map;
+		std::cout << std::endl;
+	}
+	CacheSimulator source_order, optimized_order;
+	SimulateVertexFetches(source_order);
+	OptimizeMeshLayout();
+	SimulateVertexFetches(optimized_order);
+	std::cout << "Vertex fetch cache misses per ray (simulated 4KB cache): " << source_order.num_misses
+			  << " in source order, " << optimized_order.num_misses << " after reordering." << std::endl;
 	DoSomeWork();
 	return 0;
 }
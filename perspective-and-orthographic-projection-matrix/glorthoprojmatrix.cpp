@@ -30,6 +30,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <cstring>
 #include <limits>
 #include "geometry.h"
 #include "vertexdata.h"
@@ -102,13 +103,13 @@ int main(int argc, char **argv)
     //[/comment]
     const float kInfinity = std::numeric_limits<float>::max();
     Vec3f minWorld(kInfinity), maxWorld(-kInfinity);
-    for (uint32_t i = 0; i < numVertices; ++i) {
-        if (vertices[i].x < minWorld.x) minWorld.x = vertices[i].x;
-        if (vertices[i].y < minWorld.y) minWorld.y = vertices[i].y;
-        if (vertices[i].z < minWorld.z) minWorld.z = vertices[i].z;
-        if (vertices[i].x > maxWorld.x) maxWorld.x = vertices[i].x;
-        if (vertices[i].y > maxWorld.y) maxWorld.y = vertices[i].y;
-        if (vertices[i].z > maxWorld.z) maxWorld.z = vertices[i].z;
+    for (uint32_t i = 0; i < kTeapotNumVerts; ++i) {
+        if (teapotVertsX[i] < minWorld.x) minWorld.x = teapotVertsX[i];
+        if (teapotVertsY[i] < minWorld.y) minWorld.y = teapotVertsY[i];
+        if (teapotVertsZ[i] < minWorld.z) minWorld.z = teapotVertsZ[i];
+        if (teapotVertsX[i] > maxWorld.x) maxWorld.x = teapotVertsX[i];
+        if (teapotVertsY[i] > maxWorld.y) maxWorld.y = teapotVertsY[i];
+        if (teapotVertsZ[i] > maxWorld.z) maxWorld.z = teapotVertsZ[i];
     }
 
     //[comment]
@@ -139,13 +140,13 @@ int main(int argc, char **argv)
     //[comment]
     // Loop over all points
     //[/comment]
-    for (uint32_t i = 0; i < numVertices; ++i) {
+    for (uint32_t i = 0; i < kTeapotNumVerts; ++i) {
         Vec3f vertCamera, projectedVert;
 
         //[comment]
         // Transform to camera space
         //[/comment]
-        multPointMatrix(vertices[i], vertCamera, worldToCamera);
+        multPointMatrix(Vec3f(teapotVertsX[i], teapotVertsY[i], teapotVertsZ[i]), vertCamera, worldToCamera);
 
         //[comment]
         // Project
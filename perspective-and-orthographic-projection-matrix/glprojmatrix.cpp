@@ -30,6 +30,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <cstring>
 #include "geometry.h"
 #include "vertexdata.h"
 
@@ -129,13 +130,13 @@ int main(int argc, char **argv)
     //[comment]
     // Loop over all points
     //[/comment]
-    for (uint32_t i = 0; i < numVertices; ++i) {
+    for (uint32_t i = 0; i < kTeapotNumVerts; ++i) {
         Vec3f vertCamera, projectedVert;
 
         //[comment]
         // Transform to camera space
         //[/comment]
-        multPointMatrix(vertices[i], vertCamera, worldToCamera);
+        multPointMatrix(Vec3f(teapotVertsX[i], teapotVertsY[i], teapotVertsZ[i]), vertCamera, worldToCamera);
 
         //[comment]
         // Project
@@ -0,0 +1,583 @@
+//[header]
+// A simple program to convert a geo (ascii) or obj file to the binary geo format (geob), to
+// the clustered format (geoc) used to render meshes that don't fit in memory, or to a C++
+// header which embeds the mesh in the program
+//[/header]
+//[compile]
+// Download the convertgeometry.cpp and geometry.h files to a folder.
+// Open a shell/terminal, and run the following command where the files is saved:
+//
+// c++ -o convertgeometry convertgeometry.cpp -O3 -std=c++11
+//
+// Run with: ./convertgeometry [-c] cow.geo cow.geob (-c compresses the index arrays), or
+// ./convertgeometry [-k maxTrisPerCluster] cow.geo cow.geoc to write a clustered file, or
+// ./convertgeometry [-p] cow.obj cow.h to write a header (-p only writes the vertex positions).
+//[/compile]
+//[ignore]
+// Copyright (C) 2012  www.scratchapixel.com
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//[/ignore]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include "geometry.h"
+
+// [comment]
+// Structure of the geob file (binary, little-endian):
+//
+//     * header (GeoBinHeader)
+//
+//     * face index array, vertex index array, vertex array, normal array and texture
+//       coordinates array, in this order. They hold the same data as the arrays of the
+//       geo file, and each array starts on a 16 bytes boundary.
+//
+// The offsets stored in the header are relative to the start of the file. Thus a program
+// loading the file only has to map it in memory and add the offsets to the address of the
+// mapping to get pointers to the arrays: there's nothing to parse. When the file is
+// compressed (kGeoBinCompressedIndices), the two index arrays are delta encoded then stored
+// as variable length integers (7 bits per byte, the last byte of each value has its top bit
+// cleared). Face vertex counts and vertex indices of neighboring faces are usually close,
+// so most values fit in a byte. Only the index arrays are compressed, so that the vertex,
+// normal and texture coordinates arrays can still be used in place.
+// [/comment]
+static const char kGeoBinMagic[4] = {'G', 'E', 'O', 'B'};
+static const uint32_t kGeoBinVersion = 1;
+static const uint32_t kGeoBinCompressedIndices = 1;
+
+struct GeoBinHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numFaces;
+    uint32_t vertsIndexArraySize;
+    uint32_t vertsArraySize;
+    uint64_t faceIndexOffset, faceIndexBytes;
+    uint64_t vertsIndexOffset, vertsIndexBytes;
+    uint64_t vertsOffset;
+    uint64_t normalsOffset;
+    uint64_t stOffset;
+};
+
+// [comment]
+// Structure of the geoc file (binary, little-endian):
+//
+//     * header (GeoClusterHeader)
+//
+//     * the clusters. Each cluster is a small indexed triangle mesh that can be loaded on its
+//       own: vertex positions, vertex normals, vertex texture coordinates and the triangle
+//       index array (3 indices per triangle, relative to the cluster), in this order, each
+//       array starting on a 16 bytes boundary.
+//
+//     * the cluster table (one GeoClusterInfo per cluster) which gives the bounding box of each
+//       cluster and where its data is in the file.
+//
+// The triangles are grouped by location: the set of triangles is split recursively in two
+// along the longest axis of the bounding box of their centroids, until each group has at
+// most maxTrisPerCluster triangles. A renderer only needs to keep the cluster table in
+// memory, and can load the clusters whose bounding box is hit by a ray when it needs them.
+// [/comment]
+static const char kGeoClusterMagic[4] = {'G', 'E', 'O', 'C'};
+static const uint32_t kGeoClusterVersion = 1;
+static const uint32_t kDefaultMaxTrisPerCluster = 256;
+
+struct GeoClusterHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t numClusters;
+    uint32_t numTris;
+    uint64_t clusterTableOffset;
+};
+
+struct GeoClusterInfo
+{
+    Vec3f bboxMin, bboxMax;
+    uint32_t numVerts;
+    uint32_t numTris;
+    uint64_t vertsOffset;   // then normals, texture coordinates and triangle indices
+    uint64_t bytes;
+};
+
+struct PolyMesh
+{
+    std::vector<uint32_t> faceIndex;
+    std::vector<uint32_t> vertsIndex;
+    std::vector<Vec3f> verts;
+    std::vector<Vec3f> normals;  // one per face vertex
+    std::vector<Vec2f> st;       // one per face vertex
+};
+
+bool readGeoFile(const char *file, PolyMesh &mesh)
+{
+    std::ifstream ifs(file);
+    if (ifs.fail()) return false;
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    uint32_t numFaces;
+    if (!(ss >> numFaces)) return false;
+    mesh.faceIndex.resize(numFaces);
+    uint32_t vertsIndexArraySize = 0;
+    for (uint32_t i = 0; i < numFaces; ++i) {
+        ss >> mesh.faceIndex[i];
+        vertsIndexArraySize += mesh.faceIndex[i];
+    }
+    mesh.vertsIndex.resize(vertsIndexArraySize);
+    uint32_t vertsArraySize = 0;
+    for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
+        ss >> mesh.vertsIndex[i];
+        if (mesh.vertsIndex[i] > vertsArraySize) vertsArraySize = mesh.vertsIndex[i];
+    }
+    mesh.verts.resize(vertsArraySize + 1);
+    for (Vec3f &v : mesh.verts) ss >> v.x >> v.y >> v.z;
+    mesh.normals.resize(vertsIndexArraySize);
+    for (Vec3f &n : mesh.normals) ss >> n.x >> n.y >> n.z;
+    mesh.st.resize(vertsIndexArraySize);
+    for (Vec2f &st : mesh.st) ss >> st.x >> st.y;
+    return !ss.fail();
+}
+
+// [comment]
+// The geo file stores a normal and a texture coordinate per face vertex. When the obj file
+// has no normals, we use the normal of the face (computed with Newell's method, which works
+// for any planar polygon).
+// [/comment]
+bool readObjFile(const char *file, PolyMesh &mesh)
+{
+    std::ifstream ifs(file);
+    if (ifs.fail()) return false;
+    std::vector<Vec3f> normals;
+    std::vector<Vec2f> st;
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream stream(line);
+        std::string type;
+        stream >> type;
+        if (type == "v") {
+            Vec3f v;
+            stream >> v.x >> v.y >> v.z;
+            mesh.verts.push_back(v);
+        }
+        else if (type == "vt") {
+            Vec2f t;
+            stream >> t.x >> t.y;
+            st.push_back(t);
+        }
+        else if (type == "vn") {
+            Vec3f n;
+            stream >> n.x >> n.y >> n.z;
+            normals.push_back(n);
+        }
+        else if (type == "f") {
+            std::string tuple;
+            uint32_t numFaceVerts = 0;
+            size_t first = mesh.vertsIndex.size();
+            while (stream >> tuple) {
+                // v, v/vt, v//vn or v/vt/vn, negative indices are relative to the end of the arrays
+                int index[3] = {0, 0, 0};
+                const size_t counts[3] = {mesh.verts.size(), st.size(), normals.size()};
+                const char *p = tuple.c_str();
+                for (int k = 0; k < 3 && *p; ++k) {
+                    char *end;
+                    long i = strtol(p, &end, 10);
+                    index[k] = i < 0 ? int(counts[k] + i) + 1 : int(i);
+                    p = *end == '/' ? end + 1 : end;
+                    if (*end != '/') break;
+                }
+                if (index[0] <= 0 || index[0] > (int)mesh.verts.size()) return false;
+                mesh.vertsIndex.push_back(index[0] - 1);
+                mesh.st.push_back(index[1] > 0 && index[1] <= (int)st.size() ? st[index[1] - 1] : Vec2f(0));
+                mesh.normals.push_back(index[2] > 0 && index[2] <= (int)normals.size() ? normals[index[2] - 1] : Vec3f(0));
+                numFaceVerts++;
+            }
+            if (numFaceVerts < 3) {
+                mesh.vertsIndex.resize(first);
+                mesh.st.resize(first);
+                mesh.normals.resize(first);
+                continue;
+            }
+            mesh.faceIndex.push_back(numFaceVerts);
+            if (normals.empty()) {
+                Vec3f faceNormal(0);
+                for (uint32_t j = 0; j < numFaceVerts; ++j) {
+                    const Vec3f &a = mesh.verts[mesh.vertsIndex[first + j]];
+                    const Vec3f &b = mesh.verts[mesh.vertsIndex[first + (j + 1) % numFaceVerts]];
+                    faceNormal.x += (a.y - b.y) * (a.z + b.z);
+                    faceNormal.y += (a.z - b.z) * (a.x + b.x);
+                    faceNormal.z += (a.x - b.x) * (a.y + b.y);
+                }
+                faceNormal.normalize();
+                for (uint32_t j = 0; j < numFaceVerts; ++j) mesh.normals[first + j] = faceNormal;
+            }
+        }
+    }
+    return !mesh.faceIndex.empty();
+}
+
+void encodeIndices(const std::vector<uint32_t> &indices, std::vector<uint8_t> &bytes)
+{
+    uint32_t prev = 0;
+    for (uint32_t index : indices) {
+        int32_t delta = int32_t(index - prev);
+        uint32_t v = (uint32_t(delta) << 1) ^ uint32_t(delta >> 31); // zigzag, small negative deltas stay small
+        while (v >= 0x80) {
+            bytes.push_back(uint8_t(v | 0x80));
+            v >>= 7;
+        }
+        bytes.push_back(uint8_t(v));
+        prev = index;
+    }
+}
+
+template<typename T>
+uint64_t appendArray(std::vector<uint8_t> &out, const T *data, size_t bytes)
+{
+    out.resize((out.size() + 15) & ~size_t(15), 0);
+    uint64_t offset = out.size();
+    out.insert(out.end(), (const uint8_t*)data, (const uint8_t*)data + bytes);
+    return offset;
+}
+
+bool writeGeoBinFile(const char *file, const PolyMesh &mesh, bool compress)
+{
+    GeoBinHeader header;
+    memset(&header, 0x0, sizeof(header));
+    memcpy(header.magic, kGeoBinMagic, 4);
+    header.version = kGeoBinVersion;
+    header.flags = compress ? kGeoBinCompressedIndices : 0;
+    header.numFaces = mesh.faceIndex.size();
+    header.vertsIndexArraySize = mesh.vertsIndex.size();
+    header.vertsArraySize = mesh.verts.size();
+
+    std::vector<uint8_t> out(sizeof(GeoBinHeader));
+    if (compress) {
+        std::vector<uint8_t> bytes;
+        encodeIndices(mesh.faceIndex, bytes);
+        header.faceIndexBytes = bytes.size();
+        header.faceIndexOffset = appendArray(out, bytes.data(), bytes.size());
+        bytes.clear();
+        encodeIndices(mesh.vertsIndex, bytes);
+        header.vertsIndexBytes = bytes.size();
+        header.vertsIndexOffset = appendArray(out, bytes.data(), bytes.size());
+    }
+    else {
+        header.faceIndexBytes = mesh.faceIndex.size() * sizeof(uint32_t);
+        header.faceIndexOffset = appendArray(out, mesh.faceIndex.data(), header.faceIndexBytes);
+        header.vertsIndexBytes = mesh.vertsIndex.size() * sizeof(uint32_t);
+        header.vertsIndexOffset = appendArray(out, mesh.vertsIndex.data(), header.vertsIndexBytes);
+    }
+    header.vertsOffset = appendArray(out, mesh.verts.data(), mesh.verts.size() * sizeof(Vec3f));
+    header.normalsOffset = appendArray(out, mesh.normals.data(), mesh.normals.size() * sizeof(Vec3f));
+    header.stOffset = appendArray(out, mesh.st.data(), mesh.st.size() * sizeof(Vec2f));
+    memcpy(out.data(), &header, sizeof(header));
+
+    FILE *f = fopen(file, "wb");
+    if (!f) return false;
+    bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+    return (fclose(f) == 0) && ok;
+}
+
+// [comment]
+// A triangle of the source mesh: the index of its three face vertices (the normals and
+// texture coordinates are stored per face vertex), and its centroid.
+// [/comment]
+struct ClusterTriangle
+{
+    uint32_t faceVerts[3];
+    Vec3f centroid;
+};
+
+void partitionTriangles(
+    std::vector<ClusterTriangle> &tris, size_t begin, size_t end, size_t maxTris,
+    std::vector<std::pair<size_t, size_t>> &clusters)
+{
+    if (end - begin <= maxTris) {
+        clusters.push_back(std::make_pair(begin, end));
+        return;
+    }
+    Vec3f min(std::numeric_limits<float>::max()), max(-std::numeric_limits<float>::max());
+    for (size_t i = begin; i < end; ++i) {
+        const Vec3f &c = tris[i].centroid;
+        min = Vec3f(std::min(min.x, c.x), std::min(min.y, c.y), std::min(min.z, c.z));
+        max = Vec3f(std::max(max.x, c.x), std::max(max.y, c.y), std::max(max.z, c.z));
+    }
+    Vec3f extent = max - min;
+    int axis = (extent.x > extent.y && extent.x > extent.z) ? 0 : (extent.y > extent.z) ? 1 : 2;
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(tris.begin() + begin, tris.begin() + mid, tris.begin() + end,
+        [axis](const ClusterTriangle &a, const ClusterTriangle &b) { return a.centroid[axis] < b.centroid[axis]; });
+    partitionTriangles(tris, begin, mid, maxTris, clusters);
+    partitionTriangles(tris, mid, end, maxTris, clusters);
+}
+
+// a vertex of a cluster: a position index with its normal and texture coordinates
+struct ClusterVertex
+{
+    uint32_t vertIndex;
+    Vec3f normal;
+    Vec2f st;
+    bool operator == (const ClusterVertex &v) const
+    {
+        return vertIndex == v.vertIndex &&
+            memcmp(&normal, &v.normal, sizeof(Vec3f)) == 0 &&
+            memcmp(&st, &v.st, sizeof(Vec2f)) == 0;
+    }
+};
+
+struct ClusterVertexHash
+{
+    size_t operator () (const ClusterVertex &v) const
+    {
+        uint32_t bits[5];
+        memcpy(bits, &v.normal, sizeof(Vec3f));
+        memcpy(bits + 3, &v.st, sizeof(Vec2f));
+        uint64_t h = v.vertIndex;
+        for (uint32_t i = 0; i < 5; ++i) h = (h ^ bits[i]) * 0x100000001b3ULL;
+        return size_t(h ^ (h >> 32));
+    }
+};
+
+// write the array at the next 16 bytes boundary of the file, and return its offset
+uint64_t writeArray(FILE *f, uint64_t &fileSize, const void *data, size_t bytes)
+{
+    static const uint8_t padding[16] = {0};
+    uint64_t offset = (fileSize + 15) & ~uint64_t(15);
+    fwrite(padding, 1, offset - fileSize, f);
+    fwrite(data, 1, bytes, f);
+    fileSize = offset + bytes;
+    return offset;
+}
+
+// [comment]
+// The clusters are written as soon as they are built, so only one cluster is held in memory
+// at a time (on top of the source mesh). The polygons are triangulated the same way the
+// renderer does it (as a fan around the first vertex of the face), so the triangles are
+// exactly the same as those of the unclustered mesh.
+// [/comment]
+bool writeGeoClusterFile(const char *file, const PolyMesh &mesh, size_t maxTrisPerCluster)
+{
+    std::vector<ClusterTriangle> tris;
+    for (uint32_t i = 0, k = 0; i < mesh.faceIndex.size(); ++i) {
+        for (uint32_t j = 0; j < mesh.faceIndex[i] - 2; ++j) {
+            ClusterTriangle tri = {{k, k + j + 1, k + j + 2}, Vec3f(0)};
+            for (uint32_t l = 0; l < 3; ++l)
+                tri.centroid = tri.centroid + mesh.verts[mesh.vertsIndex[tri.faceVerts[l]]] * (1.f / 3);
+            tris.push_back(tri);
+        }
+        k += mesh.faceIndex[i];
+    }
+    std::vector<std::pair<size_t, size_t>> ranges;
+    partitionTriangles(tris, 0, tris.size(), maxTrisPerCluster, ranges);
+
+    FILE *f = fopen(file, "wb");
+    if (!f) return false;
+    GeoClusterHeader header;
+    memset(&header, 0x0, sizeof(header));
+    fwrite(&header, sizeof(header), 1, f);
+    uint64_t fileSize = sizeof(header);
+    std::vector<GeoClusterInfo> table;
+    for (const auto &range : ranges) {
+        std::unordered_map<ClusterVertex, uint32_t, ClusterVertexHash> vertexMap;
+        std::vector<Vec3f> P, N;
+        std::vector<Vec2f> st;
+        std::vector<uint32_t> trisIndex;
+        GeoClusterInfo info;
+        info.bboxMin = Vec3f(std::numeric_limits<float>::max());
+        info.bboxMax = Vec3f(-std::numeric_limits<float>::max());
+        for (size_t i = range.first; i < range.second; ++i) {
+            for (uint32_t l = 0; l < 3; ++l) {
+                uint32_t faceVert = tris[i].faceVerts[l];
+                ClusterVertex v = {mesh.vertsIndex[faceVert], mesh.normals[faceVert], mesh.st[faceVert]};
+                auto inserted = vertexMap.insert(std::make_pair(v, (uint32_t)P.size()));
+                if (inserted.second) {
+                    const Vec3f &p = mesh.verts[v.vertIndex];
+                    P.push_back(p);
+                    N.push_back(v.normal);
+                    st.push_back(v.st);
+                    info.bboxMin = Vec3f(std::min(info.bboxMin.x, p.x), std::min(info.bboxMin.y, p.y), std::min(info.bboxMin.z, p.z));
+                    info.bboxMax = Vec3f(std::max(info.bboxMax.x, p.x), std::max(info.bboxMax.y, p.y), std::max(info.bboxMax.z, p.z));
+                }
+                trisIndex.push_back(inserted.first->second);
+            }
+        }
+        info.numVerts = P.size();
+        info.numTris = range.second - range.first;
+        info.vertsOffset = writeArray(f, fileSize, P.data(), P.size() * sizeof(Vec3f));
+        writeArray(f, fileSize, N.data(), N.size() * sizeof(Vec3f));
+        writeArray(f, fileSize, st.data(), st.size() * sizeof(Vec2f));
+        writeArray(f, fileSize, trisIndex.data(), trisIndex.size() * sizeof(uint32_t));
+        info.bytes = fileSize - info.vertsOffset;
+        table.push_back(info);
+    }
+    memcpy(header.magic, kGeoClusterMagic, 4);
+    header.version = kGeoClusterVersion;
+    header.numClusters = table.size();
+    header.numTris = tris.size();
+    header.clusterTableOffset = writeArray(f, fileSize, table.data(), table.size() * sizeof(GeoClusterInfo));
+    bool ok = !ferror(f) && fseek(f, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, f) == 1;
+    std::cerr << file << ": " << table.size() << " clusters" << std::endl;
+    return (fclose(f) == 0) && ok;
+}
+
+// [comment]
+// Write the mesh as a C++ header that a program can include instead of loading the mesh
+// from a file. The arrays are constexpr arrays of floats and integers: the compiler stores
+// them as they are in the program (in the read-only data), there's nothing to build when
+// the program starts (which is the case with arrays of Vec3f, since Vec3f has a
+// constructor), and they are much cheaper to compile. Vertex positions and texture
+// coordinates are stored as one array per coordinate (x, y and z), which is also the
+// layout that SIMD code wants. The names of the arrays start with the name of the input
+// file (cowVertsX, kCowNumTris, etc. for cow.obj). The polygons are triangulated as a fan
+// around the first vertex of the face, and the texture coordinates which are the same are
+// merged, so each triangle has 3 position indices and 3 texture coordinates indices. With -p
+// only the vertex positions are written (for programs which only need a point cloud).
+// [/comment]
+void writeValue(FILE *f, uint32_t v) { fprintf(f, "%u", v); }
+
+// write the shortest decimal number that reads back as the same float
+void writeValue(FILE *f, float v)
+{
+    char buf[32];
+    for (int precision = 6; precision <= 9; ++precision) {
+        snprintf(buf, sizeof(buf), "%.*g", precision, v);
+        if (strtof(buf, nullptr) == v) break;
+    }
+    fputs(buf, f);
+}
+
+template<typename T>
+void writeHeaderArray(FILE *f, const char *type, const std::string &name, const std::vector<T> &values)
+{
+    fprintf(f, "alignas(16) constexpr %s %s[%zu] = {", type, name.c_str(), std::max<size_t>(1, values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+        fprintf(f, i % 8 ? " " : "\n    ");
+        writeValue(f, values[i]);
+        fputc(i + 1 < values.size() ? ',' : '\n', f);
+    }
+    fprintf(f, values.empty() ? "0};\n" : "};\n");
+}
+
+bool writeHeaderFile(const char *file, const char *input, const PolyMesh &mesh, bool positionsOnly)
+{
+    // the name of the input file, without its directory and extension, is the prefix of the arrays
+    std::string fileName(input);
+    fileName = fileName.substr(fileName.find_last_of("/\\") + 1);
+    std::string name = fileName.substr(0, fileName.find('.'));
+    for (char &c : name) if (!isalnum((unsigned char)c)) c = '_';
+    if (name.empty() || isdigit((unsigned char)name[0])) name = "mesh" + name;
+    std::string constName = "k" + name;
+    constName[1] = toupper(constName[1]);
+
+    std::vector<float> vertsX, vertsY, vertsZ, stX, stY;
+    for (const Vec3f &v : mesh.verts) {
+        vertsX.push_back(v.x);
+        vertsY.push_back(v.y);
+        vertsZ.push_back(v.z);
+    }
+    std::unordered_map<uint64_t, uint32_t> stMap;
+    std::vector<uint32_t> stIndex(mesh.st.size());
+    for (size_t i = 0; i < mesh.st.size(); ++i) {
+        uint32_t bits[2];
+        memcpy(bits, &mesh.st[i], sizeof(Vec2f));
+        auto inserted = stMap.insert(std::make_pair(uint64_t(bits[0]) << 32 | bits[1], (uint32_t)stX.size()));
+        if (inserted.second) {
+            stX.push_back(mesh.st[i].x);
+            stY.push_back(mesh.st[i].y);
+        }
+        stIndex[i] = inserted.first->second;
+    }
+    std::vector<uint32_t> trisVertsIndex, trisStIndex;
+    for (uint32_t i = 0, k = 0; i < mesh.faceIndex.size(); ++i) {
+        for (uint32_t j = 0; j < mesh.faceIndex[i] - 2; ++j) {
+            const uint32_t faceVerts[3] = {k, k + j + 1, k + j + 2};
+            for (uint32_t l = 0; l < 3; ++l) {
+                trisVertsIndex.push_back(mesh.vertsIndex[faceVerts[l]]);
+                trisStIndex.push_back(stIndex[faceVerts[l]]);
+            }
+        }
+        k += mesh.faceIndex[i];
+    }
+
+    FILE *f = fopen(file, "w");
+    if (!f) return false;
+    fprintf(f, "// Generated by convertgeometry from %s\n\n", fileName.c_str());
+    fprintf(f, "constexpr uint32_t %sNumVerts = %zu;\n", constName.c_str(), vertsX.size());
+    if (!positionsOnly) {
+        fprintf(f, "constexpr uint32_t %sNumSt = %zu;\n", constName.c_str(), stX.size());
+        fprintf(f, "constexpr uint32_t %sNumTris = %zu;\n", constName.c_str(), trisVertsIndex.size() / 3);
+    }
+    fputc('\n', f);
+    writeHeaderArray(f, "float", name + "VertsX", vertsX);
+    writeHeaderArray(f, "float", name + "VertsY", vertsY);
+    writeHeaderArray(f, "float", name + "VertsZ", vertsZ);
+    if (positionsOnly) {
+        bool ok = !ferror(f);
+        return (fclose(f) == 0) && ok;
+    }
+    writeHeaderArray(f, "float", name + "StX", stX);
+    writeHeaderArray(f, "float", name + "StY", stY);
+    writeHeaderArray(f, "uint32_t", name + "VertsIndex", trisVertsIndex);
+    writeHeaderArray(f, "uint32_t", name + "StIndex", trisStIndex);
+    bool ok = !ferror(f);
+    return (fclose(f) == 0) && ok;
+}
+
+int main(int argc, char **argv)
+{
+    bool compress = argc > 1 && strcmp(argv[1], "-c") == 0;
+    bool positionsOnly = argc > 1 && strcmp(argv[1], "-p") == 0;
+    size_t maxTrisPerCluster = kDefaultMaxTrisPerCluster;
+    int arg = 1 + (compress || positionsOnly);
+    if (argc > 2 && strcmp(argv[1], "-k") == 0) {
+        maxTrisPerCluster = std::max(1, atoi(argv[2]));
+        arg += 2;
+    }
+    if (argc != arg + 2) {
+        std::cerr << "Usage: " << argv[0] << " [-c] input.(geo|obj) output.geob" << std::endl;
+        std::cerr << "       " << argv[0] << " [-k maxTrisPerCluster] input.(geo|obj) output.geoc" << std::endl;
+        std::cerr << "       " << argv[0] << " [-p] input.(geo|obj) output.h" << std::endl;
+        return 1;
+    }
+    const char *input = argv[arg], *output = argv[arg + 1];
+    const char *outputExt = strrchr(output, '.');
+    bool clustered = outputExt && strcmp(outputExt, ".geoc") == 0;
+    bool header = outputExt && strcmp(outputExt, ".h") == 0;
+    const char *ext = strrchr(input, '.');
+    PolyMesh mesh;
+    bool ok = (ext && strcmp(ext, ".obj") == 0) ? readObjFile(input, mesh) : readGeoFile(input, mesh);
+    if (!ok) {
+        std::cerr << "Error: Unable to read " << input << std::endl;
+        return 1;
+    }
+    if (header ? !writeHeaderFile(output, input, mesh, positionsOnly) :
+        clustered ? !writeGeoClusterFile(output, mesh, maxTrisPerCluster) : !writeGeoBinFile(output, mesh, compress)) {
+        std::cerr << "Error: Unable to write " << output << std::endl;
+        return 1;
+    }
+    std::cerr << input << ": " << mesh.faceIndex.size() << " faces, " << mesh.verts.size() << " vertices" << std::endl;
+
+    return 0;
+}
@@ -7,7 +7,7 @@
 //
 // c++ -o loadgeometry loadgeometry.cpp -O3 -std=c++11
 //
-// Run with: ./loadgeometry.
+// Run with: ./loadgeometry [file.geo|file.geob] (binary geob files are written by convertgeometry).
 //[/compile]
 //[ignore]
 // Copyright (C) 2012  www.scratchapixel.com
@@ -30,17 +30,28 @@
 #include <sstream>
 #include <vector>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <chrono>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "geometry.h"
 
 void createMesh(
     const uint32_t nfaces,
-    std::unique_ptr<uint32_t []> &faceIndex,
+    const uint32_t *faceIndex,
     const uint32_t &vertsIndexArraySize,
-    std::unique_ptr<uint32_t []> &vertsIndex,
+    const uint32_t *vertsIndex,
     const uint32_t &versArraySize,
-    std::unique_ptr<Vec3f []> &verts,
-    std::unique_ptr<Vec3f []> &normals,
-    std::unique_ptr<Vec2f []> &st)
+    const Vec3f *verts,
+    const Vec3f *normals,
+    const Vec2f *st)
 {}
 
 // [comment]
@@ -75,7 +86,6 @@ void loadGeoFile(const char *file)
         for (uint32_t i = 0; i < numFaces; ++i) {
             ss >> faceIndex[i];
             vertsIndexArraySize += faceIndex[i];
-            std::cerr << faceIndex[i] << std::endl;
         }
         std::cerr << "Verts index array size " << vertsIndexArraySize << std::endl;
         std::unique_ptr<uint32_t []> vertsIndex(new uint32_t[vertsIndexArraySize]);
@@ -84,7 +94,6 @@ void loadGeoFile(const char *file)
         for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
             ss >> vertsIndex[i];
             if (vertsIndex[i] > vertsArraySize) vertsArraySize = vertsIndex[i];
-            std::cerr << vertsIndex[i] << std::endl;
         }
         vertsArraySize += 1;
         std::cerr << "Max verts index " << vertsArraySize << std::endl;
@@ -92,24 +101,19 @@ void loadGeoFile(const char *file)
         std::unique_ptr<Vec3f []> verts(new Vec3f[vertsArraySize]);
         for (uint32_t i = 0; i < vertsArraySize; ++i) {
             ss >> verts[i].x >> verts[i].y >> verts[i].z;
-            std::cerr << verts[i] << std::endl;
         }
         // reading normals
-        std::cerr << "Reading normals\n";
         std::unique_ptr<Vec3f []> normals(new Vec3f[vertsIndexArraySize]);
         for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
             ss >> normals[i].x >> normals[i].y >> normals[i].z;
-            std::cerr << normals[i] << std::endl;
         }
         // reading st coordinates
-        std::cerr << "Reading texture coordinates\n";
         std::unique_ptr<Vec2f []> st(new Vec2f[vertsIndexArraySize]);
         for (uint32_t i = 0; i < vertsIndexArraySize; ++i) {
             ss >> st[i].x >> st[i].y;
-            std::cerr << st[i] << std::endl;
         }
         
-        createMesh(numFaces, faceIndex, vertsIndexArraySize, vertsIndex, vertsArraySize, verts, normals, st);
+        createMesh(numFaces, faceIndex.get(), vertsIndexArraySize, vertsIndex.get(), vertsArraySize, verts.get(), normals.get(), st.get());
     }
     catch (...) {
         ifs.close();
@@ -117,9 +121,148 @@ void loadGeoFile(const char *file)
     ifs.close();
 }
 
+// [comment]
+// Binary version of the geo file (geob), see convertgeometry.cpp. The header gives
+// the offset of each array from the start of the file, so loading the mesh is just mapping the
+// file in memory and adding these offsets to the address of the mapping, there's nothing to parse.
+// Only the index arrays need decoding when the file is compressed.
+// [/comment]
+static const char kGeoBinMagic[4] = {'G', 'E', 'O', 'B'};
+static const uint32_t kGeoBinVersion = 1;
+static const uint32_t kGeoBinCompressedIndices = 1;
+
+struct GeoBinHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numFaces;
+    uint32_t vertsIndexArraySize;
+    uint32_t vertsArraySize;
+    uint64_t faceIndexOffset, faceIndexBytes;
+    uint64_t vertsIndexOffset, vertsIndexBytes;
+    uint64_t vertsOffset;
+    uint64_t normalsOffset;
+    uint64_t stOffset;
+};
+
+struct MappedFile
+{
+    MappedFile(const char *file)
+    {
+#ifdef _WIN32
+        std::ifstream ifs(file, std::ios::binary);
+        if (ifs.fail()) return;
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data = (const uint8_t*)contents.data();
+        size = contents.size();
+#else
+        int fd = open(file, O_RDONLY);
+        struct stat st;
+        if (fd == -1) return;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data = (const uint8_t*)mapping;
+                size = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data) munmap((void*)data, size);
+#endif
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::string contents;
+#endif
+};
+
+// decode the delta encoded, variable length indices of a compressed file
+bool decodeIndices(const uint8_t *p, const uint8_t *end, uint32_t count, uint32_t *indices)
+{
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t v = 0;
+        for (uint32_t shift = 0; ; shift += 7) {
+            if (p == end || shift > 28) return false;
+            uint8_t byte = *p++;
+            v |= uint32_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        prev += (v >> 1) ^ (0u - (v & 1));
+        indices[i] = prev;
+    }
+    return true;
+}
+
+void loadGeoBinFile(const char *file)
+{
+    MappedFile mapped(file);
+    const GeoBinHeader *header = (const GeoBinHeader*)mapped.data;
+    if (mapped.size < sizeof(GeoBinHeader) || memcmp(header->magic, kGeoBinMagic, 4) != 0 ||
+        header->version != kGeoBinVersion) {
+        std::cerr << "Error: " << file << " is not a geob file" << std::endl;
+        return;
+    }
+    bool compressed = header->flags & kGeoBinCompressedIndices;
+    uint64_t faceIndexBytes = compressed ? header->faceIndexBytes : header->numFaces * sizeof(uint32_t);
+    uint64_t vertsIndexBytes = compressed ? header->vertsIndexBytes : header->vertsIndexArraySize * sizeof(uint32_t);
+    const uint64_t arrays[5][2] = {
+        {header->faceIndexOffset, faceIndexBytes},
+        {header->vertsIndexOffset, vertsIndexBytes},
+        {header->vertsOffset, header->vertsArraySize * sizeof(Vec3f)},
+        {header->normalsOffset, header->vertsIndexArraySize * sizeof(Vec3f)},
+        {header->stOffset, header->vertsIndexArraySize * sizeof(Vec2f)}};
+    for (uint32_t i = 0; i < 5; ++i) {
+        if (arrays[i][0] % 4 != 0 || arrays[i][0] > mapped.size || arrays[i][1] > mapped.size - arrays[i][0]) {
+            std::cerr << "Error: " << file << " is truncated" << std::endl;
+            return;
+        }
+    }
+    // [comment]
+    // The arrays are used in place, only the index arrays of a compressed file need decoding
+    // [/comment]
+    const uint32_t *faceIndex = (const uint32_t*)(mapped.data + header->faceIndexOffset);
+    const uint32_t *vertsIndex = (const uint32_t*)(mapped.data + header->vertsIndexOffset);
+    std::unique_ptr<uint32_t []> decodedFaceIndex, decodedVertsIndex;
+    if (compressed) {
+        decodedFaceIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->numFaces]);
+        decodedVertsIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->vertsIndexArraySize]);
+        if (!decodeIndices(mapped.data + header->faceIndexOffset, mapped.data + header->faceIndexOffset + faceIndexBytes,
+                           header->numFaces, decodedFaceIndex.get()) ||
+            !decodeIndices(mapped.data + header->vertsIndexOffset, mapped.data + header->vertsIndexOffset + vertsIndexBytes,
+                           header->vertsIndexArraySize, decodedVertsIndex.get())) {
+            std::cerr << "Error: " << file << " is corrupted" << std::endl;
+            return;
+        }
+        faceIndex = decodedFaceIndex.get();
+        vertsIndex = decodedVertsIndex.get();
+    }
+    std::cerr << "Mesh has " << header->numFaces << " faces " << std::endl;
+    std::cerr << "Verts index array size " << header->vertsIndexArraySize << std::endl;
+    std::cerr << "Max verts index " << header->vertsArraySize << std::endl;
+
+    createMesh(header->numFaces, faceIndex, header->vertsIndexArraySize, vertsIndex, header->vertsArraySize,
+        (const Vec3f*)(mapped.data + header->vertsOffset),
+        (const Vec3f*)(mapped.data + header->normalsOffset),
+        (const Vec2f*)(mapped.data + header->stOffset));
+}
+
 int main(int argc, char **argv)
 {
-    loadGeoFile("./test.geo");
+    const char *file = argc > 1 ? argv[1] : "./test.geo";
+    const char *ext = strrchr(file, '.');
+    auto start = std::chrono::high_resolution_clock::now();
+    if (ext && strcmp(ext, ".geob") == 0) loadGeoBinFile(file);
+    else loadGeoFile(file);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cerr << "Loaded in " << std::chrono::duration<double, std::micro>(end - start).count() << " us" << std::endl;
 
     return 0;
 }
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <chrono>
 #include <sstream>
+#include <memory>
 
 //#include "cow.h"
 
@@ -142,6 +143,47 @@ float max3(const float &a, const float &b, const float &c)
 float edgeFunction(const Vec3f &a, const Vec3f &b, const Vec3f &c)
 { return (c[0] - a[0]) * (b[1] - a[1]) - (c[1] - a[1]) * (b[0] - a[0]); }
 
+//[comment]
+// The edge functions are evaluated with integers. The vertices are snapped to 1/256th of a pixel
+// which makes the edge functions exact: stepping from one pixel (or block of pixels) to the next by
+// adding a constant gives exactly the value we would get by evaluating the function from scratch.
+// Pixels lying exactly on an edge shared by two triangles are given to only one of them (top-left
+// rule). Triangles with vertices further than guardBand pixels from the screen are skipped so that
+// the edge functions can't overflow.
+//[/comment]
+const int64_t subPixelBits = 8;
+const int64_t subPixelScale = 1 << subPixelBits;
+const float guardBand = 1 << 20;
+const uint32_t blockSize = 4;
+const uint32_t blockPixels = blockSize * blockSize;
+
+//[comment]
+// E(x, y) = a * x + b * y + c at the center of pixel (x, y). Positive inside the triangle.
+// The bias (0 for top and left edges, 1 otherwise) is already subtracted from c.
+//[/comment]
+struct EdgeEquation
+{
+    int64_t a, b, c;
+    int64_t bias;
+};
+
+//[comment]
+// Set up the edge function of the edge going from (ax, ay) to (bx, by), in fixed-point raster
+// coordinates. This is edgeFunction() rewritten so that it only depends on the pixel coordinates.
+// The interior of the triangle is on the right of a left edge (dy > 0 in raster space) and below
+// a top edge (horizontal edge with dx < 0). Samples lying on any other edge are not covered.
+//[/comment]
+void setupEdge(const int64_t &ax, const int64_t &ay, const int64_t &bx, const int64_t &by, EdgeEquation &e)
+{
+    int64_t dx = bx - ax, dy = by - ay;
+    e.a = dy * subPixelScale;
+    e.b = -dx * subPixelScale;
+    e.c = (dy - dx) * (subPixelScale / 2) - ax * dy + ay * dx;
+    bool topLeft = (dy > 0) || (dy == 0 && dx < 0);
+    e.bias = topLeft ? 0 : 1;
+    e.c -= e.bias;
+}
+
 const uint32_t imageWidth = 640;
 const uint32_t imageHeight = 480;
 const Matrix44f worldToCamera = {0.707107, -0.331295, 0.624695, 0, 0, 0.883452, 0.468521, 0, -0.707107, -0.331295, 0.624695, 0, -1.63871, -5.747777, -40.400412, 1};
@@ -277,84 +319,139 @@ int main(int argc, char **argv)
         // the triangle is out of screen
         if (xmin > imageWidth - 1 || xmax < 0 || ymin > imageHeight - 1 || ymax < 0) continue;
 
+        if (std::max(-xmin, xmax) > guardBand || std::max(-ymin, ymax) > guardBand) continue;
+
         // be careful xmin/xmax/ymin/ymax can be negative. Don't cast to uint32_t
         uint32_t x0 = std::max(int32_t(0), (int32_t)(std::floor(xmin)));
         uint32_t x1 = std::min(int32_t(imageWidth) - 1, (int32_t)(std::floor(xmax)));
         uint32_t y0 = std::max(int32_t(0), (int32_t)(std::floor(ymin)));
         uint32_t y1 = std::min(int32_t(imageHeight) - 1, (int32_t)(std::floor(ymax)));
 
-        float area = edgeFunction(v0Raster, v1Raster, v2Raster);
+        // [comment]
+        // Snap the vertices to the sub-pixel grid and set up the edge equations once per triangle.
+        // Back-facing and degenerate triangles can't pass the coverage test.
+        // [/comment]
+        int64_t fx[3], fy[3];
+        const Vec3f *vRaster[3] = {&v0Raster, &v1Raster, &v2Raster};
+        for (uint32_t k = 0; k < 3; ++k) {
+            fx[k] = (int64_t)std::floor(vRaster[k]->x * subPixelScale + 0.5f);
+            fy[k] = (int64_t)std::floor(vRaster[k]->y * subPixelScale + 0.5f);
+        }
+        int64_t area = (fx[2] - fx[0]) * (fy[1] - fy[0]) - (fy[2] - fy[0]) * (fx[1] - fx[0]);
+        if (area <= 0) continue;
+        float invArea = 1.f / area;
+        EdgeEquation edges[3];
+        setupEdge(fx[1], fy[1], fx[2], fy[2], edges[0]);
+        setupEdge(fx[2], fy[2], fx[0], fy[0], edges[1]);
+        setupEdge(fx[0], fy[0], fx[1], fy[1], edges[2]);
+
+        // [comment]
+        // Offset of each pixel of a 4x4 block relative to the block's top-left pixel. The edge
+        // functions being linear, their smallest and largest values over a block are found by
+        // adding the smallest and largest offsets to the value at the block's top-left pixel.
+        // [/comment]
+        int64_t offsets[3][blockPixels], minOffset[3], maxOffset[3], eRow[3];
+        for (uint32_t k = 0; k < 3; ++k) {
+            for (uint32_t j = 0; j < blockPixels; ++j) {
+                offsets[k][j] = edges[k].a * (j % blockSize) + edges[k].b * (j / blockSize);
+            }
+            minOffset[k] = std::min(int64_t(0), edges[k].a * (blockSize - 1)) + std::min(int64_t(0), edges[k].b * (blockSize - 1));
+            maxOffset[k] = std::max(int64_t(0), edges[k].a * (blockSize - 1)) + std::max(int64_t(0), edges[k].b * (blockSize - 1));
+        }
+        // align the bounding box on the block grid
+        x0 &= ~(blockSize - 1);
+        y0 &= ~(blockSize - 1);
+        for (uint32_t k = 0; k < 3; ++k) eRow[k] = edges[k].a * x0 + edges[k].b * y0 + edges[k].c;
         
         // [comment]
-        // Inner loop
+        // Inner loop. Blocks entirely outside one of the edges are rejected, blocks entirely inside
+        // the three edges are accepted without testing their pixels, and for the others, the 16
+        // pixels are tested at once. Moving to the next block only requires additions.
         // [/comment]
-        for (uint32_t y = y0; y <= y1; ++y) {
-            for (uint32_t x = x0; x <= x1; ++x) {
-                Vec3f pixelSample(x + 0.5, y + 0.5, 0);
-                float w0 = edgeFunction(v1Raster, v2Raster, pixelSample);
-                float w1 = edgeFunction(v2Raster, v0Raster, pixelSample);
-                float w2 = edgeFunction(v0Raster, v1Raster, pixelSample);
-                if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
-                    w0 /= area;
-                    w1 /= area;
-                    w2 /= area;
-                    float oneOverZ = v0Raster.z * w0 + v1Raster.z * w1 + v2Raster.z * w2;
-                    float z = 1 / oneOverZ;
-                    // [comment]
-                    // Depth-buffer test
-                    // [/comment]
-                    if (z < depthBuffer[y * imageWidth + x]) {
-                        depthBuffer[y * imageWidth + x] = z;
+        for (uint32_t by = y0; by <= y1; by += blockSize) {
+            int64_t e[3] = {eRow[0], eRow[1], eRow[2]};
+            for (uint32_t bx = x0; bx <= x1; bx += blockSize) {
+                bool reject = (e[0] + maxOffset[0] < 0) | (e[1] + maxOffset[1] < 0) | (e[2] + maxOffset[2] < 0);
+                bool accept = (e[0] + minOffset[0] >= 0) & (e[1] + minOffset[1] >= 0) & (e[2] + minOffset[2] >= 0);
+                if (!reject) {
+                    int64_t w[3][blockPixels];
+                    uint32_t mask = 0;
+                    for (uint32_t j = 0; j < blockPixels; ++j) {
+                        w[0][j] = e[0] + offsets[0][j];
+                        w[1][j] = e[1] + offsets[1][j];
+                        w[2][j] = e[2] + offsets[2][j];
+                        uint32_t inside = accept | ((w[0][j] | w[1][j] | w[2][j]) >= 0);
+                        // pixels outside the (clipped) bounding box are masked out
+                        mask |= (inside & (bx + j % blockSize <= x1) & (by + j / blockSize <= y1)) << j;
+                    }
+                    // process the covered pixels only
+                    while (mask) {
+                        uint32_t j = __builtin_ctz(mask);
+                        mask &= mask - 1;
+                        uint32_t x = bx + j % blockSize, y = by + j / blockSize;
+                        float w0 = (w[0][j] + edges[0].bias) * invArea;
+                        float w1 = (w[1][j] + edges[1].bias) * invArea;
+                        float w2 = (w[2][j] + edges[2].bias) * invArea;
+                        float oneOverZ = v0Raster.z * w0 + v1Raster.z * w1 + v2Raster.z * w2;
+                        float z = 1 / oneOverZ;
+                        // [comment]
+                        // Depth-buffer test
+                        // [/comment]
+                        if (z < depthBuffer[y * imageWidth + x]) {
+                            depthBuffer[y * imageWidth + x] = z;
                         
-                        Vec2f st = st0 * w0 + st1 * w1 + st2 * w2;
+                            Vec2f st = st0 * w0 + st1 * w1 + st2 * w2;
                         
-                        st *= z;
+                            st *= z;
                         
-                        // [comment]
-                        // If you need to compute the actual position of the shaded
-                        // point in camera space. Proceed like with the other vertex attribute.
-                        // Divide the point coordinates by the vertex z-coordinate then
-                        // interpolate using barycentric coordinates and finally multiply
-                        // by sample depth.
-                        // [/comment]
-                        Vec3f v0Cam, v1Cam, v2Cam;
-                        worldToCamera.multVecMatrix(v0, v0Cam);
-                        worldToCamera.multVecMatrix(v1, v1Cam);
-                        worldToCamera.multVecMatrix(v2, v2Cam);
+                            // [comment]
+                            // If you need to compute the actual position of the shaded
+                            // point in camera space. Proceed like with the other vertex attribute.
+                            // Divide the point coordinates by the vertex z-coordinate then
+                            // interpolate using barycentric coordinates and finally multiply
+                            // by sample depth.
+                            // [/comment]
+                            Vec3f v0Cam, v1Cam, v2Cam;
+                            worldToCamera.multVecMatrix(v0, v0Cam);
+                            worldToCamera.multVecMatrix(v1, v1Cam);
+                            worldToCamera.multVecMatrix(v2, v2Cam);
                         
-                        float px = (v0Cam.x/-v0Cam.z) * w0 + (v1Cam.x/-v1Cam.z) * w1 + (v2Cam.x/-v2Cam.z) * w2;
-                        float py = (v0Cam.y/-v0Cam.z) * w0 + (v1Cam.y/-v1Cam.z) * w1 + (v2Cam.y/-v2Cam.z) * w2;
+                            float px = (v0Cam.x/-v0Cam.z) * w0 + (v1Cam.x/-v1Cam.z) * w1 + (v2Cam.x/-v2Cam.z) * w2;
+                            float py = (v0Cam.y/-v0Cam.z) * w0 + (v1Cam.y/-v1Cam.z) * w1 + (v2Cam.y/-v2Cam.z) * w2;
                         
-                        Vec3f pt(px * z, py * z, -z); // pt is in camera space
+                            Vec3f pt(px * z, py * z, -z); // pt is in camera space
                         
-                        // [comment]
-                        // Compute the face normal which is used for a simple facing ratio.
-                        // Keep in mind that we are doing all calculation in camera space.
-                        // Thus the view direction can be computed as the point on the object
-                        // in camera space minus Vec3f(0), the position of the camera in camera
-                        // space.
-                        // [/comment]
-                        Vec3f n = (v1Cam - v0Cam).crossProduct(v2Cam - v0Cam);
-                        n.normalize();
-                        Vec3f viewDirection = -pt;
-                        viewDirection.normalize();
+                            // [comment]
+                            // Compute the face normal which is used for a simple facing ratio.
+                            // Keep in mind that we are doing all calculation in camera space.
+                            // Thus the view direction can be computed as the point on the object
+                            // in camera space minus Vec3f(0), the position of the camera in camera
+                            // space.
+                            // [/comment]
+                            Vec3f n = (v1Cam - v0Cam).crossProduct(v2Cam - v0Cam);
+                            n.normalize();
+                            Vec3f viewDirection = -pt;
+                            viewDirection.normalize();
                         
-                        float nDotView =  std::max(0.f, n.dotProduct(viewDirection));
+                            float nDotView =  std::max(0.f, n.dotProduct(viewDirection));
                         
-                        // [comment]
-                        // The final color is the reuslt of the faction ration multiplied by the
-                        // checkerboard pattern.
-                        // [/comment]
-                        const int M = 10;
-                        float checker = (fmod(st.x * M, 1.0) > 0.5) ^ (fmod(st.y * M, 1.0) < 0.5);
-                        float c = 0.3 * (1 - checker) + 0.7 * checker;
-                        nDotView *= c;
-                        frameBuffer[y * imageWidth + x].x = nDotView * 255;
-                        frameBuffer[y * imageWidth + x].y = nDotView * 255;
-                        frameBuffer[y * imageWidth + x].z = nDotView * 255;
+                            // [comment]
+                            // The final color is the reuslt of the faction ration multiplied by the
+                            // checkerboard pattern.
+                            // [/comment]
+                            const int M = 10;
+                            float checker = (fmod(st.x * M, 1.0) > 0.5) ^ (fmod(st.y * M, 1.0) < 0.5);
+                            float c = 0.3 * (1 - checker) + 0.7 * checker;
+                            nDotView *= c;
+                            frameBuffer[y * imageWidth + x].x = nDotView * 255;
+                            frameBuffer[y * imageWidth + x].y = nDotView * 255;
+                            frameBuffer[y * imageWidth + x].z = nDotView * 255;
+                        }
                     }
                 }
+                for (uint32_t k = 0; k < 3; ++k) e[k] += edges[k].a * blockSize;
             }
+            for (uint32_t k = 0; k < 3; ++k) eRow[k] += edges[k].b * blockSize;
         }
     }
     
@@ -368,7 +465,7 @@ int main(int argc, char **argv)
     std::ofstream ofs;
     ofs.open("./output.ppm");
     ofs << "P6\n" << imageWidth << " " << imageHeight << "\n255\n";
-    ofs.write((char*)frameBuffer, imageWidth * imageWidth * 3);
+    ofs.write((char*)frameBuffer, imageWidth * imageHeight * 3);
     ofs.close();
     
     delete [] frameBuffer;
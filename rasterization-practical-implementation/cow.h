@@ -1,3975 +1,3421 @@
+// Generated by convertgeometry from cow.obj
 
-uint32_t nvertices[9468] = {
-2, 0, 3, 1, 3, 0, 4, 2, 
-5, 3, 5, 2, 6, 4, 7, 5, 
-7, 4, 8, 9, 6, 6, 7, 8, 
-10, 11, 9, 9, 8, 10, 12, 13, 
-1, 1, 0, 12, 14, 15, 54, 13, 
-12, 55, 16, 17, 3, 3, 1, 16, 
-17, 18, 5, 5, 3, 17, 18, 19, 
-7, 7, 5, 18, 19, 20, 8, 8, 
-7, 19, 22, 16, 1, 1, 13, 22, 
-23, 22, 13, 54, 15, 23, 24, 35, 
-20, 21, 20, 35, 35, 24, 26, 28, 
-29, 27, 30, 31, 26, 26, 24, 30, 
-31, 32, 28, 28, 26, 31, 24, 20, 
-33, 34, 33, 19, 20, 19, 33, 34, 
-30, 33, 24, 33, 30, 26, 27, 25, 
-27, 26, 28, 25, 35, 26, 35, 25, 
-21, 18, 36, 19, 34, 19, 36, 17, 
-37, 36, 36, 18, 17, 16, 38, 37, 
-37, 17, 16, 22, 39, 38, 38, 16, 
-22, 23, 40, 95, 39, 22, 95, 53, 
-41, 97, 40, 23, 97, 42, 43, 29, 
-29, 28, 42, 44, 42, 28, 28, 32, 
-44, 45, 46, 31, 31, 30, 45, 46, 
-47, 32, 32, 31, 46, 36, 45, 30, 
-30, 34, 36, 47, 48, 44, 44, 32, 
-47, 49, 50, 46, 46, 45, 49, 50, 
-51, 47, 47, 46, 50, 37, 49, 45, 
-45, 36, 37, 51, 52, 48, 48, 47, 
-51, 15, 53, 23, 13, 54, 23, 14, 
-54, 55, 55, 54, 13, 49, 57, 50, 
-57, 49, 56, 57, 58, 51, 51, 50, 
-57, 58, 59, 52, 52, 51, 58, 38, 
-56, 49, 49, 37, 38, 56, 61, 57, 
-61, 56, 60, 57, 62, 58, 62, 57, 
-61, 62, 63, 59, 39, 60, 56, 56, 
-38, 39, 64, 65, 101, 101, 94, 86, 
-65, 66, 100, 66, 84, 100, 63, 62, 
-100, 65, 64, 76, 69, 70, 78, 66, 
-65, 77, 67, 66, 78, 72, 73, 69, 
-69, 68, 72, 73, 74, 70, 70, 69, 
-73, 74, 75, 71, 71, 70, 74, 77, 
-76, 68, 66, 77, 78, 78, 77, 69, 
-67, 78, 174, 174, 78, 70, 99, 80, 
-71, 71, 75, 79, 80, 81, 173, 81, 
-82, 173, 67, 173, 82, 77, 65, 76, 
-69, 77, 68, 59, 58, 62, 59, 63, 
-83, 85, 83, 63, 63, 84, 85, 84, 
-67, 82, 66, 67, 84, 82, 85, 84, 
-61, 94, 101, 62, 61, 101, 87, 88, 
-48, 48, 52, 87, 87, 52, 59, 43, 
-42, 89, 44, 90, 89, 89, 42, 44, 
-48, 91, 90, 90, 44, 48, 88, 92, 
-91, 91, 48, 88, 43, 93, 29, 95, 
-22, 23, 61, 60, 94, 53, 97, 23, 
-82, 98, 96, 96, 85, 82, 98, 64, 
-86, 86, 96, 98, 98, 82, 81, 81, 
-76, 64, 64, 98, 81, 80, 68, 76, 
-76, 81, 80, 68, 80, 99, 79, 99, 
-71, 68, 99, 72, 100, 84, 63, 65, 
-100, 101, 101, 86, 64, 62, 101, 100, 
-83, 102, 59, 87, 59, 102, 103, 83, 
-85, 85, 96, 103, 94, 103, 96, 96, 
-86, 94, 103, 104, 102, 102, 83, 103, 
-94, 105, 104, 104, 103, 94, 94, 60, 
-105, 106, 125, 2, 0, 2, 125, 108, 
-106, 2, 2, 4, 108, 109, 108, 4, 
-4, 6, 109, 110, 109, 6, 6, 9, 
-110, 111, 110, 9, 9, 11, 111, 107, 
-112, 12, 12, 0, 107, 112, 113, 55, 
-55, 12, 112, 113, 114, 14, 14, 55, 
-113, 115, 116, 123, 106, 108, 117, 118, 
-117, 108, 108, 109, 118, 119, 118, 109, 
-109, 110, 119, 120, 119, 110, 110, 111, 
-120, 114, 113, 135, 124, 122, 123, 117, 
-115, 122, 123, 122, 115, 125, 106, 124, 
-117, 122, 106, 124, 106, 122, 125, 107, 
-0, 107, 125, 124, 127, 126, 123, 124, 
-123, 126, 129, 128, 127, 126, 127, 128, 
-116, 130, 127, 127, 123, 116, 130, 131, 
-129, 129, 127, 130, 124, 126, 107, 132, 
-107, 126, 126, 128, 132, 130, 116, 133, 
-133, 134, 131, 131, 130, 133, 121, 114, 
-135, 135, 113, 112, 132, 112, 107, 112, 
-132, 135, 135, 132, 136, 137, 138, 128, 
-128, 129, 137, 139, 137, 129, 129, 131, 
-139, 140, 139, 131, 131, 134, 140, 138, 
-136, 132, 132, 128, 138, 139, 140, 121, 
-141, 142, 121, 121, 135, 141, 143, 141, 
-135, 135, 136, 143, 144, 145, 138, 138, 
-137, 144, 146, 144, 137, 137, 139, 146, 
-145, 143, 136, 136, 138, 145, 142, 146, 
-139, 139, 121, 142, 147, 148, 142, 142, 
-141, 147, 149, 147, 141, 141, 143, 149, 
-150, 151, 145, 145, 144, 150, 152, 150, 
-144, 144, 146, 152, 151, 149, 143, 143, 
-145, 151, 148, 152, 146, 146, 142, 148, 
-153, 154, 148, 148, 147, 153, 155, 153, 
-147, 147, 149, 155, 156, 157, 151, 151, 
-150, 156, 158, 156, 150, 150, 152, 158, 
-157, 155, 149, 149, 151, 157, 154, 158, 
-152, 152, 148, 154, 159, 160, 156, 156, 
-158, 159, 160, 159, 161, 162, 163, 161, 
-160, 164, 157, 157, 156, 160, 164, 165, 
-157, 155, 157, 165, 164, 160, 161, 164, 
-166, 165, 163, 167, 164, 164, 161, 163, 
-154, 168, 159, 159, 158, 154, 161, 159, 
-168, 168, 169, 162, 162, 161, 168, 154, 
-153, 165, 165, 168, 154, 168, 165, 170, 
-153, 155, 165, 166, 170, 165, 167, 171, 
-166, 166, 164, 167, 172, 169, 168, 168, 
-170, 172, 171, 172, 170, 170, 166, 171, 
-167, 169, 172, 172, 171, 167, 163, 162, 
-169, 169, 167, 163, 21, 10, 8, 8, 
-20, 21, 71, 173, 174, 67, 174, 173, 
-71, 174, 70, 173, 71, 80, 175, 176, 
-73, 73, 72, 175, 176, 175, 177, 178, 
-179, 177, 176, 180, 74, 74, 73, 176, 
-180, 181, 74, 75, 74, 181, 180, 176, 
-177, 180, 182, 181, 179, 183, 180, 180, 
-177, 179, 99, 184, 175, 175, 72, 99, 
-177, 175, 184, 184, 185, 178, 178, 177, 
-184, 99, 79, 181, 181, 184, 99, 184, 
-181, 186, 79, 75, 181, 182, 186, 181, 
-183, 187, 182, 182, 180, 183, 188, 185, 
-184, 184, 186, 188, 187, 188, 186, 186, 
-182, 187, 183, 185, 188, 188, 187, 183, 
-179, 178, 185, 185, 183, 179, 189, 190, 
-117, 117, 118, 189, 191, 189, 118, 118, 
-119, 191, 192, 191, 119, 119, 120, 192, 
-193, 194, 205, 195, 193, 189, 189, 191, 
-195, 196, 195, 191, 191, 192, 196, 197, 
-198, 194, 194, 193, 197, 199, 197, 193, 
-193, 195, 199, 200, 199, 195, 195, 196, 
-200, 201, 202, 198, 198, 197, 201, 199, 
-201, 197, 201, 199, 203, 204, 203, 199, 
-199, 200, 204, 190, 189, 205, 205, 189, 
-193, 206, 207, 205, 205, 194, 206, 208, 
-206, 194, 194, 198, 208, 209, 208, 198, 
-198, 202, 209, 210, 211, 215, 207, 206, 
-214, 208, 214, 206, 214, 208, 212, 213, 
-212, 208, 208, 209, 213, 207, 214, 215, 
-212, 210, 214, 215, 214, 210, 216, 115, 
-117, 117, 190, 216, 207, 216, 190, 190, 
-205, 207, 217, 133, 115, 115, 216, 217, 
-215, 217, 216, 216, 207, 215, 218, 219, 
-215, 215, 211, 218, 220, 134, 133, 133, 
-217, 220, 219, 220, 217, 217, 215, 219, 
-221, 222, 219, 219, 218, 221, 114, 121, 
-222, 222, 221, 114, 140, 134, 220, 140, 
-222, 121, 222, 140, 220, 220, 219, 222, 
-223, 224, 309, 203, 204, 334, 225, 226, 
-224, 224, 223, 225, 227, 228, 226, 226, 
-225, 227, 229, 230, 228, 228, 227, 229, 
-229, 231, 230, 232, 233, 231, 231, 229, 
-232, 234, 235, 233, 233, 232, 234, 236, 
-237, 235, 235, 234, 236, 238, 239, 237, 
-237, 236, 238, 240, 241, 239, 239, 238, 
-240, 242, 243, 241, 241, 240, 242, 244, 
-245, 243, 243, 242, 244, 246, 247, 237, 
-237, 239, 246, 248, 249, 247, 247, 246, 
-248, 247, 250, 235, 235, 237, 247, 247, 
-251, 250, 249, 252, 251, 251, 247, 249, 
-253, 254, 230, 230, 231, 253, 255, 256, 
-254, 254, 253, 255, 228, 230, 254, 257, 
-258, 256, 256, 255, 257, 257, 252, 258, 
-252, 257, 251, 259, 260, 202, 202, 201, 
-259, 261, 259, 201, 201, 203, 261, 260, 
-262, 209, 209, 202, 260, 262, 263, 213, 
-213, 209, 262, 258, 252, 270, 260, 259, 
-258, 259, 261, 256, 270, 271, 262, 264, 
-265, 263, 263, 262, 264, 266, 267, 272, 
-272, 248, 266, 267, 264, 271, 252, 249, 
-272, 268, 269, 267, 267, 266, 268, 269, 
-265, 264, 264, 267, 269, 259, 256, 258, 
-260, 258, 270, 262, 260, 270, 252, 271, 
-270, 267, 271, 272, 272, 271, 252, 248, 
-272, 249, 264, 262, 271, 115, 133, 116, 
-275, 276, 274, 274, 273, 275, 277, 278, 
-273, 273, 274, 277, 279, 255, 278, 278, 
-277, 279, 250, 280, 276, 276, 275, 250, 
-281, 282, 280, 280, 250, 281, 283, 284, 
-282, 282, 281, 283, 285, 279, 284, 284, 
-283, 285, 279, 285, 255, 233, 235, 275, 
-275, 273, 233, 231, 233, 273, 273, 278, 
-231, 255, 253, 278, 250, 275, 235, 250, 
-251, 281, 283, 281, 251, 251, 257, 283, 
-285, 283, 257, 255, 285, 257, 253, 231, 
-278, 286, 288, 239, 239, 241, 286, 241, 
-287, 286, 287, 241, 243, 293, 289, 248, 
-248, 246, 293, 290, 266, 248, 248, 289, 
-290, 291, 292, 295, 289, 293, 294, 292, 
-291, 289, 288, 246, 239, 288, 293, 246, 
-289, 294, 292, 243, 245, 295, 295, 245, 
-291, 296, 297, 268, 268, 266, 296, 298, 
-299, 297, 297, 296, 298, 266, 290, 296, 
-290, 289, 298, 298, 296, 290, 245, 244, 
-300, 300, 301, 289, 289, 291, 300, 291, 
-245, 300, 302, 303, 299, 299, 298, 302, 
-301, 302, 298, 298, 289, 301, 301, 300, 
-303, 303, 302, 301, 304, 305, 226, 226, 
-228, 304, 254, 304, 228, 304, 254, 306, 
-305, 307, 224, 305, 224, 226, 307, 309, 
-224, 309, 307, 308, 203, 334, 310, 223, 
-309, 334, 308, 311, 310, 310, 309, 308, 
-312, 313, 311, 311, 308, 312, 314, 315, 
-313, 313, 312, 314, 316, 317, 315, 315, 
-314, 316, 318, 261, 311, 311, 313, 319, 
-319, 318, 311, 313, 315, 319, 320, 319, 
-315, 315, 317, 320, 321, 322, 317, 317, 
-316, 321, 320, 317, 322, 323, 324, 312, 
-312, 308, 323, 324, 325, 314, 314, 312, 
-324, 325, 326, 316, 316, 314, 325, 327, 
-328, 319, 319, 320, 327, 322, 321, 329, 
-326, 329, 321, 321, 316, 326, 329, 327, 
-320, 320, 322, 329, 330, 331, 261, 261, 
-318, 330, 328, 330, 318, 318, 319, 328, 
-330, 333, 331, 333, 330, 332, 328, 332, 
-330, 332, 328, 327, 326, 325, 333, 333, 
-332, 326, 329, 326, 332, 332, 327, 329, 
-331, 333, 324, 333, 325, 324, 331, 256, 
-261, 256, 331, 324, 324, 323, 256, 261, 
-203, 310, 310, 311, 261, 334, 309, 310, 
-256, 306, 254, 306, 256, 323, 288, 286, 
-335, 286, 287, 335, 287, 243, 335, 295, 
-292, 335, 294, 293, 335, 293, 288, 335, 
-292, 294, 335, 243, 295, 335, 274, 276, 
-336, 277, 274, 336, 279, 277, 336, 276, 
-280, 336, 280, 282, 336, 282, 284, 336, 
-284, 279, 336, 337, 338, 27, 27, 29, 
-337, 25, 27, 338, 339, 340, 29, 29, 
-93, 339, 29, 341, 337, 341, 29, 340, 
-342, 343, 340, 340, 339, 342, 343, 344, 
-341, 341, 340, 343, 345, 346, 343, 343, 
-342, 345, 346, 347, 344, 344, 343, 346, 
-348, 349, 346, 346, 345, 348, 349, 350, 
-347, 347, 346, 349, 351, 352, 349, 349, 
-348, 351, 352, 353, 350, 350, 349, 352, 
-354, 355, 352, 352, 351, 354, 352, 355, 
-356, 356, 353, 352, 358, 357, 305, 305, 
-304, 358, 361, 359, 358, 358, 360, 361, 
-362, 363, 359, 359, 361, 362, 365, 364, 
-363, 365, 363, 362, 306, 360, 358, 358, 
-304, 306, 366, 360, 306, 306, 323, 366, 
-367, 361, 360, 360, 366, 367, 361, 367, 
-368, 362, 361, 368, 362, 368, 369, 371, 
-373, 367, 367, 366, 371, 308, 371, 366, 
-366, 323, 308, 372, 369, 368, 368, 370, 
-372, 369, 372, 365, 373, 371, 374, 374, 
-375, 373, 370, 373, 375, 375, 376, 370, 
-308, 307, 374, 374, 371, 308, 370, 376, 
-377, 377, 372, 370, 359, 363, 364, 364, 
-378, 359, 378, 375, 374, 374, 357, 378, 
-374, 307, 305, 305, 357, 374, 364, 377, 
-376, 377, 364, 365, 372, 377, 365, 362, 
-369, 365, 359, 378, 357, 357, 358, 359, 
-367, 373, 370, 370, 368, 367, 376, 375, 
-378, 378, 364, 376, 92, 88, 384, 384, 
-385, 92, 385, 384, 386, 386, 387, 385, 
-387, 386, 388, 388, 389, 387, 389, 388, 
-390, 390, 391, 389, 88, 87, 384, 87, 
-392, 384, 386, 384, 392, 87, 379, 392, 
-392, 388, 386, 381, 382, 379, 388, 392, 
-382, 382, 390, 388, 392, 379, 382, 380, 
-39, 393, 393, 381, 380, 381, 393, 394, 
-394, 383, 381, 406, 407, 405, 401, 406, 
-405, 396, 406, 401, 395, 396, 401, 404, 
-408, 383, 404, 383, 394, 407, 408, 404, 
-404, 405, 407, 393, 39, 95, 40, 393, 
-95, 393, 40, 394, 97, 41, 395, 401, 
-402, 395, 402, 97, 395, 391, 390, 397, 
-397, 398, 391, 382, 397, 390, 409, 382, 
-383, 380, 399, 39, 380, 400, 399, 379, 
-87, 400, 400, 380, 379, 383, 382, 381, 
-379, 380, 381, 97, 402, 403, 40, 97, 
-403, 394, 40, 403, 404, 394, 403, 383, 
-408, 409, 397, 382, 409, 410, 397, 409, 
-398, 397, 410, 396, 398, 410, 406, 396, 
-410, 411, 416, 417, 417, 412, 411, 412, 
-417, 418, 418, 413, 412, 413, 418, 419, 
-419, 414, 413, 414, 419, 420, 420, 415, 
-414, 415, 420, 416, 416, 411, 415, 416, 
-407, 406, 406, 417, 416, 417, 406, 410, 
-410, 418, 417, 418, 410, 409, 409, 419, 
-418, 419, 409, 408, 408, 420, 419, 420, 
-408, 407, 407, 416, 420, 411, 412, 421, 
-412, 413, 421, 413, 414, 421, 414, 415, 
-421, 415, 411, 421, 422, 427, 428, 428, 
-423, 422, 423, 428, 429, 429, 424, 423, 
-424, 429, 430, 430, 425, 424, 425, 430, 
-431, 431, 426, 425, 426, 431, 427, 427, 
-422, 426, 427, 405, 404, 404, 428, 427, 
-428, 404, 403, 403, 429, 428, 429, 403, 
-402, 402, 430, 429, 430, 402, 401, 401, 
-431, 430, 431, 401, 405, 405, 427, 431, 
-422, 423, 432, 423, 424, 432, 424, 425, 
-432, 425, 426, 432, 426, 422, 432, 436, 
-433, 435, 433, 436, 434, 438, 435, 437, 
-435, 438, 436, 440, 437, 439, 437, 440, 
-438, 439, 442, 441, 441, 440, 439, 442, 
-444, 443, 443, 441, 442, 434, 446, 445, 
-445, 433, 434, 487, 448, 447, 488, 445, 
-446, 436, 450, 449, 449, 434, 436, 438, 
-451, 450, 450, 436, 438, 440, 452, 451, 
-451, 438, 440, 441, 453, 452, 452, 440, 
-441, 434, 449, 455, 455, 446, 434, 446, 
-455, 456, 456, 448, 487, 453, 468, 457, 
-468, 453, 454, 459, 457, 468, 460, 462, 
-461, 459, 464, 463, 463, 457, 459, 461, 
-465, 464, 464, 459, 461, 466, 453, 457, 
-452, 466, 467, 466, 452, 453, 466, 463, 
-467, 463, 466, 457, 458, 460, 459, 461, 
-459, 460, 459, 468, 458, 454, 458, 468, 
-452, 469, 451, 469, 452, 467, 469, 470, 
-450, 450, 451, 469, 470, 471, 449, 449, 
-450, 470, 471, 472, 455, 455, 449, 471, 
-528, 473, 456, 528, 455, 472, 530, 474, 
-486, 530, 456, 473, 462, 476, 475, 475, 
-461, 462, 461, 475, 477, 477, 465, 461, 
-464, 479, 478, 478, 463, 464, 465, 480, 
-479, 479, 464, 465, 463, 478, 469, 469, 
-467, 463, 477, 481, 480, 480, 465, 477, 
-479, 483, 482, 482, 478, 479, 480, 484, 
-483, 483, 479, 480, 478, 482, 470, 470, 
-469, 478, 481, 485, 484, 484, 480, 481, 
-456, 486, 448, 456, 487, 446, 488, 487, 
-447, 446, 487, 488, 483, 490, 482, 489, 
-482, 490, 484, 491, 490, 490, 483, 484, 
-485, 492, 491, 491, 484, 485, 482, 489, 
-471, 471, 470, 482, 490, 494, 489, 493, 
-489, 494, 491, 495, 490, 494, 490, 495, 
-492, 496, 495, 489, 493, 472, 472, 471, 
-489, 534, 498, 497, 519, 527, 534, 533, 
-499, 498, 533, 517, 499, 533, 495, 496, 
-509, 497, 498, 511, 503, 502, 510, 498, 
-499, 511, 499, 500, 502, 506, 505, 505, 
-501, 502, 503, 507, 506, 506, 502, 503, 
-504, 508, 507, 507, 503, 504, 501, 509, 
-510, 511, 510, 499, 502, 510, 511, 607, 
-511, 500, 503, 511, 607, 504, 513, 532, 
-512, 508, 504, 606, 514, 513, 606, 515, 
-514, 515, 606, 500, 509, 498, 510, 501, 
-510, 502, 495, 491, 492, 516, 496, 492, 
-496, 516, 518, 518, 517, 496, 515, 500, 
-517, 517, 500, 499, 517, 518, 515, 534, 
-527, 494, 534, 494, 495, 481, 521, 520, 
-520, 485, 481, 492, 485, 520, 522, 475, 
-476, 522, 523, 477, 477, 475, 522, 523, 
-524, 481, 481, 477, 523, 524, 525, 521, 
-521, 481, 524, 462, 526, 476, 456, 455, 
-528, 527, 493, 494, 456, 530, 486, 529, 
-531, 515, 515, 518, 529, 519, 497, 531, 
-531, 529, 519, 514, 515, 531, 497, 509, 
-514, 514, 531, 497, 509, 501, 513, 513, 
-514, 509, 532, 513, 501, 504, 532, 512, 
-505, 532, 501, 496, 517, 533, 534, 533, 
-498, 497, 519, 534, 533, 534, 495, 492, 
-535, 516, 535, 492, 520, 518, 516, 536, 
-536, 529, 518, 529, 536, 527, 527, 519, 
-529, 535, 537, 536, 536, 516, 535, 537, 
-538, 527, 527, 536, 537, 538, 493, 527, 
-435, 558, 539, 558, 435, 433, 435, 539, 
-541, 541, 437, 435, 437, 541, 542, 542, 
-439, 437, 439, 542, 543, 543, 442, 439, 
-442, 543, 544, 544, 444, 442, 445, 545, 
-540, 540, 433, 445, 488, 546, 545, 545, 
-445, 488, 447, 547, 546, 546, 488, 447, 
-556, 549, 548, 550, 541, 539, 541, 550, 
-551, 551, 542, 541, 542, 551, 552, 552, 
-543, 542, 543, 552, 553, 553, 544, 543, 
-568, 546, 547, 556, 555, 557, 555, 548, 
-550, 548, 555, 556, 557, 539, 558, 539, 
-555, 550, 555, 539, 557, 433, 540, 558, 
-557, 558, 540, 556, 559, 560, 559, 556, 
-557, 560, 561, 562, 561, 560, 559, 560, 
-563, 549, 549, 556, 560, 562, 564, 563, 
-563, 560, 562, 540, 559, 557, 559, 540, 
-565, 565, 561, 559, 566, 549, 563, 564, 
-567, 566, 566, 563, 564, 568, 547, 554, 
-545, 546, 568, 540, 545, 565, 568, 565, 
-545, 569, 565, 568, 561, 571, 570, 570, 
-562, 561, 562, 570, 572, 572, 564, 562, 
-564, 572, 573, 573, 567, 564, 565, 569, 
-571, 571, 561, 565, 554, 573, 572, 554, 
-575, 574, 574, 568, 554, 568, 574, 576, 
-576, 569, 568, 571, 578, 577, 577, 570, 
-571, 570, 577, 579, 579, 572, 570, 569, 
-576, 578, 578, 571, 569, 572, 579, 575, 
-575, 554, 572, 575, 581, 580, 580, 574, 
-575, 574, 580, 582, 582, 576, 574, 578, 
-584, 583, 583, 577, 578, 577, 583, 585, 
-585, 579, 577, 576, 582, 584, 584, 578, 
-576, 579, 585, 581, 581, 575, 579, 581, 
-587, 586, 586, 580, 581, 580, 586, 588, 
-588, 582, 580, 584, 590, 589, 589, 583, 
-584, 583, 589, 591, 591, 585, 583, 582, 
-588, 590, 590, 584, 582, 585, 591, 587, 
-587, 581, 585, 589, 593, 592, 592, 591, 
-589, 594, 592, 593, 594, 596, 595, 590, 
-597, 593, 593, 589, 590, 590, 598, 597, 
-598, 590, 588, 594, 593, 597, 598, 599, 
-597, 597, 600, 596, 596, 594, 597, 592, 
-601, 587, 587, 591, 592, 601, 592, 594, 
-595, 602, 601, 601, 594, 595, 598, 586, 
-587, 587, 601, 598, 603, 598, 601, 598, 
-588, 586, 598, 603, 599, 599, 604, 600, 
-600, 597, 599, 601, 602, 605, 605, 603, 
-601, 603, 605, 604, 604, 599, 603, 605, 
-602, 600, 600, 604, 605, 602, 595, 596, 
-596, 600, 602, 441, 443, 454, 454, 453, 
-441, 607, 606, 504, 606, 607, 500, 503, 
-607, 504, 513, 504, 606, 506, 609, 608, 
-608, 505, 506, 610, 608, 609, 610, 612, 
-611, 507, 613, 609, 609, 506, 507, 507, 
-614, 613, 614, 507, 508, 610, 609, 613, 
-614, 615, 613, 613, 616, 612, 612, 610, 
-613, 608, 617, 532, 532, 505, 608, 617, 
-608, 610, 611, 618, 617, 617, 610, 611, 
-614, 512, 532, 532, 617, 614, 619, 614, 
-617, 614, 508, 512, 614, 619, 615, 615, 
-620, 616, 616, 613, 615, 617, 618, 621, 
-621, 619, 617, 619, 621, 620, 620, 615, 
-619, 621, 618, 616, 616, 620, 621, 618, 
-611, 612, 612, 616, 618, 550, 623, 622, 
-622, 551, 550, 551, 622, 624, 624, 552, 
-551, 552, 624, 625, 625, 553, 552, 638, 
-627, 626, 622, 626, 628, 628, 624, 622, 
-624, 628, 629, 629, 625, 624, 627, 631, 
-630, 630, 626, 627, 626, 630, 632, 632, 
-628, 626, 628, 632, 633, 633, 629, 628, 
-631, 635, 634, 634, 630, 631, 630, 634, 
-632, 636, 632, 634, 632, 636, 637, 637, 
-633, 632, 638, 622, 623, 626, 622, 638, 
-638, 640, 639, 639, 627, 638, 627, 639, 
-641, 641, 631, 627, 631, 641, 642, 642, 
-635, 631, 648, 644, 643, 647, 639, 640, 
-639, 647, 641, 645, 641, 647, 641, 645, 
-646, 646, 642, 641, 648, 647, 640, 647, 
-643, 645, 643, 647, 648, 550, 548, 649, 
-649, 623, 550, 623, 649, 640, 640, 638, 
-623, 548, 566, 650, 650, 649, 548, 649, 
-650, 648, 648, 640, 649, 648, 652, 651, 
-651, 644, 648, 566, 567, 653, 653, 650, 
-566, 650, 653, 652, 652, 648, 650, 652, 
-655, 654, 654, 651, 652, 655, 554, 547, 
-547, 654, 655, 653, 567, 573, 554, 655, 
-573, 653, 573, 655, 655, 652, 653, 742, 
-657, 656, 767, 637, 636, 657, 659, 658, 
-658, 656, 657, 659, 661, 660, 660, 658, 
-659, 661, 663, 662, 662, 660, 661, 663, 
-664, 662, 664, 666, 665, 665, 662, 664, 
-666, 668, 667, 667, 665, 666, 668, 670, 
-669, 669, 667, 668, 670, 672, 671, 671, 
-669, 670, 672, 674, 673, 673, 671, 672, 
-674, 676, 675, 675, 673, 674, 676, 678, 
-677, 677, 675, 676, 670, 680, 679, 679, 
-672, 670, 680, 682, 681, 681, 679, 680, 
-668, 683, 680, 680, 670, 668, 683, 684, 
-680, 684, 685, 682, 682, 680, 684, 663, 
-687, 686, 686, 664, 663, 687, 689, 688, 
-688, 686, 687, 687, 663, 661, 689, 691, 
-690, 690, 688, 689, 691, 685, 690, 684, 
-690, 685, 635, 693, 692, 692, 634, 635, 
-634, 692, 694, 694, 636, 634, 642, 695, 
-693, 693, 635, 642, 646, 696, 695, 695, 
-642, 646, 703, 685, 691, 691, 692, 693, 
-689, 694, 692, 695, 704, 703, 696, 698, 
-697, 697, 695, 696, 705, 700, 699, 699, 
-681, 705, 704, 697, 700, 705, 682, 685, 
-700, 702, 701, 701, 699, 700, 697, 698, 
-702, 702, 700, 697, 691, 689, 692, 703, 
-691, 693, 703, 693, 695, 703, 704, 685, 
-705, 704, 700, 685, 704, 705, 682, 705, 
-681, 704, 695, 697, 549, 566, 548, 707, 
-709, 708, 708, 706, 707, 706, 711, 710, 
-710, 707, 706, 711, 688, 712, 712, 710, 
-711, 709, 713, 683, 683, 708, 709, 713, 
-715, 714, 714, 683, 713, 715, 717, 716, 
-716, 714, 715, 717, 712, 718, 718, 716, 
-717, 688, 718, 712, 708, 668, 666, 666, 
-706, 708, 706, 666, 664, 664, 711, 706, 
-711, 686, 688, 668, 708, 683, 714, 684, 
-683, 684, 714, 716, 716, 690, 684, 690, 
-716, 718, 690, 718, 688, 711, 664, 686, 
-672, 721, 719, 719, 674, 672, 719, 720, 
-674, 676, 674, 720, 681, 722, 726, 726, 
-679, 681, 681, 699, 723, 723, 722, 681, 
-728, 725, 724, 727, 726, 722, 722, 724, 
-725, 672, 679, 721, 679, 726, 721, 725, 
-727, 722, 728, 678, 676, 724, 678, 728, 
-701, 730, 729, 729, 699, 701, 730, 732, 
-731, 731, 729, 730, 729, 723, 699, 731, 
-722, 723, 723, 729, 731, 733, 677, 678, 
-722, 734, 733, 733, 724, 722, 733, 678, 
-724, 732, 736, 735, 735, 731, 732, 731, 
-735, 734, 734, 722, 731, 736, 733, 734, 
-734, 735, 736, 659, 738, 737, 737, 661, 
-659, 661, 737, 687, 739, 687, 737, 657, 
-740, 738, 659, 657, 738, 657, 742, 740, 
-741, 740, 742, 743, 767, 636, 767, 742, 
-656, 743, 744, 741, 741, 742, 743, 744, 
-746, 745, 745, 741, 744, 746, 748, 747, 
-747, 745, 746, 748, 750, 749, 749, 747, 
-748, 744, 694, 751, 752, 746, 744, 744, 
-751, 752, 752, 748, 746, 748, 752, 753, 
-753, 750, 748, 750, 755, 754, 754, 749, 
-750, 755, 750, 753, 745, 757, 756, 756, 
-741, 745, 747, 758, 757, 757, 745, 747, 
-749, 759, 758, 758, 747, 749, 752, 761, 
-760, 760, 753, 752, 762, 754, 755, 754, 
-762, 759, 759, 749, 754, 753, 760, 762, 
-762, 755, 753, 694, 764, 763, 763, 751, 
-694, 751, 763, 761, 761, 752, 751, 764, 
-766, 763, 765, 763, 766, 763, 765, 761, 
-760, 761, 765, 766, 758, 759, 759, 765, 
-766, 765, 759, 762, 762, 760, 765, 757, 
-766, 764, 757, 758, 766, 694, 689, 764, 
-757, 764, 689, 689, 756, 757, 743, 636, 
-694, 694, 744, 743, 743, 742, 767, 687, 
-739, 689, 756, 689, 739, 768, 719, 721, 
-768, 720, 719, 768, 676, 720, 768, 725, 
-728, 768, 726, 727, 768, 721, 726, 768, 
-727, 725, 768, 728, 676, 769, 709, 707, 
-769, 707, 710, 769, 710, 712, 769, 713, 
-709, 769, 715, 713, 769, 717, 715, 769, 
-712, 717, 460, 771, 770, 770, 462, 460, 
-771, 460, 458, 462, 773, 772, 772, 526, 
-462, 770, 774, 462, 773, 462, 774, 773, 
-776, 775, 775, 772, 773, 774, 777, 776, 
-776, 773, 774, 776, 779, 778, 778, 775, 
-776, 777, 780, 779, 779, 776, 777, 779, 
-782, 781, 781, 778, 779, 780, 783, 782, 
-782, 779, 780, 782, 785, 784, 784, 781, 
-782, 783, 786, 785, 785, 782, 783, 785, 
-788, 787, 787, 784, 785, 789, 788, 785, 
-785, 786, 789, 738, 790, 791, 791, 737, 
-738, 791, 792, 794, 794, 793, 791, 792, 
-796, 795, 795, 794, 792, 796, 797, 798, 
-795, 796, 798, 791, 793, 739, 739, 737, 
-791, 739, 793, 799, 799, 756, 739, 793, 
-794, 800, 800, 799, 793, 801, 800, 794, 
-801, 794, 795, 802, 801, 795, 800, 806, 
-804, 804, 799, 800, 799, 804, 741, 741, 
-756, 799, 801, 802, 805, 805, 803, 801, 
-798, 805, 802, 807, 804, 806, 806, 808, 
-807, 808, 806, 803, 803, 809, 808, 807, 
-740, 741, 741, 804, 807, 810, 809, 803, 
-803, 805, 810, 797, 796, 792, 792, 811, 
-797, 807, 808, 811, 811, 790, 807, 738, 
-740, 807, 807, 790, 738, 809, 810, 797, 
-798, 797, 810, 798, 810, 805, 798, 802, 
-795, 790, 811, 792, 792, 791, 790, 803, 
-806, 800, 800, 801, 803, 811, 808, 809, 
-809, 797, 811, 817, 521, 525, 525, 818, 
-817, 819, 817, 818, 818, 820, 819, 821, 
-819, 820, 820, 822, 821, 823, 821, 822, 
-822, 824, 823, 817, 520, 521, 817, 825, 
-520, 825, 817, 819, 825, 812, 520, 819, 
-821, 825, 812, 815, 814, 815, 825, 821, 
-821, 823, 815, 815, 812, 825, 826, 472, 
-813, 813, 814, 826, 827, 826, 814, 814, 
-816, 827, 838, 840, 839, 838, 839, 834, 
-834, 839, 829, 834, 829, 828, 816, 841, 
-837, 827, 816, 837, 837, 841, 840, 840, 
-838, 837, 528, 472, 826, 528, 826, 473, 
-827, 473, 826, 828, 474, 530, 828, 835, 
-834, 828, 530, 835, 830, 823, 824, 824, 
-831, 830, 823, 830, 815, 816, 815, 842, 
-472, 832, 813, 832, 833, 813, 833, 520, 
-812, 812, 813, 833, 814, 815, 816, 814, 
-813, 812, 836, 835, 530, 836, 530, 473, 
-836, 473, 827, 836, 827, 837, 842, 841, 
-816, 842, 815, 830, 842, 830, 843, 843, 
-830, 831, 843, 831, 829, 843, 829, 839, 
-850, 849, 844, 844, 845, 850, 851, 850, 
-845, 845, 846, 851, 852, 851, 846, 846, 
-847, 852, 853, 852, 847, 847, 848, 853, 
-849, 853, 848, 848, 844, 849, 839, 840, 
-849, 849, 850, 839, 843, 839, 850, 850, 
-851, 843, 842, 843, 851, 851, 852, 842, 
-841, 842, 852, 852, 853, 841, 840, 841, 
-853, 853, 849, 840, 854, 845, 844, 854, 
-846, 845, 854, 847, 846, 854, 848, 847, 
-854, 844, 848, 861, 860, 855, 855, 856, 
-861, 862, 861, 856, 856, 857, 862, 863, 
-862, 857, 857, 858, 863, 864, 863, 858, 
-858, 859, 864, 860, 864, 859, 859, 855, 
-860, 837, 838, 860, 860, 861, 837, 836, 
-837, 861, 861, 862, 836, 835, 836, 862, 
-862, 863, 835, 834, 835, 863, 863, 864, 
-834, 838, 834, 864, 864, 860, 838, 865, 
-856, 855, 865, 857, 856, 865, 858, 857, 
-865, 859, 858, 865, 855, 859, 868, 866, 
-869, 867, 869, 866, 870, 868, 871, 869, 
-871, 868, 872, 870, 873, 871, 873, 870, 
-874, 875, 872, 872, 873, 874, 876, 877, 
-875, 875, 874, 876, 878, 879, 867, 867, 
-866, 878, 880, 881, 920, 879, 878, 921, 
-882, 883, 869, 869, 867, 882, 883, 884, 
-871, 871, 869, 883, 884, 885, 873, 873, 
-871, 884, 885, 886, 874, 874, 873, 885, 
-888, 882, 867, 867, 879, 888, 889, 888, 
-879, 920, 881, 889, 890, 901, 886, 887, 
-886, 901, 901, 890, 892, 894, 895, 893, 
-896, 897, 892, 892, 890, 896, 897, 898, 
-894, 894, 892, 897, 890, 886, 899, 900, 
-899, 885, 886, 885, 899, 900, 896, 899, 
-890, 899, 896, 892, 893, 891, 893, 892, 
-894, 891, 901, 892, 901, 891, 887, 884, 
-902, 885, 900, 885, 902, 883, 903, 902, 
-902, 884, 883, 882, 904, 903, 903, 883, 
-882, 888, 905, 904, 904, 882, 888, 889, 
-906, 961, 905, 888, 961, 919, 907, 963, 
-906, 889, 963, 908, 909, 895, 895, 894, 
-908, 910, 908, 894, 894, 898, 910, 911, 
-912, 897, 897, 896, 911, 912, 913, 898, 
-898, 897, 912, 902, 911, 896, 896, 900, 
-902, 913, 914, 910, 910, 898, 913, 915, 
-916, 912, 912, 911, 915, 916, 917, 913, 
-913, 912, 916, 903, 915, 911, 911, 902, 
-903, 917, 918, 914, 914, 913, 917, 881, 
-919, 889, 879, 920, 889, 880, 920, 921, 
-921, 920, 879, 915, 923, 916, 923, 915, 
-922, 923, 924, 917, 917, 916, 923, 924, 
-925, 918, 918, 917, 924, 904, 922, 915, 
-915, 903, 904, 922, 927, 923, 927, 922, 
-926, 923, 928, 924, 928, 923, 927, 928, 
-929, 925, 905, 926, 922, 922, 904, 905, 
-930, 931, 967, 967, 960, 952, 931, 932, 
-966, 932, 950, 966, 929, 928, 966, 931, 
-930, 942, 935, 936, 944, 932, 931, 943, 
-933, 932, 944, 938, 939, 935, 935, 934, 
-938, 939, 940, 936, 936, 935, 939, 940, 
-941, 937, 937, 936, 940, 943, 942, 934, 
-932, 943, 944, 944, 943, 935, 933, 944, 
-1040, 1040, 944, 936, 965, 946, 937, 937, 
-941, 945, 946, 947, 1039, 947, 948, 1039, 
-933, 1039, 948, 943, 931, 942, 935, 943, 
-934, 925, 924, 928, 925, 929, 949, 951, 
-949, 929, 929, 950, 951, 950, 933, 948, 
-932, 933, 950, 948, 951, 950, 927, 960, 
-967, 928, 927, 967, 953, 954, 914, 914, 
-918, 953, 953, 918, 925, 909, 908, 955, 
-910, 956, 955, 955, 908, 910, 914, 957, 
-956, 956, 910, 914, 954, 958, 957, 957, 
-914, 954, 909, 959, 895, 961, 888, 889, 
-927, 926, 960, 919, 963, 889, 948, 964, 
-962, 962, 951, 948, 964, 930, 952, 952, 
-962, 964, 964, 948, 947, 947, 942, 930, 
-930, 964, 947, 946, 934, 942, 942, 947, 
-946, 934, 946, 965, 945, 965, 937, 934, 
-965, 938, 966, 950, 929, 931, 966, 967, 
-967, 952, 930, 928, 967, 966, 949, 968, 
-925, 953, 925, 968, 969, 949, 951, 951, 
-962, 969, 960, 969, 962, 962, 952, 960, 
-969, 970, 968, 968, 949, 969, 960, 971, 
-970, 970, 969, 960, 960, 926, 971, 972, 
-991, 868, 866, 868, 991, 974, 972, 868, 
-868, 870, 974, 975, 974, 870, 870, 872, 
-975, 976, 975, 872, 872, 875, 976, 977, 
-976, 875, 875, 877, 977, 973, 978, 878, 
-878, 866, 973, 978, 979, 921, 921, 878, 
-978, 979, 980, 880, 880, 921, 979, 981, 
-982, 989, 972, 974, 983, 984, 983, 974, 
-974, 975, 984, 985, 984, 975, 975, 976, 
-985, 986, 985, 976, 976, 977, 986, 980, 
-979, 1001, 990, 988, 989, 983, 981, 988, 
-989, 988, 981, 991, 972, 990, 983, 988, 
-972, 990, 972, 988, 991, 973, 866, 973, 
-991, 990, 993, 992, 989, 990, 989, 992, 
-995, 994, 993, 992, 993, 994, 982, 996, 
-993, 993, 989, 982, 996, 997, 995, 995, 
-993, 996, 990, 992, 973, 998, 973, 992, 
-992, 994, 998, 996, 982, 999, 999, 1000, 
-997, 997, 996, 999, 987, 980, 1001, 1001, 
-979, 978, 998, 978, 973, 978, 998, 1001, 
-1001, 998, 1002, 1003, 1004, 994, 994, 995, 
-1003, 1005, 1003, 995, 995, 997, 1005, 1006, 
-1005, 997, 997, 1000, 1006, 1004, 1002, 998, 
-998, 994, 1004, 1005, 1006, 987, 1007, 1008, 
-987, 987, 1001, 1007, 1009, 1007, 1001, 1001, 
-1002, 1009, 1010, 1011, 1004, 1004, 1003, 1010, 
-1012, 1010, 1003, 1003, 1005, 1012, 1011, 1009, 
-1002, 1002, 1004, 1011, 1008, 1012, 1005, 1005, 
-987, 1008, 1013, 1014, 1008, 1008, 1007, 1013, 
-1015, 1013, 1007, 1007, 1009, 1015, 1016, 1017, 
-1011, 1011, 1010, 1016, 1018, 1016, 1010, 1010, 
-1012, 1018, 1017, 1015, 1009, 1009, 1011, 1017, 
-1014, 1018, 1012, 1012, 1008, 1014, 1019, 1020, 
-1014, 1014, 1013, 1019, 1021, 1019, 1013, 1013, 
-1015, 1021, 1022, 1023, 1017, 1017, 1016, 1022, 
-1024, 1022, 1016, 1016, 1018, 1024, 1023, 1021, 
-1015, 1015, 1017, 1023, 1020, 1024, 1018, 1018, 
-1014, 1020, 1025, 1026, 1022, 1022, 1024, 1025, 
-1026, 1025, 1027, 1028, 1029, 1027, 1026, 1030, 
-1023, 1023, 1022, 1026, 1030, 1031, 1023, 1021, 
-1023, 1031, 1030, 1026, 1027, 1030, 1032, 1031, 
-1029, 1033, 1030, 1030, 1027, 1029, 1020, 1034, 
-1025, 1025, 1024, 1020, 1027, 1025, 1034, 1034, 
-1035, 1028, 1028, 1027, 1034, 1020, 1019, 1031, 
-1031, 1034, 1020, 1034, 1031, 1036, 1019, 1021, 
-1031, 1032, 1036, 1031, 1033, 1037, 1032, 1032, 
-1030, 1033, 1038, 1035, 1034, 1034, 1036, 1038, 
-1037, 1038, 1036, 1036, 1032, 1037, 1033, 1035, 
-1038, 1038, 1037, 1033, 1029, 1028, 1035, 1035, 
-1033, 1029, 887, 876, 874, 874, 886, 887, 
-937, 1039, 1040, 933, 1040, 1039, 937, 1040, 
-936, 1039, 937, 946, 1041, 1042, 939, 939, 
-938, 1041, 1042, 1041, 1043, 1044, 1045, 1043, 
-1042, 1046, 940, 940, 939, 1042, 1046, 1047, 
-940, 941, 940, 1047, 1046, 1042, 1043, 1046, 
-1048, 1047, 1045, 1049, 1046, 1046, 1043, 1045, 
-965, 1050, 1041, 1041, 938, 965, 1043, 1041, 
-1050, 1050, 1051, 1044, 1044, 1043, 1050, 965, 
-945, 1047, 1047, 1050, 965, 1050, 1047, 1052, 
-945, 941, 1047, 1048, 1052, 1047, 1049, 1053, 
-1048, 1048, 1046, 1049, 1054, 1051, 1050, 1050, 
-1052, 1054, 1053, 1054, 1052, 1052, 1048, 1053, 
-1049, 1051, 1054, 1054, 1053, 1049, 1045, 1044, 
-1051, 1051, 1049, 1045, 1055, 1056, 983, 983, 
-984, 1055, 1057, 1055, 984, 984, 985, 1057, 
-1058, 1057, 985, 985, 986, 1058, 1059, 1060, 
-1071, 1061, 1059, 1055, 1055, 1057, 1061, 1062, 
-1061, 1057, 1057, 1058, 1062, 1063, 1064, 1060, 
-1060, 1059, 1063, 1065, 1063, 1059, 1059, 1061, 
-1065, 1066, 1065, 1061, 1061, 1062, 1066, 1067, 
-1068, 1064, 1064, 1063, 1067, 1065, 1067, 1063, 
-1067, 1065, 1069, 1070, 1069, 1065, 1065, 1066, 
-1070, 1056, 1055, 1071, 1071, 1055, 1059, 1072, 
-1073, 1071, 1071, 1060, 1072, 1074, 1072, 1060, 
-1060, 1064, 1074, 1075, 1074, 1064, 1064, 1068, 
-1075, 1076, 1077, 1081, 1073, 1072, 1080, 1074, 
-1080, 1072, 1080, 1074, 1078, 1079, 1078, 1074, 
-1074, 1075, 1079, 1073, 1080, 1081, 1078, 1076, 
-1080, 1081, 1080, 1076, 1082, 981, 983, 983, 
-1056, 1082, 1073, 1082, 1056, 1056, 1071, 1073, 
-1083, 999, 981, 981, 1082, 1083, 1081, 1083, 
-1082, 1082, 1073, 1081, 1084, 1085, 1081, 1081, 
-1077, 1084, 1086, 1000, 999, 999, 1083, 1086, 
-1085, 1086, 1083, 1083, 1081, 1085, 1087, 1088, 
-1085, 1085, 1084, 1087, 980, 987, 1088, 1088, 
-1087, 980, 1006, 1000, 1086, 1006, 1088, 987, 
-1088, 1006, 1086, 1086, 1085, 1088, 1089, 1090, 
-1175, 1069, 1070, 1200, 1091, 1092, 1090, 1090, 
-1089, 1091, 1093, 1094, 1092, 1092, 1091, 1093, 
-1095, 1096, 1094, 1094, 1093, 1095, 1095, 1097, 
-1096, 1098, 1099, 1097, 1097, 1095, 1098, 1100, 
-1101, 1099, 1099, 1098, 1100, 1102, 1103, 1101, 
-1101, 1100, 1102, 1104, 1105, 1103, 1103, 1102, 
-1104, 1106, 1107, 1105, 1105, 1104, 1106, 1108, 
-1109, 1107, 1107, 1106, 1108, 1110, 1111, 1109, 
-1109, 1108, 1110, 1112, 1113, 1103, 1103, 1105, 
-1112, 1114, 1115, 1113, 1113, 1112, 1114, 1113, 
-1116, 1101, 1101, 1103, 1113, 1113, 1117, 1116, 
-1115, 1118, 1117, 1117, 1113, 1115, 1119, 1120, 
-1096, 1096, 1097, 1119, 1121, 1122, 1120, 1120, 
-1119, 1121, 1094, 1096, 1120, 1123, 1124, 1122, 
-1122, 1121, 1123, 1123, 1118, 1124, 1118, 1123, 
-1117, 1125, 1126, 1068, 1068, 1067, 1125, 1127, 
-1125, 1067, 1067, 1069, 1127, 1126, 1128, 1075, 
-1075, 1068, 1126, 1128, 1129, 1079, 1079, 1075, 
-1128, 1124, 1118, 1136, 1126, 1125, 1124, 1125, 
-1127, 1122, 1136, 1137, 1128, 1130, 1131, 1129, 
-1129, 1128, 1130, 1132, 1133, 1138, 1138, 1114, 
-1132, 1133, 1130, 1137, 1118, 1115, 1138, 1134, 
-1135, 1133, 1133, 1132, 1134, 1135, 1131, 1130, 
-1130, 1133, 1135, 1125, 1122, 1124, 1126, 1124, 
-1136, 1128, 1126, 1136, 1118, 1137, 1136, 1133, 
-1137, 1138, 1138, 1137, 1118, 1114, 1138, 1115, 
-1130, 1128, 1137, 981, 999, 982, 1141, 1142, 
-1140, 1140, 1139, 1141, 1143, 1144, 1139, 1139, 
-1140, 1143, 1145, 1121, 1144, 1144, 1143, 1145, 
-1116, 1146, 1142, 1142, 1141, 1116, 1147, 1148, 
-1146, 1146, 1116, 1147, 1149, 1150, 1148, 1148, 
-1147, 1149, 1151, 1145, 1150, 1150, 1149, 1151, 
-1145, 1151, 1121, 1099, 1101, 1141, 1141, 1139, 
-1099, 1097, 1099, 1139, 1139, 1144, 1097, 1121, 
-1119, 1144, 1116, 1141, 1101, 1116, 1117, 1147, 
-1149, 1147, 1117, 1117, 1123, 1149, 1151, 1149, 
-1123, 1121, 1151, 1123, 1119, 1097, 1144, 1152, 
-1154, 1105, 1105, 1107, 1152, 1107, 1153, 1152, 
-1153, 1107, 1109, 1159, 1155, 1114, 1114, 1112, 
-1159, 1156, 1132, 1114, 1114, 1155, 1156, 1157, 
-1158, 1161, 1155, 1159, 1160, 1158, 1157, 1155, 
-1154, 1112, 1105, 1154, 1159, 1112, 1155, 1160, 
-1158, 1109, 1111, 1161, 1161, 1111, 1157, 1162, 
-1163, 1134, 1134, 1132, 1162, 1164, 1165, 1163, 
-1163, 1162, 1164, 1132, 1156, 1162, 1156, 1155, 
-1164, 1164, 1162, 1156, 1111, 1110, 1166, 1166, 
-1167, 1155, 1155, 1157, 1166, 1157, 1111, 1166, 
-1168, 1169, 1165, 1165, 1164, 1168, 1167, 1168, 
-1164, 1164, 1155, 1167, 1167, 1166, 1169, 1169, 
-1168, 1167, 1170, 1171, 1092, 1092, 1094, 1170, 
-1120, 1170, 1094, 1170, 1120, 1172, 1171, 1173, 
-1090, 1171, 1090, 1092, 1173, 1175, 1090, 1175, 
-1173, 1174, 1069, 1200, 1176, 1089, 1175, 1200, 
-1174, 1177, 1176, 1176, 1175, 1174, 1178, 1179, 
-1177, 1177, 1174, 1178, 1180, 1181, 1179, 1179, 
-1178, 1180, 1182, 1183, 1181, 1181, 1180, 1182, 
-1184, 1127, 1177, 1177, 1179, 1185, 1185, 1184, 
-1177, 1179, 1181, 1185, 1186, 1185, 1181, 1181, 
-1183, 1186, 1187, 1188, 1183, 1183, 1182, 1187, 
-1186, 1183, 1188, 1189, 1190, 1178, 1178, 1174, 
-1189, 1190, 1191, 1180, 1180, 1178, 1190, 1191, 
-1192, 1182, 1182, 1180, 1191, 1193, 1194, 1185, 
-1185, 1186, 1193, 1188, 1187, 1195, 1192, 1195, 
-1187, 1187, 1182, 1192, 1195, 1193, 1186, 1186, 
-1188, 1195, 1196, 1197, 1127, 1127, 1184, 1196, 
-1194, 1196, 1184, 1184, 1185, 1194, 1196, 1199, 
-1197, 1199, 1196, 1198, 1194, 1198, 1196, 1198, 
-1194, 1193, 1192, 1191, 1199, 1199, 1198, 1192, 
-1195, 1192, 1198, 1198, 1193, 1195, 1197, 1199, 
-1190, 1199, 1191, 1190, 1197, 1122, 1127, 1122, 
-1197, 1190, 1190, 1189, 1122, 1127, 1069, 1176, 
-1176, 1177, 1127, 1200, 1175, 1176, 1122, 1172, 
-1120, 1172, 1122, 1189, 1154, 1152, 1201, 1152, 
-1153, 1201, 1153, 1109, 1201, 1161, 1158, 1201, 
-1160, 1159, 1201, 1159, 1154, 1201, 1158, 1160, 
-1201, 1109, 1161, 1201, 1140, 1142, 1202, 1143, 
-1140, 1202, 1145, 1143, 1202, 1142, 1146, 1202, 
-1146, 1148, 1202, 1148, 1150, 1202, 1150, 1145, 
-1202, 1203, 1204, 893, 893, 895, 1203, 891, 
-893, 1204, 1205, 1206, 895, 895, 959, 1205, 
-895, 1207, 1203, 1207, 895, 1206, 1208, 1209, 
-1206, 1206, 1205, 1208, 1209, 1210, 1207, 1207, 
-1206, 1209, 1211, 1212, 1209, 1209, 1208, 1211, 
-1212, 1213, 1210, 1210, 1209, 1212, 1214, 1215, 
-1212, 1212, 1211, 1214, 1215, 1216, 1213, 1213, 
-1212, 1215, 1217, 1218, 1215, 1215, 1214, 1217, 
-1218, 1219, 1216, 1216, 1215, 1218, 1220, 1221, 
-1218, 1218, 1217, 1220, 1218, 1221, 1222, 1222, 
-1219, 1218, 1224, 1223, 1171, 1171, 1170, 1224, 
-1227, 1225, 1224, 1224, 1226, 1227, 1228, 1229, 
-1225, 1225, 1227, 1228, 1231, 1230, 1229, 1231, 
-1229, 1228, 1172, 1226, 1224, 1224, 1170, 1172, 
-1232, 1226, 1172, 1172, 1189, 1232, 1233, 1227, 
-1226, 1226, 1232, 1233, 1227, 1233, 1234, 1228, 
-1227, 1234, 1228, 1234, 1235, 1237, 1239, 1233, 
-1233, 1232, 1237, 1174, 1237, 1232, 1232, 1189, 
-1174, 1238, 1235, 1234, 1234, 1236, 1238, 1235, 
-1238, 1231, 1239, 1237, 1240, 1240, 1241, 1239, 
-1236, 1239, 1241, 1241, 1242, 1236, 1174, 1173, 
-1240, 1240, 1237, 1174, 1236, 1242, 1243, 1243, 
-1238, 1236, 1225, 1229, 1230, 1230, 1244, 1225, 
-1244, 1241, 1240, 1240, 1223, 1244, 1240, 1173, 
-1171, 1171, 1223, 1240, 1230, 1243, 1242, 1243, 
-1230, 1231, 1238, 1243, 1231, 1228, 1235, 1231, 
-1225, 1244, 1223, 1223, 1224, 1225, 1233, 1239, 
-1236, 1236, 1234, 1233, 1242, 1241, 1244, 1244, 
-1230, 1242, 958, 954, 1250, 1250, 1251, 958, 
-1251, 1250, 1252, 1252, 1253, 1251, 1253, 1252, 
-1254, 1254, 1255, 1253, 1255, 1254, 1256, 1256, 
-1257, 1255, 954, 953, 1250, 953, 1258, 1250, 
-1252, 1250, 1258, 953, 1245, 1258, 1258, 1254, 
-1252, 1247, 1248, 1245, 1254, 1258, 1248, 1248, 
-1256, 1254, 1258, 1245, 1248, 1246, 905, 1259, 
-1259, 1247, 1246, 1247, 1259, 1260, 1260, 1249, 
-1247, 1272, 1273, 1271, 1267, 1272, 1271, 1262, 
-1272, 1267, 1261, 1262, 1267, 1270, 1274, 1249, 
-1270, 1249, 1260, 1273, 1274, 1270, 1270, 1271, 
-1273, 1259, 905, 961, 906, 1259, 961, 1259, 
-906, 1260, 963, 907, 1261, 1267, 1268, 1261, 
-1268, 963, 1261, 1257, 1256, 1263, 1263, 1264, 
-1257, 1248, 1263, 1256, 1275, 1248, 1249, 1246, 
-1265, 905, 1246, 1266, 1265, 1245, 953, 1266, 
-1266, 1246, 1245, 1249, 1248, 1247, 1245, 1246, 
-1247, 963, 1268, 1269, 906, 963, 1269, 1260, 
-906, 1269, 1270, 1260, 1269, 1249, 1274, 1275, 
-1263, 1248, 1275, 1276, 1263, 1275, 1264, 1263, 
-1276, 1262, 1264, 1276, 1272, 1262, 1276, 1277, 
-1282, 1283, 1283, 1278, 1277, 1278, 1283, 1284, 
-1284, 1279, 1278, 1279, 1284, 1285, 1285, 1280, 
-1279, 1280, 1285, 1286, 1286, 1281, 1280, 1281, 
-1286, 1282, 1282, 1277, 1281, 1282, 1273, 1272, 
-1272, 1283, 1282, 1283, 1272, 1276, 1276, 1284, 
-1283, 1284, 1276, 1275, 1275, 1285, 1284, 1285, 
-1275, 1274, 1274, 1286, 1285, 1286, 1274, 1273, 
-1273, 1282, 1286, 1277, 1278, 1287, 1278, 1279, 
-1287, 1279, 1280, 1287, 1280, 1281, 1287, 1281, 
-1277, 1287, 1288, 1293, 1294, 1294, 1289, 1288, 
-1289, 1294, 1295, 1295, 1290, 1289, 1290, 1295, 
-1296, 1296, 1291, 1290, 1291, 1296, 1297, 1297, 
-1292, 1291, 1292, 1297, 1293, 1293, 1288, 1292, 
-1293, 1271, 1270, 1270, 1294, 1293, 1294, 1270, 
-1269, 1269, 1295, 1294, 1295, 1269, 1268, 1268, 
-1296, 1295, 1296, 1268, 1267, 1267, 1297, 1296, 
-1297, 1267, 1271, 1271, 1293, 1297, 1288, 1289, 
-1298, 1289, 1290, 1298, 1290, 1291, 1298, 1291, 
-1292, 1298, 1292, 1288, 1298, 1302, 1299, 1301, 
-1299, 1302, 1300, 1304, 1301, 1303, 1301, 1304, 
-1302, 1306, 1303, 1305, 1303, 1306, 1304, 1305, 
-1308, 1307, 1307, 1306, 1305, 1308, 1310, 1309, 
-1309, 1307, 1308, 1300, 1312, 1311, 1311, 1299, 
-1300, 1353, 1314, 1313, 1354, 1311, 1312, 1302, 
-1316, 1315, 1315, 1300, 1302, 1304, 1317, 1316, 
-1316, 1302, 1304, 1306, 1318, 1317, 1317, 1304, 
-1306, 1307, 1319, 1318, 1318, 1306, 1307, 1300, 
-1315, 1321, 1321, 1312, 1300, 1312, 1321, 1322, 
-1322, 1314, 1353, 1319, 1334, 1323, 1334, 1319, 
-1320, 1325, 1323, 1334, 1326, 1328, 1327, 1325, 
-1330, 1329, 1329, 1323, 1325, 1327, 1331, 1330, 
-1330, 1325, 1327, 1332, 1319, 1323, 1318, 1332, 
-1333, 1332, 1318, 1319, 1332, 1329, 1333, 1329, 
-1332, 1323, 1324, 1326, 1325, 1327, 1325, 1326, 
-1325, 1334, 1324, 1320, 1324, 1334, 1318, 1335, 
-1317, 1335, 1318, 1333, 1335, 1336, 1316, 1316, 
-1317, 1335, 1336, 1337, 1315, 1315, 1316, 1336, 
-1337, 1338, 1321, 1321, 1315, 1337, 1394, 1339, 
-1322, 1394, 1321, 1338, 1396, 1340, 1352, 1396, 
-1322, 1339, 1328, 1342, 1341, 1341, 1327, 1328, 
-1327, 1341, 1343, 1343, 1331, 1327, 1330, 1345, 
-1344, 1344, 1329, 1330, 1331, 1346, 1345, 1345, 
-1330, 1331, 1329, 1344, 1335, 1335, 1333, 1329, 
-1343, 1347, 1346, 1346, 1331, 1343, 1345, 1349, 
-1348, 1348, 1344, 1345, 1346, 1350, 1349, 1349, 
-1345, 1346, 1344, 1348, 1336, 1336, 1335, 1344, 
-1347, 1351, 1350, 1350, 1346, 1347, 1322, 1352, 
-1314, 1322, 1353, 1312, 1354, 1353, 1313, 1312, 
-1353, 1354, 1349, 1356, 1348, 1355, 1348, 1356, 
-1350, 1357, 1356, 1356, 1349, 1350, 1351, 1358, 
-1357, 1357, 1350, 1351, 1348, 1355, 1337, 1337, 
-1336, 1348, 1356, 1360, 1355, 1359, 1355, 1360, 
-1357, 1361, 1356, 1360, 1356, 1361, 1358, 1362, 
-1361, 1355, 1359, 1338, 1338, 1337, 1355, 1400, 
-1364, 1363, 1385, 1393, 1400, 1399, 1365, 1364, 
-1399, 1383, 1365, 1399, 1361, 1362, 1375, 1363, 
-1364, 1377, 1369, 1368, 1376, 1364, 1365, 1377, 
-1365, 1366, 1368, 1372, 1371, 1371, 1367, 1368, 
-1369, 1373, 1372, 1372, 1368, 1369, 1370, 1374, 
-1373, 1373, 1369, 1370, 1367, 1375, 1376, 1377, 
-1376, 1365, 1368, 1376, 1377, 1473, 1377, 1366, 
-1369, 1377, 1473, 1370, 1379, 1398, 1378, 1374, 
-1370, 1472, 1380, 1379, 1472, 1381, 1380, 1381, 
-1472, 1366, 1375, 1364, 1376, 1367, 1376, 1368, 
-1361, 1357, 1358, 1382, 1362, 1358, 1362, 1382, 
-1384, 1384, 1383, 1362, 1381, 1366, 1383, 1383, 
-1366, 1365, 1383, 1384, 1381, 1400, 1393, 1360, 
-1400, 1360, 1361, 1347, 1387, 1386, 1386, 1351, 
-1347, 1358, 1351, 1386, 1388, 1341, 1342, 1388, 
-1389, 1343, 1343, 1341, 1388, 1389, 1390, 1347, 
-1347, 1343, 1389, 1390, 1391, 1387, 1387, 1347, 
-1390, 1328, 1392, 1342, 1322, 1321, 1394, 1393, 
-1359, 1360, 1322, 1396, 1352, 1395, 1397, 1381, 
-1381, 1384, 1395, 1385, 1363, 1397, 1397, 1395, 
-1385, 1380, 1381, 1397, 1363, 1375, 1380, 1380, 
-1397, 1363, 1375, 1367, 1379, 1379, 1380, 1375, 
-1398, 1379, 1367, 1370, 1398, 1378, 1371, 1398, 
-1367, 1362, 1383, 1399, 1400, 1399, 1364, 1363, 
-1385, 1400, 1399, 1400, 1361, 1358, 1401, 1382, 
-1401, 1358, 1386, 1384, 1382, 1402, 1402, 1395, 
-1384, 1395, 1402, 1393, 1393, 1385, 1395, 1401, 
-1403, 1402, 1402, 1382, 1401, 1403, 1404, 1393, 
-1393, 1402, 1403, 1404, 1359, 1393, 1301, 1424, 
-1405, 1424, 1301, 1299, 1301, 1405, 1407, 1407, 
-1303, 1301, 1303, 1407, 1408, 1408, 1305, 1303, 
-1305, 1408, 1409, 1409, 1308, 1305, 1308, 1409, 
-1410, 1410, 1310, 1308, 1311, 1411, 1406, 1406, 
-1299, 1311, 1354, 1412, 1411, 1411, 1311, 1354, 
-1313, 1413, 1412, 1412, 1354, 1313, 1422, 1415, 
-1414, 1416, 1407, 1405, 1407, 1416, 1417, 1417, 
-1408, 1407, 1408, 1417, 1418, 1418, 1409, 1408, 
-1409, 1418, 1419, 1419, 1410, 1409, 1434, 1412, 
-1413, 1422, 1421, 1423, 1421, 1414, 1416, 1414, 
-1421, 1422, 1423, 1405, 1424, 1405, 1421, 1416, 
-1421, 1405, 1423, 1299, 1406, 1424, 1423, 1424, 
-1406, 1422, 1425, 1426, 1425, 1422, 1423, 1426, 
-1427, 1428, 1427, 1426, 1425, 1426, 1429, 1415, 
-1415, 1422, 1426, 1428, 1430, 1429, 1429, 1426, 
-1428, 1406, 1425, 1423, 1425, 1406, 1431, 1431, 
-1427, 1425, 1432, 1415, 1429, 1430, 1433, 1432, 
-1432, 1429, 1430, 1434, 1413, 1420, 1411, 1412, 
-1434, 1406, 1411, 1431, 1434, 1431, 1411, 1435, 
-1431, 1434, 1427, 1437, 1436, 1436, 1428, 1427, 
-1428, 1436, 1438, 1438, 1430, 1428, 1430, 1438, 
-1439, 1439, 1433, 1430, 1431, 1435, 1437, 1437, 
-1427, 1431, 1420, 1439, 1438, 1420, 1441, 1440, 
-1440, 1434, 1420, 1434, 1440, 1442, 1442, 1435, 
-1434, 1437, 1444, 1443, 1443, 1436, 1437, 1436, 
-1443, 1445, 1445, 1438, 1436, 1435, 1442, 1444, 
-1444, 1437, 1435, 1438, 1445, 1441, 1441, 1420, 
-1438, 1441, 1447, 1446, 1446, 1440, 1441, 1440, 
-1446, 1448, 1448, 1442, 1440, 1444, 1450, 1449, 
-1449, 1443, 1444, 1443, 1449, 1451, 1451, 1445, 
-1443, 1442, 1448, 1450, 1450, 1444, 1442, 1445, 
-1451, 1447, 1447, 1441, 1445, 1447, 1453, 1452, 
-1452, 1446, 1447, 1446, 1452, 1454, 1454, 1448, 
-1446, 1450, 1456, 1455, 1455, 1449, 1450, 1449, 
-1455, 1457, 1457, 1451, 1449, 1448, 1454, 1456, 
-1456, 1450, 1448, 1451, 1457, 1453, 1453, 1447, 
-1451, 1455, 1459, 1458, 1458, 1457, 1455, 1460, 
-1458, 1459, 1460, 1462, 1461, 1456, 1463, 1459, 
-1459, 1455, 1456, 1456, 1464, 1463, 1464, 1456, 
-1454, 1460, 1459, 1463, 1464, 1465, 1463, 1463, 
-1466, 1462, 1462, 1460, 1463, 1458, 1467, 1453, 
-1453, 1457, 1458, 1467, 1458, 1460, 1461, 1468, 
-1467, 1467, 1460, 1461, 1464, 1452, 1453, 1453, 
-1467, 1464, 1469, 1464, 1467, 1464, 1454, 1452, 
-1464, 1469, 1465, 1465, 1470, 1466, 1466, 1463, 
-1465, 1467, 1468, 1471, 1471, 1469, 1467, 1469, 
-1471, 1470, 1470, 1465, 1469, 1471, 1468, 1466, 
-1466, 1470, 1471, 1468, 1461, 1462, 1462, 1466, 
-1468, 1307, 1309, 1320, 1320, 1319, 1307, 1473, 
-1472, 1370, 1472, 1473, 1366, 1369, 1473, 1370, 
-1379, 1370, 1472, 1372, 1475, 1474, 1474, 1371, 
-1372, 1476, 1474, 1475, 1476, 1478, 1477, 1373, 
-1479, 1475, 1475, 1372, 1373, 1373, 1480, 1479, 
-1480, 1373, 1374, 1476, 1475, 1479, 1480, 1481, 
-1479, 1479, 1482, 1478, 1478, 1476, 1479, 1474, 
-1483, 1398, 1398, 1371, 1474, 1483, 1474, 1476, 
-1477, 1484, 1483, 1483, 1476, 1477, 1480, 1378, 
-1398, 1398, 1483, 1480, 1485, 1480, 1483, 1480, 
-1374, 1378, 1480, 1485, 1481, 1481, 1486, 1482, 
-1482, 1479, 1481, 1483, 1484, 1487, 1487, 1485, 
-1483, 1485, 1487, 1486, 1486, 1481, 1485, 1487, 
-1484, 1482, 1482, 1486, 1487, 1484, 1477, 1478, 
-1478, 1482, 1484, 1416, 1489, 1488, 1488, 1417, 
-1416, 1417, 1488, 1490, 1490, 1418, 1417, 1418, 
-1490, 1491, 1491, 1419, 1418, 1504, 1493, 1492, 
-1488, 1492, 1494, 1494, 1490, 1488, 1490, 1494, 
-1495, 1495, 1491, 1490, 1493, 1497, 1496, 1496, 
-1492, 1493, 1492, 1496, 1498, 1498, 1494, 1492, 
-1494, 1498, 1499, 1499, 1495, 1494, 1497, 1501, 
-1500, 1500, 1496, 1497, 1496, 1500, 1498, 1502, 
-1498, 1500, 1498, 1502, 1503, 1503, 1499, 1498, 
-1504, 1488, 1489, 1492, 1488, 1504, 1504, 1506, 
-1505, 1505, 1493, 1504, 1493, 1505, 1507, 1507, 
-1497, 1493, 1497, 1507, 1508, 1508, 1501, 1497, 
-1514, 1510, 1509, 1513, 1505, 1506, 1505, 1513, 
-1507, 1511, 1507, 1513, 1507, 1511, 1512, 1512, 
-1508, 1507, 1514, 1513, 1506, 1513, 1509, 1511, 
-1509, 1513, 1514, 1416, 1414, 1515, 1515, 1489, 
-1416, 1489, 1515, 1506, 1506, 1504, 1489, 1414, 
-1432, 1516, 1516, 1515, 1414, 1515, 1516, 1514, 
-1514, 1506, 1515, 1514, 1518, 1517, 1517, 1510, 
-1514, 1432, 1433, 1519, 1519, 1516, 1432, 1516, 
-1519, 1518, 1518, 1514, 1516, 1518, 1521, 1520, 
-1520, 1517, 1518, 1521, 1420, 1413, 1413, 1520, 
-1521, 1519, 1433, 1439, 1420, 1521, 1439, 1519, 
-1439, 1521, 1521, 1518, 1519, 1608, 1523, 1522, 
-1633, 1503, 1502, 1523, 1525, 1524, 1524, 1522, 
-1523, 1525, 1527, 1526, 1526, 1524, 1525, 1527, 
-1529, 1528, 1528, 1526, 1527, 1529, 1530, 1528, 
-1530, 1532, 1531, 1531, 1528, 1530, 1532, 1534, 
-1533, 1533, 1531, 1532, 1534, 1536, 1535, 1535, 
-1533, 1534, 1536, 1538, 1537, 1537, 1535, 1536, 
-1538, 1540, 1539, 1539, 1537, 1538, 1540, 1542, 
-1541, 1541, 1539, 1540, 1542, 1544, 1543, 1543, 
-1541, 1542, 1536, 1546, 1545, 1545, 1538, 1536, 
-1546, 1548, 1547, 1547, 1545, 1546, 1534, 1549, 
-1546, 1546, 1536, 1534, 1549, 1550, 1546, 1550, 
-1551, 1548, 1548, 1546, 1550, 1529, 1553, 1552, 
-1552, 1530, 1529, 1553, 1555, 1554, 1554, 1552, 
-1553, 1553, 1529, 1527, 1555, 1557, 1556, 1556, 
-1554, 1555, 1557, 1551, 1556, 1550, 1556, 1551, 
-1501, 1559, 1558, 1558, 1500, 1501, 1500, 1558, 
-1560, 1560, 1502, 1500, 1508, 1561, 1559, 1559, 
-1501, 1508, 1512, 1562, 1561, 1561, 1508, 1512, 
-1569, 1551, 1557, 1557, 1558, 1559, 1555, 1560, 
-1558, 1561, 1570, 1569, 1562, 1564, 1563, 1563, 
-1561, 1562, 1571, 1566, 1565, 1565, 1547, 1571, 
-1570, 1563, 1566, 1571, 1548, 1551, 1566, 1568, 
-1567, 1567, 1565, 1566, 1563, 1564, 1568, 1568, 
-1566, 1563, 1557, 1555, 1558, 1569, 1557, 1559, 
-1569, 1559, 1561, 1569, 1570, 1551, 1571, 1570, 
-1566, 1551, 1570, 1571, 1548, 1571, 1547, 1570, 
-1561, 1563, 1415, 1432, 1414, 1573, 1575, 1574, 
-1574, 1572, 1573, 1572, 1577, 1576, 1576, 1573, 
-1572, 1577, 1554, 1578, 1578, 1576, 1577, 1575, 
-1579, 1549, 1549, 1574, 1575, 1579, 1581, 1580, 
-1580, 1549, 1579, 1581, 1583, 1582, 1582, 1580, 
-1581, 1583, 1578, 1584, 1584, 1582, 1583, 1554, 
-1584, 1578, 1574, 1534, 1532, 1532, 1572, 1574, 
-1572, 1532, 1530, 1530, 1577, 1572, 1577, 1552, 
-1554, 1534, 1574, 1549, 1580, 1550, 1549, 1550, 
-1580, 1582, 1582, 1556, 1550, 1556, 1582, 1584, 
-1556, 1584, 1554, 1577, 1530, 1552, 1538, 1587, 
-1585, 1585, 1540, 1538, 1585, 1586, 1540, 1542, 
-1540, 1586, 1547, 1588, 1592, 1592, 1545, 1547, 
-1547, 1565, 1589, 1589, 1588, 1547, 1594, 1591, 
-1590, 1593, 1592, 1588, 1588, 1590, 1591, 1538, 
-1545, 1587, 1545, 1592, 1587, 1591, 1593, 1588, 
-1594, 1544, 1542, 1590, 1544, 1594, 1567, 1596, 
-1595, 1595, 1565, 1567, 1596, 1598, 1597, 1597, 
-1595, 1596, 1595, 1589, 1565, 1597, 1588, 1589, 
-1589, 1595, 1597, 1599, 1543, 1544, 1588, 1600, 
-1599, 1599, 1590, 1588, 1599, 1544, 1590, 1598, 
-1602, 1601, 1601, 1597, 1598, 1597, 1601, 1600, 
-1600, 1588, 1597, 1602, 1599, 1600, 1600, 1601, 
-1602, 1525, 1604, 1603, 1603, 1527, 1525, 1527, 
-1603, 1553, 1605, 1553, 1603, 1523, 1606, 1604, 
-1525, 1523, 1604, 1523, 1608, 1606, 1607, 1606, 
-1608, 1609, 1633, 1502, 1633, 1608, 1522, 1609, 
-1610, 1607, 1607, 1608, 1609, 1610, 1612, 1611, 
-1611, 1607, 1610, 1612, 1614, 1613, 1613, 1611, 
-1612, 1614, 1616, 1615, 1615, 1613, 1614, 1610, 
-1560, 1617, 1618, 1612, 1610, 1610, 1617, 1618, 
-1618, 1614, 1612, 1614, 1618, 1619, 1619, 1616, 
-1614, 1616, 1621, 1620, 1620, 1615, 1616, 1621, 
-1616, 1619, 1611, 1623, 1622, 1622, 1607, 1611, 
-1613, 1624, 1623, 1623, 1611, 1613, 1615, 1625, 
-1624, 1624, 1613, 1615, 1618, 1627, 1626, 1626, 
-1619, 1618, 1628, 1620, 1621, 1620, 1628, 1625, 
-1625, 1615, 1620, 1619, 1626, 1628, 1628, 1621, 
-1619, 1560, 1630, 1629, 1629, 1617, 1560, 1617, 
-1629, 1627, 1627, 1618, 1617, 1630, 1632, 1629, 
-1631, 1629, 1632, 1629, 1631, 1627, 1626, 1627, 
-1631, 1632, 1624, 1625, 1625, 1631, 1632, 1631, 
-1625, 1628, 1628, 1626, 1631, 1623, 1632, 1630, 
-1623, 1624, 1632, 1560, 1555, 1630, 1623, 1630, 
-1555, 1555, 1622, 1623, 1609, 1502, 1560, 1560, 
-1610, 1609, 1609, 1608, 1633, 1553, 1605, 1555, 
-1622, 1555, 1605, 1634, 1585, 1587, 1634, 1586, 
-1585, 1634, 1542, 1586, 1634, 1591, 1594, 1634, 
-1592, 1593, 1634, 1587, 1592, 1634, 1593, 1591, 
-1634, 1594, 1542, 1635, 1575, 1573, 1635, 1573, 
-1576, 1635, 1576, 1578, 1635, 1579, 1575, 1635, 
-1581, 1579, 1635, 1583, 1581, 1635, 1578, 1583, 
-1326, 1637, 1636, 1636, 1328, 1326, 1637, 1326, 
-1324, 1328, 1639, 1638, 1638, 1392, 1328, 1636, 
-1640, 1328, 1639, 1328, 1640, 1639, 1642, 1641, 
-1641, 1638, 1639, 1640, 1643, 1642, 1642, 1639, 
-1640, 1642, 1645, 1644, 1644, 1641, 1642, 1643, 
-1646, 1645, 1645, 1642, 1643, 1645, 1648, 1647, 
-1647, 1644, 1645, 1646, 1649, 1648, 1648, 1645, 
-1646, 1648, 1651, 1650, 1650, 1647, 1648, 1649, 
-1652, 1651, 1651, 1648, 1649, 1651, 1654, 1653, 
-1653, 1650, 1651, 1655, 1654, 1651, 1651, 1652, 
-1655, 1604, 1656, 1657, 1657, 1603, 1604, 1657, 
-1658, 1660, 1660, 1659, 1657, 1658, 1662, 1661, 
-1661, 1660, 1658, 1662, 1663, 1664, 1661, 1662, 
-1664, 1657, 1659, 1605, 1605, 1603, 1657, 1605, 
-1659, 1665, 1665, 1622, 1605, 1659, 1660, 1666, 
-1666, 1665, 1659, 1667, 1666, 1660, 1667, 1660, 
-1661, 1668, 1667, 1661, 1666, 1672, 1670, 1670, 
-1665, 1666, 1665, 1670, 1607, 1607, 1622, 1665, 
-1667, 1668, 1671, 1671, 1669, 1667, 1664, 1671, 
-1668, 1673, 1670, 1672, 1672, 1674, 1673, 1674, 
-1672, 1669, 1669, 1675, 1674, 1673, 1606, 1607, 
-1607, 1670, 1673, 1676, 1675, 1669, 1669, 1671, 
-1676, 1663, 1662, 1658, 1658, 1677, 1663, 1673, 
-1674, 1677, 1677, 1656, 1673, 1604, 1606, 1673, 
-1673, 1656, 1604, 1675, 1676, 1663, 1664, 1663, 
-1676, 1664, 1676, 1671, 1664, 1668, 1661, 1656, 
-1677, 1658, 1658, 1657, 1656, 1669, 1672, 1666, 
-1666, 1667, 1669, 1677, 1674, 1675, 1675, 1663, 
-1677, 1683, 1387, 1391, 1391, 1684, 1683, 1685, 
-1683, 1684, 1684, 1686, 1685, 1687, 1685, 1686, 
-1686, 1688, 1687, 1689, 1687, 1688, 1688, 1690, 
-1689, 1683, 1386, 1387, 1683, 1691, 1386, 1691, 
-1683, 1685, 1691, 1678, 1386, 1685, 1687, 1691, 
-1678, 1681, 1680, 1681, 1691, 1687, 1687, 1689, 
-1681, 1681, 1678, 1691, 1692, 1338, 1679, 1679, 
-1680, 1692, 1693, 1692, 1680, 1680, 1682, 1693, 
-1704, 1706, 1705, 1704, 1705, 1700, 1700, 1705, 
-1695, 1700, 1695, 1694, 1682, 1707, 1703, 1693, 
-1682, 1703, 1703, 1707, 1706, 1706, 1704, 1703, 
-1394, 1338, 1692, 1394, 1692, 1339, 1693, 1339, 
-1692, 1694, 1340, 1396, 1694, 1701, 1700, 1694, 
-1396, 1701, 1696, 1689, 1690, 1690, 1697, 1696, 
-1689, 1696, 1681, 1682, 1681, 1708, 1338, 1698, 
-1679, 1698, 1699, 1679, 1699, 1386, 1678, 1678, 
-1679, 1699, 1680, 1681, 1682, 1680, 1679, 1678, 
-1702, 1701, 1396, 1702, 1396, 1339, 1702, 1339, 
-1693, 1702, 1693, 1703, 1708, 1707, 1682, 1708, 
-1681, 1696, 1708, 1696, 1709, 1709, 1696, 1697, 
-1709, 1697, 1695, 1709, 1695, 1705, 1716, 1715, 
-1710, 1710, 1711, 1716, 1717, 1716, 1711, 1711, 
-1712, 1717, 1718, 1717, 1712, 1712, 1713, 1718, 
-1719, 1718, 1713, 1713, 1714, 1719, 1715, 1719, 
-1714, 1714, 1710, 1715, 1705, 1706, 1715, 1715, 
-1716, 1705, 1709, 1705, 1716, 1716, 1717, 1709, 
-1708, 1709, 1717, 1717, 1718, 1708, 1707, 1708, 
-1718, 1718, 1719, 1707, 1706, 1707, 1719, 1719, 
-1715, 1706, 1720, 1711, 1710, 1720, 1712, 1711, 
-1720, 1713, 1712, 1720, 1714, 1713, 1720, 1710, 
-1714, 1727, 1726, 1721, 1721, 1722, 1727, 1728, 
-1727, 1722, 1722, 1723, 1728, 1729, 1728, 1723, 
-1723, 1724, 1729, 1730, 1729, 1724, 1724, 1725, 
-1730, 1726, 1730, 1725, 1725, 1721, 1726, 1703, 
-1704, 1726, 1726, 1727, 1703, 1702, 1703, 1727, 
-1727, 1728, 1702, 1701, 1702, 1728, 1728, 1729, 
-1701, 1700, 1701, 1729, 1729, 1730, 1700, 1704, 
-1700, 1730, 1730, 1726, 1704, 1731, 1722, 1721, 
-1731, 1723, 1722, 1731, 1724, 1723, 1731, 1725, 
-1724, 1731, 1721, 1725};
+constexpr uint32_t kCowNumVerts = 1732;
+constexpr uint32_t kCowNumSt = 1528;
+constexpr uint32_t kCowNumTris = 3156;
 
-uint32_t stindices[9468] = {
-0, 1, 2, 4, 2, 1, 11, 0, 
-5, 2, 5, 0, 27, 11, 17, 5, 
-17, 11, 35, 48, 27, 27, 17, 35, 
-214, 215, 216, 216, 218, 214, 9, 15, 
-4, 4, 1, 9, 239, 240, 241, 15, 
-9, 24, 8, 10, 2, 2, 4, 8, 
-10, 16, 5, 5, 2, 10, 16, 34, 
-17, 17, 5, 16, 34, 58, 35, 35, 
-17, 34, 14, 8, 4, 4, 15, 14, 
-32, 14, 15, 241, 240, 242, 226, 224, 
-222, 220, 222, 224, 224, 226, 229, 233, 
-234, 232, 56, 69, 79, 79, 80, 56, 
-69, 89, 94, 94, 79, 69, 226, 222, 
-230, 45, 57, 34, 58, 34, 57, 45, 
-56, 57, 80, 57, 56, 229, 232, 227, 
-232, 229, 233, 227, 224, 229, 224, 227, 
-220, 16, 25, 34, 45, 34, 25, 10, 
-23, 25, 25, 16, 10, 8, 22, 23, 
-23, 10, 8, 14, 31, 22, 22, 8, 
-14, 32, 67, 42, 31, 14, 42, 244, 
-248, 246, 249, 242, 246, 235, 237, 234, 
-234, 233, 235, 109, 118, 94, 94, 89, 
-109, 44, 65, 69, 69, 56, 44, 65, 
-90, 89, 89, 69, 65, 25, 44, 56, 
-56, 45, 25, 90, 110, 109, 109, 89, 
-90, 41, 77, 65, 65, 44, 41, 77, 
-91, 90, 90, 65, 77, 23, 41, 44, 
-44, 25, 23, 91, 111, 110, 110, 90, 
-91, 240, 244, 242, 15, 33, 32, 239, 
-241, 243, 24, 33, 15, 41, 66, 77, 
-66, 41, 43, 66, 102, 91, 91, 77, 
-66, 287, 288, 289, 111, 91, 102, 22, 
-43, 41, 41, 23, 22, 43, 68, 66, 
-68, 43, 55, 66, 92, 102, 92, 66, 
-68, 92, 120, 125, 31, 55, 43, 43, 
-22, 31, 324, 323, 326, 326, 330, 328, 
-119, 124, 112, 124, 126, 112, 120, 92, 
-112, 323, 324, 325, 141, 145, 136, 124, 
-119, 132, 137, 124, 136, 157, 151, 141, 
-332, 329, 334, 151, 158, 145, 145, 141, 
-151, 158, 177, 159, 159, 145, 158, 327, 
-325, 329, 124, 132, 136, 136, 132, 141, 
-137, 136, 146, 146, 136, 145, 322, 321, 
-320, 344, 345, 346, 347, 348, 349, 348, 
-351, 349, 313, 317, 309, 327, 323, 325, 
-332, 327, 329, 288, 287, 290, 288, 298, 
-295, 302, 295, 298, 298, 306, 302, 306, 
-313, 309, 124, 137, 126, 309, 302, 306, 
-333, 330, 326, 92, 68, 103, 291, 294, 
-292, 292, 289, 291, 291, 289, 288, 316, 
-312, 308, 305, 301, 308, 308, 312, 305, 
-292, 297, 301, 301, 305, 292, 294, 300, 
-297, 297, 292, 294, 237, 238, 234, 363, 
-364, 365, 333, 335, 330, 244, 246, 242, 
-351, 353, 354, 354, 356, 351, 353, 352, 
-355, 355, 354, 353, 353, 351, 348, 348, 
-350, 352, 352, 353, 348, 331, 329, 325, 
-350, 348, 347, 366, 367, 368, 369, 370, 
-371, 329, 336, 334, 112, 126, 120, 119, 
-112, 103, 326, 328, 324, 92, 103, 112, 
-295, 293, 288, 291, 288, 293, 358, 359, 
-356, 356, 354, 358, 357, 358, 354, 354, 
-355, 357, 358, 360, 361, 361, 359, 358, 
-357, 362, 360, 360, 358, 357, 330, 335, 
-337, 6, 3, 0, 1, 0, 3, 13, 
-6, 0, 0, 11, 13, 26, 13, 11, 
-11, 27, 26, 47, 26, 27, 27, 48, 
-47, 217, 219, 216, 216, 215, 217, 7, 
-21, 9, 9, 1, 7, 21, 40, 24, 
-24, 9, 21, 245, 247, 239, 239, 243, 
-245, 36, 50, 28, 6, 13, 19, 29, 
-19, 13, 13, 26, 29, 46, 29, 26, 
-26, 47, 46, 221, 223, 219, 219, 217, 
-221, 247, 245, 250, 12, 18, 28, 19, 
-36, 18, 28, 18, 36, 3, 6, 12, 
-19, 18, 6, 12, 6, 18, 3, 7, 
-1, 7, 3, 12, 38, 20, 28, 12, 
-28, 20, 61, 39, 38, 20, 38, 39, 
-50, 62, 38, 38, 28, 50, 62, 87, 
-61, 61, 38, 62, 12, 20, 7, 30, 
-7, 20, 20, 39, 30, 377, 378, 379, 
-379, 382, 381, 381, 377, 379, 254, 247, 
-250, 250, 245, 253, 30, 21, 7, 253, 
-257, 250, 403, 404, 405, 63, 53, 39, 
-39, 61, 63, 86, 63, 61, 61, 87, 
-86, 383, 384, 381, 381, 382, 383, 53, 
-64, 30, 30, 39, 53, 384, 383, 385, 
-412, 413, 414, 414, 416, 412, 406, 407, 
-403, 403, 405, 406, 75, 76, 53, 53, 
-63, 75, 387, 391, 393, 63, 86, 99, 
-76, 88, 64, 64, 53, 76, 386, 387, 
-384, 384, 385, 386, 415, 417, 413, 413, 
-412, 415, 408, 409, 407, 407, 406, 408, 
-100, 101, 76, 76, 75, 100, 389, 394, 
-391, 391, 387, 389, 101, 108, 88, 88, 
-76, 101, 388, 389, 387, 387, 386, 388, 
-418, 419, 417, 417, 415, 418, 410, 411, 
-409, 409, 408, 410, 116, 117, 101, 101, 
-100, 116, 392, 396, 394, 394, 389, 392, 
-117, 123, 108, 108, 101, 117, 390, 392, 
-389, 389, 388, 390, 395, 398, 396, 396, 
-392, 395, 398, 395, 399, 400, 401, 399, 
-130, 135, 117, 117, 116, 130, 425, 426, 
-427, 123, 117, 131, 135, 130, 140, 425, 
-428, 426, 144, 150, 135, 135, 140, 144, 
-390, 397, 395, 395, 392, 390, 399, 395, 
-397, 397, 402, 400, 400, 399, 397, 419, 
-418, 420, 420, 421, 419, 421, 420, 422, 
-432, 433, 434, 428, 429, 426, 150, 167, 
-156, 156, 135, 150, 423, 424, 421, 421, 
-422, 423, 430, 431, 429, 429, 428, 430, 
-435, 436, 437, 437, 439, 435, 438, 440, 
-436, 436, 435, 438, 220, 214, 218, 218, 
-222, 220, 320, 317, 318, 313, 318, 317, 
-159, 146, 145, 317, 320, 321, 1522, 1523, 
-1524, 151, 157, 168, 169, 168, 184, 341, 
-342, 340, 169, 176, 158, 158, 151, 169, 
-441, 442, 443, 177, 158, 185, 176, 169, 
-184, 441, 444, 442, 189, 195, 176, 176, 
-184, 189, 336, 339, 338, 338, 334, 336, 
-340, 338, 339, 339, 343, 341, 341, 340, 
-339, 370, 369, 372, 372, 373, 370, 373, 
-372, 374, 448, 449, 450, 444, 445, 442, 
-195, 205, 201, 201, 176, 195, 375, 376, 
-373, 373, 374, 375, 446, 447, 445, 445, 
-444, 446, 451, 452, 453, 453, 455, 451, 
-454, 456, 452, 452, 451, 454, 37, 52, 
-19, 19, 29, 37, 51, 37, 29, 29, 
-46, 51, 225, 228, 223, 223, 221, 225, 
-74, 98, 85, 60, 74, 37, 37, 51, 
-60, 73, 60, 51, 228, 225, 231, 97, 
-115, 98, 98, 74, 97, 84, 97, 74, 
-74, 60, 84, 457, 458, 459, 60, 73, 
-83, 107, 122, 115, 115, 97, 107, 84, 
-107, 97, 107, 84, 114, 460, 461, 458, 
-458, 457, 460, 506, 507, 508, 85, 37, 
-74, 106, 72, 85, 85, 98, 106, 113, 
-106, 98, 98, 115, 113, 129, 113, 115, 
-115, 122, 129, 514, 516, 515, 72, 106, 
-95, 113, 95, 106, 510, 511, 512, 513, 
-512, 511, 519, 520, 521, 72, 95, 70, 
-512, 514, 510, 515, 510, 514, 49, 36, 
-19, 19, 52, 49, 72, 49, 52, 506, 
-508, 509, 59, 71, 36, 36, 49, 59, 
-70, 59, 49, 49, 72, 70, 517, 518, 
-515, 515, 516, 517, 82, 96, 71, 71, 
-59, 82, 81, 82, 59, 59, 70, 81, 
-261, 258, 265, 265, 270, 261, 247, 254, 
-258, 258, 261, 247, 535, 536, 537, 535, 
-538, 539, 538, 535, 537, 82, 81, 105, 
-465, 467, 464, 461, 460, 462, 469, 470, 
-467, 467, 465, 469, 471, 473, 470, 470, 
-469, 471, 475, 477, 473, 473, 471, 475, 
-475, 479, 477, 483, 486, 479, 479, 475, 
-483, 490, 494, 486, 486, 483, 490, 498, 
-499, 494, 494, 490, 498, 500, 501, 499, 
-499, 498, 500, 502, 503, 501, 501, 500, 
-502, 540, 541, 542, 542, 545, 540, 543, 
-546, 541, 541, 540, 543, 187, 171, 192, 
-192, 199, 187, 180, 161, 171, 171, 187, 
-180, 551, 552, 553, 198, 192, 171, 171, 
-152, 179, 161, 147, 152, 152, 171, 161, 
-484, 480, 477, 477, 479, 484, 148, 133, 
-153, 153, 163, 148, 473, 477, 480, 142, 
-138, 133, 133, 148, 142, 142, 147, 138, 
-147, 142, 152, 128, 134, 122, 122, 107, 
-128, 121, 128, 107, 107, 114, 121, 134, 
-139, 129, 129, 122, 134, 522, 523, 521, 
-521, 520, 522, 138, 147, 143, 134, 128, 
-138, 128, 121, 133, 143, 149, 139, 524, 
-525, 523, 523, 522, 524, 183, 166, 165, 
-165, 180, 183, 166, 155, 149, 147, 161, 
-165, 528, 526, 527, 527, 529, 528, 526, 
-525, 524, 524, 527, 526, 128, 133, 138, 
-134, 138, 143, 139, 134, 143, 147, 149, 
-143, 166, 149, 165, 165, 149, 147, 180, 
-165, 161, 155, 139, 149, 380, 379, 378, 
-196, 190, 194, 194, 188, 196, 182, 174, 
-188, 188, 194, 182, 164, 148, 174, 174, 
-182, 164, 179, 186, 190, 190, 196, 179, 
-170, 178, 186, 186, 179, 170, 160, 175, 
-178, 178, 170, 160, 154, 164, 175, 175, 
-160, 154, 164, 154, 148, 486, 494, 495, 
-495, 491, 486, 479, 486, 491, 491, 487, 
-479, 148, 163, 174, 552, 554, 553, 179, 
-152, 170, 160, 170, 152, 152, 142, 160, 
-154, 160, 142, 148, 154, 142, 484, 479, 
-487, 504, 505, 501, 501, 503, 504, 211, 
-209, 207, 544, 542, 541, 193, 197, 180, 
-180, 187, 193, 191, 183, 180, 180, 197, 
-191, 549, 550, 548, 197, 193, 204, 208, 
-210, 197, 200, 187, 199, 200, 193, 187, 
-197, 204, 208, 541, 546, 548, 548, 546, 
-549, 530, 532, 528, 528, 529, 530, 533, 
-534, 532, 532, 530, 533, 529, 531, 530, 
-191, 197, 202, 202, 206, 191, 555, 556, 
-557, 560, 561, 562, 559, 558, 557, 558, 
-555, 557, 566, 567, 568, 568, 569, 566, 
-570, 566, 569, 564, 562, 561, 561, 560, 
-563, 563, 565, 561, 474, 472, 470, 470, 
-473, 474, 571, 572, 573, 173, 153, 162, 
-694, 692, 695, 472, 467, 470, 692, 693, 
-695, 693, 692, 691, 461, 462, 463, 465, 
-464, 462, 466, 468, 463, 463, 464, 466, 
-574, 575, 576, 587, 588, 589, 577, 579, 
-575, 575, 574, 577, 582, 584, 579, 579, 
-577, 582, 590, 591, 592, 592, 595, 594, 
-594, 590, 592, 595, 596, 594, 597, 594, 
-596, 596, 598, 597, 600, 599, 598, 584, 
-582, 586, 597, 598, 599, 580, 578, 574, 
-574, 583, 580, 578, 581, 577, 577, 574, 
-578, 581, 585, 582, 582, 577, 581, 604, 
-603, 602, 602, 607, 604, 613, 614, 609, 
-612, 609, 614, 586, 582, 585, 609, 604, 
-607, 607, 613, 609, 605, 611, 608, 608, 
-601, 605, 603, 605, 601, 601, 602, 603, 
-605, 610, 611, 610, 605, 606, 603, 606, 
-605, 606, 603, 604, 612, 616, 610, 610, 
-606, 612, 609, 612, 606, 606, 604, 609, 
-611, 610, 615, 610, 616, 615, 619, 620, 
-621, 617, 611, 615, 615, 618, 617, 121, 
-114, 127, 593, 592, 591, 462, 464, 463, 
-133, 162, 153, 162, 133, 172, 200, 207, 
-203, 207, 209, 203, 544, 541, 547, 212, 
-208, 203, 204, 193, 203, 193, 200, 203, 
-208, 204, 203, 213, 212, 203, 194, 190, 
-181, 182, 194, 181, 164, 182, 181, 190, 
-186, 181, 186, 178, 181, 178, 175, 181, 
-175, 164, 181, 622, 623, 624, 232, 234, 
-236, 625, 624, 623, 628, 629, 626, 626, 
-627, 628, 652, 650, 653, 650, 652, 651, 
-630, 631, 629, 629, 628, 630, 649, 648, 
-650, 650, 651, 649, 632, 633, 631, 631, 
-630, 632, 647, 646, 648, 648, 649, 647, 
-634, 635, 633, 633, 632, 634, 645, 644, 
-646, 646, 647, 645, 636, 637, 635, 635, 
-634, 636, 641, 643, 644, 644, 645, 641, 
-639, 640, 641, 637, 636, 638, 641, 640, 
-642, 642, 643, 641, 476, 478, 472, 472, 
-474, 476, 658, 656, 659, 659, 660, 658, 
-654, 655, 656, 656, 658, 654, 497, 488, 
-493, 657, 655, 654, 661, 662, 663, 663, 
-664, 661, 665, 666, 667, 667, 669, 665, 
-668, 671, 666, 666, 665, 668, 671, 668, 
-674, 676, 671, 674, 676, 674, 678, 670, 
-673, 668, 668, 665, 670, 672, 670, 665, 
-665, 669, 672, 677, 678, 674, 674, 675, 
-677, 678, 677, 679, 681, 685, 683, 683, 
-682, 681, 680, 681, 682, 682, 684, 680, 
-691, 692, 689, 689, 690, 691, 680, 684, 
-686, 686, 687, 680, 481, 493, 488, 488, 
-485, 481, 485, 489, 482, 482, 478, 485, 
-689, 692, 694, 472, 478, 482, 488, 496, 
-492, 496, 488, 497, 687, 686, 688, 676, 
-678, 679, 481, 485, 478, 478, 476, 481, 
-668, 673, 675, 675, 674, 668, 492, 489, 
-485, 485, 488, 492, 300, 294, 296, 296, 
-304, 300, 304, 296, 303, 303, 310, 304, 
-310, 303, 307, 307, 315, 310, 315, 307, 
-314, 314, 319, 315, 294, 291, 296, 291, 
-299, 296, 303, 296, 299, 696, 697, 698, 
-299, 307, 303, 702, 700, 697, 307, 299, 
-311, 311, 314, 307, 698, 697, 700, 701, 
-705, 706, 706, 702, 701, 93, 54, 78, 
-78, 104, 93, 268, 273, 271, 259, 268, 
-271, 263, 268, 259, 251, 263, 259, 260, 
-269, 264, 260, 264, 256, 273, 269, 260, 
-260, 271, 273, 54, 31, 42, 67, 54, 
-42, 54, 67, 78, 246, 248, 251, 259, 
-255, 251, 255, 246, 251, 285, 286, 281, 
-281, 276, 285, 280, 281, 286, 274, 280, 
-264, 701, 703, 705, 701, 699, 703, 697, 
-696, 699, 699, 701, 697, 704, 700, 702, 
-697, 701, 702, 246, 255, 252, 249, 246, 
-252, 256, 249, 252, 260, 256, 252, 264, 
-269, 274, 281, 280, 274, 272, 281, 274, 
-276, 281, 272, 263, 276, 272, 268, 263, 
-272, 707, 708, 709, 709, 711, 707, 713, 
-714, 715, 715, 716, 713, 718, 719, 720, 
-720, 721, 718, 723, 724, 725, 725, 726, 
-723, 710, 712, 708, 708, 707, 710, 282, 
-273, 268, 268, 277, 282, 277, 268, 272, 
-272, 283, 277, 283, 272, 274, 274, 279, 
-283, 279, 274, 269, 269, 278, 279, 278, 
-269, 273, 273, 282, 278, 728, 729, 730, 
-713, 716, 717, 718, 721, 722, 723, 726, 
-727, 731, 728, 730, 735, 739, 733, 733, 
-732, 735, 732, 733, 734, 734, 737, 732, 
-741, 742, 743, 743, 744, 741, 746, 747, 
-748, 748, 749, 746, 749, 748, 750, 751, 
-752, 753, 275, 271, 260, 260, 284, 275, 
-733, 740, 736, 736, 734, 733, 754, 755, 
-756, 255, 262, 266, 262, 255, 259, 259, 
-267, 262, 267, 259, 271, 271, 275, 267, 
-735, 732, 738, 732, 737, 738, 741, 744, 
-745, 757, 758, 759, 758, 760, 759, 761, 
-762, 763, 762, 761, 764, 766, 763, 771, 
-763, 766, 761, 777, 771, 787, 771, 777, 
-766, 787, 808, 795, 795, 777, 787, 975, 
-976, 977, 977, 979, 975, 764, 774, 768, 
-768, 762, 764, 1008, 1009, 1010, 782, 768, 
-774, 761, 772, 767, 767, 764, 761, 766, 
-778, 772, 772, 761, 766, 777, 796, 778, 
-778, 766, 777, 795, 818, 796, 796, 777, 
-795, 764, 767, 773, 773, 774, 764, 774, 
-773, 790, 1011, 1009, 1008, 983, 985, 987, 
-985, 983, 981, 990, 987, 985, 993, 995, 
-994, 833, 824, 812, 812, 841, 833, 847, 
-842, 824, 824, 833, 847, 991, 983, 987, 
-796, 819, 809, 819, 796, 818, 819, 812, 
-809, 812, 819, 841, 988, 993, 990, 994, 
-990, 993, 990, 985, 988, 981, 988, 985, 
-796, 788, 778, 788, 796, 809, 788, 780, 
-772, 772, 778, 788, 780, 779, 767, 767, 
-772, 780, 779, 789, 773, 773, 767, 779, 
-799, 823, 790, 799, 773, 789, 1015, 1018, 
-1013, 1015, 1011, 1017, 1087, 1083, 1079, 997, 
-994, 995, 847, 874, 866, 866, 842, 847, 
-824, 820, 800, 800, 812, 824, 842, 843, 
-820, 820, 824, 842, 812, 800, 788, 788, 
-809, 812, 866, 867, 843, 843, 842, 866, 
-820, 831, 797, 797, 800, 820, 843, 844, 
-831, 831, 820, 843, 800, 797, 780, 780, 
-788, 800, 867, 868, 844, 844, 843, 867, 
-1011, 1013, 1009, 790, 792, 774, 1012, 1008, 
-1010, 774, 792, 782, 831, 821, 797, 798, 
-797, 821, 844, 856, 821, 821, 831, 844, 
-1056, 1057, 1058, 856, 844, 868, 797, 798, 
-779, 779, 780, 797, 821, 822, 798, 810, 
-798, 822, 856, 845, 821, 822, 821, 845, 
-883, 876, 845, 798, 810, 789, 789, 779, 
-798, 1097, 1096, 1095, 1099, 1101, 1097, 869, 
-882, 875, 869, 884, 882, 869, 845, 876, 
-1094, 1095, 1096, 895, 904, 899, 888, 875, 
-882, 895, 882, 894, 899, 908, 914, 1105, 
-1100, 1103, 904, 915, 908, 908, 899, 904, 
-913, 931, 915, 915, 904, 913, 1100, 1094, 
-1098, 895, 888, 882, 899, 888, 895, 903, 
-895, 894, 904, 895, 903, 1091, 1092, 1093, 
-1115, 1116, 1117, 1118, 1119, 1120, 1118, 1121, 
-1119, 1078, 1086, 1082, 1094, 1096, 1098, 1100, 
-1098, 1103, 1060, 1058, 1057, 1064, 1067, 1057, 
-1067, 1064, 1071, 1071, 1075, 1067, 1078, 1082, 
-1075, 884, 894, 882, 1075, 1071, 1078, 1097, 
-1101, 1104, 857, 822, 845, 1061, 1063, 1059, 
-1059, 1056, 1061, 1057, 1056, 1059, 1076, 1079, 
-1083, 1076, 1068, 1072, 1072, 1079, 1076, 1068, 
-1065, 1061, 1061, 1072, 1068, 1065, 1069, 1063, 
-1063, 1061, 1065, 1087, 1089, 1083, 1134, 1135, 
-1136, 1101, 1106, 1104, 1011, 1015, 1013, 1125, 
-1123, 1121, 1121, 1127, 1125, 1126, 1124, 1123, 
-1123, 1125, 1126, 1119, 1121, 1123, 1124, 1122, 
-1119, 1119, 1123, 1124, 1094, 1100, 1102, 1120, 
-1119, 1122, 1137, 1138, 1139, 1140, 1141, 1142, 
-1105, 1107, 1100, 876, 884, 869, 857, 869, 
-875, 1095, 1099, 1097, 869, 857, 845, 1057, 
-1062, 1064, 1062, 1057, 1059, 1127, 1130, 1129, 
-1129, 1125, 1127, 1125, 1129, 1128, 1128, 1126, 
-1125, 1132, 1131, 1129, 1129, 1130, 1132, 1131, 
-1133, 1128, 1128, 1129, 1131, 1108, 1106, 1101, 
-763, 765, 769, 765, 763, 762, 763, 769, 
-776, 776, 771, 763, 771, 776, 786, 786, 
-787, 771, 787, 786, 807, 807, 808, 787, 
-975, 980, 978, 978, 976, 975, 768, 781, 
-770, 770, 762, 768, 782, 801, 781, 781, 
-768, 782, 1010, 1016, 1014, 1014, 1012, 1010, 
-793, 814, 802, 784, 776, 769, 776, 784, 
-794, 794, 786, 776, 786, 794, 806, 806, 
-807, 786, 980, 984, 982, 982, 978, 980, 
-1019, 1014, 1016, 793, 783, 775, 783, 802, 
-784, 802, 783, 793, 775, 769, 765, 769, 
-783, 784, 783, 769, 775, 762, 770, 765, 
-775, 765, 770, 793, 785, 805, 785, 793, 
-775, 805, 804, 829, 804, 805, 785, 805, 
-830, 814, 814, 793, 805, 829, 855, 830, 
-830, 805, 829, 770, 785, 775, 785, 770, 
-791, 791, 804, 785, 1148, 1149, 1150, 1152, 
-1153, 1148, 1148, 1150, 1152, 1019, 1016, 1023, 
-1022, 1014, 1019, 770, 781, 791, 1019, 1026, 
-1022, 1174, 1175, 1176, 804, 817, 827, 827, 
-829, 804, 829, 827, 853, 853, 855, 829, 
-1152, 1155, 1154, 1154, 1153, 1152, 791, 828, 
-817, 817, 804, 791, 1156, 1154, 1155, 1183, 
-1184, 1185, 1185, 1187, 1183, 1176, 1178, 1177, 
-1177, 1174, 1176, 817, 840, 839, 839, 827, 
-817, 1163, 1161, 1158, 864, 853, 827, 828, 
-854, 840, 840, 817, 828, 1155, 1158, 1157, 
-1157, 1156, 1155, 1184, 1188, 1186, 1186, 1185, 
-1184, 1178, 1180, 1179, 1179, 1177, 1178, 840, 
-865, 863, 863, 839, 840, 1161, 1164, 1160, 
-1160, 1158, 1161, 854, 873, 865, 865, 840, 
-854, 1158, 1160, 1159, 1159, 1157, 1158, 1188, 
-1190, 1189, 1189, 1186, 1188, 1180, 1182, 1181, 
-1181, 1179, 1180, 865, 881, 880, 880, 863, 
-865, 1164, 1167, 1165, 1165, 1160, 1164, 873, 
-887, 881, 881, 865, 873, 1160, 1165, 1162, 
-1162, 1159, 1160, 1167, 1169, 1166, 1166, 1165, 
-1167, 1170, 1166, 1169, 1170, 1172, 1171, 881, 
-898, 892, 892, 880, 881, 1196, 1197, 1198, 
-893, 881, 887, 902, 892, 898, 1197, 1199, 
-1198, 898, 912, 907, 907, 902, 898, 1166, 
-1168, 1162, 1162, 1165, 1166, 1168, 1166, 1170, 
-1171, 1173, 1168, 1168, 1170, 1171, 1191, 1189, 
-1190, 1190, 1192, 1191, 1193, 1191, 1192, 1203, 
-1204, 1205, 1197, 1200, 1199, 920, 930, 912, 
-912, 898, 920, 1192, 1195, 1194, 1194, 1193, 
-1192, 1200, 1202, 1201, 1201, 1199, 1200, 1206, 
-1207, 1208, 1208, 1210, 1206, 1207, 1211, 1209, 
-1209, 1208, 1207, 979, 977, 981, 981, 983, 
-979, 1088, 1086, 1091, 1086, 1088, 1082, 904, 
-903, 913, 1092, 1091, 1086, 1525, 1526, 1527, 
-921, 914, 908, 940, 921, 922, 1111, 1113, 
-1112, 915, 932, 922, 922, 908, 915, 1212, 
-1213, 1214, 939, 915, 931, 940, 922, 932, 
-1213, 1215, 1214, 932, 951, 947, 947, 940, 
-932, 1109, 1110, 1107, 1107, 1105, 1109, 1110, 
-1109, 1111, 1112, 1114, 1110, 1110, 1111, 1112, 
-1143, 1142, 1141, 1141, 1144, 1143, 1145, 1143, 
-1144, 1219, 1220, 1221, 1213, 1216, 1215, 957, 
-963, 951, 951, 932, 957, 1144, 1147, 1146, 
-1146, 1145, 1144, 1216, 1218, 1217, 1217, 1215, 
-1216, 1222, 1223, 1224, 1224, 1226, 1222, 1223, 
-1227, 1225, 1225, 1224, 1223, 784, 816, 803, 
-803, 794, 784, 794, 803, 815, 815, 806, 
-794, 984, 989, 986, 986, 982, 984, 851, 
-861, 838, 803, 838, 826, 826, 815, 803, 
-815, 826, 837, 992, 986, 989, 861, 878, 
-862, 862, 838, 861, 838, 862, 852, 852, 
-826, 838, 1228, 1229, 1230, 850, 837, 826, 
-878, 885, 872, 872, 862, 878, 862, 872, 
-852, 879, 852, 872, 1229, 1232, 1231, 1231, 
-1230, 1229, 1277, 1278, 1279, 838, 803, 851, 
-851, 836, 871, 871, 861, 851, 861, 871, 
-877, 877, 878, 861, 878, 877, 889, 889, 
-885, 878, 1286, 1287, 1285, 859, 871, 836, 
-871, 859, 877, 1281, 1282, 1283, 1282, 1281, 
-1284, 1290, 1291, 1292, 834, 859, 836, 1283, 
-1285, 1281, 1285, 1283, 1286, 784, 802, 813, 
-813, 816, 784, 816, 813, 836, 1280, 1277, 
-1279, 802, 835, 825, 825, 813, 802, 813, 
-825, 834, 834, 836, 813, 1286, 1289, 1288, 
-1288, 1287, 1286, 835, 860, 849, 849, 825, 
-835, 825, 849, 848, 848, 834, 825, 1034, 
-1027, 1030, 1030, 1039, 1034, 1027, 1023, 1016, 
-1016, 1030, 1027, 1306, 1307, 1308, 1310, 1309, 
-1308, 1306, 1308, 1309, 870, 848, 849, 1235, 
-1239, 1237, 1233, 1231, 1232, 1239, 1241, 1240, 
-1240, 1237, 1239, 1241, 1245, 1243, 1243, 1240, 
-1241, 1245, 1249, 1247, 1247, 1243, 1245, 1249, 
-1253, 1247, 1253, 1260, 1256, 1256, 1247, 1253, 
-1260, 1268, 1264, 1264, 1256, 1260, 1268, 1270, 
-1269, 1269, 1264, 1268, 1270, 1272, 1271, 1271, 
-1269, 1270, 1272, 1274, 1273, 1273, 1271, 1272, 
-1311, 1312, 1313, 1313, 1316, 1311, 1312, 1318, 
-1315, 1315, 1313, 1312, 955, 934, 949, 949, 
-962, 955, 934, 926, 942, 942, 949, 934, 
-1322, 1323, 1324, 934, 955, 961, 943, 917, 
-934, 917, 910, 926, 926, 934, 917, 1249, 
-1252, 1255, 1255, 1253, 1249, 919, 897, 911, 
-911, 929, 919, 1252, 1249, 1245, 897, 901, 
-906, 906, 911, 897, 901, 910, 906, 917, 
-906, 910, 885, 896, 890, 890, 872, 885, 
-872, 890, 886, 886, 879, 872, 889, 900, 
-896, 896, 885, 889, 1290, 1294, 1293, 1293, 
-1291, 1290, 905, 910, 901, 901, 890, 896, 
-897, 886, 890, 900, 909, 905, 1294, 1296, 
-1295, 1295, 1293, 1294, 924, 923, 941, 941, 
-942, 924, 909, 916, 923, 924, 926, 910, 
-1298, 1297, 1299, 1299, 1300, 1298, 1295, 1296, 
-1297, 1297, 1298, 1295, 901, 897, 890, 905, 
-901, 896, 905, 896, 900, 905, 909, 910, 
-924, 909, 923, 910, 909, 924, 926, 924, 
-942, 909, 900, 916, 1149, 1148, 1151, 956, 
-953, 959, 959, 950, 956, 950, 936, 946, 
-946, 956, 950, 936, 911, 927, 927, 946, 
-936, 953, 948, 943, 943, 959, 953, 948, 
-944, 933, 933, 943, 948, 944, 935, 925, 
-925, 933, 944, 935, 927, 918, 918, 925, 
-935, 911, 918, 927, 1267, 1268, 1260, 1260, 
-1263, 1267, 1263, 1260, 1253, 1253, 1259, 1263, 
-936, 929, 911, 1322, 1325, 1323, 933, 917, 
-943, 917, 933, 925, 925, 906, 917, 906, 
-925, 918, 906, 918, 911, 1259, 1253, 1255, 
-1272, 1276, 1275, 1275, 1274, 1272, 968, 970, 
-972, 1312, 1311, 1314, 942, 958, 954, 954, 
-949, 942, 942, 941, 952, 952, 958, 942, 
-1319, 1321, 1320, 966, 954, 958, 958, 971, 
-969, 962, 949, 960, 949, 954, 960, 969, 
-966, 958, 1319, 1318, 1312, 1320, 1318, 1319, 
-1299, 1303, 1301, 1301, 1300, 1299, 1303, 1305, 
-1304, 1304, 1301, 1303, 1301, 1302, 1300, 964, 
-958, 952, 952, 967, 964, 1326, 1327, 1328, 
-1331, 1332, 1333, 1326, 1329, 1330, 1326, 1328, 
-1329, 1337, 1338, 1339, 1339, 1340, 1337, 1340, 
-1339, 1341, 1332, 1331, 1334, 1335, 1333, 1332, 
-1332, 1336, 1335, 1241, 1242, 1244, 1244, 1245, 
-1241, 1342, 1343, 1344, 928, 919, 937, 1456, 
-1453, 1454, 1241, 1239, 1242, 1456, 1455, 1453, 
-1450, 1453, 1455, 1234, 1233, 1232, 1233, 1235, 
-1237, 1234, 1238, 1236, 1236, 1235, 1234, 1345, 
-1346, 1347, 1358, 1359, 1360, 1346, 1350, 1348, 
-1348, 1347, 1346, 1350, 1355, 1353, 1353, 1348, 
-1350, 1361, 1362, 1363, 1365, 1366, 1361, 1361, 
-1363, 1365, 1365, 1367, 1366, 1367, 1365, 1368, 
-1368, 1369, 1367, 1369, 1370, 1371, 1357, 1353, 
-1355, 1370, 1369, 1368, 1347, 1349, 1351, 1351, 
-1354, 1347, 1348, 1352, 1349, 1349, 1347, 1348, 
-1353, 1356, 1352, 1352, 1348, 1353, 1373, 1372, 
-1375, 1375, 1378, 1373, 1380, 1385, 1384, 1385, 
-1380, 1383, 1356, 1353, 1357, 1378, 1375, 1380, 
-1380, 1384, 1378, 1379, 1381, 1376, 1376, 1374, 
-1379, 1374, 1376, 1372, 1372, 1373, 1374, 1381, 
-1382, 1376, 1377, 1376, 1382, 1376, 1377, 1372, 
-1375, 1372, 1377, 1382, 1387, 1383, 1383, 1377, 
-1382, 1377, 1383, 1380, 1380, 1375, 1377, 1386, 
-1382, 1381, 1386, 1387, 1382, 1390, 1391, 1392, 
-1386, 1381, 1388, 1388, 1389, 1386, 891, 879, 
-886, 1362, 1361, 1364, 1234, 1235, 1233, 919, 
-928, 897, 938, 897, 928, 965, 968, 960, 
-965, 970, 968, 1317, 1312, 1314, 965, 969, 
-973, 965, 954, 966, 965, 960, 954, 965, 
-966, 969, 965, 973, 974, 945, 953, 956, 
-945, 956, 946, 945, 946, 927, 945, 948, 
-953, 945, 944, 948, 945, 935, 944, 945, 
-927, 935, 1393, 1394, 1395, 996, 995, 993, 
-1394, 1393, 1396, 1399, 1400, 1397, 1397, 1398, 
-1399, 996, 998, 995, 999, 995, 998, 1400, 
-1402, 1401, 1401, 1397, 1400, 998, 1001, 1000, 
-1000, 999, 998, 1402, 1404, 1403, 1403, 1401, 
-1402, 1001, 1003, 1002, 1002, 1000, 1001, 1404, 
-1406, 1405, 1405, 1403, 1404, 1003, 1005, 1004, 
-1004, 1002, 1003, 1406, 1408, 1407, 1407, 1405, 
-1406, 1005, 1007, 1006, 1006, 1004, 1005, 1410, 
-1411, 1412, 1409, 1407, 1408, 1413, 1411, 1410, 
-1410, 1414, 1413, 1242, 1248, 1246, 1246, 1244, 
-1242, 1420, 1415, 1419, 1419, 1421, 1420, 1415, 
-1416, 1417, 1417, 1419, 1415, 1262, 1258, 1266, 
-1417, 1416, 1418, 1422, 1423, 1424, 1424, 1425, 
-1422, 1426, 1427, 1428, 1428, 1430, 1426, 1427, 
-1432, 1429, 1429, 1428, 1427, 1435, 1429, 1432, 
-1435, 1432, 1437, 1439, 1435, 1437, 1429, 1434, 
-1431, 1431, 1428, 1429, 1428, 1431, 1433, 1433, 
-1430, 1428, 1435, 1439, 1438, 1438, 1436, 1435, 
-1440, 1438, 1439, 1444, 1446, 1442, 1442, 1441, 
-1444, 1441, 1442, 1443, 1443, 1445, 1441, 1452, 
-1453, 1450, 1450, 1451, 1452, 1447, 1445, 1443, 
-1443, 1448, 1447, 1258, 1262, 1251, 1251, 1254, 
-1258, 1250, 1257, 1254, 1254, 1248, 1250, 1454, 
-1453, 1452, 1250, 1248, 1242, 1261, 1265, 1258, 
-1266, 1258, 1265, 1449, 1447, 1448, 1440, 1439, 
-1437, 1248, 1254, 1251, 1251, 1246, 1248, 1436, 
-1434, 1429, 1429, 1435, 1436, 1254, 1257, 1261, 
-1261, 1258, 1254, 1066, 1063, 1069, 1069, 1074, 
-1066, 1073, 1066, 1074, 1074, 1080, 1073, 1077, 
-1073, 1080, 1080, 1084, 1077, 1085, 1077, 1084, 
-1084, 1090, 1085, 1066, 1059, 1063, 1066, 1070, 
-1059, 1070, 1066, 1073, 1457, 1458, 1459, 1073, 
-1077, 1070, 1458, 1460, 1462, 1081, 1070, 1077, 
-1077, 1085, 1081, 1460, 1458, 1457, 1466, 1467, 
-1463, 1463, 1462, 1466, 832, 811, 846, 846, 
-858, 832, 1042, 1041, 1038, 1042, 1038, 1029, 
-1029, 1038, 1033, 1029, 1033, 1021, 1031, 1035, 
-1028, 1025, 1031, 1028, 1028, 1035, 1041, 1041, 
-1042, 1028, 799, 789, 811, 799, 811, 823, 
-832, 823, 811, 1021, 1018, 1015, 1021, 1024, 
-1029, 1021, 1015, 1024, 1051, 1053, 1055, 1055, 
-1048, 1051, 1053, 1051, 1045, 1031, 1045, 1040, 
-1467, 1465, 1463, 1465, 1461, 1463, 1461, 1459, 
-1458, 1458, 1463, 1461, 1462, 1460, 1464, 1462, 
-1463, 1458, 1020, 1024, 1015, 1020, 1015, 1017, 
-1020, 1017, 1025, 1020, 1025, 1028, 1040, 1035, 
-1031, 1040, 1045, 1051, 1040, 1051, 1043, 1043, 
-1051, 1048, 1043, 1048, 1033, 1043, 1033, 1038, 
-1468, 1469, 1470, 1470, 1472, 1468, 1474, 1475, 
-1476, 1476, 1477, 1474, 1479, 1480, 1481, 1481, 
-1482, 1479, 1484, 1485, 1486, 1486, 1487, 1484, 
-1469, 1473, 1471, 1471, 1470, 1469, 1038, 1041, 
-1052, 1052, 1049, 1038, 1043, 1038, 1049, 1049, 
-1050, 1043, 1040, 1043, 1050, 1050, 1044, 1040, 
-1035, 1040, 1044, 1044, 1046, 1035, 1041, 1035, 
-1046, 1046, 1052, 1041, 1489, 1490, 1491, 1478, 
-1477, 1476, 1483, 1482, 1481, 1488, 1487, 1486, 
-1489, 1491, 1492, 1494, 1501, 1497, 1497, 1495, 
-1494, 1493, 1494, 1495, 1495, 1498, 1493, 1502, 
-1503, 1504, 1504, 1505, 1502, 1507, 1508, 1509, 
-1509, 1510, 1507, 1511, 1507, 1510, 1512, 1513, 
-1514, 1028, 1042, 1047, 1047, 1054, 1028, 1496, 
-1499, 1494, 1494, 1493, 1496, 1515, 1516, 1517, 
-1036, 1032, 1024, 1029, 1024, 1032, 1032, 1037, 
-1029, 1042, 1029, 1037, 1037, 1047, 1042, 1500, 
-1495, 1497, 1500, 1498, 1495, 1506, 1505, 1504, 
-1518, 1519, 1520, 1518, 1521, 1519, 1528, 1529, 
-1530, 1532, 1530, 1529, 1539, 1528, 1533, 1530, 
-1533, 1528, 1555, 1539, 1545, 1533, 1545, 1539, 
-1563, 1576, 1555, 1555, 1545, 1563, 1742, 1743, 
-1744, 1744, 1746, 1742, 1537, 1543, 1532, 1532, 
-1529, 1537, 1767, 1768, 1769, 1543, 1537, 1552, 
-1536, 1538, 1530, 1530, 1532, 1536, 1538, 1544, 
-1533, 1533, 1530, 1538, 1544, 1562, 1545, 1545, 
-1533, 1544, 1562, 1586, 1563, 1563, 1545, 1562, 
-1542, 1536, 1532, 1532, 1543, 1542, 1560, 1542, 
-1543, 1769, 1768, 1770, 1754, 1752, 1750, 1748, 
-1750, 1752, 1752, 1754, 1757, 1761, 1762, 1760, 
-1584, 1597, 1607, 1607, 1608, 1584, 1597, 1617, 
-1622, 1622, 1607, 1597, 1754, 1750, 1758, 1573, 
-1585, 1562, 1586, 1562, 1585, 1573, 1584, 1585, 
-1608, 1585, 1584, 1757, 1760, 1755, 1760, 1757, 
-1761, 1755, 1752, 1757, 1752, 1755, 1748, 1544, 
-1553, 1562, 1573, 1562, 1553, 1538, 1551, 1553, 
-1553, 1544, 1538, 1536, 1550, 1551, 1551, 1538, 
-1536, 1542, 1559, 1550, 1550, 1536, 1542, 1560, 
-1595, 1570, 1559, 1542, 1570, 1772, 1776, 1774, 
-1777, 1770, 1774, 1763, 1765, 1762, 1762, 1761, 
-1763, 1637, 1646, 1622, 1622, 1617, 1637, 1572, 
-1593, 1597, 1597, 1584, 1572, 1593, 1618, 1617, 
-1617, 1597, 1593, 1553, 1572, 1584, 1584, 1573, 
-1553, 1618, 1638, 1637, 1637, 1617, 1618, 1569, 
-1605, 1593, 1593, 1572, 1569, 1605, 1619, 1618, 
-1618, 1593, 1605, 1551, 1569, 1572, 1572, 1553, 
-1551, 1619, 1639, 1638, 1638, 1618, 1619, 1768, 
-1772, 1770, 1543, 1561, 1560, 1767, 1769, 1771, 
-1552, 1561, 1543, 1569, 1594, 1605, 1594, 1569, 
-1571, 1594, 1630, 1619, 1619, 1605, 1594, 1815, 
-1816, 1817, 1639, 1619, 1630, 1550, 1571, 1569, 
-1569, 1551, 1550, 1571, 1596, 1594, 1596, 1571, 
-1583, 1594, 1620, 1630, 1620, 1594, 1596, 1620, 
-1648, 1653, 1559, 1583, 1571, 1571, 1550, 1559, 
-1852, 1851, 1854, 1854, 1858, 1856, 1647, 1652, 
-1640, 1652, 1654, 1640, 1648, 1620, 1640, 1851, 
-1852, 1853, 1669, 1673, 1664, 1652, 1647, 1660, 
-1665, 1652, 1664, 1685, 1679, 1669, 1860, 1857, 
-1862, 1679, 1686, 1673, 1673, 1669, 1679, 1686, 
-1705, 1687, 1687, 1673, 1686, 1855, 1853, 1857, 
-1652, 1660, 1664, 1664, 1660, 1669, 1665, 1664, 
-1674, 1674, 1664, 1673, 1850, 1849, 1848, 1872, 
-1873, 1874, 1875, 1876, 1877, 1876, 1879, 1877, 
-1841, 1845, 1837, 1855, 1851, 1853, 1860, 1855, 
-1857, 1816, 1815, 1818, 1816, 1826, 1823, 1830, 
-1823, 1826, 1826, 1834, 1830, 1834, 1841, 1837, 
-1652, 1665, 1654, 1837, 1830, 1834, 1861, 1858, 
-1854, 1620, 1596, 1631, 1819, 1822, 1820, 1820, 
-1817, 1819, 1819, 1817, 1816, 1844, 1840, 1836, 
-1833, 1829, 1836, 1836, 1840, 1833, 1820, 1825, 
-1829, 1829, 1833, 1820, 1822, 1828, 1825, 1825, 
-1820, 1822, 1765, 1766, 1762, 1891, 1892, 1893, 
-1861, 1863, 1858, 1772, 1774, 1770, 1879, 1881, 
-1882, 1882, 1884, 1879, 1881, 1880, 1883, 1883, 
-1882, 1881, 1881, 1879, 1876, 1876, 1878, 1880, 
-1880, 1881, 1876, 1859, 1857, 1853, 1878, 1876, 
-1875, 1894, 1895, 1896, 1897, 1898, 1899, 1857, 
-1864, 1862, 1640, 1654, 1648, 1647, 1640, 1631, 
-1854, 1856, 1852, 1620, 1631, 1640, 1823, 1821, 
-1816, 1819, 1816, 1821, 1886, 1887, 1884, 1884, 
-1882, 1886, 1885, 1886, 1882, 1882, 1883, 1885, 
-1886, 1888, 1889, 1889, 1887, 1886, 1885, 1890, 
-1888, 1888, 1886, 1885, 1858, 1863, 1865, 1534, 
-1531, 1528, 1529, 1528, 1531, 1541, 1534, 1528, 
-1528, 1539, 1541, 1554, 1541, 1539, 1539, 1555, 
-1554, 1575, 1554, 1555, 1555, 1576, 1575, 1745, 
-1747, 1744, 1744, 1743, 1745, 1535, 1549, 1537, 
-1537, 1529, 1535, 1549, 1568, 1552, 1552, 1537, 
-1549, 1773, 1775, 1767, 1767, 1771, 1773, 1564, 
-1578, 1556, 1534, 1541, 1547, 1557, 1547, 1541, 
-1541, 1554, 1557, 1574, 1557, 1554, 1554, 1575, 
-1574, 1749, 1751, 1747, 1747, 1745, 1749, 1775, 
-1773, 1778, 1540, 1546, 1556, 1547, 1564, 1546, 
-1556, 1546, 1564, 1531, 1534, 1540, 1547, 1546, 
-1534, 1540, 1534, 1546, 1531, 1535, 1529, 1535, 
-1531, 1540, 1566, 1548, 1556, 1540, 1556, 1548, 
-1589, 1567, 1566, 1548, 1566, 1567, 1578, 1590, 
-1566, 1566, 1556, 1578, 1590, 1615, 1589, 1589, 
-1566, 1590, 1540, 1548, 1535, 1558, 1535, 1548, 
-1548, 1567, 1558, 1905, 1906, 1907, 1907, 1910, 
-1909, 1909, 1905, 1907, 1782, 1775, 1778, 1778, 
-1773, 1781, 1558, 1549, 1535, 1781, 1785, 1778, 
-1931, 1932, 1933, 1591, 1581, 1567, 1567, 1589, 
-1591, 1614, 1591, 1589, 1589, 1615, 1614, 1911, 
-1912, 1909, 1909, 1910, 1911, 1581, 1592, 1558, 
-1558, 1567, 1581, 1912, 1911, 1913, 1940, 1941, 
-1942, 1942, 1944, 1940, 1934, 1935, 1931, 1931, 
-1933, 1934, 1603, 1604, 1581, 1581, 1591, 1603, 
-1915, 1919, 1921, 1591, 1614, 1627, 1604, 1616, 
-1592, 1592, 1581, 1604, 1914, 1915, 1912, 1912, 
-1913, 1914, 1943, 1945, 1941, 1941, 1940, 1943, 
-1936, 1937, 1935, 1935, 1934, 1936, 1628, 1629, 
-1604, 1604, 1603, 1628, 1917, 1922, 1919, 1919, 
-1915, 1917, 1629, 1636, 1616, 1616, 1604, 1629, 
-1916, 1917, 1915, 1915, 1914, 1916, 1946, 1947, 
-1945, 1945, 1943, 1946, 1938, 1939, 1937, 1937, 
-1936, 1938, 1644, 1645, 1629, 1629, 1628, 1644, 
-1920, 1924, 1922, 1922, 1917, 1920, 1645, 1651, 
-1636, 1636, 1629, 1645, 1918, 1920, 1917, 1917, 
-1916, 1918, 1923, 1926, 1924, 1924, 1920, 1923, 
-1926, 1923, 1927, 1928, 1929, 1927, 1658, 1663, 
-1645, 1645, 1644, 1658, 1953, 1954, 1955, 1651, 
-1645, 1659, 1663, 1658, 1668, 1953, 1956, 1954, 
-1672, 1678, 1663, 1663, 1668, 1672, 1918, 1925, 
-1923, 1923, 1920, 1918, 1927, 1923, 1925, 1925, 
-1930, 1928, 1928, 1927, 1925, 1947, 1946, 1948, 
-1948, 1949, 1947, 1949, 1948, 1950, 1960, 1961, 
-1962, 1956, 1957, 1954, 1678, 1695, 1684, 1684, 
-1663, 1678, 1951, 1952, 1949, 1949, 1950, 1951, 
-1958, 1959, 1957, 1957, 1956, 1958, 1963, 1964, 
-1965, 1965, 1967, 1963, 1966, 1968, 1964, 1964, 
-1963, 1966, 1748, 1742, 1746, 1746, 1750, 1748, 
-1848, 1845, 1846, 1841, 1846, 1845, 1687, 1674, 
-1673, 1845, 1848, 1849, 3050, 3051, 3052, 1679, 
-1685, 1696, 1697, 1696, 1712, 1869, 1870, 1868, 
-1697, 1704, 1686, 1686, 1679, 1697, 1969, 1970, 
-1971, 1705, 1686, 1713, 1704, 1697, 1712, 1969, 
-1972, 1970, 1717, 1723, 1704, 1704, 1712, 1717, 
-1864, 1867, 1866, 1866, 1862, 1864, 1868, 1866, 
-1867, 1867, 1871, 1869, 1869, 1868, 1867, 1898, 
-1897, 1900, 1900, 1901, 1898, 1901, 1900, 1902, 
-1976, 1977, 1978, 1972, 1973, 1970, 1723, 1733, 
-1729, 1729, 1704, 1723, 1903, 1904, 1901, 1901, 
-1902, 1903, 1974, 1975, 1973, 1973, 1972, 1974, 
-1979, 1980, 1981, 1981, 1983, 1979, 1982, 1984, 
-1980, 1980, 1979, 1982, 1565, 1580, 1547, 1547, 
-1557, 1565, 1579, 1565, 1557, 1557, 1574, 1579, 
-1753, 1756, 1751, 1751, 1749, 1753, 1602, 1626, 
-1613, 1588, 1602, 1565, 1565, 1579, 1588, 1601, 
-1588, 1579, 1756, 1753, 1759, 1625, 1643, 1626, 
-1626, 1602, 1625, 1612, 1625, 1602, 1602, 1588, 
-1612, 1985, 1986, 1987, 1588, 1601, 1611, 1635, 
-1650, 1643, 1643, 1625, 1635, 1612, 1635, 1625, 
-1635, 1612, 1642, 1988, 1989, 1986, 1986, 1985, 
-1988, 2034, 2035, 2036, 1613, 1565, 1602, 1634, 
-1600, 1613, 1613, 1626, 1634, 1641, 1634, 1626, 
-1626, 1643, 1641, 1657, 1641, 1643, 1643, 1650, 
-1657, 2042, 2044, 2043, 1600, 1634, 1623, 1641, 
-1623, 1634, 2038, 2039, 2040, 2041, 2040, 2039, 
-2047, 2048, 2049, 1600, 1623, 1598, 2040, 2042, 
-2038, 2043, 2038, 2042, 1577, 1564, 1547, 1547, 
-1580, 1577, 1600, 1577, 1580, 2034, 2036, 2037, 
-1587, 1599, 1564, 1564, 1577, 1587, 1598, 1587, 
-1577, 1577, 1600, 1598, 2045, 2046, 2043, 2043, 
-2044, 2045, 1610, 1624, 1599, 1599, 1587, 1610, 
-1609, 1610, 1587, 1587, 1598, 1609, 1789, 1786, 
-1793, 1793, 1798, 1789, 1775, 1782, 1786, 1786, 
-1789, 1775, 2063, 2064, 2065, 2063, 2066, 2067, 
-2066, 2063, 2065, 1610, 1609, 1633, 1993, 1995, 
-1992, 1989, 1988, 1990, 1997, 1998, 1995, 1995, 
-1993, 1997, 1999, 2001, 1998, 1998, 1997, 1999, 
-2003, 2005, 2001, 2001, 1999, 2003, 2003, 2007, 
-2005, 2011, 2014, 2007, 2007, 2003, 2011, 2018, 
-2022, 2014, 2014, 2011, 2018, 2026, 2027, 2022, 
-2022, 2018, 2026, 2028, 2029, 2027, 2027, 2026, 
-2028, 2030, 2031, 2029, 2029, 2028, 2030, 2068, 
-2069, 2070, 2070, 2073, 2068, 2071, 2074, 2069, 
-2069, 2068, 2071, 1715, 1699, 1720, 1720, 1727, 
-1715, 1708, 1689, 1699, 1699, 1715, 1708, 2079, 
-2080, 2081, 1726, 1720, 1699, 1699, 1680, 1707, 
-1689, 1675, 1680, 1680, 1699, 1689, 2012, 2008, 
-2005, 2005, 2007, 2012, 1676, 1661, 1681, 1681, 
-1691, 1676, 2001, 2005, 2008, 1670, 1666, 1661, 
-1661, 1676, 1670, 1670, 1675, 1666, 1675, 1670, 
-1680, 1656, 1662, 1650, 1650, 1635, 1656, 1649, 
-1656, 1635, 1635, 1642, 1649, 1662, 1667, 1657, 
-1657, 1650, 1662, 2050, 2051, 2049, 2049, 2048, 
-2050, 1666, 1675, 1671, 1662, 1656, 1666, 1656, 
-1649, 1661, 1671, 1677, 1667, 2052, 2053, 2051, 
-2051, 2050, 2052, 1711, 1694, 1693, 1693, 1708, 
-1711, 1694, 1683, 1677, 1675, 1689, 1693, 2056, 
-2054, 2055, 2055, 2057, 2056, 2054, 2053, 2052, 
-2052, 2055, 2054, 1656, 1661, 1666, 1662, 1666, 
-1671, 1667, 1662, 1671, 1675, 1677, 1671, 1694, 
-1677, 1693, 1693, 1677, 1675, 1708, 1693, 1689, 
-1683, 1667, 1677, 1908, 1907, 1906, 1724, 1718, 
-1722, 1722, 1716, 1724, 1710, 1702, 1716, 1716, 
-1722, 1710, 1692, 1676, 1702, 1702, 1710, 1692, 
-1707, 1714, 1718, 1718, 1724, 1707, 1698, 1706, 
-1714, 1714, 1707, 1698, 1688, 1703, 1706, 1706, 
-1698, 1688, 1682, 1692, 1703, 1703, 1688, 1682, 
-1692, 1682, 1676, 2014, 2022, 2023, 2023, 2019, 
-2014, 2007, 2014, 2019, 2019, 2015, 2007, 1676, 
-1691, 1702, 2080, 2082, 2081, 1707, 1680, 1698, 
-1688, 1698, 1680, 1680, 1670, 1688, 1682, 1688, 
-1670, 1676, 1682, 1670, 2012, 2007, 2015, 2032, 
-2033, 2029, 2029, 2031, 2032, 1739, 1737, 1735, 
-2072, 2070, 2069, 1721, 1725, 1708, 1708, 1715, 
-1721, 1719, 1711, 1708, 1708, 1725, 1719, 2077, 
-2078, 2076, 1725, 1721, 1732, 1736, 1738, 1725, 
-1728, 1715, 1727, 1728, 1721, 1715, 1725, 1732, 
-1736, 2069, 2074, 2076, 2076, 2074, 2077, 2058, 
-2060, 2056, 2056, 2057, 2058, 2061, 2062, 2060, 
-2060, 2058, 2061, 2057, 2059, 2058, 1719, 1725, 
-1730, 1730, 1734, 1719, 2083, 2084, 2085, 2088, 
-2089, 2090, 2087, 2086, 2085, 2086, 2083, 2085, 
-2094, 2095, 2096, 2096, 2097, 2094, 2098, 2094, 
-2097, 2092, 2090, 2089, 2089, 2088, 2091, 2091, 
-2093, 2089, 2002, 2000, 1998, 1998, 2001, 2002, 
-2099, 2100, 2101, 1701, 1681, 1690, 2222, 2220, 
-2223, 2000, 1995, 1998, 2220, 2221, 2223, 2221, 
-2220, 2219, 1989, 1990, 1991, 1993, 1992, 1990, 
-1994, 1996, 1991, 1991, 1992, 1994, 2102, 2103, 
-2104, 2115, 2116, 2117, 2105, 2107, 2103, 2103, 
-2102, 2105, 2110, 2112, 2107, 2107, 2105, 2110, 
-2118, 2119, 2120, 2120, 2123, 2122, 2122, 2118, 
-2120, 2123, 2124, 2122, 2125, 2122, 2124, 2124, 
-2126, 2125, 2128, 2127, 2126, 2112, 2110, 2114, 
-2125, 2126, 2127, 2108, 2106, 2102, 2102, 2111, 
-2108, 2106, 2109, 2105, 2105, 2102, 2106, 2109, 
-2113, 2110, 2110, 2105, 2109, 2132, 2131, 2130, 
-2130, 2135, 2132, 2141, 2142, 2137, 2140, 2137, 
-2142, 2114, 2110, 2113, 2137, 2132, 2135, 2135, 
-2141, 2137, 2133, 2139, 2136, 2136, 2129, 2133, 
-2131, 2133, 2129, 2129, 2130, 2131, 2133, 2138, 
-2139, 2138, 2133, 2134, 2131, 2134, 2133, 2134, 
-2131, 2132, 2140, 2144, 2138, 2138, 2134, 2140, 
-2137, 2140, 2134, 2134, 2132, 2137, 2139, 2138, 
-2143, 2138, 2144, 2143, 2147, 2148, 2149, 2145, 
-2139, 2143, 2143, 2146, 2145, 1649, 1642, 1655, 
-2121, 2120, 2119, 1990, 1992, 1991, 1661, 1690, 
-1681, 1690, 1661, 1700, 1728, 1735, 1731, 1735, 
-1737, 1731, 2072, 2069, 2075, 1740, 1736, 1731, 
-1732, 1721, 1731, 1721, 1728, 1731, 1736, 1732, 
-1731, 1741, 1740, 1731, 1722, 1718, 1709, 1710, 
-1722, 1709, 1692, 1710, 1709, 1718, 1714, 1709, 
-1714, 1706, 1709, 1706, 1703, 1709, 1703, 1692, 
-1709, 2150, 2151, 2152, 1760, 1762, 1764, 2153, 
-2152, 2151, 2156, 2157, 2154, 2154, 2155, 2156, 
-2180, 2178, 2181, 2178, 2180, 2179, 2158, 2159, 
-2157, 2157, 2156, 2158, 2177, 2176, 2178, 2178, 
-2179, 2177, 2160, 2161, 2159, 2159, 2158, 2160, 
-2175, 2174, 2176, 2176, 2177, 2175, 2162, 2163, 
-2161, 2161, 2160, 2162, 2173, 2172, 2174, 2174, 
-2175, 2173, 2164, 2165, 2163, 2163, 2162, 2164, 
-2169, 2171, 2172, 2172, 2173, 2169, 2167, 2168, 
-2169, 2165, 2164, 2166, 2169, 2168, 2170, 2170, 
-2171, 2169, 2004, 2006, 2000, 2000, 2002, 2004, 
-2186, 2184, 2187, 2187, 2188, 2186, 2182, 2183, 
-2184, 2184, 2186, 2182, 2025, 2016, 2021, 2185, 
-2183, 2182, 2189, 2190, 2191, 2191, 2192, 2189, 
-2193, 2194, 2195, 2195, 2197, 2193, 2196, 2199, 
-2194, 2194, 2193, 2196, 2199, 2196, 2202, 2204, 
-2199, 2202, 2204, 2202, 2206, 2198, 2201, 2196, 
-2196, 2193, 2198, 2200, 2198, 2193, 2193, 2197, 
-2200, 2205, 2206, 2202, 2202, 2203, 2205, 2206, 
-2205, 2207, 2209, 2213, 2211, 2211, 2210, 2209, 
-2208, 2209, 2210, 2210, 2212, 2208, 2219, 2220, 
-2217, 2217, 2218, 2219, 2208, 2212, 2214, 2214, 
-2215, 2208, 2009, 2021, 2016, 2016, 2013, 2009, 
-2013, 2017, 2010, 2010, 2006, 2013, 2217, 2220, 
-2222, 2000, 2006, 2010, 2016, 2024, 2020, 2024, 
-2016, 2025, 2215, 2214, 2216, 2204, 2206, 2207, 
-2009, 2013, 2006, 2006, 2004, 2009, 2196, 2201, 
-2203, 2203, 2202, 2196, 2020, 2017, 2013, 2013, 
-2016, 2020, 1828, 1822, 1824, 1824, 1832, 1828, 
-1832, 1824, 1831, 1831, 1838, 1832, 1838, 1831, 
-1835, 1835, 1843, 1838, 1843, 1835, 1842, 1842, 
-1847, 1843, 1822, 1819, 1824, 1819, 1827, 1824, 
-1831, 1824, 1827, 2224, 2225, 2226, 1827, 1835, 
-1831, 2230, 2228, 2225, 1835, 1827, 1839, 1839, 
-1842, 1835, 2226, 2225, 2228, 2229, 2233, 2234, 
-2234, 2230, 2229, 1621, 1582, 1606, 1606, 1632, 
-1621, 1796, 1801, 1799, 1787, 1796, 1799, 1791, 
-1796, 1787, 1779, 1791, 1787, 1788, 1797, 1792, 
-1788, 1792, 1784, 1801, 1797, 1788, 1788, 1799, 
-1801, 1582, 1559, 1570, 1595, 1582, 1570, 1582, 
-1595, 1606, 1774, 1776, 1779, 1787, 1783, 1779, 
-1783, 1774, 1779, 1813, 1814, 1809, 1809, 1804, 
-1813, 1808, 1809, 1814, 1802, 1808, 1792, 2229, 
-2231, 2233, 2229, 2227, 2231, 2225, 2224, 2227, 
-2227, 2229, 2225, 2232, 2228, 2230, 2225, 2229, 
-2230, 1774, 1783, 1780, 1777, 1774, 1780, 1784, 
-1777, 1780, 1788, 1784, 1780, 1792, 1797, 1802, 
-1809, 1808, 1802, 1800, 1809, 1802, 1804, 1809, 
-1800, 1791, 1804, 1800, 1796, 1791, 1800, 2235, 
-2236, 2237, 2237, 2239, 2235, 2241, 2242, 2243, 
-2243, 2244, 2241, 2246, 2247, 2248, 2248, 2249, 
-2246, 2251, 2252, 2253, 2253, 2254, 2251, 2238, 
-2240, 2236, 2236, 2235, 2238, 1810, 1801, 1796, 
-1796, 1805, 1810, 1805, 1796, 1800, 1800, 1811, 
-1805, 1811, 1800, 1802, 1802, 1807, 1811, 1807, 
-1802, 1797, 1797, 1806, 1807, 1806, 1797, 1801, 
-1801, 1810, 1806, 2256, 2257, 2258, 2241, 2244, 
-2245, 2246, 2249, 2250, 2251, 2254, 2255, 2259, 
-2256, 2258, 2263, 2267, 2261, 2261, 2260, 2263, 
-2260, 2261, 2262, 2262, 2265, 2260, 2269, 2270, 
-2271, 2271, 2272, 2269, 2274, 2275, 2276, 2276, 
-2277, 2274, 2277, 2276, 2278, 2279, 2280, 2281, 
-1803, 1799, 1788, 1788, 1812, 1803, 2261, 2268, 
-2264, 2264, 2262, 2261, 2282, 2283, 2284, 1783, 
-1790, 1794, 1790, 1783, 1787, 1787, 1795, 1790, 
-1795, 1787, 1799, 1799, 1803, 1795, 2263, 2260, 
-2266, 2260, 2265, 2266, 2269, 2272, 2273, 2285, 
-2286, 2287, 2286, 2288, 2287, 2289, 2290, 2291, 
-2290, 2289, 2292, 2294, 2291, 2299, 2291, 2294, 
-2289, 2305, 2299, 2315, 2299, 2305, 2294, 2315, 
-2336, 2323, 2323, 2305, 2315, 2503, 2504, 2505, 
-2505, 2507, 2503, 2292, 2302, 2296, 2296, 2290, 
-2292, 2536, 2537, 2538, 2310, 2296, 2302, 2289, 
-2300, 2295, 2295, 2292, 2289, 2294, 2306, 2300, 
-2300, 2289, 2294, 2305, 2324, 2306, 2306, 2294, 
-2305, 2323, 2346, 2324, 2324, 2305, 2323, 2292, 
-2295, 2301, 2301, 2302, 2292, 2302, 2301, 2318, 
-2539, 2537, 2536, 2511, 2513, 2515, 2513, 2511, 
-2509, 2518, 2515, 2513, 2521, 2523, 2522, 2361, 
-2352, 2340, 2340, 2369, 2361, 2375, 2370, 2352, 
-2352, 2361, 2375, 2519, 2511, 2515, 2324, 2347, 
-2337, 2347, 2324, 2346, 2347, 2340, 2337, 2340, 
-2347, 2369, 2516, 2521, 2518, 2522, 2518, 2521, 
-2518, 2513, 2516, 2509, 2516, 2513, 2324, 2316, 
-2306, 2316, 2324, 2337, 2316, 2308, 2300, 2300, 
-2306, 2316, 2308, 2307, 2295, 2295, 2300, 2308, 
-2307, 2317, 2301, 2301, 2295, 2307, 2327, 2351, 
-2318, 2327, 2301, 2317, 2543, 2546, 2541, 2543, 
-2539, 2545, 2615, 2611, 2607, 2525, 2522, 2523, 
-2375, 2402, 2394, 2394, 2370, 2375, 2352, 2348, 
-2328, 2328, 2340, 2352, 2370, 2371, 2348, 2348, 
-2352, 2370, 2340, 2328, 2316, 2316, 2337, 2340, 
-2394, 2395, 2371, 2371, 2370, 2394, 2348, 2359, 
-2325, 2325, 2328, 2348, 2371, 2372, 2359, 2359, 
-2348, 2371, 2328, 2325, 2308, 2308, 2316, 2328, 
-2395, 2396, 2372, 2372, 2371, 2395, 2539, 2541, 
-2537, 2318, 2320, 2302, 2540, 2536, 2538, 2302, 
-2320, 2310, 2359, 2349, 2325, 2326, 2325, 2349, 
-2372, 2384, 2349, 2349, 2359, 2372, 2584, 2585, 
-2586, 2384, 2372, 2396, 2325, 2326, 2307, 2307, 
-2308, 2325, 2349, 2350, 2326, 2338, 2326, 2350, 
-2384, 2373, 2349, 2350, 2349, 2373, 2411, 2404, 
-2373, 2326, 2338, 2317, 2317, 2307, 2326, 2625, 
-2624, 2623, 2627, 2629, 2625, 2397, 2410, 2403, 
-2397, 2412, 2410, 2397, 2373, 2404, 2622, 2623, 
-2624, 2423, 2432, 2427, 2416, 2403, 2410, 2423, 
-2410, 2422, 2427, 2436, 2442, 2633, 2628, 2631, 
-2432, 2443, 2436, 2436, 2427, 2432, 2441, 2459, 
-2443, 2443, 2432, 2441, 2628, 2622, 2626, 2423, 
-2416, 2410, 2427, 2416, 2423, 2431, 2423, 2422, 
-2432, 2423, 2431, 2619, 2620, 2621, 2643, 2644, 
-2645, 2646, 2647, 2648, 2646, 2649, 2647, 2606, 
-2614, 2610, 2622, 2624, 2626, 2628, 2626, 2631, 
-2588, 2586, 2585, 2592, 2595, 2585, 2595, 2592, 
-2599, 2599, 2603, 2595, 2606, 2610, 2603, 2412, 
-2422, 2410, 2603, 2599, 2606, 2625, 2629, 2632, 
-2385, 2350, 2373, 2589, 2591, 2587, 2587, 2584, 
-2589, 2585, 2584, 2587, 2604, 2607, 2611, 2604, 
-2596, 2600, 2600, 2607, 2604, 2596, 2593, 2589, 
-2589, 2600, 2596, 2593, 2597, 2591, 2591, 2589, 
-2593, 2615, 2617, 2611, 2662, 2663, 2664, 2629, 
-2634, 2632, 2539, 2543, 2541, 2653, 2651, 2649, 
-2649, 2655, 2653, 2654, 2652, 2651, 2651, 2653, 
-2654, 2647, 2649, 2651, 2652, 2650, 2647, 2647, 
-2651, 2652, 2622, 2628, 2630, 2648, 2647, 2650, 
-2665, 2666, 2667, 2668, 2669, 2670, 2633, 2635, 
-2628, 2404, 2412, 2397, 2385, 2397, 2403, 2623, 
-2627, 2625, 2397, 2385, 2373, 2585, 2590, 2592, 
-2590, 2585, 2587, 2655, 2658, 2657, 2657, 2653, 
-2655, 2653, 2657, 2656, 2656, 2654, 2653, 2660, 
-2659, 2657, 2657, 2658, 2660, 2659, 2661, 2656, 
-2656, 2657, 2659, 2636, 2634, 2629, 2291, 2293, 
-2297, 2293, 2291, 2290, 2291, 2297, 2304, 2304, 
-2299, 2291, 2299, 2304, 2314, 2314, 2315, 2299, 
-2315, 2314, 2335, 2335, 2336, 2315, 2503, 2508, 
-2506, 2506, 2504, 2503, 2296, 2309, 2298, 2298, 
-2290, 2296, 2310, 2329, 2309, 2309, 2296, 2310, 
-2538, 2544, 2542, 2542, 2540, 2538, 2321, 2342, 
-2330, 2312, 2304, 2297, 2304, 2312, 2322, 2322, 
-2314, 2304, 2314, 2322, 2334, 2334, 2335, 2314, 
-2508, 2512, 2510, 2510, 2506, 2508, 2547, 2542, 
-2544, 2321, 2311, 2303, 2311, 2330, 2312, 2330, 
-2311, 2321, 2303, 2297, 2293, 2297, 2311, 2312, 
-2311, 2297, 2303, 2290, 2298, 2293, 2303, 2293, 
-2298, 2321, 2313, 2333, 2313, 2321, 2303, 2333, 
-2332, 2357, 2332, 2333, 2313, 2333, 2358, 2342, 
-2342, 2321, 2333, 2357, 2383, 2358, 2358, 2333, 
-2357, 2298, 2313, 2303, 2313, 2298, 2319, 2319, 
-2332, 2313, 2676, 2677, 2678, 2680, 2681, 2676, 
-2676, 2678, 2680, 2547, 2544, 2551, 2550, 2542, 
-2547, 2298, 2309, 2319, 2547, 2554, 2550, 2702, 
-2703, 2704, 2332, 2345, 2355, 2355, 2357, 2332, 
-2357, 2355, 2381, 2381, 2383, 2357, 2680, 2683, 
-2682, 2682, 2681, 2680, 2319, 2356, 2345, 2345, 
-2332, 2319, 2684, 2682, 2683, 2711, 2712, 2713, 
-2713, 2715, 2711, 2704, 2706, 2705, 2705, 2702, 
-2704, 2345, 2368, 2367, 2367, 2355, 2345, 2691, 
-2689, 2686, 2392, 2381, 2355, 2356, 2382, 2368, 
-2368, 2345, 2356, 2683, 2686, 2685, 2685, 2684, 
-2683, 2712, 2716, 2714, 2714, 2713, 2712, 2706, 
-2708, 2707, 2707, 2705, 2706, 2368, 2393, 2391, 
-2391, 2367, 2368, 2689, 2692, 2688, 2688, 2686, 
-2689, 2382, 2401, 2393, 2393, 2368, 2382, 2686, 
-2688, 2687, 2687, 2685, 2686, 2716, 2718, 2717, 
-2717, 2714, 2716, 2708, 2710, 2709, 2709, 2707, 
-2708, 2393, 2409, 2408, 2408, 2391, 2393, 2692, 
-2695, 2693, 2693, 2688, 2692, 2401, 2415, 2409, 
-2409, 2393, 2401, 2688, 2693, 2690, 2690, 2687, 
-2688, 2695, 2697, 2694, 2694, 2693, 2695, 2698, 
-2694, 2697, 2698, 2700, 2699, 2409, 2426, 2420, 
-2420, 2408, 2409, 2724, 2725, 2726, 2421, 2409, 
-2415, 2430, 2420, 2426, 2725, 2727, 2726, 2426, 
-2440, 2435, 2435, 2430, 2426, 2694, 2696, 2690, 
-2690, 2693, 2694, 2696, 2694, 2698, 2699, 2701, 
-2696, 2696, 2698, 2699, 2719, 2717, 2718, 2718, 
-2720, 2719, 2721, 2719, 2720, 2731, 2732, 2733, 
-2725, 2728, 2727, 2448, 2458, 2440, 2440, 2426, 
-2448, 2720, 2723, 2722, 2722, 2721, 2720, 2728, 
-2730, 2729, 2729, 2727, 2728, 2734, 2735, 2736, 
-2736, 2738, 2734, 2735, 2739, 2737, 2737, 2736, 
-2735, 2507, 2505, 2509, 2509, 2511, 2507, 2616, 
-2614, 2619, 2614, 2616, 2610, 2432, 2431, 2441, 
-2620, 2619, 2614, 3053, 3054, 3055, 2449, 2442, 
-2436, 2468, 2449, 2450, 2639, 2641, 2640, 2443, 
-2460, 2450, 2450, 2436, 2443, 2740, 2741, 2742, 
-2467, 2443, 2459, 2468, 2450, 2460, 2741, 2743, 
-2742, 2460, 2479, 2475, 2475, 2468, 2460, 2637, 
-2638, 2635, 2635, 2633, 2637, 2638, 2637, 2639, 
-2640, 2642, 2638, 2638, 2639, 2640, 2671, 2670, 
-2669, 2669, 2672, 2671, 2673, 2671, 2672, 2747, 
-2748, 2749, 2741, 2744, 2743, 2485, 2491, 2479, 
-2479, 2460, 2485, 2672, 2675, 2674, 2674, 2673, 
-2672, 2744, 2746, 2745, 2745, 2743, 2744, 2750, 
-2751, 2752, 2752, 2754, 2750, 2751, 2755, 2753, 
-2753, 2752, 2751, 2312, 2344, 2331, 2331, 2322, 
-2312, 2322, 2331, 2343, 2343, 2334, 2322, 2512, 
-2517, 2514, 2514, 2510, 2512, 2379, 2389, 2366, 
-2331, 2366, 2354, 2354, 2343, 2331, 2343, 2354, 
-2365, 2520, 2514, 2517, 2389, 2406, 2390, 2390, 
-2366, 2389, 2366, 2390, 2380, 2380, 2354, 2366, 
-2756, 2757, 2758, 2378, 2365, 2354, 2406, 2413, 
-2400, 2400, 2390, 2406, 2390, 2400, 2380, 2407, 
-2380, 2400, 2757, 2760, 2759, 2759, 2758, 2757, 
-2805, 2806, 2807, 2366, 2331, 2379, 2379, 2364, 
-2399, 2399, 2389, 2379, 2389, 2399, 2405, 2405, 
-2406, 2389, 2406, 2405, 2417, 2417, 2413, 2406, 
-2814, 2815, 2813, 2387, 2399, 2364, 2399, 2387, 
-2405, 2809, 2810, 2811, 2810, 2809, 2812, 2818, 
-2819, 2820, 2362, 2387, 2364, 2811, 2813, 2809, 
-2813, 2811, 2814, 2312, 2330, 2341, 2341, 2344, 
-2312, 2344, 2341, 2364, 2808, 2805, 2807, 2330, 
-2363, 2353, 2353, 2341, 2330, 2341, 2353, 2362, 
-2362, 2364, 2341, 2814, 2817, 2816, 2816, 2815, 
-2814, 2363, 2388, 2377, 2377, 2353, 2363, 2353, 
-2377, 2376, 2376, 2362, 2353, 2562, 2555, 2558, 
-2558, 2567, 2562, 2555, 2551, 2544, 2544, 2558, 
-2555, 2834, 2835, 2836, 2838, 2837, 2836, 2834, 
-2836, 2837, 2398, 2376, 2377, 2763, 2767, 2765, 
-2761, 2759, 2760, 2767, 2769, 2768, 2768, 2765, 
-2767, 2769, 2773, 2771, 2771, 2768, 2769, 2773, 
-2777, 2775, 2775, 2771, 2773, 2777, 2781, 2775, 
-2781, 2788, 2784, 2784, 2775, 2781, 2788, 2796, 
-2792, 2792, 2784, 2788, 2796, 2798, 2797, 2797, 
-2792, 2796, 2798, 2800, 2799, 2799, 2797, 2798, 
-2800, 2802, 2801, 2801, 2799, 2800, 2839, 2840, 
-2841, 2841, 2844, 2839, 2840, 2846, 2843, 2843, 
-2841, 2840, 2483, 2462, 2477, 2477, 2490, 2483, 
-2462, 2454, 2470, 2470, 2477, 2462, 2850, 2851, 
-2852, 2462, 2483, 2489, 2471, 2445, 2462, 2445, 
-2438, 2454, 2454, 2462, 2445, 2777, 2780, 2783, 
-2783, 2781, 2777, 2447, 2425, 2439, 2439, 2457, 
-2447, 2780, 2777, 2773, 2425, 2429, 2434, 2434, 
-2439, 2425, 2429, 2438, 2434, 2445, 2434, 2438, 
-2413, 2424, 2418, 2418, 2400, 2413, 2400, 2418, 
-2414, 2414, 2407, 2400, 2417, 2428, 2424, 2424, 
-2413, 2417, 2818, 2822, 2821, 2821, 2819, 2818, 
-2433, 2438, 2429, 2429, 2418, 2424, 2425, 2414, 
-2418, 2428, 2437, 2433, 2822, 2824, 2823, 2823, 
-2821, 2822, 2452, 2451, 2469, 2469, 2470, 2452, 
-2437, 2444, 2451, 2452, 2454, 2438, 2826, 2825, 
-2827, 2827, 2828, 2826, 2823, 2824, 2825, 2825, 
-2826, 2823, 2429, 2425, 2418, 2433, 2429, 2424, 
-2433, 2424, 2428, 2433, 2437, 2438, 2452, 2437, 
-2451, 2438, 2437, 2452, 2454, 2452, 2470, 2437, 
-2428, 2444, 2677, 2676, 2679, 2484, 2481, 2487, 
-2487, 2478, 2484, 2478, 2464, 2474, 2474, 2484, 
-2478, 2464, 2439, 2455, 2455, 2474, 2464, 2481, 
-2476, 2471, 2471, 2487, 2481, 2476, 2472, 2461, 
-2461, 2471, 2476, 2472, 2463, 2453, 2453, 2461, 
-2472, 2463, 2455, 2446, 2446, 2453, 2463, 2439, 
-2446, 2455, 2795, 2796, 2788, 2788, 2791, 2795, 
-2791, 2788, 2781, 2781, 2787, 2791, 2464, 2457, 
-2439, 2850, 2853, 2851, 2461, 2445, 2471, 2445, 
-2461, 2453, 2453, 2434, 2445, 2434, 2453, 2446, 
-2434, 2446, 2439, 2787, 2781, 2783, 2800, 2804, 
-2803, 2803, 2802, 2800, 2496, 2498, 2500, 2840, 
-2839, 2842, 2470, 2486, 2482, 2482, 2477, 2470, 
-2470, 2469, 2480, 2480, 2486, 2470, 2847, 2849, 
-2848, 2494, 2482, 2486, 2486, 2499, 2497, 2490, 
-2477, 2488, 2477, 2482, 2488, 2497, 2494, 2486, 
-2847, 2846, 2840, 2848, 2846, 2847, 2827, 2831, 
-2829, 2829, 2828, 2827, 2831, 2833, 2832, 2832, 
-2829, 2831, 2829, 2830, 2828, 2492, 2486, 2480, 
-2480, 2495, 2492, 2854, 2855, 2856, 2859, 2860, 
-2861, 2854, 2857, 2858, 2854, 2856, 2857, 2865, 
-2866, 2867, 2867, 2868, 2865, 2868, 2867, 2869, 
-2860, 2859, 2862, 2863, 2861, 2860, 2860, 2864, 
-2863, 2769, 2770, 2772, 2772, 2773, 2769, 2870, 
-2871, 2872, 2456, 2447, 2465, 2984, 2981, 2982, 
-2769, 2767, 2770, 2984, 2983, 2981, 2978, 2981, 
-2983, 2762, 2761, 2760, 2761, 2763, 2765, 2762, 
-2766, 2764, 2764, 2763, 2762, 2873, 2874, 2875, 
-2886, 2887, 2888, 2874, 2878, 2876, 2876, 2875, 
-2874, 2878, 2883, 2881, 2881, 2876, 2878, 2889, 
-2890, 2891, 2893, 2894, 2889, 2889, 2891, 2893, 
-2893, 2895, 2894, 2895, 2893, 2896, 2896, 2897, 
-2895, 2897, 2898, 2899, 2885, 2881, 2883, 2898, 
-2897, 2896, 2875, 2877, 2879, 2879, 2882, 2875, 
-2876, 2880, 2877, 2877, 2875, 2876, 2881, 2884, 
-2880, 2880, 2876, 2881, 2901, 2900, 2903, 2903, 
-2906, 2901, 2908, 2913, 2912, 2913, 2908, 2911, 
-2884, 2881, 2885, 2906, 2903, 2908, 2908, 2912, 
-2906, 2907, 2909, 2904, 2904, 2902, 2907, 2902, 
-2904, 2900, 2900, 2901, 2902, 2909, 2910, 2904, 
-2905, 2904, 2910, 2904, 2905, 2900, 2903, 2900, 
-2905, 2910, 2915, 2911, 2911, 2905, 2910, 2905, 
-2911, 2908, 2908, 2903, 2905, 2914, 2910, 2909, 
-2914, 2915, 2910, 2918, 2919, 2920, 2914, 2909, 
-2916, 2916, 2917, 2914, 2419, 2407, 2414, 2890, 
-2889, 2892, 2762, 2763, 2761, 2447, 2456, 2425, 
-2466, 2425, 2456, 2493, 2496, 2488, 2493, 2498, 
-2496, 2845, 2840, 2842, 2493, 2497, 2501, 2493, 
-2482, 2494, 2493, 2488, 2482, 2493, 2494, 2497, 
-2493, 2501, 2502, 2473, 2481, 2484, 2473, 2484, 
-2474, 2473, 2474, 2455, 2473, 2476, 2481, 2473, 
-2472, 2476, 2473, 2463, 2472, 2473, 2455, 2463, 
-2921, 2922, 2923, 2524, 2523, 2521, 2922, 2921, 
-2924, 2927, 2928, 2925, 2925, 2926, 2927, 2524, 
-2526, 2523, 2527, 2523, 2526, 2928, 2930, 2929, 
-2929, 2925, 2928, 2526, 2529, 2528, 2528, 2527, 
-2526, 2930, 2932, 2931, 2931, 2929, 2930, 2529, 
-2531, 2530, 2530, 2528, 2529, 2932, 2934, 2933, 
-2933, 2931, 2932, 2531, 2533, 2532, 2532, 2530, 
-2531, 2934, 2936, 2935, 2935, 2933, 2934, 2533, 
-2535, 2534, 2534, 2532, 2533, 2938, 2939, 2940, 
-2937, 2935, 2936, 2941, 2939, 2938, 2938, 2942, 
-2941, 2770, 2776, 2774, 2774, 2772, 2770, 2948, 
-2943, 2947, 2947, 2949, 2948, 2943, 2944, 2945, 
-2945, 2947, 2943, 2790, 2786, 2794, 2945, 2944, 
-2946, 2950, 2951, 2952, 2952, 2953, 2950, 2954, 
-2955, 2956, 2956, 2958, 2954, 2955, 2960, 2957, 
-2957, 2956, 2955, 2963, 2957, 2960, 2963, 2960, 
-2965, 2967, 2963, 2965, 2957, 2962, 2959, 2959, 
-2956, 2957, 2956, 2959, 2961, 2961, 2958, 2956, 
-2963, 2967, 2966, 2966, 2964, 2963, 2968, 2966, 
-2967, 2972, 2974, 2970, 2970, 2969, 2972, 2969, 
-2970, 2971, 2971, 2973, 2969, 2980, 2981, 2978, 
-2978, 2979, 2980, 2975, 2973, 2971, 2971, 2976, 
-2975, 2786, 2790, 2779, 2779, 2782, 2786, 2778, 
-2785, 2782, 2782, 2776, 2778, 2982, 2981, 2980, 
-2778, 2776, 2770, 2789, 2793, 2786, 2794, 2786, 
-2793, 2977, 2975, 2976, 2968, 2967, 2965, 2776, 
-2782, 2779, 2779, 2774, 2776, 2964, 2962, 2957, 
-2957, 2963, 2964, 2782, 2785, 2789, 2789, 2786, 
-2782, 2594, 2591, 2597, 2597, 2602, 2594, 2601, 
-2594, 2602, 2602, 2608, 2601, 2605, 2601, 2608, 
-2608, 2612, 2605, 2613, 2605, 2612, 2612, 2618, 
-2613, 2594, 2587, 2591, 2594, 2598, 2587, 2598, 
-2594, 2601, 2985, 2986, 2987, 2601, 2605, 2598, 
-2986, 2988, 2990, 2609, 2598, 2605, 2605, 2613, 
-2609, 2988, 2986, 2985, 2994, 2995, 2991, 2991, 
-2990, 2994, 2360, 2339, 2374, 2374, 2386, 2360, 
-2570, 2569, 2566, 2570, 2566, 2557, 2557, 2566, 
-2561, 2557, 2561, 2549, 2559, 2563, 2556, 2553, 
-2559, 2556, 2556, 2563, 2569, 2569, 2570, 2556, 
-2327, 2317, 2339, 2327, 2339, 2351, 2360, 2351, 
-2339, 2549, 2546, 2543, 2549, 2552, 2557, 2549, 
-2543, 2552, 2579, 2581, 2583, 2583, 2576, 2579, 
-2581, 2579, 2573, 2559, 2573, 2568, 2995, 2993, 
-2991, 2993, 2989, 2991, 2989, 2987, 2986, 2986, 
-2991, 2989, 2990, 2988, 2992, 2990, 2991, 2986, 
-2548, 2552, 2543, 2548, 2543, 2545, 2548, 2545, 
-2553, 2548, 2553, 2556, 2568, 2563, 2559, 2568, 
-2573, 2579, 2568, 2579, 2571, 2571, 2579, 2576, 
-2571, 2576, 2561, 2571, 2561, 2566, 2996, 2997, 
-2998, 2998, 3000, 2996, 3002, 3003, 3004, 3004, 
-3005, 3002, 3007, 3008, 3009, 3009, 3010, 3007, 
-3012, 3013, 3014, 3014, 3015, 3012, 2997, 3001, 
-2999, 2999, 2998, 2997, 2566, 2569, 2580, 2580, 
-2577, 2566, 2571, 2566, 2577, 2577, 2578, 2571, 
-2568, 2571, 2578, 2578, 2572, 2568, 2563, 2568, 
-2572, 2572, 2574, 2563, 2569, 2563, 2574, 2574, 
-2580, 2569, 3017, 3018, 3019, 3006, 3005, 3004, 
-3011, 3010, 3009, 3016, 3015, 3014, 3017, 3019, 
-3020, 3022, 3029, 3025, 3025, 3023, 3022, 3021, 
-3022, 3023, 3023, 3026, 3021, 3030, 3031, 3032, 
-3032, 3033, 3030, 3035, 3036, 3037, 3037, 3038, 
-3035, 3039, 3035, 3038, 3040, 3041, 3042, 2556, 
-2570, 2575, 2575, 2582, 2556, 3024, 3027, 3022, 
-3022, 3021, 3024, 3043, 3044, 3045, 2564, 2560, 
-2552, 2557, 2552, 2560, 2560, 2565, 2557, 2570, 
-2557, 2565, 2565, 2575, 2570, 3028, 3023, 3025, 
-3028, 3026, 3023, 3034, 3033, 3032, 3046, 3047, 
-3048, 3046, 3049, 3047};
-
-
-
-Vec3f vertices[1732] = {
-{1.79489, 4.83536, 0.48091}, {2.66195, 4.94608, -1.13939}, {2.18866, 5.86984, 0.516773}, 
-{2.71731, 6.01616, -1.11639}, {2.0877, 7.083, 0.479657}, {2.3704, 7.22128, -1.37961}, 
-{1.53785, 8.1498, 0.335179}, {1.70898, 8.1852, -1.52386}, {0.682862, 9.17272, -1.61379}, 
-{0.810986, 9.01916, 0.103545}, {-0.001599, 9.47092, -1.5801}, {-0.001599, 9.48256, 0.117406}, 
-{1.28091, 4.12776, 0.450461}, {1.91407, 3.85584, -1.30399}, {-0.001599, 3.66499, 0.458912}, 
-{-0.001599, 3.18927, -1.45}, {2.87633, 4.8796, -3.07589}, {2.97704, 5.809, -3.03396}, 
-{2.56574, 7.16064, -3.15259}, {1.94225, 8.13888, -3.29374}, {0.90307, 9.47034, -3.45594}, 
-{-0.001599, 9.56328, -3.25619}, {2.38298, 3.91519, -2.98284}, {1.35189, 3.28409, -2.89053}, 
-{1.41668, 9.29775, -5.00654}, {-0.001599, 9.65968, -4.92815}, {1.06284, 9.55975, -5.96414}, 
-{-0.001599, 9.77216, -5.8895}, {0.97489, 9.45692, -7.16338}, {0.214051, 9.62156, -7.13774}, 
-{2.06171, 8.28696, -5.22502}, {1.95476, 8.63824, -5.9107}, {1.50244, 8.93868, -6.95658}, 
-{1.72883, 9.17692, -3.9663}, {2.07996, 8.32408, -4.23346}, {0.760434, 9.57441, -4.9455}, 
-{2.18955, 7.21064, -4.34358}, {2.40495, 6.47972, -4.5221}, {2.2495, 5.48552, -4.76234}, 
-{1.69686, 4.8084, -4.7619}, {1.12933, 3.70331, -4.00058}, {-0.001599, 3.39507, -4.01534}, 
-{0.760939, 8.99912, -7.63131}, {-0.001599, 9.23784, -7.61843}, {1.00825, 8.51292, -7.55579}, 
-{2.18013, 7.37804, -5.1549}, {2.11291, 7.32866, -6.03711}, {1.73811, 7.17185, -6.97621}, 
-{0.921483, 7.09284, -7.47198}, {2.48617, 6.44612, -4.81722}, {2.3239, 6.54836, -5.91438}, 
-{1.9603, 6.37976, -6.74874}, {1.28688, 6.19092, -7.27426}, {-0.001599, 3.19378, -2.86215}, 
-{0.978707, 3.19543, -1.34248}, {0.73649, 3.76932, 0.433324}, {2.23255, 5.19668, -5.19026}, 
-{2.36673, 5.51132, -5.78998}, {2.03854, 5.2964, -6.63598}, {1.39654, 5.20337, -6.97156}, 
-{1.72485, 4.44348, -5.2437}, {2.05458, 4.27716, -5.7023}, {2.04022, 4.18312, -6.4357}, 
-{1.61059, 4.33704, -6.95558}, {1.36598, 2.924, -6.29895}, {1.76816, 3.05544, -6.3566}, 
-{1.95043, 3.19489, -6.87499}, {1.6148, 3.34463, -7.33114}, {1.71223, 1.53773, -6.4941}, 
-{1.89624, 1.54982, -6.51695}, {1.90698, 1.49676, -6.81274}, {1.70064, 1.39332, -7.0651}, 
-{1.85589, 1.13052, -6.26999}, {2.02578, 1.10124, -6.44516}, {2.08036, 1.00058, -6.73899}, 
-{1.80099, 0.905667, -7.10327}, {1.54588, 2.36794, -6.49025}, {1.75134, 2.40168, -6.51951}, 
-{1.84277, 2.3486, -6.96314}, {1.52349, 0.906661, -6.99755}, {1.49345, 1.46587, -6.8259}, 
-{1.4436, 2.29521, -6.88214}, {1.34111, 3.30601, -7.34526}, {1.16131, 4.36396, -6.85246}, 
-{1.56217, 3.89597, -7.07058}, {1.18311, 3.82301, -7.01797}, {1.31839, 3.38382, -5.99754}, 
-{0.960131, 6.27508, -7.29634}, {0.593519, 6.75048, -7.4103}, {-0.001599, 8.91284, -7.71778}, 
-{-0.001599, 8.18572, -7.5635}, {-0.001599, 7.23668, -7.4263}, {-0.001599, 6.8002, -7.4401}, 
-{-0.001599, 9.5328, -7.15882}, {1.42048, 3.98379, -5.5191}, {1.50351, 4.16464, -4.30942}, 
-{1.12262, 3.56639, -6.5844}, {0.596276, 3.45543, -3.98158}, {1.26539, 3.03939, -6.80981}, 
-{1.52229, 1.00251, -6.51932}, {1.93274, 3.6359, -6.67895}, {1.85841, 3.44039, -6.15044}, 
-{1.13156, 5.20337, -6.90259}, {0.879353, 4.10727, -6.24376}, {0.891677, 4.65605, -5.87689}, 
-{1.24802, 4.46058, -5.32084}, {2.27339, 5.68996, 1.78333}, {1.76286, 4.77524, 0.959476}, 
-{2.27338, 7.15396, 1.73876}, {1.82067, 8.06748, 1.59626}, {1.02995, 9.02872, 1.47709}, 
-{-0.001599, 9.56192, 1.39195}, {1.19346, 4.0668, 0.925357}, {0.76289, 3.71054, 0.980685}, 
-{-0.001599, 3.66877, 1.61838}, {1.8359, 5.36928, 3.0282}, {1.77348, 4.95268, 2.78309}, 
-{1.99287, 6.85472, 3.22342}, {1.6106, 7.792, 3.05421}, {0.572974, 9.37256, 2.52025}, 
-{-0.001599, 9.55274, 2.44165}, {1.07735, 3.61148, 2.28503}, {2.21787, 5.78328, 2.54203}, 
-{2.09762, 5.2452, 2.45709}, {2.19514, 5.22356, 1.71539}, {1.94731, 5.32572, 1.15383}, 
-{2.12957, 4.71108, 1.70665}, {2.08381, 4.771, 2.45258}, {2.11265, 4.18712, 1.57372}, 
-{2.08492, 4.24744, 2.29127}, {1.81917, 4.72496, 2.74158}, {1.75772, 4.236, 2.5991}, 
-{1.80391, 4.11864, 1.34638}, {1.51811, 4.6626, 2.75438}, {1.28965, 4.25377, 2.62866}, 
-{1.13695, 3.59968, 1.38602}, {1.67789, 3.25309, 1.3885}, {1.80682, 3.54698, 2.23892}, 
-{1.85357, 3.38666, 1.59151}, {1.51129, 3.42284, 2.43358}, {1.11139, 3.83971, 2.49034}, 
-{1.12763, 2.73589, 1.72378}, {1.04428, 2.87968, 2.26118}, {1.57019, 2.68021, 1.57848}, 
-{1.78011, 2.72026, 2.2386}, {1.76349, 2.7082, 1.75016}, {1.43749, 2.738, 2.41322}, 
-{1.29726, 1.8778, 1.84057}, {1.23558, 1.89112, 2.15578}, {1.51676, 1.86199, 1.73262}, 
-{1.63716, 1.92647, 2.17241}, {1.63855, 1.87635, 1.8991}, {1.43106, 1.96338, 2.29103}, 
-{1.23528, 0.906661, 1.85165}, {1.23408, 1.00251, 2.32989}, {1.51278, 0.905666, 1.74594}, 
-{1.79436, 1.10124, 2.45058}, {1.79216, 1.00058, 2.11022}, {1.52445, 1.13052, 2.57922}, 
-{1.70294, 0.826082, 2.81458}, {1.96198, 0.796801, 2.68545}, {1.80684, 0.644565, 2.74944}, 
-{1.77525, 0.035412, 3.13496}, {2.12346, 0.006131, 2.92941}, {1.99045, 0.613355, 2.21124}, 
-{1.43918, 0.775415, 2.01341}, {1.6495, 0.57833, 1.96778}, {2.0997, -0.008211, 2.24152}, 
-{1.19555, 0.673136, 2.55315}, {1.21482, 0.035412, 2.82684}, {1.25022, 0.592586, 2.1201}, 
-{1.6495, 0.273, 1.96778}, {1.25823, 0.297792, 2.14015}, {1.47734, 2.26994, -7.09658}, 
-{1.60248, 2.28089, -7.13591}, {1.95225, 0.826083, -5.99094}, {2.19895, 0.796801, -6.16376}, 
-{2.09505, 0.644565, -6.09977}, {2.06346, 0.035413, -5.71424}, {2.41167, 0.006131, -5.9198}, 
-{2.27866, 0.613355, -6.63797}, {1.72738, 0.775415, -6.8358}, {1.93771, 0.57833, -6.88143}, 
-{2.38791, -0.008211, -6.60769}, {1.48376, 0.673137, -6.29605}, {1.50302, 0.035413, -6.02237}, 
-{1.53843, 0.592586, -6.7291}, {1.93771, 0.273, -6.88143}, {1.54644, 0.297792, -6.70906}, 
-{1.14036, 7.89165, 3.42466}, {1.78531, 6.77652, 3.57773}, {0.598846, 9.31412, 3.06758}, 
-{-0.001599, 9.6004, 2.94879}, {0.812134, 8.44079, 4.39824}, {0.877354, 7.31364, 4.60814}, 
-{0.521022, 9.5398, 4.21614}, {-0.001599, 9.90892, 4.08744}, {0.840666, 8.99392, 5.26106}, 
-{0.859028, 7.91712, 5.47484}, {0.556538, 9.90112, 4.95854}, {-0.001599, 10.239, 4.91546}, 
-{0.886882, 9.12882, 5.60397}, {0.900361, 8.12086, 5.83848}, {0.566358, 10.3039, 5.45014}, 
-{-0.001598, 10.6002, 5.42951}, {1.2632, 6.79948, 3.74415}, {0.623326, 6.543, 4.78114}, 
-{1.01569, 6.00548, 3.96736}, {0.546802, 7.40152, 5.63286}, {0.525718, 7.62747, 6.05089}, 
-{-0.001599, 6.16316, 4.97026}, {-0.001599, 5.1718, 4.32154}, {-0.001598, 7.13888, 5.75174}, 
-{-0.001598, 7.52242, 6.09251}, {0.327508, 6.19808, 5.02126}, {0.463294, 5.19456, 4.30282}, 
-{1.44143, 5.764, 3.56765}, {0.979162, 4.772, 3.53009}, {-0.001599, 4.08628, 3.93028}, 
-{0.622702, 3.93164, 3.80353}, {1.00902, 3.99227, 3.28603}, {-0.001599, 3.53475, 3.29197}, 
-{0.684346, 3.54142, 3.0493}, {-0.001598, 10.9607, 5.99188}, {0.436458, 10.9363, 6.02215}, 
-{-0.001598, 10.9994, 6.20921}, {0.383177, 10.9776, 6.20419}, {-0.001598, 10.8622, 6.67874}, 
-{0.383576, 10.8443, 6.67077}, {-0.001598, 10.6015, 6.99281}, {0.349385, 10.5763, 6.98256}, 
-{0.640087, 10.394, 7.33284}, {-0.001598, 10.2259, 7.63402}, {0.393092, 10.2016, 7.61096}, 
-{-0.001598, 9.88032, 7.89185}, {0.369166, 9.82023, 7.86285}, {-0.001598, 9.44728, 8.38395}, 
-{0.237431, 9.41185, 8.36297}, {-0.001598, 9.07548, 8.83878}, {0.192069, 9.02802, 8.82746}, 
-{-0.001598, 8.82704, 9.32115}, {0.192192, 8.7929, 9.29742}, {-0.001598, 8.6119, 9.42564}, 
-{0.186005, 8.60411, 9.38671}, {-0.001598, 8.20959, 9.26141}, {0.224352, 8.21089, 9.23774}, 
-{0.548038, 8.75791, 8.65431}, {0.586636, 8.89746, 8.21772}, {0.670611, 8.2974, 8.5272}, 
-{0.677083, 8.43168, 8.04699}, {0.817105, 9.58975, 7.73293}, {1.0205, 9.36624, 7.39809}, 
-{1.17231, 8.75872, 7.21522}, {0.931225, 10.2929, 7.18446}, {0.8041, 10.4372, 6.82855}, 
-{1.08101, 10.0182, 7.10779}, {0.947858, 10.0439, 6.41498}, {1.06266, 9.64246, 7.03446}, 
-{1.15099, 9.26662, 6.26714}, {0.938519, 9.15995, 5.85129}, {0.963411, 8.26122, 6.07032}, 
-{0.913034, 9.84336, 5.81055}, {0.525718, 7.74892, 6.47414}, {-0.001598, 7.65964, 6.5197}, 
-{0.550094, 7.76154, 7.11438}, {-0.001598, 7.69903, 7.12101}, {0.465103, 8.0121, 8.48994}, 
-{0.491695, 7.98791, 7.99319}, {-0.001598, 7.89506, 8.4512}, {-0.001598, 7.91291, 8.02541}, 
-{1.19119, 8.4106, 6.53926}, {0.982635, 8.13918, 7.1751}, {0.667284, 8.20598, 8.00771}, 
-{0.935055, 10.1216, 7.6108}, {1.03685, 9.97784, 7.55066}, {0.802012, 9.87556, 7.76747}, 
-{0.935055, 9.87881, 7.64498}, {1.1177, 9.9708, 7.39396}, {1.1177, 10.1595, 7.31501}, 
-{1.1177, 9.85067, 7.3258}, {0.935055, 9.75763, 7.63862}, {1.03685, 9.5384, 7.52642}, 
-{1.03685, 9.68391, 7.5183}, {1.1177, 9.58974, 7.28065}, {1.1177, 9.73943, 7.36502}, 
-{1.1177, 9.76065, 7.14847}, {0.457806, 8.7256, 9.1349}, {0.376929, 8.58792, 9.28214}, 
-{0.498554, 8.77832, 9.02162}, {0.619908, 8.18411, 8.88694}, {0.605815, 8.08587, 8.78926}, 
-{0.414238, 8.20184, 9.16806}, {0.44497, 8.38412, 9.24806}, {0.566318, 8.57448, 9.00342}, 
-{0.534862, 8.42572, 9.1171}, {0.326659, 8.45348, 9.33146}, {0.307187, 7.96801, 8.93809}, 
-{-0.001598, 7.90125, 8.96516}, {0.292569, 8.0642, 9.08853}, {-0.001598, 8.04586, 9.14675}, 
-{-0.001598, 8.18591, 8.97709}, {0.368969, 8.18382, 8.97296}, {0.279999, 8.16608, 9.0892}, 
-{-0.001598, 8.16023, 9.1524}, {0.854898, 10.8769, 6.59538}, {0.864122, 11.0406, 6.2727}, 
-{0.936942, 10.5447, 6.65742}, {0.954962, 10.888, 6.06038}, {1.08416, 10.5927, 6.21846}, 
-{0.514751, 10.7462, 5.83474}, {0.622536, 10.5344, 5.70483}, {0.90035, 10.3653, 5.70702}, 
-{1.21799, 10.4372, 6.28086}, {1.25005, 10.3017, 5.86014}, {1.54346, 10.5874, 6.41794}, 
-{1.78663, 10.3048, 5.85028}, {2.09148, 10.7467, 6.25761}, {2.35605, 10.4568, 5.90543}, 
-{1.61373, 9.6276, 6.20091}, {2.15672, 9.73114, 6.03557}, {2.55509, 10.2494, 5.93645}, 
-{2.43184, 10.6909, 6.04242}, {2.55791, 10.5414, 5.97733}, {1.0629, 10.5204, 6.44282}, 
-{1.34821, 10.321, 6.53942}, {1.62226, 10.4653, 6.53711}, {2.1279, 10.6342, 6.35692}, 
-{2.40694, 10.2835, 6.09731}, {2.11033, 9.88913, 6.14079}, {2.43419, 10.5232, 6.1358}, 
-{1.63713, 9.79897, 6.32802}, {1.37095, 9.95241, 6.31531}, {2.09644, 10.2185, 6.12348}, 
-{1.51294, 10.1521, 6.22239}, {-0.001598, 10.773, 5.81674}, {0.364494, 8.5269, 9.19068}, 
-{1.10834, 9.84035, 7.50483}, {-0.001599, 9.98883, -7.15035}, {-0.001599, 9.91467, -5.8968}, 
-{-0.001599, 9.57269, -8.23215}, {0.164085, 9.70072, -8.22475}, {-0.001599, 9.90878, -8.22368}, 
-{-0.001599, 9.5648, -9.4773}, {0.129928, 9.70072, -9.46841}, {-0.001599, 9.8762, -9.46883}, 
-{-0.001599, 9.5648, -10.5829}, {0.129928, 9.70073, -10.5783}, {-0.001599, 9.8762, -10.5745}, 
-{-0.001599, 9.50776, -11.628}, {0.214051, 9.70073, -11.6277}, {-0.001599, 9.99727, -11.6259}, 
-{-0.001599, 9.34465, -12.7793}, {0.454419, 9.85055, -12.779}, {-0.001599, 10.6109, -13.0516}, 
-{-0.001599, 9.69992, -13.5751}, {-0.001599, 10.5813, -14.0648}, {-0.001599, 10.4974, -13.4783}, 
-{1.26461, 11.1438, 6.50538}, {1.21744, 11.0243, 6.71594}, {1.41099, 11.1201, 6.90837}, 
-{1.32251, 10.7598, 6.71334}, {1.45723, 10.9323, 6.89456}, {1.47299, 11.0301, 7.21479}, 
-{1.43614, 11.1788, 7.17858}, {1.57384, 11.2638, 7.12249}, {1.36279, 11.279, 7.80922}, 
-{1.42002, 10.7038, 6.55074}, {1.59489, 10.8545, 6.80881}, {1.62553, 10.9111, 7.0612}, 
-{1.5645, 11.004, 7.30975}, {1.75342, 11.0572, 7.03524}, {1.43965, 10.8046, 6.33982}, 
-{1.6644, 11.1036, 7.41532}, {1.68417, 10.9932, 6.68858}, {1.41371, 11.0612, 6.2917}, 
-{1.66284, 11.166, 6.6948}, {1.70289, 11.2487, 7.06195}, {1.63735, 11.2336, 7.39055}, 
-{1.53901, 11.2196, 6.76024}, {1.33717, 5.05217, -6.96987}, {1.72485, 4.63363, -5.48745}, 
-{1.64787, 3.94669, -5.53653}, {1.15404, 3.82851, -6.86685}, {1.32652, 3.38032, -5.63882}, 
-{0.593535, 5.79516, -7.50486}, {-0.001599, 5.7848, -7.5419}, {0.579835, 5.14528, -7.61789}, 
-{-0.001599, 5.1383, -7.67239}, {0.585267, 4.37674, -7.54898}, {-0.001599, 4.33723, -7.60113}, 
-{0.623941, 3.71519, -7.16157}, {-0.001599, 3.67543, -7.27314}, {1.03731, 5.12232, -7.47126}, 
-{1.69686, 3.99775, -4.75446}, {1.29429, 3.42723, -4.83297}, {-0.001599, 3.07664, -4.88953}, 
-{-0.001599, 3.00853, -5.63806}, {0.680863, 3.25503, -6.59891}, {-0.001599, 3.1821, -6.60319}, 
-{1.61696, 5.17818, -5.46599}, {1.44345, 5.62538, -6.29192}, {0.505621, 3.14245, -4.88755}, 
-{0.645035, 3.23498, -4.53714}, {0.956281, 3.35532, -4.58266}, {1.06542, 3.30511, -4.88394}, 
-{0.815419, 3.19706, -5.09878}, {0.53977, 3.0858, -5.64033}, {0.839079, 3.16785, -5.46824}, 
-{1.09818, 3.27474, -5.68409}, {0.969207, 3.27824, -6.04438}, {0.605723, 3.14044, -6.01982}, 
-{0.88311, 2.65973, -5.64717}, {0.745849, 2.66309, -5.73458}, {0.782944, 2.67731, -5.87078}, 
-{0.922806, 2.68638, -5.88785}, {0.983444, 2.67724, -5.74072}, {0.851538, 3.07341, -5.6035}, 
-{0.683201, 3.0261, -5.69915}, {0.746879, 3.05201, -5.88662}, {0.901608, 3.12649, -5.92024}, 
-{0.976169, 3.13122, -5.70915}, {0.86766, 2.60032, -5.78787}, {0.856598, 2.6654, -4.91405}, 
-{0.966588, 2.69744, -4.82542}, {0.925028, 2.70159, -4.67958}, {0.755181, 2.66751, -4.68555}, 
-{0.72417, 2.64726, -4.83325}, {0.826444, 3.10703, -4.97976}, {0.967073, 3.14656, -4.85022}, 
-{0.89783, 3.17471, -4.66875}, {0.698337, 3.14813, -4.65568}, {0.640001, 3.07908, -4.84486}, 
-{0.867282, 2.60819, -4.78228}, {-1.79908, 4.83536, 0.48091}, {-2.66614, 4.94608, -1.13939}, 
-{-2.19285, 5.86984, 0.516773}, {-2.7215, 6.01616, -1.11639}, {-2.09189, 7.083, 0.479657}, 
-{-2.37458, 7.22128, -1.37961}, {-1.54204, 8.1498, 0.335179}, {-1.71317, 8.1852, -1.52386}, 
-{-0.68705, 9.17272, -1.61379}, {-0.815173, 9.01916, 0.103545}, {-0.002589, 9.47092, -1.5801}, 
-{-0.002589, 9.48256, 0.117406}, {-1.2851, 4.12776, 0.450461}, {-1.91826, 3.85584, -1.30399}, 
-{-0.002589, 3.66499, 0.458912}, {-0.002589, 3.18927, -1.45}, {-2.88052, 4.8796, -3.07589}, 
-{-2.98122, 5.809, -3.03396}, {-2.56993, 7.16064, -3.15259}, {-1.94644, 8.13888, -3.29374}, 
-{-0.907258, 9.47034, -3.45594}, {-0.002589, 9.56328, -3.25619}, {-2.38717, 3.91519, -2.98284}, 
-{-1.35607, 3.28409, -2.89053}, {-1.42087, 9.29775, -5.00654}, {-0.002588, 9.65968, -4.92815}, 
-{-1.06703, 9.55975, -5.96414}, {-0.002588, 9.77216, -5.8895}, {-0.979078, 9.45692, -7.16338}, 
-{-0.218239, 9.62156, -7.13774}, {-2.06589, 8.28696, -5.22502}, {-1.95895, 8.63824, -5.9107}, 
-{-1.50663, 8.93868, -6.95658}, {-1.73302, 9.17692, -3.9663}, {-2.08415, 8.32408, -4.23346}, 
-{-0.764622, 9.57441, -4.9455}, {-2.19373, 7.21064, -4.34358}, {-2.40913, 6.47972, -4.5221}, 
-{-2.25369, 5.48552, -4.76234}, {-1.70105, 4.8084, -4.7619}, {-1.13351, 3.70331, -4.00058}, 
-{-0.002588, 3.39507, -4.01534}, {-0.765126, 8.99912, -7.63131}, {-0.002588, 9.23784, -7.61843}, 
-{-1.01244, 8.51292, -7.55579}, {-2.18431, 7.37804, -5.1549}, {-2.1171, 7.32866, -6.03711}, 
-{-1.7423, 7.17185, -6.97621}, {-0.92567, 7.09284, -7.47198}, {-2.49036, 6.44612, -4.81722}, 
-{-2.32809, 6.54836, -5.91438}, {-1.96449, 6.37976, -6.74874}, {-1.29107, 6.19092, -7.27426}, 
-{-0.002589, 3.19378, -2.86215}, {-0.982894, 3.19543, -1.34248}, {-0.740678, 3.76932, 0.433324}, 
-{-2.23673, 5.19668, -5.19026}, {-2.37092, 5.51132, -5.78998}, {-2.04273, 5.2964, -6.63598}, 
-{-1.40073, 5.20337, -6.97156}, {-1.72903, 4.44348, -5.2437}, {-2.05877, 4.27716, -5.7023}, 
-{-2.04441, 4.18312, -6.4357}, {-1.61478, 4.33704, -6.95558}, {-1.37017, 2.924, -6.29895}, 
-{-1.77235, 3.05544, -6.3566}, {-1.95461, 3.19489, -6.87499}, {-1.61899, 3.34463, -7.33114}, 
-{-1.71642, 1.53773, -6.4941}, {-1.90043, 1.54982, -6.51695}, {-1.91117, 1.49676, -6.81274}, 
-{-1.70483, 1.39332, -7.0651}, {-1.86008, 1.13052, -6.26999}, {-2.02997, 1.10124, -6.44516}, 
-{-2.08455, 1.00058, -6.73899}, {-1.80518, 0.905667, -7.10327}, {-1.55007, 2.36794, -6.49025}, 
-{-1.75552, 2.40168, -6.51951}, {-1.84695, 2.3486, -6.96314}, {-1.52768, 0.906661, -6.99755}, 
-{-1.49764, 1.46587, -6.8259}, {-1.44779, 2.29521, -6.88214}, {-1.3453, 3.30601, -7.34526}, 
-{-1.1655, 4.36396, -6.85246}, {-1.56636, 3.89597, -7.07058}, {-1.1873, 3.82301, -7.01797}, 
-{-1.32258, 3.38382, -5.99754}, {-0.964318, 6.27508, -7.29634}, {-0.597706, 6.75048, -7.4103}, 
-{-0.002588, 8.91284, -7.71778}, {-0.002588, 8.18572, -7.5635}, {-0.002588, 7.23668, -7.4263}, 
-{-0.002588, 6.8002, -7.4401}, {-0.002588, 9.5328, -7.15882}, {-1.42467, 3.98379, -5.5191}, 
-{-1.5077, 4.16464, -4.30942}, {-1.12681, 3.56639, -6.5844}, {-0.600463, 3.45543, -3.98158}, 
-{-1.26957, 3.03939, -6.80981}, {-1.52647, 1.00251, -6.51932}, {-1.93693, 3.6359, -6.67895}, 
-{-1.86259, 3.44039, -6.15044}, {-1.13575, 5.20337, -6.90259}, {-0.883541, 4.10727, -6.24376}, 
-{-0.895865, 4.65605, -5.87689}, {-1.25221, 4.46058, -5.32084}, {-2.27758, 5.68996, 1.78333}, 
-{-1.76705, 4.77524, 0.959476}, {-2.27757, 7.15396, 1.73876}, {-1.82486, 8.06748, 1.59626}, 
-{-1.03414, 9.02872, 1.47709}, {-0.002589, 9.56192, 1.39195}, {-1.19765, 4.0668, 0.925357}, 
-{-0.767078, 3.71054, 0.980685}, {-0.002589, 3.66877, 1.61838}, {-1.84009, 5.36928, 3.0282}, 
-{-1.77767, 4.95268, 2.78309}, {-1.99705, 6.85472, 3.22342}, {-1.61478, 7.792, 3.05421}, 
-{-0.577161, 9.37256, 2.52025}, {-0.002589, 9.55274, 2.44165}, {-1.08154, 3.61148, 2.28503}, 
-{-2.22206, 5.78328, 2.54203}, {-2.10181, 5.2452, 2.45709}, {-2.19933, 5.22356, 1.71539}, 
-{-1.9515, 5.32572, 1.15383}, {-2.13375, 4.71108, 1.70665}, {-2.088, 4.771, 2.45258}, 
-{-2.11684, 4.18712, 1.57372}, {-2.08911, 4.24744, 2.29127}, {-1.82336, 4.72496, 2.74158}, 
-{-1.7619, 4.236, 2.5991}, {-1.8081, 4.11864, 1.34638}, {-1.5223, 4.6626, 2.75438}, 
-{-1.29383, 4.25377, 2.62866}, {-1.14114, 3.59968, 1.38602}, {-1.68208, 3.25309, 1.3885}, 
-{-1.81101, 3.54698, 2.23892}, {-1.85775, 3.38666, 1.59151}, {-1.51547, 3.42284, 2.43358}, 
-{-1.11558, 3.83971, 2.49034}, {-1.13182, 2.73589, 1.72378}, {-1.04846, 2.87968, 2.26118}, 
-{-1.57438, 2.68021, 1.57848}, {-1.7843, 2.72026, 2.2386}, {-1.76768, 2.7082, 1.75016}, 
-{-1.44168, 2.738, 2.41322}, {-1.30145, 1.8778, 1.84057}, {-1.23977, 1.89112, 2.15578}, 
-{-1.52095, 1.86199, 1.73262}, {-1.64135, 1.92647, 2.17241}, {-1.64274, 1.87635, 1.8991}, 
-{-1.43525, 1.96338, 2.29103}, {-1.23947, 0.906661, 1.85165}, {-1.23827, 1.00251, 2.32989}, 
-{-1.51697, 0.905666, 1.74594}, {-1.79855, 1.10124, 2.45058}, {-1.79634, 1.00058, 2.11022}, 
-{-1.52864, 1.13052, 2.57922}, {-1.70713, 0.826082, 2.81458}, {-1.96617, 0.796801, 2.68545}, 
-{-1.81103, 0.644565, 2.74944}, {-1.77944, 0.035412, 3.13496}, {-2.12765, 0.006131, 2.92941}, 
-{-1.99464, 0.613355, 2.21124}, {-1.44336, 0.775415, 2.01341}, {-1.65369, 0.57833, 1.96778}, 
-{-2.10389, -0.008211, 2.24152}, {-1.19974, 0.673136, 2.55315}, {-1.219, 0.035412, 2.82684}, 
-{-1.25441, 0.592586, 2.1201}, {-1.65369, 0.273, 1.96778}, {-1.26242, 0.297792, 2.14015}, 
-{-1.48153, 2.26994, -7.09658}, {-1.60666, 2.28089, -7.13591}, {-1.95644, 0.826083, -5.99094}, 
-{-2.20313, 0.796801, -6.16376}, {-2.09924, 0.644565, -6.09977}, {-2.06765, 0.035413, -5.71424}, 
-{-2.41585, 0.006131, -5.9198}, {-2.28285, 0.613355, -6.63797}, {-1.73157, 0.775415, -6.8358}, 
-{-1.94189, 0.57833, -6.88143}, {-2.3921, -0.008211, -6.60769}, {-1.48795, 0.673137, -6.29605}, 
-{-1.50721, 0.035413, -6.02237}, {-1.54262, 0.592586, -6.7291}, {-1.94189, 0.273, -6.88143}, 
-{-1.55062, 0.297792, -6.70906}, {-1.14454, 7.89165, 3.42466}, {-1.7895, 6.77652, 3.57773}, 
-{-0.603033, 9.31412, 3.06758}, {-0.002589, 9.6004, 2.94879}, {-0.816322, 8.44079, 4.39824}, 
-{-0.881541, 7.31364, 4.60814}, {-0.525209, 9.5398, 4.21614}, {-0.002589, 9.90892, 4.08744}, 
-{-0.844853, 8.99392, 5.26106}, {-0.863215, 7.91712, 5.47484}, {-0.560725, 9.90112, 4.95854}, 
-{-0.002589, 10.239, 4.91546}, {-0.891069, 9.12882, 5.60397}, {-0.904548, 8.12086, 5.83848}, 
-{-0.570545, 10.3039, 5.45014}, {-0.002589, 10.6002, 5.42951}, {-1.26739, 6.79948, 3.74415}, 
-{-0.627513, 6.543, 4.78114}, {-1.01988, 6.00548, 3.96736}, {-0.550989, 7.40152, 5.63286}, 
-{-0.529905, 7.62747, 6.05089}, {-0.002589, 6.16316, 4.97026}, {-0.002589, 5.1718, 4.32154}, 
-{-0.002589, 7.13888, 5.75174}, {-0.002589, 7.52242, 6.09251}, {-0.331695, 6.19808, 5.02126}, 
-{-0.467482, 5.19456, 4.30282}, {-1.44562, 5.764, 3.56765}, {-0.98335, 4.772, 3.53009}, 
-{-0.002589, 4.08628, 3.93028}, {-0.62689, 3.93164, 3.80353}, {-1.0132, 3.99227, 3.28603}, 
-{-0.002589, 3.53475, 3.29197}, {-0.688534, 3.54142, 3.0493}, {-0.002589, 10.9607, 5.99188}, 
-{-0.440645, 10.9363, 6.02215}, {-0.002589, 10.9994, 6.20921}, {-0.387365, 10.9776, 6.20419}, 
-{-0.002589, 10.8622, 6.67874}, {-0.387764, 10.8443, 6.67077}, {-0.002589, 10.6015, 6.99281}, 
-{-0.353572, 10.5763, 6.98256}, {-0.644275, 10.394, 7.33284}, {-0.002589, 10.2259, 7.63402}, 
-{-0.397279, 10.2016, 7.61096}, {-0.002589, 9.88032, 7.89185}, {-0.373353, 9.82023, 7.86285}, 
-{-0.002589, 9.44728, 8.38395}, {-0.241618, 9.41185, 8.36297}, {-0.002589, 9.07548, 8.83878}, 
-{-0.196256, 9.02802, 8.82746}, {-0.002589, 8.82704, 9.32115}, {-0.19638, 8.7929, 9.29742}, 
-{-0.002589, 8.6119, 9.42564}, {-0.190193, 8.60411, 9.38671}, {-0.002589, 8.20959, 9.26141}, 
-{-0.228539, 8.21089, 9.23774}, {-0.552225, 8.75791, 8.65431}, {-0.590824, 8.89746, 8.21772}, 
-{-0.674798, 8.2974, 8.5272}, {-0.681271, 8.43168, 8.04699}, {-0.821292, 9.58975, 7.73293}, 
-{-1.02469, 9.36624, 7.39809}, {-1.1765, 8.75872, 7.21522}, {-0.935413, 10.2929, 7.18446}, 
-{-0.808287, 10.4372, 6.82855}, {-1.0852, 10.0182, 7.10779}, {-0.952045, 10.0439, 6.41498}, 
-{-1.06685, 9.64246, 7.03446}, {-1.15518, 9.26662, 6.26714}, {-0.942706, 9.15995, 5.85129}, 
-{-0.967599, 8.26122, 6.07032}, {-0.917222, 9.84336, 5.81055}, {-0.529905, 7.74892, 6.47414}, 
-{-0.002589, 7.65964, 6.5197}, {-0.554282, 7.76154, 7.11438}, {-0.002589, 7.69903, 7.12101}, 
-{-0.46929, 8.0121, 8.48994}, {-0.495882, 7.98791, 7.99319}, {-0.002589, 7.89506, 8.4512}, 
-{-0.002589, 7.91291, 8.02541}, {-1.19537, 8.4106, 6.53926}, {-0.986823, 8.13918, 7.1751}, 
-{-0.671471, 8.20598, 8.00771}, {-0.939242, 10.1216, 7.6108}, {-1.04104, 9.97784, 7.55066}, 
-{-0.8062, 9.87556, 7.76747}, {-0.939242, 9.87881, 7.64498}, {-1.12189, 9.9708, 7.39396}, 
-{-1.12189, 10.1595, 7.31501}, {-1.12189, 9.85067, 7.3258}, {-0.939242, 9.75763, 7.63862}, 
-{-1.04104, 9.5384, 7.52642}, {-1.04104, 9.68391, 7.5183}, {-1.12189, 9.58974, 7.28065}, 
-{-1.12189, 9.73943, 7.36502}, {-1.12189, 9.76065, 7.14847}, {-0.461993, 8.7256, 9.1349}, 
-{-0.381116, 8.58792, 9.28214}, {-0.502741, 8.77832, 9.02162}, {-0.624095, 8.18411, 8.88694}, 
-{-0.610002, 8.08587, 8.78926}, {-0.418425, 8.20184, 9.16806}, {-0.449157, 8.38412, 9.24806}, 
-{-0.570505, 8.57448, 9.00342}, {-0.539049, 8.42572, 9.1171}, {-0.330847, 8.45348, 9.33146}, 
-{-0.311375, 7.96801, 8.93809}, {-0.002589, 7.90125, 8.96516}, {-0.296756, 8.0642, 9.08853}, 
-{-0.002589, 8.04586, 9.14675}, {-0.002589, 8.18591, 8.97709}, {-0.373156, 8.18382, 8.97296}, 
-{-0.284187, 8.16608, 9.0892}, {-0.002589, 8.16023, 9.1524}, {-0.859085, 10.8769, 6.59538}, 
-{-0.868309, 11.0406, 6.2727}, {-0.941129, 10.5447, 6.65742}, {-0.959149, 10.888, 6.06038}, 
-{-1.08835, 10.5927, 6.21846}, {-0.518939, 10.7462, 5.83474}, {-0.626723, 10.5344, 5.70483}, 
-{-0.904537, 10.3653, 5.70702}, {-1.22218, 10.4372, 6.28086}, {-1.25424, 10.3017, 5.86014}, 
-{-1.54765, 10.5874, 6.41794}, {-1.79082, 10.3048, 5.85028}, {-2.09567, 10.7467, 6.25761}, 
-{-2.36024, 10.4568, 5.90543}, {-1.61792, 9.6276, 6.20091}, {-2.1609, 9.73114, 6.03557}, 
-{-2.55928, 10.2494, 5.93645}, {-2.43602, 10.6909, 6.04242}, {-2.56209, 10.5414, 5.97733}, 
-{-1.06709, 10.5204, 6.44282}, {-1.3524, 10.321, 6.53942}, {-1.62645, 10.4653, 6.53711}, 
-{-2.13209, 10.6342, 6.35692}, {-2.41113, 10.2835, 6.09731}, {-2.11451, 9.88913, 6.14079}, 
-{-2.43838, 10.5232, 6.1358}, {-1.64132, 9.79897, 6.32802}, {-1.37513, 9.95241, 6.31531}, 
-{-2.10062, 10.2185, 6.12348}, {-1.51713, 10.1521, 6.22239}, {-0.002589, 10.773, 5.81674}, 
-{-0.368681, 8.5269, 9.19068}, {-1.11253, 9.84035, 7.50483}, {-0.002588, 9.98883, -7.15035}, 
-{-0.002588, 9.91467, -5.8968}, {-0.002588, 9.57269, -8.23215}, {-0.168272, 9.70072, -8.22475}, 
-{-0.002588, 9.90878, -8.22368}, {-0.002588, 9.5648, -9.4773}, {-0.134115, 9.70072, -9.46841}, 
-{-0.002588, 9.8762, -9.46883}, {-0.002588, 9.5648, -10.5829}, {-0.134115, 9.70073, -10.5783}, 
-{-0.002588, 9.8762, -10.5745}, {-0.002588, 9.50776, -11.628}, {-0.218238, 9.70073, -11.6277}, 
-{-0.002588, 9.99727, -11.6259}, {-0.002588, 9.34465, -12.7793}, {-0.458606, 9.85055, -12.779}, 
-{-0.002588, 10.6109, -13.0516}, {-0.002588, 9.69992, -13.5751}, {-0.002588, 10.5813, -14.0648}, 
-{-0.002588, 10.4974, -13.4783}, {-1.26879, 11.1438, 6.50538}, {-1.22162, 11.0243, 6.71594}, 
-{-1.41518, 11.1201, 6.90837}, {-1.3267, 10.7598, 6.71334}, {-1.46142, 10.9323, 6.89456}, 
-{-1.47717, 11.0301, 7.21479}, {-1.44033, 11.1788, 7.17858}, {-1.57803, 11.2638, 7.12249}, 
-{-1.36697, 11.279, 7.80922}, {-1.4242, 10.7038, 6.55074}, {-1.59907, 10.8545, 6.80881}, 
-{-1.62971, 10.9111, 7.0612}, {-1.56869, 11.004, 7.30975}, {-1.7576, 11.0572, 7.03524}, 
-{-1.44383, 10.8046, 6.33982}, {-1.66859, 11.1036, 7.41532}, {-1.68836, 10.9932, 6.68858}, 
-{-1.41789, 11.0612, 6.2917}, {-1.66702, 11.166, 6.6948}, {-1.70708, 11.2487, 7.06195}, 
-{-1.64154, 11.2336, 7.39055}, {-1.5432, 11.2196, 6.76024}, {-1.34136, 5.05217, -6.96987}, 
-{-1.72903, 4.63363, -5.48745}, {-1.65206, 3.94669, -5.53653}, {-1.15823, 3.82851, -6.86685}, 
-{-1.33071, 3.38032, -5.63882}, {-0.597722, 5.79516, -7.50486}, {-0.002588, 5.7848, -7.5419}, 
-{-0.584022, 5.14528, -7.61789}, {-0.002588, 5.1383, -7.67239}, {-0.589454, 4.37674, -7.54898}, 
-{-0.002588, 4.33723, -7.60113}, {-0.628129, 3.71519, -7.16157}, {-0.002588, 3.67543, -7.27314}, 
-{-1.04149, 5.12232, -7.47126}, {-1.70105, 3.99775, -4.75446}, {-1.29848, 3.42723, -4.83297}, 
-{-0.002588, 3.07664, -4.88953}, {-0.002588, 3.00853, -5.63806}, {-0.68505, 3.25503, -6.59891}, 
-{-0.002588, 3.1821, -6.60319}, {-1.62114, 5.17818, -5.46599}, {-1.44764, 5.62538, -6.29192}, 
-{-0.509809, 3.14245, -4.88755}, {-0.649222, 3.23498, -4.53714}, {-0.960468, 3.35532, -4.58266}, 
-{-1.06961, 3.30511, -4.88394}, {-0.819606, 3.19706, -5.09878}, {-0.543958, 3.0858, -5.64033}, 
-{-0.843266, 3.16785, -5.46824}, {-1.10236, 3.27474, -5.68409}, {-0.973395, 3.27824, -6.04438}, 
-{-0.60991, 3.14044, -6.01982}, {-0.887298, 2.65973, -5.64717}, {-0.750037, 2.66309, -5.73458}, 
-{-0.787131, 2.67731, -5.87078}, {-0.926993, 2.68638, -5.88785}, {-0.987631, 2.67724, -5.74072}, 
-{-0.855725, 3.07341, -5.6035}, {-0.687389, 3.0261, -5.69915}, {-0.751067, 3.05201, -5.88662}, 
-{-0.905795, 3.12649, -5.92024}, {-0.980357, 3.13122, -5.70915}, {-0.871847, 2.60032, -5.78787}, 
-{-0.860786, 2.6654, -4.91405}, {-0.970775, 2.69744, -4.82542}, {-0.929215, 2.70159, -4.67958}, 
-{-0.759368, 2.66751, -4.68555}, {-0.728357, 2.64726, -4.83325}, {-0.830632, 3.10703, -4.97976}, 
-{-0.97126, 3.14656, -4.85022}, {-0.902017, 3.17471, -4.66875}, {-0.702524, 3.14813, -4.65568}, 
-{-0.644189, 3.07908, -4.84486}, {-0.871469, 2.60819, -4.78228}, {1.79489, 4.83536, 0.48091}, 
-{2.66195, 4.94608, -1.13939}, {2.18866, 5.86984, 0.516773}, {2.71731, 6.01616, -1.11639}, 
-{2.0877, 7.083, 0.479657}, {2.3704, 7.22128, -1.37961}, {1.53785, 8.1498, 0.335179}, 
-{1.70898, 8.1852, -1.52386}, {0.682862, 9.17272, -1.61379}, {0.810986, 9.01916, 0.103545}, 
-{-0.001599, 9.47092, -1.5801}, {-0.001599, 9.48256, 0.117406}, {1.28091, 4.12776, 0.450461}, 
-{1.91407, 3.85584, -1.30399}, {-0.001599, 3.66499, 0.458912}, {-0.001599, 3.18927, -1.45}, 
-{2.87633, 4.8796, -3.07589}, {2.97704, 5.809, -3.03396}, {2.56574, 7.16064, -3.15259}, 
-{1.94225, 8.13888, -3.29374}, {0.90307, 9.47034, -3.45594}, {-0.001599, 9.56328, -3.25619}, 
-{2.38298, 3.91519, -2.98284}, {1.35189, 3.28409, -2.89053}, {1.41668, 9.29775, -5.00654}, 
-{-0.001599, 9.65968, -4.92815}, {1.06284, 9.55975, -5.96414}, {-0.001599, 9.77216, -5.8895}, 
-{0.97489, 9.45692, -7.16338}, {0.214051, 9.62156, -7.13774}, {2.06171, 8.28696, -5.22502}, 
-{1.95476, 8.63824, -5.9107}, {1.50244, 8.93868, -6.95658}, {1.72883, 9.17692, -3.9663}, 
-{2.07996, 8.32408, -4.23346}, {0.760434, 9.57441, -4.9455}, {2.18955, 7.21064, -4.34358}, 
-{2.40495, 6.47972, -4.5221}, {2.2495, 5.48552, -4.76234}, {1.69686, 4.8084, -4.7619}, 
-{1.12933, 3.70331, -4.00058}, {-0.001599, 3.39507, -4.01534}, {0.760939, 8.99912, -7.63131}, 
-{-0.001599, 9.23784, -7.61843}, {1.00825, 8.51292, -7.55579}, {2.18013, 7.37804, -5.1549}, 
-{2.11291, 7.32866, -6.03711}, {1.73811, 7.17185, -6.97621}, {0.921483, 7.09284, -7.47198}, 
-{2.48617, 6.44612, -4.81722}, {2.3239, 6.54836, -5.91438}, {1.9603, 6.37976, -6.74874}, 
-{1.28688, 6.19092, -7.27426}, {-0.001599, 3.19378, -2.86215}, {0.978707, 3.19543, -1.34248}, 
-{0.73649, 3.76932, 0.433324}, {2.23255, 5.19668, -5.19026}, {2.36673, 5.51132, -5.78998}, 
-{2.03854, 5.2964, -6.63598}, {1.39654, 5.20337, -6.97156}, {1.72485, 4.44348, -5.2437}, 
-{2.05458, 4.27716, -5.7023}, {2.04022, 4.18312, -6.4357}, {1.61059, 4.33704, -6.95558}, 
-{1.36598, 2.924, -6.29895}, {1.76816, 3.05544, -6.3566}, {1.95043, 3.19489, -6.87499}, 
-{1.6148, 3.34463, -7.33114}, {1.71223, 1.53773, -6.4941}, {1.89624, 1.54982, -6.51695}, 
-{1.90698, 1.49676, -6.81274}, {1.70064, 1.39332, -7.0651}, {1.85589, 1.13052, -6.26999}, 
-{2.02578, 1.10124, -6.44516}, {2.08036, 1.00058, -6.73899}, {1.80099, 0.905667, -7.10327}, 
-{1.54588, 2.36794, -6.49025}, {1.75134, 2.40168, -6.51951}, {1.84277, 2.3486, -6.96314}, 
-{1.52349, 0.906661, -6.99755}, {1.49345, 1.46587, -6.8259}, {1.4436, 2.29521, -6.88214}, 
-{1.34111, 3.30601, -7.34526}, {1.16131, 4.36396, -6.85246}, {1.56217, 3.89597, -7.07058}, 
-{1.18311, 3.82301, -7.01797}, {1.31839, 3.38382, -5.99754}, {0.960131, 6.27508, -7.29634}, 
-{0.593519, 6.75048, -7.4103}, {-0.001599, 8.91284, -7.71778}, {-0.001599, 8.18572, -7.5635}, 
-{-0.001599, 7.23668, -7.4263}, {-0.001599, 6.8002, -7.4401}, {-0.001599, 9.5328, -7.15882}, 
-{1.42048, 3.98379, -5.5191}, {1.50351, 4.16464, -4.30942}, {1.12262, 3.56639, -6.5844}, 
-{0.596276, 3.45543, -3.98158}, {1.26539, 3.03939, -6.80981}, {1.52229, 1.00251, -6.51932}, 
-{1.93274, 3.6359, -6.67895}, {1.85841, 3.44039, -6.15044}, {1.13156, 5.20337, -6.90259}, 
-{0.879353, 4.10727, -6.24376}, {0.891677, 4.65605, -5.87689}, {1.24802, 4.46058, -5.32084}, 
-{2.27339, 5.68996, 1.78333}, {1.76286, 4.77524, 0.959476}, {2.27338, 7.15396, 1.73876}, 
-{1.82067, 8.06748, 1.59626}, {1.02995, 9.02872, 1.47709}, {-0.001599, 9.56192, 1.39195}, 
-{1.19346, 4.0668, 0.925357}, {0.76289, 3.71054, 0.980685}, {-0.001599, 3.66877, 1.61838}, 
-{1.8359, 5.36928, 3.0282}, {1.77348, 4.95268, 2.78309}, {1.99287, 6.85472, 3.22342}, 
-{1.6106, 7.792, 3.05421}, {0.572974, 9.37256, 2.52025}, {-0.001599, 9.55274, 2.44165}, 
-{1.07735, 3.61148, 2.28503}, {2.21787, 5.78328, 2.54203}, {2.09762, 5.2452, 2.45709}, 
-{2.19514, 5.22356, 1.71539}, {1.94731, 5.32572, 1.15383}, {2.12957, 4.71108, 1.70665}, 
-{2.08381, 4.771, 2.45258}, {2.11265, 4.18712, 1.57372}, {2.08492, 4.24744, 2.29127}, 
-{1.81917, 4.72496, 2.74158}, {1.75772, 4.236, 2.5991}, {1.80391, 4.11864, 1.34638}, 
-{1.51811, 4.6626, 2.75438}, {1.28965, 4.25377, 2.62866}, {1.13695, 3.59968, 1.38602}, 
-{1.67789, 3.25309, 1.3885}, {1.80682, 3.54698, 2.23892}, {1.85357, 3.38666, 1.59151}, 
-{1.51129, 3.42284, 2.43358}, {1.11139, 3.83971, 2.49034}, {1.12763, 2.73589, 1.72378}, 
-{1.04428, 2.87968, 2.26118}, {1.57019, 2.68021, 1.57848}, {1.78011, 2.72026, 2.2386}, 
-{1.76349, 2.7082, 1.75016}, {1.43749, 2.738, 2.41322}, {1.29726, 1.8778, 1.84057}, 
-{1.23558, 1.89112, 2.15578}, {1.51676, 1.86199, 1.73262}, {1.63716, 1.92647, 2.17241}, 
-{1.63855, 1.87635, 1.8991}, {1.43106, 1.96338, 2.29103}, {1.23528, 0.906661, 1.85165}, 
-{1.23408, 1.00251, 2.32989}, {1.51278, 0.905666, 1.74594}, {1.79436, 1.10124, 2.45058}, 
-{1.79216, 1.00058, 2.11022}, {1.52445, 1.13052, 2.57922}, {1.70294, 0.826082, 2.81458}, 
-{1.96198, 0.796801, 2.68545}, {1.80684, 0.644565, 2.74944}, {1.77525, 0.035412, 3.13496}, 
-{2.12346, 0.006131, 2.92941}, {1.99045, 0.613355, 2.21124}, {1.43918, 0.775415, 2.01341}, 
-{1.6495, 0.57833, 1.96778}, {2.0997, -0.008211, 2.24152}, {1.19555, 0.673136, 2.55315}, 
-{1.21482, 0.035412, 2.82684}, {1.25022, 0.592586, 2.1201}, {1.6495, 0.273, 1.96778}, 
-{1.25823, 0.297792, 2.14015}, {1.47734, 2.26994, -7.09658}, {1.60248, 2.28089, -7.13591}, 
-{1.95225, 0.826083, -5.99094}, {2.19895, 0.796801, -6.16376}, {2.09505, 0.644565, -6.09977}, 
-{2.06346, 0.035413, -5.71424}, {2.41167, 0.006131, -5.9198}, {2.27866, 0.613355, -6.63797}, 
-{1.72738, 0.775415, -6.8358}, {1.93771, 0.57833, -6.88143}, {2.38791, -0.008211, -6.60769}, 
-{1.48376, 0.673137, -6.29605}, {1.50302, 0.035413, -6.02237}, {1.53843, 0.592586, -6.7291}, 
-{1.93771, 0.273, -6.88143}, {1.54644, 0.297792, -6.70906}, {1.14036, 7.89165, 3.42466}, 
-{1.78531, 6.77652, 3.57773}, {0.598846, 9.31412, 3.06758}, {-0.001599, 9.6004, 2.94879}, 
-{0.812134, 8.44079, 4.39824}, {0.877354, 7.31364, 4.60814}, {0.521022, 9.5398, 4.21614}, 
-{-0.001599, 9.90892, 4.08744}, {0.840666, 8.99392, 5.26106}, {0.859028, 7.91712, 5.47484}, 
-{0.556538, 9.90112, 4.95854}, {-0.001599, 10.239, 4.91546}, {0.886882, 9.12882, 5.60397}, 
-{0.900361, 8.12086, 5.83848}, {0.566358, 10.3039, 5.45014}, {-0.001598, 10.6002, 5.42951}, 
-{1.2632, 6.79948, 3.74415}, {0.623326, 6.543, 4.78114}, {1.01569, 6.00548, 3.96736}, 
-{0.546802, 7.40152, 5.63286}, {0.525718, 7.62747, 6.05089}, {-0.001599, 6.16316, 4.97026}, 
-{-0.001599, 5.1718, 4.32154}, {-0.001598, 7.13888, 5.75174}, {-0.001598, 7.52242, 6.09251}, 
-{0.327508, 6.19808, 5.02126}, {0.463294, 5.19456, 4.30282}, {1.44143, 5.764, 3.56765}, 
-{0.979162, 4.772, 3.53009}, {-0.001599, 4.08628, 3.93028}, {0.622702, 3.93164, 3.80353}, 
-{1.00902, 3.99227, 3.28603}, {-0.001599, 3.53475, 3.29197}, {0.684346, 3.54142, 3.0493}, 
-{-0.001598, 10.9607, 5.99188}, {0.436458, 10.9363, 6.02215}, {-0.001598, 10.9994, 6.20921}, 
-{0.383177, 10.9776, 6.20419}, {-0.001598, 10.8622, 6.67874}, {0.383576, 10.8443, 6.67077}, 
-{-0.001598, 10.6015, 6.99281}, {0.349385, 10.5763, 6.98256}, {0.640087, 10.394, 7.33284}, 
-{-0.001598, 10.2259, 7.63402}, {0.393092, 10.2016, 7.61096}, {-0.001598, 9.88032, 7.89185}, 
-{0.369166, 9.82023, 7.86285}, {-0.001598, 9.44728, 8.38395}, {0.237431, 9.41185, 8.36297}, 
-{-0.001598, 9.07548, 8.83878}, {0.192069, 9.02802, 8.82746}, {-0.001598, 8.82704, 9.32115}, 
-{0.192192, 8.7929, 9.29742}, {-0.001598, 8.6119, 9.42564}, {0.186005, 8.60411, 9.38671}, 
-{-0.001598, 8.20959, 9.26141}, {0.224352, 8.21089, 9.23774}, {0.548038, 8.75791, 8.65431}, 
-{0.586636, 8.89746, 8.21772}, {0.670611, 8.2974, 8.5272}, {0.677083, 8.43168, 8.04699}, 
-{0.817105, 9.58975, 7.73293}, {1.0205, 9.36624, 7.39809}, {1.17231, 8.75872, 7.21522}, 
-{0.931225, 10.2929, 7.18446}, {0.8041, 10.4372, 6.82855}, {1.08101, 10.0182, 7.10779}, 
-{0.947858, 10.0439, 6.41498}, {1.06266, 9.64246, 7.03446}, {1.15099, 9.26662, 6.26714}, 
-{0.938519, 9.15995, 5.85129}, {0.963411, 8.26122, 6.07032}, {0.913034, 9.84336, 5.81055}, 
-{0.525718, 7.74892, 6.47414}, {-0.001598, 7.65964, 6.5197}, {0.550094, 7.76154, 7.11438}, 
-{-0.001598, 7.69903, 7.12101}, {0.465103, 8.0121, 8.48994}, {0.491695, 7.98791, 7.99319}, 
-{-0.001598, 7.89506, 8.4512}, {-0.001598, 7.91291, 8.02541}, {1.19119, 8.4106, 6.53926}, 
-{0.982635, 8.13918, 7.1751}, {0.667284, 8.20598, 8.00771}, {0.935055, 10.1216, 7.6108}, 
-{1.03685, 9.97784, 7.55066}, {0.802012, 9.87556, 7.76747}, {0.935055, 9.87881, 7.64498}, 
-{1.1177, 9.9708, 7.39396}, {1.1177, 10.1595, 7.31501}, {1.1177, 9.85067, 7.3258}, 
-{0.935055, 9.75763, 7.63862}, {1.03685, 9.5384, 7.52642}, {1.03685, 9.68391, 7.5183}, 
-{1.1177, 9.58974, 7.28065}, {1.1177, 9.73943, 7.36502}, {1.1177, 9.76065, 7.14847}, 
-{0.457806, 8.7256, 9.1349}, {0.376929, 8.58792, 9.28214}, {0.498554, 8.77832, 9.02162}, 
-{0.619908, 8.18411, 8.88694}, {0.605815, 8.08587, 8.78926}, {0.414238, 8.20184, 9.16806}, 
-{0.44497, 8.38412, 9.24806}, {0.566318, 8.57448, 9.00342}, {0.534862, 8.42572, 9.1171}, 
-{0.326659, 8.45348, 9.33146}, {0.307187, 7.96801, 8.93809}, {-0.001598, 7.90125, 8.96516}, 
-{0.292569, 8.0642, 9.08853}, {-0.001598, 8.04586, 9.14675}, {-0.001598, 8.18591, 8.97709}, 
-{0.368969, 8.18382, 8.97296}, {0.279999, 8.16608, 9.0892}, {-0.001598, 8.16023, 9.1524}, 
-{0.854898, 10.8769, 6.59538}, {0.864122, 11.0406, 6.2727}, {0.936942, 10.5447, 6.65742}, 
-{0.954962, 10.888, 6.06038}, {1.08416, 10.5927, 6.21846}, {0.514751, 10.7462, 5.83474}, 
-{0.622536, 10.5344, 5.70483}, {0.90035, 10.3653, 5.70702}, {1.21799, 10.4372, 6.28086}, 
-{1.25005, 10.3017, 5.86014}, {1.54346, 10.5874, 6.41794}, {1.78663, 10.3048, 5.85028}, 
-{2.09148, 10.7467, 6.25761}, {2.35605, 10.4568, 5.90543}, {1.61373, 9.6276, 6.20091}, 
-{2.15672, 9.73114, 6.03557}, {2.55509, 10.2494, 5.93645}, {2.43184, 10.6909, 6.04242}, 
-{2.55791, 10.5414, 5.97733}, {1.0629, 10.5204, 6.44282}, {1.34821, 10.321, 6.53942}, 
-{1.62226, 10.4653, 6.53711}, {2.1279, 10.6342, 6.35692}, {2.40694, 10.2835, 6.09731}, 
-{2.11033, 9.88913, 6.14079}, {2.43419, 10.5232, 6.1358}, {1.63713, 9.79897, 6.32802}, 
-{1.37095, 9.95241, 6.31531}, {2.09644, 10.2185, 6.12348}, {1.51294, 10.1521, 6.22239}, 
-{-0.001598, 10.773, 5.81674}, {0.364494, 8.5269, 9.19068}, {1.10834, 9.84035, 7.50483}, 
-{-0.001599, 9.98883, -7.15035}, {-0.001599, 9.91467, -5.8968}, {-0.001599, 9.57269, -8.23215}, 
-{0.164085, 9.70072, -8.22475}, {-0.001599, 9.90878, -8.22368}, {-0.001599, 9.5648, -9.4773}, 
-{0.129928, 9.70072, -9.46841}, {-0.001599, 9.8762, -9.46883}, {-0.001599, 9.5648, -10.5829}, 
-{0.129928, 9.70073, -10.5783}, {-0.001599, 9.8762, -10.5745}, {-0.001599, 9.50776, -11.628}, 
-{0.214051, 9.70073, -11.6277}, {-0.001599, 9.99727, -11.6259}, {-0.001599, 9.34465, -12.7793}, 
-{0.454419, 9.85055, -12.779}, {-0.001599, 10.6109, -13.0516}, {-0.001599, 9.69992, -13.5751}, 
-{-0.001599, 10.5813, -14.0648}, {-0.001599, 10.4974, -13.4783}, {1.26461, 11.1438, 6.50538}, 
-{1.21744, 11.0243, 6.71594}, {1.41099, 11.1201, 6.90837}, {1.32251, 10.7598, 6.71334}, 
-{1.45723, 10.9323, 6.89456}, {1.47299, 11.0301, 7.21479}, {1.43614, 11.1788, 7.17858}, 
-{1.57384, 11.2638, 7.12249}, {1.36279, 11.279, 7.80922}, {1.42002, 10.7038, 6.55074}, 
-{1.59489, 10.8545, 6.80881}, {1.62553, 10.9111, 7.0612}, {1.5645, 11.004, 7.30975}, 
-{1.75342, 11.0572, 7.03524}, {1.43965, 10.8046, 6.33982}, {1.6644, 11.1036, 7.41532}, 
-{1.68417, 10.9932, 6.68858}, {1.41371, 11.0612, 6.2917}, {1.66284, 11.166, 6.6948}, 
-{1.70289, 11.2487, 7.06195}, {1.63735, 11.2336, 7.39055}, {1.53901, 11.2196, 6.76024}, 
-{1.33717, 5.05217, -6.96987}, {1.72485, 4.63363, -5.48745}, {1.64787, 3.94669, -5.53653}, 
-{1.15404, 3.82851, -6.86685}, {1.32652, 3.38032, -5.63882}, {0.593535, 5.79516, -7.50486}, 
-{-0.001599, 5.7848, -7.5419}, {0.579835, 5.14528, -7.61789}, {-0.001599, 5.1383, -7.67239}, 
-{0.585267, 4.37674, -7.54898}, {-0.001599, 4.33723, -7.60113}, {0.623941, 3.71519, -7.16157}, 
-{-0.001599, 3.67543, -7.27314}, {1.03731, 5.12232, -7.47126}, {1.69686, 3.99775, -4.75446}, 
-{1.29429, 3.42723, -4.83297}, {-0.001599, 3.07664, -4.88953}, {-0.001599, 3.00853, -5.63806}, 
-{0.680863, 3.25503, -6.59891}, {-0.001599, 3.1821, -6.60319}, {1.61696, 5.17818, -5.46599}, 
-{1.44345, 5.62538, -6.29192}, {0.505621, 3.14245, -4.88755}, {0.645035, 3.23498, -4.53714}, 
-{0.956281, 3.35532, -4.58266}, {1.06542, 3.30511, -4.88394}, {0.815419, 3.19706, -5.09878}, 
-{0.53977, 3.0858, -5.64033}, {0.839079, 3.16785, -5.46824}, {1.09818, 3.27474, -5.68409}, 
-{0.969207, 3.27824, -6.04438}, {0.605723, 3.14044, -6.01982}, {0.88311, 2.65973, -5.64717}, 
-{0.745849, 2.66309, -5.73458}, {0.782944, 2.67731, -5.87078}, {0.922806, 2.68638, -5.88785}, 
-{0.983444, 2.67724, -5.74072}, {0.851538, 3.07341, -5.6035}, {0.683201, 3.0261, -5.69915}, 
-{0.746879, 3.05201, -5.88662}, {0.901608, 3.12649, -5.92024}, {0.976169, 3.13122, -5.70915}, 
-{0.86766, 2.60032, -5.78787}, {0.856598, 2.6654, -4.91405}, {0.966588, 2.69744, -4.82542}, 
-{0.925028, 2.70159, -4.67958}, {0.755181, 2.66751, -4.68555}, {0.72417, 2.64726, -4.83325}, 
-{0.826444, 3.10703, -4.97976}, {0.967073, 3.14656, -4.85022}, {0.89783, 3.17471, -4.66875}, 
-{0.698337, 3.14813, -4.65568}, {0.640001, 3.07908, -4.84486}, {0.867282, 2.60819, -4.78228}, 
-{-1.79908, 4.83536, 0.48091}, {-2.66614, 4.94608, -1.13939}, {-2.19285, 5.86984, 0.516773}, 
-{-2.7215, 6.01616, -1.11639}, {-2.09189, 7.083, 0.479657}, {-2.37458, 7.22128, -1.37961}, 
-{-1.54204, 8.1498, 0.335179}, {-1.71317, 8.1852, -1.52386}, {-0.68705, 9.17272, -1.61379}, 
-{-0.815173, 9.01916, 0.103545}, {-0.002589, 9.47092, -1.5801}, {-0.002589, 9.48256, 0.117406}, 
-{-1.2851, 4.12776, 0.450461}, {-1.91826, 3.85584, -1.30399}, {-0.002589, 3.66499, 0.458912}, 
-{-0.002589, 3.18927, -1.45}, {-2.88052, 4.8796, -3.07589}, {-2.98122, 5.809, -3.03396}, 
-{-2.56993, 7.16064, -3.15259}, {-1.94644, 8.13888, -3.29374}, {-0.907258, 9.47034, -3.45594}, 
-{-0.002589, 9.56328, -3.25619}, {-2.38717, 3.91519, -2.98284}, {-1.35607, 3.28409, -2.89053}, 
-{-1.42087, 9.29775, -5.00654}, {-0.002588, 9.65968, -4.92815}, {-1.06703, 9.55975, -5.96414}, 
-{-0.002588, 9.77216, -5.8895}, {-0.979078, 9.45692, -7.16338}, {-0.218239, 9.62156, -7.13774}, 
-{-2.06589, 8.28696, -5.22502}, {-1.95895, 8.63824, -5.9107}, {-1.50663, 8.93868, -6.95658}, 
-{-1.73302, 9.17692, -3.9663}, {-2.08415, 8.32408, -4.23346}, {-0.764622, 9.57441, -4.9455}, 
-{-2.19373, 7.21064, -4.34358}, {-2.40913, 6.47972, -4.5221}, {-2.25369, 5.48552, -4.76234}, 
-{-1.70105, 4.8084, -4.7619}, {-1.13351, 3.70331, -4.00058}, {-0.002588, 3.39507, -4.01534}, 
-{-0.765126, 8.99912, -7.63131}, {-0.002588, 9.23784, -7.61843}, {-1.01244, 8.51292, -7.55579}, 
-{-2.18431, 7.37804, -5.1549}, {-2.1171, 7.32866, -6.03711}, {-1.7423, 7.17185, -6.97621}, 
-{-0.92567, 7.09284, -7.47198}, {-2.49036, 6.44612, -4.81722}, {-2.32809, 6.54836, -5.91438}, 
-{-1.96449, 6.37976, -6.74874}, {-1.29107, 6.19092, -7.27426}, {-0.002589, 3.19378, -2.86215}, 
-{-0.982894, 3.19543, -1.34248}, {-0.740678, 3.76932, 0.433324}, {-2.23673, 5.19668, -5.19026}, 
-{-2.37092, 5.51132, -5.78998}, {-2.04273, 5.2964, -6.63598}, {-1.40073, 5.20337, -6.97156}, 
-{-1.72903, 4.44348, -5.2437}, {-2.05877, 4.27716, -5.7023}, {-2.04441, 4.18312, -6.4357}, 
-{-1.61478, 4.33704, -6.95558}, {-1.37017, 2.924, -6.29895}, {-1.77235, 3.05544, -6.3566}, 
-{-1.95461, 3.19489, -6.87499}, {-1.61899, 3.34463, -7.33114}, {-1.71642, 1.53773, -6.4941}, 
-{-1.90043, 1.54982, -6.51695}, {-1.91117, 1.49676, -6.81274}, {-1.70483, 1.39332, -7.0651}, 
-{-1.86008, 1.13052, -6.26999}, {-2.02997, 1.10124, -6.44516}, {-2.08455, 1.00058, -6.73899}, 
-{-1.80518, 0.905667, -7.10327}, {-1.55007, 2.36794, -6.49025}, {-1.75552, 2.40168, -6.51951}, 
-{-1.84695, 2.3486, -6.96314}, {-1.52768, 0.906661, -6.99755}, {-1.49764, 1.46587, -6.8259}, 
-{-1.44779, 2.29521, -6.88214}, {-1.3453, 3.30601, -7.34526}, {-1.1655, 4.36396, -6.85246}, 
-{-1.56636, 3.89597, -7.07058}, {-1.1873, 3.82301, -7.01797}, {-1.32258, 3.38382, -5.99754}, 
-{-0.964318, 6.27508, -7.29634}, {-0.597706, 6.75048, -7.4103}, {-0.002588, 8.91284, -7.71778}, 
-{-0.002588, 8.18572, -7.5635}, {-0.002588, 7.23668, -7.4263}, {-0.002588, 6.8002, -7.4401}, 
-{-0.002588, 9.5328, -7.15882}, {-1.42467, 3.98379, -5.5191}, {-1.5077, 4.16464, -4.30942}, 
-{-1.12681, 3.56639, -6.5844}, {-0.600463, 3.45543, -3.98158}, {-1.26957, 3.03939, -6.80981}, 
-{-1.52647, 1.00251, -6.51932}, {-1.93693, 3.6359, -6.67895}, {-1.86259, 3.44039, -6.15044}, 
-{-1.13575, 5.20337, -6.90259}, {-0.883541, 4.10727, -6.24376}, {-0.895865, 4.65605, -5.87689}, 
-{-1.25221, 4.46058, -5.32084}, {-2.27758, 5.68996, 1.78333}, {-1.76705, 4.77524, 0.959476}, 
-{-2.27757, 7.15396, 1.73876}, {-1.82486, 8.06748, 1.59626}, {-1.03414, 9.02872, 1.47709}, 
-{-0.002589, 9.56192, 1.39195}, {-1.19765, 4.0668, 0.925357}, {-0.767078, 3.71054, 0.980685}, 
-{-0.002589, 3.66877, 1.61838}, {-1.84009, 5.36928, 3.0282}, {-1.77767, 4.95268, 2.78309}, 
-{-1.99705, 6.85472, 3.22342}, {-1.61478, 7.792, 3.05421}, {-0.577161, 9.37256, 2.52025}, 
-{-0.002589, 9.55274, 2.44165}, {-1.08154, 3.61148, 2.28503}, {-2.22206, 5.78328, 2.54203}, 
-{-2.10181, 5.2452, 2.45709}, {-2.19933, 5.22356, 1.71539}, {-1.9515, 5.32572, 1.15383}, 
-{-2.13375, 4.71108, 1.70665}, {-2.088, 4.771, 2.45258}, {-2.11684, 4.18712, 1.57372}, 
-{-2.08911, 4.24744, 2.29127}, {-1.82336, 4.72496, 2.74158}, {-1.7619, 4.236, 2.5991}, 
-{-1.8081, 4.11864, 1.34638}, {-1.5223, 4.6626, 2.75438}, {-1.29383, 4.25377, 2.62866}, 
-{-1.14114, 3.59968, 1.38602}, {-1.68208, 3.25309, 1.3885}, {-1.81101, 3.54698, 2.23892}, 
-{-1.85775, 3.38666, 1.59151}, {-1.51547, 3.42284, 2.43358}, {-1.11558, 3.83971, 2.49034}, 
-{-1.13182, 2.73589, 1.72378}, {-1.04846, 2.87968, 2.26118}, {-1.57438, 2.68021, 1.57848}, 
-{-1.7843, 2.72026, 2.2386}, {-1.76768, 2.7082, 1.75016}, {-1.44168, 2.738, 2.41322}, 
-{-1.30145, 1.8778, 1.84057}, {-1.23977, 1.89112, 2.15578}, {-1.52095, 1.86199, 1.73262}, 
-{-1.64135, 1.92647, 2.17241}, {-1.64274, 1.87635, 1.8991}, {-1.43525, 1.96338, 2.29103}, 
-{-1.23947, 0.906661, 1.85165}, {-1.23827, 1.00251, 2.32989}, {-1.51697, 0.905666, 1.74594}, 
-{-1.79855, 1.10124, 2.45058}, {-1.79634, 1.00058, 2.11022}, {-1.52864, 1.13052, 2.57922}, 
-{-1.70713, 0.826082, 2.81458}, {-1.96617, 0.796801, 2.68545}, {-1.81103, 0.644565, 2.74944}, 
-{-1.77944, 0.035412, 3.13496}, {-2.12765, 0.006131, 2.92941}, {-1.99464, 0.613355, 2.21124}, 
-{-1.44336, 0.775415, 2.01341}, {-1.65369, 0.57833, 1.96778}, {-2.10389, -0.008211, 2.24152}, 
-{-1.19974, 0.673136, 2.55315}, {-1.219, 0.035412, 2.82684}, {-1.25441, 0.592586, 2.1201}, 
-{-1.65369, 0.273, 1.96778}, {-1.26242, 0.297792, 2.14015}, {-1.48153, 2.26994, -7.09658}, 
-{-1.60666, 2.28089, -7.13591}, {-1.95644, 0.826083, -5.99094}, {-2.20313, 0.796801, -6.16376}, 
-{-2.09924, 0.644565, -6.09977}, {-2.06765, 0.035413, -5.71424}, {-2.41585, 0.006131, -5.9198}, 
-{-2.28285, 0.613355, -6.63797}, {-1.73157, 0.775415, -6.8358}, {-1.94189, 0.57833, -6.88143}, 
-{-2.3921, -0.008211, -6.60769}, {-1.48795, 0.673137, -6.29605}, {-1.50721, 0.035413, -6.02237}, 
-{-1.54262, 0.592586, -6.7291}, {-1.94189, 0.273, -6.88143}, {-1.55062, 0.297792, -6.70906}, 
-{-1.14454, 7.89165, 3.42466}, {-1.7895, 6.77652, 3.57773}, {-0.603033, 9.31412, 3.06758}, 
-{-0.002589, 9.6004, 2.94879}, {-0.816322, 8.44079, 4.39824}, {-0.881541, 7.31364, 4.60814}, 
-{-0.525209, 9.5398, 4.21614}, {-0.002589, 9.90892, 4.08744}, {-0.844853, 8.99392, 5.26106}, 
-{-0.863215, 7.91712, 5.47484}, {-0.560725, 9.90112, 4.95854}, {-0.002589, 10.239, 4.91546}, 
-{-0.891069, 9.12882, 5.60397}, {-0.904548, 8.12086, 5.83848}, {-0.570545, 10.3039, 5.45014}, 
-{-0.002589, 10.6002, 5.42951}, {-1.26739, 6.79948, 3.74415}, {-0.627513, 6.543, 4.78114}, 
-{-1.01988, 6.00548, 3.96736}, {-0.550989, 7.40152, 5.63286}, {-0.529905, 7.62747, 6.05089}, 
-{-0.002589, 6.16316, 4.97026}, {-0.002589, 5.1718, 4.32154}, {-0.002589, 7.13888, 5.75174}, 
-{-0.002589, 7.52242, 6.09251}, {-0.331695, 6.19808, 5.02126}, {-0.467482, 5.19456, 4.30282}, 
-{-1.44562, 5.764, 3.56765}, {-0.98335, 4.772, 3.53009}, {-0.002589, 4.08628, 3.93028}, 
-{-0.62689, 3.93164, 3.80353}, {-1.0132, 3.99227, 3.28603}, {-0.002589, 3.53475, 3.29197}, 
-{-0.688534, 3.54142, 3.0493}, {-0.002589, 10.9607, 5.99188}, {-0.440645, 10.9363, 6.02215}, 
-{-0.002589, 10.9994, 6.20921}, {-0.387365, 10.9776, 6.20419}, {-0.002589, 10.8622, 6.67874}, 
-{-0.387764, 10.8443, 6.67077}, {-0.002589, 10.6015, 6.99281}, {-0.353572, 10.5763, 6.98256}, 
-{-0.644275, 10.394, 7.33284}, {-0.002589, 10.2259, 7.63402}, {-0.397279, 10.2016, 7.61096}, 
-{-0.002589, 9.88032, 7.89185}, {-0.373353, 9.82023, 7.86285}, {-0.002589, 9.44728, 8.38395}, 
-{-0.241618, 9.41185, 8.36297}, {-0.002589, 9.07548, 8.83878}, {-0.196256, 9.02802, 8.82746}, 
-{-0.002589, 8.82704, 9.32115}, {-0.19638, 8.7929, 9.29742}, {-0.002589, 8.6119, 9.42564}, 
-{-0.190193, 8.60411, 9.38671}, {-0.002589, 8.20959, 9.26141}, {-0.228539, 8.21089, 9.23774}, 
-{-0.552225, 8.75791, 8.65431}, {-0.590824, 8.89746, 8.21772}, {-0.674798, 8.2974, 8.5272}, 
-{-0.681271, 8.43168, 8.04699}, {-0.821292, 9.58975, 7.73293}, {-1.02469, 9.36624, 7.39809}, 
-{-1.1765, 8.75872, 7.21522}, {-0.935413, 10.2929, 7.18446}, {-0.808287, 10.4372, 6.82855}, 
-{-1.0852, 10.0182, 7.10779}, {-0.952045, 10.0439, 6.41498}, {-1.06685, 9.64246, 7.03446}, 
-{-1.15518, 9.26662, 6.26714}, {-0.942706, 9.15995, 5.85129}, {-0.967599, 8.26122, 6.07032}, 
-{-0.917222, 9.84336, 5.81055}, {-0.529905, 7.74892, 6.47414}, {-0.002589, 7.65964, 6.5197}, 
-{-0.554282, 7.76154, 7.11438}, {-0.002589, 7.69903, 7.12101}, {-0.46929, 8.0121, 8.48994}, 
-{-0.495882, 7.98791, 7.99319}, {-0.002589, 7.89506, 8.4512}, {-0.002589, 7.91291, 8.02541}, 
-{-1.19537, 8.4106, 6.53926}, {-0.986823, 8.13918, 7.1751}, {-0.671471, 8.20598, 8.00771}, 
-{-0.939242, 10.1216, 7.6108}, {-1.04104, 9.97784, 7.55066}, {-0.8062, 9.87556, 7.76747}, 
-{-0.939242, 9.87881, 7.64498}, {-1.12189, 9.9708, 7.39396}, {-1.12189, 10.1595, 7.31501}, 
-{-1.12189, 9.85067, 7.3258}, {-0.939242, 9.75763, 7.63862}, {-1.04104, 9.5384, 7.52642}, 
-{-1.04104, 9.68391, 7.5183}, {-1.12189, 9.58974, 7.28065}, {-1.12189, 9.73943, 7.36502}, 
-{-1.12189, 9.76065, 7.14847}, {-0.461993, 8.7256, 9.1349}, {-0.381116, 8.58792, 9.28214}, 
-{-0.502741, 8.77832, 9.02162}, {-0.624095, 8.18411, 8.88694}, {-0.610002, 8.08587, 8.78926}, 
-{-0.418425, 8.20184, 9.16806}, {-0.449157, 8.38412, 9.24806}, {-0.570505, 8.57448, 9.00342}, 
-{-0.539049, 8.42572, 9.1171}, {-0.330847, 8.45348, 9.33146}, {-0.311375, 7.96801, 8.93809}, 
-{-0.002589, 7.90125, 8.96516}, {-0.296756, 8.0642, 9.08853}, {-0.002589, 8.04586, 9.14675}, 
-{-0.002589, 8.18591, 8.97709}, {-0.373156, 8.18382, 8.97296}, {-0.284187, 8.16608, 9.0892}, 
-{-0.002589, 8.16023, 9.1524}, {-0.859085, 10.8769, 6.59538}, {-0.868309, 11.0406, 6.2727}, 
-{-0.941129, 10.5447, 6.65742}, {-0.959149, 10.888, 6.06038}, {-1.08835, 10.5927, 6.21846}, 
-{-0.518939, 10.7462, 5.83474}, {-0.626723, 10.5344, 5.70483}, {-0.904537, 10.3653, 5.70702}, 
-{-1.22218, 10.4372, 6.28086}, {-1.25424, 10.3017, 5.86014}, {-1.54765, 10.5874, 6.41794}, 
-{-1.79082, 10.3048, 5.85028}, {-2.09567, 10.7467, 6.25761}, {-2.36024, 10.4568, 5.90543}, 
-{-1.61792, 9.6276, 6.20091}, {-2.1609, 9.73114, 6.03557}, {-2.55928, 10.2494, 5.93645}, 
-{-2.43602, 10.6909, 6.04242}, {-2.56209, 10.5414, 5.97733}, {-1.06709, 10.5204, 6.44282}, 
-{-1.3524, 10.321, 6.53942}, {-1.62645, 10.4653, 6.53711}, {-2.13209, 10.6342, 6.35692}, 
-{-2.41113, 10.2835, 6.09731}, {-2.11451, 9.88913, 6.14079}, {-2.43838, 10.5232, 6.1358}, 
-{-1.64132, 9.79897, 6.32802}, {-1.37513, 9.95241, 6.31531}, {-2.10062, 10.2185, 6.12348}, 
-{-1.51713, 10.1521, 6.22239}, {-0.002589, 10.773, 5.81674}, {-0.368681, 8.5269, 9.19068}, 
-{-1.11253, 9.84035, 7.50483}, {-0.002588, 9.98883, -7.15035}, {-0.002588, 9.91467, -5.8968}, 
-{-0.002588, 9.57269, -8.23215}, {-0.168272, 9.70072, -8.22475}, {-0.002588, 9.90878, -8.22368}, 
-{-0.002588, 9.5648, -9.4773}, {-0.134115, 9.70072, -9.46841}, {-0.002588, 9.8762, -9.46883}, 
-{-0.002588, 9.5648, -10.5829}, {-0.134115, 9.70073, -10.5783}, {-0.002588, 9.8762, -10.5745}, 
-{-0.002588, 9.50776, -11.628}, {-0.218238, 9.70073, -11.6277}, {-0.002588, 9.99727, -11.6259}, 
-{-0.002588, 9.34465, -12.7793}, {-0.458606, 9.85055, -12.779}, {-0.002588, 10.6109, -13.0516}, 
-{-0.002588, 9.69992, -13.5751}, {-0.002588, 10.5813, -14.0648}, {-0.002588, 10.4974, -13.4783}, 
-{-1.26879, 11.1438, 6.50538}, {-1.22162, 11.0243, 6.71594}, {-1.41518, 11.1201, 6.90837}, 
-{-1.3267, 10.7598, 6.71334}, {-1.46142, 10.9323, 6.89456}, {-1.47717, 11.0301, 7.21479}, 
-{-1.44033, 11.1788, 7.17858}, {-1.57803, 11.2638, 7.12249}, {-1.36697, 11.279, 7.80922}, 
-{-1.4242, 10.7038, 6.55074}, {-1.59907, 10.8545, 6.80881}, {-1.62971, 10.9111, 7.0612}, 
-{-1.56869, 11.004, 7.30975}, {-1.7576, 11.0572, 7.03524}, {-1.44383, 10.8046, 6.33982}, 
-{-1.66859, 11.1036, 7.41532}, {-1.68836, 10.9932, 6.68858}, {-1.41789, 11.0612, 6.2917}, 
-{-1.66702, 11.166, 6.6948}, {-1.70708, 11.2487, 7.06195}, {-1.64154, 11.2336, 7.39055}, 
-{-1.5432, 11.2196, 6.76024}, {-1.34136, 5.05217, -6.96987}, {-1.72903, 4.63363, -5.48745}, 
-{-1.65206, 3.94669, -5.53653}, {-1.15823, 3.82851, -6.86685}, {-1.33071, 3.38032, -5.63882}, 
-{-0.597722, 5.79516, -7.50486}, {-0.002588, 5.7848, -7.5419}, {-0.584022, 5.14528, -7.61789}, 
-{-0.002588, 5.1383, -7.67239}, {-0.589454, 4.37674, -7.54898}, {-0.002588, 4.33723, -7.60113}, 
-{-0.628129, 3.71519, -7.16157}, {-0.002588, 3.67543, -7.27314}, {-1.04149, 5.12232, -7.47126}, 
-{-1.70105, 3.99775, -4.75446}, {-1.29848, 3.42723, -4.83297}, {-0.002588, 3.07664, -4.88953}, 
-{-0.002588, 3.00853, -5.63806}, {-0.68505, 3.25503, -6.59891}, {-0.002588, 3.1821, -6.60319}, 
-{-1.62114, 5.17818, -5.46599}, {-1.44764, 5.62538, -6.29192}, {-0.509809, 3.14245, -4.88755}, 
-{-0.649222, 3.23498, -4.53714}, {-0.960468, 3.35532, -4.58266}, {-1.06961, 3.30511, -4.88394}, 
-{-0.819606, 3.19706, -5.09878}, {-0.543958, 3.0858, -5.64033}, {-0.843266, 3.16785, -5.46824}, 
-{-1.10236, 3.27474, -5.68409}, {-0.973395, 3.27824, -6.04438}, {-0.60991, 3.14044, -6.01982}, 
-{-0.887298, 2.65973, -5.64717}, {-0.750037, 2.66309, -5.73458}, {-0.787131, 2.67731, -5.87078}, 
-{-0.926993, 2.68638, -5.88785}, {-0.987631, 2.67724, -5.74072}, {-0.855725, 3.07341, -5.6035}, 
-{-0.687389, 3.0261, -5.69915}, {-0.751067, 3.05201, -5.88662}, {-0.905795, 3.12649, -5.92024}, 
-{-0.980357, 3.13122, -5.70915}, {-0.871847, 2.60032, -5.78787}, {-0.860786, 2.6654, -4.91405}, 
-{-0.970775, 2.69744, -4.82542}, {-0.929215, 2.70159, -4.67958}, {-0.759368, 2.66751, -4.68555}, 
-{-0.728357, 2.64726, -4.83325}, {-0.830632, 3.10703, -4.97976}, {-0.97126, 3.14656, -4.85022}, 
-{-0.902017, 3.17471, -4.66875}, {-0.702524, 3.14813, -4.65568}, {-0.644189, 3.07908, -4.84486}, 
-{-0.871469, 2.60819, -4.78228}};
-
-Vec2f st[3056] = {
-{0.273199, 0.285773}, {0.237165, 0.284524}, {0.278296, 0.228885}, 
-{0.254246, 0.307963}, {0.241022, 0.228085}, {0.320273, 0.219717}, 
-{0.266933, 0.32989}, {0.235071, 0.301193}, {0.238706, 0.160631}, 
-{0.212518, 0.283463}, {0.27108, 0.162092}, {0.315457, 0.28448}, 
-{0.250687, 0.327524}, {0.317928, 0.328338}, {0.205114, 0.163872}, 
-{0.203046, 0.222351}, {0.318161, 0.15796}, {0.353849, 0.214693}, 
-{0.270184, 0.356318}, {0.307505, 0.380052}, {0.232836, 0.327219}, 
-{0.210394, 0.300005}, {0.259812, 0.101888}, {0.294443, 0.110256}, 
-{0.200032, 0.282866}, {0.319903, 0.116474}, {0.349748, 0.323374}, 
-{0.352616, 0.279448}, {0.251441, 0.353359}, {0.340153, 0.374158}, 
-{0.2122, 0.31467}, {0.236226, 0.101903}, {0.183131, 0.167088}, 
-{0.180042, 0.22101}, {0.352236, 0.153043}, {0.388247, 0.21156}, 
-{0.255763, 0.373252}, {0.343624, 0.387062}, {0.234924, 0.353202}, 
-{0.214586, 0.322589}, {0.197985, 0.301932}, {0.293272, 0.099976}, 
-{0.213802, 0.117664}, {0.249751, 0.086982}, {0.325733, 0.088214}, 
-{0.358687, 0.12031}, {0.395208, 0.355559}, {0.383231, 0.319223}, 
-{0.382898, 0.271379}, {0.269512, 0.392043}, {0.241252, 0.364715}, 
-{0.393172, 0.374624}, {0.304781, 0.392394}, {0.186703, 0.323209}, 
-{0.207989, 0.102162}, {0.223515, 0.085121}, {0.357394, 0.085771}, 
-{0.388393, 0.129616}, {0.398614, 0.147393}, {0.234958, 0.390734}, 
-{0.401033, 0.414631}, {0.216687, 0.347583}, {0.23332, 0.363269}, 
-{0.192288, 0.34576}, {0.182051, 0.316137}, {0.324013, 0.057484}, 
-{0.260711, 0.066092}, {0.197733, 0.128422}, {0.217722, 0.069147}, 
-{0.36963, 0.061887}, {0.249677, 0.417651}, {0.231148, 0.363715}, 
-{0.277924, 0.405966}, {0.413891, 0.410148}, {0.362752, 0.420974}, 
-{0.163491, 0.345749}, {0.163071, 0.328735}, {0.296834, 0.061759}, 
-{0.188116, 0.099428}, {0.401728, 0.060026}, {0.392602, 0.093382}, 
-{0.205687, 0.400259}, {0.207799, 0.382233}, {0.425388, 0.438991}, 
-{0.413619, 0.440491}, {0.305581, 0.398191}, {0.187964, 0.35254}, 
-{0.216288, 0.358306}, {0.162096, 0.322755}, {0.380095, 0.025457}, 
-{0.318552, 0.024773}, {0.290961, 0.032696}, {0.214446, 0.0436}, 
-{0.206211, 0.074921}, {0.398146, 0.018253}, {0.284632, 0.442676}, 
-{0.216907, 0.359336}, {0.382019, 0.451029}, {0.32349, 0.428286}, 
-{0.164109, 0.351831}, {0.135841, 0.343443}, {0.134095, 0.333923}, 
-{0.253225, 0.036624}, {0.188575, 0.053537}, {0.186482, 0.071358}, 
-{0.192094, 0.373988}, {0.296647, 0.434312}, {0.386718, 0.462973}, 
-{0.133595, 0.328124}, {0.365264, 0.004585}, {0.315799, 0.007504}, 
-{0.284383, 0.014391}, {0.195385, 0.035127}, {0.326551, 0.463979}, 
-{0.427648, 0.457615}, {0.344511, 0.458475}, {0.107096, 0.353132}, 
-{0.10359, 0.341277}, {0.3822, 0.001954}, {0.175166, 0.046356}, 
-{0.219808, 0.025492}, {0.411607, 0.470169}, {0.351608, 0.471142}, 
-{0.100284, 0.328588}, {0.180024, 0.028299}, {0.249984, 0.024935}, 
-{0.204444, 0.021486}, {0.435679, 0.466486}, {0.387802, 0.471588}, 
-{0.334422, 0.478541}, {0.096492, 0.361313}, {0.095747, 0.337904}, 
-{0.152394, 0.040681}, {0.418593, 0.491223}, {0.356497, 0.479217}, 
-{0.090102, 0.344796}, {0.150545, 0.025228}, {0.185239, 0.01241}, 
-{0.391518, 0.486073}, {0.338652, 0.493283}, {0.091189, 0.363542}, 
-{0.122722, 0.04077}, {0.404609, 0.512801}, {0.3617, 0.495552}, 
-{0.068951, 0.369811}, {0.120873, 0.030467}, {0.148187, 0.01921}, 
-{0.373826, 0.519097}, {0.417699, 0.515355}, {0.352246, 0.5177}, 
-{0.068451, 0.34585}, {0.107096, 0.043271}, {0.394988, 0.525467}, 
-{0.432291, 0.505629}, {0.408726, 0.516772}, {0.339092, 0.515585}, 
-{0.088882, 0.336315}, {0.108116, 0.049373}, {0.10359, 0.033036}, 
-{0.11727, 0.021677}, {0.402773, 0.521376}, {0.362435, 0.54807}, 
-{0.436037, 0.499668}, {0.427267, 0.518026}, {0.411862, 0.522949}, 
-{0.354573, 0.546702}, {0.346977, 0.546196}, {0.078247, 0.336315}, 
-{0.097512, 0.059092}, {0.096492, 0.053073}, {0.400984, 0.529937}, 
-{0.378659, 0.554017}, {0.43519, 0.492193}, {0.447607, 0.497507}, 
-{0.422618, 0.522573}, {0.407987, 0.524315}, {0.090102, 0.036555}, 
-{0.100284, 0.020347}, {0.406053, 0.529654}, {0.402773, 0.53713}, 
-{0.357757, 0.564797}, {0.411502, 0.529185}, {0.416046, 0.525323}, 
-{0.347819, 0.563499}, {0.091189, 0.055302}, {0.095747, 0.029664}, 
-{0.408621, 0.533845}, {0.373798, 0.569224}, {0.421301, 0.532876}, 
-{0.068951, 0.06157}, {0.412842, 0.534067}, {0.350389, 0.573925}, 
-{0.396576, 0.559076}, {0.367409, 0.581385}, {0.416291, 0.530781}, 
-{0.068451, 0.037609}, {0.412729, 0.538333}, {0.353811, 0.577327}, 
-{0.410801, 0.541656}, {0.383207, 0.575256}, {0.374509, 0.582019}, 
-{0.088882, 0.028074}, {0.349634, 0.584349}, {0.365751, 0.587907}, 
-{0.362227, 0.585345}, {0.078247, 0.028074}, {0.346284, 0.579109}, 
-{0.372672, 0.585965}, {0.360778, 0.589906}, {0.367877, 0.591093}, 
-{0.354428, 0.58712}, {0.375017, 0.591626}, {0.363194, 0.592811}, 
-{0.368441, 0.594736}, {0.840236, 0.199369}, {0.840236, 0.140241}, 
-{0.868541, 0.140723}, {0.840236, 0.095845}, {0.864078, 0.200543}, 
-{0.876168, 0.092879}, {0.840236, 0.257752}, {0.840236, 0.059281}, 
-{0.871748, 0.264709}, {0.86025, 0.056543}, {0.86678, 0.316595}, 
-{0.840236, 0.041616}, {0.889639, 0.318721}, {0.840236, 0.31599}, 
-{0.861152, 0.037479}, {0.877314, 0.352077}, {0.900512, 0.282487}, 
-{0.840236, 0.001954}, {0.840236, 0.349477}, {0.87425, 0.393849}, 
-{0.847748, 0.392956}, {0.866798, 0.410148}, {0.840236, 0.393395}, 
-{0.840236, 0.4097}, {0.840236, 0.39369}, {0.90845, 0.271281}, 
-{0.90845, 0.204789}, {0.942596, 0.208534}, {0.955595, 0.154612}, 
-{0.934159, 0.27039}, {0.90845, 0.1556}, {0.935079, 0.289456}, 
-{0.929275, 0.116608}, {0.90845, 0.311669}, {0.90845, 0.115432}, 
-{0.947843, 0.115946}, {0.948108, 0.303575}, {0.90845, 0.084981}, 
-{0.941815, 0.09567}, {0.950077, 0.287529}, {0.946032, 0.33489}, 
-{0.930974, 0.097256}, {0.953589, 0.086952}, {0.97134, 0.302194}, 
-{0.932343, 0.361511}, {0.926118, 0.085051}, {0.945617, 0.085176}, 
-{0.90845, 0.369964}, {0.93283, 0.093127}, {0.90845, 0.058908}, 
-{0.954712, 0.058882}, {0.930196, 0.387783}, {0.939779, 0.092672}, 
-{0.930798, 0.086537}, {0.927307, 0.058829}, {0.946758, 0.057305}, 
-{0.90845, 0.392198}, {0.936909, 0.077693}, {0.929604, 0.045611}, 
-{0.937733, 0.064824}, {0.942266, 0.044755}, {0.937293, 0.081838}, 
-{0.90845, 0.02529}, {0.932303, 0.05678}, {0.942508, 0.056432}, 
-{0.939911, 0.049079}, {0.948704, 0.016106}, {0.932222, 0.025439}, 
-{0.938167, 0.060112}, {0.934521, 0.05025}, {0.942191, 0.086351}, 
-{0.90845, 0.001954}, {0.930239, 0.00584}, {0.851667, 0.736018}, 
-{0.829304, 0.739258}, {0.825484, 0.704859}, {0.851725, 0.774796}, 
-{0.814103, 0.701928}, {0.812756, 0.673443}, {0.820074, 0.739258}, 
-{0.801333, 0.685368}, {0.82111, 0.768497}, {0.801333, 0.718645}, 
-{0.780603, 0.668433}, {0.83676, 0.769435}, {0.816791, 0.742081}, 
-{0.780603, 0.683637}, {0.780603, 0.635375}, {0.82187, 0.78734}, 
-{0.800856, 0.741282}, {0.780603, 0.719006}, {0.815779, 0.623978}, 
-{0.835073, 0.784799}, {0.801045, 0.768052}, {0.780603, 0.610048}, 
-{0.827373, 0.805348}, {0.780603, 0.741525}, {0.820857, 0.787148}, 
-{0.807164, 0.607042}, {0.836906, 0.804003}, {0.802392, 0.791096}, 
-{0.780603, 0.769428}, {0.780603, 0.598727}, {0.832118, 0.841437}, 
-{0.836477, 0.841056}, {0.780603, 0.79248}, {0.839897, 0.871972}, 
-{0.83268, 0.869445}, {0.833684, 0.885585}, {0.44895, 0.704942}, 
-{0.434941, 0.700364}, {0.441207, 0.680995}, {0.452094, 0.718351}, 
-{0.448364, 0.68217}, {0.433284, 0.716381}, {0.447002, 0.652077}, 
-{0.43684, 0.737279}, {0.439381, 0.649574}, {0.453412, 0.652498}, 
-{0.458927, 0.747498}, {0.452006, 0.637893}, {0.447441, 0.753292}, 
-{0.440386, 0.633434}, {0.430832, 0.753887}, {0.455363, 0.627288}, 
-{0.439044, 0.621961}, {0.460337, 0.620966}, {0.459236, 0.599747}, 
-{0.471365, 0.598727}, {0.439715, 0.599747}, {0.181991, 0.837729}, 
-{0.185486, 0.854715}, {0.17582, 0.854681}, {0.325604, 0.598727}, 
-{0.323645, 0.627616}, {0.316175, 0.626735}, {0.337295, 0.630149}, 
-{0.307513, 0.662824}, {0.343958, 0.649518}, {0.326164, 0.653537}, 
-{0.334016, 0.671894}, {0.354457, 0.665535}, {0.318913, 0.680833}, 
-{0.371123, 0.686433}, {0.345881, 0.690734}, {0.324678, 0.699675}, 
-{0.35866, 0.70985}, {0.322932, 0.728914}, {0.378029, 0.703041}, 
-{0.74807, 0.889577}, {0.778704, 0.935785}, {0.742789, 0.939}, 
-{0.307222, 0.832946}, {0.295664, 0.830442}, {0.306343, 0.814302}, 
-{0.830895, 0.919924}, {0.847553, 0.923263}, {0.828543, 0.936876}, 
-{0.83653, 0.915353}, {0.855331, 0.91179}, {0.840246, 0.908984}, 
-{0.840944, 0.898716}, {0.864864, 0.889577}, {0.679232, 0.763096}, 
-{0.67764, 0.771029}, {0.668745, 0.760924}, {0.679815, 0.78554}, 
-{0.677092, 0.746065}, {0.660787, 0.746683}, {0.654578, 0.732261}, 
-{0.668508, 0.71774}, {0.653393, 0.724311}, {0.652241, 0.698821}, 
-{0.665937, 0.693885}, {0.658904, 0.664386}, {0.665713, 0.666903}, 
-{0.658852, 0.633434}, {0.677872, 0.693267}, {0.668966, 0.637893}, 
-{0.678802, 0.722064}, {0.672892, 0.665618}, {0.675184, 0.627288}, 
-{0.678368, 0.636873}, {0.65751, 0.621961}, {0.684207, 0.626268}, 
-{0.678803, 0.620966}, {0.677702, 0.599747}, {0.689831, 0.598727}, 
-{0.658181, 0.599747}, {0.002317, 0.747407}, {0.025549, 0.72933}, 
-{0.021159, 0.759479}, {0.017408, 0.779434}, {0.001992, 0.777495}, 
-{0.015547, 0.807935}, {0.007901, 0.807384}, {0.015408, 0.841246}, 
-{0.005742, 0.841212}, {0.130541, 0.692792}, {0.14926, 0.697801}, 
-{0.150091, 0.723291}, {0.13461, 0.662903}, {0.118776, 0.72288}, 
-{0.145589, 0.663366}, {0.134996, 0.629075}, {0.151654, 0.632414}, 
-{0.14063, 0.624503}, {0.159431, 0.620941}, {0.144346, 0.618135}, 
-{0.145045, 0.607867}, {0.168964, 0.598727}, {0.571176, 0.848933}, 
-{0.565531, 0.868135}, {0.557688, 0.85584}, {0.572396, 0.860809}, 
-{0.5719, 0.874717}, {0.583032, 0.860809}, {0.582168, 0.874438}, 
-{0.099419, 0.8664}, {0.095737, 0.856734}, {0.105053, 0.859298}, 
-{0.959395, 0.848739}, {0.928572, 0.869127}, {0.930084, 0.845208}, 
-{0.960222, 0.872699}, {0.943713, 0.839203}, {0.948093, 0.87986}, 
-{0.634134, 0.846868}, {0.628489, 0.866071}, {0.620646, 0.853775}, 
-{0.635354, 0.858745}, {0.634858, 0.872652}, {0.64599, 0.858745}, 
-{0.645126, 0.872373}, {0.115011, 0.866683}, {0.111328, 0.857017}, 
-{0.120645, 0.859581}, {0.984099, 0.79996}, {0.953276, 0.820348}, 
-{0.954788, 0.796429}, {0.984926, 0.823921}, {0.968417, 0.790425}, 
-{0.972797, 0.831081}, {0.543007, 0.752189}, {0.562449, 0.750688}, 
-{0.561212, 0.776548}, {0.543007, 0.734283}, {0.562791, 0.733565}, 
-{0.543007, 0.720795}, {0.564748, 0.724693}, {0.560993, 0.720168}, 
-{0.543007, 0.714694}, {0.580827, 0.706802}, {0.558266, 0.71364}, 
-{0.574425, 0.724617}, {0.543007, 0.707124}, {0.55641, 0.707299}, 
-{0.543007, 0.690769}, {0.573163, 0.704913}, {0.556424, 0.691047}, 
-{0.572841, 0.693673}, {0.543007, 0.67983}, {0.58547, 0.689474}, 
-{0.555233, 0.680187}, {0.587113, 0.696808}, {0.565359, 0.667985}, 
-{0.571072, 0.685551}, {0.592212, 0.682771}, {0.592306, 0.704251}, 
-{0.543007, 0.657494}, {0.5755, 0.673154}, {0.596671, 0.68793}, 
-{0.556756, 0.658298}, {0.581996, 0.668606}, {0.597884, 0.675312}, 
-{0.600984, 0.69021}, {0.543007, 0.648514}, {0.575634, 0.658303}, 
-{0.602379, 0.677421}, {0.593088, 0.673359}, {0.555922, 0.649524}, 
-{0.570999, 0.652846}, {0.600096, 0.665975}, {0.590533, 0.651392}, 
-{0.543007, 0.631372}, {0.551333, 0.632103}, {0.543007, 0.61553}, 
-{0.549753, 0.615924}, {0.543007, 0.598727}, {0.549758, 0.599554}, 
-{0.55901, 0.605215}, {0.560429, 0.609161}, {0.422683, 0.784736}, 
-{0.400218, 0.823579}, {0.404497, 0.785536}, {0.395875, 0.757879}, 
-{0.214444, 0.677673}, {0.222083, 0.719592}, {0.20298, 0.710443}, 
-{0.20298, 0.723803}, {0.20298, 0.676457}, {0.219174, 0.642718}, 
-{0.20298, 0.641925}, {0.20298, 0.604114}, {0.224726, 0.598727}, 
-{0.054263, 0.602941}, {0.053528, 0.617502}, {0.03516, 0.618952}, 
-{0.053528, 0.632245}, {0.03516, 0.633832}, {0.054377, 0.654546}, 
-{0.03516, 0.654777}, {0.03516, 0.686279}, {0.052343, 0.685157}, 
-{0.03516, 0.701111}, {0.051417, 0.702461}, {0.045916, 0.718071}, 
-{0.056318, 0.712887}, {0.03516, 0.719013}, {0.045407, 0.723311}, 
-{0.03516, 0.725339}, {0.745926, 0.950143}, {0.760349, 0.954961}, 
-{0.751241, 0.977859}, {0.735536, 0.969613}, {0.737976, 0.942992}, 
-{0.504519, 0.85611}, {0.511054, 0.855838}, {0.511269, 0.862414}, 
-{0.504519, 0.842096}, {0.517704, 0.855274}, {0.504519, 0.863603}, 
-{0.512389, 0.842141}, {0.517271, 0.853149}, {0.515953, 0.850592}, 
-{0.519004, 0.841826}, {0.520074, 0.848176}, {0.721373, 0.900856}, 
-{0.729401, 0.924971}, {0.713798, 0.932999}, {0.728875, 0.934926}, 
-{0.475869, 0.855604}, {0.476693, 0.863475}, {0.46679, 0.863475}, 
-{0.473442, 0.84899}, {0.463649, 0.841826}, {0.438992, 0.849219}, 
-{0.439136, 0.836311}, {0.442132, 0.82757}, {0.432885, 0.849219}, 
-{0.43511, 0.838972}, {0.435087, 0.83941}, {0.049252, 0.868746}, 
-{0.049048, 0.878554}, {0.045064, 0.878554}, {0.045703, 0.868308}, 
-{0.049869, 0.865647}, {0.060533, 0.847007}, {0.075849, 0.845238}, 
-{0.074713, 0.861655}, {0.63096, 0.831812}, {0.645615, 0.830696}, 
-{0.650948, 0.842877}, {0.626185, 0.820475}, {0.621954, 0.827277}, 
-{0.645958, 0.812005}, {0.625319, 0.837215}, {0.622034, 0.817731}, 
-{0.63177, 0.801387}, {0.633134, 0.836474}, {0.644037, 0.792171}, 
-{0.628311, 0.800118}, {0.639266, 0.789531}, {0.355478, 0.829284}, 
-{0.3634, 0.847099}, {0.357983, 0.849272}, {0.343262, 0.765794}, 
-{0.335746, 0.790201}, {0.317566, 0.790643}, {0.311674, 0.80032}, 
-{0.339655, 0.74688}, {0.31978, 0.778462}, {0.319672, 0.759771}, 
-{0.321601, 0.733004}, {0.31438, 0.739937}, {0.311433, 0.732906}, 
-{0.306224, 0.737297}, {0.46214, 0.813428}, {0.465746, 0.794514}, 
-{0.471249, 0.79613}, {0.484986, 0.785798}, {0.468109, 0.812612}, 
-{0.482721, 0.796614}, {0.4838, 0.780638}, {0.469655, 0.837835}, 
-{0.493336, 0.784849}, {0.48041, 0.816938}, {0.473454, 0.821884}, 
-{0.497204, 0.795518}, {0.493968, 0.780539}, {0.499178, 0.784931}, 
-{0.486291, 0.822676}, {0.491318, 0.81313}, {0.476641, 0.836622}, 
-{0.493238, 0.832614}, {0.407571, 0.846866}, {0.392834, 0.850338}, 
-{0.391621, 0.829284}, {0.27871, 0.732906}, {0.276126, 0.77657}, 
-{0.271162, 0.776824}, {0.267244, 0.810311}, {0.725498, 0.822958}, 
-{0.717986, 0.822224}, {0.717986, 0.784837}, {0.723757, 0.785095}, 
-{0.717986, 0.741465}, {0.722567, 0.741775}, {0.717986, 0.702953}, 
-{0.722567, 0.703115}, {0.717986, 0.66655}, {0.725498, 0.666561}, 
-{0.717986, 0.626447}, {0.73387, 0.626458}, {0.717986, 0.598727}, 
-{0.742735, 0.615784}, {0.773437, 0.598727}, {0.747982, 0.643514}, 
-{0.770514, 0.619155}, {0.774468, 0.634021}, {0.753093, 0.683679}, 
-{0.742763, 0.683618}, {0.748875, 0.720305}, {0.742763, 0.720171}, 
-{0.748875, 0.758817}, {0.742763, 0.758831}, {0.75001, 0.802188}, 
-{0.742763, 0.802151}, {0.740006, 0.840014}, {0.752799, 0.839575}, 
-{0.87598, 0.961573}, {0.881158, 0.962834}, {0.879116, 0.972246}, 
-{0.884651, 0.940867}, {0.872572, 0.972727}, {0.875779, 0.978949}, 
-{0.866563, 0.97904}, {0.140453, 0.836319}, {0.153883, 0.84381}, 
-{0.150223, 0.853026}, {0.137595, 0.847889}, {0.568618, 0.792114}, 
-{0.565222, 0.797777}, {0.551792, 0.79583}, {0.574709, 0.801103}, 
-{0.556179, 0.788355}, {0.569302, 0.784767}, {0.569914, 0.80409}, 
-{0.556919, 0.78054}, {0.577819, 0.796915}, {0.575777, 0.809894}, 
-{0.580231, 0.80899}, {0.570463, 0.815244}, {0.577131, 0.822229}, 
-{0.573651, 0.818552}, {0.566625, 0.83595}, {0.70481, 0.852849}, 
-{0.70258, 0.840774}, {0.708601, 0.84099}, {0.704951, 0.826949}, 
-{0.711481, 0.853779}, {0.696014, 0.828625}, {0.710956, 0.865225}, 
-{0.706428, 0.866088}, {0.712539, 0.879808}, {0.819886, 0.943895}, 
-{0.828823, 0.942992}, {0.836205, 0.955374}, {0.825918, 0.959874}, 
-{0.830859, 0.975208}, {0.820602, 0.963039}, {0.824235, 0.977935}, 
-{0.153094, 0.832328}, {0.141722, 0.789731}, {0.159187, 0.792174}, 
-{0.118107, 0.809697}, {0.138133, 0.747108}, {0.090086, 0.775152}, 
-{0.091795, 0.751224}, {0.089338, 0.79412}, {0.095358, 0.731496}, 
-{0.064813, 0.78124}, {0.064553, 0.753003}, {0.105541, 0.836319}, 
-{0.104442, 0.850729}, {0.098578, 0.849081}, {0.109036, 0.836929}, 
-{0.10076, 0.836436}, {0.108783, 0.852742}, {0.023075, 0.867431}, 
-{0.024308, 0.880075}, {0.017779, 0.880978}, {0.01833, 0.867926}, 
-{0.021218, 0.865244}, {0.239988, 0.853375}, {0.238732, 0.840324}, 
-{0.244122, 0.837729}, {0.24486, 0.853059}, {0.242939, 0.856057}, 
-{0.270708, 0.840727}, {0.271836, 0.856057}, {0.264483, 0.856222}, 
-{0.265583, 0.840408}, {0.267225, 0.837729}, {0.163004, 0.862202}, 
-{0.15996, 0.866983}, {0.158103, 0.86274}, {0.159746, 0.858707}, 
-{0.680548, 0.849977}, {0.681412, 0.865621}, {0.675091, 0.866601}, 
-{0.683635, 0.848861}, {0.672092, 0.872893}, {0.675468, 0.850121}, 
-{0.679046, 0.846868}, {0.685924, 0.864244}, {0.682587, 0.871143}, 
-{0.335285, 0.807564}, {0.334337, 0.824044}, {0.327388, 0.823118}, 
-{0.329369, 0.806377}, {0.333273, 0.804311}, {0.219293, 0.838435}, 
-{0.220334, 0.855176}, {0.213744, 0.852771}, {0.214148, 0.837729}, 
-{0.209045, 0.853744}, {0.031895, 0.845238}, {0.032945, 0.860621}, 
-{0.028333, 0.861253}, {0.068451, 0.867683}, {0.074743, 0.865647}, 
-{0.070551, 0.876488}, {0.182571, 0.866666}, {0.181491, 0.861521}, 
-{0.186476, 0.863297}, {0.186103, 0.858707}, {0.664188, 0.367804}, 
-{0.623058, 0.312166}, {0.659092, 0.310917}, {0.626915, 0.368605}, 
-{0.640139, 0.288727}, {0.706166, 0.376973}, {0.624599, 0.436059}, 
-{0.59841, 0.313227}, {0.652826, 0.2668}, {0.620964, 0.295496}, 
-{0.701349, 0.31221}, {0.656972, 0.434598}, {0.591006, 0.432818}, 
-{0.588939, 0.374339}, {0.63658, 0.269166}, {0.703821, 0.268352}, 
-{0.739742, 0.381997}, {0.704053, 0.43873}, {0.645705, 0.494802}, 
-{0.680335, 0.486434}, {0.596287, 0.296685}, {0.585925, 0.313824}, 
-{0.656076, 0.240372}, {0.693398, 0.216637}, {0.618729, 0.269471}, 
-{0.735641, 0.273316}, {0.738508, 0.317242}, {0.705795, 0.480216}, 
-{0.622119, 0.494787}, {0.569023, 0.429602}, {0.598093, 0.28202}, 
-{0.565935, 0.375679}, {0.637334, 0.243331}, {0.726045, 0.222532}, 
-{0.774139, 0.38513}, {0.738128, 0.443647}, {0.679165, 0.496714}, 
-{0.635644, 0.509708}, {0.599695, 0.479026}, {0.711626, 0.508476}, 
-{0.583877, 0.294758}, {0.641656, 0.223438}, {0.729516, 0.209628}, 
-{0.600478, 0.274101}, {0.620816, 0.243488}, {0.7811, 0.241131}, 
-{0.769123, 0.277467}, {0.76879, 0.325311}, {0.744579, 0.47638}, 
-{0.609408, 0.511569}, {0.593882, 0.494527}, {0.743286, 0.510918}, 
-{0.655405, 0.204647}, {0.627145, 0.231975}, {0.779065, 0.222066}, 
-{0.690674, 0.204296}, {0.572596, 0.273481}, {0.784506, 0.449297}, 
-{0.774286, 0.467074}, {0.709906, 0.539206}, {0.646603, 0.530597}, 
-{0.603614, 0.527543}, {0.583626, 0.468268}, {0.755522, 0.534802}, 
-{0.620851, 0.205955}, {0.786926, 0.182058}, {0.57818, 0.25093}, 
-{0.567943, 0.280552}, {0.602579, 0.249107}, {0.619212, 0.233421}, 
-{0.682726, 0.534931}, {0.574009, 0.497262}, {0.787621, 0.536664}, 
-{0.63557, 0.179039}, {0.61704, 0.232975}, {0.663816, 0.190724}, 
-{0.799783, 0.186542}, {0.748644, 0.175716}, {0.549384, 0.250941}, 
-{0.548963, 0.267955}, {0.778494, 0.503308}, {0.765987, 0.571233}, 
-{0.704444, 0.571917}, {0.676853, 0.563994}, {0.600339, 0.55309}, 
-{0.592103, 0.521769}, {0.784039, 0.578437}, {0.591579, 0.196431}, 
-{0.593691, 0.214457}, {0.811281, 0.157699}, {0.691473, 0.198499}, 
-{0.799511, 0.156199}, {0.573856, 0.24415}, {0.547989, 0.273935}, 
-{0.602181, 0.238384}, {0.639117, 0.560066}, {0.574467, 0.543153}, 
-{0.572375, 0.525332}, {0.670525, 0.154014}, {0.602799, 0.237354}, 
-{0.709383, 0.168404}, {0.767911, 0.145661}, {0.521734, 0.253247}, 
-{0.550002, 0.244859}, {0.519988, 0.262767}, {0.751157, 0.592105}, 
-{0.701692, 0.589186}, {0.670276, 0.582299}, {0.581278, 0.561562}, 
-{0.577987, 0.222702}, {0.682539, 0.162378}, {0.77261, 0.133717}, 
-{0.519488, 0.268566}, {0.768092, 0.594736}, {0.561059, 0.550334}, 
-{0.6057, 0.571198}, {0.712444, 0.13271}, {0.730404, 0.138215}, 
-{0.813541, 0.139075}, {0.492989, 0.243558}, {0.489483, 0.255413}, 
-{0.565916, 0.568391}, {0.635877, 0.571755}, {0.590336, 0.575204}, 
-{0.7375, 0.125548}, {0.7975, 0.126521}, {0.486177, 0.268102}, 
-{0.538286, 0.556009}, {0.720314, 0.118149}, {0.773695, 0.125102}, 
-{0.821572, 0.130204}, {0.482385, 0.235376}, {0.48164, 0.258785}, 
-{0.571132, 0.58428}, {0.536438, 0.571462}, {0.74239, 0.117473}, 
-{0.804485, 0.105467}, {0.475995, 0.251894}, {0.508614, 0.55592}, 
-{0.724545, 0.103406}, {0.77741, 0.110617}, {0.477082, 0.233148}, 
-{0.534079, 0.57748}, {0.506766, 0.566223}, {0.747593, 0.101138}, 
-{0.790502, 0.083889}, {0.454843, 0.226879}, {0.492989, 0.553419}, 
-{0.738138, 0.07899}, {0.759719, 0.077593}, {0.803591, 0.081335}, 
-{0.454344, 0.25084}, {0.503163, 0.575013}, {0.494009, 0.547317}, 
-{0.489483, 0.563654}, {0.724984, 0.081105}, {0.78088, 0.071223}, 
-{0.794619, 0.079918}, {0.818183, 0.091061}, {0.474775, 0.260375}, 
-{0.483404, 0.537598}, {0.482385, 0.543617}, {0.732869, 0.050494}, 
-{0.740465, 0.049988}, {0.788665, 0.075314}, {0.748327, 0.04862}, 
-{0.797754, 0.073741}, {0.82193, 0.097022}, {0.81316, 0.078664}, 
-{0.464139, 0.260375}, {0.486177, 0.576343}, {0.475995, 0.560135}, 
-{0.786877, 0.066753}, {0.764551, 0.042673}, {0.793879, 0.072375}, 
-{0.808511, 0.074117}, {0.8335, 0.099183}, {0.821083, 0.104497}, 
-{0.48164, 0.567026}, {0.477082, 0.541388}, {0.733712, 0.033191}, 
-{0.74365, 0.031893}, {0.788666, 0.05956}, {0.791945, 0.067036}, 
-{0.797395, 0.067505}, {0.801938, 0.071367}, {0.454843, 0.53512}, 
-{0.794513, 0.062845}, {0.75969, 0.027465}, {0.807193, 0.063814}, 
-{0.454344, 0.55908}, {0.736281, 0.022765}, {0.798734, 0.062623}, 
-{0.753301, 0.015305}, {0.782469, 0.037614}, {0.802184, 0.065909}, 
-{0.474775, 0.568616}, {0.739704, 0.019363}, {0.798621, 0.058357}, 
-{0.760401, 0.014671}, {0.796694, 0.055034}, {0.769099, 0.021434}, 
-{0.464139, 0.568616}, {0.735527, 0.012341}, {0.751644, 0.008783}, 
-{0.748119, 0.011345}, {0.732176, 0.017581}, {0.758565, 0.010725}, 
-{0.74667, 0.006784}, {0.753769, 0.005597}, {0.740321, 0.00957}, 
-{0.760909, 0.005064}, {0.749086, 0.003879}, {0.754333, 0.001954}, 
-{0.033963, 0.140723}, {0.062267, 0.140241}, {0.062267, 0.199369}, 
-{0.062267, 0.095845}, {0.038426, 0.200543}, {0.026336, 0.092879}, 
-{0.062267, 0.257752}, {0.062267, 0.059281}, {0.030755, 0.264709}, 
-{0.042254, 0.056543}, {0.035724, 0.316595}, {0.062267, 0.041616}, 
-{0.012865, 0.318721}, {0.062267, 0.31599}, {0.041352, 0.037479}, 
-{0.02519, 0.352077}, {0.001992, 0.282487}, {0.062267, 0.001954}, 
-{0.062267, 0.349477}, {0.028254, 0.393849}, {0.054756, 0.392956}, 
-{0.062267, 0.393395}, {0.035706, 0.410148}, {0.062267, 0.430782}, 
-{0.056496, 0.430819}, {0.057686, 0.474139}, {0.062267, 0.474154}, 
-{0.057686, 0.512799}, {0.062267, 0.512666}, {0.054756, 0.549353}, 
-{0.062267, 0.549291}, {0.046383, 0.589456}, {0.062267, 0.598949}, 
-{0.963861, 0.60277}, {0.998008, 0.599025}, {0.998008, 0.665517}, 
-{0.950863, 0.548847}, {0.972298, 0.664626}, {0.998008, 0.549836}, 
-{0.971379, 0.683692}, {0.977182, 0.510843}, {0.998008, 0.705904}, 
-{0.958615, 0.510181}, {0.998008, 0.509667}, {0.958349, 0.697811}, 
-{0.964643, 0.489906}, {0.998008, 0.479217}, {0.956381, 0.681764}, 
-{0.960425, 0.729125}, {0.975484, 0.491492}, {0.952869, 0.481187}, 
-{0.935117, 0.69643}, {0.974115, 0.755747}, {0.960841, 0.479412}, 
-{0.98034, 0.479286}, {0.998008, 0.7642}, {0.951746, 0.453117}, 
-{0.973627, 0.487362}, {0.998008, 0.453144}, {0.976262, 0.782019}, 
-{0.9597, 0.45154}, {0.966679, 0.486907}, {0.975659, 0.480773}, 
-{0.979151, 0.453065}, {0.998008, 0.786434}, {0.964192, 0.438991}, 
-{0.968725, 0.459059}, {0.969549, 0.471928}, {0.976853, 0.439846}, 
-{0.966547, 0.443315}, {0.957754, 0.410342}, {0.96395, 0.450667}, 
-{0.969165, 0.476074}, {0.998008, 0.419526}, {0.974155, 0.451016}, 
-{0.971937, 0.444486}, {0.974236, 0.419675}, {0.968291, 0.454348}, 
-{0.976219, 0.400076}, {0.964267, 0.480586}, {0.998008, 0.39619}, 
-{0.884101, 0.533638}, {0.880281, 0.568037}, {0.857919, 0.564797}, 
-{0.895483, 0.530706}, {0.85786, 0.603575}, {0.896829, 0.502222}, 
-{0.889511, 0.568037}, {0.908253, 0.514147}, {0.888475, 0.597276}, 
-{0.928982, 0.497211}, {0.908252, 0.547423}, {0.872825, 0.598213}, 
-{0.928982, 0.464154}, {0.928982, 0.512415}, {0.892794, 0.57086}, 
-{0.887716, 0.616118}, {0.893807, 0.452757}, {0.908729, 0.57006}, 
-{0.928982, 0.547784}, {0.874512, 0.613577}, {0.928982, 0.438826}, 
-{0.90854, 0.596831}, {0.882212, 0.634127}, {0.902421, 0.435821}, 
-{0.928982, 0.570303}, {0.888728, 0.615927}, {0.872679, 0.632782}, 
-{0.928982, 0.427506}, {0.928982, 0.598207}, {0.907193, 0.619874}, 
-{0.877467, 0.670216}, {0.921471, 0.41414}, {0.873108, 0.669834}, 
-{0.928982, 0.417232}, {0.928982, 0.621259}, {0.869689, 0.700751}, 
-{0.876906, 0.698224}, {0.875901, 0.714364}, {0.414322, 0.680995}, 
-{0.420588, 0.700364}, {0.406579, 0.704942}, {0.403436, 0.718351}, 
-{0.407165, 0.68217}, {0.422246, 0.716381}, {0.408527, 0.652077}, 
-{0.41869, 0.737279}, {0.416148, 0.649574}, {0.402118, 0.652498}, 
-{0.396602, 0.747498}, {0.403523, 0.637893}, {0.408088, 0.753292}, 
-{0.415143, 0.633434}, {0.424697, 0.753887}, {0.400167, 0.627288}, 
-{0.416485, 0.621961}, {0.395193, 0.620966}, {0.396293, 0.599747}, 
-{0.384164, 0.598727}, {0.415815, 0.599747}, {0.169684, 0.854681}, 
-{0.160018, 0.854715}, {0.163514, 0.837729}, {0.292716, 0.626735}, 
-{0.285246, 0.627616}, {0.283287, 0.598727}, {0.301378, 0.662824}, 
-{0.271595, 0.630149}, {0.282726, 0.653537}, {0.264932, 0.649518}, 
-{0.274875, 0.671894}, {0.254433, 0.665535}, {0.289977, 0.680833}, 
-{0.237768, 0.686433}, {0.26301, 0.690734}, {0.284212, 0.699675}, 
-{0.25023, 0.70985}, {0.285958, 0.728914}, {0.230862, 0.703041}, 
-{0.821581, 0.939}, {0.785666, 0.935785}, {0.8163, 0.889577}, 
-{0.27885, 0.814302}, {0.289529, 0.830442}, {0.277971, 0.832946}, 
-{0.907741, 0.765654}, {0.88873, 0.752042}, {0.905388, 0.748703}, 
-{0.899754, 0.744131}, {0.880953, 0.740569}, {0.896037, 0.737763}, 
-{0.895339, 0.727494}, {0.87142, 0.718355}, {0.6296, 0.760924}, 
-{0.620705, 0.771029}, {0.619114, 0.763096}, {0.618531, 0.78554}, 
-{0.621254, 0.746065}, {0.637558, 0.746683}, {0.643767, 0.732261}, 
-{0.629838, 0.71774}, {0.644953, 0.724311}, {0.646105, 0.698821}, 
-{0.632409, 0.693885}, {0.639442, 0.664386}, {0.632633, 0.666903}, 
-{0.620474, 0.693267}, {0.639494, 0.633434}, {0.619544, 0.722064}, 
-{0.625454, 0.665618}, {0.629379, 0.637893}, {0.623162, 0.627288}, 
-{0.619978, 0.636873}, {0.640836, 0.621961}, {0.614139, 0.626268}, 
-{0.619543, 0.620966}, {0.620643, 0.599747}, {0.608514, 0.598727}, 
-{0.640165, 0.599747}, {0.03776, 0.759479}, {0.03337, 0.72933}, 
-{0.056602, 0.747407}, {0.041511, 0.779434}, {0.056927, 0.777495}, 
-{0.043372, 0.807935}, {0.051018, 0.807384}, {0.043511, 0.841246}, 
-{0.053177, 0.841212}, {0.081326, 0.727504}, {0.082157, 0.702014}, 
-{0.100876, 0.697006}, {0.096808, 0.667116}, {0.112641, 0.727094}, 
-{0.085828, 0.66758}, {0.096422, 0.633289}, {0.079764, 0.636627}, 
-{0.090787, 0.628717}, {0.071987, 0.625154}, {0.087071, 0.622349}, 
-{0.086373, 0.61208}, {0.062453, 0.602941}, {0.589167, 0.86781}, 
-{0.59701, 0.855515}, {0.602655, 0.874717}, {0.603875, 0.862841}, 
-{0.603379, 0.848933}, {0.614511, 0.862841}, {0.613647, 0.849212}, 
-{0.136236, 0.86412}, {0.12692, 0.866683}, {0.130602, 0.857017}, 
-{0.920924, 0.845208}, {0.922437, 0.869127}, {0.891614, 0.848739}, 
-{0.890786, 0.872699}, {0.907295, 0.839203}, {0.902915, 0.87986}, 
-{0.526209, 0.860703}, {0.534053, 0.848408}, {0.539698, 0.86761}, 
-{0.540918, 0.855734}, {0.540421, 0.841826}, {0.551553, 0.855734}, 
-{0.550689, 0.842105}, {0.151828, 0.864119}, {0.142512, 0.866683}, 
-{0.146194, 0.857017}, {0.996496, 0.841077}, {0.998008, 0.864996}, 
-{0.967185, 0.844608}, {0.966358, 0.868569}, {0.982867, 0.835073}, 
-{0.978486, 0.875729}, {0.518668, 0.776548}, {0.517431, 0.750688}, 
-{0.536872, 0.752189}, {0.536872, 0.734283}, {0.517089, 0.733565}, 
-{0.536872, 0.720795}, {0.515132, 0.724693}, {0.518886, 0.720168}, 
-{0.499052, 0.706802}, {0.536872, 0.714694}, {0.505455, 0.724617}, 
-{0.521614, 0.71364}, {0.536872, 0.707124}, {0.523469, 0.707299}, 
-{0.506717, 0.704913}, {0.536872, 0.690769}, {0.507038, 0.693673}, 
-{0.523456, 0.691047}, {0.49441, 0.689474}, {0.536872, 0.67983}, 
-{0.492767, 0.696808}, {0.524647, 0.680187}, {0.487573, 0.704251}, 
-{0.487668, 0.682771}, {0.508808, 0.685551}, {0.514521, 0.667985}, 
-{0.483209, 0.68793}, {0.50438, 0.673154}, {0.536872, 0.657494}, 
-{0.478896, 0.69021}, {0.481996, 0.675312}, {0.497884, 0.668606}, 
-{0.523124, 0.658298}, {0.4775, 0.677421}, {0.486792, 0.673359}, 
-{0.504246, 0.658303}, {0.536872, 0.648514}, {0.479783, 0.665975}, 
-{0.489347, 0.651392}, {0.50888, 0.652846}, {0.523957, 0.649524}, 
-{0.536872, 0.631372}, {0.528546, 0.632103}, {0.536872, 0.61553}, 
-{0.530126, 0.615924}, {0.536872, 0.598727}, {0.530122, 0.599554}, 
-{0.52087, 0.605215}, {0.519451, 0.609161}, {0.447194, 0.785536}, 
-{0.451473, 0.823579}, {0.429008, 0.784736}, {0.455815, 0.757879}, 
-{0.196845, 0.710443}, {0.177743, 0.719592}, {0.185381, 0.677673}, 
-{0.196845, 0.723803}, {0.196845, 0.676457}, {0.180652, 0.642718}, 
-{0.196845, 0.641925}, {0.196845, 0.604114}, {0.175099, 0.598727}, 
-{0.029025, 0.618952}, {0.010657, 0.617502}, {0.009923, 0.602941}, 
-{0.010657, 0.632245}, {0.029025, 0.633832}, {0.009808, 0.654546}, 
-{0.029025, 0.654777}, {0.029025, 0.686279}, {0.011842, 0.685157}, 
-{0.029025, 0.701111}, {0.012769, 0.702461}, {0.018269, 0.718071}, 
-{0.007867, 0.712887}, {0.029025, 0.719013}, {0.018779, 0.723311}, 
-{0.029025, 0.725339}, {0.782189, 0.942992}, {0.791297, 0.965889}, 
-{0.776875, 0.970707}, {0.766484, 0.951237}, {0.768925, 0.977859}, 
-{0.491633, 0.862414}, {0.491849, 0.855838}, {0.498384, 0.85611}, 
-{0.485199, 0.855274}, {0.498384, 0.842096}, {0.498384, 0.863603}, 
-{0.485632, 0.853149}, {0.490513, 0.842141}, {0.48695, 0.850592}, 
-{0.483899, 0.841826}, {0.482829, 0.848176}, {0.707663, 0.915942}, 
-{0.69206, 0.907914}, {0.700087, 0.8838}, {0.692585, 0.91787}, 
-{0.416847, 0.82757}, {0.42675, 0.82757}, {0.425926, 0.835441}, 
-{0.423499, 0.842055}, {0.413706, 0.849219}, {0.457514, 0.849219}, 
-{0.454518, 0.840478}, {0.454374, 0.82757}, {0.450492, 0.837817}, 
-{0.448267, 0.82757}, {0.450469, 0.837379}, {0.056758, 0.865647}, 
-{0.060741, 0.865647}, {0.060945, 0.875455}, {0.057396, 0.875893}, 
-{0.061563, 0.878554}, {0.053261, 0.845238}, {0.054397, 0.861655}, 
-{0.039081, 0.859886}, {0.687979, 0.789531}, {0.682645, 0.801712}, 
-{0.66799, 0.800595}, {0.663215, 0.811932}, {0.658984, 0.805131}, 
-{0.682988, 0.820402}, {0.662349, 0.795193}, {0.659064, 0.814677}, 
-{0.6688, 0.831021}, {0.670164, 0.795933}, {0.681067, 0.840237}, 
-{0.665341, 0.83229}, {0.676296, 0.842877}, {0.343925, 0.829284}, 
-{0.349342, 0.831458}, {0.34142, 0.849272}, {0.362392, 0.767556}, 
-{0.380572, 0.767998}, {0.388087, 0.792405}, {0.3565, 0.757879}, 
-{0.384481, 0.811318}, {0.364606, 0.779737}, {0.364498, 0.798427}, 
-{0.366427, 0.825195}, {0.359206, 0.818262}, {0.356259, 0.825293}, 
-{0.351049, 0.820902}, {0.516075, 0.822244}, {0.510572, 0.82386}, 
-{0.506966, 0.804946}, {0.529811, 0.832576}, {0.512935, 0.805762}, 
-{0.527547, 0.82176}, {0.528626, 0.837736}, {0.514481, 0.780539}, 
-{0.538162, 0.833525}, {0.518279, 0.79649}, {0.525236, 0.801436}, 
-{0.54203, 0.822856}, {0.538794, 0.837835}, {0.544004, 0.833443}, 
-{0.531117, 0.795698}, {0.536144, 0.805244}, {0.521467, 0.781752}, 
-{0.538064, 0.78576}, {0.385486, 0.829284}, {0.384273, 0.850338}, 
-{0.369535, 0.846866}, {0.290652, 0.766392}, {0.295616, 0.766646}, 
-{0.298199, 0.810311}, {0.286734, 0.732906}, {0.711851, 0.784837}, 
-{0.711851, 0.822224}, {0.704339, 0.822958}, {0.70608, 0.785095}, 
-{0.711851, 0.741465}, {0.707269, 0.741775}, {0.711851, 0.702953}, 
-{0.707269, 0.703115}, {0.711851, 0.66655}, {0.704339, 0.666561}, 
-{0.711851, 0.626447}, {0.695967, 0.626458}, {0.711851, 0.598727}, 
-{0.919543, 0.790425}, {0.944999, 0.835212}, {0.914297, 0.818155}, 
-{0.942076, 0.814784}, {0.946029, 0.799918}, {0.854893, 0.947661}, 
-{0.856935, 0.957073}, {0.851757, 0.958334}, {0.860428, 0.97904}, 
-{0.848349, 0.947179}, {0.851556, 0.940958}, {0.84234, 0.940867}, 
-{0.118831, 0.853026}, {0.115172, 0.84381}, {0.128602, 0.836319}, 
-{0.13146, 0.847889}, {0.615313, 0.804821}, {0.601882, 0.806769}, 
-{0.598486, 0.801105}, {0.592395, 0.810094}, {0.610925, 0.797346}, 
-{0.597802, 0.793758}, {0.59719, 0.813081}, {0.610185, 0.789531}, 
-{0.589285, 0.805906}, {0.591327, 0.818886}, {0.586873, 0.817981}, 
-{0.596641, 0.824236}, {0.589973, 0.831221}, {0.593453, 0.827543}, 
-{0.600479, 0.844941}, {0.731989, 0.882824}, {0.725968, 0.883041}, 
-{0.728197, 0.870966}, {0.728338, 0.896865}, {0.734868, 0.870035}, 
-{0.719401, 0.895189}, {0.734344, 0.858589}, {0.729815, 0.857726}, 
-{0.735926, 0.844006}, {0.813751, 0.965553}, {0.806369, 0.977935}, 
-{0.797433, 0.977032}, {0.803464, 0.961052}, {0.798149, 0.957888}, 
-{0.808405, 0.945719}, {0.801782, 0.942992}, {0.165899, 0.793584}, 
-{0.183364, 0.791141}, {0.171992, 0.833738}, {0.186952, 0.748517}, 
-{0.206978, 0.811107}, {0.23329, 0.752634}, {0.235, 0.776562}, 
-{0.229728, 0.732906}, {0.235748, 0.79553}, {0.260532, 0.754413}, 
-{0.260273, 0.78265}, {0.092443, 0.849081}, {0.086579, 0.850729}, 
-{0.085479, 0.836319}, {0.081984, 0.836929}, {0.09026, 0.836436}, 
-{0.082238, 0.852742}, {0.037951, 0.88138}, {0.031421, 0.880477}, 
-{0.032655, 0.867833}, {0.037399, 0.868328}, {0.034512, 0.865647}, 
-{0.227207, 0.837729}, {0.232597, 0.840324}, {0.231341, 0.853375}, 
-{0.226469, 0.853059}, {0.22839, 0.856057}, {0.258348, 0.856222}, 
-{0.250995, 0.856057}, {0.252124, 0.840727}, {0.257249, 0.840408}, 
-{0.255606, 0.837729}, {0.169797, 0.86295}, {0.171653, 0.858707}, 
-{0.174698, 0.863488}, {0.171439, 0.866983}, {0.662959, 0.866601}, 
-{0.656637, 0.865621}, {0.657501, 0.849977}, {0.665957, 0.872893}, 
-{0.654414, 0.848861}, {0.662581, 0.850121}, {0.655463, 0.871143}, 
-{0.659004, 0.846868}, {0.652125, 0.864244}, {0.321253, 0.823118}, 
-{0.314304, 0.824044}, {0.313357, 0.807564}, {0.319273, 0.806377}, 
-{0.315368, 0.804311}, {0.198211, 0.852771}, {0.191621, 0.855176}, 
-{0.192662, 0.838435}, {0.197806, 0.837729}, {0.20291, 0.853744}, 
-{0.022197, 0.861253}, {0.017584, 0.860621}, {0.018635, 0.845238}, 
-{0.084193, 0.856734}, {0.088385, 0.867575}, {0.082094, 0.865539}, 
-{0.193184, 0.863757}, {0.198169, 0.861982}, {0.197089, 0.867126}, 
-{0.193556, 0.859167}, {0.002856, 0.845238}, {0.011449, 0.851257}, 
-{0.005417, 0.861059}, {0.008024, 0.880872}, {0.001992, 0.87107}, 
-{0.010585, 0.865051}, {0.273199, 0.285773}, {0.237165, 0.284524}, 
-{0.278296, 0.228885}, {0.254246, 0.307963}, {0.241022, 0.228085}, 
-{0.320273, 0.219717}, {0.266933, 0.32989}, {0.235071, 0.301193}, 
-{0.238706, 0.160631}, {0.212518, 0.283463}, {0.27108, 0.162092}, 
-{0.315457, 0.28448}, {0.250687, 0.327524}, {0.317928, 0.328338}, 
-{0.205114, 0.163872}, {0.203046, 0.222351}, {0.318161, 0.15796}, 
-{0.353849, 0.214693}, {0.270184, 0.356318}, {0.307505, 0.380052}, 
-{0.232836, 0.327219}, {0.210394, 0.300005}, {0.259812, 0.101888}, 
-{0.294443, 0.110256}, {0.200032, 0.282866}, {0.319903, 0.116474}, 
-{0.349748, 0.323374}, {0.352616, 0.279448}, {0.251441, 0.353359}, 
-{0.340153, 0.374158}, {0.2122, 0.31467}, {0.236226, 0.101903}, 
-{0.183131, 0.167088}, {0.180042, 0.22101}, {0.352236, 0.153043}, 
-{0.388247, 0.21156}, {0.255763, 0.373252}, {0.343624, 0.387062}, 
-{0.234924, 0.353202}, {0.214586, 0.322589}, {0.197985, 0.301932}, 
-{0.293272, 0.099976}, {0.213802, 0.117664}, {0.249751, 0.086982}, 
-{0.325733, 0.088214}, {0.358687, 0.12031}, {0.395208, 0.355559}, 
-{0.383231, 0.319223}, {0.382898, 0.271379}, {0.269512, 0.392043}, 
-{0.241252, 0.364715}, {0.393172, 0.374624}, {0.304781, 0.392394}, 
-{0.186703, 0.323209}, {0.207989, 0.102162}, {0.223515, 0.085121}, 
-{0.357394, 0.085771}, {0.388393, 0.129616}, {0.398614, 0.147393}, 
-{0.234958, 0.390734}, {0.401033, 0.414631}, {0.216687, 0.347583}, 
-{0.23332, 0.363269}, {0.192288, 0.34576}, {0.182051, 0.316137}, 
-{0.324013, 0.057484}, {0.260711, 0.066092}, {0.197733, 0.128422}, 
-{0.217722, 0.069147}, {0.36963, 0.061887}, {0.249677, 0.417651}, 
-{0.231148, 0.363715}, {0.277924, 0.405966}, {0.413891, 0.410148}, 
-{0.362752, 0.420974}, {0.163491, 0.345749}, {0.163071, 0.328735}, 
-{0.296834, 0.061759}, {0.188116, 0.099428}, {0.401728, 0.060026}, 
-{0.392602, 0.093382}, {0.205687, 0.400259}, {0.207799, 0.382233}, 
-{0.425388, 0.438991}, {0.413619, 0.440491}, {0.305581, 0.398191}, 
-{0.187964, 0.35254}, {0.216288, 0.358306}, {0.162096, 0.322755}, 
-{0.380095, 0.025457}, {0.318552, 0.024773}, {0.290961, 0.032696}, 
-{0.214446, 0.0436}, {0.206211, 0.074921}, {0.398146, 0.018253}, 
-{0.284632, 0.442676}, {0.216907, 0.359336}, {0.382019, 0.451029}, 
-{0.32349, 0.428286}, {0.164109, 0.351831}, {0.135841, 0.343443}, 
-{0.134095, 0.333923}, {0.253225, 0.036624}, {0.188575, 0.053537}, 
-{0.186482, 0.071358}, {0.192094, 0.373988}, {0.296647, 0.434312}, 
-{0.386718, 0.462973}, {0.133595, 0.328124}, {0.365264, 0.004585}, 
-{0.315799, 0.007504}, {0.284383, 0.014391}, {0.195385, 0.035127}, 
-{0.326551, 0.463979}, {0.427648, 0.457615}, {0.344511, 0.458475}, 
-{0.107096, 0.353132}, {0.10359, 0.341277}, {0.3822, 0.001954}, 
-{0.175166, 0.046356}, {0.219808, 0.025492}, {0.411607, 0.470169}, 
-{0.351608, 0.471142}, {0.100284, 0.328588}, {0.180024, 0.028299}, 
-{0.249984, 0.024935}, {0.204444, 0.021486}, {0.435679, 0.466486}, 
-{0.387802, 0.471588}, {0.334422, 0.478541}, {0.096492, 0.361313}, 
-{0.095747, 0.337904}, {0.152394, 0.040681}, {0.418593, 0.491223}, 
-{0.356497, 0.479217}, {0.090102, 0.344796}, {0.150545, 0.025228}, 
-{0.185239, 0.01241}, {0.391518, 0.486073}, {0.338652, 0.493283}, 
-{0.091189, 0.363542}, {0.122722, 0.04077}, {0.404609, 0.512801}, 
-{0.3617, 0.495552}, {0.068951, 0.369811}, {0.120873, 0.030467}, 
-{0.148187, 0.01921}, {0.373826, 0.519097}, {0.417699, 0.515355}, 
-{0.352246, 0.5177}, {0.068451, 0.34585}, {0.107096, 0.043271}, 
-{0.394988, 0.525467}, {0.432291, 0.505629}, {0.408726, 0.516772}, 
-{0.339092, 0.515585}, {0.088882, 0.336315}, {0.108116, 0.049373}, 
-{0.10359, 0.033036}, {0.11727, 0.021677}, {0.402773, 0.521376}, 
-{0.362435, 0.54807}, {0.436037, 0.499668}, {0.427267, 0.518026}, 
-{0.411862, 0.522949}, {0.354573, 0.546702}, {0.346977, 0.546196}, 
-{0.078247, 0.336315}, {0.097512, 0.059092}, {0.096492, 0.053073}, 
-{0.400984, 0.529937}, {0.378659, 0.554017}, {0.43519, 0.492193}, 
-{0.447607, 0.497507}, {0.422618, 0.522573}, {0.407987, 0.524315}, 
-{0.090102, 0.036555}, {0.100284, 0.020347}, {0.406053, 0.529654}, 
-{0.402773, 0.53713}, {0.357757, 0.564797}, {0.411502, 0.529185}, 
-{0.416046, 0.525323}, {0.347819, 0.563499}, {0.091189, 0.055302}, 
-{0.095747, 0.029664}, {0.408621, 0.533845}, {0.373798, 0.569224}, 
-{0.421301, 0.532876}, {0.068951, 0.06157}, {0.412842, 0.534067}, 
-{0.350389, 0.573925}, {0.396576, 0.559076}, {0.367409, 0.581385}, 
-{0.416291, 0.530781}, {0.068451, 0.037609}, {0.412729, 0.538333}, 
-{0.353811, 0.577327}, {0.410801, 0.541656}, {0.383207, 0.575256}, 
-{0.374509, 0.582019}, {0.088882, 0.028074}, {0.349634, 0.584349}, 
-{0.365751, 0.587907}, {0.362227, 0.585345}, {0.078247, 0.028074}, 
-{0.346284, 0.579109}, {0.372672, 0.585965}, {0.360778, 0.589906}, 
-{0.367877, 0.591093}, {0.354428, 0.58712}, {0.375017, 0.591626}, 
-{0.363194, 0.592811}, {0.368441, 0.594736}, {0.840236, 0.199369}, 
-{0.840236, 0.140241}, {0.868541, 0.140723}, {0.840236, 0.095845}, 
-{0.864078, 0.200543}, {0.876168, 0.092879}, {0.840236, 0.257752}, 
-{0.840236, 0.059281}, {0.871748, 0.264709}, {0.86025, 0.056543}, 
-{0.86678, 0.316595}, {0.840236, 0.041616}, {0.889639, 0.318721}, 
-{0.840236, 0.31599}, {0.861152, 0.037479}, {0.877314, 0.352077}, 
-{0.900512, 0.282487}, {0.840236, 0.001954}, {0.840236, 0.349477}, 
-{0.87425, 0.393849}, {0.847748, 0.392956}, {0.866798, 0.410148}, 
-{0.840236, 0.393395}, {0.840236, 0.4097}, {0.840236, 0.39369}, 
-{0.90845, 0.271281}, {0.90845, 0.204789}, {0.942596, 0.208534}, 
-{0.955595, 0.154612}, {0.934159, 0.27039}, {0.90845, 0.1556}, 
-{0.935079, 0.289456}, {0.929275, 0.116608}, {0.90845, 0.311669}, 
-{0.90845, 0.115432}, {0.947843, 0.115946}, {0.948108, 0.303575}, 
-{0.90845, 0.084981}, {0.941815, 0.09567}, {0.950077, 0.287529}, 
-{0.946032, 0.33489}, {0.930974, 0.097256}, {0.953589, 0.086952}, 
-{0.97134, 0.302194}, {0.932343, 0.361511}, {0.926118, 0.085051}, 
-{0.945617, 0.085176}, {0.90845, 0.369964}, {0.93283, 0.093127}, 
-{0.90845, 0.058908}, {0.954712, 0.058882}, {0.930196, 0.387783}, 
-{0.939779, 0.092672}, {0.930798, 0.086537}, {0.927307, 0.058829}, 
-{0.946758, 0.057305}, {0.90845, 0.392198}, {0.936909, 0.077693}, 
-{0.929604, 0.045611}, {0.937733, 0.064824}, {0.942266, 0.044755}, 
-{0.937293, 0.081838}, {0.90845, 0.02529}, {0.932303, 0.05678}, 
-{0.942508, 0.056432}, {0.939911, 0.049079}, {0.948704, 0.016106}, 
-{0.932222, 0.025439}, {0.938167, 0.060112}, {0.934521, 0.05025}, 
-{0.942191, 0.086351}, {0.90845, 0.001954}, {0.930239, 0.00584}, 
-{0.851667, 0.736018}, {0.829304, 0.739258}, {0.825484, 0.704859}, 
-{0.851725, 0.774796}, {0.814103, 0.701928}, {0.812756, 0.673443}, 
-{0.820074, 0.739258}, {0.801333, 0.685368}, {0.82111, 0.768497}, 
-{0.801333, 0.718645}, {0.780603, 0.668433}, {0.83676, 0.769435}, 
-{0.816791, 0.742081}, {0.780603, 0.683637}, {0.780603, 0.635375}, 
-{0.82187, 0.78734}, {0.800856, 0.741282}, {0.780603, 0.719006}, 
-{0.815779, 0.623978}, {0.835073, 0.784799}, {0.801045, 0.768052}, 
-{0.780603, 0.610048}, {0.827373, 0.805348}, {0.780603, 0.741525}, 
-{0.820857, 0.787148}, {0.807164, 0.607042}, {0.836906, 0.804003}, 
-{0.802392, 0.791096}, {0.780603, 0.769428}, {0.780603, 0.598727}, 
-{0.832118, 0.841437}, {0.836477, 0.841056}, {0.780603, 0.79248}, 
-{0.839897, 0.871972}, {0.83268, 0.869445}, {0.833684, 0.885585}, 
-{0.44895, 0.704942}, {0.434941, 0.700364}, {0.441207, 0.680995}, 
-{0.452094, 0.718351}, {0.448364, 0.68217}, {0.433284, 0.716381}, 
-{0.447002, 0.652077}, {0.43684, 0.737279}, {0.439381, 0.649574}, 
-{0.453412, 0.652498}, {0.458927, 0.747498}, {0.452006, 0.637893}, 
-{0.447441, 0.753292}, {0.440386, 0.633434}, {0.430832, 0.753887}, 
-{0.455363, 0.627288}, {0.439044, 0.621961}, {0.460337, 0.620966}, 
-{0.459236, 0.599747}, {0.471365, 0.598727}, {0.439715, 0.599747}, 
-{0.181991, 0.837729}, {0.185486, 0.854715}, {0.17582, 0.854681}, 
-{0.325604, 0.598727}, {0.323645, 0.627616}, {0.316175, 0.626735}, 
-{0.337295, 0.630149}, {0.307513, 0.662824}, {0.343958, 0.649518}, 
-{0.326164, 0.653537}, {0.334016, 0.671894}, {0.354457, 0.665535}, 
-{0.318913, 0.680833}, {0.371123, 0.686433}, {0.345881, 0.690734}, 
-{0.324678, 0.699675}, {0.35866, 0.70985}, {0.322932, 0.728914}, 
-{0.378029, 0.703041}, {0.74807, 0.889577}, {0.778704, 0.935785}, 
-{0.742789, 0.939}, {0.307222, 0.832946}, {0.295664, 0.830442}, 
-{0.306343, 0.814302}, {0.830895, 0.919924}, {0.847553, 0.923263}, 
-{0.828543, 0.936876}, {0.83653, 0.915353}, {0.855331, 0.91179}, 
-{0.840246, 0.908984}, {0.840944, 0.898716}, {0.864864, 0.889577}, 
-{0.679232, 0.763096}, {0.67764, 0.771029}, {0.668745, 0.760924}, 
-{0.679815, 0.78554}, {0.677092, 0.746065}, {0.660787, 0.746683}, 
-{0.654578, 0.732261}, {0.668508, 0.71774}, {0.653393, 0.724311}, 
-{0.652241, 0.698821}, {0.665937, 0.693885}, {0.658904, 0.664386}, 
-{0.665713, 0.666903}, {0.658852, 0.633434}, {0.677872, 0.693267}, 
-{0.668966, 0.637893}, {0.678802, 0.722064}, {0.672892, 0.665618}, 
-{0.675184, 0.627288}, {0.678368, 0.636873}, {0.65751, 0.621961}, 
-{0.684207, 0.626268}, {0.678803, 0.620966}, {0.677702, 0.599747}, 
-{0.689831, 0.598727}, {0.658181, 0.599747}, {0.002317, 0.747407}, 
-{0.025549, 0.72933}, {0.021159, 0.759479}, {0.017408, 0.779434}, 
-{0.001992, 0.777495}, {0.015547, 0.807935}, {0.007901, 0.807384}, 
-{0.015408, 0.841246}, {0.005742, 0.841212}, {0.130541, 0.692792}, 
-{0.14926, 0.697801}, {0.150091, 0.723291}, {0.13461, 0.662903}, 
-{0.118776, 0.72288}, {0.145589, 0.663366}, {0.134996, 0.629075}, 
-{0.151654, 0.632414}, {0.14063, 0.624503}, {0.159431, 0.620941}, 
-{0.144346, 0.618135}, {0.145045, 0.607867}, {0.168964, 0.598727}, 
-{0.571176, 0.848933}, {0.565531, 0.868135}, {0.557688, 0.85584}, 
-{0.572396, 0.860809}, {0.5719, 0.874717}, {0.583032, 0.860809}, 
-{0.582168, 0.874438}, {0.099419, 0.8664}, {0.095737, 0.856734}, 
-{0.105053, 0.859298}, {0.959395, 0.848739}, {0.928572, 0.869127}, 
-{0.930084, 0.845208}, {0.960222, 0.872699}, {0.943713, 0.839203}, 
-{0.948093, 0.87986}, {0.634134, 0.846868}, {0.628489, 0.866071}, 
-{0.620646, 0.853775}, {0.635354, 0.858745}, {0.634858, 0.872652}, 
-{0.64599, 0.858745}, {0.645126, 0.872373}, {0.115011, 0.866683}, 
-{0.111328, 0.857017}, {0.120645, 0.859581}, {0.984099, 0.79996}, 
-{0.953276, 0.820348}, {0.954788, 0.796429}, {0.984926, 0.823921}, 
-{0.968417, 0.790425}, {0.972797, 0.831081}, {0.543007, 0.752189}, 
-{0.562449, 0.750688}, {0.561212, 0.776548}, {0.543007, 0.734283}, 
-{0.562791, 0.733565}, {0.543007, 0.720795}, {0.564748, 0.724693}, 
-{0.560993, 0.720168}, {0.543007, 0.714694}, {0.580827, 0.706802}, 
-{0.558266, 0.71364}, {0.574425, 0.724617}, {0.543007, 0.707124}, 
-{0.55641, 0.707299}, {0.543007, 0.690769}, {0.573163, 0.704913}, 
-{0.556424, 0.691047}, {0.572841, 0.693673}, {0.543007, 0.67983}, 
-{0.58547, 0.689474}, {0.555233, 0.680187}, {0.587113, 0.696808}, 
-{0.565359, 0.667985}, {0.571072, 0.685551}, {0.592212, 0.682771}, 
-{0.592306, 0.704251}, {0.543007, 0.657494}, {0.5755, 0.673154}, 
-{0.596671, 0.68793}, {0.556756, 0.658298}, {0.581996, 0.668606}, 
-{0.597884, 0.675312}, {0.600984, 0.69021}, {0.543007, 0.648514}, 
-{0.575634, 0.658303}, {0.602379, 0.677421}, {0.593088, 0.673359}, 
-{0.555922, 0.649524}, {0.570999, 0.652846}, {0.600096, 0.665975}, 
-{0.590533, 0.651392}, {0.543007, 0.631372}, {0.551333, 0.632103}, 
-{0.543007, 0.61553}, {0.549753, 0.615924}, {0.543007, 0.598727}, 
-{0.549758, 0.599554}, {0.55901, 0.605215}, {0.560429, 0.609161}, 
-{0.422683, 0.784736}, {0.400218, 0.823579}, {0.404497, 0.785536}, 
-{0.395875, 0.757879}, {0.214444, 0.677673}, {0.222083, 0.719592}, 
-{0.20298, 0.710443}, {0.20298, 0.723803}, {0.20298, 0.676457}, 
-{0.219174, 0.642718}, {0.20298, 0.641925}, {0.20298, 0.604114}, 
-{0.224726, 0.598727}, {0.054263, 0.602941}, {0.053528, 0.617502}, 
-{0.03516, 0.618952}, {0.053528, 0.632245}, {0.03516, 0.633832}, 
-{0.054377, 0.654546}, {0.03516, 0.654777}, {0.03516, 0.686279}, 
-{0.052343, 0.685157}, {0.03516, 0.701111}, {0.051417, 0.702461}, 
-{0.045916, 0.718071}, {0.056318, 0.712887}, {0.03516, 0.719013}, 
-{0.045407, 0.723311}, {0.03516, 0.725339}, {0.745926, 0.950143}, 
-{0.760349, 0.954961}, {0.751241, 0.977859}, {0.735536, 0.969613}, 
-{0.737976, 0.942992}, {0.504519, 0.85611}, {0.511054, 0.855838}, 
-{0.511269, 0.862414}, {0.504519, 0.842096}, {0.517704, 0.855274}, 
-{0.504519, 0.863603}, {0.512389, 0.842141}, {0.517271, 0.853149}, 
-{0.515953, 0.850592}, {0.519004, 0.841826}, {0.520074, 0.848176}, 
-{0.721373, 0.900856}, {0.729401, 0.924971}, {0.713798, 0.932999}, 
-{0.728875, 0.934926}, {0.475869, 0.855604}, {0.476693, 0.863475}, 
-{0.46679, 0.863475}, {0.473442, 0.84899}, {0.463649, 0.841826}, 
-{0.438992, 0.849219}, {0.439136, 0.836311}, {0.442132, 0.82757}, 
-{0.432885, 0.849219}, {0.43511, 0.838972}, {0.435087, 0.83941}, 
-{0.049252, 0.868746}, {0.049048, 0.878554}, {0.045064, 0.878554}, 
-{0.045703, 0.868308}, {0.049869, 0.865647}, {0.060533, 0.847007}, 
-{0.075849, 0.845238}, {0.074713, 0.861655}, {0.63096, 0.831812}, 
-{0.645615, 0.830696}, {0.650948, 0.842877}, {0.626185, 0.820475}, 
-{0.621954, 0.827277}, {0.645958, 0.812005}, {0.625319, 0.837215}, 
-{0.622034, 0.817731}, {0.63177, 0.801387}, {0.633134, 0.836474}, 
-{0.644037, 0.792171}, {0.628311, 0.800118}, {0.639266, 0.789531}, 
-{0.355478, 0.829284}, {0.3634, 0.847099}, {0.357983, 0.849272}, 
-{0.343262, 0.765794}, {0.335746, 0.790201}, {0.317566, 0.790643}, 
-{0.311674, 0.80032}, {0.339655, 0.74688}, {0.31978, 0.778462}, 
-{0.319672, 0.759771}, {0.321601, 0.733004}, {0.31438, 0.739937}, 
-{0.311433, 0.732906}, {0.306224, 0.737297}, {0.46214, 0.813428}, 
-{0.465746, 0.794514}, {0.471249, 0.79613}, {0.484986, 0.785798}, 
-{0.468109, 0.812612}, {0.482721, 0.796614}, {0.4838, 0.780638}, 
-{0.469655, 0.837835}, {0.493336, 0.784849}, {0.48041, 0.816938}, 
-{0.473454, 0.821884}, {0.497204, 0.795518}, {0.493968, 0.780539}, 
-{0.499178, 0.784931}, {0.486291, 0.822676}, {0.491318, 0.81313}, 
-{0.476641, 0.836622}, {0.493238, 0.832614}, {0.407571, 0.846866}, 
-{0.392834, 0.850338}, {0.391621, 0.829284}, {0.27871, 0.732906}, 
-{0.276126, 0.77657}, {0.271162, 0.776824}, {0.267244, 0.810311}, 
-{0.725498, 0.822958}, {0.717986, 0.822224}, {0.717986, 0.784837}, 
-{0.723757, 0.785095}, {0.717986, 0.741465}, {0.722567, 0.741775}, 
-{0.717986, 0.702953}, {0.722567, 0.703115}, {0.717986, 0.66655}, 
-{0.725498, 0.666561}, {0.717986, 0.626447}, {0.73387, 0.626458}, 
-{0.717986, 0.598727}, {0.742735, 0.615784}, {0.773437, 0.598727}, 
-{0.747982, 0.643514}, {0.770514, 0.619155}, {0.774468, 0.634021}, 
-{0.753093, 0.683679}, {0.742763, 0.683618}, {0.748875, 0.720305}, 
-{0.742763, 0.720171}, {0.748875, 0.758817}, {0.742763, 0.758831}, 
-{0.75001, 0.802188}, {0.742763, 0.802151}, {0.740006, 0.840014}, 
-{0.752799, 0.839575}, {0.87598, 0.961573}, {0.881158, 0.962834}, 
-{0.879116, 0.972246}, {0.884651, 0.940867}, {0.872572, 0.972727}, 
-{0.875779, 0.978949}, {0.866563, 0.97904}, {0.140453, 0.836319}, 
-{0.153883, 0.84381}, {0.150223, 0.853026}, {0.137595, 0.847889}, 
-{0.568618, 0.792114}, {0.565222, 0.797777}, {0.551792, 0.79583}, 
-{0.574709, 0.801103}, {0.556179, 0.788355}, {0.569302, 0.784767}, 
-{0.569914, 0.80409}, {0.556919, 0.78054}, {0.577819, 0.796915}, 
-{0.575777, 0.809894}, {0.580231, 0.80899}, {0.570463, 0.815244}, 
-{0.577131, 0.822229}, {0.573651, 0.818552}, {0.566625, 0.83595}, 
-{0.70481, 0.852849}, {0.70258, 0.840774}, {0.708601, 0.84099}, 
-{0.704951, 0.826949}, {0.711481, 0.853779}, {0.696014, 0.828625}, 
-{0.710956, 0.865225}, {0.706428, 0.866088}, {0.712539, 0.879808}, 
-{0.819886, 0.943895}, {0.828823, 0.942992}, {0.836205, 0.955374}, 
-{0.825918, 0.959874}, {0.830859, 0.975208}, {0.820602, 0.963039}, 
-{0.824235, 0.977935}, {0.153094, 0.832328}, {0.141722, 0.789731}, 
-{0.159187, 0.792174}, {0.118107, 0.809697}, {0.138133, 0.747108}, 
-{0.090086, 0.775152}, {0.091795, 0.751224}, {0.089338, 0.79412}, 
-{0.095358, 0.731496}, {0.064813, 0.78124}, {0.064553, 0.753003}, 
-{0.105541, 0.836319}, {0.104442, 0.850729}, {0.098578, 0.849081}, 
-{0.109036, 0.836929}, {0.10076, 0.836436}, {0.108783, 0.852742}, 
-{0.023075, 0.867431}, {0.024308, 0.880075}, {0.017779, 0.880978}, 
-{0.01833, 0.867926}, {0.021218, 0.865244}, {0.239988, 0.853375}, 
-{0.238732, 0.840324}, {0.244122, 0.837729}, {0.24486, 0.853059}, 
-{0.242939, 0.856057}, {0.270708, 0.840727}, {0.271836, 0.856057}, 
-{0.264483, 0.856222}, {0.265583, 0.840408}, {0.267225, 0.837729}, 
-{0.163004, 0.862202}, {0.15996, 0.866983}, {0.158103, 0.86274}, 
-{0.159746, 0.858707}, {0.680548, 0.849977}, {0.681412, 0.865621}, 
-{0.675091, 0.866601}, {0.683635, 0.848861}, {0.672092, 0.872893}, 
-{0.675468, 0.850121}, {0.679046, 0.846868}, {0.685924, 0.864244}, 
-{0.682587, 0.871143}, {0.335285, 0.807564}, {0.334337, 0.824044}, 
-{0.327388, 0.823118}, {0.329369, 0.806377}, {0.333273, 0.804311}, 
-{0.219293, 0.838435}, {0.220334, 0.855176}, {0.213744, 0.852771}, 
-{0.214148, 0.837729}, {0.209045, 0.853744}, {0.031895, 0.845238}, 
-{0.032945, 0.860621}, {0.028333, 0.861253}, {0.068451, 0.867683}, 
-{0.074743, 0.865647}, {0.070551, 0.876488}, {0.182571, 0.866666}, 
-{0.181491, 0.861521}, {0.186476, 0.863297}, {0.186103, 0.858707}, 
-{0.664188, 0.367804}, {0.623058, 0.312166}, {0.659092, 0.310917}, 
-{0.626915, 0.368605}, {0.640139, 0.288727}, {0.706166, 0.376973}, 
-{0.624599, 0.436059}, {0.59841, 0.313227}, {0.652826, 0.2668}, 
-{0.620964, 0.295496}, {0.701349, 0.31221}, {0.656972, 0.434598}, 
-{0.591006, 0.432818}, {0.588939, 0.374339}, {0.63658, 0.269166}, 
-{0.703821, 0.268352}, {0.739742, 0.381997}, {0.704053, 0.43873}, 
-{0.645705, 0.494802}, {0.680335, 0.486434}, {0.596287, 0.296685}, 
-{0.585925, 0.313824}, {0.656076, 0.240372}, {0.693398, 0.216637}, 
-{0.618729, 0.269471}, {0.735641, 0.273316}, {0.738508, 0.317242}, 
-{0.705795, 0.480216}, {0.622119, 0.494787}, {0.569023, 0.429602}, 
-{0.598093, 0.28202}, {0.565935, 0.375679}, {0.637334, 0.243331}, 
-{0.726045, 0.222532}, {0.774139, 0.38513}, {0.738128, 0.443647}, 
-{0.679165, 0.496714}, {0.635644, 0.509708}, {0.599695, 0.479026}, 
-{0.711626, 0.508476}, {0.583877, 0.294758}, {0.641656, 0.223438}, 
-{0.729516, 0.209628}, {0.600478, 0.274101}, {0.620816, 0.243488}, 
-{0.7811, 0.241131}, {0.769123, 0.277467}, {0.76879, 0.325311}, 
-{0.744579, 0.47638}, {0.609408, 0.511569}, {0.593882, 0.494527}, 
-{0.743286, 0.510918}, {0.655405, 0.204647}, {0.627145, 0.231975}, 
-{0.779065, 0.222066}, {0.690674, 0.204296}, {0.572596, 0.273481}, 
-{0.784506, 0.449297}, {0.774286, 0.467074}, {0.709906, 0.539206}, 
-{0.646603, 0.530597}, {0.603614, 0.527543}, {0.583626, 0.468268}, 
-{0.755522, 0.534802}, {0.620851, 0.205955}, {0.786926, 0.182058}, 
-{0.57818, 0.25093}, {0.567943, 0.280552}, {0.602579, 0.249107}, 
-{0.619212, 0.233421}, {0.682726, 0.534931}, {0.574009, 0.497262}, 
-{0.787621, 0.536664}, {0.63557, 0.179039}, {0.61704, 0.232975}, 
-{0.663816, 0.190724}, {0.799783, 0.186542}, {0.748644, 0.175716}, 
-{0.549384, 0.250941}, {0.548963, 0.267955}, {0.778494, 0.503308}, 
-{0.765987, 0.571233}, {0.704444, 0.571917}, {0.676853, 0.563994}, 
-{0.600339, 0.55309}, {0.592103, 0.521769}, {0.784039, 0.578437}, 
-{0.591579, 0.196431}, {0.593691, 0.214457}, {0.811281, 0.157699}, 
-{0.691473, 0.198499}, {0.799511, 0.156199}, {0.573856, 0.24415}, 
-{0.547989, 0.273935}, {0.602181, 0.238384}, {0.639117, 0.560066}, 
-{0.574467, 0.543153}, {0.572375, 0.525332}, {0.670525, 0.154014}, 
-{0.602799, 0.237354}, {0.709383, 0.168404}, {0.767911, 0.145661}, 
-{0.521734, 0.253247}, {0.550002, 0.244859}, {0.519988, 0.262767}, 
-{0.751157, 0.592105}, {0.701692, 0.589186}, {0.670276, 0.582299}, 
-{0.581278, 0.561562}, {0.577987, 0.222702}, {0.682539, 0.162378}, 
-{0.77261, 0.133717}, {0.519488, 0.268566}, {0.768092, 0.594736}, 
-{0.561059, 0.550334}, {0.6057, 0.571198}, {0.712444, 0.13271}, 
-{0.730404, 0.138215}, {0.813541, 0.139075}, {0.492989, 0.243558}, 
-{0.489483, 0.255413}, {0.565916, 0.568391}, {0.635877, 0.571755}, 
-{0.590336, 0.575204}, {0.7375, 0.125548}, {0.7975, 0.126521}, 
-{0.486177, 0.268102}, {0.538286, 0.556009}, {0.720314, 0.118149}, 
-{0.773695, 0.125102}, {0.821572, 0.130204}, {0.482385, 0.235376}, 
-{0.48164, 0.258785}, {0.571132, 0.58428}, {0.536438, 0.571462}, 
-{0.74239, 0.117473}, {0.804485, 0.105467}, {0.475995, 0.251894}, 
-{0.508614, 0.55592}, {0.724545, 0.103406}, {0.77741, 0.110617}, 
-{0.477082, 0.233148}, {0.534079, 0.57748}, {0.506766, 0.566223}, 
-{0.747593, 0.101138}, {0.790502, 0.083889}, {0.454843, 0.226879}, 
-{0.492989, 0.553419}, {0.738138, 0.07899}, {0.759719, 0.077593}, 
-{0.803591, 0.081335}, {0.454344, 0.25084}, {0.503163, 0.575013}, 
-{0.494009, 0.547317}, {0.489483, 0.563654}, {0.724984, 0.081105}, 
-{0.78088, 0.071223}, {0.794619, 0.079918}, {0.818183, 0.091061}, 
-{0.474775, 0.260375}, {0.483404, 0.537598}, {0.482385, 0.543617}, 
-{0.732869, 0.050494}, {0.740465, 0.049988}, {0.788665, 0.075314}, 
-{0.748327, 0.04862}, {0.797754, 0.073741}, {0.82193, 0.097022}, 
-{0.81316, 0.078664}, {0.464139, 0.260375}, {0.486177, 0.576343}, 
-{0.475995, 0.560135}, {0.786877, 0.066753}, {0.764551, 0.042673}, 
-{0.793879, 0.072375}, {0.808511, 0.074117}, {0.8335, 0.099183}, 
-{0.821083, 0.104497}, {0.48164, 0.567026}, {0.477082, 0.541388}, 
-{0.733712, 0.033191}, {0.74365, 0.031893}, {0.788666, 0.05956}, 
-{0.791945, 0.067036}, {0.797395, 0.067505}, {0.801938, 0.071367}, 
-{0.454843, 0.53512}, {0.794513, 0.062845}, {0.75969, 0.027465}, 
-{0.807193, 0.063814}, {0.454344, 0.55908}, {0.736281, 0.022765}, 
-{0.798734, 0.062623}, {0.753301, 0.015305}, {0.782469, 0.037614}, 
-{0.802184, 0.065909}, {0.474775, 0.568616}, {0.739704, 0.019363}, 
-{0.798621, 0.058357}, {0.760401, 0.014671}, {0.796694, 0.055034}, 
-{0.769099, 0.021434}, {0.464139, 0.568616}, {0.735527, 0.012341}, 
-{0.751644, 0.008783}, {0.748119, 0.011345}, {0.732176, 0.017581}, 
-{0.758565, 0.010725}, {0.74667, 0.006784}, {0.753769, 0.005597}, 
-{0.740321, 0.00957}, {0.760909, 0.005064}, {0.749086, 0.003879}, 
-{0.754333, 0.001954}, {0.033963, 0.140723}, {0.062267, 0.140241}, 
-{0.062267, 0.199369}, {0.062267, 0.095845}, {0.038426, 0.200543}, 
-{0.026336, 0.092879}, {0.062267, 0.257752}, {0.062267, 0.059281}, 
-{0.030755, 0.264709}, {0.042254, 0.056543}, {0.035724, 0.316595}, 
-{0.062267, 0.041616}, {0.012865, 0.318721}, {0.062267, 0.31599}, 
-{0.041352, 0.037479}, {0.02519, 0.352077}, {0.001992, 0.282487}, 
-{0.062267, 0.001954}, {0.062267, 0.349477}, {0.028254, 0.393849}, 
-{0.054756, 0.392956}, {0.062267, 0.393395}, {0.035706, 0.410148}, 
-{0.062267, 0.430782}, {0.056496, 0.430819}, {0.057686, 0.474139}, 
-{0.062267, 0.474154}, {0.057686, 0.512799}, {0.062267, 0.512666}, 
-{0.054756, 0.549353}, {0.062267, 0.549291}, {0.046383, 0.589456}, 
-{0.062267, 0.598949}, {0.963861, 0.60277}, {0.998008, 0.599025}, 
-{0.998008, 0.665517}, {0.950863, 0.548847}, {0.972298, 0.664626}, 
-{0.998008, 0.549836}, {0.971379, 0.683692}, {0.977182, 0.510843}, 
-{0.998008, 0.705904}, {0.958615, 0.510181}, {0.998008, 0.509667}, 
-{0.958349, 0.697811}, {0.964643, 0.489906}, {0.998008, 0.479217}, 
-{0.956381, 0.681764}, {0.960425, 0.729125}, {0.975484, 0.491492}, 
-{0.952869, 0.481187}, {0.935117, 0.69643}, {0.974115, 0.755747}, 
-{0.960841, 0.479412}, {0.98034, 0.479286}, {0.998008, 0.7642}, 
-{0.951746, 0.453117}, {0.973627, 0.487362}, {0.998008, 0.453144}, 
-{0.976262, 0.782019}, {0.9597, 0.45154}, {0.966679, 0.486907}, 
-{0.975659, 0.480773}, {0.979151, 0.453065}, {0.998008, 0.786434}, 
-{0.964192, 0.438991}, {0.968725, 0.459059}, {0.969549, 0.471928}, 
-{0.976853, 0.439846}, {0.966547, 0.443315}, {0.957754, 0.410342}, 
-{0.96395, 0.450667}, {0.969165, 0.476074}, {0.998008, 0.419526}, 
-{0.974155, 0.451016}, {0.971937, 0.444486}, {0.974236, 0.419675}, 
-{0.968291, 0.454348}, {0.976219, 0.400076}, {0.964267, 0.480586}, 
-{0.998008, 0.39619}, {0.884101, 0.533638}, {0.880281, 0.568037}, 
-{0.857919, 0.564797}, {0.895483, 0.530706}, {0.85786, 0.603575}, 
-{0.896829, 0.502222}, {0.889511, 0.568037}, {0.908253, 0.514147}, 
-{0.888475, 0.597276}, {0.928982, 0.497211}, {0.908252, 0.547423}, 
-{0.872825, 0.598213}, {0.928982, 0.464154}, {0.928982, 0.512415}, 
-{0.892794, 0.57086}, {0.887716, 0.616118}, {0.893807, 0.452757}, 
-{0.908729, 0.57006}, {0.928982, 0.547784}, {0.874512, 0.613577}, 
-{0.928982, 0.438826}, {0.90854, 0.596831}, {0.882212, 0.634127}, 
-{0.902421, 0.435821}, {0.928982, 0.570303}, {0.888728, 0.615927}, 
-{0.872679, 0.632782}, {0.928982, 0.427506}, {0.928982, 0.598207}, 
-{0.907193, 0.619874}, {0.877467, 0.670216}, {0.921471, 0.41414}, 
-{0.873108, 0.669834}, {0.928982, 0.417232}, {0.928982, 0.621259}, 
-{0.869689, 0.700751}, {0.876906, 0.698224}, {0.875901, 0.714364}, 
-{0.414322, 0.680995}, {0.420588, 0.700364}, {0.406579, 0.704942}, 
-{0.403436, 0.718351}, {0.407165, 0.68217}, {0.422246, 0.716381}, 
-{0.408527, 0.652077}, {0.41869, 0.737279}, {0.416148, 0.649574}, 
-{0.402118, 0.652498}, {0.396602, 0.747498}, {0.403523, 0.637893}, 
-{0.408088, 0.753292}, {0.415143, 0.633434}, {0.424697, 0.753887}, 
-{0.400167, 0.627288}, {0.416485, 0.621961}, {0.395193, 0.620966}, 
-{0.396293, 0.599747}, {0.384164, 0.598727}, {0.415815, 0.599747}, 
-{0.169684, 0.854681}, {0.160018, 0.854715}, {0.163514, 0.837729}, 
-{0.292716, 0.626735}, {0.285246, 0.627616}, {0.283287, 0.598727}, 
-{0.301378, 0.662824}, {0.271595, 0.630149}, {0.282726, 0.653537}, 
-{0.264932, 0.649518}, {0.274875, 0.671894}, {0.254433, 0.665535}, 
-{0.289977, 0.680833}, {0.237768, 0.686433}, {0.26301, 0.690734}, 
-{0.284212, 0.699675}, {0.25023, 0.70985}, {0.285958, 0.728914}, 
-{0.230862, 0.703041}, {0.821581, 0.939}, {0.785666, 0.935785}, 
-{0.8163, 0.889577}, {0.27885, 0.814302}, {0.289529, 0.830442}, 
-{0.277971, 0.832946}, {0.907741, 0.765654}, {0.88873, 0.752042}, 
-{0.905388, 0.748703}, {0.899754, 0.744131}, {0.880953, 0.740569}, 
-{0.896037, 0.737763}, {0.895339, 0.727494}, {0.87142, 0.718355}, 
-{0.6296, 0.760924}, {0.620705, 0.771029}, {0.619114, 0.763096}, 
-{0.618531, 0.78554}, {0.621254, 0.746065}, {0.637558, 0.746683}, 
-{0.643767, 0.732261}, {0.629838, 0.71774}, {0.644953, 0.724311}, 
-{0.646105, 0.698821}, {0.632409, 0.693885}, {0.639442, 0.664386}, 
-{0.632633, 0.666903}, {0.620474, 0.693267}, {0.639494, 0.633434}, 
-{0.619544, 0.722064}, {0.625454, 0.665618}, {0.629379, 0.637893}, 
-{0.623162, 0.627288}, {0.619978, 0.636873}, {0.640836, 0.621961}, 
-{0.614139, 0.626268}, {0.619543, 0.620966}, {0.620643, 0.599747}, 
-{0.608514, 0.598727}, {0.640165, 0.599747}, {0.03776, 0.759479}, 
-{0.03337, 0.72933}, {0.056602, 0.747407}, {0.041511, 0.779434}, 
-{0.056927, 0.777495}, {0.043372, 0.807935}, {0.051018, 0.807384}, 
-{0.043511, 0.841246}, {0.053177, 0.841212}, {0.081326, 0.727504}, 
-{0.082157, 0.702014}, {0.100876, 0.697006}, {0.096808, 0.667116}, 
-{0.112641, 0.727094}, {0.085828, 0.66758}, {0.096422, 0.633289}, 
-{0.079764, 0.636627}, {0.090787, 0.628717}, {0.071987, 0.625154}, 
-{0.087071, 0.622349}, {0.086373, 0.61208}, {0.062453, 0.602941}, 
-{0.589167, 0.86781}, {0.59701, 0.855515}, {0.602655, 0.874717}, 
-{0.603875, 0.862841}, {0.603379, 0.848933}, {0.614511, 0.862841}, 
-{0.613647, 0.849212}, {0.136236, 0.86412}, {0.12692, 0.866683}, 
-{0.130602, 0.857017}, {0.920924, 0.845208}, {0.922437, 0.869127}, 
-{0.891614, 0.848739}, {0.890786, 0.872699}, {0.907295, 0.839203}, 
-{0.902915, 0.87986}, {0.526209, 0.860703}, {0.534053, 0.848408}, 
-{0.539698, 0.86761}, {0.540918, 0.855734}, {0.540421, 0.841826}, 
-{0.551553, 0.855734}, {0.550689, 0.842105}, {0.151828, 0.864119}, 
-{0.142512, 0.866683}, {0.146194, 0.857017}, {0.996496, 0.841077}, 
-{0.998008, 0.864996}, {0.967185, 0.844608}, {0.966358, 0.868569}, 
-{0.982867, 0.835073}, {0.978486, 0.875729}, {0.518668, 0.776548}, 
-{0.517431, 0.750688}, {0.536872, 0.752189}, {0.536872, 0.734283}, 
-{0.517089, 0.733565}, {0.536872, 0.720795}, {0.515132, 0.724693}, 
-{0.518886, 0.720168}, {0.499052, 0.706802}, {0.536872, 0.714694}, 
-{0.505455, 0.724617}, {0.521614, 0.71364}, {0.536872, 0.707124}, 
-{0.523469, 0.707299}, {0.506717, 0.704913}, {0.536872, 0.690769}, 
-{0.507038, 0.693673}, {0.523456, 0.691047}, {0.49441, 0.689474}, 
-{0.536872, 0.67983}, {0.492767, 0.696808}, {0.524647, 0.680187}, 
-{0.487573, 0.704251}, {0.487668, 0.682771}, {0.508808, 0.685551}, 
-{0.514521, 0.667985}, {0.483209, 0.68793}, {0.50438, 0.673154}, 
-{0.536872, 0.657494}, {0.478896, 0.69021}, {0.481996, 0.675312}, 
-{0.497884, 0.668606}, {0.523124, 0.658298}, {0.4775, 0.677421}, 
-{0.486792, 0.673359}, {0.504246, 0.658303}, {0.536872, 0.648514}, 
-{0.479783, 0.665975}, {0.489347, 0.651392}, {0.50888, 0.652846}, 
-{0.523957, 0.649524}, {0.536872, 0.631372}, {0.528546, 0.632103}, 
-{0.536872, 0.61553}, {0.530126, 0.615924}, {0.536872, 0.598727}, 
-{0.530122, 0.599554}, {0.52087, 0.605215}, {0.519451, 0.609161}, 
-{0.447194, 0.785536}, {0.451473, 0.823579}, {0.429008, 0.784736}, 
-{0.455815, 0.757879}, {0.196845, 0.710443}, {0.177743, 0.719592}, 
-{0.185381, 0.677673}, {0.196845, 0.723803}, {0.196845, 0.676457}, 
-{0.180652, 0.642718}, {0.196845, 0.641925}, {0.196845, 0.604114}, 
-{0.175099, 0.598727}, {0.029025, 0.618952}, {0.010657, 0.617502}, 
-{0.009923, 0.602941}, {0.010657, 0.632245}, {0.029025, 0.633832}, 
-{0.009808, 0.654546}, {0.029025, 0.654777}, {0.029025, 0.686279}, 
-{0.011842, 0.685157}, {0.029025, 0.701111}, {0.012769, 0.702461}, 
-{0.018269, 0.718071}, {0.007867, 0.712887}, {0.029025, 0.719013}, 
-{0.018779, 0.723311}, {0.029025, 0.725339}, {0.782189, 0.942992}, 
-{0.791297, 0.965889}, {0.776875, 0.970707}, {0.766484, 0.951237}, 
-{0.768925, 0.977859}, {0.491633, 0.862414}, {0.491849, 0.855838}, 
-{0.498384, 0.85611}, {0.485199, 0.855274}, {0.498384, 0.842096}, 
-{0.498384, 0.863603}, {0.485632, 0.853149}, {0.490513, 0.842141}, 
-{0.48695, 0.850592}, {0.483899, 0.841826}, {0.482829, 0.848176}, 
-{0.707663, 0.915942}, {0.69206, 0.907914}, {0.700087, 0.8838}, 
-{0.692585, 0.91787}, {0.416847, 0.82757}, {0.42675, 0.82757}, 
-{0.425926, 0.835441}, {0.423499, 0.842055}, {0.413706, 0.849219}, 
-{0.457514, 0.849219}, {0.454518, 0.840478}, {0.454374, 0.82757}, 
-{0.450492, 0.837817}, {0.448267, 0.82757}, {0.450469, 0.837379}, 
-{0.056758, 0.865647}, {0.060741, 0.865647}, {0.060945, 0.875455}, 
-{0.057396, 0.875893}, {0.061563, 0.878554}, {0.053261, 0.845238}, 
-{0.054397, 0.861655}, {0.039081, 0.859886}, {0.687979, 0.789531}, 
-{0.682645, 0.801712}, {0.66799, 0.800595}, {0.663215, 0.811932}, 
-{0.658984, 0.805131}, {0.682988, 0.820402}, {0.662349, 0.795193}, 
-{0.659064, 0.814677}, {0.6688, 0.831021}, {0.670164, 0.795933}, 
-{0.681067, 0.840237}, {0.665341, 0.83229}, {0.676296, 0.842877}, 
-{0.343925, 0.829284}, {0.349342, 0.831458}, {0.34142, 0.849272}, 
-{0.362392, 0.767556}, {0.380572, 0.767998}, {0.388087, 0.792405}, 
-{0.3565, 0.757879}, {0.384481, 0.811318}, {0.364606, 0.779737}, 
-{0.364498, 0.798427}, {0.366427, 0.825195}, {0.359206, 0.818262}, 
-{0.356259, 0.825293}, {0.351049, 0.820902}, {0.516075, 0.822244}, 
-{0.510572, 0.82386}, {0.506966, 0.804946}, {0.529811, 0.832576}, 
-{0.512935, 0.805762}, {0.527547, 0.82176}, {0.528626, 0.837736}, 
-{0.514481, 0.780539}, {0.538162, 0.833525}, {0.518279, 0.79649}, 
-{0.525236, 0.801436}, {0.54203, 0.822856}, {0.538794, 0.837835}, 
-{0.544004, 0.833443}, {0.531117, 0.795698}, {0.536144, 0.805244}, 
-{0.521467, 0.781752}, {0.538064, 0.78576}, {0.385486, 0.829284}, 
-{0.384273, 0.850338}, {0.369535, 0.846866}, {0.290652, 0.766392}, 
-{0.295616, 0.766646}, {0.298199, 0.810311}, {0.286734, 0.732906}, 
-{0.711851, 0.784837}, {0.711851, 0.822224}, {0.704339, 0.822958}, 
-{0.70608, 0.785095}, {0.711851, 0.741465}, {0.707269, 0.741775}, 
-{0.711851, 0.702953}, {0.707269, 0.703115}, {0.711851, 0.66655}, 
-{0.704339, 0.666561}, {0.711851, 0.626447}, {0.695967, 0.626458}, 
-{0.711851, 0.598727}, {0.919543, 0.790425}, {0.944999, 0.835212}, 
-{0.914297, 0.818155}, {0.942076, 0.814784}, {0.946029, 0.799918}, 
-{0.854893, 0.947661}, {0.856935, 0.957073}, {0.851757, 0.958334}, 
-{0.860428, 0.97904}, {0.848349, 0.947179}, {0.851556, 0.940958}, 
-{0.84234, 0.940867}, {0.118831, 0.853026}, {0.115172, 0.84381}, 
-{0.128602, 0.836319}, {0.13146, 0.847889}, {0.615313, 0.804821}, 
-{0.601882, 0.806769}, {0.598486, 0.801105}, {0.592395, 0.810094}, 
-{0.610925, 0.797346}, {0.597802, 0.793758}, {0.59719, 0.813081}, 
-{0.610185, 0.789531}, {0.589285, 0.805906}, {0.591327, 0.818886}, 
-{0.586873, 0.817981}, {0.596641, 0.824236}, {0.589973, 0.831221}, 
-{0.593453, 0.827543}, {0.600479, 0.844941}, {0.731989, 0.882824}, 
-{0.725968, 0.883041}, {0.728197, 0.870966}, {0.728338, 0.896865}, 
-{0.734868, 0.870035}, {0.719401, 0.895189}, {0.734344, 0.858589}, 
-{0.729815, 0.857726}, {0.735926, 0.844006}, {0.813751, 0.965553}, 
-{0.806369, 0.977935}, {0.797433, 0.977032}, {0.803464, 0.961052}, 
-{0.798149, 0.957888}, {0.808405, 0.945719}, {0.801782, 0.942992}, 
-{0.165899, 0.793584}, {0.183364, 0.791141}, {0.171992, 0.833738}, 
-{0.186952, 0.748517}, {0.206978, 0.811107}, {0.23329, 0.752634}, 
-{0.235, 0.776562}, {0.229728, 0.732906}, {0.235748, 0.79553}, 
-{0.260532, 0.754413}, {0.260273, 0.78265}, {0.092443, 0.849081}, 
-{0.086579, 0.850729}, {0.085479, 0.836319}, {0.081984, 0.836929}, 
-{0.09026, 0.836436}, {0.082238, 0.852742}, {0.037951, 0.88138}, 
-{0.031421, 0.880477}, {0.032655, 0.867833}, {0.037399, 0.868328}, 
-{0.034512, 0.865647}, {0.227207, 0.837729}, {0.232597, 0.840324}, 
-{0.231341, 0.853375}, {0.226469, 0.853059}, {0.22839, 0.856057}, 
-{0.258348, 0.856222}, {0.250995, 0.856057}, {0.252124, 0.840727}, 
-{0.257249, 0.840408}, {0.255606, 0.837729}, {0.169797, 0.86295}, 
-{0.171653, 0.858707}, {0.174698, 0.863488}, {0.171439, 0.866983}, 
-{0.662959, 0.866601}, {0.656637, 0.865621}, {0.657501, 0.849977}, 
-{0.665957, 0.872893}, {0.654414, 0.848861}, {0.662581, 0.850121}, 
-{0.655463, 0.871143}, {0.659004, 0.846868}, {0.652125, 0.864244}, 
-{0.321253, 0.823118}, {0.314304, 0.824044}, {0.313357, 0.807564}, 
-{0.319273, 0.806377}, {0.315368, 0.804311}, {0.198211, 0.852771}, 
-{0.191621, 0.855176}, {0.192662, 0.838435}, {0.197806, 0.837729}, 
-{0.20291, 0.853744}, {0.022197, 0.861253}, {0.017584, 0.860621}, 
-{0.018635, 0.845238}, {0.084193, 0.856734}, {0.088385, 0.867575}, 
-{0.082094, 0.865539}, {0.193184, 0.863757}, {0.198169, 0.861982}, 
-{0.197089, 0.867126}, {0.193556, 0.859167}, {0.002856, 0.845238}, 
-{0.011449, 0.851257}, {0.005417, 0.861059}, {0.008024, 0.880872}, 
-{0.001992, 0.87107}, {0.010585, 0.865051}};
\ No newline at end of file
+alignas(16) constexpr float cowVertsX[1732] = {
+    1.794894, 2.66195, 2.188662, 2.717314, 2.087702, 2.370398, 1.53785, 1.708982,
+    0.682862, 0.810986, -0.001599, -0.001599, 1.28091, 1.914071, -0.001599, -0.001599,
+    2.876335, 2.977035, 2.565738, 1.942254, 0.90307, -0.001599, 2.382978, 1.351887,
+    1.416678, -0.001599, 1.062842, -0.001599, 0.97489, 0.214051, 2.061706, 1.954762,
+    1.502438, 1.72883, 2.079962, 0.760434, 2.189547, 2.404947, 2.249498, 1.696862,
+    1.129325, -0.001599, 0.760939, -0.001599, 1.008251, 2.180127, 2.112911, 1.738111,
+    0.921483, 2.486174, 2.3239, 1.960299, 1.286879, -0.001599, 0.978707, 0.73649,
+    2.232547, 2.36673, 2.038545, 1.396538, 1.724846, 2.054583, 2.04022, 1.610595,
+    1.365983, 1.768159, 1.950427, 1.614802, 1.712232, 1.896239, 1.906983, 1.700643,
+    1.855889, 2.02578, 2.080363, 1.80099, 1.545877, 1.751336, 1.842766, 1.523488,
+    1.493454, 1.443599, 1.341115, 1.16131, 1.56217, 1.183111, 1.318391, 0.960131,
+    0.593519, -0.001599, -0.001599, -0.001599, -0.001599, -0.001599, 1.420479, 1.503511,
+    1.122619, 0.596276, 1.265387, 1.522288, 1.932741, 1.858408, 1.13156, 0.879353,
+    0.891677, 1.248018, 2.273394, 1.762862, 2.273378, 1.820673, 1.02995, -0.001599,
+    1.193458, 0.76289, -0.001599, 1.835902, 1.773478, 1.992866, 1.610598, 0.572974,
+    -0.001599, 1.07735, 2.21787, 2.097618, 2.195142, 1.947314, 2.129566, 2.083813,
+    2.112655, 2.084924, 1.819169, 1.757718, 1.80391, 1.51811, 1.289646, 1.136948,
+    1.67789, 1.806823, 1.853567, 1.511286, 1.111389, 1.127629, 1.044276, 1.570188,
+    1.780111, 1.763494, 1.437489, 1.297262, 1.235579, 1.516764, 1.637158, 1.638551,
+    1.431057, 1.235282, 1.234081, 1.512784, 1.794359, 1.792156, 1.524453, 1.702945,
+    1.961981, 1.806842, 1.775255, 2.123459, 1.990453, 1.439175, 1.649499, 2.099702,
+    1.195553, 1.214816, 1.250222, 1.649499, 1.258231, 1.477342, 1.602477, 1.952254,
+    2.198946, 2.095049, 2.063462, 2.411666, 2.27866, 1.727382, 1.937706, 2.387908,
+    1.483759, 1.503023, 1.538428, 1.937706, 1.546437, 1.140358, 1.785314, 0.598846,
+    -0.001599, 0.812134, 0.877354, 0.521022, -0.001599, 0.840666, 0.859028, 0.556538,
+    -0.001599, 0.886882, 0.900361, 0.566358, -0.001598, 1.263202, 0.623326, 1.015694,
+    0.546802, 0.525718, -0.001599, -0.001599, -0.001598, -0.001598, 0.327508, 0.463294,
+    1.44143, 0.979162, -0.001599, 0.622702, 1.009016, -0.001599, 0.684346, -0.001598,
+    0.436458, -0.001598, 0.383177, -0.001598, 0.383576, -0.001598, 0.349385, 0.640087,
+    -0.001598, 0.393092, -0.001598, 0.369166, -0.001598, 0.237431, -0.001598, 0.192069,
+    -0.001598, 0.192192, -0.001598, 0.186005, -0.001598, 0.224352, 0.548038, 0.586636,
+    0.670611, 0.677083, 0.817105, 1.020502, 1.17231, 0.931225, 0.8041, 1.081009,
+    0.947858, 1.062662, 1.150989, 0.938519, 0.963411, 0.913034, 0.525718, -0.001598,
+    0.550094, -0.001598, 0.465103, 0.491695, -0.001598, -0.001598, 1.191188, 0.982635,
+    0.667284, 0.935055, 1.036852, 0.802012, 0.935055, 1.117702, 1.117702, 1.117702,
+    0.935055, 1.036852, 1.036852, 1.117702, 1.117702, 1.117702, 0.457806, 0.376929,
+    0.498554, 0.619908, 0.605815, 0.414238, 0.44497, 0.566318, 0.534862, 0.326659,
+    0.307187, -0.001598, 0.292569, -0.001598, -0.001598, 0.368969, 0.279999, -0.001598,
+    0.854898, 0.864122, 0.936942, 0.954962, 1.084158, 0.514751, 0.622536, 0.90035,
+    1.21799, 1.250054, 1.543462, 1.78663, 2.091479, 2.35605, 1.61373, 2.156718,
+    2.55509, 2.431838, 2.557906, 1.0629, 1.348209, 1.622262, 2.127903, 2.406942,
+    2.110326, 2.434194, 1.637133, 1.370946, 2.096436, 1.512938, -0.001598, 0.364494,
+    1.10834, -0.001599, -0.001599, -0.001599, 0.164085, -0.001599, -0.001599, 0.129928,
+    -0.001599, -0.001599, 0.129928, -0.001599, -0.001599, 0.214051, -0.001599, -0.001599,
+    0.454419, -0.001599, -0.001599, -0.001599, -0.001599, 1.264606, 1.217438, 1.41099,
+    1.32251, 1.457228, 1.472988, 1.436138, 1.57384, 1.362786, 1.420017, 1.594887,
+    1.625527, 1.564499, 1.753417, 1.439646, 1.664399, 1.68417, 1.413706, 1.662835,
+    1.70289, 1.63735, 1.53901, 1.337174, 1.724846, 1.647874, 1.154039, 1.326521,
+    0.593535, -0.001599, 0.579835, -0.001599, 0.585267, -0.001599, 0.623941, -0.001599,
+    1.037306, 1.696862, 1.294295, -0.001599, -0.001599, 0.680863, -0.001599, 1.616956,
+    1.443452, 0.505621, 0.645035, 0.956281, 1.065423, 0.815419, 0.53977, 0.839079,
+    1.098175, 0.969207, 0.605723, 0.88311, 0.745849, 0.782944, 0.922806, 0.983444,
+    0.851538, 0.683201, 0.746879, 0.901608, 0.976169, 0.86766, 0.856598, 0.966588,
+    0.925028, 0.755181, 0.72417, 0.826444, 0.967073, 0.89783, 0.698337, 0.640001,
+    0.867282, -1.799081, -2.666138, -2.19285, -2.721502, -2.09189, -2.374585, -1.542038,
+    -1.71317, -0.68705, -0.815173, -0.002589, -0.002589, -1.285098, -1.918258, -0.002589,
+    -0.002589, -2.880522, -2.981222, -2.569926, -1.946442, -0.907258, -0.002589, -2.387166,
+    -1.356074, -1.420865, -0.002588, -1.06703, -0.002588, -0.979078, -0.218239, -2.065893,
+    -1.95895, -1.506626, -1.733018, -2.08415, -0.764622, -2.193734, -2.409134, -2.253686,
+    -1.70105, -1.133513, -0.002588, -0.765126, -0.002588, -1.012438, -2.184314, -2.117099,
+    -1.742298, -0.92567, -2.490362, -2.328088, -1.964486, -1.291066, -0.002589, -0.982894,
+    -0.740678, -2.236734, -2.370918, -2.042732, -1.400726, -1.729033, -2.05877, -2.044408,
+    -1.614782, -1.37017, -1.772346, -1.954614, -1.618989, -1.716419, -1.900426, -1.91117,
+    -1.70483, -1.860077, -2.029968, -2.08455, -1.805177, -1.550065, -1.755523, -1.846953,
+    -1.527676, -1.497641, -1.447786, -1.345302, -1.165498, -1.566358, -1.187298, -1.322578,
+    -0.964318, -0.597706, -0.002588, -0.002588, -0.002588, -0.002588, -0.002588, -1.424667,
+    -1.507698, -1.126806, -0.600463, -1.269574, -1.526475, -1.936928, -1.862595, -1.135747,
+    -0.883541, -0.895865, -1.252205, -2.277582, -1.76705, -2.277566, -1.824861, -1.034137,
+    -0.002589, -1.197646, -0.767078, -0.002589, -1.840089, -1.777666, -1.997053, -1.614785,
+    -0.577161, -0.002589, -1.081538, -2.222058, -2.101806, -2.19933, -1.951502, -2.133754,
+    -2.088, -2.116842, -2.089112, -1.823356, -1.761905, -1.808098, -1.522298, -1.293833,
+    -1.141136, -1.682078, -1.81101, -1.857754, -1.515474, -1.115576, -1.131816, -1.048464,
+    -1.574375, -1.784298, -1.767681, -1.441676, -1.30145, -1.239766, -1.520952, -1.641345,
+    -1.642739, -1.435245, -1.239469, -1.238268, -1.516971, -1.798546, -1.796344, -1.52864,
+    -1.707132, -1.966168, -1.811029, -1.779443, -2.127646, -1.994641, -1.443363, -1.653687,
+    -2.103889, -1.19974, -1.219004, -1.254409, -1.653687, -1.262418, -1.481529, -1.606664,
+    -1.956442, -2.203133, -2.099236, -2.067649, -2.415853, -2.282847, -1.731569, -1.941893,
+    -2.392096, -1.487947, -1.50721, -1.542616, -1.941893, -1.550625, -1.144545, -1.789502,
+    -0.603033, -0.002589, -0.816322, -0.881541, -0.525209, -0.002589, -0.844853, -0.863215,
+    -0.560725, -0.002589, -0.891069, -0.904548, -0.570545, -0.002589, -1.26739, -0.627513,
+    -1.019882, -0.550989, -0.529905, -0.002589, -0.002589, -0.002589, -0.002589, -0.331695,
+    -0.467482, -1.445618, -0.98335, -0.002589, -0.62689, -1.013203, -0.002589, -0.688534,
+    -0.002589, -0.440645, -0.002589, -0.387365, -0.002589, -0.387764, -0.002589, -0.353572,
+    -0.644275, -0.002589, -0.397279, -0.002589, -0.373353, -0.002589, -0.241618, -0.002589,
+    -0.196256, -0.002589, -0.19638, -0.002589, -0.190193, -0.002589, -0.228539, -0.552225,
+    -0.590824, -0.674798, -0.681271, -0.821292, -1.02469, -1.176497, -0.935413, -0.808287,
+    -1.085196, -0.952045, -1.066849, -1.155176, -0.942706, -0.967599, -0.917222, -0.529905,
+    -0.002589, -0.554282, -0.002589, -0.46929, -0.495882, -0.002589, -0.002589, -1.195375,
+    -0.986823, -0.671471, -0.939242, -1.041039, -0.8062, -0.939242, -1.121889, -1.121889,
+    -1.121889, -0.939242, -1.041039, -1.041039, -1.121889, -1.121889, -1.121889, -0.461993,
+    -0.381116, -0.502741, -0.624095, -0.610002, -0.418425, -0.449157, -0.570505, -0.539049,
+    -0.330847, -0.311375, -0.002589, -0.296756, -0.002589, -0.002589, -0.373156, -0.284187,
+    -0.002589, -0.859085, -0.868309, -0.941129, -0.959149, -1.088345, -0.518939, -0.626723,
+    -0.904537, -1.222177, -1.254241, -1.547649, -1.790817, -2.095666, -2.360237, -1.617917,
+    -2.160905, -2.559277, -2.436025, -2.562093, -1.067087, -1.352397, -1.626449, -2.13209,
+    -2.411129, -2.114513, -2.438381, -1.641321, -1.375133, -2.100623, -1.517125, -0.002589,
+    -0.368681, -1.112527, -0.002588, -0.002588, -0.002588, -0.168272, -0.002588, -0.002588,
+    -0.134115, -0.002588, -0.002588, -0.134115, -0.002588, -0.002588, -0.218238, -0.002588,
+    -0.002588, -0.458606, -0.002588, -0.002588, -0.002588, -0.002588, -1.268793, -1.221625,
+    -1.415177, -1.326697, -1.461415, -1.477175, -1.440325, -1.578028, -1.366973, -1.424204,
+    -1.599075, -1.629714, -1.568686, -1.757604, -1.443833, -1.668587, -1.688357, -1.417893,
+    -1.667022, -1.707077, -1.641537, -1.543197, -1.341361, -1.729033, -1.652061, -1.158226,
+    -1.330709, -0.597722, -0.002588, -0.584022, -0.002588, -0.589454, -0.002588, -0.628129,
+    -0.002588, -1.041493, -1.70105, -1.298482, -0.002588, -0.002588, -0.68505, -0.002588,
+    -1.621144, -1.447639, -0.509809, -0.649222, -0.960468, -1.06961, -0.819606, -0.543958,
+    -0.843266, -1.102362, -0.973395, -0.60991, -0.887298, -0.750037, -0.787131, -0.926993,
+    -0.987631, -0.855725, -0.687389, -0.751067, -0.905795, -0.980357, -0.871847, -0.860786,
+    -0.970775, -0.929215, -0.759368, -0.728357, -0.830632, -0.97126, -0.902017, -0.702524,
+    -0.644189, -0.871469, 1.794894, 2.66195, 2.188662, 2.717314, 2.087702, 2.370398,
+    1.53785, 1.708982, 0.682862, 0.810986, -0.001599, -0.001599, 1.28091, 1.914071,
+    -0.001599, -0.001599, 2.876335, 2.977035, 2.565738, 1.942254, 0.90307, -0.001599,
+    2.382978, 1.351887, 1.416678, -0.001599, 1.062842, -0.001599, 0.97489, 0.214051,
+    2.061706, 1.954762, 1.502438, 1.72883, 2.079962, 0.760434, 2.189547, 2.404947,
+    2.249498, 1.696862, 1.129325, -0.001599, 0.760939, -0.001599, 1.008251, 2.180127,
+    2.112911, 1.738111, 0.921483, 2.486174, 2.3239, 1.960299, 1.286879, -0.001599,
+    0.978707, 0.73649, 2.232547, 2.36673, 2.038545, 1.396538, 1.724846, 2.054583,
+    2.04022, 1.610595, 1.365983, 1.768159, 1.950427, 1.614802, 1.712232, 1.896239,
+    1.906983, 1.700643, 1.855889, 2.02578, 2.080363, 1.80099, 1.545877, 1.751336,
+    1.842766, 1.523488, 1.493454, 1.443599, 1.341115, 1.16131, 1.56217, 1.183111,
+    1.318391, 0.960131, 0.593519, -0.001599, -0.001599, -0.001599, -0.001599, -0.001599,
+    1.420479, 1.503511, 1.122619, 0.596276, 1.265387, 1.522288, 1.932741, 1.858408,
+    1.13156, 0.879353, 0.891677, 1.248018, 2.273394, 1.762862, 2.273378, 1.820673,
+    1.02995, -0.001599, 1.193458, 0.76289, -0.001599, 1.835902, 1.773478, 1.992866,
+    1.610598, 0.572974, -0.001599, 1.07735, 2.21787, 2.097618, 2.195142, 1.947314,
+    2.129566, 2.083813, 2.112655, 2.084924, 1.819169, 1.757718, 1.80391, 1.51811,
+    1.289646, 1.136948, 1.67789, 1.806823, 1.853567, 1.511286, 1.111389, 1.127629,
+    1.044276, 1.570188, 1.780111, 1.763494, 1.437489, 1.297262, 1.235579, 1.516764,
+    1.637158, 1.638551, 1.431057, 1.235282, 1.234081, 1.512784, 1.794359, 1.792156,
+    1.524453, 1.702945, 1.961981, 1.806842, 1.775255, 2.123459, 1.990453, 1.439175,
+    1.649499, 2.099702, 1.195553, 1.214816, 1.250222, 1.649499, 1.258231, 1.477342,
+    1.602477, 1.952254, 2.198946, 2.095049, 2.063462, 2.411666, 2.27866, 1.727382,
+    1.937706, 2.387908, 1.483759, 1.503023, 1.538428, 1.937706, 1.546437, 1.140358,
+    1.785314, 0.598846, -0.001599, 0.812134, 0.877354, 0.521022, -0.001599, 0.840666,
+    0.859028, 0.556538, -0.001599, 0.886882, 0.900361, 0.566358, -0.001598, 1.263202,
+    0.623326, 1.015694, 0.546802, 0.525718, -0.001599, -0.001599, -0.001598, -0.001598,
+    0.327508, 0.463294, 1.44143, 0.979162, -0.001599, 0.622702, 1.009016, -0.001599,
+    0.684346, -0.001598, 0.436458, -0.001598, 0.383177, -0.001598, 0.383576, -0.001598,
+    0.349385, 0.640087, -0.001598, 0.393092, -0.001598, 0.369166, -0.001598, 0.237431,
+    -0.001598, 0.192069, -0.001598, 0.192192, -0.001598, 0.186005, -0.001598, 0.224352,
+    0.548038, 0.586636, 0.670611, 0.677083, 0.817105, 1.020502, 1.17231, 0.931225,
+    0.8041, 1.081009, 0.947858, 1.062662, 1.150989, 0.938519, 0.963411, 0.913034,
+    0.525718, -0.001598, 0.550094, -0.001598, 0.465103, 0.491695, -0.001598, -0.001598,
+    1.191188, 0.982635, 0.667284, 0.935055, 1.036852, 0.802012, 0.935055, 1.117702,
+    1.117702, 1.117702, 0.935055, 1.036852, 1.036852, 1.117702, 1.117702, 1.117702,
+    0.457806, 0.376929, 0.498554, 0.619908, 0.605815, 0.414238, 0.44497, 0.566318,
+    0.534862, 0.326659, 0.307187, -0.001598, 0.292569, -0.001598, -0.001598, 0.368969,
+    0.279999, -0.001598, 0.854898, 0.864122, 0.936942, 0.954962, 1.084158, 0.514751,
+    0.622536, 0.90035, 1.21799, 1.250054, 1.543462, 1.78663, 2.091479, 2.35605,
+    1.61373, 2.156718, 2.55509, 2.431838, 2.557906, 1.0629, 1.348209, 1.622262,
+    2.127903, 2.406942, 2.110326, 2.434194, 1.637133, 1.370946, 2.096436, 1.512938,
+    -0.001598, 0.364494, 1.10834, -0.001599, -0.001599, -0.001599, 0.164085, -0.001599,
+    -0.001599, 0.129928, -0.001599, -0.001599, 0.129928, -0.001599, -0.001599, 0.214051,
+    -0.001599, -0.001599, 0.454419, -0.001599, -0.001599, -0.001599, -0.001599, 1.264606,
+    1.217438, 1.41099, 1.32251, 1.457228, 1.472988, 1.436138, 1.57384, 1.362786,
+    1.420017, 1.594887, 1.625527, 1.564499, 1.753417, 1.439646, 1.664399, 1.68417,
+    1.413706, 1.662835, 1.70289, 1.63735, 1.53901, 1.337174, 1.724846, 1.647874,
+    1.154039, 1.326521, 0.593535, -0.001599, 0.579835, -0.001599, 0.585267, -0.001599,
+    0.623941, -0.001599, 1.037306, 1.696862, 1.294295, -0.001599, -0.001599, 0.680863,
+    -0.001599, 1.616956, 1.443452, 0.505621, 0.645035, 0.956281, 1.065423, 0.815419,
+    0.53977, 0.839079, 1.098175, 0.969207, 0.605723, 0.88311, 0.745849, 0.782944,
+    0.922806, 0.983444, 0.851538, 0.683201, 0.746879, 0.901608, 0.976169, 0.86766,
+    0.856598, 0.966588, 0.925028, 0.755181, 0.72417, 0.826444, 0.967073, 0.89783,
+    0.698337, 0.640001, 0.867282, -1.799081, -2.666138, -2.19285, -2.721502, -2.09189,
+    -2.374585, -1.542038, -1.71317, -0.68705, -0.815173, -0.002589, -0.002589, -1.285098,
+    -1.918258, -0.002589, -0.002589, -2.880522, -2.981222, -2.569926, -1.946442, -0.907258,
+    -0.002589, -2.387166, -1.356074, -1.420865, -0.002588, -1.06703, -0.002588, -0.979078,
+    -0.218239, -2.065893, -1.95895, -1.506626, -1.733018, -2.08415, -0.764622, -2.193734,
+    -2.409134, -2.253686, -1.70105, -1.133513, -0.002588, -0.765126, -0.002588, -1.012438,
+    -2.184314, -2.117099, -1.742298, -0.92567, -2.490362, -2.328088, -1.964486, -1.291066,
+    -0.002589, -0.982894, -0.740678, -2.236734, -2.370918, -2.042732, -1.400726, -1.729033,
+    -2.05877, -2.044408, -1.614782, -1.37017, -1.772346, -1.954614, -1.618989, -1.716419,
+    -1.900426, -1.91117, -1.70483, -1.860077, -2.029968, -2.08455, -1.805177, -1.550065,
+    -1.755523, -1.846953, -1.527676, -1.497641, -1.447786, -1.345302, -1.165498, -1.566358,
+    -1.187298, -1.322578, -0.964318, -0.597706, -0.002588, -0.002588, -0.002588, -0.002588,
+    -0.002588, -1.424667, -1.507698, -1.126806, -0.600463, -1.269574, -1.526475, -1.936928,
+    -1.862595, -1.135747, -0.883541, -0.895865, -1.252205, -2.277582, -1.76705, -2.277566,
+    -1.824861, -1.034137, -0.002589, -1.197646, -0.767078, -0.002589, -1.840089, -1.777666,
+    -1.997053, -1.614785, -0.577161, -0.002589, -1.081538, -2.222058, -2.101806, -2.19933,
+    -1.951502, -2.133754, -2.088, -2.116842, -2.089112, -1.823356, -1.761905, -1.808098,
+    -1.522298, -1.293833, -1.141136, -1.682078, -1.81101, -1.857754, -1.515474, -1.115576,
+    -1.131816, -1.048464, -1.574375, -1.784298, -1.767681, -1.441676, -1.30145, -1.239766,
+    -1.520952, -1.641345, -1.642739, -1.435245, -1.239469, -1.238268, -1.516971, -1.798546,
+    -1.796344, -1.52864, -1.707132, -1.966168, -1.811029, -1.779443, -2.127646, -1.994641,
+    -1.443363, -1.653687, -2.103889, -1.19974, -1.219004, -1.254409, -1.653687, -1.262418,
+    -1.481529, -1.606664, -1.956442, -2.203133, -2.099236, -2.067649, -2.415853, -2.282847,
+    -1.731569, -1.941893, -2.392096, -1.487947, -1.50721, -1.542616, -1.941893, -1.550625,
+    -1.144545, -1.789502, -0.603033, -0.002589, -0.816322, -0.881541, -0.525209, -0.002589,
+    -0.844853, -0.863215, -0.560725, -0.002589, -0.891069, -0.904548, -0.570545, -0.002589,
+    -1.26739, -0.627513, -1.019882, -0.550989, -0.529905, -0.002589, -0.002589, -0.002589,
+    -0.002589, -0.331695, -0.467482, -1.445618, -0.98335, -0.002589, -0.62689, -1.013203,
+    -0.002589, -0.688534, -0.002589, -0.440645, -0.002589, -0.387365, -0.002589, -0.387764,
+    -0.002589, -0.353572, -0.644275, -0.002589, -0.397279, -0.002589, -0.373353, -0.002589,
+    -0.241618, -0.002589, -0.196256, -0.002589, -0.19638, -0.002589, -0.190193, -0.002589,
+    -0.228539, -0.552225, -0.590824, -0.674798, -0.681271, -0.821292, -1.02469, -1.176497,
+    -0.935413, -0.808287, -1.085196, -0.952045, -1.066849, -1.155176, -0.942706, -0.967599,
+    -0.917222, -0.529905, -0.002589, -0.554282, -0.002589, -0.46929, -0.495882, -0.002589,
+    -0.002589, -1.195375, -0.986823, -0.671471, -0.939242, -1.041039, -0.8062, -0.939242,
+    -1.121889, -1.121889, -1.121889, -0.939242, -1.041039, -1.041039, -1.121889, -1.121889,
+    -1.121889, -0.461993, -0.381116, -0.502741, -0.624095, -0.610002, -0.418425, -0.449157,
+    -0.570505, -0.539049, -0.330847, -0.311375, -0.002589, -0.296756, -0.002589, -0.002589,
+    -0.373156, -0.284187, -0.002589, -0.859085, -0.868309, -0.941129, -0.959149, -1.088345,
+    -0.518939, -0.626723, -0.904537, -1.222177, -1.254241, -1.547649, -1.790817, -2.095666,
+    -2.360237, -1.617917, -2.160905, -2.559277, -2.436025, -2.562093, -1.067087, -1.352397,
+    -1.626449, -2.13209, -2.411129, -2.114513, -2.438381, -1.641321, -1.375133, -2.100623,
+    -1.517125, -0.002589, -0.368681, -1.112527, -0.002588, -0.002588, -0.002588, -0.168272,
+    -0.002588, -0.002588, -0.134115, -0.002588, -0.002588, -0.134115, -0.002588, -0.002588,
+    -0.218238, -0.002588, -0.002588, -0.458606, -0.002588, -0.002588, -0.002588, -0.002588,
+    -1.268793, -1.221625, -1.415177, -1.326697, -1.461415, -1.477175, -1.440325, -1.578028,
+    -1.366973, -1.424204, -1.599075, -1.629714, -1.568686, -1.757604, -1.443833, -1.668587,
+    -1.688357, -1.417893, -1.667022, -1.707077, -1.641537, -1.543197, -1.341361, -1.729033,
+    -1.652061, -1.158226, -1.330709, -0.597722, -0.002588, -0.584022, -0.002588, -0.589454,
+    -0.002588, -0.628129, -0.002588, -1.041493, -1.70105, -1.298482, -0.002588, -0.002588,
+    -0.68505, -0.002588, -1.621144, -1.447639, -0.509809, -0.649222, -0.960468, -1.06961,
+    -0.819606, -0.543958, -0.843266, -1.102362, -0.973395, -0.60991, -0.887298, -0.750037,
+    -0.787131, -0.926993, -0.987631, -0.855725, -0.687389, -0.751067, -0.905795, -0.980357,
+    -0.871847, -0.860786, -0.970775, -0.929215, -0.759368, -0.728357, -0.830632, -0.97126,
+    -0.902017, -0.702524, -0.644189, -0.871469
+};
+alignas(16) constexpr float cowVertsY[1732] = {
+    4.83536, 4.94608, 5.86984, 6.01616, 7.083, 7.22128, 8.1498, 8.1852,
+    9.17272, 9.01916, 9.470921, 9.48256, 4.12776, 3.855844, 3.664988, 3.189268,
+    4.8796, 5.809, 7.16064, 8.13888, 9.470338, 9.56328, 3.915193, 3.284092,
+    9.297747, 9.65968, 9.559751, 9.77216, 9.45692, 9.62156, 8.28696, 8.63824,
+    8.93868, 9.17692, 8.32408, 9.574411, 7.21064, 6.47972, 5.48552, 4.8084,
+    3.703308, 3.395072, 8.99912, 9.237841, 8.51292, 7.37804, 7.32866, 7.171855,
+    7.09284, 6.44612, 6.54836, 6.37976, 6.19092, 3.19378, 3.195425, 3.76932,
+    5.19668, 5.51132, 5.296397, 5.203373, 4.44348, 4.27716, 4.18312, 4.33704,
+    2.924004, 3.055436, 3.194888, 3.344628, 1.537735, 1.549825, 1.496764, 1.393316,
+    1.130518, 1.101237, 1.000584, 0.905667, 2.367944, 2.401676, 2.348604, 0.906661,
+    1.465865, 2.295212, 3.306012, 4.36396, 3.895967, 3.823008, 3.383824, 6.27508,
+    6.75048, 8.91284, 8.18572, 7.23668, 6.8002, 9.5328, 3.983788, 4.16464,
+    3.56639, 3.455431, 3.039392, 1.002507, 3.635903, 3.440387, 5.203373, 4.107274,
+    4.656047, 4.460584, 5.68996, 4.77524, 7.15396, 8.06748, 9.02872, 9.56192,
+    4.0668, 3.710536, 3.668773, 5.36928, 4.952685, 6.854721, 7.792, 9.37256,
+    9.552738, 3.611476, 5.78328, 5.2452, 5.22356, 5.325722, 4.71108, 4.771,
+    4.18712, 4.24744, 4.72496, 4.236, 4.11864, 4.6626, 4.253766, 3.59968,
+    3.253093, 3.546976, 3.386657, 3.422843, 3.839711, 2.735891, 2.879685, 2.680212,
+    2.720263, 2.708198, 2.738001, 1.877803, 1.891119, 1.861987, 1.926468, 1.87635,
+    1.963384, 0.906661, 1.002507, 0.905666, 1.101236, 1.000584, 1.130518, 0.826082,
+    0.796801, 0.644565, 0.035412, 0.006131, 0.613355, 0.775415, 0.57833, -0.008211,
+    0.673136, 0.035412, 0.592586, 0.273, 0.297792, 2.269936, 2.280894, 0.826083,
+    0.796801, 0.644565, 0.035413, 0.006131, 0.613355, 0.775415, 0.57833, -0.008211,
+    0.673137, 0.035413, 0.592586, 0.273, 0.297792, 7.891648, 6.77652, 9.31412,
+    9.6004, 8.440787, 7.31364, 9.5398, 9.90892, 8.99392, 7.91712, 9.90112,
+    10.239, 9.128822, 8.120859, 10.30388, 10.600233, 6.79948, 6.543, 6.00548,
+    7.40152, 7.627468, 6.16316, 5.171801, 7.13888, 7.52242, 6.19808, 5.19456,
+    5.764, 4.772, 4.08628, 3.931644, 3.992274, 3.534748, 3.541418, 10.960683,
+    10.936337, 10.999388, 10.977563, 10.86216, 10.84427, 10.601476, 10.576267, 10.394019,
+    10.225917, 10.201584, 9.880316, 9.820226, 9.447278, 9.411846, 9.07548, 9.02802,
+    8.827036, 8.792901, 8.611904, 8.604106, 8.209594, 8.210886, 8.757909, 8.897457,
+    8.297398, 8.43168, 9.589754, 9.366241, 8.758717, 10.292948, 10.43716, 10.018246,
+    10.04392, 9.642462, 9.266621, 9.159949, 8.261222, 9.843362, 7.748917, 7.659642,
+    7.761541, 7.699033, 8.012096, 7.987913, 7.895057, 7.912911, 8.410602, 8.139176,
+    8.205983, 10.12165, 9.977836, 9.875558, 9.878813, 9.970797, 10.159487, 9.85067,
+    9.757633, 9.538399, 9.683908, 9.58974, 9.739426, 9.760651, 8.7256, 8.58792,
+    8.77832, 8.184112, 8.085866, 8.201836, 8.38412, 8.57448, 8.42572, 8.45348,
+    7.968013, 7.901245, 8.064198, 8.04586, 8.185915, 8.183822, 8.166083, 8.160228,
+    10.87688, 11.04064, 10.54472, 10.88804, 10.59272, 10.746188, 10.534443, 10.36528,
+    10.437201, 10.30172, 10.58744, 10.30484, 10.746728, 10.45676, 9.627604, 9.731145,
+    10.24944, 10.69092, 10.54136, 10.5204, 10.320953, 10.46528, 10.634247, 10.28348,
+    9.889126, 10.523206, 9.798966, 9.95241, 10.218478, 10.152135, 10.772967, 8.526902,
+    9.840354, 9.988833, 9.914669, 9.572687, 9.700725, 9.908785, 9.564801, 9.700725,
+    9.876197, 9.564801, 9.700726, 9.876197, 9.507756, 9.700726, 9.997272, 9.344654,
+    9.850549, 10.610927, 9.699921, 10.581338, 10.497425, 11.14376, 11.024343, 11.120135,
+    10.75976, 10.932266, 11.030109, 11.178761, 11.26384, 11.27904, 10.7038, 10.854529,
+    10.91108, 11.00402, 11.05716, 10.80464, 11.1036, 10.993155, 11.0612, 11.166,
+    11.248673, 11.233616, 11.2196, 5.052166, 4.633626, 3.946692, 3.828506, 3.380316,
+    5.79516, 5.7848, 5.145279, 5.138303, 4.376737, 4.337232, 3.715187, 3.67543,
+    5.12232, 3.997753, 3.427225, 3.076642, 3.008528, 3.255028, 3.182103, 5.178176,
+    5.625378, 3.142452, 3.234981, 3.355323, 3.305106, 3.197063, 3.085804, 3.167853,
+    3.274744, 3.278238, 3.140439, 2.659735, 2.663094, 2.67731, 2.686379, 2.677238,
+    3.073414, 3.026098, 3.052005, 3.126487, 3.131215, 2.600322, 2.665395, 2.697442,
+    2.701589, 2.667513, 2.647258, 3.107026, 3.146563, 3.174708, 3.148127, 3.079077,
+    2.608193, 4.83536, 4.94608, 5.86984, 6.01616, 7.083, 7.22128, 8.1498,
+    8.1852, 9.17272, 9.01916, 9.470921, 9.48256, 4.12776, 3.855844, 3.664988,
+    3.189268, 4.8796, 5.809, 7.16064, 8.13888, 9.470338, 9.56328, 3.915193,
+    3.284092, 9.297747, 9.65968, 9.559751, 9.77216, 9.45692, 9.62156, 8.28696,
+    8.63824, 8.93868, 9.17692, 8.32408, 9.574411, 7.21064, 6.47972, 5.48552,
+    4.8084, 3.703308, 3.395072, 8.99912, 9.237841, 8.51292, 7.37804, 7.32866,
+    7.171855, 7.09284, 6.44612, 6.54836, 6.37976, 6.19092, 3.19378, 3.195425,
+    3.76932, 5.19668, 5.51132, 5.296397, 5.203373, 4.44348, 4.27716, 4.18312,
+    4.33704, 2.924004, 3.055436, 3.194888, 3.344628, 1.537735, 1.549825, 1.496764,
+    1.393316, 1.130518, 1.101237, 1.000584, 0.905667, 2.367944, 2.401676, 2.348604,
+    0.906661, 1.465865, 2.295212, 3.306012, 4.36396, 3.895967, 3.823008, 3.383824,
+    6.27508, 6.75048, 8.91284, 8.18572, 7.23668, 6.8002, 9.5328, 3.983788,
+    4.16464, 3.56639, 3.455431, 3.039392, 1.002507, 3.635903, 3.440387, 5.203373,
+    4.107274, 4.656047, 4.460584, 5.68996, 4.77524, 7.15396, 8.06748, 9.02872,
+    9.56192, 4.0668, 3.710536, 3.668773, 5.36928, 4.952685, 6.854721, 7.792,
+    9.37256, 9.552738, 3.611476, 5.78328, 5.2452, 5.22356, 5.325722, 4.71108,
+    4.771, 4.18712, 4.24744, 4.72496, 4.236, 4.11864, 4.6626, 4.253766,
+    3.59968, 3.253093, 3.546976, 3.386657, 3.422843, 3.839711, 2.735891, 2.879685,
+    2.680212, 2.720263, 2.708198, 2.738001, 1.877803, 1.891119, 1.861987, 1.926468,
+    1.87635, 1.963384, 0.906661, 1.002507, 0.905666, 1.101236, 1.000584, 1.130518,
+    0.826082, 0.796801, 0.644565, 0.035412, 0.006131, 0.613355, 0.775415, 0.57833,
+    -0.008211, 0.673136, 0.035412, 0.592586, 0.273, 0.297792, 2.269936, 2.280894,
+    0.826083, 0.796801, 0.644565, 0.035413, 0.006131, 0.613355, 0.775415, 0.57833,
+    -0.008211, 0.673137, 0.035413, 0.592586, 0.273, 0.297792, 7.891648, 6.77652,
+    9.31412, 9.6004, 8.440787, 7.31364, 9.5398, 9.90892, 8.99392, 7.91712,
+    9.90112, 10.239, 9.128822, 8.120859, 10.30388, 10.600233, 6.79948, 6.543,
+    6.00548, 7.40152, 7.627468, 6.16316, 5.171801, 7.13888, 7.52242, 6.19808,
+    5.19456, 5.764, 4.772, 4.08628, 3.931644, 3.992274, 3.534748, 3.541418,
+    10.960683, 10.936337, 10.999388, 10.977563, 10.86216, 10.84427, 10.601476, 10.576267,
+    10.394019, 10.225917, 10.201584, 9.880316, 9.820226, 9.447278, 9.411846, 9.07548,
+    9.02802, 8.827036, 8.792901, 8.611904, 8.604106, 8.209594, 8.210886, 8.757909,
+    8.897457, 8.297398, 8.43168, 9.589754, 9.366241, 8.758717, 10.292948, 10.43716,
+    10.018246, 10.04392, 9.642462, 9.266621, 9.159949, 8.261222, 9.843362, 7.748917,
+    7.659642, 7.761541, 7.699033, 8.012096, 7.987913, 7.895057, 7.912911, 8.410602,
+    8.139176, 8.205983, 10.12165, 9.977836, 9.875558, 9.878813, 9.970797, 10.159487,
+    9.85067, 9.757633, 9.538399, 9.683908, 9.58974, 9.739426, 9.760651, 8.7256,
+    8.58792, 8.77832, 8.184112, 8.085866, 8.201836, 8.38412, 8.57448, 8.42572,
+    8.45348, 7.968013, 7.901245, 8.064198, 8.04586, 8.185915, 8.183822, 8.166083,
+    8.160228, 10.87688, 11.04064, 10.54472, 10.88804, 10.59272, 10.746188, 10.534443,
+    10.36528, 10.437201, 10.30172, 10.58744, 10.30484, 10.746728, 10.45676, 9.627604,
+    9.731145, 10.24944, 10.69092, 10.54136, 10.5204, 10.320953, 10.46528, 10.634247,
+    10.28348, 9.889126, 10.523206, 9.798966, 9.95241, 10.218478, 10.152135, 10.772967,
+    8.526902, 9.840354, 9.988833, 9.914669, 9.572687, 9.700725, 9.908785, 9.564801,
+    9.700725, 9.876197, 9.564801, 9.700726, 9.876197, 9.507756, 9.700726, 9.997272,
+    9.344654, 9.850549, 10.610927, 9.699921, 10.581338, 10.497425, 11.14376, 11.024343,
+    11.120135, 10.75976, 10.932266, 11.030109, 11.178761, 11.26384, 11.27904, 10.7038,
+    10.854529, 10.91108, 11.00402, 11.05716, 10.80464, 11.1036, 10.993155, 11.0612,
+    11.166, 11.248673, 11.233616, 11.2196, 5.052166, 4.633626, 3.946692, 3.828506,
+    3.380316, 5.79516, 5.7848, 5.145279, 5.138303, 4.376737, 4.337232, 3.715187,
+    3.67543, 5.12232, 3.997753, 3.427225, 3.076642, 3.008528, 3.255028, 3.182103,
+    5.178176, 5.625378, 3.142452, 3.234981, 3.355323, 3.305106, 3.197063, 3.085804,
+    3.167853, 3.274744, 3.278238, 3.140439, 2.659735, 2.663094, 2.67731, 2.686379,
+    2.677238, 3.073414, 3.026098, 3.052005, 3.126487, 3.131215, 2.600322, 2.665395,
+    2.697442, 2.701589, 2.667513, 2.647258, 3.107026, 3.146563, 3.174708, 3.148127,
+    3.079077, 2.608193, 4.83536, 4.94608, 5.86984, 6.01616, 7.083, 7.22128,
+    8.1498, 8.1852, 9.17272, 9.01916, 9.470921, 9.48256, 4.12776, 3.855844,
+    3.664988, 3.189268, 4.8796, 5.809, 7.16064, 8.13888, 9.470338, 9.56328,
+    3.915193, 3.284092, 9.297747, 9.65968, 9.559751, 9.77216, 9.45692, 9.62156,
+    8.28696, 8.63824, 8.93868, 9.17692, 8.32408, 9.574411, 7.21064, 6.47972,
+    5.48552, 4.8084, 3.703308, 3.395072, 8.99912, 9.237841, 8.51292, 7.37804,
+    7.32866, 7.171855, 7.09284, 6.44612, 6.54836, 6.37976, 6.19092, 3.19378,
+    3.195425, 3.76932, 5.19668, 5.51132, 5.296397, 5.203373, 4.44348, 4.27716,
+    4.18312, 4.33704, 2.924004, 3.055436, 3.194888, 3.344628, 1.537735, 1.549825,
+    1.496764, 1.393316, 1.130518, 1.101237, 1.000584, 0.905667, 2.367944, 2.401676,
+    2.348604, 0.906661, 1.465865, 2.295212, 3.306012, 4.36396, 3.895967, 3.823008,
+    3.383824, 6.27508, 6.75048, 8.91284, 8.18572, 7.23668, 6.8002, 9.5328,
+    3.983788, 4.16464, 3.56639, 3.455431, 3.039392, 1.002507, 3.635903, 3.440387,
+    5.203373, 4.107274, 4.656047, 4.460584, 5.68996, 4.77524, 7.15396, 8.06748,
+    9.02872, 9.56192, 4.0668, 3.710536, 3.668773, 5.36928, 4.952685, 6.854721,
+    7.792, 9.37256, 9.552738, 3.611476, 5.78328, 5.2452, 5.22356, 5.325722,
+    4.71108, 4.771, 4.18712, 4.24744, 4.72496, 4.236, 4.11864, 4.6626,
+    4.253766, 3.59968, 3.253093, 3.546976, 3.386657, 3.422843, 3.839711, 2.735891,
+    2.879685, 2.680212, 2.720263, 2.708198, 2.738001, 1.877803, 1.891119, 1.861987,
+    1.926468, 1.87635, 1.963384, 0.906661, 1.002507, 0.905666, 1.101236, 1.000584,
+    1.130518, 0.826082, 0.796801, 0.644565, 0.035412, 0.006131, 0.613355, 0.775415,
+    0.57833, -0.008211, 0.673136, 0.035412, 0.592586, 0.273, 0.297792, 2.269936,
+    2.280894, 0.826083, 0.796801, 0.644565, 0.035413, 0.006131, 0.613355, 0.775415,
+    0.57833, -0.008211, 0.673137, 0.035413, 0.592586, 0.273, 0.297792, 7.891648,
+    6.77652, 9.31412, 9.6004, 8.440787, 7.31364, 9.5398, 9.90892, 8.99392,
+    7.91712, 9.90112, 10.239, 9.128822, 8.120859, 10.30388, 10.600233, 6.79948,
+    6.543, 6.00548, 7.40152, 7.627468, 6.16316, 5.171801, 7.13888, 7.52242,
+    6.19808, 5.19456, 5.764, 4.772, 4.08628, 3.931644, 3.992274, 3.534748,
+    3.541418, 10.960683, 10.936337, 10.999388, 10.977563, 10.86216, 10.84427, 10.601476,
+    10.576267, 10.394019, 10.225917, 10.201584, 9.880316, 9.820226, 9.447278, 9.411846,
+    9.07548, 9.02802, 8.827036, 8.792901, 8.611904, 8.604106, 8.209594, 8.210886,
+    8.757909, 8.897457, 8.297398, 8.43168, 9.589754, 9.366241, 8.758717, 10.292948,
+    10.43716, 10.018246, 10.04392, 9.642462, 9.266621, 9.159949, 8.261222, 9.843362,
+    7.748917, 7.659642, 7.761541, 7.699033, 8.012096, 7.987913, 7.895057, 7.912911,
+    8.410602, 8.139176, 8.205983, 10.12165, 9.977836, 9.875558, 9.878813, 9.970797,
+    10.159487, 9.85067, 9.757633, 9.538399, 9.683908, 9.58974, 9.739426, 9.760651,
+    8.7256, 8.58792, 8.77832, 8.184112, 8.085866, 8.201836, 8.38412, 8.57448,
+    8.42572, 8.45348, 7.968013, 7.901245, 8.064198, 8.04586, 8.185915, 8.183822,
+    8.166083, 8.160228, 10.87688, 11.04064, 10.54472, 10.88804, 10.59272, 10.746188,
+    10.534443, 10.36528, 10.437201, 10.30172, 10.58744, 10.30484, 10.746728, 10.45676,
+    9.627604, 9.731145, 10.24944, 10.69092, 10.54136, 10.5204, 10.320953, 10.46528,
+    10.634247, 10.28348, 9.889126, 10.523206, 9.798966, 9.95241, 10.218478, 10.152135,
+    10.772967, 8.526902, 9.840354, 9.988833, 9.914669, 9.572687, 9.700725, 9.908785,
+    9.564801, 9.700725, 9.876197, 9.564801, 9.700726, 9.876197, 9.507756, 9.700726,
+    9.997272, 9.344654, 9.850549, 10.610927, 9.699921, 10.581338, 10.497425, 11.14376,
+    11.024343, 11.120135, 10.75976, 10.932266, 11.030109, 11.178761, 11.26384, 11.27904,
+    10.7038, 10.854529, 10.91108, 11.00402, 11.05716, 10.80464, 11.1036, 10.993155,
+    11.0612, 11.166, 11.248673, 11.233616, 11.2196, 5.052166, 4.633626, 3.946692,
+    3.828506, 3.380316, 5.79516, 5.7848, 5.145279, 5.138303, 4.376737, 4.337232,
+    3.715187, 3.67543, 5.12232, 3.997753, 3.427225, 3.076642, 3.008528, 3.255028,
+    3.182103, 5.178176, 5.625378, 3.142452, 3.234981, 3.355323, 3.305106, 3.197063,
+    3.085804, 3.167853, 3.274744, 3.278238, 3.140439, 2.659735, 2.663094, 2.67731,
+    2.686379, 2.677238, 3.073414, 3.026098, 3.052005, 3.126487, 3.131215, 2.600322,
+    2.665395, 2.697442, 2.701589, 2.667513, 2.647258, 3.107026, 3.146563, 3.174708,
+    3.148127, 3.079077, 2.608193, 4.83536, 4.94608, 5.86984, 6.01616, 7.083,
+    7.22128, 8.1498, 8.1852, 9.17272, 9.01916, 9.470921, 9.48256, 4.12776,
+    3.855844, 3.664988, 3.189268, 4.8796, 5.809, 7.16064, 8.13888, 9.470338,
+    9.56328, 3.915193, 3.284092, 9.297747, 9.65968, 9.559751, 9.77216, 9.45692,
+    9.62156, 8.28696, 8.63824, 8.93868, 9.17692, 8.32408, 9.574411, 7.21064,
+    6.47972, 5.48552, 4.8084, 3.703308, 3.395072, 8.99912, 9.237841, 8.51292,
+    7.37804, 7.32866, 7.171855, 7.09284, 6.44612, 6.54836, 6.37976, 6.19092,
+    3.19378, 3.195425, 3.76932, 5.19668, 5.51132, 5.296397, 5.203373, 4.44348,
+    4.27716, 4.18312, 4.33704, 2.924004, 3.055436, 3.194888, 3.344628, 1.537735,
+    1.549825, 1.496764, 1.393316, 1.130518, 1.101237, 1.000584, 0.905667, 2.367944,
+    2.401676, 2.348604, 0.906661, 1.465865, 2.295212, 3.306012, 4.36396, 3.895967,
+    3.823008, 3.383824, 6.27508, 6.75048, 8.91284, 8.18572, 7.23668, 6.8002,
+    9.5328, 3.983788, 4.16464, 3.56639, 3.455431, 3.039392, 1.002507, 3.635903,
+    3.440387, 5.203373, 4.107274, 4.656047, 4.460584, 5.68996, 4.77524, 7.15396,
+    8.06748, 9.02872, 9.56192, 4.0668, 3.710536, 3.668773, 5.36928, 4.952685,
+    6.854721, 7.792, 9.37256, 9.552738, 3.611476, 5.78328, 5.2452, 5.22356,
+    5.325722, 4.71108, 4.771, 4.18712, 4.24744, 4.72496, 4.236, 4.11864,
+    4.6626, 4.253766, 3.59968, 3.253093, 3.546976, 3.386657, 3.422843, 3.839711,
+    2.735891, 2.879685, 2.680212, 2.720263, 2.708198, 2.738001, 1.877803, 1.891119,
+    1.861987, 1.926468, 1.87635, 1.963384, 0.906661, 1.002507, 0.905666, 1.101236,
+    1.000584, 1.130518, 0.826082, 0.796801, 0.644565, 0.035412, 0.006131, 0.613355,
+    0.775415, 0.57833, -0.008211, 0.673136, 0.035412, 0.592586, 0.273, 0.297792,
+    2.269936, 2.280894, 0.826083, 0.796801, 0.644565, 0.035413, 0.006131, 0.613355,
+    0.775415, 0.57833, -0.008211, 0.673137, 0.035413, 0.592586, 0.273, 0.297792,
+    7.891648, 6.77652, 9.31412, 9.6004, 8.440787, 7.31364, 9.5398, 9.90892,
+    8.99392, 7.91712, 9.90112, 10.239, 9.128822, 8.120859, 10.30388, 10.600233,
+    6.79948, 6.543, 6.00548, 7.40152, 7.627468, 6.16316, 5.171801, 7.13888,
+    7.52242, 6.19808, 5.19456, 5.764, 4.772, 4.08628, 3.931644, 3.992274,
+    3.534748, 3.541418, 10.960683, 10.936337, 10.999388, 10.977563, 10.86216, 10.84427,
+    10.601476, 10.576267, 10.394019, 10.225917, 10.201584, 9.880316, 9.820226, 9.447278,
+    9.411846, 9.07548, 9.02802, 8.827036, 8.792901, 8.611904, 8.604106, 8.209594,
+    8.210886, 8.757909, 8.897457, 8.297398, 8.43168, 9.589754, 9.366241, 8.758717,
+    10.292948, 10.43716, 10.018246, 10.04392, 9.642462, 9.266621, 9.159949, 8.261222,
+    9.843362, 7.748917, 7.659642, 7.761541, 7.699033, 8.012096, 7.987913, 7.895057,
+    7.912911, 8.410602, 8.139176, 8.205983, 10.12165, 9.977836, 9.875558, 9.878813,
+    9.970797, 10.159487, 9.85067, 9.757633, 9.538399, 9.683908, 9.58974, 9.739426,
+    9.760651, 8.7256, 8.58792, 8.77832, 8.184112, 8.085866, 8.201836, 8.38412,
+    8.57448, 8.42572, 8.45348, 7.968013, 7.901245, 8.064198, 8.04586, 8.185915,
+    8.183822, 8.166083, 8.160228, 10.87688, 11.04064, 10.54472, 10.88804, 10.59272,
+    10.746188, 10.534443, 10.36528, 10.437201, 10.30172, 10.58744, 10.30484, 10.746728,
+    10.45676, 9.627604, 9.731145, 10.24944, 10.69092, 10.54136, 10.5204, 10.320953,
+    10.46528, 10.634247, 10.28348, 9.889126, 10.523206, 9.798966, 9.95241, 10.218478,
+    10.152135, 10.772967, 8.526902, 9.840354, 9.988833, 9.914669, 9.572687, 9.700725,
+    9.908785, 9.564801, 9.700725, 9.876197, 9.564801, 9.700726, 9.876197, 9.507756,
+    9.700726, 9.997272, 9.344654, 9.850549, 10.610927, 9.699921, 10.581338, 10.497425,
+    11.14376, 11.024343, 11.120135, 10.75976, 10.932266, 11.030109, 11.178761, 11.26384,
+    11.27904, 10.7038, 10.854529, 10.91108, 11.00402, 11.05716, 10.80464, 11.1036,
+    10.993155, 11.0612, 11.166, 11.248673, 11.233616, 11.2196, 5.052166, 4.633626,
+    3.946692, 3.828506, 3.380316, 5.79516, 5.7848, 5.145279, 5.138303, 4.376737,
+    4.337232, 3.715187, 3.67543, 5.12232, 3.997753, 3.427225, 3.076642, 3.008528,
+    3.255028, 3.182103, 5.178176, 5.625378, 3.142452, 3.234981, 3.355323, 3.305106,
+    3.197063, 3.085804, 3.167853, 3.274744, 3.278238, 3.140439, 2.659735, 2.663094,
+    2.67731, 2.686379, 2.677238, 3.073414, 3.026098, 3.052005, 3.126487, 3.131215,
+    2.600322, 2.665395, 2.697442, 2.701589, 2.667513, 2.647258, 3.107026, 3.146563,
+    3.174708, 3.148127, 3.079077, 2.608193
+};
+alignas(16) constexpr float cowVertsZ[1732] = {
+    0.48091, -1.139387, 0.516773, -1.116395, 0.479657, -1.379611, 0.335179, -1.523856,
+    -1.613787, 0.103545, -1.580104, 0.117406, 0.450461, -1.303987, 0.458912, -1.449995,
+    -3.075891, -3.033963, -3.152591, -3.293735, -3.455935, -3.256187, -2.98284, -2.890532,
+    -5.006539, -4.928147, -5.964139, -5.8895, -7.16338, -7.13774, -5.225019, -5.910699,
+    -6.95658, -3.966299, -4.233459, -4.945499, -4.343579, -4.522099, -4.76234, -4.761899,
+    -4.000579, -4.015339, -7.631309, -7.618429, -7.555789, -5.1549, -6.037111, -6.976207,
+    -7.471979, -4.817219, -5.91438, -6.74874, -7.27426, -2.862155, -1.342476, 0.433324,
+    -5.190259, -5.789979, -6.63598, -6.971558, -5.2437, -5.7023, -6.435699, -6.955579,
+    -6.298955, -6.3566, -6.874987, -7.33114, -6.494098, -6.516954, -6.812739, -7.0651,
+    -6.269988, -6.445157, -6.73899, -7.103271, -6.490252, -6.519512, -6.96314, -6.997555,
+    -6.825899, -6.88214, -7.34526, -6.852463, -7.07058, -7.01797, -5.99754, -7.29634,
+    -7.410299, -7.71778, -7.563499, -7.4263, -7.4401, -7.15882, -5.5191, -4.30942,
+    -6.584401, -3.981575, -6.809807, -6.519324, -6.678947, -6.150438, -6.902589, -6.243761,
+    -5.876886, -5.320836, 1.783329, 0.959476, 1.738761, 1.596262, 1.477093, 1.391948,
+    0.925357, 0.980685, 1.618383, 3.028197, 2.783089, 3.223421, 3.054209, 2.520248,
+    2.441653, 2.285029, 2.542033, 2.457094, 1.715389, 1.153829, 1.706645, 2.452585,
+    1.573724, 2.291265, 2.741581, 2.599097, 1.346381, 2.754385, 2.628665, 1.386018,
+    1.388502, 2.238917, 1.591507, 2.433584, 2.49034, 1.723782, 2.26118, 1.578479,
+    2.238599, 1.750158, 2.413216, 1.840571, 2.155779, 1.732621, 2.172413, 1.899102,
+    2.29103, 1.851654, 2.329885, 1.745938, 2.450578, 2.110218, 2.57922, 2.814579,
+    2.685449, 2.749436, 3.134964, 2.929407, 2.211241, 2.013405, 1.967777, 2.241517,
+    2.553154, 2.826838, 2.120104, 1.967777, 2.14015, -7.096584, -7.135912, -5.990945,
+    -6.163759, -6.099772, -5.714245, -5.919803, -6.637968, -6.835803, -6.881431, -6.607692,
+    -6.296054, -6.022371, -6.729105, -6.881432, -6.70906, 3.424662, 3.577733, 3.067576,
+    2.948788, 4.398236, 4.60814, 4.216141, 4.087437, 5.261061, 5.474844, 4.95854,
+    4.915461, 5.603967, 5.838484, 5.45014, 5.429509, 3.744148, 4.78114, 3.967356,
+    5.632861, 6.050893, 4.970261, 4.32154, 5.75174, 6.092512, 5.021261, 4.302821,
+    3.567649, 3.530088, 3.930281, 3.803532, 3.286026, 3.291969, 3.049304, 5.991881,
+    6.022153, 6.209205, 6.204185, 6.678741, 6.670771, 6.992806, 6.982558, 7.332838,
+    7.634021, 7.610962, 7.89185, 7.862846, 8.38395, 8.362971, 8.838781, 8.827456,
+    9.321155, 9.297422, 9.425635, 9.38671, 9.261407, 9.237742, 8.654314, 8.217725,
+    8.527203, 8.046989, 7.732928, 7.398088, 7.215217, 7.184463, 6.828553, 7.107795,
+    6.41498, 7.034461, 6.267135, 5.851286, 6.070321, 5.810553, 6.474141, 6.519702,
+    7.114379, 7.121011, 8.489944, 7.993187, 8.451196, 8.025408, 6.539258, 7.175103,
+    8.00771, 7.610795, 7.550657, 7.767465, 7.644979, 7.393955, 7.315015, 7.325798,
+    7.638615, 7.526416, 7.518304, 7.280652, 7.365016, 7.14847, 9.134901, 9.282141,
+    9.021621, 8.886935, 8.789263, 9.168058, 9.248061, 9.003421, 9.117101, 9.331461,
+    8.93809, 8.965159, 9.088527, 9.146748, 8.977086, 8.97296, 9.089196, 9.152395,
+    6.595381, 6.2727, 6.657421, 6.060381, 6.218461, 5.834745, 5.704831, 5.70702,
+    6.28086, 5.86014, 6.417941, 5.850281, 6.257605, 5.905434, 6.200912, 6.035568,
+    5.936452, 6.04242, 5.977332, 6.442822, 6.539421, 6.537112, 6.356922, 6.097309,
+    6.140787, 6.135803, 6.328025, 6.31531, 6.123482, 6.222389, 5.816736, 9.190677,
+    7.504834, -7.150352, -5.896802, -8.232147, -8.224747, -8.22368, -9.477296, -9.468407,
+    -9.468828, -10.58292, -10.578284, -10.574452, -11.628008, -11.627699, -11.625935, -12.779329,
+    -12.77902, -13.051553, -13.575122, -14.064795, -13.478335, 6.505381, 6.715941, 6.908369,
+    6.713341, 6.894556, 7.214794, 7.178582, 7.122494, 7.80922, 6.550742, 6.808812,
+    7.061201, 7.309751, 7.035236, 6.339821, 7.415321, 6.688581, 6.291701, 6.6948,
+    7.061949, 7.390554, 6.760243, -6.969872, -5.48745, -5.536535, -6.866847, -5.638816,
+    -7.504856, -7.541896, -7.617894, -7.672389, -7.548977, -7.601128, -7.161573, -7.273139,
+    -7.47126, -4.754455, -4.83297, -4.889535, -5.638063, -6.598912, -6.603194, -5.465988,
+    -6.29192, -4.887545, -4.537141, -4.582662, -4.883942, -5.098783, -5.640331, -5.468236,
+    -5.684091, -6.044376, -6.019818, -5.647167, -5.734576, -5.870777, -5.887852, -5.740717,
+    -5.6035, -5.699152, -5.886618, -5.920241, -5.709154, -5.787874, -4.91405, -4.825419,
+    -4.679581, -4.685552, -4.833247, -4.979762, -4.850222, -4.668745, -4.655683, -4.844859,
+    -4.782281, 0.48091, -1.139387, 0.516773, -1.116395, 0.479657, -1.379611, 0.335179,
+    -1.523856, -1.613787, 0.103545, -1.580104, 0.117406, 0.450461, -1.303987, 0.458912,
+    -1.449995, -3.075891, -3.033963, -3.152591, -3.293735, -3.455935, -3.256187, -2.98284,
+    -2.890532, -5.006539, -4.928147, -5.964139, -5.8895, -7.16338, -7.13774, -5.225019,
+    -5.910699, -6.95658, -3.966299, -4.233459, -4.945499, -4.343579, -4.522099, -4.76234,
+    -4.761899, -4.000579, -4.015339, -7.631309, -7.618429, -7.555789, -5.1549, -6.037111,
+    -6.976207, -7.471979, -4.817219, -5.91438, -6.74874, -7.27426, -2.862155, -1.342476,
+    0.433324, -5.190259, -5.789979, -6.63598, -6.971558, -5.2437, -5.7023, -6.435699,
+    -6.955579, -6.298955, -6.3566, -6.874987, -7.33114, -6.494098, -6.516954, -6.812739,
+    -7.0651, -6.269988, -6.445157, -6.73899, -7.103271, -6.490252, -6.519512, -6.96314,
+    -6.997555, -6.825899, -6.88214, -7.34526, -6.852463, -7.07058, -7.01797, -5.99754,
+    -7.29634, -7.410299, -7.71778, -7.563499, -7.4263, -7.4401, -7.15882, -5.5191,
+    -4.30942, -6.584401, -3.981575, -6.809807, -6.519324, -6.678947, -6.150438, -6.902589,
+    -6.243761, -5.876886, -5.320836, 1.783329, 0.959476, 1.738761, 1.596262, 1.477093,
+    1.391948, 0.925357, 0.980685, 1.618383, 3.028197, 2.783089, 3.223421, 3.054209,
+    2.520248, 2.441653, 2.285029, 2.542033, 2.457094, 1.715389, 1.153829, 1.706645,
+    2.452585, 1.573724, 2.291265, 2.741581, 2.599097, 1.346381, 2.754385, 2.628665,
+    1.386018, 1.388502, 2.238917, 1.591507, 2.433584, 2.49034, 1.723782, 2.26118,
+    1.578479, 2.238599, 1.750158, 2.413216, 1.840571, 2.155779, 1.732621, 2.172413,
+    1.899102, 2.29103, 1.851654, 2.329885, 1.745938, 2.450578, 2.110218, 2.57922,
+    2.814579, 2.685449, 2.749436, 3.134964, 2.929407, 2.211241, 2.013405, 1.967777,
+    2.241517, 2.553154, 2.826838, 2.120104, 1.967777, 2.14015, -7.096584, -7.135912,
+    -5.990945, -6.163759, -6.099772, -5.714245, -5.919803, -6.637968, -6.835803, -6.881431,
+    -6.607692, -6.296054, -6.022371, -6.729105, -6.881432, -6.70906, 3.424662, 3.577733,
+    3.067576, 2.948788, 4.398236, 4.60814, 4.216141, 4.087437, 5.261061, 5.474844,
+    4.95854, 4.915461, 5.603967, 5.838484, 5.45014, 5.429509, 3.744148, 4.78114,
+    3.967356, 5.632861, 6.050893, 4.970261, 4.32154, 5.75174, 6.092512, 5.021261,
+    4.302821, 3.567649, 3.530088, 3.930281, 3.803532, 3.286026, 3.291969, 3.049304,
+    5.991881, 6.022153, 6.209205, 6.204185, 6.678741, 6.670771, 6.992806, 6.982558,
+    7.332838, 7.634021, 7.610962, 7.89185, 7.862846, 8.38395, 8.362971, 8.838781,
+    8.827456, 9.321155, 9.297422, 9.425635, 9.38671, 9.261407, 9.237742, 8.654314,
+    8.217725, 8.527203, 8.046989, 7.732928, 7.398088, 7.215217, 7.184463, 6.828553,
+    7.107795, 6.41498, 7.034461, 6.267135, 5.851286, 6.070321, 5.810553, 6.474141,
+    6.519702, 7.114379, 7.121011, 8.489944, 7.993187, 8.451196, 8.025408, 6.539258,
+    7.175103, 8.00771, 7.610795, 7.550657, 7.767465, 7.644979, 7.393955, 7.315015,
+    7.325798, 7.638615, 7.526416, 7.518304, 7.280652, 7.365016, 7.14847, 9.134901,
+    9.282141, 9.021621, 8.886935, 8.789263, 9.168058, 9.248061, 9.003421, 9.117101,
+    9.331461, 8.93809, 8.965159, 9.088527, 9.146748, 8.977086, 8.97296, 9.089196,
+    9.152395, 6.595381, 6.2727, 6.657421, 6.060381, 6.218461, 5.834745, 5.704831,
+    5.70702, 6.28086, 5.86014, 6.417941, 5.850281, 6.257605, 5.905434, 6.200912,
+    6.035568, 5.936452, 6.04242, 5.977332, 6.442822, 6.539421, 6.537112, 6.356922,
+    6.097309, 6.140787, 6.135803, 6.328025, 6.31531, 6.123482, 6.222389, 5.816736,
+    9.190677, 7.504834, -7.150352, -5.896802, -8.232147, -8.224747, -8.22368, -9.477296,
+    -9.468407, -9.468828, -10.58292, -10.578284, -10.574452, -11.628008, -11.627699, -11.625935,
+    -12.779329, -12.77902, -13.051553, -13.575122, -14.064795, -13.478335, 6.505381, 6.715941,
+    6.908369, 6.713341, 6.894556, 7.214794, 7.178582, 7.122494, 7.80922, 6.550742,
+    6.808812, 7.061201, 7.309751, 7.035236, 6.339821, 7.415321, 6.688581, 6.291701,
+    6.6948, 7.061949, 7.390554, 6.760243, -6.969872, -5.48745, -5.536535, -6.866847,
+    -5.638816, -7.504856, -7.541896, -7.617894, -7.672389, -7.548977, -7.601128, -7.161573,
+    -7.273139, -7.47126, -4.754455, -4.83297, -4.889535, -5.638063, -6.598912, -6.603194,
+    -5.465988, -6.29192, -4.887545, -4.537141, -4.582662, -4.883942, -5.098783, -5.640331,
+    -5.468236, -5.684091, -6.044376, -6.019818, -5.647167, -5.734576, -5.870777, -5.887852,
+    -5.740717, -5.6035, -5.699152, -5.886618, -5.920241, -5.709154, -5.787874, -4.91405,
+    -4.825419, -4.679581, -4.685552, -4.833247, -4.979762, -4.850222, -4.668745, -4.655683,
+    -4.844859, -4.782281, 0.48091, -1.139387, 0.516773, -1.116395, 0.479657, -1.379611,
+    0.335179, -1.523856, -1.613787, 0.103545, -1.580104, 0.117406, 0.450461, -1.303987,
+    0.458912, -1.449995, -3.075891, -3.033963, -3.152591, -3.293735, -3.455935, -3.256187,
+    -2.98284, -2.890532, -5.006539, -4.928147, -5.964139, -5.8895, -7.16338, -7.13774,
+    -5.225019, -5.910699, -6.95658, -3.966299, -4.233459, -4.945499, -4.343579, -4.522099,
+    -4.76234, -4.761899, -4.000579, -4.015339, -7.631309, -7.618429, -7.555789, -5.1549,
+    -6.037111, -6.976207, -7.471979, -4.817219, -5.91438, -6.74874, -7.27426, -2.862155,
+    -1.342476, 0.433324, -5.190259, -5.789979, -6.63598, -6.971558, -5.2437, -5.7023,
+    -6.435699, -6.955579, -6.298955, -6.3566, -6.874987, -7.33114, -6.494098, -6.516954,
+    -6.812739, -7.0651, -6.269988, -6.445157, -6.73899, -7.103271, -6.490252, -6.519512,
+    -6.96314, -6.997555, -6.825899, -6.88214, -7.34526, -6.852463, -7.07058, -7.01797,
+    -5.99754, -7.29634, -7.410299, -7.71778, -7.563499, -7.4263, -7.4401, -7.15882,
+    -5.5191, -4.30942, -6.584401, -3.981575, -6.809807, -6.519324, -6.678947, -6.150438,
+    -6.902589, -6.243761, -5.876886, -5.320836, 1.783329, 0.959476, 1.738761, 1.596262,
+    1.477093, 1.391948, 0.925357, 0.980685, 1.618383, 3.028197, 2.783089, 3.223421,
+    3.054209, 2.520248, 2.441653, 2.285029, 2.542033, 2.457094, 1.715389, 1.153829,
+    1.706645, 2.452585, 1.573724, 2.291265, 2.741581, 2.599097, 1.346381, 2.754385,
+    2.628665, 1.386018, 1.388502, 2.238917, 1.591507, 2.433584, 2.49034, 1.723782,
+    2.26118, 1.578479, 2.238599, 1.750158, 2.413216, 1.840571, 2.155779, 1.732621,
+    2.172413, 1.899102, 2.29103, 1.851654, 2.329885, 1.745938, 2.450578, 2.110218,
+    2.57922, 2.814579, 2.685449, 2.749436, 3.134964, 2.929407, 2.211241, 2.013405,
+    1.967777, 2.241517, 2.553154, 2.826838, 2.120104, 1.967777, 2.14015, -7.096584,
+    -7.135912, -5.990945, -6.163759, -6.099772, -5.714245, -5.919803, -6.637968, -6.835803,
+    -6.881431, -6.607692, -6.296054, -6.022371, -6.729105, -6.881432, -6.70906, 3.424662,
+    3.577733, 3.067576, 2.948788, 4.398236, 4.60814, 4.216141, 4.087437, 5.261061,
+    5.474844, 4.95854, 4.915461, 5.603967, 5.838484, 5.45014, 5.429509, 3.744148,
+    4.78114, 3.967356, 5.632861, 6.050893, 4.970261, 4.32154, 5.75174, 6.092512,
+    5.021261, 4.302821, 3.567649, 3.530088, 3.930281, 3.803532, 3.286026, 3.291969,
+    3.049304, 5.991881, 6.022153, 6.209205, 6.204185, 6.678741, 6.670771, 6.992806,
+    6.982558, 7.332838, 7.634021, 7.610962, 7.89185, 7.862846, 8.38395, 8.362971,
+    8.838781, 8.827456, 9.321155, 9.297422, 9.425635, 9.38671, 9.261407, 9.237742,
+    8.654314, 8.217725, 8.527203, 8.046989, 7.732928, 7.398088, 7.215217, 7.184463,
+    6.828553, 7.107795, 6.41498, 7.034461, 6.267135, 5.851286, 6.070321, 5.810553,
+    6.474141, 6.519702, 7.114379, 7.121011, 8.489944, 7.993187, 8.451196, 8.025408,
+    6.539258, 7.175103, 8.00771, 7.610795, 7.550657, 7.767465, 7.644979, 7.393955,
+    7.315015, 7.325798, 7.638615, 7.526416, 7.518304, 7.280652, 7.365016, 7.14847,
+    9.134901, 9.282141, 9.021621, 8.886935, 8.789263, 9.168058, 9.248061, 9.003421,
+    9.117101, 9.331461, 8.93809, 8.965159, 9.088527, 9.146748, 8.977086, 8.97296,
+    9.089196, 9.152395, 6.595381, 6.2727, 6.657421, 6.060381, 6.218461, 5.834745,
+    5.704831, 5.70702, 6.28086, 5.86014, 6.417941, 5.850281, 6.257605, 5.905434,
+    6.200912, 6.035568, 5.936452, 6.04242, 5.977332, 6.442822, 6.539421, 6.537112,
+    6.356922, 6.097309, 6.140787, 6.135803, 6.328025, 6.31531, 6.123482, 6.222389,
+    5.816736, 9.190677, 7.504834, -7.150352, -5.896802, -8.232147, -8.224747, -8.22368,
+    -9.477296, -9.468407, -9.468828, -10.58292, -10.578284, -10.574452, -11.628008, -11.627699,
+    -11.625935, -12.779329, -12.77902, -13.051553, -13.575122, -14.064795, -13.478335, 6.505381,
+    6.715941, 6.908369, 6.713341, 6.894556, 7.214794, 7.178582, 7.122494, 7.80922,
+    6.550742, 6.808812, 7.061201, 7.309751, 7.035236, 6.339821, 7.415321, 6.688581,
+    6.291701, 6.6948, 7.061949, 7.390554, 6.760243, -6.969872, -5.48745, -5.536535,
+    -6.866847, -5.638816, -7.504856, -7.541896, -7.617894, -7.672389, -7.548977, -7.601128,
+    -7.161573, -7.273139, -7.47126, -4.754455, -4.83297, -4.889535, -5.638063, -6.598912,
+    -6.603194, -5.465988, -6.29192, -4.887545, -4.537141, -4.582662, -4.883942, -5.098783,
+    -5.640331, -5.468236, -5.684091, -6.044376, -6.019818, -5.647167, -5.734576, -5.870777,
+    -5.887852, -5.740717, -5.6035, -5.699152, -5.886618, -5.920241, -5.709154, -5.787874,
+    -4.91405, -4.825419, -4.679581, -4.685552, -4.833247, -4.979762, -4.850222, -4.668745,
+    -4.655683, -4.844859, -4.782281, 0.48091, -1.139387, 0.516773, -1.116395, 0.479657,
+    -1.379611, 0.335179, -1.523856, -1.613787, 0.103545, -1.580104, 0.117406, 0.450461,
+    -1.303987, 0.458912, -1.449995, -3.075891, -3.033963, -3.152591, -3.293735, -3.455935,
+    -3.256187, -2.98284, -2.890532, -5.006539, -4.928147, -5.964139, -5.8895, -7.16338,
+    -7.13774, -5.225019, -5.910699, -6.95658, -3.966299, -4.233459, -4.945499, -4.343579,
+    -4.522099, -4.76234, -4.761899, -4.000579, -4.015339, -7.631309, -7.618429, -7.555789,
+    -5.1549, -6.037111, -6.976207, -7.471979, -4.817219, -5.91438, -6.74874, -7.27426,
+    -2.862155, -1.342476, 0.433324, -5.190259, -5.789979, -6.63598, -6.971558, -5.2437,
+    -5.7023, -6.435699, -6.955579, -6.298955, -6.3566, -6.874987, -7.33114, -6.494098,
+    -6.516954, -6.812739, -7.0651, -6.269988, -6.445157, -6.73899, -7.103271, -6.490252,
+    -6.519512, -6.96314, -6.997555, -6.825899, -6.88214, -7.34526, -6.852463, -7.07058,
+    -7.01797, -5.99754, -7.29634, -7.410299, -7.71778, -7.563499, -7.4263, -7.4401,
+    -7.15882, -5.5191, -4.30942, -6.584401, -3.981575, -6.809807, -6.519324, -6.678947,
+    -6.150438, -6.902589, -6.243761, -5.876886, -5.320836, 1.783329, 0.959476, 1.738761,
+    1.596262, 1.477093, 1.391948, 0.925357, 0.980685, 1.618383, 3.028197, 2.783089,
+    3.223421, 3.054209, 2.520248, 2.441653, 2.285029, 2.542033, 2.457094, 1.715389,
+    1.153829, 1.706645, 2.452585, 1.573724, 2.291265, 2.741581, 2.599097, 1.346381,
+    2.754385, 2.628665, 1.386018, 1.388502, 2.238917, 1.591507, 2.433584, 2.49034,
+    1.723782, 2.26118, 1.578479, 2.238599, 1.750158, 2.413216, 1.840571, 2.155779,
+    1.732621, 2.172413, 1.899102, 2.29103, 1.851654, 2.329885, 1.745938, 2.450578,
+    2.110218, 2.57922, 2.814579, 2.685449, 2.749436, 3.134964, 2.929407, 2.211241,
+    2.013405, 1.967777, 2.241517, 2.553154, 2.826838, 2.120104, 1.967777, 2.14015,
+    -7.096584, -7.135912, -5.990945, -6.163759, -6.099772, -5.714245, -5.919803, -6.637968,
+    -6.835803, -6.881431, -6.607692, -6.296054, -6.022371, -6.729105, -6.881432, -6.70906,
+    3.424662, 3.577733, 3.067576, 2.948788, 4.398236, 4.60814, 4.216141, 4.087437,
+    5.261061, 5.474844, 4.95854, 4.915461, 5.603967, 5.838484, 5.45014, 5.429509,
+    3.744148, 4.78114, 3.967356, 5.632861, 6.050893, 4.970261, 4.32154, 5.75174,
+    6.092512, 5.021261, 4.302821, 3.567649, 3.530088, 3.930281, 3.803532, 3.286026,
+    3.291969, 3.049304, 5.991881, 6.022153, 6.209205, 6.204185, 6.678741, 6.670771,
+    6.992806, 6.982558, 7.332838, 7.634021, 7.610962, 7.89185, 7.862846, 8.38395,
+    8.362971, 8.838781, 8.827456, 9.321155, 9.297422, 9.425635, 9.38671, 9.261407,
+    9.237742, 8.654314, 8.217725, 8.527203, 8.046989, 7.732928, 7.398088, 7.215217,
+    7.184463, 6.828553, 7.107795, 6.41498, 7.034461, 6.267135, 5.851286, 6.070321,
+    5.810553, 6.474141, 6.519702, 7.114379, 7.121011, 8.489944, 7.993187, 8.451196,
+    8.025408, 6.539258, 7.175103, 8.00771, 7.610795, 7.550657, 7.767465, 7.644979,
+    7.393955, 7.315015, 7.325798, 7.638615, 7.526416, 7.518304, 7.280652, 7.365016,
+    7.14847, 9.134901, 9.282141, 9.021621, 8.886935, 8.789263, 9.168058, 9.248061,
+    9.003421, 9.117101, 9.331461, 8.93809, 8.965159, 9.088527, 9.146748, 8.977086,
+    8.97296, 9.089196, 9.152395, 6.595381, 6.2727, 6.657421, 6.060381, 6.218461,
+    5.834745, 5.704831, 5.70702, 6.28086, 5.86014, 6.417941, 5.850281, 6.257605,
+    5.905434, 6.200912, 6.035568, 5.936452, 6.04242, 5.977332, 6.442822, 6.539421,
+    6.537112, 6.356922, 6.097309, 6.140787, 6.135803, 6.328025, 6.31531, 6.123482,
+    6.222389, 5.816736, 9.190677, 7.504834, -7.150352, -5.896802, -8.232147, -8.224747,
+    -8.22368, -9.477296, -9.468407, -9.468828, -10.58292, -10.578284, -10.574452, -11.628008,
+    -11.627699, -11.625935, -12.779329, -12.77902, -13.051553, -13.575122, -14.064795, -13.478335,
+    6.505381, 6.715941, 6.908369, 6.713341, 6.894556, 7.214794, 7.178582, 7.122494,
+    7.80922, 6.550742, 6.808812, 7.061201, 7.309751, 7.035236, 6.339821, 7.415321,
+    6.688581, 6.291701, 6.6948, 7.061949, 7.390554, 6.760243, -6.969872, -5.48745,
+    -5.536535, -6.866847, -5.638816, -7.504856, -7.541896, -7.617894, -7.672389, -7.548977,
+    -7.601128, -7.161573, -7.273139, -7.47126, -4.754455, -4.83297, -4.889535, -5.638063,
+    -6.598912, -6.603194, -5.465988, -6.29192, -4.887545, -4.537141, -4.582662, -4.883942,
+    -5.098783, -5.640331, -5.468236, -5.684091, -6.044376, -6.019818, -5.647167, -5.734576,
+    -5.870777, -5.887852, -5.740717, -5.6035, -5.699152, -5.886618, -5.920241, -5.709154,
+    -5.787874, -4.91405, -4.825419, -4.679581, -4.685552, -4.833247, -4.979762, -4.850222,
+    -4.668745, -4.655683, -4.844859, -4.782281
+};
+alignas(16) constexpr float cowStX[1528] = {
+    0.273199, 0.237165, 0.278296, 0.241022, 0.315457, 0.320273, 0.352616, 0.353849,
+    0.388247, 0.382898, 0.840236, 0.840236, 0.868541, 0.864078, 0.212518, 0.203046,
+    0.90845, 0.90845, 0.942596, 0.200032, 0.238706, 0.27108, 0.318161, 0.352236,
+    0.398614, 0.205114, 0.183131, 0.955595, 0.889639, 0.86678, 0.871748, 0.840236,
+    0.877314, 0.87425, 0.847748, 0.840236, 0.357394, 0.36963, 0.401728, 0.392602,
+    0.380095, 0.398146, 0.900512, 0.358687, 0.388393, 0.840236, 0.319903, 0.294443,
+    0.259812, 0.236226, 0.197733, 0.213802, 0.90845, 0.90845, 0.929275, 0.947843,
+    0.866798, 0.840236, 0.365264, 0.3822, 0.325733, 0.324013, 0.318552, 0.315799,
+    0.293272, 0.296834, 0.290961, 0.284383, 0.180042, 0.934159, 0.260711, 0.249751,
+    0.253225, 0.851667, 0.829304, 0.825484, 0.217722, 0.223515, 0.214446, 0.219808,
+    0.249984, 0.434941, 0.44895, 0.452094, 0.43684, 0.433284, 0.175166, 0.180024,
+    0.195385, 0.204444, 0.441207, 0.122722, 0.120873, 0.150545, 0.152394, 0.185239,
+    0.108116, 0.107096, 0.453412, 0.447002, 0.452006, 0.10359, 0.100284, 0.11727,
+    0.448364, 0.148187, 0.833684, 0.83268, 0.839897, 0.181991, 0.185486, 0.17582,
+    0.325604, 0.323645, 0.316175, 0.307513, 0.836906, 0.832118, 0.827373, 0.851725,
+    0.83676, 0.82111, 0.82187, 0.835073, 0.458927, 0.188575, 0.814103, 0.801333,
+    0.812756, 0.780603, 0.807164, 0.780603, 0.815779, 0.780603, 0.780603, 0.780603,
+    0.840236, 0.74807, 0.778704, 0.742789, 0.447441, 0.326164, 0.334016, 0.318913,
+    0.343958, 0.354457, 0.337295, 0.439381, 0.307222, 0.295664, 0.306343, 0.830895,
+    0.847553, 0.828543, 0.440386, 0.820074, 0.345881, 0.324678, 0.371123, 0.35866,
+    0.322932, 0.378029, 0.430832, 0.266933, 0.254246, 0.317928, 0.349748, 0.383231,
+    0.840236, 0.876168, 0.235071, 0.210394, 0.197985, 0.935079, 0.90845, 0.255763,
+    0.241252, 0.251441, 0.307505, 0.340153, 0.395208, 0.840236, 0.86025, 0.948108,
+    0.250687, 0.270184, 0.234924, 0.232836, 0.216687, 0.214586, 0.23332, 0.216288,
+    0.2122, 0.679232, 0.67764, 0.668745, 0.660787, 0.677092, 0.946032, 0.950077,
+    0.97134, 0.002317, 0.025549, 0.021159, 0.192288, 0.186703, 0.187964, 0.654578,
+    0.668508, 0.182051, 0.653393, 0.130541, 0.14926, 0.150091, 0.118776, 0.017408,
+    0.001992, 0.163491, 0.163071, 0.665937, 0.677872, 0.678802, 0.164109, 0.162096,
+    0.652241, 0.13461, 0.145589, 0.015547, 0.007901, 0.135841, 0.134095, 0.665713,
+    0.672892, 0.133595, 0.658904, 0.134996, 0.151654, 0.015408, 0.005742, 0.107096,
+    0.10359, 0.668966, 0.678368, 0.100284, 0.658852, 0.675184, 0.684207, 0.678803,
+    0.677702, 0.689831, 0.096492, 0.090102, 0.571176, 0.565531, 0.557688, 0.095747,
+    0.091189, 0.572396, 0.068951, 0.068451, 0.65751, 0.658181, 0.14063, 0.159431,
+    0.144346, 0.099419, 0.095737, 0.105053, 0.5719, 0.078247, 0.088882, 0.145045,
+    0.168964, 0.583032, 0.582168, 0.959395, 0.928572, 0.930084, 0.943713, 0.960222,
+    0.948093, 0.836477, 0.002856, 0.011449, 0.005417, 0.097512, 0.096492, 0.091189,
+    0.459236, 0.471365, 0.460337, 0.090102, 0.634134, 0.628489, 0.620646, 0.095747,
+    0.635354, 0.068951, 0.068451, 0.439044, 0.455363, 0.439715, 0.83653, 0.855331,
+    0.840246, 0.115011, 0.111328, 0.120645, 0.634858, 0.078247, 0.088882, 0.840944,
+    0.864864, 0.64599, 0.645126, 0.984099, 0.953276, 0.954788, 0.968417, 0.984926,
+    0.972797, 0.343624, 0.304781, 0.393172, 0.840236, 0.861152, 0.362752, 0.32349,
+    0.305581, 0.401033, 0.413891, 0.840236, 0.382019, 0.344511, 0.413619, 0.543007,
+    0.562449, 0.561212, 0.425388, 0.386718, 0.351608, 0.427648, 0.543007, 0.562791,
+    0.422683, 0.400218, 0.404497, 0.296647, 0.277924, 0.326551, 0.334422, 0.20298,
+    0.20298, 0.219174, 0.284632, 0.214444, 0.222083, 0.20298, 0.20298, 0.054263,
+    0.053528, 0.03516, 0.249677, 0.269512, 0.395875, 0.234958, 0.231148, 0.20298,
+    0.224726, 0.207799, 0.216907, 0.205687, 0.90845, 0.932343, 0.930196, 0.90845,
+    0.745926, 0.760349, 0.751241, 0.735536, 0.737976, 0.192094, 0.543007, 0.558266,
+    0.560993, 0.543007, 0.543007, 0.55641, 0.543007, 0.556424, 0.543007, 0.555233,
+    0.565359, 0.543007, 0.556756, 0.543007, 0.555922, 0.543007, 0.551333, 0.543007,
+    0.549753, 0.543007, 0.549758, 0.504519, 0.511054, 0.511269, 0.504519, 0.504519,
+    0.512389, 0.373798, 0.378659, 0.396576, 0.383207, 0.357757, 0.362435, 0.721373,
+    0.729401, 0.713798, 0.410801, 0.394988, 0.402773, 0.373826, 0.5755, 0.571072,
+    0.417699, 0.418593, 0.432291, 0.427267, 0.404609, 0.391518, 0.387802, 0.356497,
+    0.411607, 0.338652, 0.053528, 0.03516, 0.3617, 0.352246, 0.054377, 0.03516,
+    0.347819, 0.346977, 0.354573, 0.339092, 0.03516, 0.03516, 0.052343, 0.051417,
+    0.679815, 0.412729, 0.412842, 0.416291, 0.421301, 0.416046, 0.422618, 0.411862,
+    0.408621, 0.400984, 0.406053, 0.402773, 0.407987, 0.408726, 0.570999, 0.575634,
+    0.581996, 0.728875, 0.55901, 0.560429, 0.375017, 0.367877, 0.372672, 0.517704,
+    0.367409, 0.353811, 0.350389, 0.519004, 0.520074, 0.515953, 0.362227, 0.360778,
+    0.354428, 0.374509, 0.045916, 0.03516, 0.045407, 0.03516, 0.056318, 0.349634,
+    0.346284, 0.475869, 0.476693, 0.46679, 0.438992, 0.439136, 0.442132, 0.463649,
+    0.473442, 0.049252, 0.049048, 0.045064, 0.045703, 0.049869, 0.43511, 0.432885,
+    0.435087, 0.572841, 0.573163, 0.060533, 0.075849, 0.074713, 0.447607, 0.436037,
+    0.820602, 0.825918, 0.824235, 0.830859, 0.836205, 0.564748, 0.580827, 0.574425,
+    0.63096, 0.645615, 0.650948, 0.355478, 0.3634, 0.357983, 0.626185, 0.645958,
+    0.63177, 0.644037, 0.343262, 0.335746, 0.317566, 0.31978, 0.339655, 0.319672,
+    0.321601, 0.31438, 0.306224, 0.311433, 0.639266, 0.625319, 0.621954, 0.633134,
+    0.622034, 0.628311, 0.484986, 0.471249, 0.465746, 0.4838, 0.493968, 0.499178,
+    0.493336, 0.497204, 0.468109, 0.473454, 0.469655, 0.46214, 0.48041, 0.482721,
+    0.491318, 0.486291, 0.407571, 0.392834, 0.391621, 0.476641, 0.493238, 0.435679,
+    0.311674, 0.43519, 0.365751, 0.517271, 0.363194, 0.368441, 0.411502, 0.27871,
+    0.276126, 0.271162, 0.840236, 0.267244, 0.717986, 0.723757, 0.725498, 0.717986,
+    0.740006, 0.75001, 0.752799, 0.742763, 0.717986, 0.722567, 0.742763, 0.748875,
+    0.717986, 0.722567, 0.742763, 0.748875, 0.717986, 0.725498, 0.742763, 0.753093,
+    0.717986, 0.73387, 0.747982, 0.774468, 0.742735, 0.773437, 0.717986, 0.770514,
+    0.58547, 0.587113, 0.872572, 0.879116, 0.875779, 0.866563, 0.87598, 0.881158,
+    0.590533, 0.597884, 0.593088, 0.884651, 0.140453, 0.153883, 0.150223, 0.137595,
+    0.568618, 0.565222, 0.551792, 0.556179, 0.574709, 0.569914, 0.575777, 0.570463,
+    0.573651, 0.569302, 0.577819, 0.556919, 0.577131, 0.580231, 0.566625, 0.70258,
+    0.696014, 0.704951, 0.708601, 0.70481, 0.711481, 0.819886, 0.828823, 0.710956,
+    0.706428, 0.592212, 0.596671, 0.600984, 0.592306, 0.600096, 0.602379, 0.712539,
+    0.801333, 0.780603, 0.800856, 0.780603, 0.801045, 0.780603, 0.802392, 0.780603,
+    0.816791, 0.153094, 0.141722, 0.159187, 0.091795, 0.138133, 0.820857, 0.090086,
+    0.064813, 0.064553, 0.206211, 0.207989, 0.188116, 0.186482, 0.927307, 0.937733,
+    0.936909, 0.926118, 0.90845, 0.90845, 0.945617, 0.946758, 0.954712, 0.953589,
+    0.930974, 0.90845, 0.930239, 0.932222, 0.90845, 0.948704, 0.942266, 0.089338,
+    0.118107, 0.095358, 0.941815, 0.929604, 0.105541, 0.104442, 0.098578, 0.10076,
+    0.023075, 0.024308, 0.017779, 0.01833, 0.239988, 0.238732, 0.244122, 0.24486,
+    0.270708, 0.271836, 0.264483, 0.265583, 0.109036, 0.108783, 0.938167, 0.932303,
+    0.934521, 0.939911, 0.942508, 0.163004, 0.15996, 0.158103, 0.021218, 0.242939,
+    0.267225, 0.159746, 0.683635, 0.685924, 0.681412, 0.680548, 0.675091, 0.675468,
+    0.335285, 0.334337, 0.327388, 0.329369, 0.219293, 0.220334, 0.213744, 0.214148,
+    0.209045, 0.031895, 0.032945, 0.028333, 0.937293, 0.942191, 0.682587, 0.672092,
+    0.068451, 0.074743, 0.070551, 0.93283, 0.939779, 0.930798, 0.679046, 0.333273,
+    0.182571, 0.181491, 0.186476, 0.186103, 0.664188, 0.623058, 0.659092, 0.626915,
+    0.706166, 0.701349, 0.739742, 0.738508, 0.76879, 0.774139, 0.033963, 0.062267,
+    0.062267, 0.038426, 0.588939, 0.59841, 0.963861, 0.998008, 0.998008, 0.585925,
+    0.656972, 0.624599, 0.704053, 0.738128, 0.784506, 0.591006, 0.569023, 0.950863,
+    0.030755, 0.035724, 0.012865, 0.062267, 0.02519, 0.062267, 0.054756, 0.028254,
+    0.787621, 0.755522, 0.743286, 0.778494, 0.784039, 0.765987, 0.001992, 0.774286,
+    0.744579, 0.062267, 0.705795, 0.680335, 0.645705, 0.622119, 0.599695, 0.583626,
+    0.977182, 0.998008, 0.998008, 0.958615, 0.921471, 0.928982, 0.902421, 0.035706,
+    0.768092, 0.751157, 0.709906, 0.711626, 0.704444, 0.701692, 0.682726, 0.679165,
+    0.676853, 0.670276, 0.565935, 0.972298, 0.646603, 0.635644, 0.639117, 0.884101,
+    0.880281, 0.857919, 0.603614, 0.609408, 0.600339, 0.635877, 0.6057, 0.403436,
+    0.406579, 0.420588, 0.422246, 0.41869, 0.581278, 0.565916, 0.561059, 0.590336,
+    0.414322, 0.536438, 0.506766, 0.508614, 0.538286, 0.571132, 0.492989, 0.494009,
+    0.403523, 0.408527, 0.402118, 0.489483, 0.503163, 0.486177, 0.407165, 0.534079,
+    0.869689, 0.876906, 0.875901, 0.169684, 0.160018, 0.163514, 0.292716, 0.285246,
+    0.283287, 0.301378, 0.882212, 0.877467, 0.872679, 0.85786, 0.888475, 0.872825,
+    0.887716, 0.874512, 0.396602, 0.574467, 0.896829, 0.908253, 0.895483, 0.928982,
+    0.928982, 0.893807, 0.928982, 0.928982, 0.928982, 0.821581, 0.785666, 0.8163,
+    0.408088, 0.274875, 0.282726, 0.289977, 0.254433, 0.264932, 0.271595, 0.416148,
+    0.27885, 0.289529, 0.277971, 0.907741, 0.88873, 0.905388, 0.415143, 0.889511,
+    0.284212, 0.26301, 0.237768, 0.285958, 0.25023, 0.230862, 0.424697, 0.640139,
+    0.652826, 0.703821, 0.735641, 0.769123, 0.026336, 0.062267, 0.596287, 0.620964,
+    0.583877, 0.998008, 0.971379, 0.637334, 0.627145, 0.641656, 0.693398, 0.726045,
+    0.7811, 0.042254, 0.062267, 0.958349, 0.656076, 0.63658, 0.618729, 0.620816,
+    0.600478, 0.602579, 0.619212, 0.602181, 0.598093, 0.6296, 0.620705, 0.619114,
+    0.621254, 0.637558, 0.960425, 0.956381, 0.935117, 0.03776, 0.03337, 0.056602,
+    0.572596, 0.57818, 0.573856, 0.629838, 0.643767, 0.567943, 0.644953, 0.081326,
+    0.082157, 0.100876, 0.112641, 0.056927, 0.041511, 0.548963, 0.549384, 0.619544,
+    0.620474, 0.632409, 0.550002, 0.547989, 0.646105, 0.085828, 0.096808, 0.051018,
+    0.043372, 0.519988, 0.521734, 0.625454, 0.632633, 0.519488, 0.639442, 0.079764,
+    0.096422, 0.053177, 0.043511, 0.489483, 0.492989, 0.619978, 0.629379, 0.486177,
+    0.639494, 0.614139, 0.623162, 0.619543, 0.608514, 0.620643, 0.475995, 0.482385,
+    0.589167, 0.59701, 0.602655, 0.48164, 0.477082, 0.603875, 0.454344, 0.454843,
+    0.640836, 0.640165, 0.090787, 0.071987, 0.087071, 0.136236, 0.12692, 0.130602,
+    0.603379, 0.474775, 0.464139, 0.062453, 0.086373, 0.613647, 0.614511, 0.920924,
+    0.922437, 0.891614, 0.907295, 0.902915, 0.890786, 0.873108, 0.008024, 0.001992,
+    0.010585, 0.483404, 0.477082, 0.482385, 0.395193, 0.384164, 0.396293, 0.475995,
+    0.526209, 0.534053, 0.539698, 0.48164, 0.540918, 0.454344, 0.454843, 0.400167,
+    0.416485, 0.415815, 0.899754, 0.880953, 0.896037, 0.151828, 0.142512, 0.146194,
+    0.540421, 0.474775, 0.464139, 0.87142, 0.895339, 0.550689, 0.551553, 0.996496,
+    0.998008, 0.967185, 0.982867, 0.978486, 0.966358, 0.690674, 0.729516, 0.779065,
+    0.041352, 0.062267, 0.691473, 0.709383, 0.748644, 0.786926, 0.799783, 0.062267,
+    0.730404, 0.767911, 0.799511, 0.518668, 0.517431, 0.536872, 0.811281, 0.7375,
+    0.77261, 0.813541, 0.517089, 0.536872, 0.447194, 0.451473, 0.429008, 0.663816,
+    0.682539, 0.712444, 0.720314, 0.180652, 0.196845, 0.196845, 0.670525, 0.196845,
+    0.177743, 0.185381, 0.196845, 0.029025, 0.010657, 0.009923, 0.63557, 0.655405,
+    0.455815, 0.61704, 0.620851, 0.175099, 0.196845, 0.602799, 0.593691, 0.591579,
+    0.976262, 0.974115, 0.998008, 0.998008, 0.782189, 0.791297, 0.776875, 0.768925,
+    0.766484, 0.577987, 0.518886, 0.521614, 0.536872, 0.536872, 0.523469, 0.536872,
+    0.523456, 0.536872, 0.524647, 0.536872, 0.514521, 0.523124, 0.536872, 0.523957,
+    0.536872, 0.528546, 0.536872, 0.530126, 0.536872, 0.530122, 0.536872, 0.491633,
+    0.491849, 0.498384, 0.498384, 0.490513, 0.498384, 0.782469, 0.764551, 0.75969,
+    0.769099, 0.748327, 0.74365, 0.707663, 0.69206, 0.700087, 0.796694, 0.788666,
+    0.78088, 0.759719, 0.508808, 0.50438, 0.818183, 0.804485, 0.803591, 0.81316,
+    0.77741, 0.790502, 0.74239, 0.773695, 0.7975, 0.724545, 0.029025, 0.010657,
+    0.747593, 0.738138, 0.029025, 0.009808, 0.740465, 0.732869, 0.733712, 0.724984,
+    0.011842, 0.029025, 0.029025, 0.012769, 0.618531, 0.802184, 0.798734, 0.798621,
+    0.807193, 0.808511, 0.801938, 0.797754, 0.794513, 0.791945, 0.786877, 0.793879,
+    0.788665, 0.794619, 0.50888, 0.504246, 0.497884, 0.692585, 0.519451, 0.52087,
+    0.758565, 0.753769, 0.760909, 0.485199, 0.739704, 0.753301, 0.736281, 0.48695,
+    0.482829, 0.483899, 0.748119, 0.740321, 0.74667, 0.760401, 0.029025, 0.018269,
+    0.029025, 0.018779, 0.007867, 0.735527, 0.732176, 0.416847, 0.42675, 0.425926,
+    0.457514, 0.454518, 0.454374, 0.423499, 0.413706, 0.056758, 0.060741, 0.060945,
+    0.057396, 0.061563, 0.450492, 0.448267, 0.450469, 0.506717, 0.507038, 0.053261,
+    0.054397, 0.039081, 0.82193, 0.8335, 0.801782, 0.803464, 0.798149, 0.808405,
+    0.813751, 0.515132, 0.505455, 0.499052, 0.687979, 0.682645, 0.66799, 0.343925,
+    0.349342, 0.34142, 0.682988, 0.663215, 0.681067, 0.6688, 0.362392, 0.380572,
+    0.388087, 0.384481, 0.364606, 0.364498, 0.366427, 0.359206, 0.356259, 0.351049,
+    0.676296, 0.658984, 0.662349, 0.670164, 0.659064, 0.665341, 0.510572, 0.516075,
+    0.529811, 0.528626, 0.538162, 0.544004, 0.538794, 0.54203, 0.514481, 0.518279,
+    0.512935, 0.506966, 0.525236, 0.527547, 0.536144, 0.531117, 0.385486, 0.384273,
+    0.369535, 0.521467, 0.538064, 0.821572, 0.3565, 0.821083, 0.751644, 0.485632,
+    0.749086, 0.754333, 0.797395, 0.290652, 0.295616, 0.298199, 0.062267, 0.286734,
+    0.704339, 0.70608, 0.711851, 0.711851, 0.062267, 0.056496, 0.707269, 0.711851,
+    0.062267, 0.057686, 0.707269, 0.711851, 0.062267, 0.057686, 0.704339, 0.711851,
+    0.062267, 0.054756, 0.695967, 0.711851, 0.062267, 0.046383, 0.919543, 0.944999,
+    0.914297, 0.711851, 0.942076, 0.946029, 0.492767, 0.49441, 0.851556, 0.854893,
+    0.848349, 0.84234, 0.856935, 0.851757, 0.486792, 0.481996, 0.489347, 0.860428,
+    0.118831, 0.115172, 0.128602, 0.13146, 0.615313, 0.601882, 0.598486, 0.610925,
+    0.59719, 0.592395, 0.591327, 0.596641, 0.593453, 0.589285, 0.597802, 0.610185,
+    0.589973, 0.586873, 0.600479, 0.728338, 0.719401, 0.725968, 0.731989, 0.728197,
+    0.734868, 0.797433, 0.806369, 0.734344, 0.729815, 0.487668, 0.483209, 0.487573,
+    0.478896, 0.4775, 0.479783, 0.735926, 0.908252, 0.928982, 0.908729, 0.928982,
+    0.90854, 0.928982, 0.907193, 0.928982, 0.892794, 0.165899, 0.183364, 0.171992,
+    0.186952, 0.23329, 0.888728, 0.260532, 0.260273, 0.235, 0.574009, 0.593882,
+    0.592103, 0.572375, 0.969549, 0.968725, 0.979151, 0.98034, 0.998008, 0.998008,
+    0.951746, 0.9597, 0.960841, 0.952869, 0.975484, 0.974236, 0.976219, 0.998008,
+    0.998008, 0.957754, 0.964192, 0.235748, 0.206978, 0.229728, 0.964643, 0.976853,
+    0.092443, 0.086579, 0.085479, 0.09026, 0.037951, 0.031421, 0.032655, 0.037399,
+    0.227207, 0.232597, 0.231341, 0.226469, 0.258348, 0.250995, 0.252124, 0.257249,
+    0.082238, 0.081984, 0.968291, 0.974155, 0.971937, 0.966547, 0.96395, 0.169797,
+    0.171653, 0.174698, 0.034512, 0.22839, 0.255606, 0.171439, 0.656637, 0.652125,
+    0.654414, 0.657501, 0.662959, 0.662581, 0.321253, 0.314304, 0.313357, 0.319273,
+    0.198211, 0.191621, 0.192662, 0.197806, 0.20291, 0.022197, 0.017584, 0.018635,
+    0.969165, 0.964267, 0.665957, 0.655463, 0.084193, 0.088385, 0.082094, 0.966679,
+    0.973627, 0.975659, 0.659004, 0.315368, 0.193184, 0.198169, 0.197089, 0.193556
+};
+alignas(16) constexpr float cowStY[1528] = {
+    0.285773, 0.284524, 0.228885, 0.228085, 0.28448, 0.219717, 0.279448, 0.214693,
+    0.21156, 0.271379, 0.199369, 0.140241, 0.140723, 0.200543, 0.283463, 0.222351,
+    0.271281, 0.204789, 0.208534, 0.282866, 0.160631, 0.162092, 0.15796, 0.153043,
+    0.147393, 0.163872, 0.167088, 0.154612, 0.318721, 0.316595, 0.264709, 0.257752,
+    0.352077, 0.393849, 0.392956, 0.349477, 0.085771, 0.061887, 0.060026, 0.093382,
+    0.025457, 0.018253, 0.282487, 0.12031, 0.129616, 0.31599, 0.116474, 0.110256,
+    0.101888, 0.101903, 0.128422, 0.117664, 0.1556, 0.115432, 0.116608, 0.115946,
+    0.410148, 0.4097, 0.004585, 0.001954, 0.088214, 0.057484, 0.024773, 0.007504,
+    0.099976, 0.061759, 0.032696, 0.014391, 0.22101, 0.27039, 0.066092, 0.086982,
+    0.036624, 0.736018, 0.739258, 0.704859, 0.069147, 0.085121, 0.0436, 0.025492,
+    0.024935, 0.700364, 0.704942, 0.718351, 0.737279, 0.716381, 0.046356, 0.028299,
+    0.035127, 0.021486, 0.680995, 0.04077, 0.030467, 0.025228, 0.040681, 0.01241,
+    0.049373, 0.043271, 0.652498, 0.652077, 0.637893, 0.033036, 0.020347, 0.021677,
+    0.68217, 0.01921, 0.885585, 0.869445, 0.871972, 0.837729, 0.854715, 0.854681,
+    0.598727, 0.627616, 0.626735, 0.662824, 0.804003, 0.841437, 0.805348, 0.774796,
+    0.769435, 0.768497, 0.78734, 0.784799, 0.747498, 0.053537, 0.701928, 0.685368,
+    0.673443, 0.598727, 0.607042, 0.610048, 0.623978, 0.635375, 0.668433, 0.683637,
+    0.39369, 0.889577, 0.935785, 0.939, 0.753292, 0.653537, 0.671894, 0.680833,
+    0.649518, 0.665535, 0.630149, 0.649574, 0.832946, 0.830442, 0.814302, 0.919924,
+    0.923263, 0.936876, 0.633434, 0.739258, 0.690734, 0.699675, 0.686433, 0.70985,
+    0.728914, 0.703041, 0.753887, 0.32989, 0.307963, 0.328338, 0.323374, 0.319223,
+    0.095845, 0.092879, 0.301193, 0.300005, 0.301932, 0.289456, 0.311669, 0.373252,
+    0.364715, 0.353359, 0.380052, 0.374158, 0.355559, 0.059281, 0.056543, 0.303575,
+    0.327524, 0.356318, 0.353202, 0.327219, 0.347583, 0.322589, 0.363269, 0.358306,
+    0.31467, 0.763096, 0.771029, 0.760924, 0.746683, 0.746065, 0.33489, 0.287529,
+    0.302194, 0.747407, 0.72933, 0.759479, 0.34576, 0.323209, 0.35254, 0.732261,
+    0.71774, 0.316137, 0.724311, 0.692792, 0.697801, 0.723291, 0.72288, 0.779434,
+    0.777495, 0.345749, 0.328735, 0.693885, 0.693267, 0.722064, 0.351831, 0.322755,
+    0.698821, 0.662903, 0.663366, 0.807935, 0.807384, 0.343443, 0.333923, 0.666903,
+    0.665618, 0.328124, 0.664386, 0.629075, 0.632414, 0.841246, 0.841212, 0.353132,
+    0.341277, 0.637893, 0.636873, 0.328588, 0.633434, 0.627288, 0.626268, 0.620966,
+    0.599747, 0.598727, 0.361313, 0.344796, 0.848933, 0.868135, 0.85584, 0.337904,
+    0.363542, 0.860809, 0.369811, 0.34585, 0.621961, 0.599747, 0.624503, 0.620941,
+    0.618135, 0.8664, 0.856734, 0.859298, 0.874717, 0.336315, 0.336315, 0.607867,
+    0.598727, 0.860809, 0.874438, 0.848739, 0.869127, 0.845208, 0.839203, 0.872699,
+    0.87986, 0.841056, 0.845238, 0.851257, 0.861059, 0.059092, 0.053073, 0.055302,
+    0.599747, 0.598727, 0.620966, 0.036555, 0.846868, 0.866071, 0.853775, 0.029664,
+    0.858745, 0.06157, 0.037609, 0.621961, 0.627288, 0.599747, 0.915353, 0.91179,
+    0.908984, 0.866683, 0.857017, 0.859581, 0.872652, 0.028074, 0.028074, 0.898716,
+    0.889577, 0.858745, 0.872373, 0.79996, 0.820348, 0.796429, 0.790425, 0.823921,
+    0.831081, 0.387062, 0.392394, 0.374624, 0.041616, 0.037479, 0.420974, 0.428286,
+    0.398191, 0.414631, 0.410148, 0.001954, 0.451029, 0.458475, 0.440491, 0.752189,
+    0.750688, 0.776548, 0.438991, 0.462973, 0.471142, 0.457615, 0.734283, 0.733565,
+    0.784736, 0.823579, 0.785536, 0.434312, 0.405966, 0.463979, 0.478541, 0.676457,
+    0.641925, 0.642718, 0.442676, 0.677673, 0.719592, 0.710443, 0.723803, 0.602941,
+    0.617502, 0.618952, 0.417651, 0.392043, 0.757879, 0.390734, 0.363715, 0.604114,
+    0.598727, 0.382233, 0.359336, 0.400259, 0.369964, 0.361511, 0.387783, 0.392198,
+    0.950143, 0.954961, 0.977859, 0.969613, 0.942992, 0.373988, 0.714694, 0.71364,
+    0.720168, 0.720795, 0.707124, 0.707299, 0.690769, 0.691047, 0.67983, 0.680187,
+    0.667985, 0.657494, 0.658298, 0.648514, 0.649524, 0.631372, 0.632103, 0.61553,
+    0.615924, 0.598727, 0.599554, 0.85611, 0.855838, 0.862414, 0.863603, 0.842096,
+    0.842141, 0.569224, 0.554017, 0.559076, 0.575256, 0.564797, 0.54807, 0.900856,
+    0.924971, 0.932999, 0.541656, 0.525467, 0.53713, 0.519097, 0.673154, 0.685551,
+    0.515355, 0.491223, 0.505629, 0.518026, 0.512801, 0.486073, 0.471588, 0.479217,
+    0.470169, 0.493283, 0.632245, 0.633832, 0.495552, 0.5177, 0.654546, 0.654777,
+    0.563499, 0.546196, 0.546702, 0.515585, 0.701111, 0.686279, 0.685157, 0.702461,
+    0.78554, 0.538333, 0.534067, 0.530781, 0.532876, 0.525323, 0.522573, 0.522949,
+    0.533845, 0.529937, 0.529654, 0.521376, 0.524315, 0.516772, 0.652846, 0.658303,
+    0.668606, 0.934926, 0.605215, 0.609161, 0.591626, 0.591093, 0.585965, 0.855274,
+    0.581385, 0.577327, 0.573925, 0.841826, 0.848176, 0.850592, 0.585345, 0.589906,
+    0.58712, 0.582019, 0.718071, 0.719013, 0.723311, 0.725339, 0.712887, 0.584349,
+    0.579109, 0.855604, 0.863475, 0.863475, 0.849219, 0.836311, 0.82757, 0.841826,
+    0.84899, 0.868746, 0.878554, 0.878554, 0.868308, 0.865647, 0.838972, 0.849219,
+    0.83941, 0.693673, 0.704913, 0.847007, 0.845238, 0.861655, 0.497507, 0.499668,
+    0.963039, 0.959874, 0.977935, 0.975208, 0.955374, 0.724693, 0.706802, 0.724617,
+    0.831812, 0.830696, 0.842877, 0.829284, 0.847099, 0.849272, 0.820475, 0.812005,
+    0.801387, 0.792171, 0.765794, 0.790201, 0.790643, 0.778462, 0.74688, 0.759771,
+    0.733004, 0.739937, 0.737297, 0.732906, 0.789531, 0.837215, 0.827277, 0.836474,
+    0.817731, 0.800118, 0.785798, 0.79613, 0.794514, 0.780638, 0.780539, 0.784931,
+    0.784849, 0.795518, 0.812612, 0.821884, 0.837835, 0.813428, 0.816938, 0.796614,
+    0.81313, 0.822676, 0.846866, 0.850338, 0.829284, 0.836622, 0.832614, 0.466486,
+    0.80032, 0.492193, 0.587907, 0.853149, 0.592811, 0.594736, 0.529185, 0.732906,
+    0.77657, 0.776824, 0.393395, 0.810311, 0.784837, 0.785095, 0.822958, 0.822224,
+    0.840014, 0.802188, 0.839575, 0.802151, 0.741465, 0.741775, 0.758831, 0.758817,
+    0.702953, 0.703115, 0.720171, 0.720305, 0.66655, 0.666561, 0.683618, 0.683679,
+    0.626447, 0.626458, 0.643514, 0.634021, 0.615784, 0.598727, 0.598727, 0.619155,
+    0.689474, 0.696808, 0.972727, 0.972246, 0.978949, 0.97904, 0.961573, 0.962834,
+    0.651392, 0.675312, 0.673359, 0.940867, 0.836319, 0.84381, 0.853026, 0.847889,
+    0.792114, 0.797777, 0.79583, 0.788355, 0.801103, 0.80409, 0.809894, 0.815244,
+    0.818552, 0.784767, 0.796915, 0.78054, 0.822229, 0.80899, 0.83595, 0.840774,
+    0.828625, 0.826949, 0.84099, 0.852849, 0.853779, 0.943895, 0.942992, 0.865225,
+    0.866088, 0.682771, 0.68793, 0.69021, 0.704251, 0.665975, 0.677421, 0.879808,
+    0.718645, 0.719006, 0.741282, 0.741525, 0.768052, 0.769428, 0.791096, 0.79248,
+    0.742081, 0.832328, 0.789731, 0.792174, 0.751224, 0.747108, 0.787148, 0.775152,
+    0.78124, 0.753003, 0.074921, 0.102162, 0.099428, 0.071358, 0.058829, 0.064824,
+    0.077693, 0.085051, 0.058908, 0.084981, 0.085176, 0.057305, 0.058882, 0.086952,
+    0.097256, 0.001954, 0.00584, 0.025439, 0.02529, 0.016106, 0.044755, 0.79412,
+    0.809697, 0.731496, 0.09567, 0.045611, 0.836319, 0.850729, 0.849081, 0.836436,
+    0.867431, 0.880075, 0.880978, 0.867926, 0.853375, 0.840324, 0.837729, 0.853059,
+    0.840727, 0.856057, 0.856222, 0.840408, 0.836929, 0.852742, 0.060112, 0.05678,
+    0.05025, 0.049079, 0.056432, 0.862202, 0.866983, 0.86274, 0.865244, 0.856057,
+    0.837729, 0.858707, 0.848861, 0.864244, 0.865621, 0.849977, 0.866601, 0.850121,
+    0.807564, 0.824044, 0.823118, 0.806377, 0.838435, 0.855176, 0.852771, 0.837729,
+    0.853744, 0.845238, 0.860621, 0.861253, 0.081838, 0.086351, 0.871143, 0.872893,
+    0.867683, 0.865647, 0.876488, 0.093127, 0.092672, 0.086537, 0.846868, 0.804311,
+    0.866666, 0.861521, 0.863297, 0.858707, 0.367804, 0.312166, 0.310917, 0.368605,
+    0.376973, 0.31221, 0.381997, 0.317242, 0.325311, 0.38513, 0.140723, 0.140241,
+    0.199369, 0.200543, 0.374339, 0.313227, 0.60277, 0.599025, 0.665517, 0.313824,
+    0.434598, 0.436059, 0.43873, 0.443647, 0.449297, 0.432818, 0.429602, 0.548847,
+    0.264709, 0.316595, 0.318721, 0.257752, 0.352077, 0.349477, 0.392956, 0.393849,
+    0.536664, 0.534802, 0.510918, 0.503308, 0.578437, 0.571233, 0.282487, 0.467074,
+    0.47638, 0.31599, 0.480216, 0.486434, 0.494802, 0.494787, 0.479026, 0.468268,
+    0.510843, 0.509667, 0.549836, 0.510181, 0.41414, 0.427506, 0.435821, 0.410148,
+    0.594736, 0.592105, 0.539206, 0.508476, 0.571917, 0.589186, 0.534931, 0.496714,
+    0.563994, 0.582299, 0.375679, 0.664626, 0.530597, 0.509708, 0.560066, 0.533638,
+    0.568037, 0.564797, 0.527543, 0.511569, 0.55309, 0.571755, 0.571198, 0.718351,
+    0.704942, 0.700364, 0.716381, 0.737279, 0.561562, 0.568391, 0.550334, 0.575204,
+    0.680995, 0.571462, 0.566223, 0.55592, 0.556009, 0.58428, 0.553419, 0.547317,
+    0.637893, 0.652077, 0.652498, 0.563654, 0.575013, 0.576343, 0.68217, 0.57748,
+    0.700751, 0.698224, 0.714364, 0.854681, 0.854715, 0.837729, 0.626735, 0.627616,
+    0.598727, 0.662824, 0.634127, 0.670216, 0.632782, 0.603575, 0.597276, 0.598213,
+    0.616118, 0.613577, 0.747498, 0.543153, 0.502222, 0.514147, 0.530706, 0.438826,
+    0.464154, 0.452757, 0.497211, 0.512415, 0.417232, 0.939, 0.935785, 0.889577,
+    0.753292, 0.671894, 0.653537, 0.680833, 0.665535, 0.649518, 0.630149, 0.649574,
+    0.814302, 0.830442, 0.832946, 0.765654, 0.752042, 0.748703, 0.633434, 0.568037,
+    0.699675, 0.690734, 0.686433, 0.728914, 0.70985, 0.703041, 0.753887, 0.288727,
+    0.2668, 0.268352, 0.273316, 0.277467, 0.092879, 0.095845, 0.296685, 0.295496,
+    0.294758, 0.705904, 0.683692, 0.243331, 0.231975, 0.223438, 0.216637, 0.222532,
+    0.241131, 0.056543, 0.059281, 0.697811, 0.240372, 0.269166, 0.269471, 0.243488,
+    0.274101, 0.249107, 0.233421, 0.238384, 0.28202, 0.760924, 0.771029, 0.763096,
+    0.746065, 0.746683, 0.729125, 0.681764, 0.69643, 0.759479, 0.72933, 0.747407,
+    0.273481, 0.25093, 0.24415, 0.71774, 0.732261, 0.280552, 0.724311, 0.727504,
+    0.702014, 0.697006, 0.727094, 0.777495, 0.779434, 0.267955, 0.250941, 0.722064,
+    0.693267, 0.693885, 0.244859, 0.273935, 0.698821, 0.66758, 0.667116, 0.807384,
+    0.807935, 0.262767, 0.253247, 0.665618, 0.666903, 0.268566, 0.664386, 0.636627,
+    0.633289, 0.841212, 0.841246, 0.255413, 0.243558, 0.636873, 0.637893, 0.268102,
+    0.633434, 0.626268, 0.627288, 0.620966, 0.598727, 0.599747, 0.251894, 0.235376,
+    0.86781, 0.855515, 0.874717, 0.258785, 0.233148, 0.862841, 0.25084, 0.226879,
+    0.621961, 0.599747, 0.628717, 0.625154, 0.622349, 0.86412, 0.866683, 0.857017,
+    0.848933, 0.260375, 0.260375, 0.602941, 0.61208, 0.849212, 0.862841, 0.845208,
+    0.869127, 0.848739, 0.839203, 0.87986, 0.872699, 0.669834, 0.880872, 0.87107,
+    0.865051, 0.537598, 0.541388, 0.543617, 0.620966, 0.598727, 0.599747, 0.560135,
+    0.860703, 0.848408, 0.86761, 0.567026, 0.855734, 0.55908, 0.53512, 0.627288,
+    0.621961, 0.599747, 0.744131, 0.740569, 0.737763, 0.864119, 0.866683, 0.857017,
+    0.841826, 0.568616, 0.568616, 0.718355, 0.727494, 0.842105, 0.855734, 0.841077,
+    0.864996, 0.844608, 0.835073, 0.875729, 0.868569, 0.204296, 0.209628, 0.222066,
+    0.037479, 0.041616, 0.198499, 0.168404, 0.175716, 0.182058, 0.186542, 0.001954,
+    0.138215, 0.145661, 0.156199, 0.776548, 0.750688, 0.752189, 0.157699, 0.125548,
+    0.133717, 0.139075, 0.733565, 0.734283, 0.785536, 0.823579, 0.784736, 0.190724,
+    0.162378, 0.13271, 0.118149, 0.642718, 0.641925, 0.676457, 0.154014, 0.710443,
+    0.719592, 0.677673, 0.723803, 0.618952, 0.617502, 0.602941, 0.179039, 0.204647,
+    0.757879, 0.232975, 0.205955, 0.598727, 0.604114, 0.237354, 0.214457, 0.196431,
+    0.782019, 0.755747, 0.7642, 0.786434, 0.942992, 0.965889, 0.970707, 0.977859,
+    0.951237, 0.222702, 0.720168, 0.71364, 0.714694, 0.720795, 0.707299, 0.707124,
+    0.691047, 0.690769, 0.680187, 0.67983, 0.667985, 0.658298, 0.657494, 0.649524,
+    0.648514, 0.632103, 0.631372, 0.615924, 0.61553, 0.599554, 0.598727, 0.862414,
+    0.855838, 0.85611, 0.863603, 0.842141, 0.842096, 0.037614, 0.042673, 0.027465,
+    0.021434, 0.04862, 0.031893, 0.915942, 0.907914, 0.8838, 0.055034, 0.05956,
+    0.071223, 0.077593, 0.685551, 0.673154, 0.091061, 0.105467, 0.081335, 0.078664,
+    0.110617, 0.083889, 0.117473, 0.125102, 0.126521, 0.103406, 0.633832, 0.632245,
+    0.101138, 0.07899, 0.654777, 0.654546, 0.049988, 0.050494, 0.033191, 0.081105,
+    0.685157, 0.686279, 0.701111, 0.702461, 0.78554, 0.065909, 0.062623, 0.058357,
+    0.063814, 0.074117, 0.071367, 0.073741, 0.062845, 0.067036, 0.066753, 0.072375,
+    0.075314, 0.079918, 0.652846, 0.658303, 0.668606, 0.91787, 0.609161, 0.605215,
+    0.010725, 0.005597, 0.005064, 0.855274, 0.019363, 0.015305, 0.022765, 0.850592,
+    0.848176, 0.841826, 0.011345, 0.00957, 0.006784, 0.014671, 0.719013, 0.718071,
+    0.725339, 0.723311, 0.712887, 0.012341, 0.017581, 0.82757, 0.82757, 0.835441,
+    0.849219, 0.840478, 0.82757, 0.842055, 0.849219, 0.865647, 0.865647, 0.875455,
+    0.875893, 0.878554, 0.837817, 0.82757, 0.837379, 0.704913, 0.693673, 0.845238,
+    0.861655, 0.859886, 0.097022, 0.099183, 0.942992, 0.961052, 0.957888, 0.945719,
+    0.965553, 0.724693, 0.724617, 0.706802, 0.789531, 0.801712, 0.800595, 0.829284,
+    0.831458, 0.849272, 0.820402, 0.811932, 0.840237, 0.831021, 0.767556, 0.767998,
+    0.792405, 0.811318, 0.779737, 0.798427, 0.825195, 0.818262, 0.825293, 0.820902,
+    0.842877, 0.805131, 0.795193, 0.795933, 0.814677, 0.83229, 0.82386, 0.822244,
+    0.832576, 0.837736, 0.833525, 0.833443, 0.837835, 0.822856, 0.780539, 0.79649,
+    0.805762, 0.804946, 0.801436, 0.82176, 0.805244, 0.795698, 0.829284, 0.850338,
+    0.846866, 0.781752, 0.78576, 0.130204, 0.757879, 0.104497, 0.008783, 0.853149,
+    0.003879, 0.001954, 0.067505, 0.766392, 0.766646, 0.810311, 0.393395, 0.732906,
+    0.822958, 0.785095, 0.784837, 0.822224, 0.430782, 0.430819, 0.741775, 0.741465,
+    0.474154, 0.474139, 0.703115, 0.702953, 0.512666, 0.512799, 0.666561, 0.66655,
+    0.549291, 0.549353, 0.626458, 0.626447, 0.598949, 0.589456, 0.790425, 0.835212,
+    0.818155, 0.598727, 0.814784, 0.799918, 0.696808, 0.689474, 0.940958, 0.947661,
+    0.947179, 0.940867, 0.957073, 0.958334, 0.673359, 0.675312, 0.651392, 0.97904,
+    0.853026, 0.84381, 0.836319, 0.847889, 0.804821, 0.806769, 0.801105, 0.797346,
+    0.813081, 0.810094, 0.818886, 0.824236, 0.827543, 0.805906, 0.793758, 0.789531,
+    0.831221, 0.817981, 0.844941, 0.896865, 0.895189, 0.883041, 0.882824, 0.870966,
+    0.870035, 0.977032, 0.977935, 0.858589, 0.857726, 0.682771, 0.68793, 0.704251,
+    0.69021, 0.677421, 0.665975, 0.844006, 0.547423, 0.547784, 0.57006, 0.570303,
+    0.596831, 0.598207, 0.619874, 0.621259, 0.57086, 0.793584, 0.791141, 0.833738,
+    0.748517, 0.752634, 0.615927, 0.754413, 0.78265, 0.776562, 0.497262, 0.494527,
+    0.521769, 0.525332, 0.471928, 0.459059, 0.453065, 0.479286, 0.453144, 0.479217,
+    0.453117, 0.45154, 0.479412, 0.481187, 0.491492, 0.419675, 0.400076, 0.39619,
+    0.419526, 0.410342, 0.438991, 0.79553, 0.811107, 0.732906, 0.489906, 0.439846,
+    0.849081, 0.850729, 0.836319, 0.836436, 0.88138, 0.880477, 0.867833, 0.868328,
+    0.837729, 0.840324, 0.853375, 0.853059, 0.856222, 0.856057, 0.840727, 0.840408,
+    0.852742, 0.836929, 0.454348, 0.451016, 0.444486, 0.443315, 0.450667, 0.86295,
+    0.858707, 0.863488, 0.865647, 0.856057, 0.837729, 0.866983, 0.865621, 0.864244,
+    0.848861, 0.849977, 0.866601, 0.850121, 0.823118, 0.824044, 0.807564, 0.806377,
+    0.852771, 0.855176, 0.838435, 0.837729, 0.853744, 0.861253, 0.860621, 0.845238,
+    0.476074, 0.480586, 0.872893, 0.871143, 0.856734, 0.867575, 0.865539, 0.486907,
+    0.487362, 0.480773, 0.846868, 0.804311, 0.863757, 0.861982, 0.867126, 0.859167
+};
+alignas(16) constexpr uint32_t cowVertsIndex[9468] = {
+    2, 0, 3, 1, 3, 0, 4, 2,
+    5, 3, 5, 2, 6, 4, 7, 5,
+    7, 4, 8, 9, 6, 6, 7, 8,
+    10, 11, 9, 9, 8, 10, 12, 13,
+    1, 1, 0, 12, 14, 15, 54, 13,
+    12, 55, 16, 17, 3, 3, 1, 16,
+    17, 18, 5, 5, 3, 17, 18, 19,
+    7, 7, 5, 18, 19, 20, 8, 8,
+    7, 19, 22, 16, 1, 1, 13, 22,
+    23, 22, 13, 54, 15, 23, 24, 35,
+    20, 21, 20, 35, 35, 24, 26, 28,
+    29, 27, 30, 31, 26, 26, 24, 30,
+    31, 32, 28, 28, 26, 31, 24, 20,
+    33, 34, 33, 19, 20, 19, 33, 34,
+    30, 33, 24, 33, 30, 26, 27, 25,
+    27, 26, 28, 25, 35, 26, 35, 25,
+    21, 18, 36, 19, 34, 19, 36, 17,
+    37, 36, 36, 18, 17, 16, 38, 37,
+    37, 17, 16, 22, 39, 38, 38, 16,
+    22, 23, 40, 95, 39, 22, 95, 53,
+    41, 97, 40, 23, 97, 42, 43, 29,
+    29, 28, 42, 44, 42, 28, 28, 32,
+    44, 45, 46, 31, 31, 30, 45, 46,
+    47, 32, 32, 31, 46, 36, 45, 30,
+    30, 34, 36, 47, 48, 44, 44, 32,
+    47, 49, 50, 46, 46, 45, 49, 50,
+    51, 47, 47, 46, 50, 37, 49, 45,
+    45, 36, 37, 51, 52, 48, 48, 47,
+    51, 15, 53, 23, 13, 54, 23, 14,
+    54, 55, 55, 54, 13, 49, 57, 50,
+    57, 49, 56, 57, 58, 51, 51, 50,
+    57, 58, 59, 52, 52, 51, 58, 38,
+    56, 49, 49, 37, 38, 56, 61, 57,
+    61, 56, 60, 57, 62, 58, 62, 57,
+    61, 62, 63, 59, 39, 60, 56, 56,
+    38, 39, 64, 65, 101, 101, 94, 86,
+    65, 66, 100, 66, 84, 100, 63, 62,
+    100, 65, 64, 76, 69, 70, 78, 66,
+    65, 77, 67, 66, 78, 72, 73, 69,
+    69, 68, 72, 73, 74, 70, 70, 69,
+    73, 74, 75, 71, 71, 70, 74, 77,
+    76, 68, 66, 77, 78, 78, 77, 69,
+    67, 78, 174, 174, 78, 70, 99, 80,
+    71, 71, 75, 79, 80, 81, 173, 81,
+    82, 173, 67, 173, 82, 77, 65, 76,
+    69, 77, 68, 59, 58, 62, 59, 63,
+    83, 85, 83, 63, 63, 84, 85, 84,
+    67, 82, 66, 67, 84, 82, 85, 84,
+    61, 94, 101, 62, 61, 101, 87, 88,
+    48, 48, 52, 87, 87, 52, 59, 43,
+    42, 89, 44, 90, 89, 89, 42, 44,
+    48, 91, 90, 90, 44, 48, 88, 92,
+    91, 91, 48, 88, 43, 93, 29, 95,
+    22, 23, 61, 60, 94, 53, 97, 23,
+    82, 98, 96, 96, 85, 82, 98, 64,
+    86, 86, 96, 98, 98, 82, 81, 81,
+    76, 64, 64, 98, 81, 80, 68, 76,
+    76, 81, 80, 68, 80, 99, 79, 99,
+    71, 68, 99, 72, 100, 84, 63, 65,
+    100, 101, 101, 86, 64, 62, 101, 100,
+    83, 102, 59, 87, 59, 102, 103, 83,
+    85, 85, 96, 103, 94, 103, 96, 96,
+    86, 94, 103, 104, 102, 102, 83, 103,
+    94, 105, 104, 104, 103, 94, 94, 60,
+    105, 106, 125, 2, 0, 2, 125, 108,
+    106, 2, 2, 4, 108, 109, 108, 4,
+    4, 6, 109, 110, 109, 6, 6, 9,
+    110, 111, 110, 9, 9, 11, 111, 107,
+    112, 12, 12, 0, 107, 112, 113, 55,
+    55, 12, 112, 113, 114, 14, 14, 55,
+    113, 115, 116, 123, 106, 108, 117, 118,
+    117, 108, 108, 109, 118, 119, 118, 109,
+    109, 110, 119, 120, 119, 110, 110, 111,
+    120, 114, 113, 135, 124, 122, 123, 117,
+    115, 122, 123, 122, 115, 125, 106, 124,
+    117, 122, 106, 124, 106, 122, 125, 107,
+    0, 107, 125, 124, 127, 126, 123, 124,
+    123, 126, 129, 128, 127, 126, 127, 128,
+    116, 130, 127, 127, 123, 116, 130, 131,
+    129, 129, 127, 130, 124, 126, 107, 132,
+    107, 126, 126, 128, 132, 130, 116, 133,
+    133, 134, 131, 131, 130, 133, 121, 114,
+    135, 135, 113, 112, 132, 112, 107, 112,
+    132, 135, 135, 132, 136, 137, 138, 128,
+    128, 129, 137, 139, 137, 129, 129, 131,
+    139, 140, 139, 131, 131, 134, 140, 138,
+    136, 132, 132, 128, 138, 139, 140, 121,
+    141, 142, 121, 121, 135, 141, 143, 141,
+    135, 135, 136, 143, 144, 145, 138, 138,
+    137, 144, 146, 144, 137, 137, 139, 146,
+    145, 143, 136, 136, 138, 145, 142, 146,
+    139, 139, 121, 142, 147, 148, 142, 142,
+    141, 147, 149, 147, 141, 141, 143, 149,
+    150, 151, 145, 145, 144, 150, 152, 150,
+    144, 144, 146, 152, 151, 149, 143, 143,
+    145, 151, 148, 152, 146, 146, 142, 148,
+    153, 154, 148, 148, 147, 153, 155, 153,
+    147, 147, 149, 155, 156, 157, 151, 151,
+    150, 156, 158, 156, 150, 150, 152, 158,
+    157, 155, 149, 149, 151, 157, 154, 158,
+    152, 152, 148, 154, 159, 160, 156, 156,
+    158, 159, 160, 159, 161, 162, 163, 161,
+    160, 164, 157, 157, 156, 160, 164, 165,
+    157, 155, 157, 165, 164, 160, 161, 164,
+    166, 165, 163, 167, 164, 164, 161, 163,
+    154, 168, 159, 159, 158, 154, 161, 159,
+    168, 168, 169, 162, 162, 161, 168, 154,
+    153, 165, 165, 168, 154, 168, 165, 170,
+    153, 155, 165, 166, 170, 165, 167, 171,
+    166, 166, 164, 167, 172, 169, 168, 168,
+    170, 172, 171, 172, 170, 170, 166, 171,
+    167, 169, 172, 172, 171, 167, 163, 162,
+    169, 169, 167, 163, 21, 10, 8, 8,
+    20, 21, 71, 173, 174, 67, 174, 173,
+    71, 174, 70, 173, 71, 80, 175, 176,
+    73, 73, 72, 175, 176, 175, 177, 178,
+    179, 177, 176, 180, 74, 74, 73, 176,
+    180, 181, 74, 75, 74, 181, 180, 176,
+    177, 180, 182, 181, 179, 183, 180, 180,
+    177, 179, 99, 184, 175, 175, 72, 99,
+    177, 175, 184, 184, 185, 178, 178, 177,
+    184, 99, 79, 181, 181, 184, 99, 184,
+    181, 186, 79, 75, 181, 182, 186, 181,
+    183, 187, 182, 182, 180, 183, 188, 185,
+    184, 184, 186, 188, 187, 188, 186, 186,
+    182, 187, 183, 185, 188, 188, 187, 183,
+    179, 178, 185, 185, 183, 179, 189, 190,
+    117, 117, 118, 189, 191, 189, 118, 118,
+    119, 191, 192, 191, 119, 119, 120, 192,
+    193, 194, 205, 195, 193, 189, 189, 191,
+    195, 196, 195, 191, 191, 192, 196, 197,
+    198, 194, 194, 193, 197, 199, 197, 193,
+    193, 195, 199, 200, 199, 195, 195, 196,
+    200, 201, 202, 198, 198, 197, 201, 199,
+    201, 197, 201, 199, 203, 204, 203, 199,
+    199, 200, 204, 190, 189, 205, 205, 189,
+    193, 206, 207, 205, 205, 194, 206, 208,
+    206, 194, 194, 198, 208, 209, 208, 198,
+    198, 202, 209, 210, 211, 215, 207, 206,
+    214, 208, 214, 206, 214, 208, 212, 213,
+    212, 208, 208, 209, 213, 207, 214, 215,
+    212, 210, 214, 215, 214, 210, 216, 115,
+    117, 117, 190, 216, 207, 216, 190, 190,
+    205, 207, 217, 133, 115, 115, 216, 217,
+    215, 217, 216, 216, 207, 215, 218, 219,
+    215, 215, 211, 218, 220, 134, 133, 133,
+    217, 220, 219, 220, 217, 217, 215, 219,
+    221, 222, 219, 219, 218, 221, 114, 121,
+    222, 222, 221, 114, 140, 134, 220, 140,
+    222, 121, 222, 140, 220, 220, 219, 222,
+    223, 224, 309, 203, 204, 334, 225, 226,
+    224, 224, 223, 225, 227, 228, 226, 226,
+    225, 227, 229, 230, 228, 228, 227, 229,
+    229, 231, 230, 232, 233, 231, 231, 229,
+    232, 234, 235, 233, 233, 232, 234, 236,
+    237, 235, 235, 234, 236, 238, 239, 237,
+    237, 236, 238, 240, 241, 239, 239, 238,
+    240, 242, 243, 241, 241, 240, 242, 244,
+    245, 243, 243, 242, 244, 246, 247, 237,
+    237, 239, 246, 248, 249, 247, 247, 246,
+    248, 247, 250, 235, 235, 237, 247, 247,
+    251, 250, 249, 252, 251, 251, 247, 249,
+    253, 254, 230, 230, 231, 253, 255, 256,
+    254, 254, 253, 255, 228, 230, 254, 257,
+    258, 256, 256, 255, 257, 257, 252, 258,
+    252, 257, 251, 259, 260, 202, 202, 201,
+    259, 261, 259, 201, 201, 203, 261, 260,
+    262, 209, 209, 202, 260, 262, 263, 213,
+    213, 209, 262, 258, 252, 270, 260, 259,
+    258, 259, 261, 256, 270, 271, 262, 264,
+    265, 263, 263, 262, 264, 266, 267, 272,
+    272, 248, 266, 267, 264, 271, 252, 249,
+    272, 268, 269, 267, 267, 266, 268, 269,
+    265, 264, 264, 267, 269, 259, 256, 258,
+    260, 258, 270, 262, 260, 270, 252, 271,
+    270, 267, 271, 272, 272, 271, 252, 248,
+    272, 249, 264, 262, 271, 115, 133, 116,
+    275, 276, 274, 274, 273, 275, 277, 278,
+    273, 273, 274, 277, 279, 255, 278, 278,
+    277, 279, 250, 280, 276, 276, 275, 250,
+    281, 282, 280, 280, 250, 281, 283, 284,
+    282, 282, 281, 283, 285, 279, 284, 284,
+    283, 285, 279, 285, 255, 233, 235, 275,
+    275, 273, 233, 231, 233, 273, 273, 278,
+    231, 255, 253, 278, 250, 275, 235, 250,
+    251, 281, 283, 281, 251, 251, 257, 283,
+    285, 283, 257, 255, 285, 257, 253, 231,
+    278, 286, 288, 239, 239, 241, 286, 241,
+    287, 286, 287, 241, 243, 293, 289, 248,
+    248, 246, 293, 290, 266, 248, 248, 289,
+    290, 291, 292, 295, 289, 293, 294, 292,
+    291, 289, 288, 246, 239, 288, 293, 246,
+    289, 294, 292, 243, 245, 295, 295, 245,
+    291, 296, 297, 268, 268, 266, 296, 298,
+    299, 297, 297, 296, 298, 266, 290, 296,
+    290, 289, 298, 298, 296, 290, 245, 244,
+    300, 300, 301, 289, 289, 291, 300, 291,
+    245, 300, 302, 303, 299, 299, 298, 302,
+    301, 302, 298, 298, 289, 301, 301, 300,
+    303, 303, 302, 301, 304, 305, 226, 226,
+    228, 304, 254, 304, 228, 304, 254, 306,
+    305, 307, 224, 305, 224, 226, 307, 309,
+    224, 309, 307, 308, 203, 334, 310, 223,
+    309, 334, 308, 311, 310, 310, 309, 308,
+    312, 313, 311, 311, 308, 312, 314, 315,
+    313, 313, 312, 314, 316, 317, 315, 315,
+    314, 316, 318, 261, 311, 311, 313, 319,
+    319, 318, 311, 313, 315, 319, 320, 319,
+    315, 315, 317, 320, 321, 322, 317, 317,
+    316, 321, 320, 317, 322, 323, 324, 312,
+    312, 308, 323, 324, 325, 314, 314, 312,
+    324, 325, 326, 316, 316, 314, 325, 327,
+    328, 319, 319, 320, 327, 322, 321, 329,
+    326, 329, 321, 321, 316, 326, 329, 327,
+    320, 320, 322, 329, 330, 331, 261, 261,
+    318, 330, 328, 330, 318, 318, 319, 328,
+    330, 333, 331, 333, 330, 332, 328, 332,
+    330, 332, 328, 327, 326, 325, 333, 333,
+    332, 326, 329, 326, 332, 332, 327, 329,
+    331, 333, 324, 333, 325, 324, 331, 256,
+    261, 256, 331, 324, 324, 323, 256, 261,
+    203, 310, 310, 311, 261, 334, 309, 310,
+    256, 306, 254, 306, 256, 323, 288, 286,
+    335, 286, 287, 335, 287, 243, 335, 295,
+    292, 335, 294, 293, 335, 293, 288, 335,
+    292, 294, 335, 243, 295, 335, 274, 276,
+    336, 277, 274, 336, 279, 277, 336, 276,
+    280, 336, 280, 282, 336, 282, 284, 336,
+    284, 279, 336, 337, 338, 27, 27, 29,
+    337, 25, 27, 338, 339, 340, 29, 29,
+    93, 339, 29, 341, 337, 341, 29, 340,
+    342, 343, 340, 340, 339, 342, 343, 344,
+    341, 341, 340, 343, 345, 346, 343, 343,
+    342, 345, 346, 347, 344, 344, 343, 346,
+    348, 349, 346, 346, 345, 348, 349, 350,
+    347, 347, 346, 349, 351, 352, 349, 349,
+    348, 351, 352, 353, 350, 350, 349, 352,
+    354, 355, 352, 352, 351, 354, 352, 355,
+    356, 356, 353, 352, 358, 357, 305, 305,
+    304, 358, 361, 359, 358, 358, 360, 361,
+    362, 363, 359, 359, 361, 362, 365, 364,
+    363, 365, 363, 362, 306, 360, 358, 358,
+    304, 306, 366, 360, 306, 306, 323, 366,
+    367, 361, 360, 360, 366, 367, 361, 367,
+    368, 362, 361, 368, 362, 368, 369, 371,
+    373, 367, 367, 366, 371, 308, 371, 366,
+    366, 323, 308, 372, 369, 368, 368, 370,
+    372, 369, 372, 365, 373, 371, 374, 374,
+    375, 373, 370, 373, 375, 375, 376, 370,
+    308, 307, 374, 374, 371, 308, 370, 376,
+    377, 377, 372, 370, 359, 363, 364, 364,
+    378, 359, 378, 375, 374, 374, 357, 378,
+    374, 307, 305, 305, 357, 374, 364, 377,
+    376, 377, 364, 365, 372, 377, 365, 362,
+    369, 365, 359, 378, 357, 357, 358, 359,
+    367, 373, 370, 370, 368, 367, 376, 375,
+    378, 378, 364, 376, 92, 88, 384, 384,
+    385, 92, 385, 384, 386, 386, 387, 385,
+    387, 386, 388, 388, 389, 387, 389, 388,
+    390, 390, 391, 389, 88, 87, 384, 87,
+    392, 384, 386, 384, 392, 87, 379, 392,
+    392, 388, 386, 381, 382, 379, 388, 392,
+    382, 382, 390, 388, 392, 379, 382, 380,
+    39, 393, 393, 381, 380, 381, 393, 394,
+    394, 383, 381, 406, 407, 405, 401, 406,
+    405, 396, 406, 401, 395, 396, 401, 404,
+    408, 383, 404, 383, 394, 407, 408, 404,
+    404, 405, 407, 393, 39, 95, 40, 393,
+    95, 393, 40, 394, 97, 41, 395, 401,
+    402, 395, 402, 97, 395, 391, 390, 397,
+    397, 398, 391, 382, 397, 390, 409, 382,
+    383, 380, 399, 39, 380, 400, 399, 379,
+    87, 400, 400, 380, 379, 383, 382, 381,
+    379, 380, 381, 97, 402, 403, 40, 97,
+    403, 394, 40, 403, 404, 394, 403, 383,
+    408, 409, 397, 382, 409, 410, 397, 409,
+    398, 397, 410, 396, 398, 410, 406, 396,
+    410, 411, 416, 417, 417, 412, 411, 412,
+    417, 418, 418, 413, 412, 413, 418, 419,
+    419, 414, 413, 414, 419, 420, 420, 415,
+    414, 415, 420, 416, 416, 411, 415, 416,
+    407, 406, 406, 417, 416, 417, 406, 410,
+    410, 418, 417, 418, 410, 409, 409, 419,
+    418, 419, 409, 408, 408, 420, 419, 420,
+    408, 407, 407, 416, 420, 411, 412, 421,
+    412, 413, 421, 413, 414, 421, 414, 415,
+    421, 415, 411, 421, 422, 427, 428, 428,
+    423, 422, 423, 428, 429, 429, 424, 423,
+    424, 429, 430, 430, 425, 424, 425, 430,
+    431, 431, 426, 425, 426, 431, 427, 427,
+    422, 426, 427, 405, 404, 404, 428, 427,
+    428, 404, 403, 403, 429, 428, 429, 403,
+    402, 402, 430, 429, 430, 402, 401, 401,
+    431, 430, 431, 401, 405, 405, 427, 431,
+    422, 423, 432, 423, 424, 432, 424, 425,
+    432, 425, 426, 432, 426, 422, 432, 436,
+    433, 435, 433, 436, 434, 438, 435, 437,
+    435, 438, 436, 440, 437, 439, 437, 440,
+    438, 439, 442, 441, 441, 440, 439, 442,
+    444, 443, 443, 441, 442, 434, 446, 445,
+    445, 433, 434, 487, 448, 447, 488, 445,
+    446, 436, 450, 449, 449, 434, 436, 438,
+    451, 450, 450, 436, 438, 440, 452, 451,
+    451, 438, 440, 441, 453, 452, 452, 440,
+    441, 434, 449, 455, 455, 446, 434, 446,
+    455, 456, 456, 448, 487, 453, 468, 457,
+    468, 453, 454, 459, 457, 468, 460, 462,
+    461, 459, 464, 463, 463, 457, 459, 461,
+    465, 464, 464, 459, 461, 466, 453, 457,
+    452, 466, 467, 466, 452, 453, 466, 463,
+    467, 463, 466, 457, 458, 460, 459, 461,
+    459, 460, 459, 468, 458, 454, 458, 468,
+    452, 469, 451, 469, 452, 467, 469, 470,
+    450, 450, 451, 469, 470, 471, 449, 449,
+    450, 470, 471, 472, 455, 455, 449, 471,
+    528, 473, 456, 528, 455, 472, 530, 474,
+    486, 530, 456, 473, 462, 476, 475, 475,
+    461, 462, 461, 475, 477, 477, 465, 461,
+    464, 479, 478, 478, 463, 464, 465, 480,
+    479, 479, 464, 465, 463, 478, 469, 469,
+    467, 463, 477, 481, 480, 480, 465, 477,
+    479, 483, 482, 482, 478, 479, 480, 484,
+    483, 483, 479, 480, 478, 482, 470, 470,
+    469, 478, 481, 485, 484, 484, 480, 481,
+    456, 486, 448, 456, 487, 446, 488, 487,
+    447, 446, 487, 488, 483, 490, 482, 489,
+    482, 490, 484, 491, 490, 490, 483, 484,
+    485, 492, 491, 491, 484, 485, 482, 489,
+    471, 471, 470, 482, 490, 494, 489, 493,
+    489, 494, 491, 495, 490, 494, 490, 495,
+    492, 496, 495, 489, 493, 472, 472, 471,
+    489, 534, 498, 497, 519, 527, 534, 533,
+    499, 498, 533, 517, 499, 533, 495, 496,
+    509, 497, 498, 511, 503, 502, 510, 498,
+    499, 511, 499, 500, 502, 506, 505, 505,
+    501, 502, 503, 507, 506, 506, 502, 503,
+    504, 508, 507, 507, 503, 504, 501, 509,
+    510, 511, 510, 499, 502, 510, 511, 607,
+    511, 500, 503, 511, 607, 504, 513, 532,
+    512, 508, 504, 606, 514, 513, 606, 515,
+    514, 515, 606, 500, 509, 498, 510, 501,
+    510, 502, 495, 491, 492, 516, 496, 492,
+    496, 516, 518, 518, 517, 496, 515, 500,
+    517, 517, 500, 499, 517, 518, 515, 534,
+    527, 494, 534, 494, 495, 481, 521, 520,
+    520, 485, 481, 492, 485, 520, 522, 475,
+    476, 522, 523, 477, 477, 475, 522, 523,
+    524, 481, 481, 477, 523, 524, 525, 521,
+    521, 481, 524, 462, 526, 476, 456, 455,
+    528, 527, 493, 494, 456, 530, 486, 529,
+    531, 515, 515, 518, 529, 519, 497, 531,
+    531, 529, 519, 514, 515, 531, 497, 509,
+    514, 514, 531, 497, 509, 501, 513, 513,
+    514, 509, 532, 513, 501, 504, 532, 512,
+    505, 532, 501, 496, 517, 533, 534, 533,
+    498, 497, 519, 534, 533, 534, 495, 492,
+    535, 516, 535, 492, 520, 518, 516, 536,
+    536, 529, 518, 529, 536, 527, 527, 519,
+    529, 535, 537, 536, 536, 516, 535, 537,
+    538, 527, 527, 536, 537, 538, 493, 527,
+    435, 558, 539, 558, 435, 433, 435, 539,
+    541, 541, 437, 435, 437, 541, 542, 542,
+    439, 437, 439, 542, 543, 543, 442, 439,
+    442, 543, 544, 544, 444, 442, 445, 545,
+    540, 540, 433, 445, 488, 546, 545, 545,
+    445, 488, 447, 547, 546, 546, 488, 447,
+    556, 549, 548, 550, 541, 539, 541, 550,
+    551, 551, 542, 541, 542, 551, 552, 552,
+    543, 542, 543, 552, 553, 553, 544, 543,
+    568, 546, 547, 556, 555, 557, 555, 548,
+    550, 548, 555, 556, 557, 539, 558, 539,
+    555, 550, 555, 539, 557, 433, 540, 558,
+    557, 558, 540, 556, 559, 560, 559, 556,
+    557, 560, 561, 562, 561, 560, 559, 560,
+    563, 549, 549, 556, 560, 562, 564, 563,
+    563, 560, 562, 540, 559, 557, 559, 540,
+    565, 565, 561, 559, 566, 549, 563, 564,
+    567, 566, 566, 563, 564, 568, 547, 554,
+    545, 546, 568, 540, 545, 565, 568, 565,
+    545, 569, 565, 568, 561, 571, 570, 570,
+    562, 561, 562, 570, 572, 572, 564, 562,
+    564, 572, 573, 573, 567, 564, 565, 569,
+    571, 571, 561, 565, 554, 573, 572, 554,
+    575, 574, 574, 568, 554, 568, 574, 576,
+    576, 569, 568, 571, 578, 577, 577, 570,
+    571, 570, 577, 579, 579, 572, 570, 569,
+    576, 578, 578, 571, 569, 572, 579, 575,
+    575, 554, 572, 575, 581, 580, 580, 574,
+    575, 574, 580, 582, 582, 576, 574, 578,
+    584, 583, 583, 577, 578, 577, 583, 585,
+    585, 579, 577, 576, 582, 584, 584, 578,
+    576, 579, 585, 581, 581, 575, 579, 581,
+    587, 586, 586, 580, 581, 580, 586, 588,
+    588, 582, 580, 584, 590, 589, 589, 583,
+    584, 583, 589, 591, 591, 585, 583, 582,
+    588, 590, 590, 584, 582, 585, 591, 587,
+    587, 581, 585, 589, 593, 592, 592, 591,
+    589, 594, 592, 593, 594, 596, 595, 590,
+    597, 593, 593, 589, 590, 590, 598, 597,
+    598, 590, 588, 594, 593, 597, 598, 599,
+    597, 597, 600, 596, 596, 594, 597, 592,
+    601, 587, 587, 591, 592, 601, 592, 594,
+    595, 602, 601, 601, 594, 595, 598, 586,
+    587, 587, 601, 598, 603, 598, 601, 598,
+    588, 586, 598, 603, 599, 599, 604, 600,
+    600, 597, 599, 601, 602, 605, 605, 603,
+    601, 603, 605, 604, 604, 599, 603, 605,
+    602, 600, 600, 604, 605, 602, 595, 596,
+    596, 600, 602, 441, 443, 454, 454, 453,
+    441, 607, 606, 504, 606, 607, 500, 503,
+    607, 504, 513, 504, 606, 506, 609, 608,
+    608, 505, 506, 610, 608, 609, 610, 612,
+    611, 507, 613, 609, 609, 506, 507, 507,
+    614, 613, 614, 507, 508, 610, 609, 613,
+    614, 615, 613, 613, 616, 612, 612, 610,
+    613, 608, 617, 532, 532, 505, 608, 617,
+    608, 610, 611, 618, 617, 617, 610, 611,
+    614, 512, 532, 532, 617, 614, 619, 614,
+    617, 614, 508, 512, 614, 619, 615, 615,
+    620, 616, 616, 613, 615, 617, 618, 621,
+    621, 619, 617, 619, 621, 620, 620, 615,
+    619, 621, 618, 616, 616, 620, 621, 618,
+    611, 612, 612, 616, 618, 550, 623, 622,
+    622, 551, 550, 551, 622, 624, 624, 552,
+    551, 552, 624, 625, 625, 553, 552, 638,
+    627, 626, 622, 626, 628, 628, 624, 622,
+    624, 628, 629, 629, 625, 624, 627, 631,
+    630, 630, 626, 627, 626, 630, 632, 632,
+    628, 626, 628, 632, 633, 633, 629, 628,
+    631, 635, 634, 634, 630, 631, 630, 634,
+    632, 636, 632, 634, 632, 636, 637, 637,
+    633, 632, 638, 622, 623, 626, 622, 638,
+    638, 640, 639, 639, 627, 638, 627, 639,
+    641, 641, 631, 627, 631, 641, 642, 642,
+    635, 631, 648, 644, 643, 647, 639, 640,
+    639, 647, 641, 645, 641, 647, 641, 645,
+    646, 646, 642, 641, 648, 647, 640, 647,
+    643, 645, 643, 647, 648, 550, 548, 649,
+    649, 623, 550, 623, 649, 640, 640, 638,
+    623, 548, 566, 650, 650, 649, 548, 649,
+    650, 648, 648, 640, 649, 648, 652, 651,
+    651, 644, 648, 566, 567, 653, 653, 650,
+    566, 650, 653, 652, 652, 648, 650, 652,
+    655, 654, 654, 651, 652, 655, 554, 547,
+    547, 654, 655, 653, 567, 573, 554, 655,
+    573, 653, 573, 655, 655, 652, 653, 742,
+    657, 656, 767, 637, 636, 657, 659, 658,
+    658, 656, 657, 659, 661, 660, 660, 658,
+    659, 661, 663, 662, 662, 660, 661, 663,
+    664, 662, 664, 666, 665, 665, 662, 664,
+    666, 668, 667, 667, 665, 666, 668, 670,
+    669, 669, 667, 668, 670, 672, 671, 671,
+    669, 670, 672, 674, 673, 673, 671, 672,
+    674, 676, 675, 675, 673, 674, 676, 678,
+    677, 677, 675, 676, 670, 680, 679, 679,
+    672, 670, 680, 682, 681, 681, 679, 680,
+    668, 683, 680, 680, 670, 668, 683, 684,
+    680, 684, 685, 682, 682, 680, 684, 663,
+    687, 686, 686, 664, 663, 687, 689, 688,
+    688, 686, 687, 687, 663, 661, 689, 691,
+    690, 690, 688, 689, 691, 685, 690, 684,
+    690, 685, 635, 693, 692, 692, 634, 635,
+    634, 692, 694, 694, 636, 634, 642, 695,
+    693, 693, 635, 642, 646, 696, 695, 695,
+    642, 646, 703, 685, 691, 691, 692, 693,
+    689, 694, 692, 695, 704, 703, 696, 698,
+    697, 697, 695, 696, 705, 700, 699, 699,
+    681, 705, 704, 697, 700, 705, 682, 685,
+    700, 702, 701, 701, 699, 700, 697, 698,
+    702, 702, 700, 697, 691, 689, 692, 703,
+    691, 693, 703, 693, 695, 703, 704, 685,
+    705, 704, 700, 685, 704, 705, 682, 705,
+    681, 704, 695, 697, 549, 566, 548, 707,
+    709, 708, 708, 706, 707, 706, 711, 710,
+    710, 707, 706, 711, 688, 712, 712, 710,
+    711, 709, 713, 683, 683, 708, 709, 713,
+    715, 714, 714, 683, 713, 715, 717, 716,
+    716, 714, 715, 717, 712, 718, 718, 716,
+    717, 688, 718, 712, 708, 668, 666, 666,
+    706, 708, 706, 666, 664, 664, 711, 706,
+    711, 686, 688, 668, 708, 683, 714, 684,
+    683, 684, 714, 716, 716, 690, 684, 690,
+    716, 718, 690, 718, 688, 711, 664, 686,
+    672, 721, 719, 719, 674, 672, 719, 720,
+    674, 676, 674, 720, 681, 722, 726, 726,
+    679, 681, 681, 699, 723, 723, 722, 681,
+    728, 725, 724, 727, 726, 722, 722, 724,
+    725, 672, 679, 721, 679, 726, 721, 725,
+    727, 722, 728, 678, 676, 724, 678, 728,
+    701, 730, 729, 729, 699, 701, 730, 732,
+    731, 731, 729, 730, 729, 723, 699, 731,
+    722, 723, 723, 729, 731, 733, 677, 678,
+    722, 734, 733, 733, 724, 722, 733, 678,
+    724, 732, 736, 735, 735, 731, 732, 731,
+    735, 734, 734, 722, 731, 736, 733, 734,
+    734, 735, 736, 659, 738, 737, 737, 661,
+    659, 661, 737, 687, 739, 687, 737, 657,
+    740, 738, 659, 657, 738, 657, 742, 740,
+    741, 740, 742, 743, 767, 636, 767, 742,
+    656, 743, 744, 741, 741, 742, 743, 744,
+    746, 745, 745, 741, 744, 746, 748, 747,
+    747, 745, 746, 748, 750, 749, 749, 747,
+    748, 744, 694, 751, 752, 746, 744, 744,
+    751, 752, 752, 748, 746, 748, 752, 753,
+    753, 750, 748, 750, 755, 754, 754, 749,
+    750, 755, 750, 753, 745, 757, 756, 756,
+    741, 745, 747, 758, 757, 757, 745, 747,
+    749, 759, 758, 758, 747, 749, 752, 761,
+    760, 760, 753, 752, 762, 754, 755, 754,
+    762, 759, 759, 749, 754, 753, 760, 762,
+    762, 755, 753, 694, 764, 763, 763, 751,
+    694, 751, 763, 761, 761, 752, 751, 764,
+    766, 763, 765, 763, 766, 763, 765, 761,
+    760, 761, 765, 766, 758, 759, 759, 765,
+    766, 765, 759, 762, 762, 760, 765, 757,
+    766, 764, 757, 758, 766, 694, 689, 764,
+    757, 764, 689, 689, 756, 757, 743, 636,
+    694, 694, 744, 743, 743, 742, 767, 687,
+    739, 689, 756, 689, 739, 768, 719, 721,
+    768, 720, 719, 768, 676, 720, 768, 725,
+    728, 768, 726, 727, 768, 721, 726, 768,
+    727, 725, 768, 728, 676, 769, 709, 707,
+    769, 707, 710, 769, 710, 712, 769, 713,
+    709, 769, 715, 713, 769, 717, 715, 769,
+    712, 717, 460, 771, 770, 770, 462, 460,
+    771, 460, 458, 462, 773, 772, 772, 526,
+    462, 770, 774, 462, 773, 462, 774, 773,
+    776, 775, 775, 772, 773, 774, 777, 776,
+    776, 773, 774, 776, 779, 778, 778, 775,
+    776, 777, 780, 779, 779, 776, 777, 779,
+    782, 781, 781, 778, 779, 780, 783, 782,
+    782, 779, 780, 782, 785, 784, 784, 781,
+    782, 783, 786, 785, 785, 782, 783, 785,
+    788, 787, 787, 784, 785, 789, 788, 785,
+    785, 786, 789, 738, 790, 791, 791, 737,
+    738, 791, 792, 794, 794, 793, 791, 792,
+    796, 795, 795, 794, 792, 796, 797, 798,
+    795, 796, 798, 791, 793, 739, 739, 737,
+    791, 739, 793, 799, 799, 756, 739, 793,
+    794, 800, 800, 799, 793, 801, 800, 794,
+    801, 794, 795, 802, 801, 795, 800, 806,
+    804, 804, 799, 800, 799, 804, 741, 741,
+    756, 799, 801, 802, 805, 805, 803, 801,
+    798, 805, 802, 807, 804, 806, 806, 808,
+    807, 808, 806, 803, 803, 809, 808, 807,
+    740, 741, 741, 804, 807, 810, 809, 803,
+    803, 805, 810, 797, 796, 792, 792, 811,
+    797, 807, 808, 811, 811, 790, 807, 738,
+    740, 807, 807, 790, 738, 809, 810, 797,
+    798, 797, 810, 798, 810, 805, 798, 802,
+    795, 790, 811, 792, 792, 791, 790, 803,
+    806, 800, 800, 801, 803, 811, 808, 809,
+    809, 797, 811, 817, 521, 525, 525, 818,
+    817, 819, 817, 818, 818, 820, 819, 821,
+    819, 820, 820, 822, 821, 823, 821, 822,
+    822, 824, 823, 817, 520, 521, 817, 825,
+    520, 825, 817, 819, 825, 812, 520, 819,
+    821, 825, 812, 815, 814, 815, 825, 821,
+    821, 823, 815, 815, 812, 825, 826, 472,
+    813, 813, 814, 826, 827, 826, 814, 814,
+    816, 827, 838, 840, 839, 838, 839, 834,
+    834, 839, 829, 834, 829, 828, 816, 841,
+    837, 827, 816, 837, 837, 841, 840, 840,
+    838, 837, 528, 472, 826, 528, 826, 473,
+    827, 473, 826, 828, 474, 530, 828, 835,
+    834, 828, 530, 835, 830, 823, 824, 824,
+    831, 830, 823, 830, 815, 816, 815, 842,
+    472, 832, 813, 832, 833, 813, 833, 520,
+    812, 812, 813, 833, 814, 815, 816, 814,
+    813, 812, 836, 835, 530, 836, 530, 473,
+    836, 473, 827, 836, 827, 837, 842, 841,
+    816, 842, 815, 830, 842, 830, 843, 843,
+    830, 831, 843, 831, 829, 843, 829, 839,
+    850, 849, 844, 844, 845, 850, 851, 850,
+    845, 845, 846, 851, 852, 851, 846, 846,
+    847, 852, 853, 852, 847, 847, 848, 853,
+    849, 853, 848, 848, 844, 849, 839, 840,
+    849, 849, 850, 839, 843, 839, 850, 850,
+    851, 843, 842, 843, 851, 851, 852, 842,
+    841, 842, 852, 852, 853, 841, 840, 841,
+    853, 853, 849, 840, 854, 845, 844, 854,
+    846, 845, 854, 847, 846, 854, 848, 847,
+    854, 844, 848, 861, 860, 855, 855, 856,
+    861, 862, 861, 856, 856, 857, 862, 863,
+    862, 857, 857, 858, 863, 864, 863, 858,
+    858, 859, 864, 860, 864, 859, 859, 855,
+    860, 837, 838, 860, 860, 861, 837, 836,
+    837, 861, 861, 862, 836, 835, 836, 862,
+    862, 863, 835, 834, 835, 863, 863, 864,
+    834, 838, 834, 864, 864, 860, 838, 865,
+    856, 855, 865, 857, 856, 865, 858, 857,
+    865, 859, 858, 865, 855, 859, 868, 866,
+    869, 867, 869, 866, 870, 868, 871, 869,
+    871, 868, 872, 870, 873, 871, 873, 870,
+    874, 875, 872, 872, 873, 874, 876, 877,
+    875, 875, 874, 876, 878, 879, 867, 867,
+    866, 878, 880, 881, 920, 879, 878, 921,
+    882, 883, 869, 869, 867, 882, 883, 884,
+    871, 871, 869, 883, 884, 885, 873, 873,
+    871, 884, 885, 886, 874, 874, 873, 885,
+    888, 882, 867, 867, 879, 888, 889, 888,
+    879, 920, 881, 889, 890, 901, 886, 887,
+    886, 901, 901, 890, 892, 894, 895, 893,
+    896, 897, 892, 892, 890, 896, 897, 898,
+    894, 894, 892, 897, 890, 886, 899, 900,
+    899, 885, 886, 885, 899, 900, 896, 899,
+    890, 899, 896, 892, 893, 891, 893, 892,
+    894, 891, 901, 892, 901, 891, 887, 884,
+    902, 885, 900, 885, 902, 883, 903, 902,
+    902, 884, 883, 882, 904, 903, 903, 883,
+    882, 888, 905, 904, 904, 882, 888, 889,
+    906, 961, 905, 888, 961, 919, 907, 963,
+    906, 889, 963, 908, 909, 895, 895, 894,
+    908, 910, 908, 894, 894, 898, 910, 911,
+    912, 897, 897, 896, 911, 912, 913, 898,
+    898, 897, 912, 902, 911, 896, 896, 900,
+    902, 913, 914, 910, 910, 898, 913, 915,
+    916, 912, 912, 911, 915, 916, 917, 913,
+    913, 912, 916, 903, 915, 911, 911, 902,
+    903, 917, 918, 914, 914, 913, 917, 881,
+    919, 889, 879, 920, 889, 880, 920, 921,
+    921, 920, 879, 915, 923, 916, 923, 915,
+    922, 923, 924, 917, 917, 916, 923, 924,
+    925, 918, 918, 917, 924, 904, 922, 915,
+    915, 903, 904, 922, 927, 923, 927, 922,
+    926, 923, 928, 924, 928, 923, 927, 928,
+    929, 925, 905, 926, 922, 922, 904, 905,
+    930, 931, 967, 967, 960, 952, 931, 932,
+    966, 932, 950, 966, 929, 928, 966, 931,
+    930, 942, 935, 936, 944, 932, 931, 943,
+    933, 932, 944, 938, 939, 935, 935, 934,
+    938, 939, 940, 936, 936, 935, 939, 940,
+    941, 937, 937, 936, 940, 943, 942, 934,
+    932, 943, 944, 944, 943, 935, 933, 944,
+    1040, 1040, 944, 936, 965, 946, 937, 937,
+    941, 945, 946, 947, 1039, 947, 948, 1039,
+    933, 1039, 948, 943, 931, 942, 935, 943,
+    934, 925, 924, 928, 925, 929, 949, 951,
+    949, 929, 929, 950, 951, 950, 933, 948,
+    932, 933, 950, 948, 951, 950, 927, 960,
+    967, 928, 927, 967, 953, 954, 914, 914,
+    918, 953, 953, 918, 925, 909, 908, 955,
+    910, 956, 955, 955, 908, 910, 914, 957,
+    956, 956, 910, 914, 954, 958, 957, 957,
+    914, 954, 909, 959, 895, 961, 888, 889,
+    927, 926, 960, 919, 963, 889, 948, 964,
+    962, 962, 951, 948, 964, 930, 952, 952,
+    962, 964, 964, 948, 947, 947, 942, 930,
+    930, 964, 947, 946, 934, 942, 942, 947,
+    946, 934, 946, 965, 945, 965, 937, 934,
+    965, 938, 966, 950, 929, 931, 966, 967,
+    967, 952, 930, 928, 967, 966, 949, 968,
+    925, 953, 925, 968, 969, 949, 951, 951,
+    962, 969, 960, 969, 962, 962, 952, 960,
+    969, 970, 968, 968, 949, 969, 960, 971,
+    970, 970, 969, 960, 960, 926, 971, 972,
+    991, 868, 866, 868, 991, 974, 972, 868,
+    868, 870, 974, 975, 974, 870, 870, 872,
+    975, 976, 975, 872, 872, 875, 976, 977,
+    976, 875, 875, 877, 977, 973, 978, 878,
+    878, 866, 973, 978, 979, 921, 921, 878,
+    978, 979, 980, 880, 880, 921, 979, 981,
+    982, 989, 972, 974, 983, 984, 983, 974,
+    974, 975, 984, 985, 984, 975, 975, 976,
+    985, 986, 985, 976, 976, 977, 986, 980,
+    979, 1001, 990, 988, 989, 983, 981, 988,
+    989, 988, 981, 991, 972, 990, 983, 988,
+    972, 990, 972, 988, 991, 973, 866, 973,
+    991, 990, 993, 992, 989, 990, 989, 992,
+    995, 994, 993, 992, 993, 994, 982, 996,
+    993, 993, 989, 982, 996, 997, 995, 995,
+    993, 996, 990, 992, 973, 998, 973, 992,
+    992, 994, 998, 996, 982, 999, 999, 1000,
+    997, 997, 996, 999, 987, 980, 1001, 1001,
+    979, 978, 998, 978, 973, 978, 998, 1001,
+    1001, 998, 1002, 1003, 1004, 994, 994, 995,
+    1003, 1005, 1003, 995, 995, 997, 1005, 1006,
+    1005, 997, 997, 1000, 1006, 1004, 1002, 998,
+    998, 994, 1004, 1005, 1006, 987, 1007, 1008,
+    987, 987, 1001, 1007, 1009, 1007, 1001, 1001,
+    1002, 1009, 1010, 1011, 1004, 1004, 1003, 1010,
+    1012, 1010, 1003, 1003, 1005, 1012, 1011, 1009,
+    1002, 1002, 1004, 1011, 1008, 1012, 1005, 1005,
+    987, 1008, 1013, 1014, 1008, 1008, 1007, 1013,
+    1015, 1013, 1007, 1007, 1009, 1015, 1016, 1017,
+    1011, 1011, 1010, 1016, 1018, 1016, 1010, 1010,
+    1012, 1018, 1017, 1015, 1009, 1009, 1011, 1017,
+    1014, 1018, 1012, 1012, 1008, 1014, 1019, 1020,
+    1014, 1014, 1013, 1019, 1021, 1019, 1013, 1013,
+    1015, 1021, 1022, 1023, 1017, 1017, 1016, 1022,
+    1024, 1022, 1016, 1016, 1018, 1024, 1023, 1021,
+    1015, 1015, 1017, 1023, 1020, 1024, 1018, 1018,
+    1014, 1020, 1025, 1026, 1022, 1022, 1024, 1025,
+    1026, 1025, 1027, 1028, 1029, 1027, 1026, 1030,
+    1023, 1023, 1022, 1026, 1030, 1031, 1023, 1021,
+    1023, 1031, 1030, 1026, 1027, 1030, 1032, 1031,
+    1029, 1033, 1030, 1030, 1027, 1029, 1020, 1034,
+    1025, 1025, 1024, 1020, 1027, 1025, 1034, 1034,
+    1035, 1028, 1028, 1027, 1034, 1020, 1019, 1031,
+    1031, 1034, 1020, 1034, 1031, 1036, 1019, 1021,
+    1031, 1032, 1036, 1031, 1033, 1037, 1032, 1032,
+    1030, 1033, 1038, 1035, 1034, 1034, 1036, 1038,
+    1037, 1038, 1036, 1036, 1032, 1037, 1033, 1035,
+    1038, 1038, 1037, 1033, 1029, 1028, 1035, 1035,
+    1033, 1029, 887, 876, 874, 874, 886, 887,
+    937, 1039, 1040, 933, 1040, 1039, 937, 1040,
+    936, 1039, 937, 946, 1041, 1042, 939, 939,
+    938, 1041, 1042, 1041, 1043, 1044, 1045, 1043,
+    1042, 1046, 940, 940, 939, 1042, 1046, 1047,
+    940, 941, 940, 1047, 1046, 1042, 1043, 1046,
+    1048, 1047, 1045, 1049, 1046, 1046, 1043, 1045,
+    965, 1050, 1041, 1041, 938, 965, 1043, 1041,
+    1050, 1050, 1051, 1044, 1044, 1043, 1050, 965,
+    945, 1047, 1047, 1050, 965, 1050, 1047, 1052,
+    945, 941, 1047, 1048, 1052, 1047, 1049, 1053,
+    1048, 1048, 1046, 1049, 1054, 1051, 1050, 1050,
+    1052, 1054, 1053, 1054, 1052, 1052, 1048, 1053,
+    1049, 1051, 1054, 1054, 1053, 1049, 1045, 1044,
+    1051, 1051, 1049, 1045, 1055, 1056, 983, 983,
+    984, 1055, 1057, 1055, 984, 984, 985, 1057,
+    1058, 1057, 985, 985, 986, 1058, 1059, 1060,
+    1071, 1061, 1059, 1055, 1055, 1057, 1061, 1062,
+    1061, 1057, 1057, 1058, 1062, 1063, 1064, 1060,
+    1060, 1059, 1063, 1065, 1063, 1059, 1059, 1061,
+    1065, 1066, 1065, 1061, 1061, 1062, 1066, 1067,
+    1068, 1064, 1064, 1063, 1067, 1065, 1067, 1063,
+    1067, 1065, 1069, 1070, 1069, 1065, 1065, 1066,
+    1070, 1056, 1055, 1071, 1071, 1055, 1059, 1072,
+    1073, 1071, 1071, 1060, 1072, 1074, 1072, 1060,
+    1060, 1064, 1074, 1075, 1074, 1064, 1064, 1068,
+    1075, 1076, 1077, 1081, 1073, 1072, 1080, 1074,
+    1080, 1072, 1080, 1074, 1078, 1079, 1078, 1074,
+    1074, 1075, 1079, 1073, 1080, 1081, 1078, 1076,
+    1080, 1081, 1080, 1076, 1082, 981, 983, 983,
+    1056, 1082, 1073, 1082, 1056, 1056, 1071, 1073,
+    1083, 999, 981, 981, 1082, 1083, 1081, 1083,
+    1082, 1082, 1073, 1081, 1084, 1085, 1081, 1081,
+    1077, 1084, 1086, 1000, 999, 999, 1083, 1086,
+    1085, 1086, 1083, 1083, 1081, 1085, 1087, 1088,
+    1085, 1085, 1084, 1087, 980, 987, 1088, 1088,
+    1087, 980, 1006, 1000, 1086, 1006, 1088, 987,
+    1088, 1006, 1086, 1086, 1085, 1088, 1089, 1090,
+    1175, 1069, 1070, 1200, 1091, 1092, 1090, 1090,
+    1089, 1091, 1093, 1094, 1092, 1092, 1091, 1093,
+    1095, 1096, 1094, 1094, 1093, 1095, 1095, 1097,
+    1096, 1098, 1099, 1097, 1097, 1095, 1098, 1100,
+    1101, 1099, 1099, 1098, 1100, 1102, 1103, 1101,
+    1101, 1100, 1102, 1104, 1105, 1103, 1103, 1102,
+    1104, 1106, 1107, 1105, 1105, 1104, 1106, 1108,
+    1109, 1107, 1107, 1106, 1108, 1110, 1111, 1109,
+    1109, 1108, 1110, 1112, 1113, 1103, 1103, 1105,
+    1112, 1114, 1115, 1113, 1113, 1112, 1114, 1113,
+    1116, 1101, 1101, 1103, 1113, 1113, 1117, 1116,
+    1115, 1118, 1117, 1117, 1113, 1115, 1119, 1120,
+    1096, 1096, 1097, 1119, 1121, 1122, 1120, 1120,
+    1119, 1121, 1094, 1096, 1120, 1123, 1124, 1122,
+    1122, 1121, 1123, 1123, 1118, 1124, 1118, 1123,
+    1117, 1125, 1126, 1068, 1068, 1067, 1125, 1127,
+    1125, 1067, 1067, 1069, 1127, 1126, 1128, 1075,
+    1075, 1068, 1126, 1128, 1129, 1079, 1079, 1075,
+    1128, 1124, 1118, 1136, 1126, 1125, 1124, 1125,
+    1127, 1122, 1136, 1137, 1128, 1130, 1131, 1129,
+    1129, 1128, 1130, 1132, 1133, 1138, 1138, 1114,
+    1132, 1133, 1130, 1137, 1118, 1115, 1138, 1134,
+    1135, 1133, 1133, 1132, 1134, 1135, 1131, 1130,
+    1130, 1133, 1135, 1125, 1122, 1124, 1126, 1124,
+    1136, 1128, 1126, 1136, 1118, 1137, 1136, 1133,
+    1137, 1138, 1138, 1137, 1118, 1114, 1138, 1115,
+    1130, 1128, 1137, 981, 999, 982, 1141, 1142,
+    1140, 1140, 1139, 1141, 1143, 1144, 1139, 1139,
+    1140, 1143, 1145, 1121, 1144, 1144, 1143, 1145,
+    1116, 1146, 1142, 1142, 1141, 1116, 1147, 1148,
+    1146, 1146, 1116, 1147, 1149, 1150, 1148, 1148,
+    1147, 1149, 1151, 1145, 1150, 1150, 1149, 1151,
+    1145, 1151, 1121, 1099, 1101, 1141, 1141, 1139,
+    1099, 1097, 1099, 1139, 1139, 1144, 1097, 1121,
+    1119, 1144, 1116, 1141, 1101, 1116, 1117, 1147,
+    1149, 1147, 1117, 1117, 1123, 1149, 1151, 1149,
+    1123, 1121, 1151, 1123, 1119, 1097, 1144, 1152,
+    1154, 1105, 1105, 1107, 1152, 1107, 1153, 1152,
+    1153, 1107, 1109, 1159, 1155, 1114, 1114, 1112,
+    1159, 1156, 1132, 1114, 1114, 1155, 1156, 1157,
+    1158, 1161, 1155, 1159, 1160, 1158, 1157, 1155,
+    1154, 1112, 1105, 1154, 1159, 1112, 1155, 1160,
+    1158, 1109, 1111, 1161, 1161, 1111, 1157, 1162,
+    1163, 1134, 1134, 1132, 1162, 1164, 1165, 1163,
+    1163, 1162, 1164, 1132, 1156, 1162, 1156, 1155,
+    1164, 1164, 1162, 1156, 1111, 1110, 1166, 1166,
+    1167, 1155, 1155, 1157, 1166, 1157, 1111, 1166,
+    1168, 1169, 1165, 1165, 1164, 1168, 1167, 1168,
+    1164, 1164, 1155, 1167, 1167, 1166, 1169, 1169,
+    1168, 1167, 1170, 1171, 1092, 1092, 1094, 1170,
+    1120, 1170, 1094, 1170, 1120, 1172, 1171, 1173,
+    1090, 1171, 1090, 1092, 1173, 1175, 1090, 1175,
+    1173, 1174, 1069, 1200, 1176, 1089, 1175, 1200,
+    1174, 1177, 1176, 1176, 1175, 1174, 1178, 1179,
+    1177, 1177, 1174, 1178, 1180, 1181, 1179, 1179,
+    1178, 1180, 1182, 1183, 1181, 1181, 1180, 1182,
+    1184, 1127, 1177, 1177, 1179, 1185, 1185, 1184,
+    1177, 1179, 1181, 1185, 1186, 1185, 1181, 1181,
+    1183, 1186, 1187, 1188, 1183, 1183, 1182, 1187,
+    1186, 1183, 1188, 1189, 1190, 1178, 1178, 1174,
+    1189, 1190, 1191, 1180, 1180, 1178, 1190, 1191,
+    1192, 1182, 1182, 1180, 1191, 1193, 1194, 1185,
+    1185, 1186, 1193, 1188, 1187, 1195, 1192, 1195,
+    1187, 1187, 1182, 1192, 1195, 1193, 1186, 1186,
+    1188, 1195, 1196, 1197, 1127, 1127, 1184, 1196,
+    1194, 1196, 1184, 1184, 1185, 1194, 1196, 1199,
+    1197, 1199, 1196, 1198, 1194, 1198, 1196, 1198,
+    1194, 1193, 1192, 1191, 1199, 1199, 1198, 1192,
+    1195, 1192, 1198, 1198, 1193, 1195, 1197, 1199,
+    1190, 1199, 1191, 1190, 1197, 1122, 1127, 1122,
+    1197, 1190, 1190, 1189, 1122, 1127, 1069, 1176,
+    1176, 1177, 1127, 1200, 1175, 1176, 1122, 1172,
+    1120, 1172, 1122, 1189, 1154, 1152, 1201, 1152,
+    1153, 1201, 1153, 1109, 1201, 1161, 1158, 1201,
+    1160, 1159, 1201, 1159, 1154, 1201, 1158, 1160,
+    1201, 1109, 1161, 1201, 1140, 1142, 1202, 1143,
+    1140, 1202, 1145, 1143, 1202, 1142, 1146, 1202,
+    1146, 1148, 1202, 1148, 1150, 1202, 1150, 1145,
+    1202, 1203, 1204, 893, 893, 895, 1203, 891,
+    893, 1204, 1205, 1206, 895, 895, 959, 1205,
+    895, 1207, 1203, 1207, 895, 1206, 1208, 1209,
+    1206, 1206, 1205, 1208, 1209, 1210, 1207, 1207,
+    1206, 1209, 1211, 1212, 1209, 1209, 1208, 1211,
+    1212, 1213, 1210, 1210, 1209, 1212, 1214, 1215,
+    1212, 1212, 1211, 1214, 1215, 1216, 1213, 1213,
+    1212, 1215, 1217, 1218, 1215, 1215, 1214, 1217,
+    1218, 1219, 1216, 1216, 1215, 1218, 1220, 1221,
+    1218, 1218, 1217, 1220, 1218, 1221, 1222, 1222,
+    1219, 1218, 1224, 1223, 1171, 1171, 1170, 1224,
+    1227, 1225, 1224, 1224, 1226, 1227, 1228, 1229,
+    1225, 1225, 1227, 1228, 1231, 1230, 1229, 1231,
+    1229, 1228, 1172, 1226, 1224, 1224, 1170, 1172,
+    1232, 1226, 1172, 1172, 1189, 1232, 1233, 1227,
+    1226, 1226, 1232, 1233, 1227, 1233, 1234, 1228,
+    1227, 1234, 1228, 1234, 1235, 1237, 1239, 1233,
+    1233, 1232, 1237, 1174, 1237, 1232, 1232, 1189,
+    1174, 1238, 1235, 1234, 1234, 1236, 1238, 1235,
+    1238, 1231, 1239, 1237, 1240, 1240, 1241, 1239,
+    1236, 1239, 1241, 1241, 1242, 1236, 1174, 1173,
+    1240, 1240, 1237, 1174, 1236, 1242, 1243, 1243,
+    1238, 1236, 1225, 1229, 1230, 1230, 1244, 1225,
+    1244, 1241, 1240, 1240, 1223, 1244, 1240, 1173,
+    1171, 1171, 1223, 1240, 1230, 1243, 1242, 1243,
+    1230, 1231, 1238, 1243, 1231, 1228, 1235, 1231,
+    1225, 1244, 1223, 1223, 1224, 1225, 1233, 1239,
+    1236, 1236, 1234, 1233, 1242, 1241, 1244, 1244,
+    1230, 1242, 958, 954, 1250, 1250, 1251, 958,
+    1251, 1250, 1252, 1252, 1253, 1251, 1253, 1252,
+    1254, 1254, 1255, 1253, 1255, 1254, 1256, 1256,
+    1257, 1255, 954, 953, 1250, 953, 1258, 1250,
+    1252, 1250, 1258, 953, 1245, 1258, 1258, 1254,
+    1252, 1247, 1248, 1245, 1254, 1258, 1248, 1248,
+    1256, 1254, 1258, 1245, 1248, 1246, 905, 1259,
+    1259, 1247, 1246, 1247, 1259, 1260, 1260, 1249,
+    1247, 1272, 1273, 1271, 1267, 1272, 1271, 1262,
+    1272, 1267, 1261, 1262, 1267, 1270, 1274, 1249,
+    1270, 1249, 1260, 1273, 1274, 1270, 1270, 1271,
+    1273, 1259, 905, 961, 906, 1259, 961, 1259,
+    906, 1260, 963, 907, 1261, 1267, 1268, 1261,
+    1268, 963, 1261, 1257, 1256, 1263, 1263, 1264,
+    1257, 1248, 1263, 1256, 1275, 1248, 1249, 1246,
+    1265, 905, 1246, 1266, 1265, 1245, 953, 1266,
+    1266, 1246, 1245, 1249, 1248, 1247, 1245, 1246,
+    1247, 963, 1268, 1269, 906, 963, 1269, 1260,
+    906, 1269, 1270, 1260, 1269, 1249, 1274, 1275,
+    1263, 1248, 1275, 1276, 1263, 1275, 1264, 1263,
+    1276, 1262, 1264, 1276, 1272, 1262, 1276, 1277,
+    1282, 1283, 1283, 1278, 1277, 1278, 1283, 1284,
+    1284, 1279, 1278, 1279, 1284, 1285, 1285, 1280,
+    1279, 1280, 1285, 1286, 1286, 1281, 1280, 1281,
+    1286, 1282, 1282, 1277, 1281, 1282, 1273, 1272,
+    1272, 1283, 1282, 1283, 1272, 1276, 1276, 1284,
+    1283, 1284, 1276, 1275, 1275, 1285, 1284, 1285,
+    1275, 1274, 1274, 1286, 1285, 1286, 1274, 1273,
+    1273, 1282, 1286, 1277, 1278, 1287, 1278, 1279,
+    1287, 1279, 1280, 1287, 1280, 1281, 1287, 1281,
+    1277, 1287, 1288, 1293, 1294, 1294, 1289, 1288,
+    1289, 1294, 1295, 1295, 1290, 1289, 1290, 1295,
+    1296, 1296, 1291, 1290, 1291, 1296, 1297, 1297,
+    1292, 1291, 1292, 1297, 1293, 1293, 1288, 1292,
+    1293, 1271, 1270, 1270, 1294, 1293, 1294, 1270,
+    1269, 1269, 1295, 1294, 1295, 1269, 1268, 1268,
+    1296, 1295, 1296, 1268, 1267, 1267, 1297, 1296,
+    1297, 1267, 1271, 1271, 1293, 1297, 1288, 1289,
+    1298, 1289, 1290, 1298, 1290, 1291, 1298, 1291,
+    1292, 1298, 1292, 1288, 1298, 1302, 1299, 1301,
+    1299, 1302, 1300, 1304, 1301, 1303, 1301, 1304,
+    1302, 1306, 1303, 1305, 1303, 1306, 1304, 1305,
+    1308, 1307, 1307, 1306, 1305, 1308, 1310, 1309,
+    1309, 1307, 1308, 1300, 1312, 1311, 1311, 1299,
+    1300, 1353, 1314, 1313, 1354, 1311, 1312, 1302,
+    1316, 1315, 1315, 1300, 1302, 1304, 1317, 1316,
+    1316, 1302, 1304, 1306, 1318, 1317, 1317, 1304,
+    1306, 1307, 1319, 1318, 1318, 1306, 1307, 1300,
+    1315, 1321, 1321, 1312, 1300, 1312, 1321, 1322,
+    1322, 1314, 1353, 1319, 1334, 1323, 1334, 1319,
+    1320, 1325, 1323, 1334, 1326, 1328, 1327, 1325,
+    1330, 1329, 1329, 1323, 1325, 1327, 1331, 1330,
+    1330, 1325, 1327, 1332, 1319, 1323, 1318, 1332,
+    1333, 1332, 1318, 1319, 1332, 1329, 1333, 1329,
+    1332, 1323, 1324, 1326, 1325, 1327, 1325, 1326,
+    1325, 1334, 1324, 1320, 1324, 1334, 1318, 1335,
+    1317, 1335, 1318, 1333, 1335, 1336, 1316, 1316,
+    1317, 1335, 1336, 1337, 1315, 1315, 1316, 1336,
+    1337, 1338, 1321, 1321, 1315, 1337, 1394, 1339,
+    1322, 1394, 1321, 1338, 1396, 1340, 1352, 1396,
+    1322, 1339, 1328, 1342, 1341, 1341, 1327, 1328,
+    1327, 1341, 1343, 1343, 1331, 1327, 1330, 1345,
+    1344, 1344, 1329, 1330, 1331, 1346, 1345, 1345,
+    1330, 1331, 1329, 1344, 1335, 1335, 1333, 1329,
+    1343, 1347, 1346, 1346, 1331, 1343, 1345, 1349,
+    1348, 1348, 1344, 1345, 1346, 1350, 1349, 1349,
+    1345, 1346, 1344, 1348, 1336, 1336, 1335, 1344,
+    1347, 1351, 1350, 1350, 1346, 1347, 1322, 1352,
+    1314, 1322, 1353, 1312, 1354, 1353, 1313, 1312,
+    1353, 1354, 1349, 1356, 1348, 1355, 1348, 1356,
+    1350, 1357, 1356, 1356, 1349, 1350, 1351, 1358,
+    1357, 1357, 1350, 1351, 1348, 1355, 1337, 1337,
+    1336, 1348, 1356, 1360, 1355, 1359, 1355, 1360,
+    1357, 1361, 1356, 1360, 1356, 1361, 1358, 1362,
+    1361, 1355, 1359, 1338, 1338, 1337, 1355, 1400,
+    1364, 1363, 1385, 1393, 1400, 1399, 1365, 1364,
+    1399, 1383, 1365, 1399, 1361, 1362, 1375, 1363,
+    1364, 1377, 1369, 1368, 1376, 1364, 1365, 1377,
+    1365, 1366, 1368, 1372, 1371, 1371, 1367, 1368,
+    1369, 1373, 1372, 1372, 1368, 1369, 1370, 1374,
+    1373, 1373, 1369, 1370, 1367, 1375, 1376, 1377,
+    1376, 1365, 1368, 1376, 1377, 1473, 1377, 1366,
+    1369, 1377, 1473, 1370, 1379, 1398, 1378, 1374,
+    1370, 1472, 1380, 1379, 1472, 1381, 1380, 1381,
+    1472, 1366, 1375, 1364, 1376, 1367, 1376, 1368,
+    1361, 1357, 1358, 1382, 1362, 1358, 1362, 1382,
+    1384, 1384, 1383, 1362, 1381, 1366, 1383, 1383,
+    1366, 1365, 1383, 1384, 1381, 1400, 1393, 1360,
+    1400, 1360, 1361, 1347, 1387, 1386, 1386, 1351,
+    1347, 1358, 1351, 1386, 1388, 1341, 1342, 1388,
+    1389, 1343, 1343, 1341, 1388, 1389, 1390, 1347,
+    1347, 1343, 1389, 1390, 1391, 1387, 1387, 1347,
+    1390, 1328, 1392, 1342, 1322, 1321, 1394, 1393,
+    1359, 1360, 1322, 1396, 1352, 1395, 1397, 1381,
+    1381, 1384, 1395, 1385, 1363, 1397, 1397, 1395,
+    1385, 1380, 1381, 1397, 1363, 1375, 1380, 1380,
+    1397, 1363, 1375, 1367, 1379, 1379, 1380, 1375,
+    1398, 1379, 1367, 1370, 1398, 1378, 1371, 1398,
+    1367, 1362, 1383, 1399, 1400, 1399, 1364, 1363,
+    1385, 1400, 1399, 1400, 1361, 1358, 1401, 1382,
+    1401, 1358, 1386, 1384, 1382, 1402, 1402, 1395,
+    1384, 1395, 1402, 1393, 1393, 1385, 1395, 1401,
+    1403, 1402, 1402, 1382, 1401, 1403, 1404, 1393,
+    1393, 1402, 1403, 1404, 1359, 1393, 1301, 1424,
+    1405, 1424, 1301, 1299, 1301, 1405, 1407, 1407,
+    1303, 1301, 1303, 1407, 1408, 1408, 1305, 1303,
+    1305, 1408, 1409, 1409, 1308, 1305, 1308, 1409,
+    1410, 1410, 1310, 1308, 1311, 1411, 1406, 1406,
+    1299, 1311, 1354, 1412, 1411, 1411, 1311, 1354,
+    1313, 1413, 1412, 1412, 1354, 1313, 1422, 1415,
+    1414, 1416, 1407, 1405, 1407, 1416, 1417, 1417,
+    1408, 1407, 1408, 1417, 1418, 1418, 1409, 1408,
+    1409, 1418, 1419, 1419, 1410, 1409, 1434, 1412,
+    1413, 1422, 1421, 1423, 1421, 1414, 1416, 1414,
+    1421, 1422, 1423, 1405, 1424, 1405, 1421, 1416,
+    1421, 1405, 1423, 1299, 1406, 1424, 1423, 1424,
+    1406, 1422, 1425, 1426, 1425, 1422, 1423, 1426,
+    1427, 1428, 1427, 1426, 1425, 1426, 1429, 1415,
+    1415, 1422, 1426, 1428, 1430, 1429, 1429, 1426,
+    1428, 1406, 1425, 1423, 1425, 1406, 1431, 1431,
+    1427, 1425, 1432, 1415, 1429, 1430, 1433, 1432,
+    1432, 1429, 1430, 1434, 1413, 1420, 1411, 1412,
+    1434, 1406, 1411, 1431, 1434, 1431, 1411, 1435,
+    1431, 1434, 1427, 1437, 1436, 1436, 1428, 1427,
+    1428, 1436, 1438, 1438, 1430, 1428, 1430, 1438,
+    1439, 1439, 1433, 1430, 1431, 1435, 1437, 1437,
+    1427, 1431, 1420, 1439, 1438, 1420, 1441, 1440,
+    1440, 1434, 1420, 1434, 1440, 1442, 1442, 1435,
+    1434, 1437, 1444, 1443, 1443, 1436, 1437, 1436,
+    1443, 1445, 1445, 1438, 1436, 1435, 1442, 1444,
+    1444, 1437, 1435, 1438, 1445, 1441, 1441, 1420,
+    1438, 1441, 1447, 1446, 1446, 1440, 1441, 1440,
+    1446, 1448, 1448, 1442, 1440, 1444, 1450, 1449,
+    1449, 1443, 1444, 1443, 1449, 1451, 1451, 1445,
+    1443, 1442, 1448, 1450, 1450, 1444, 1442, 1445,
+    1451, 1447, 1447, 1441, 1445, 1447, 1453, 1452,
+    1452, 1446, 1447, 1446, 1452, 1454, 1454, 1448,
+    1446, 1450, 1456, 1455, 1455, 1449, 1450, 1449,
+    1455, 1457, 1457, 1451, 1449, 1448, 1454, 1456,
+    1456, 1450, 1448, 1451, 1457, 1453, 1453, 1447,
+    1451, 1455, 1459, 1458, 1458, 1457, 1455, 1460,
+    1458, 1459, 1460, 1462, 1461, 1456, 1463, 1459,
+    1459, 1455, 1456, 1456, 1464, 1463, 1464, 1456,
+    1454, 1460, 1459, 1463, 1464, 1465, 1463, 1463,
+    1466, 1462, 1462, 1460, 1463, 1458, 1467, 1453,
+    1453, 1457, 1458, 1467, 1458, 1460, 1461, 1468,
+    1467, 1467, 1460, 1461, 1464, 1452, 1453, 1453,
+    1467, 1464, 1469, 1464, 1467, 1464, 1454, 1452,
+    1464, 1469, 1465, 1465, 1470, 1466, 1466, 1463,
+    1465, 1467, 1468, 1471, 1471, 1469, 1467, 1469,
+    1471, 1470, 1470, 1465, 1469, 1471, 1468, 1466,
+    1466, 1470, 1471, 1468, 1461, 1462, 1462, 1466,
+    1468, 1307, 1309, 1320, 1320, 1319, 1307, 1473,
+    1472, 1370, 1472, 1473, 1366, 1369, 1473, 1370,
+    1379, 1370, 1472, 1372, 1475, 1474, 1474, 1371,
+    1372, 1476, 1474, 1475, 1476, 1478, 1477, 1373,
+    1479, 1475, 1475, 1372, 1373, 1373, 1480, 1479,
+    1480, 1373, 1374, 1476, 1475, 1479, 1480, 1481,
+    1479, 1479, 1482, 1478, 1478, 1476, 1479, 1474,
+    1483, 1398, 1398, 1371, 1474, 1483, 1474, 1476,
+    1477, 1484, 1483, 1483, 1476, 1477, 1480, 1378,
+    1398, 1398, 1483, 1480, 1485, 1480, 1483, 1480,
+    1374, 1378, 1480, 1485, 1481, 1481, 1486, 1482,
+    1482, 1479, 1481, 1483, 1484, 1487, 1487, 1485,
+    1483, 1485, 1487, 1486, 1486, 1481, 1485, 1487,
+    1484, 1482, 1482, 1486, 1487, 1484, 1477, 1478,
+    1478, 1482, 1484, 1416, 1489, 1488, 1488, 1417,
+    1416, 1417, 1488, 1490, 1490, 1418, 1417, 1418,
+    1490, 1491, 1491, 1419, 1418, 1504, 1493, 1492,
+    1488, 1492, 1494, 1494, 1490, 1488, 1490, 1494,
+    1495, 1495, 1491, 1490, 1493, 1497, 1496, 1496,
+    1492, 1493, 1492, 1496, 1498, 1498, 1494, 1492,
+    1494, 1498, 1499, 1499, 1495, 1494, 1497, 1501,
+    1500, 1500, 1496, 1497, 1496, 1500, 1498, 1502,
+    1498, 1500, 1498, 1502, 1503, 1503, 1499, 1498,
+    1504, 1488, 1489, 1492, 1488, 1504, 1504, 1506,
+    1505, 1505, 1493, 1504, 1493, 1505, 1507, 1507,
+    1497, 1493, 1497, 1507, 1508, 1508, 1501, 1497,
+    1514, 1510, 1509, 1513, 1505, 1506, 1505, 1513,
+    1507, 1511, 1507, 1513, 1507, 1511, 1512, 1512,
+    1508, 1507, 1514, 1513, 1506, 1513, 1509, 1511,
+    1509, 1513, 1514, 1416, 1414, 1515, 1515, 1489,
+    1416, 1489, 1515, 1506, 1506, 1504, 1489, 1414,
+    1432, 1516, 1516, 1515, 1414, 1515, 1516, 1514,
+    1514, 1506, 1515, 1514, 1518, 1517, 1517, 1510,
+    1514, 1432, 1433, 1519, 1519, 1516, 1432, 1516,
+    1519, 1518, 1518, 1514, 1516, 1518, 1521, 1520,
+    1520, 1517, 1518, 1521, 1420, 1413, 1413, 1520,
+    1521, 1519, 1433, 1439, 1420, 1521, 1439, 1519,
+    1439, 1521, 1521, 1518, 1519, 1608, 1523, 1522,
+    1633, 1503, 1502, 1523, 1525, 1524, 1524, 1522,
+    1523, 1525, 1527, 1526, 1526, 1524, 1525, 1527,
+    1529, 1528, 1528, 1526, 1527, 1529, 1530, 1528,
+    1530, 1532, 1531, 1531, 1528, 1530, 1532, 1534,
+    1533, 1533, 1531, 1532, 1534, 1536, 1535, 1535,
+    1533, 1534, 1536, 1538, 1537, 1537, 1535, 1536,
+    1538, 1540, 1539, 1539, 1537, 1538, 1540, 1542,
+    1541, 1541, 1539, 1540, 1542, 1544, 1543, 1543,
+    1541, 1542, 1536, 1546, 1545, 1545, 1538, 1536,
+    1546, 1548, 1547, 1547, 1545, 1546, 1534, 1549,
+    1546, 1546, 1536, 1534, 1549, 1550, 1546, 1550,
+    1551, 1548, 1548, 1546, 1550, 1529, 1553, 1552,
+    1552, 1530, 1529, 1553, 1555, 1554, 1554, 1552,
+    1553, 1553, 1529, 1527, 1555, 1557, 1556, 1556,
+    1554, 1555, 1557, 1551, 1556, 1550, 1556, 1551,
+    1501, 1559, 1558, 1558, 1500, 1501, 1500, 1558,
+    1560, 1560, 1502, 1500, 1508, 1561, 1559, 1559,
+    1501, 1508, 1512, 1562, 1561, 1561, 1508, 1512,
+    1569, 1551, 1557, 1557, 1558, 1559, 1555, 1560,
+    1558, 1561, 1570, 1569, 1562, 1564, 1563, 1563,
+    1561, 1562, 1571, 1566, 1565, 1565, 1547, 1571,
+    1570, 1563, 1566, 1571, 1548, 1551, 1566, 1568,
+    1567, 1567, 1565, 1566, 1563, 1564, 1568, 1568,
+    1566, 1563, 1557, 1555, 1558, 1569, 1557, 1559,
+    1569, 1559, 1561, 1569, 1570, 1551, 1571, 1570,
+    1566, 1551, 1570, 1571, 1548, 1571, 1547, 1570,
+    1561, 1563, 1415, 1432, 1414, 1573, 1575, 1574,
+    1574, 1572, 1573, 1572, 1577, 1576, 1576, 1573,
+    1572, 1577, 1554, 1578, 1578, 1576, 1577, 1575,
+    1579, 1549, 1549, 1574, 1575, 1579, 1581, 1580,
+    1580, 1549, 1579, 1581, 1583, 1582, 1582, 1580,
+    1581, 1583, 1578, 1584, 1584, 1582, 1583, 1554,
+    1584, 1578, 1574, 1534, 1532, 1532, 1572, 1574,
+    1572, 1532, 1530, 1530, 1577, 1572, 1577, 1552,
+    1554, 1534, 1574, 1549, 1580, 1550, 1549, 1550,
+    1580, 1582, 1582, 1556, 1550, 1556, 1582, 1584,
+    1556, 1584, 1554, 1577, 1530, 1552, 1538, 1587,
+    1585, 1585, 1540, 1538, 1585, 1586, 1540, 1542,
+    1540, 1586, 1547, 1588, 1592, 1592, 1545, 1547,
+    1547, 1565, 1589, 1589, 1588, 1547, 1594, 1591,
+    1590, 1593, 1592, 1588, 1588, 1590, 1591, 1538,
+    1545, 1587, 1545, 1592, 1587, 1591, 1593, 1588,
+    1594, 1544, 1542, 1590, 1544, 1594, 1567, 1596,
+    1595, 1595, 1565, 1567, 1596, 1598, 1597, 1597,
+    1595, 1596, 1595, 1589, 1565, 1597, 1588, 1589,
+    1589, 1595, 1597, 1599, 1543, 1544, 1588, 1600,
+    1599, 1599, 1590, 1588, 1599, 1544, 1590, 1598,
+    1602, 1601, 1601, 1597, 1598, 1597, 1601, 1600,
+    1600, 1588, 1597, 1602, 1599, 1600, 1600, 1601,
+    1602, 1525, 1604, 1603, 1603, 1527, 1525, 1527,
+    1603, 1553, 1605, 1553, 1603, 1523, 1606, 1604,
+    1525, 1523, 1604, 1523, 1608, 1606, 1607, 1606,
+    1608, 1609, 1633, 1502, 1633, 1608, 1522, 1609,
+    1610, 1607, 1607, 1608, 1609, 1610, 1612, 1611,
+    1611, 1607, 1610, 1612, 1614, 1613, 1613, 1611,
+    1612, 1614, 1616, 1615, 1615, 1613, 1614, 1610,
+    1560, 1617, 1618, 1612, 1610, 1610, 1617, 1618,
+    1618, 1614, 1612, 1614, 1618, 1619, 1619, 1616,
+    1614, 1616, 1621, 1620, 1620, 1615, 1616, 1621,
+    1616, 1619, 1611, 1623, 1622, 1622, 1607, 1611,
+    1613, 1624, 1623, 1623, 1611, 1613, 1615, 1625,
+    1624, 1624, 1613, 1615, 1618, 1627, 1626, 1626,
+    1619, 1618, 1628, 1620, 1621, 1620, 1628, 1625,
+    1625, 1615, 1620, 1619, 1626, 1628, 1628, 1621,
+    1619, 1560, 1630, 1629, 1629, 1617, 1560, 1617,
+    1629, 1627, 1627, 1618, 1617, 1630, 1632, 1629,
+    1631, 1629, 1632, 1629, 1631, 1627, 1626, 1627,
+    1631, 1632, 1624, 1625, 1625, 1631, 1632, 1631,
+    1625, 1628, 1628, 1626, 1631, 1623, 1632, 1630,
+    1623, 1624, 1632, 1560, 1555, 1630, 1623, 1630,
+    1555, 1555, 1622, 1623, 1609, 1502, 1560, 1560,
+    1610, 1609, 1609, 1608, 1633, 1553, 1605, 1555,
+    1622, 1555, 1605, 1634, 1585, 1587, 1634, 1586,
+    1585, 1634, 1542, 1586, 1634, 1591, 1594, 1634,
+    1592, 1593, 1634, 1587, 1592, 1634, 1593, 1591,
+    1634, 1594, 1542, 1635, 1575, 1573, 1635, 1573,
+    1576, 1635, 1576, 1578, 1635, 1579, 1575, 1635,
+    1581, 1579, 1635, 1583, 1581, 1635, 1578, 1583,
+    1326, 1637, 1636, 1636, 1328, 1326, 1637, 1326,
+    1324, 1328, 1639, 1638, 1638, 1392, 1328, 1636,
+    1640, 1328, 1639, 1328, 1640, 1639, 1642, 1641,
+    1641, 1638, 1639, 1640, 1643, 1642, 1642, 1639,
+    1640, 1642, 1645, 1644, 1644, 1641, 1642, 1643,
+    1646, 1645, 1645, 1642, 1643, 1645, 1648, 1647,
+    1647, 1644, 1645, 1646, 1649, 1648, 1648, 1645,
+    1646, 1648, 1651, 1650, 1650, 1647, 1648, 1649,
+    1652, 1651, 1651, 1648, 1649, 1651, 1654, 1653,
+    1653, 1650, 1651, 1655, 1654, 1651, 1651, 1652,
+    1655, 1604, 1656, 1657, 1657, 1603, 1604, 1657,
+    1658, 1660, 1660, 1659, 1657, 1658, 1662, 1661,
+    1661, 1660, 1658, 1662, 1663, 1664, 1661, 1662,
+    1664, 1657, 1659, 1605, 1605, 1603, 1657, 1605,
+    1659, 1665, 1665, 1622, 1605, 1659, 1660, 1666,
+    1666, 1665, 1659, 1667, 1666, 1660, 1667, 1660,
+    1661, 1668, 1667, 1661, 1666, 1672, 1670, 1670,
+    1665, 1666, 1665, 1670, 1607, 1607, 1622, 1665,
+    1667, 1668, 1671, 1671, 1669, 1667, 1664, 1671,
+    1668, 1673, 1670, 1672, 1672, 1674, 1673, 1674,
+    1672, 1669, 1669, 1675, 1674, 1673, 1606, 1607,
+    1607, 1670, 1673, 1676, 1675, 1669, 1669, 1671,
+    1676, 1663, 1662, 1658, 1658, 1677, 1663, 1673,
+    1674, 1677, 1677, 1656, 1673, 1604, 1606, 1673,
+    1673, 1656, 1604, 1675, 1676, 1663, 1664, 1663,
+    1676, 1664, 1676, 1671, 1664, 1668, 1661, 1656,
+    1677, 1658, 1658, 1657, 1656, 1669, 1672, 1666,
+    1666, 1667, 1669, 1677, 1674, 1675, 1675, 1663,
+    1677, 1683, 1387, 1391, 1391, 1684, 1683, 1685,
+    1683, 1684, 1684, 1686, 1685, 1687, 1685, 1686,
+    1686, 1688, 1687, 1689, 1687, 1688, 1688, 1690,
+    1689, 1683, 1386, 1387, 1683, 1691, 1386, 1691,
+    1683, 1685, 1691, 1678, 1386, 1685, 1687, 1691,
+    1678, 1681, 1680, 1681, 1691, 1687, 1687, 1689,
+    1681, 1681, 1678, 1691, 1692, 1338, 1679, 1679,
+    1680, 1692, 1693, 1692, 1680, 1680, 1682, 1693,
+    1704, 1706, 1705, 1704, 1705, 1700, 1700, 1705,
+    1695, 1700, 1695, 1694, 1682, 1707, 1703, 1693,
+    1682, 1703, 1703, 1707, 1706, 1706, 1704, 1703,
+    1394, 1338, 1692, 1394, 1692, 1339, 1693, 1339,
+    1692, 1694, 1340, 1396, 1694, 1701, 1700, 1694,
+    1396, 1701, 1696, 1689, 1690, 1690, 1697, 1696,
+    1689, 1696, 1681, 1682, 1681, 1708, 1338, 1698,
+    1679, 1698, 1699, 1679, 1699, 1386, 1678, 1678,
+    1679, 1699, 1680, 1681, 1682, 1680, 1679, 1678,
+    1702, 1701, 1396, 1702, 1396, 1339, 1702, 1339,
+    1693, 1702, 1693, 1703, 1708, 1707, 1682, 1708,
+    1681, 1696, 1708, 1696, 1709, 1709, 1696, 1697,
+    1709, 1697, 1695, 1709, 1695, 1705, 1716, 1715,
+    1710, 1710, 1711, 1716, 1717, 1716, 1711, 1711,
+    1712, 1717, 1718, 1717, 1712, 1712, 1713, 1718,
+    1719, 1718, 1713, 1713, 1714, 1719, 1715, 1719,
+    1714, 1714, 1710, 1715, 1705, 1706, 1715, 1715,
+    1716, 1705, 1709, 1705, 1716, 1716, 1717, 1709,
+    1708, 1709, 1717, 1717, 1718, 1708, 1707, 1708,
+    1718, 1718, 1719, 1707, 1706, 1707, 1719, 1719,
+    1715, 1706, 1720, 1711, 1710, 1720, 1712, 1711,
+    1720, 1713, 1712, 1720, 1714, 1713, 1720, 1710,
+    1714, 1727, 1726, 1721, 1721, 1722, 1727, 1728,
+    1727, 1722, 1722, 1723, 1728, 1729, 1728, 1723,
+    1723, 1724, 1729, 1730, 1729, 1724, 1724, 1725,
+    1730, 1726, 1730, 1725, 1725, 1721, 1726, 1703,
+    1704, 1726, 1726, 1727, 1703, 1702, 1703, 1727,
+    1727, 1728, 1702, 1701, 1702, 1728, 1728, 1729,
+    1701, 1700, 1701, 1729, 1729, 1730, 1700, 1704,
+    1700, 1730, 1730, 1726, 1704, 1731, 1722, 1721,
+    1731, 1723, 1722, 1731, 1724, 1723, 1731, 1725,
+    1724, 1731, 1721, 1725
+};
+alignas(16) constexpr uint32_t cowStIndex[9468] = {
+    0, 1, 2, 3, 2, 1, 4, 0,
+    5, 2, 5, 0, 6, 4, 7, 5,
+    7, 4, 8, 9, 6, 6, 7, 8,
+    10, 11, 12, 12, 13, 10, 14, 15,
+    3, 3, 1, 14, 16, 17, 18, 15,
+    14, 19, 20, 21, 2, 2, 3, 20,
+    21, 22, 5, 5, 2, 21, 22, 23,
+    7, 7, 5, 22, 23, 24, 8, 8,
+    7, 23, 25, 20, 3, 3, 15, 25,
+    26, 25, 15, 18, 17, 27, 28, 29,
+    30, 31, 30, 29, 29, 28, 32, 33,
+    34, 35, 36, 37, 38, 38, 39, 36,
+    37, 40, 41, 41, 38, 37, 28, 30,
+    42, 43, 44, 23, 24, 23, 44, 43,
+    36, 44, 39, 44, 36, 32, 35, 45,
+    35, 32, 33, 45, 29, 32, 29, 45,
+    31, 22, 46, 23, 43, 23, 46, 21,
+    47, 46, 46, 22, 21, 20, 48, 47,
+    47, 21, 20, 25, 49, 48, 48, 20,
+    25, 26, 50, 51, 49, 25, 51, 52,
+    53, 54, 55, 27, 54, 56, 57, 34,
+    34, 33, 56, 58, 59, 41, 41, 40,
+    58, 60, 61, 37, 37, 36, 60, 61,
+    62, 40, 40, 37, 61, 46, 60, 36,
+    36, 43, 46, 62, 63, 58, 58, 40,
+    62, 64, 65, 61, 61, 60, 64, 65,
+    66, 62, 62, 61, 65, 47, 64, 60,
+    60, 46, 47, 66, 67, 63, 63, 62,
+    66, 17, 52, 27, 15, 68, 26, 16,
+    18, 69, 19, 68, 15, 64, 70, 65,
+    70, 64, 71, 70, 72, 66, 66, 65,
+    70, 73, 74, 75, 67, 66, 72, 48,
+    71, 64, 64, 47, 48, 71, 76, 70,
+    76, 71, 77, 70, 78, 72, 78, 70,
+    76, 78, 79, 80, 49, 77, 71, 71,
+    48, 49, 81, 82, 83, 83, 84, 85,
+    86, 87, 88, 87, 89, 88, 79, 78,
+    88, 82, 81, 90, 91, 92, 93, 87,
+    86, 94, 95, 87, 93, 96, 97, 91,
+    98, 99, 100, 97, 101, 92, 92, 91,
+    97, 101, 102, 103, 103, 92, 101, 104,
+    90, 99, 87, 94, 93, 93, 94, 91,
+    95, 93, 105, 105, 93, 92, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 113,
+    115, 114, 116, 117, 118, 104, 82, 90,
+    98, 104, 99, 74, 73, 119, 74, 120,
+    121, 122, 121, 120, 120, 123, 122, 123,
+    116, 118, 87, 95, 89, 118, 122, 123,
+    124, 84, 83, 78, 76, 125, 126, 127,
+    128, 128, 75, 126, 126, 75, 74, 129,
+    130, 131, 132, 133, 131, 131, 130, 132,
+    128, 134, 133, 133, 132, 128, 127, 135,
+    134, 134, 128, 127, 57, 136, 34, 137,
+    138, 139, 124, 140, 84, 52, 54, 27,
+    115, 141, 142, 142, 143, 115, 141, 144,
+    145, 145, 142, 141, 141, 115, 113, 113,
+    146, 144, 144, 141, 113, 147, 99, 90,
+    146, 113, 112, 148, 149, 150, 151, 152,
+    153, 99, 154, 100, 88, 89, 79, 86,
+    88, 125, 83, 85, 81, 78, 125, 88,
+    121, 155, 74, 126, 74, 155, 156, 157,
+    143, 143, 142, 156, 158, 156, 142, 142,
+    145, 158, 156, 159, 160, 160, 157, 156,
+    158, 161, 159, 159, 156, 158, 84, 140,
+    162, 163, 164, 0, 1, 0, 164, 165,
+    163, 0, 0, 4, 165, 166, 165, 4,
+    4, 6, 166, 167, 166, 6, 6, 9,
+    167, 168, 169, 12, 12, 11, 168, 170,
+    171, 14, 14, 1, 170, 171, 172, 19,
+    19, 14, 171, 173, 174, 16, 16, 69,
+    173, 175, 176, 177, 163, 165, 178, 179,
+    178, 165, 165, 166, 179, 180, 179, 166,
+    166, 167, 180, 181, 182, 169, 169, 168,
+    181, 174, 173, 183, 184, 185, 177, 178,
+    175, 185, 177, 185, 175, 164, 163, 184,
+    178, 185, 163, 184, 163, 185, 164, 170,
+    1, 170, 164, 184, 186, 187, 177, 184,
+    177, 187, 188, 189, 186, 187, 186, 189,
+    176, 190, 186, 186, 177, 176, 190, 191,
+    188, 188, 186, 190, 184, 187, 170, 192,
+    170, 187, 187, 189, 192, 193, 194, 195,
+    195, 196, 197, 197, 193, 195, 198, 174,
+    183, 183, 173, 199, 192, 171, 170, 199,
+    200, 183, 201, 202, 203, 204, 205, 189,
+    189, 188, 204, 206, 204, 188, 188, 191,
+    206, 207, 208, 197, 197, 196, 207, 205,
+    209, 192, 192, 189, 205, 208, 207, 210,
+    211, 212, 213, 213, 214, 211, 215, 216,
+    201, 201, 203, 215, 217, 218, 205, 205,
+    204, 217, 219, 220, 221, 204, 206, 222,
+    218, 223, 209, 209, 205, 218, 224, 219,
+    208, 208, 210, 224, 225, 226, 212, 212,
+    211, 225, 227, 228, 216, 216, 215, 227,
+    229, 230, 218, 218, 217, 229, 231, 232,
+    220, 220, 219, 231, 230, 233, 223, 223,
+    218, 230, 234, 231, 219, 219, 224, 234,
+    235, 236, 226, 226, 225, 235, 237, 238,
+    228, 228, 227, 237, 239, 240, 230, 230,
+    229, 239, 241, 242, 232, 232, 231, 241,
+    240, 243, 233, 233, 230, 240, 244, 241,
+    231, 231, 234, 244, 245, 246, 242, 242,
+    241, 245, 246, 245, 247, 248, 249, 247,
+    250, 251, 240, 240, 239, 250, 252, 253,
+    254, 243, 240, 255, 251, 250, 256, 252,
+    257, 253, 258, 259, 251, 251, 256, 258,
+    244, 260, 245, 245, 241, 244, 247, 245,
+    260, 260, 261, 248, 248, 247, 260, 236,
+    235, 262, 262, 263, 236, 263, 262, 264,
+    265, 266, 267, 257, 268, 253, 259, 269,
+    270, 270, 251, 259, 271, 272, 263, 263,
+    264, 271, 273, 274, 268, 268, 257, 273,
+    275, 276, 277, 277, 278, 275, 279, 280,
+    276, 276, 275, 279, 31, 10, 13, 13,
+    30, 31, 108, 117, 281, 116, 281, 117,
+    103, 105, 92, 117, 108, 107, 282, 283,
+    284, 97, 96, 285, 286, 285, 287, 288,
+    289, 290, 286, 291, 101, 101, 97, 286,
+    292, 293, 294, 102, 101, 295, 291, 286,
+    287, 292, 296, 293, 297, 298, 291, 291,
+    287, 297, 154, 299, 300, 300, 100, 154,
+    290, 300, 299, 299, 301, 288, 288, 290,
+    299, 152, 151, 302, 302, 303, 152, 303,
+    302, 304, 305, 306, 307, 296, 308, 293,
+    298, 309, 310, 310, 291, 298, 311, 312,
+    303, 303, 304, 311, 313, 314, 308, 308,
+    296, 313, 315, 316, 317, 317, 318, 315,
+    319, 320, 316, 316, 315, 319, 321, 322,
+    178, 178, 179, 321, 323, 321, 179, 179,
+    180, 323, 324, 325, 182, 182, 181, 324,
+    326, 327, 328, 329, 326, 321, 321, 323,
+    329, 330, 329, 323, 325, 324, 331, 332,
+    333, 327, 327, 326, 332, 334, 332, 326,
+    326, 329, 334, 335, 336, 337, 329, 330,
+    338, 339, 340, 333, 333, 332, 339, 334,
+    339, 332, 339, 334, 341, 342, 343, 336,
+    336, 335, 342, 344, 345, 346, 328, 321,
+    326, 347, 348, 328, 328, 327, 347, 349,
+    347, 327, 327, 333, 349, 350, 349, 333,
+    333, 340, 350, 351, 352, 353, 348, 347,
+    354, 349, 354, 347, 355, 356, 357, 358,
+    357, 356, 359, 360, 361, 348, 354, 362,
+    357, 351, 355, 353, 355, 351, 363, 175,
+    178, 178, 322, 363, 348, 363, 322, 344,
+    346, 364, 365, 366, 175, 175, 363, 365,
+    362, 365, 363, 363, 348, 362, 367, 368,
+    353, 353, 352, 367, 369, 370, 366, 366,
+    365, 369, 371, 369, 365, 365, 362, 371,
+    372, 373, 374, 374, 375, 372, 174, 198,
+    373, 373, 372, 174, 376, 377, 378, 376,
+    379, 380, 379, 376, 378, 369, 371, 381,
+    382, 383, 384, 343, 342, 385, 386, 387,
+    383, 383, 382, 386, 388, 389, 387, 387,
+    386, 388, 390, 391, 389, 389, 388, 390,
+    390, 392, 391, 393, 394, 392, 392, 390,
+    393, 395, 396, 394, 394, 393, 395, 397,
+    398, 396, 396, 395, 397, 399, 400, 398,
+    398, 397, 399, 401, 402, 400, 400, 399,
+    401, 403, 404, 405, 405, 406, 403, 407,
+    408, 404, 404, 403, 407, 409, 410, 411,
+    411, 412, 409, 413, 414, 410, 410, 409,
+    413, 415, 416, 417, 418, 411, 410, 410,
+    419, 420, 414, 421, 419, 419, 410, 414,
+    422, 423, 391, 391, 392, 422, 424, 425,
+    426, 426, 427, 424, 389, 391, 423, 428,
+    429, 425, 425, 424, 428, 428, 421, 429,
+    421, 428, 419, 430, 431, 340, 340, 339,
+    430, 432, 430, 339, 339, 341, 432, 431,
+    433, 350, 350, 340, 431, 434, 435, 361,
+    361, 360, 434, 429, 421, 436, 431, 430,
+    429, 430, 432, 425, 436, 437, 433, 438,
+    439, 435, 435, 434, 438, 440, 441, 442,
+    442, 413, 440, 441, 443, 437, 421, 414,
+    442, 444, 445, 446, 446, 447, 444, 445,
+    439, 438, 438, 446, 445, 430, 425, 429,
+    431, 429, 436, 433, 431, 436, 421, 437,
+    436, 441, 437, 442, 442, 437, 421, 413,
+    442, 414, 443, 433, 437, 448, 195, 194,
+    449, 450, 451, 451, 452, 449, 453, 454,
+    452, 452, 451, 453, 455, 424, 454, 454,
+    453, 455, 420, 456, 450, 450, 449, 420,
+    457, 458, 456, 456, 420, 457, 459, 460,
+    458, 458, 457, 459, 461, 455, 460, 460,
+    459, 461, 455, 461, 424, 394, 396, 462,
+    462, 463, 394, 392, 394, 463, 463, 464,
+    392, 424, 427, 454, 416, 465, 417, 420,
+    419, 457, 459, 457, 419, 419, 428, 459,
+    461, 459, 428, 424, 461, 428, 422, 392,
+    464, 466, 467, 400, 400, 402, 466, 468,
+    469, 470, 471, 405, 404, 472, 473, 413,
+    413, 409, 472, 474, 440, 413, 413, 473,
+    474, 475, 476, 477, 473, 472, 478, 479,
+    480, 473, 481, 409, 412, 481, 472, 409,
+    473, 478, 479, 404, 408, 477, 477, 408,
+    475, 482, 483, 444, 444, 447, 482, 484,
+    485, 483, 483, 482, 484, 447, 486, 482,
+    474, 473, 487, 487, 488, 474, 489, 490,
+    491, 492, 493, 494, 495, 496, 491, 496,
+    489, 491, 497, 498, 499, 499, 500, 497,
+    501, 497, 500, 502, 494, 493, 493, 492,
+    503, 503, 504, 493, 505, 506, 387, 387,
+    389, 505, 507, 508, 509, 510, 426, 511,
+    512, 513, 514, 506, 383, 387, 513, 515,
+    514, 515, 513, 516, 343, 385, 517, 382,
+    384, 385, 518, 519, 517, 517, 384, 518,
+    520, 521, 522, 523, 524, 525, 526, 527,
+    521, 521, 520, 526, 528, 529, 527, 527,
+    526, 528, 530, 531, 532, 532, 533, 534,
+    534, 530, 532, 533, 535, 534, 536, 534,
+    535, 535, 537, 536, 538, 539, 537, 529,
+    528, 540, 536, 537, 539, 541, 542, 520,
+    520, 543, 541, 542, 544, 526, 526, 520,
+    542, 544, 545, 528, 528, 526, 544, 546,
+    547, 548, 548, 549, 546, 550, 551, 552,
+    553, 552, 551, 540, 528, 545, 552, 546,
+    549, 549, 550, 552, 554, 555, 556, 556,
+    557, 554, 547, 554, 557, 557, 548, 547,
+    554, 558, 555, 558, 554, 559, 547, 559,
+    554, 559, 547, 546, 553, 560, 558, 558,
+    559, 553, 552, 553, 559, 559, 546, 552,
+    555, 558, 561, 558, 560, 561, 562, 563,
+    564, 565, 555, 561, 561, 566, 565, 432,
+    341, 567, 568, 532, 531, 385, 384, 517,
+    425, 511, 426, 511, 425, 569, 481, 470,
+    570, 470, 469, 570, 471, 404, 571, 572,
+    479, 570, 478, 472, 570, 472, 481, 570,
+    479, 478, 570, 573, 572, 570, 451, 450,
+    574, 453, 451, 574, 455, 453, 574, 450,
+    456, 574, 456, 458, 574, 458, 460, 574,
+    460, 455, 574, 575, 576, 577, 35, 34,
+    578, 579, 577, 576, 580, 581, 582, 582,
+    583, 580, 584, 585, 586, 585, 584, 587,
+    588, 589, 581, 581, 580, 588, 590, 591,
+    585, 585, 587, 590, 592, 593, 589, 589,
+    588, 592, 594, 595, 591, 591, 590, 594,
+    596, 597, 593, 593, 592, 596, 598, 599,
+    595, 595, 594, 598, 600, 601, 597, 597,
+    596, 600, 602, 603, 599, 599, 598, 602,
+    604, 605, 602, 601, 600, 606, 602, 605,
+    607, 607, 603, 602, 608, 609, 506, 506,
+    505, 608, 610, 611, 612, 612, 613, 610,
+    614, 615, 611, 611, 610, 614, 616, 617,
+    618, 619, 615, 614, 620, 621, 622, 622,
+    623, 620, 624, 625, 626, 626, 627, 624,
+    628, 629, 625, 625, 624, 628, 629, 628,
+    630, 631, 629, 630, 631, 630, 632, 633,
+    634, 628, 628, 624, 633, 635, 633, 624,
+    624, 627, 635, 636, 632, 630, 630, 637,
+    636, 632, 636, 638, 639, 640, 641, 641,
+    642, 639, 643, 639, 642, 642, 644, 643,
+    516, 513, 645, 645, 646, 516, 643, 644,
+    647, 647, 648, 643, 649, 618, 617, 617,
+    650, 649, 650, 651, 652, 652, 609, 650,
+    645, 513, 512, 506, 609, 652, 617, 653,
+    654, 653, 617, 616, 648, 647, 655, 631,
+    632, 638, 649, 650, 609, 609, 608, 649,
+    628, 634, 637, 637, 630, 628, 654, 651,
+    650, 650, 617, 654, 135, 127, 656, 656,
+    657, 135, 657, 656, 658, 658, 659, 657,
+    659, 658, 660, 660, 661, 659, 661, 660,
+    662, 662, 663, 661, 127, 126, 656, 126,
+    664, 656, 658, 656, 664, 665, 666, 667,
+    664, 660, 658, 668, 669, 666, 660, 664,
+    670, 670, 662, 660, 667, 666, 669, 671,
+    672, 673, 673, 668, 671, 674, 675, 676,
+    676, 677, 674, 678, 679, 680, 681, 678,
+    680, 682, 678, 681, 683, 682, 681, 684,
+    685, 686, 684, 686, 687, 679, 685, 684,
+    684, 680, 679, 675, 49, 51, 50, 675,
+    51, 675, 50, 676, 54, 53, 683, 681,
+    688, 683, 688, 54, 683, 689, 690, 691,
+    691, 692, 689, 693, 691, 690, 694, 693,
+    686, 671, 695, 672, 671, 696, 695, 666,
+    665, 696, 696, 671, 666, 697, 669, 668,
+    666, 671, 668, 54, 688, 698, 55, 54,
+    698, 687, 55, 698, 684, 687, 698, 686,
+    685, 694, 691, 693, 694, 699, 691, 694,
+    692, 691, 699, 682, 692, 699, 678, 682,
+    699, 700, 701, 702, 702, 703, 700, 704,
+    705, 706, 706, 707, 704, 708, 709, 710,
+    710, 711, 708, 712, 713, 714, 714, 715,
+    712, 716, 717, 701, 701, 700, 716, 718,
+    679, 678, 678, 719, 718, 719, 678, 699,
+    699, 720, 719, 720, 699, 694, 694, 721,
+    720, 721, 694, 685, 685, 722, 721, 722,
+    685, 679, 679, 718, 722, 723, 724, 725,
+    704, 707, 726, 708, 711, 727, 712, 715,
+    728, 729, 723, 725, 730, 731, 732, 732,
+    733, 730, 733, 732, 734, 734, 735, 733,
+    736, 737, 738, 738, 739, 736, 740, 741,
+    742, 742, 743, 740, 743, 742, 744, 745,
+    746, 747, 748, 680, 684, 684, 749, 748,
+    732, 750, 751, 751, 734, 732, 752, 753,
+    754, 688, 755, 756, 755, 688, 681, 681,
+    757, 755, 757, 681, 680, 680, 748, 757,
+    730, 733, 758, 733, 735, 758, 736, 739,
+    759, 760, 761, 762, 761, 763, 762, 764,
+    765, 766, 765, 764, 767, 768, 766, 769,
+    766, 768, 764, 770, 769, 771, 769, 770,
+    768, 771, 772, 773, 773, 770, 771, 774,
+    775, 776, 776, 777, 774, 767, 778, 779,
+    779, 765, 767, 780, 781, 782, 783, 779,
+    778, 764, 784, 785, 785, 767, 764, 768,
+    786, 784, 784, 764, 768, 770, 787, 786,
+    786, 768, 770, 773, 788, 787, 787, 770,
+    773, 767, 785, 789, 789, 778, 767, 778,
+    789, 790, 791, 781, 780, 792, 793, 794,
+    793, 792, 795, 796, 794, 793, 797, 798,
+    799, 800, 801, 802, 802, 803, 800, 804,
+    805, 801, 801, 800, 804, 806, 792, 794,
+    787, 807, 808, 807, 787, 788, 807, 802,
+    808, 802, 807, 803, 809, 797, 796, 799,
+    796, 797, 796, 793, 809, 795, 809, 793,
+    787, 810, 786, 810, 787, 808, 810, 811,
+    784, 784, 786, 810, 811, 812, 785, 785,
+    784, 811, 812, 813, 789, 789, 785, 812,
+    814, 815, 790, 814, 789, 813, 816, 817,
+    818, 816, 791, 819, 820, 821, 822, 823,
+    799, 798, 804, 824, 825, 825, 805, 804,
+    801, 826, 827, 827, 802, 801, 805, 828,
+    826, 826, 801, 805, 802, 827, 810, 810,
+    808, 802, 825, 829, 828, 828, 805, 825,
+    826, 830, 831, 831, 827, 826, 828, 832,
+    830, 830, 826, 828, 827, 831, 811, 811,
+    810, 827, 829, 833, 832, 832, 828, 829,
+    791, 818, 781, 790, 834, 778, 835, 780,
+    782, 778, 834, 783, 830, 836, 831, 837,
+    831, 836, 832, 838, 836, 836, 830, 832,
+    839, 840, 841, 838, 832, 833, 831, 837,
+    812, 812, 811, 831, 836, 842, 837, 843,
+    837, 842, 838, 844, 836, 842, 836, 844,
+    845, 846, 844, 837, 843, 813, 813, 812,
+    837, 847, 848, 849, 850, 851, 847, 852,
+    853, 854, 852, 855, 853, 852, 844, 846,
+    856, 849, 848, 857, 858, 859, 860, 854,
+    853, 857, 853, 861, 859, 862, 863, 864,
+    865, 866, 858, 867, 862, 862, 859, 858,
+    868, 869, 867, 867, 858, 868, 865, 856,
+    870, 857, 860, 853, 859, 860, 857, 871,
+    857, 861, 858, 857, 871, 872, 873, 874,
+    875, 876, 877, 878, 879, 880, 878, 881,
+    879, 882, 883, 884, 856, 848, 870, 865,
+    870, 866, 885, 841, 840, 886, 887, 840,
+    887, 886, 888, 888, 889, 887, 882, 884,
+    889, 855, 861, 853, 889, 888, 882, 847,
+    851, 890, 891, 842, 844, 892, 893, 894,
+    894, 839, 892, 840, 839, 894, 895, 822,
+    821, 895, 896, 897, 897, 822, 895, 896,
+    898, 892, 892, 897, 896, 898, 899, 893,
+    893, 892, 898, 820, 900, 821, 901, 902,
+    903, 851, 904, 890, 791, 816, 818, 905,
+    906, 881, 881, 907, 905, 908, 909, 906,
+    906, 905, 908, 879, 881, 906, 909, 910,
+    879, 879, 906, 909, 856, 865, 911, 880,
+    879, 910, 912, 913, 914, 915, 916, 917,
+    864, 918, 865, 846, 855, 852, 891, 852,
+    854, 849, 850, 847, 852, 891, 844, 840,
+    919, 886, 919, 840, 894, 907, 920, 921,
+    921, 905, 907, 905, 921, 922, 922, 908,
+    905, 923, 924, 921, 921, 920, 923, 924,
+    925, 922, 922, 921, 924, 926, 904, 851,
+    766, 927, 928, 927, 766, 765, 766, 928,
+    929, 929, 769, 766, 769, 929, 930, 930,
+    771, 769, 771, 930, 931, 931, 772, 771,
+    774, 932, 933, 933, 775, 774, 779, 934,
+    935, 935, 765, 779, 783, 936, 934, 934,
+    779, 783, 782, 937, 938, 938, 835, 782,
+    939, 940, 941, 942, 929, 928, 929, 942,
+    943, 943, 930, 929, 930, 943, 944, 944,
+    931, 930, 932, 945, 946, 946, 933, 932,
+    947, 938, 937, 939, 948, 949, 948, 941,
+    942, 941, 948, 939, 949, 928, 927, 928,
+    948, 942, 948, 928, 949, 765, 935, 927,
+    949, 927, 935, 939, 950, 951, 950, 939,
+    949, 951, 952, 953, 952, 951, 950, 951,
+    954, 940, 940, 939, 951, 953, 955, 954,
+    954, 951, 953, 935, 950, 949, 950, 935,
+    956, 956, 952, 950, 957, 958, 959, 960,
+    961, 957, 957, 959, 960, 947, 937, 962,
+    963, 938, 947, 935, 934, 956, 947, 964,
+    963, 965, 966, 967, 952, 968, 969, 969,
+    953, 952, 953, 969, 970, 970, 955, 953,
+    960, 971, 972, 972, 961, 960, 956, 973,
+    968, 968, 952, 956, 974, 972, 971, 975,
+    976, 977, 977, 978, 975, 967, 979, 980,
+    980, 965, 967, 968, 981, 982, 982, 969,
+    968, 983, 984, 985, 986, 970, 969, 973,
+    987, 981, 981, 968, 973, 971, 985, 988,
+    988, 974, 971, 976, 989, 990, 990, 977,
+    976, 979, 991, 992, 992, 980, 979, 981,
+    993, 994, 994, 982, 981, 984, 995, 996,
+    996, 985, 984, 987, 997, 993, 993, 981,
+    987, 985, 996, 998, 998, 988, 985, 989,
+    999, 1000, 1000, 990, 989, 991, 1001, 1002,
+    1002, 992, 991, 993, 1003, 1004, 1004, 994,
+    993, 995, 1005, 1006, 1006, 996, 995, 997,
+    1007, 1003, 1003, 993, 997, 996, 1006, 1008,
+    1008, 998, 996, 1005, 1009, 1010, 1010, 1006,
+    1005, 1011, 1010, 1009, 1011, 1012, 1013, 1003,
+    1014, 1015, 1015, 1004, 1003, 1016, 1017, 1018,
+    1019, 1003, 1007, 1020, 1015, 1014, 1017, 1021,
+    1018, 1014, 1022, 1023, 1023, 1020, 1014, 1010,
+    1024, 1008, 1008, 1006, 1010, 1024, 1010, 1011,
+    1013, 1025, 1024, 1024, 1011, 1013, 1026, 1000,
+    999, 999, 1027, 1026, 1028, 1026, 1027, 1029,
+    1030, 1031, 1017, 1032, 1021, 1033, 1034, 1022,
+    1022, 1014, 1033, 1027, 1035, 1036, 1036, 1028,
+    1027, 1032, 1037, 1038, 1038, 1021, 1032, 1039,
+    1040, 1041, 1041, 1042, 1039, 1040, 1043, 1044,
+    1044, 1041, 1040, 777, 776, 795, 795, 792,
+    777, 1045, 883, 872, 883, 1045, 884, 858,
+    871, 868, 873, 872, 883, 1046, 1047, 1048,
+    1049, 863, 862, 1050, 1049, 1051, 1052, 1053,
+    1054, 867, 1055, 1051, 1051, 862, 867, 1056,
+    1057, 1058, 1059, 867, 869, 1050, 1051, 1055,
+    1057, 1060, 1058, 1055, 1061, 1062, 1062, 1050,
+    1055, 1063, 1064, 918, 918, 864, 1063, 1064,
+    1063, 1052, 1054, 1065, 1064, 1064, 1052, 1054,
+    1066, 917, 916, 916, 1067, 1066, 1068, 1066,
+    1067, 1069, 1070, 1071, 1057, 1072, 1060, 1073,
+    1074, 1061, 1061, 1055, 1073, 1067, 1075, 1076,
+    1076, 1068, 1067, 1072, 1077, 1078, 1078, 1060,
+    1072, 1079, 1080, 1081, 1081, 1082, 1079, 1080,
+    1083, 1084, 1084, 1081, 1080, 942, 1085, 1086,
+    1086, 943, 942, 943, 1086, 1087, 1087, 944,
+    943, 945, 1088, 1089, 1089, 946, 945, 1090,
+    1091, 1092, 1086, 1092, 1093, 1093, 1087, 1086,
+    1087, 1093, 1094, 1095, 1089, 1088, 1091, 1096,
+    1097, 1097, 1092, 1091, 1092, 1097, 1098, 1098,
+    1093, 1092, 1099, 1100, 1101, 1102, 1094, 1093,
+    1096, 1103, 1104, 1104, 1097, 1096, 1097, 1104,
+    1098, 1105, 1098, 1104, 1100, 1106, 1107, 1107,
+    1101, 1100, 1108, 1109, 1110, 1092, 1086, 1090,
+    1090, 1111, 1112, 1112, 1091, 1090, 1091, 1112,
+    1113, 1113, 1096, 1091, 1096, 1113, 1114, 1114,
+    1103, 1096, 1115, 1116, 1117, 1118, 1112, 1111,
+    1112, 1118, 1113, 1119, 1120, 1121, 1120, 1119,
+    1122, 1123, 1124, 1125, 1126, 1118, 1111, 1121,
+    1117, 1119, 1117, 1121, 1115, 942, 941, 1127,
+    1127, 1085, 942, 1085, 1127, 1111, 1128, 1108,
+    1110, 941, 1129, 1130, 1130, 1127, 941, 1127,
+    1130, 1126, 1126, 1111, 1127, 1115, 1131, 1132,
+    1132, 1116, 1115, 1129, 1133, 1134, 1134, 1130,
+    1129, 1130, 1134, 1135, 1135, 1126, 1130, 1136,
+    1137, 1138, 1138, 1139, 1136, 1137, 962, 937,
+    937, 1138, 1137, 1140, 1141, 1142, 1143, 1144,
+    1142, 1140, 1142, 1144, 1145, 1135, 1134, 1146,
+    1147, 1148, 1149, 1107, 1106, 1147, 1150, 1151,
+    1151, 1148, 1147, 1150, 1152, 1153, 1153, 1151,
+    1150, 1152, 1154, 1155, 1155, 1153, 1152, 1154,
+    1156, 1155, 1156, 1157, 1158, 1158, 1155, 1156,
+    1157, 1159, 1160, 1160, 1158, 1157, 1159, 1161,
+    1162, 1162, 1160, 1159, 1161, 1163, 1164, 1164,
+    1162, 1161, 1163, 1165, 1166, 1166, 1164, 1163,
+    1167, 1168, 1169, 1169, 1170, 1167, 1168, 1171,
+    1172, 1172, 1169, 1168, 1173, 1174, 1175, 1175,
+    1176, 1173, 1174, 1177, 1178, 1178, 1175, 1174,
+    1179, 1180, 1181, 1174, 1173, 1182, 1183, 1184,
+    1174, 1184, 1185, 1177, 1177, 1174, 1184, 1154,
+    1186, 1187, 1187, 1156, 1154, 1188, 1189, 1190,
+    1190, 1191, 1188, 1186, 1154, 1152, 1189, 1192,
+    1193, 1193, 1190, 1189, 1192, 1185, 1193, 1184,
+    1193, 1185, 1103, 1194, 1195, 1195, 1104, 1103,
+    1104, 1195, 1196, 1196, 1105, 1104, 1114, 1197,
+    1194, 1194, 1103, 1114, 1123, 1198, 1199, 1199,
+    1124, 1123, 1200, 1185, 1192, 1192, 1195, 1194,
+    1189, 1196, 1195, 1197, 1201, 1200, 1198, 1202,
+    1203, 1203, 1199, 1198, 1204, 1205, 1206, 1206,
+    1178, 1204, 1201, 1207, 1205, 1204, 1177, 1185,
+    1208, 1209, 1210, 1210, 1211, 1208, 1203, 1202,
+    1209, 1209, 1208, 1203, 1192, 1189, 1195, 1200,
+    1192, 1194, 1200, 1194, 1197, 1200, 1201, 1185,
+    1204, 1201, 1205, 1185, 1201, 1204, 1177, 1204,
+    1178, 1201, 1197, 1207, 958, 957, 1212, 1213,
+    1214, 1215, 1215, 1216, 1213, 1216, 1217, 1218,
+    1218, 1213, 1216, 1217, 1190, 1219, 1219, 1218,
+    1217, 1214, 1220, 1183, 1183, 1215, 1214, 1220,
+    1221, 1222, 1222, 1183, 1220, 1221, 1223, 1224,
+    1224, 1222, 1221, 1223, 1219, 1225, 1225, 1224,
+    1223, 1190, 1225, 1219, 1226, 1159, 1157, 1157,
+    1227, 1226, 1227, 1157, 1156, 1156, 1228, 1227,
+    1217, 1191, 1190, 1179, 1229, 1180, 1222, 1184,
+    1183, 1184, 1222, 1224, 1224, 1193, 1184, 1193,
+    1224, 1225, 1193, 1225, 1190, 1228, 1156, 1187,
+    1163, 1230, 1231, 1231, 1165, 1163, 1232, 1233,
+    1234, 1168, 1167, 1235, 1178, 1236, 1237, 1237,
+    1175, 1178, 1178, 1206, 1238, 1238, 1236, 1178,
+    1239, 1240, 1241, 1242, 1237, 1236, 1236, 1243,
+    1244, 1176, 1175, 1245, 1175, 1237, 1245, 1244,
+    1242, 1236, 1239, 1171, 1168, 1241, 1171, 1239,
+    1210, 1246, 1247, 1247, 1211, 1210, 1246, 1248,
+    1249, 1249, 1247, 1246, 1247, 1250, 1211, 1251,
+    1236, 1238, 1238, 1252, 1251, 1253, 1254, 1255,
+    1256, 1257, 1258, 1253, 1259, 1260, 1253, 1255,
+    1259, 1261, 1262, 1263, 1263, 1264, 1261, 1264,
+    1263, 1265, 1257, 1256, 1266, 1267, 1258, 1257,
+    1257, 1268, 1267, 1150, 1269, 1270, 1270, 1152,
+    1150, 1271, 1272, 1273, 1274, 1188, 1275, 1276,
+    1277, 1278, 1150, 1147, 1269, 1276, 1279, 1277,
+    1280, 1277, 1279, 1281, 1149, 1106, 1149, 1146,
+    1148, 1281, 1282, 1283, 1283, 1146, 1281, 1284,
+    1285, 1286, 1287, 1288, 1289, 1285, 1290, 1291,
+    1291, 1286, 1285, 1290, 1292, 1293, 1293, 1291,
+    1290, 1294, 1295, 1296, 1297, 1298, 1294, 1294,
+    1296, 1297, 1297, 1299, 1298, 1299, 1297, 1300,
+    1300, 1301, 1299, 1301, 1302, 1303, 1304, 1293,
+    1292, 1302, 1301, 1300, 1286, 1305, 1306, 1306,
+    1307, 1286, 1291, 1308, 1305, 1305, 1286, 1291,
+    1293, 1309, 1308, 1308, 1291, 1293, 1310, 1311,
+    1312, 1312, 1313, 1310, 1314, 1315, 1316, 1315,
+    1314, 1317, 1309, 1293, 1304, 1313, 1312, 1314,
+    1314, 1316, 1313, 1318, 1319, 1320, 1320, 1321,
+    1318, 1321, 1320, 1311, 1311, 1310, 1321, 1319,
+    1322, 1320, 1323, 1320, 1322, 1320, 1323, 1311,
+    1312, 1311, 1323, 1322, 1324, 1317, 1317, 1323,
+    1322, 1323, 1317, 1314, 1314, 1312, 1323, 1325,
+    1322, 1319, 1325, 1324, 1322, 1326, 1327, 1328,
+    1325, 1319, 1329, 1329, 1330, 1325, 1331, 1105,
+    1196, 1295, 1294, 1332, 1281, 1146, 1149, 1188,
+    1274, 1189, 1333, 1189, 1274, 1334, 1232, 1245,
+    1334, 1233, 1232, 1335, 1168, 1235, 1334, 1244,
+    1336, 1334, 1237, 1242, 1334, 1245, 1237, 1334,
+    1242, 1244, 1334, 1336, 1337, 1338, 1214, 1213,
+    1338, 1213, 1218, 1338, 1218, 1219, 1338, 1220,
+    1214, 1338, 1221, 1220, 1338, 1223, 1221, 1338,
+    1219, 1223, 1339, 1340, 1341, 1342, 798, 797,
+    1340, 1339, 1343, 1344, 1345, 1346, 1346, 1347,
+    1344, 1342, 1348, 798, 1349, 798, 1348, 1345,
+    1350, 1351, 1351, 1346, 1345, 1348, 1352, 1353,
+    1353, 1349, 1348, 1350, 1354, 1355, 1355, 1351,
+    1350, 1352, 1356, 1357, 1357, 1353, 1352, 1354,
+    1358, 1359, 1359, 1355, 1354, 1356, 1360, 1361,
+    1361, 1357, 1356, 1358, 1362, 1363, 1363, 1359,
+    1358, 1360, 1364, 1365, 1365, 1361, 1360, 1366,
+    1367, 1368, 1369, 1363, 1362, 1370, 1367, 1366,
+    1366, 1371, 1370, 1269, 1372, 1373, 1373, 1270,
+    1269, 1374, 1375, 1376, 1376, 1377, 1374, 1375,
+    1378, 1379, 1379, 1376, 1375, 1380, 1381, 1382,
+    1379, 1378, 1383, 1384, 1385, 1386, 1386, 1387,
+    1384, 1388, 1389, 1390, 1390, 1391, 1388, 1389,
+    1392, 1393, 1393, 1390, 1389, 1394, 1393, 1392,
+    1394, 1392, 1395, 1396, 1394, 1395, 1393, 1397,
+    1398, 1398, 1390, 1393, 1390, 1398, 1399, 1399,
+    1391, 1390, 1394, 1396, 1400, 1400, 1401, 1394,
+    1402, 1400, 1396, 1403, 1404, 1405, 1405, 1406,
+    1403, 1406, 1405, 1407, 1407, 1408, 1406, 1409,
+    1277, 1280, 1280, 1410, 1409, 1411, 1408, 1407,
+    1407, 1412, 1411, 1381, 1380, 1413, 1413, 1414,
+    1381, 1415, 1416, 1414, 1414, 1372, 1415, 1278,
+    1277, 1409, 1415, 1372, 1269, 1417, 1418, 1381,
+    1382, 1381, 1418, 1419, 1411, 1412, 1402, 1396,
+    1395, 1372, 1414, 1413, 1413, 1373, 1372, 1401,
+    1397, 1393, 1393, 1394, 1401, 1414, 1416, 1417,
+    1417, 1381, 1414, 1420, 893, 899, 899, 1421,
+    1420, 1422, 1420, 1421, 1421, 1423, 1422, 1424,
+    1422, 1423, 1423, 1425, 1424, 1426, 1424, 1425,
+    1425, 1427, 1426, 1420, 894, 893, 1420, 1428,
+    894, 1428, 1420, 1422, 1429, 1430, 1431, 1422,
+    1424, 1428, 1430, 1432, 1433, 1434, 1428, 1424,
+    1424, 1426, 1434, 1432, 1430, 1429, 1435, 1436,
+    1437, 1437, 1433, 1435, 1438, 1439, 1440, 1440,
+    1441, 1438, 1442, 1443, 1444, 1442, 1444, 1445,
+    1445, 1444, 1446, 1445, 1446, 1447, 1448, 1449,
+    1450, 1451, 1448, 1450, 1450, 1449, 1443, 1443,
+    1442, 1450, 814, 813, 1439, 814, 1439, 815,
+    1438, 815, 1439, 1447, 817, 816, 1447, 1452,
+    1445, 1447, 816, 1452, 1453, 1454, 1455, 1455,
+    1456, 1453, 1454, 1453, 1457, 1448, 1457, 1458,
+    1436, 1459, 1437, 1459, 1460, 1437, 1460, 1431,
+    1430, 1430, 1437, 1460, 1433, 1432, 1461, 1433,
+    1437, 1430, 1462, 1452, 816, 1462, 816, 819,
+    1462, 819, 1451, 1462, 1451, 1450, 1458, 1449,
+    1448, 1458, 1457, 1453, 1458, 1453, 1463, 1463,
+    1453, 1456, 1463, 1456, 1446, 1463, 1446, 1444,
+    1464, 1465, 1466, 1466, 1467, 1464, 1468, 1469,
+    1470, 1470, 1471, 1468, 1472, 1473, 1474, 1474,
+    1475, 1472, 1476, 1477, 1478, 1478, 1479, 1476,
+    1465, 1480, 1481, 1481, 1466, 1465, 1444, 1443,
+    1482, 1482, 1483, 1444, 1463, 1444, 1483, 1483,
+    1484, 1463, 1458, 1463, 1484, 1484, 1485, 1458,
+    1449, 1458, 1485, 1485, 1486, 1449, 1443, 1449,
+    1486, 1486, 1482, 1443, 1487, 1488, 1489, 1490,
+    1471, 1470, 1491, 1475, 1474, 1492, 1479, 1478,
+    1487, 1489, 1493, 1494, 1495, 1496, 1496, 1497,
+    1494, 1498, 1494, 1497, 1497, 1499, 1498, 1500,
+    1501, 1502, 1502, 1503, 1500, 1504, 1505, 1506,
+    1506, 1507, 1504, 1508, 1504, 1507, 1509, 1510,
+    1511, 1450, 1442, 1512, 1512, 1513, 1450, 1514,
+    1515, 1494, 1494, 1498, 1514, 1516, 1517, 1518,
+    1519, 1520, 1452, 1445, 1452, 1520, 1520, 1521,
+    1445, 1442, 1445, 1521, 1521, 1512, 1442, 1522,
+    1497, 1496, 1522, 1499, 1497, 1523, 1503, 1502,
+    1524, 1525, 1526, 1524, 1527, 1525, 0, 1,
+    2, 3, 2, 1, 4, 0, 5, 2,
+    5, 0, 6, 4, 7, 5, 7, 4,
+    8, 9, 6, 6, 7, 8, 10, 11,
+    12, 12, 13, 10, 14, 15, 3, 3,
+    1, 14, 16, 17, 18, 15, 14, 19,
+    20, 21, 2, 2, 3, 20, 21, 22,
+    5, 5, 2, 21, 22, 23, 7, 7,
+    5, 22, 23, 24, 8, 8, 7, 23,
+    25, 20, 3, 3, 15, 25, 26, 25,
+    15, 18, 17, 27, 28, 29, 30, 31,
+    30, 29, 29, 28, 32, 33, 34, 35,
+    36, 37, 38, 38, 39, 36, 37, 40,
+    41, 41, 38, 37, 28, 30, 42, 43,
+    44, 23, 24, 23, 44, 43, 36, 44,
+    39, 44, 36, 32, 35, 45, 35, 32,
+    33, 45, 29, 32, 29, 45, 31, 22,
+    46, 23, 43, 23, 46, 21, 47, 46,
+    46, 22, 21, 20, 48, 47, 47, 21,
+    20, 25, 49, 48, 48, 20, 25, 26,
+    50, 51, 49, 25, 51, 52, 53, 54,
+    55, 27, 54, 56, 57, 34, 34, 33,
+    56, 58, 59, 41, 41, 40, 58, 60,
+    61, 37, 37, 36, 60, 61, 62, 40,
+    40, 37, 61, 46, 60, 36, 36, 43,
+    46, 62, 63, 58, 58, 40, 62, 64,
+    65, 61, 61, 60, 64, 65, 66, 62,
+    62, 61, 65, 47, 64, 60, 60, 46,
+    47, 66, 67, 63, 63, 62, 66, 17,
+    52, 27, 15, 68, 26, 16, 18, 69,
+    19, 68, 15, 64, 70, 65, 70, 64,
+    71, 70, 72, 66, 66, 65, 70, 73,
+    74, 75, 67, 66, 72, 48, 71, 64,
+    64, 47, 48, 71, 76, 70, 76, 71,
+    77, 70, 78, 72, 78, 70, 76, 78,
+    79, 80, 49, 77, 71, 71, 48, 49,
+    81, 82, 83, 83, 84, 85, 86, 87,
+    88, 87, 89, 88, 79, 78, 88, 82,
+    81, 90, 91, 92, 93, 87, 86, 94,
+    95, 87, 93, 96, 97, 91, 98, 99,
+    100, 97, 101, 92, 92, 91, 97, 101,
+    102, 103, 103, 92, 101, 104, 90, 99,
+    87, 94, 93, 93, 94, 91, 95, 93,
+    105, 105, 93, 92, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 113, 115, 114,
+    116, 117, 118, 104, 82, 90, 98, 104,
+    99, 74, 73, 119, 74, 120, 121, 122,
+    121, 120, 120, 123, 122, 123, 116, 118,
+    87, 95, 89, 118, 122, 123, 124, 84,
+    83, 78, 76, 125, 126, 127, 128, 128,
+    75, 126, 126, 75, 74, 129, 130, 131,
+    132, 133, 131, 131, 130, 132, 128, 134,
+    133, 133, 132, 128, 127, 135, 134, 134,
+    128, 127, 57, 136, 34, 137, 138, 139,
+    124, 140, 84, 52, 54, 27, 115, 141,
+    142, 142, 143, 115, 141, 144, 145, 145,
+    142, 141, 141, 115, 113, 113, 146, 144,
+    144, 141, 113, 147, 99, 90, 146, 113,
+    112, 148, 149, 150, 151, 152, 153, 99,
+    154, 100, 88, 89, 79, 86, 88, 125,
+    83, 85, 81, 78, 125, 88, 121, 155,
+    74, 126, 74, 155, 156, 157, 143, 143,
+    142, 156, 158, 156, 142, 142, 145, 158,
+    156, 159, 160, 160, 157, 156, 158, 161,
+    159, 159, 156, 158, 84, 140, 162, 163,
+    164, 0, 1, 0, 164, 165, 163, 0,
+    0, 4, 165, 166, 165, 4, 4, 6,
+    166, 167, 166, 6, 6, 9, 167, 168,
+    169, 12, 12, 11, 168, 170, 171, 14,
+    14, 1, 170, 171, 172, 19, 19, 14,
+    171, 173, 174, 16, 16, 69, 173, 175,
+    176, 177, 163, 165, 178, 179, 178, 165,
+    165, 166, 179, 180, 179, 166, 166, 167,
+    180, 181, 182, 169, 169, 168, 181, 174,
+    173, 183, 184, 185, 177, 178, 175, 185,
+    177, 185, 175, 164, 163, 184, 178, 185,
+    163, 184, 163, 185, 164, 170, 1, 170,
+    164, 184, 186, 187, 177, 184, 177, 187,
+    188, 189, 186, 187, 186, 189, 176, 190,
+    186, 186, 177, 176, 190, 191, 188, 188,
+    186, 190, 184, 187, 170, 192, 170, 187,
+    187, 189, 192, 193, 194, 195, 195, 196,
+    197, 197, 193, 195, 198, 174, 183, 183,
+    173, 199, 192, 171, 170, 199, 200, 183,
+    201, 202, 203, 204, 205, 189, 189, 188,
+    204, 206, 204, 188, 188, 191, 206, 207,
+    208, 197, 197, 196, 207, 205, 209, 192,
+    192, 189, 205, 208, 207, 210, 211, 212,
+    213, 213, 214, 211, 215, 216, 201, 201,
+    203, 215, 217, 218, 205, 205, 204, 217,
+    219, 220, 221, 204, 206, 222, 218, 223,
+    209, 209, 205, 218, 224, 219, 208, 208,
+    210, 224, 225, 226, 212, 212, 211, 225,
+    227, 228, 216, 216, 215, 227, 229, 230,
+    218, 218, 217, 229, 231, 232, 220, 220,
+    219, 231, 230, 233, 223, 223, 218, 230,
+    234, 231, 219, 219, 224, 234, 235, 236,
+    226, 226, 225, 235, 237, 238, 228, 228,
+    227, 237, 239, 240, 230, 230, 229, 239,
+    241, 242, 232, 232, 231, 241, 240, 243,
+    233, 233, 230, 240, 244, 241, 231, 231,
+    234, 244, 245, 246, 242, 242, 241, 245,
+    246, 245, 247, 248, 249, 247, 250, 251,
+    240, 240, 239, 250, 252, 253, 254, 243,
+    240, 255, 251, 250, 256, 252, 257, 253,
+    258, 259, 251, 251, 256, 258, 244, 260,
+    245, 245, 241, 244, 247, 245, 260, 260,
+    261, 248, 248, 247, 260, 236, 235, 262,
+    262, 263, 236, 263, 262, 264, 265, 266,
+    267, 257, 268, 253, 259, 269, 270, 270,
+    251, 259, 271, 272, 263, 263, 264, 271,
+    273, 274, 268, 268, 257, 273, 275, 276,
+    277, 277, 278, 275, 279, 280, 276, 276,
+    275, 279, 31, 10, 13, 13, 30, 31,
+    108, 117, 281, 116, 281, 117, 103, 105,
+    92, 117, 108, 107, 282, 283, 284, 97,
+    96, 285, 286, 285, 287, 288, 289, 290,
+    286, 291, 101, 101, 97, 286, 292, 293,
+    294, 102, 101, 295, 291, 286, 287, 292,
+    296, 293, 297, 298, 291, 291, 287, 297,
+    154, 299, 300, 300, 100, 154, 290, 300,
+    299, 299, 301, 288, 288, 290, 299, 152,
+    151, 302, 302, 303, 152, 303, 302, 304,
+    305, 306, 307, 296, 308, 293, 298, 309,
+    310, 310, 291, 298, 311, 312, 303, 303,
+    304, 311, 313, 314, 308, 308, 296, 313,
+    315, 316, 317, 317, 318, 315, 319, 320,
+    316, 316, 315, 319, 321, 322, 178, 178,
+    179, 321, 323, 321, 179, 179, 180, 323,
+    324, 325, 182, 182, 181, 324, 326, 327,
+    328, 329, 326, 321, 321, 323, 329, 330,
+    329, 323, 325, 324, 331, 332, 333, 327,
+    327, 326, 332, 334, 332, 326, 326, 329,
+    334, 335, 336, 337, 329, 330, 338, 339,
+    340, 333, 333, 332, 339, 334, 339, 332,
+    339, 334, 341, 342, 343, 336, 336, 335,
+    342, 344, 345, 346, 328, 321, 326, 347,
+    348, 328, 328, 327, 347, 349, 347, 327,
+    327, 333, 349, 350, 349, 333, 333, 340,
+    350, 351, 352, 353, 348, 347, 354, 349,
+    354, 347, 355, 356, 357, 358, 357, 356,
+    359, 360, 361, 348, 354, 362, 357, 351,
+    355, 353, 355, 351, 363, 175, 178, 178,
+    322, 363, 348, 363, 322, 344, 346, 364,
+    365, 366, 175, 175, 363, 365, 362, 365,
+    363, 363, 348, 362, 367, 368, 353, 353,
+    352, 367, 369, 370, 366, 366, 365, 369,
+    371, 369, 365, 365, 362, 371, 372, 373,
+    374, 374, 375, 372, 174, 198, 373, 373,
+    372, 174, 376, 377, 378, 376, 379, 380,
+    379, 376, 378, 369, 371, 381, 382, 383,
+    384, 343, 342, 385, 386, 387, 383, 383,
+    382, 386, 388, 389, 387, 387, 386, 388,
+    390, 391, 389, 389, 388, 390, 390, 392,
+    391, 393, 394, 392, 392, 390, 393, 395,
+    396, 394, 394, 393, 395, 397, 398, 396,
+    396, 395, 397, 399, 400, 398, 398, 397,
+    399, 401, 402, 400, 400, 399, 401, 403,
+    404, 405, 405, 406, 403, 407, 408, 404,
+    404, 403, 407, 409, 410, 411, 411, 412,
+    409, 413, 414, 410, 410, 409, 413, 415,
+    416, 417, 418, 411, 410, 410, 419, 420,
+    414, 421, 419, 419, 410, 414, 422, 423,
+    391, 391, 392, 422, 424, 425, 426, 426,
+    427, 424, 389, 391, 423, 428, 429, 425,
+    425, 424, 428, 428, 421, 429, 421, 428,
+    419, 430, 431, 340, 340, 339, 430, 432,
+    430, 339, 339, 341, 432, 431, 433, 350,
+    350, 340, 431, 434, 435, 361, 361, 360,
+    434, 429, 421, 436, 431, 430, 429, 430,
+    432, 425, 436, 437, 433, 438, 439, 435,
+    435, 434, 438, 440, 441, 442, 442, 413,
+    440, 441, 443, 437, 421, 414, 442, 444,
+    445, 446, 446, 447, 444, 445, 439, 438,
+    438, 446, 445, 430, 425, 429, 431, 429,
+    436, 433, 431, 436, 421, 437, 436, 441,
+    437, 442, 442, 437, 421, 413, 442, 414,
+    443, 433, 437, 448, 195, 194, 449, 450,
+    451, 451, 452, 449, 453, 454, 452, 452,
+    451, 453, 455, 424, 454, 454, 453, 455,
+    420, 456, 450, 450, 449, 420, 457, 458,
+    456, 456, 420, 457, 459, 460, 458, 458,
+    457, 459, 461, 455, 460, 460, 459, 461,
+    455, 461, 424, 394, 396, 462, 462, 463,
+    394, 392, 394, 463, 463, 464, 392, 424,
+    427, 454, 416, 465, 417, 420, 419, 457,
+    459, 457, 419, 419, 428, 459, 461, 459,
+    428, 424, 461, 428, 422, 392, 464, 466,
+    467, 400, 400, 402, 466, 468, 469, 470,
+    471, 405, 404, 472, 473, 413, 413, 409,
+    472, 474, 440, 413, 413, 473, 474, 475,
+    476, 477, 473, 472, 478, 479, 480, 473,
+    481, 409, 412, 481, 472, 409, 473, 478,
+    479, 404, 408, 477, 477, 408, 475, 482,
+    483, 444, 444, 447, 482, 484, 485, 483,
+    483, 482, 484, 447, 486, 482, 474, 473,
+    487, 487, 488, 474, 489, 490, 491, 492,
+    493, 494, 495, 496, 491, 496, 489, 491,
+    497, 498, 499, 499, 500, 497, 501, 497,
+    500, 502, 494, 493, 493, 492, 503, 503,
+    504, 493, 505, 506, 387, 387, 389, 505,
+    507, 508, 509, 510, 426, 511, 512, 513,
+    514, 506, 383, 387, 513, 515, 514, 515,
+    513, 516, 343, 385, 517, 382, 384, 385,
+    518, 519, 517, 517, 384, 518, 520, 521,
+    522, 523, 524, 525, 526, 527, 521, 521,
+    520, 526, 528, 529, 527, 527, 526, 528,
+    530, 531, 532, 532, 533, 534, 534, 530,
+    532, 533, 535, 534, 536, 534, 535, 535,
+    537, 536, 538, 539, 537, 529, 528, 540,
+    536, 537, 539, 541, 542, 520, 520, 543,
+    541, 542, 544, 526, 526, 520, 542, 544,
+    545, 528, 528, 526, 544, 546, 547, 548,
+    548, 549, 546, 550, 551, 552, 553, 552,
+    551, 540, 528, 545, 552, 546, 549, 549,
+    550, 552, 554, 555, 556, 556, 557, 554,
+    547, 554, 557, 557, 548, 547, 554, 558,
+    555, 558, 554, 559, 547, 559, 554, 559,
+    547, 546, 553, 560, 558, 558, 559, 553,
+    552, 553, 559, 559, 546, 552, 555, 558,
+    561, 558, 560, 561, 562, 563, 564, 565,
+    555, 561, 561, 566, 565, 432, 341, 567,
+    568, 532, 531, 385, 384, 517, 425, 511,
+    426, 511, 425, 569, 481, 470, 570, 470,
+    469, 570, 471, 404, 571, 572, 479, 570,
+    478, 472, 570, 472, 481, 570, 479, 478,
+    570, 573, 572, 570, 451, 450, 574, 453,
+    451, 574, 455, 453, 574, 450, 456, 574,
+    456, 458, 574, 458, 460, 574, 460, 455,
+    574, 575, 576, 577, 35, 34, 578, 579,
+    577, 576, 580, 581, 582, 582, 583, 580,
+    584, 585, 586, 585, 584, 587, 588, 589,
+    581, 581, 580, 588, 590, 591, 585, 585,
+    587, 590, 592, 593, 589, 589, 588, 592,
+    594, 595, 591, 591, 590, 594, 596, 597,
+    593, 593, 592, 596, 598, 599, 595, 595,
+    594, 598, 600, 601, 597, 597, 596, 600,
+    602, 603, 599, 599, 598, 602, 604, 605,
+    602, 601, 600, 606, 602, 605, 607, 607,
+    603, 602, 608, 609, 506, 506, 505, 608,
+    610, 611, 612, 612, 613, 610, 614, 615,
+    611, 611, 610, 614, 616, 617, 618, 619,
+    615, 614, 620, 621, 622, 622, 623, 620,
+    624, 625, 626, 626, 627, 624, 628, 629,
+    625, 625, 624, 628, 629, 628, 630, 631,
+    629, 630, 631, 630, 632, 633, 634, 628,
+    628, 624, 633, 635, 633, 624, 624, 627,
+    635, 636, 632, 630, 630, 637, 636, 632,
+    636, 638, 639, 640, 641, 641, 642, 639,
+    643, 639, 642, 642, 644, 643, 516, 513,
+    645, 645, 646, 516, 643, 644, 647, 647,
+    648, 643, 649, 618, 617, 617, 650, 649,
+    650, 651, 652, 652, 609, 650, 645, 513,
+    512, 506, 609, 652, 617, 653, 654, 653,
+    617, 616, 648, 647, 655, 631, 632, 638,
+    649, 650, 609, 609, 608, 649, 628, 634,
+    637, 637, 630, 628, 654, 651, 650, 650,
+    617, 654, 135, 127, 656, 656, 657, 135,
+    657, 656, 658, 658, 659, 657, 659, 658,
+    660, 660, 661, 659, 661, 660, 662, 662,
+    663, 661, 127, 126, 656, 126, 664, 656,
+    658, 656, 664, 665, 666, 667, 664, 660,
+    658, 668, 669, 666, 660, 664, 670, 670,
+    662, 660, 667, 666, 669, 671, 672, 673,
+    673, 668, 671, 674, 675, 676, 676, 677,
+    674, 678, 679, 680, 681, 678, 680, 682,
+    678, 681, 683, 682, 681, 684, 685, 686,
+    684, 686, 687, 679, 685, 684, 684, 680,
+    679, 675, 49, 51, 50, 675, 51, 675,
+    50, 676, 54, 53, 683, 681, 688, 683,
+    688, 54, 683, 689, 690, 691, 691, 692,
+    689, 693, 691, 690, 694, 693, 686, 671,
+    695, 672, 671, 696, 695, 666, 665, 696,
+    696, 671, 666, 697, 669, 668, 666, 671,
+    668, 54, 688, 698, 55, 54, 698, 687,
+    55, 698, 684, 687, 698, 686, 685, 694,
+    691, 693, 694, 699, 691, 694, 692, 691,
+    699, 682, 692, 699, 678, 682, 699, 700,
+    701, 702, 702, 703, 700, 704, 705, 706,
+    706, 707, 704, 708, 709, 710, 710, 711,
+    708, 712, 713, 714, 714, 715, 712, 716,
+    717, 701, 701, 700, 716, 718, 679, 678,
+    678, 719, 718, 719, 678, 699, 699, 720,
+    719, 720, 699, 694, 694, 721, 720, 721,
+    694, 685, 685, 722, 721, 722, 685, 679,
+    679, 718, 722, 723, 724, 725, 704, 707,
+    726, 708, 711, 727, 712, 715, 728, 729,
+    723, 725, 730, 731, 732, 732, 733, 730,
+    733, 732, 734, 734, 735, 733, 736, 737,
+    738, 738, 739, 736, 740, 741, 742, 742,
+    743, 740, 743, 742, 744, 745, 746, 747,
+    748, 680, 684, 684, 749, 748, 732, 750,
+    751, 751, 734, 732, 752, 753, 754, 688,
+    755, 756, 755, 688, 681, 681, 757, 755,
+    757, 681, 680, 680, 748, 757, 730, 733,
+    758, 733, 735, 758, 736, 739, 759, 760,
+    761, 762, 761, 763, 762, 764, 765, 766,
+    765, 764, 767, 768, 766, 769, 766, 768,
+    764, 770, 769, 771, 769, 770, 768, 771,
+    772, 773, 773, 770, 771, 774, 775, 776,
+    776, 777, 774, 767, 778, 779, 779, 765,
+    767, 780, 781, 782, 783, 779, 778, 764,
+    784, 785, 785, 767, 764, 768, 786, 784,
+    784, 764, 768, 770, 787, 786, 786, 768,
+    770, 773, 788, 787, 787, 770, 773, 767,
+    785, 789, 789, 778, 767, 778, 789, 790,
+    791, 781, 780, 792, 793, 794, 793, 792,
+    795, 796, 794, 793, 797, 798, 799, 800,
+    801, 802, 802, 803, 800, 804, 805, 801,
+    801, 800, 804, 806, 792, 794, 787, 807,
+    808, 807, 787, 788, 807, 802, 808, 802,
+    807, 803, 809, 797, 796, 799, 796, 797,
+    796, 793, 809, 795, 809, 793, 787, 810,
+    786, 810, 787, 808, 810, 811, 784, 784,
+    786, 810, 811, 812, 785, 785, 784, 811,
+    812, 813, 789, 789, 785, 812, 814, 815,
+    790, 814, 789, 813, 816, 817, 818, 816,
+    791, 819, 820, 821, 822, 823, 799, 798,
+    804, 824, 825, 825, 805, 804, 801, 826,
+    827, 827, 802, 801, 805, 828, 826, 826,
+    801, 805, 802, 827, 810, 810, 808, 802,
+    825, 829, 828, 828, 805, 825, 826, 830,
+    831, 831, 827, 826, 828, 832, 830, 830,
+    826, 828, 827, 831, 811, 811, 810, 827,
+    829, 833, 832, 832, 828, 829, 791, 818,
+    781, 790, 834, 778, 835, 780, 782, 778,
+    834, 783, 830, 836, 831, 837, 831, 836,
+    832, 838, 836, 836, 830, 832, 839, 840,
+    841, 838, 832, 833, 831, 837, 812, 812,
+    811, 831, 836, 842, 837, 843, 837, 842,
+    838, 844, 836, 842, 836, 844, 845, 846,
+    844, 837, 843, 813, 813, 812, 837, 847,
+    848, 849, 850, 851, 847, 852, 853, 854,
+    852, 855, 853, 852, 844, 846, 856, 849,
+    848, 857, 858, 859, 860, 854, 853, 857,
+    853, 861, 859, 862, 863, 864, 865, 866,
+    858, 867, 862, 862, 859, 858, 868, 869,
+    867, 867, 858, 868, 865, 856, 870, 857,
+    860, 853, 859, 860, 857, 871, 857, 861,
+    858, 857, 871, 872, 873, 874, 875, 876,
+    877, 878, 879, 880, 878, 881, 879, 882,
+    883, 884, 856, 848, 870, 865, 870, 866,
+    885, 841, 840, 886, 887, 840, 887, 886,
+    888, 888, 889, 887, 882, 884, 889, 855,
+    861, 853, 889, 888, 882, 847, 851, 890,
+    891, 842, 844, 892, 893, 894, 894, 839,
+    892, 840, 839, 894, 895, 822, 821, 895,
+    896, 897, 897, 822, 895, 896, 898, 892,
+    892, 897, 896, 898, 899, 893, 893, 892,
+    898, 820, 900, 821, 901, 902, 903, 851,
+    904, 890, 791, 816, 818, 905, 906, 881,
+    881, 907, 905, 908, 909, 906, 906, 905,
+    908, 879, 881, 906, 909, 910, 879, 879,
+    906, 909, 856, 865, 911, 880, 879, 910,
+    912, 913, 914, 915, 916, 917, 864, 918,
+    865, 846, 855, 852, 891, 852, 854, 849,
+    850, 847, 852, 891, 844, 840, 919, 886,
+    919, 840, 894, 907, 920, 921, 921, 905,
+    907, 905, 921, 922, 922, 908, 905, 923,
+    924, 921, 921, 920, 923, 924, 925, 922,
+    922, 921, 924, 926, 904, 851, 766, 927,
+    928, 927, 766, 765, 766, 928, 929, 929,
+    769, 766, 769, 929, 930, 930, 771, 769,
+    771, 930, 931, 931, 772, 771, 774, 932,
+    933, 933, 775, 774, 779, 934, 935, 935,
+    765, 779, 783, 936, 934, 934, 779, 783,
+    782, 937, 938, 938, 835, 782, 939, 940,
+    941, 942, 929, 928, 929, 942, 943, 943,
+    930, 929, 930, 943, 944, 944, 931, 930,
+    932, 945, 946, 946, 933, 932, 947, 938,
+    937, 939, 948, 949, 948, 941, 942, 941,
+    948, 939, 949, 928, 927, 928, 948, 942,
+    948, 928, 949, 765, 935, 927, 949, 927,
+    935, 939, 950, 951, 950, 939, 949, 951,
+    952, 953, 952, 951, 950, 951, 954, 940,
+    940, 939, 951, 953, 955, 954, 954, 951,
+    953, 935, 950, 949, 950, 935, 956, 956,
+    952, 950, 957, 958, 959, 960, 961, 957,
+    957, 959, 960, 947, 937, 962, 963, 938,
+    947, 935, 934, 956, 947, 964, 963, 965,
+    966, 967, 952, 968, 969, 969, 953, 952,
+    953, 969, 970, 970, 955, 953, 960, 971,
+    972, 972, 961, 960, 956, 973, 968, 968,
+    952, 956, 974, 972, 971, 975, 976, 977,
+    977, 978, 975, 967, 979, 980, 980, 965,
+    967, 968, 981, 982, 982, 969, 968, 983,
+    984, 985, 986, 970, 969, 973, 987, 981,
+    981, 968, 973, 971, 985, 988, 988, 974,
+    971, 976, 989, 990, 990, 977, 976, 979,
+    991, 992, 992, 980, 979, 981, 993, 994,
+    994, 982, 981, 984, 995, 996, 996, 985,
+    984, 987, 997, 993, 993, 981, 987, 985,
+    996, 998, 998, 988, 985, 989, 999, 1000,
+    1000, 990, 989, 991, 1001, 1002, 1002, 992,
+    991, 993, 1003, 1004, 1004, 994, 993, 995,
+    1005, 1006, 1006, 996, 995, 997, 1007, 1003,
+    1003, 993, 997, 996, 1006, 1008, 1008, 998,
+    996, 1005, 1009, 1010, 1010, 1006, 1005, 1011,
+    1010, 1009, 1011, 1012, 1013, 1003, 1014, 1015,
+    1015, 1004, 1003, 1016, 1017, 1018, 1019, 1003,
+    1007, 1020, 1015, 1014, 1017, 1021, 1018, 1014,
+    1022, 1023, 1023, 1020, 1014, 1010, 1024, 1008,
+    1008, 1006, 1010, 1024, 1010, 1011, 1013, 1025,
+    1024, 1024, 1011, 1013, 1026, 1000, 999, 999,
+    1027, 1026, 1028, 1026, 1027, 1029, 1030, 1031,
+    1017, 1032, 1021, 1033, 1034, 1022, 1022, 1014,
+    1033, 1027, 1035, 1036, 1036, 1028, 1027, 1032,
+    1037, 1038, 1038, 1021, 1032, 1039, 1040, 1041,
+    1041, 1042, 1039, 1040, 1043, 1044, 1044, 1041,
+    1040, 777, 776, 795, 795, 792, 777, 1045,
+    883, 872, 883, 1045, 884, 858, 871, 868,
+    873, 872, 883, 1046, 1047, 1048, 1049, 863,
+    862, 1050, 1049, 1051, 1052, 1053, 1054, 867,
+    1055, 1051, 1051, 862, 867, 1056, 1057, 1058,
+    1059, 867, 869, 1050, 1051, 1055, 1057, 1060,
+    1058, 1055, 1061, 1062, 1062, 1050, 1055, 1063,
+    1064, 918, 918, 864, 1063, 1064, 1063, 1052,
+    1054, 1065, 1064, 1064, 1052, 1054, 1066, 917,
+    916, 916, 1067, 1066, 1068, 1066, 1067, 1069,
+    1070, 1071, 1057, 1072, 1060, 1073, 1074, 1061,
+    1061, 1055, 1073, 1067, 1075, 1076, 1076, 1068,
+    1067, 1072, 1077, 1078, 1078, 1060, 1072, 1079,
+    1080, 1081, 1081, 1082, 1079, 1080, 1083, 1084,
+    1084, 1081, 1080, 942, 1085, 1086, 1086, 943,
+    942, 943, 1086, 1087, 1087, 944, 943, 945,
+    1088, 1089, 1089, 946, 945, 1090, 1091, 1092,
+    1086, 1092, 1093, 1093, 1087, 1086, 1087, 1093,
+    1094, 1095, 1089, 1088, 1091, 1096, 1097, 1097,
+    1092, 1091, 1092, 1097, 1098, 1098, 1093, 1092,
+    1099, 1100, 1101, 1102, 1094, 1093, 1096, 1103,
+    1104, 1104, 1097, 1096, 1097, 1104, 1098, 1105,
+    1098, 1104, 1100, 1106, 1107, 1107, 1101, 1100,
+    1108, 1109, 1110, 1092, 1086, 1090, 1090, 1111,
+    1112, 1112, 1091, 1090, 1091, 1112, 1113, 1113,
+    1096, 1091, 1096, 1113, 1114, 1114, 1103, 1096,
+    1115, 1116, 1117, 1118, 1112, 1111, 1112, 1118,
+    1113, 1119, 1120, 1121, 1120, 1119, 1122, 1123,
+    1124, 1125, 1126, 1118, 1111, 1121, 1117, 1119,
+    1117, 1121, 1115, 942, 941, 1127, 1127, 1085,
+    942, 1085, 1127, 1111, 1128, 1108, 1110, 941,
+    1129, 1130, 1130, 1127, 941, 1127, 1130, 1126,
+    1126, 1111, 1127, 1115, 1131, 1132, 1132, 1116,
+    1115, 1129, 1133, 1134, 1134, 1130, 1129, 1130,
+    1134, 1135, 1135, 1126, 1130, 1136, 1137, 1138,
+    1138, 1139, 1136, 1137, 962, 937, 937, 1138,
+    1137, 1140, 1141, 1142, 1143, 1144, 1142, 1140,
+    1142, 1144, 1145, 1135, 1134, 1146, 1147, 1148,
+    1149, 1107, 1106, 1147, 1150, 1151, 1151, 1148,
+    1147, 1150, 1152, 1153, 1153, 1151, 1150, 1152,
+    1154, 1155, 1155, 1153, 1152, 1154, 1156, 1155,
+    1156, 1157, 1158, 1158, 1155, 1156, 1157, 1159,
+    1160, 1160, 1158, 1157, 1159, 1161, 1162, 1162,
+    1160, 1159, 1161, 1163, 1164, 1164, 1162, 1161,
+    1163, 1165, 1166, 1166, 1164, 1163, 1167, 1168,
+    1169, 1169, 1170, 1167, 1168, 1171, 1172, 1172,
+    1169, 1168, 1173, 1174, 1175, 1175, 1176, 1173,
+    1174, 1177, 1178, 1178, 1175, 1174, 1179, 1180,
+    1181, 1174, 1173, 1182, 1183, 1184, 1174, 1184,
+    1185, 1177, 1177, 1174, 1184, 1154, 1186, 1187,
+    1187, 1156, 1154, 1188, 1189, 1190, 1190, 1191,
+    1188, 1186, 1154, 1152, 1189, 1192, 1193, 1193,
+    1190, 1189, 1192, 1185, 1193, 1184, 1193, 1185,
+    1103, 1194, 1195, 1195, 1104, 1103, 1104, 1195,
+    1196, 1196, 1105, 1104, 1114, 1197, 1194, 1194,
+    1103, 1114, 1123, 1198, 1199, 1199, 1124, 1123,
+    1200, 1185, 1192, 1192, 1195, 1194, 1189, 1196,
+    1195, 1197, 1201, 1200, 1198, 1202, 1203, 1203,
+    1199, 1198, 1204, 1205, 1206, 1206, 1178, 1204,
+    1201, 1207, 1205, 1204, 1177, 1185, 1208, 1209,
+    1210, 1210, 1211, 1208, 1203, 1202, 1209, 1209,
+    1208, 1203, 1192, 1189, 1195, 1200, 1192, 1194,
+    1200, 1194, 1197, 1200, 1201, 1185, 1204, 1201,
+    1205, 1185, 1201, 1204, 1177, 1204, 1178, 1201,
+    1197, 1207, 958, 957, 1212, 1213, 1214, 1215,
+    1215, 1216, 1213, 1216, 1217, 1218, 1218, 1213,
+    1216, 1217, 1190, 1219, 1219, 1218, 1217, 1214,
+    1220, 1183, 1183, 1215, 1214, 1220, 1221, 1222,
+    1222, 1183, 1220, 1221, 1223, 1224, 1224, 1222,
+    1221, 1223, 1219, 1225, 1225, 1224, 1223, 1190,
+    1225, 1219, 1226, 1159, 1157, 1157, 1227, 1226,
+    1227, 1157, 1156, 1156, 1228, 1227, 1217, 1191,
+    1190, 1179, 1229, 1180, 1222, 1184, 1183, 1184,
+    1222, 1224, 1224, 1193, 1184, 1193, 1224, 1225,
+    1193, 1225, 1190, 1228, 1156, 1187, 1163, 1230,
+    1231, 1231, 1165, 1163, 1232, 1233, 1234, 1168,
+    1167, 1235, 1178, 1236, 1237, 1237, 1175, 1178,
+    1178, 1206, 1238, 1238, 1236, 1178, 1239, 1240,
+    1241, 1242, 1237, 1236, 1236, 1243, 1244, 1176,
+    1175, 1245, 1175, 1237, 1245, 1244, 1242, 1236,
+    1239, 1171, 1168, 1241, 1171, 1239, 1210, 1246,
+    1247, 1247, 1211, 1210, 1246, 1248, 1249, 1249,
+    1247, 1246, 1247, 1250, 1211, 1251, 1236, 1238,
+    1238, 1252, 1251, 1253, 1254, 1255, 1256, 1257,
+    1258, 1253, 1259, 1260, 1253, 1255, 1259, 1261,
+    1262, 1263, 1263, 1264, 1261, 1264, 1263, 1265,
+    1257, 1256, 1266, 1267, 1258, 1257, 1257, 1268,
+    1267, 1150, 1269, 1270, 1270, 1152, 1150, 1271,
+    1272, 1273, 1274, 1188, 1275, 1276, 1277, 1278,
+    1150, 1147, 1269, 1276, 1279, 1277, 1280, 1277,
+    1279, 1281, 1149, 1106, 1149, 1146, 1148, 1281,
+    1282, 1283, 1283, 1146, 1281, 1284, 1285, 1286,
+    1287, 1288, 1289, 1285, 1290, 1291, 1291, 1286,
+    1285, 1290, 1292, 1293, 1293, 1291, 1290, 1294,
+    1295, 1296, 1297, 1298, 1294, 1294, 1296, 1297,
+    1297, 1299, 1298, 1299, 1297, 1300, 1300, 1301,
+    1299, 1301, 1302, 1303, 1304, 1293, 1292, 1302,
+    1301, 1300, 1286, 1305, 1306, 1306, 1307, 1286,
+    1291, 1308, 1305, 1305, 1286, 1291, 1293, 1309,
+    1308, 1308, 1291, 1293, 1310, 1311, 1312, 1312,
+    1313, 1310, 1314, 1315, 1316, 1315, 1314, 1317,
+    1309, 1293, 1304, 1313, 1312, 1314, 1314, 1316,
+    1313, 1318, 1319, 1320, 1320, 1321, 1318, 1321,
+    1320, 1311, 1311, 1310, 1321, 1319, 1322, 1320,
+    1323, 1320, 1322, 1320, 1323, 1311, 1312, 1311,
+    1323, 1322, 1324, 1317, 1317, 1323, 1322, 1323,
+    1317, 1314, 1314, 1312, 1323, 1325, 1322, 1319,
+    1325, 1324, 1322, 1326, 1327, 1328, 1325, 1319,
+    1329, 1329, 1330, 1325, 1331, 1105, 1196, 1295,
+    1294, 1332, 1281, 1146, 1149, 1188, 1274, 1189,
+    1333, 1189, 1274, 1334, 1232, 1245, 1334, 1233,
+    1232, 1335, 1168, 1235, 1334, 1244, 1336, 1334,
+    1237, 1242, 1334, 1245, 1237, 1334, 1242, 1244,
+    1334, 1336, 1337, 1338, 1214, 1213, 1338, 1213,
+    1218, 1338, 1218, 1219, 1338, 1220, 1214, 1338,
+    1221, 1220, 1338, 1223, 1221, 1338, 1219, 1223,
+    1339, 1340, 1341, 1342, 798, 797, 1340, 1339,
+    1343, 1344, 1345, 1346, 1346, 1347, 1344, 1342,
+    1348, 798, 1349, 798, 1348, 1345, 1350, 1351,
+    1351, 1346, 1345, 1348, 1352, 1353, 1353, 1349,
+    1348, 1350, 1354, 1355, 1355, 1351, 1350, 1352,
+    1356, 1357, 1357, 1353, 1352, 1354, 1358, 1359,
+    1359, 1355, 1354, 1356, 1360, 1361, 1361, 1357,
+    1356, 1358, 1362, 1363, 1363, 1359, 1358, 1360,
+    1364, 1365, 1365, 1361, 1360, 1366, 1367, 1368,
+    1369, 1363, 1362, 1370, 1367, 1366, 1366, 1371,
+    1370, 1269, 1372, 1373, 1373, 1270, 1269, 1374,
+    1375, 1376, 1376, 1377, 1374, 1375, 1378, 1379,
+    1379, 1376, 1375, 1380, 1381, 1382, 1379, 1378,
+    1383, 1384, 1385, 1386, 1386, 1387, 1384, 1388,
+    1389, 1390, 1390, 1391, 1388, 1389, 1392, 1393,
+    1393, 1390, 1389, 1394, 1393, 1392, 1394, 1392,
+    1395, 1396, 1394, 1395, 1393, 1397, 1398, 1398,
+    1390, 1393, 1390, 1398, 1399, 1399, 1391, 1390,
+    1394, 1396, 1400, 1400, 1401, 1394, 1402, 1400,
+    1396, 1403, 1404, 1405, 1405, 1406, 1403, 1406,
+    1405, 1407, 1407, 1408, 1406, 1409, 1277, 1280,
+    1280, 1410, 1409, 1411, 1408, 1407, 1407, 1412,
+    1411, 1381, 1380, 1413, 1413, 1414, 1381, 1415,
+    1416, 1414, 1414, 1372, 1415, 1278, 1277, 1409,
+    1415, 1372, 1269, 1417, 1418, 1381, 1382, 1381,
+    1418, 1419, 1411, 1412, 1402, 1396, 1395, 1372,
+    1414, 1413, 1413, 1373, 1372, 1401, 1397, 1393,
+    1393, 1394, 1401, 1414, 1416, 1417, 1417, 1381,
+    1414, 1420, 893, 899, 899, 1421, 1420, 1422,
+    1420, 1421, 1421, 1423, 1422, 1424, 1422, 1423,
+    1423, 1425, 1424, 1426, 1424, 1425, 1425, 1427,
+    1426, 1420, 894, 893, 1420, 1428, 894, 1428,
+    1420, 1422, 1429, 1430, 1431, 1422, 1424, 1428,
+    1430, 1432, 1433, 1434, 1428, 1424, 1424, 1426,
+    1434, 1432, 1430, 1429, 1435, 1436, 1437, 1437,
+    1433, 1435, 1438, 1439, 1440, 1440, 1441, 1438,
+    1442, 1443, 1444, 1442, 1444, 1445, 1445, 1444,
+    1446, 1445, 1446, 1447, 1448, 1449, 1450, 1451,
+    1448, 1450, 1450, 1449, 1443, 1443, 1442, 1450,
+    814, 813, 1439, 814, 1439, 815, 1438, 815,
+    1439, 1447, 817, 816, 1447, 1452, 1445, 1447,
+    816, 1452, 1453, 1454, 1455, 1455, 1456, 1453,
+    1454, 1453, 1457, 1448, 1457, 1458, 1436, 1459,
+    1437, 1459, 1460, 1437, 1460, 1431, 1430, 1430,
+    1437, 1460, 1433, 1432, 1461, 1433, 1437, 1430,
+    1462, 1452, 816, 1462, 816, 819, 1462, 819,
+    1451, 1462, 1451, 1450, 1458, 1449, 1448, 1458,
+    1457, 1453, 1458, 1453, 1463, 1463, 1453, 1456,
+    1463, 1456, 1446, 1463, 1446, 1444, 1464, 1465,
+    1466, 1466, 1467, 1464, 1468, 1469, 1470, 1470,
+    1471, 1468, 1472, 1473, 1474, 1474, 1475, 1472,
+    1476, 1477, 1478, 1478, 1479, 1476, 1465, 1480,
+    1481, 1481, 1466, 1465, 1444, 1443, 1482, 1482,
+    1483, 1444, 1463, 1444, 1483, 1483, 1484, 1463,
+    1458, 1463, 1484, 1484, 1485, 1458, 1449, 1458,
+    1485, 1485, 1486, 1449, 1443, 1449, 1486, 1486,
+    1482, 1443, 1487, 1488, 1489, 1490, 1471, 1470,
+    1491, 1475, 1474, 1492, 1479, 1478, 1487, 1489,
+    1493, 1494, 1495, 1496, 1496, 1497, 1494, 1498,
+    1494, 1497, 1497, 1499, 1498, 1500, 1501, 1502,
+    1502, 1503, 1500, 1504, 1505, 1506, 1506, 1507,
+    1504, 1508, 1504, 1507, 1509, 1510, 1511, 1450,
+    1442, 1512, 1512, 1513, 1450, 1514, 1515, 1494,
+    1494, 1498, 1514, 1516, 1517, 1518, 1519, 1520,
+    1452, 1445, 1452, 1520, 1520, 1521, 1445, 1442,
+    1445, 1521, 1521, 1512, 1442, 1522, 1497, 1496,
+    1522, 1499, 1497, 1523, 1503, 1502, 1524, 1525,
+    1526, 1524, 1527, 1525
+};
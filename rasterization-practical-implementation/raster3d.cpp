@@ -1,13 +1,18 @@
 // Copyright (C) 2012  www.scratchapixel.com
 // Distributed under the terms of the CC BY-NC-ND 4.0 License.
 // https://creativecommons.org/licenses/by-nc-nd/4.0/
-// clang++ -o raster3d.exe raster3d.cpp -O3
+// clang++ -o raster3d.exe raster3d.cpp -O3 -std=c++11 -pthread
 
 #define _USE_MATH_DEFINES 
 
 #include "geometry.h"
 #include <fstream>
 #include <chrono>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
 
 #include "cow.h"
 
@@ -108,7 +113,7 @@ const uint32_t imageWidth = 640;
 const uint32_t imageHeight = 480;
 const Matrix44f worldToCamera = {0.707107, -0.331295, 0.624695, 0, 0, 0.883452, 0.468521, 0, -0.707107, -0.331295, 0.624695, 0, -1.63871, -5.747777, -40.400412, 1};
 
-const uint32_t ntris = 3156;
+const uint32_t ntris = kCowNumTris;
 const float nearClippingPlane = 1;
 const float farClippingPLane = 1000;
 float focalLength = 20; // in mm
@@ -117,6 +122,250 @@ float focalLength = 20; // in mm
 float filmApertureWidth = 0.980;
 float filmApertureHeight = 0.735;
 
+// The image is divided into tiles. Triangles are first binned into the tiles they overlap
+// (geometry pass), then each tile is rasterized independently of the others (raster pass).
+// Since no two threads ever write to the same tile, the depth and frame buffers need no locks.
+const uint32_t tileSize = 64;
+const uint32_t ntilesX = (imageWidth + tileSize - 1) / tileSize;
+const uint32_t ntilesY = (imageHeight + tileSize - 1) / tileSize;
+
+// Edge functions are evaluated with integers. Vertices are snapped to 1/256th of a pixel, which
+// makes the edge functions exact: stepping from one pixel (or block of pixels) to the next by adding
+// a constant gives exactly the value we would get by evaluating the function from scratch. Pixels
+// lying exactly on an edge shared by two triangles are given to only one of them (top-left rule).
+const int64_t subPixelBits = 8;
+const int64_t subPixelScale = 1 << subPixelBits;
+// Triangles with vertices further than this from the screen (in pixels) are skipped, so that the
+// edge functions can't overflow.
+const float guardBand = 1 << 20;
+// Pixels are processed in blocks of 4x4 pixels, aligned in raster space.
+const uint32_t blockSize = 4;
+const uint32_t blockPixels = blockSize * blockSize;
+const uint32_t nblocksX = (imageWidth + blockSize - 1) / blockSize;
+const uint32_t nblocksY = (imageHeight + blockSize - 1) / blockSize;
+const uint32_t tileBlocks = tileSize / blockSize;
+
+// E(x, y) = a * x + b * y + c at the center of pixel (x, y). Positive inside the triangle.
+struct EdgeEquation
+{
+    int64_t a, b, c;
+    int64_t bias; // subtracted from c, 0 for top and left edges, 1 otherwise
+};
+
+// Set up the edge function of the edge going from (ax, ay) to (bx, by) (fixed-point raster coordinates).
+// This is edgeFunction() rewritten so that it only depends on the pixel coordinates.
+void setupEdge(const int64_t &ax, const int64_t &ay, const int64_t &bx, const int64_t &by, EdgeEquation &e)
+{
+    int64_t dx = bx - ax, dy = by - ay;
+    e.a = dy * subPixelScale;
+    e.b = -dx * subPixelScale;
+    e.c = (dy - dx) * (subPixelScale / 2) - ax * dy + ay * dx;
+    // The interior of the triangle is on the right of a left edge (dy > 0 in raster space) and below
+    // a top edge (horizontal edge with dx < 0). Samples on any other edge are not covered.
+    bool topLeft = (dy > 0) || (dy == 0 && dx < 0);
+    e.bias = topLeft ? 0 : 1;
+    e.c -= e.bias;
+}
+
+// Everything the raster pass needs to know about a triangle, computed once in the geometry pass.
+struct Triangle
+{
+    Vec3f v0Raster, v1Raster, v2Raster; // z contains 1/z
+    Vec2f st0, st1, st2;                // divided by z
+    Vec2f p0, p1, p2;                   // camera space x and y divided by -z
+    Vec3f n;                            // normalized face normal in camera space
+    EdgeEquation edges[3];              // edges opposite to v0, v1 and v2
+    float invArea;
+    float zMin;                         // depth of the nearest vertex (see HiZBuffer)
+    uint32_t x0, x1, y0, y1;            // pixel bounding box
+};
+
+// Hierarchical depth buffer: the largest depth of each block of pixels and of each tile. A triangle
+// whose nearest depth is larger than the largest depth of a tile is hidden in this tile and is not
+// rasterized there. The same test is done for each block the triangle overlaps. Each tile is only
+// ever accessed by the thread rasterizing it, like the depth buffer.
+struct HiZBuffer
+{
+    HiZBuffer() :
+        blockZMax(nblocksX * nblocksY, farClippingPLane),
+        tileZMax(ntilesX * ntilesY, farClippingPLane),
+        tileZMaxCount(ntilesX * ntilesY)
+    {
+        for (uint32_t i = 0; i < ntilesX * ntilesY; ++i) {
+            tileZMaxCount[i] = std::min(tileBlocks, nblocksX - (i % ntilesX) * tileBlocks) *
+                std::min(tileBlocks, nblocksY - (i / ntilesX) * tileBlocks);
+        }
+    }
+    // Update the largest depth of the block whose top-left pixel is (bx, by) after the pixel(s)
+    // holding it were overwritten, and the largest depth of the tile containing the block if needed.
+    void update(const uint32_t &bx, const uint32_t &by, const float *depthBuffer)
+    {
+        float zMax = 0;
+        for (uint32_t y = by; y < std::min(by + blockSize, imageHeight); ++y) {
+            for (uint32_t x = bx; x < std::min(bx + blockSize, imageWidth); ++x) {
+                zMax = std::max(zMax, depthBuffer[y * imageWidth + x]);
+            }
+        }
+        float &blockZ = blockZMax[(by / blockSize) * nblocksX + bx / blockSize];
+        uint32_t tile = (by / tileSize) * ntilesX + bx / tileSize;
+        float oldZMax = blockZ;
+        blockZ = zMax;
+        // depths only ever decrease: the largest depth of the tile only changes when none of its
+        // blocks has it anymore
+        if (zMax < oldZMax && oldZMax == tileZMax[tile] && --tileZMaxCount[tile] == 0) {
+            uint32_t bx0 = (bx / tileSize) * tileBlocks, by0 = (by / tileSize) * tileBlocks;
+            zMax = 0;
+            uint32_t count = 0;
+            for (uint32_t j = by0; j < std::min(by0 + tileBlocks, nblocksY); ++j) {
+                for (uint32_t i = bx0; i < std::min(bx0 + tileBlocks, nblocksX); ++i) {
+                    float z = blockZMax[j * nblocksX + i];
+                    if (z > zMax) zMax = z, count = 0;
+                    count += (z == zMax);
+                }
+            }
+            tileZMax[tile] = zMax;
+            tileZMaxCount[tile] = count;
+        }
+    }
+    std::vector<float> blockZMax;
+    std::vector<float> tileZMax;
+    std::vector<uint32_t> tileZMaxCount; // number of blocks of the tile whose largest depth is the tile's
+};
+
+// Run job(threadIndex) on nthreads threads and wait for all of them to finish.
+template<typename Job>
+void parallelRun(const uint32_t &nthreads, const Job &job)
+{
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < nthreads; ++i) threads.emplace_back(job, i);
+    job(0);
+    for (auto &thread : threads) thread.join();
+}
+
+// Compute the color of a point on a triangle given its barycentric coordinates and depth.
+Vec3<unsigned char> shadeFragment(const Triangle &tri, const float &w0, const float &w1, const float &w2, const float &z)
+{
+    Vec2f st = tri.st0 * w0 + tri.st1 * w1 + tri.st2 * w2;
+    
+    st *= z;
+    
+    float px = tri.p0.x * w0 + tri.p1.x * w1 + tri.p2.x * w2;
+    float py = tri.p0.y * w0 + tri.p1.y * w1 + tri.p2.y * w2;
+    
+    Vec3f pt(px * z, py * z, -z); // pt is in camera space
+    
+    Vec3f viewDirection = -pt;
+    viewDirection.normalize();
+    
+    float nDotView =  std::max(0.f, tri.n.dotProduct(viewDirection));
+    
+    const int M = 10;
+    float checker = (fmod(st.x * M, 1.0) > 0.5) ^ (fmod(st.y * M, 1.0) < 0.5);
+    float c = 0.3 * (1 - checker) + 0.7 * checker;
+    nDotView *= c;
+    return Vec3<unsigned char>(nDotView * 255);
+}
+
+// The visibility buffer stores, for each pixel, the index of the visible triangle and the pixel's
+// barycentric coordinates w1 and w2 in that triangle (w0 = 1 - w1 - w2). With it, the raster pass
+// only resolves visibility and each pixel is shaded once, whatever the depth complexity.
+const uint32_t noTriangle = uint32_t(-1);
+
+struct VisibilityBuffer
+{
+    uint32_t *triangleIds;
+    Vec2f *barycentrics;
+};
+
+// If visibilityBuffer is null, visible fragments are shaded right away (forward shading).
+void rasterizeTriangle(
+    const uint32_t &triIndex,
+    const Triangle &tri,
+    const uint32_t &tx0, const uint32_t &ty0, const uint32_t &tx1, const uint32_t &ty1,
+    float *depthBuffer,
+    HiZBuffer &hiZBuffer,
+    Vec3<unsigned char> *frameBuffer,
+    const VisibilityBuffer *visibilityBuffer
+)
+{
+    const Vec3f &v0Raster = tri.v0Raster, &v1Raster = tri.v1Raster, &v2Raster = tri.v2Raster;
+    const EdgeEquation *edges = tri.edges;
+
+    // clip the triangle bounding box to the tile, and align it to the block grid
+    uint32_t x0 = std::max(tri.x0, tx0) & ~(blockSize - 1);
+    uint32_t x1 = std::min(tri.x1, tx1);
+    uint32_t y0 = std::max(tri.y0, ty0) & ~(blockSize - 1);
+    uint32_t y1 = std::min(tri.y1, ty1);
+
+    // Offset of each pixel of a block relative to the block's top-left pixel, for each edge function.
+    // The edge functions being linear, their smallest and largest values over the block are found
+    // by adding the smallest and largest offsets to the value at the top-left pixel.
+    int64_t offsets[3][blockPixels], minOffset[3], maxOffset[3];
+    for (uint32_t k = 0; k < 3; ++k) {
+        for (uint32_t i = 0; i < blockPixels; ++i) {
+            offsets[k][i] = edges[k].a * (i % blockSize) + edges[k].b * (i / blockSize);
+        }
+        minOffset[k] = std::min(int64_t(0), edges[k].a * (blockSize - 1)) + std::min(int64_t(0), edges[k].b * (blockSize - 1));
+        maxOffset[k] = std::max(int64_t(0), edges[k].a * (blockSize - 1)) + std::max(int64_t(0), edges[k].b * (blockSize - 1));
+    }
+
+    int64_t eRow[3];
+    for (uint32_t k = 0; k < 3; ++k) eRow[k] = edges[k].a * x0 + edges[k].b * y0 + edges[k].c;
+
+    for (uint32_t by = y0; by <= y1; by += blockSize) {
+        int64_t e[3] = {eRow[0], eRow[1], eRow[2]};
+        for (uint32_t bx = x0; bx <= x1; bx += blockSize) {
+            // trivial reject: the block is entirely outside one of the edges
+            bool reject = (e[0] + maxOffset[0] < 0) | (e[1] + maxOffset[1] < 0) | (e[2] + maxOffset[2] < 0);
+            // trivial accept: the block is entirely inside the three edges
+            bool accept = (e[0] + minOffset[0] >= 0) & (e[1] + minOffset[1] >= 0) & (e[2] + minOffset[2] >= 0);
+            float &blockZMax = hiZBuffer.blockZMax[(by / blockSize) * nblocksX + bx / blockSize];
+            // skip the block if the triangle is behind everything drawn in it so far
+            if (!reject && tri.zMin < blockZMax) {
+                // evaluate the three edge functions for the 16 pixels of the block at once
+                int64_t w[3][blockPixels];
+                uint32_t mask = 0;
+                for (uint32_t i = 0; i < blockPixels; ++i) {
+                    w[0][i] = e[0] + offsets[0][i];
+                    w[1][i] = e[1] + offsets[1][i];
+                    w[2][i] = e[2] + offsets[2][i];
+                    uint32_t inside = accept | ((w[0][i] | w[1][i] | w[2][i]) >= 0);
+                    // pixels outside the (clipped) bounding box are masked out
+                    mask |= (inside & (bx + i % blockSize <= x1) & (by + i / blockSize <= y1)) << i;
+                }
+                // process the covered pixels only
+                bool updateHiZ = false;
+                while (mask) {
+                    uint32_t i = __builtin_ctz(mask);
+                    mask &= mask - 1;
+                    uint32_t x = bx + i % blockSize, y = by + i / blockSize;
+                    float w0 = (w[0][i] + edges[0].bias) * tri.invArea;
+                    float w1 = (w[1][i] + edges[1].bias) * tri.invArea;
+                    float w2 = (w[2][i] + edges[2].bias) * tri.invArea;
+                    float oneOverZ = v0Raster.z * w0 + v1Raster.z * w1 + v2Raster.z * w2;
+                    float z = 1 / oneOverZ;
+
+                    if (z < depthBuffer[y * imageWidth + x]) {
+                        // the largest depth of the block only changes if the pixel had it
+                        updateHiZ |= (depthBuffer[y * imageWidth + x] == blockZMax);
+                        depthBuffer[y * imageWidth + x] = z;
+                        if (visibilityBuffer) {
+                            visibilityBuffer->triangleIds[y * imageWidth + x] = triIndex;
+                            visibilityBuffer->barycentrics[y * imageWidth + x] = Vec2f(w1, w2);
+                        }
+                        else {
+                            frameBuffer[y * imageWidth + x] = shadeFragment(tri, w0, w1, w2, z);
+                        }
+                    }
+                }
+                if (updateHiZ) hiZBuffer.update(bx, by, depthBuffer);
+            }
+            for (uint32_t k = 0; k < 3; ++k) e[k] += edges[k].a * blockSize;
+        }
+        for (uint32_t k = 0; k < 3; ++k) eRow[k] += edges[k].b * blockSize;
+    }
+}
+
 int main(int argc, char **argv)
 {
     Matrix44f cameraToWorld = worldToCamera.inverse();
@@ -143,104 +392,172 @@ int main(int argc, char **argv)
 		depthBuffer[i] = farClippingPLane;
 	}
 
+    HiZBuffer hiZBuffer;
+
+    // usage: ./raster3d [nthreads] [deferred|forward]. The number of threads defaults to the number
+    // of cores. Shading is deferred (visibility buffer) unless forward is specified.
+    uint32_t nthreads = (argc > 1) ? atoi(argv[1]) : std::thread::hardware_concurrency();
+    nthreads = std::max(1u, nthreads);
+    bool deferred = (argc > 2) ? strcmp(argv[2], "forward") != 0 : true;
+
+    VisibilityBuffer visibilityBuffer;
+    visibilityBuffer.triangleIds = new uint32_t[imageWidth * imageHeight];
+    visibilityBuffer.barycentrics = new Vec2f[imageWidth * imageHeight];
+
+    for (uint32_t i = 0; i < imageWidth * imageHeight; ++i) {
+        visibilityBuffer.triangleIds[i] = noTriangle;
+    }
+
+    const uint32_t nverts = kCowNumVerts;
+    Vec3f *verticesCamera = new Vec3f[nverts];
+    Vec3f *verticesRaster = new Vec3f[nverts];
+    Triangle *triangles = new Triangle[ntris];
+    // one list of triangles per tile and per thread, so that binning doesn't need locks either
+    std::vector<std::vector<uint32_t>> bins(nthreads * ntilesX * ntilesY);
+
     auto t_start = std::chrono::high_resolution_clock::now();
-    
-    for (uint32_t i = 0; i < ntris; ++i) {
-        const Vec3f &v0 = vertices[nvertices[i * 3]];
-        const Vec3f &v1 = vertices[nvertices[i * 3 + 1]];
-        const Vec3f &v2 = vertices[nvertices[i * 3 + 2]];
-        
-        Vec3f v0Raster, v1Raster, v2Raster;
-        convertToRaster(v0, worldToCamera, l, r, t, b, nearClippingPlane, imageWidth, imageHeight, v0Raster);
-        convertToRaster(v1, worldToCamera, l, r, t, b, nearClippingPlane, imageWidth, imageHeight, v1Raster);
-        convertToRaster(v2, worldToCamera, l, r, t, b, nearClippingPlane, imageWidth, imageHeight, v2Raster);
-        
-        v0Raster.z = 1 / v0Raster.z,
-        v1Raster.z = 1 / v1Raster.z,
-        v2Raster.z = 1 / v2Raster.z;
-        
-        Vec2f st0 = st[stindices[i * 3]];
-        Vec2f st1 = st[stindices[i * 3 + 1]];
-        Vec2f st2 = st[stindices[i * 3 + 2]];
-
-        st0 *= v0Raster.z, st1 *= v1Raster.z, st2 *= v2Raster.z;
-    
-        float xmin = min3(v0Raster.x, v1Raster.x, v2Raster.x);
-        float ymin = min3(v0Raster.y, v1Raster.y, v2Raster.y);
-        float xmax = max3(v0Raster.x, v1Raster.x, v2Raster.x);
-        float ymax = max3(v0Raster.y, v1Raster.y, v2Raster.y);
-        
-        if (xmin > imageWidth - 1 || xmax < 0 || ymin > imageHeight - 1 || ymax < 0) continue;
-
-        uint32_t x0 = std::max(int32_t(0), (int32_t)(std::floor(xmin)));
-        uint32_t x1 = std::min(int32_t(imageWidth) - 1, (int32_t)(std::floor(xmax)));
-        uint32_t y0 = std::max(int32_t(0), (int32_t)(std::floor(ymin)));
-        uint32_t y1 = std::min(int32_t(imageHeight) - 1, (int32_t)(std::floor(ymax)));
-
-        float area = edgeFunction(v0Raster, v1Raster, v2Raster);
-        
-        for (uint32_t y = y0; y <= y1; ++y) {
-            for (uint32_t x = x0; x <= x1; ++x) {
-                Vec3f pixelSample(x + 0.5, y + 0.5, 0);
-                float w0 = edgeFunction(v1Raster, v2Raster, pixelSample);
-                float w1 = edgeFunction(v2Raster, v0Raster, pixelSample);
-                float w2 = edgeFunction(v0Raster, v1Raster, pixelSample);
-                if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
-                    w0 /= area;
-                    w1 /= area;
-                    w2 /= area;
-                    float oneOverZ = v0Raster.z * w0 + v1Raster.z * w1 + v2Raster.z * w2;
-                    float z = 1 / oneOverZ;
- 
-					if (z < depthBuffer[y * imageWidth + x]) {
-                        depthBuffer[y * imageWidth + x] = z;
-                        
-                        Vec2f st = st0 * w0 + st1 * w1 + st2 * w2;
-                        
-                        st *= z;
-                        
-                        Vec3f v0Cam, v1Cam, v2Cam;
-                        worldToCamera.multVecMatrix(v0, v0Cam);
-                        worldToCamera.multVecMatrix(v1, v1Cam);
-                        worldToCamera.multVecMatrix(v2, v2Cam);
-                        
-                        float px = (v0Cam.x/-v0Cam.z) * w0 + (v1Cam.x/-v1Cam.z) * w1 + (v2Cam.x/-v2Cam.z) * w2;
-                        float py = (v0Cam.y/-v0Cam.z) * w0 + (v1Cam.y/-v1Cam.z) * w1 + (v2Cam.y/-v2Cam.z) * w2;
-                        
-                        Vec3f pt(px * z, py * z, -z); // pt is in camera space
-                        
-                        Vec3f n = (v1Cam - v0Cam).crossProduct(v2Cam - v0Cam);
-                        n.normalize();
-                        Vec3f viewDirection = -pt;
-                        viewDirection.normalize();
-                        
-                        float nDotView =  std::max(0.f, n.dotProduct(viewDirection));
-                        
-                        const int M = 10;
-                        float checker = (fmod(st.x * M, 1.0) > 0.5) ^ (fmod(st.y * M, 1.0) < 0.5);
-                        float c = 0.3 * (1 - checker) + 0.7 * checker;
-                        nDotView *= c;
-                        frameBuffer[y * imageWidth + x].x = nDotView * 255;
-                        frameBuffer[y * imageWidth + x].y = nDotView * 255;
-                        frameBuffer[y * imageWidth + x].z = nDotView * 255;
+
+    // Geometry pass. Each thread transforms a contiguous range of vertices, then sets up and bins
+    // a contiguous range of triangles. Because thread i processes triangles that come before
+    // those of thread i + 1, reading the bins of a tile in thread order preserves the order in
+    // which the triangles were submitted, and the image is identical to the one we would get
+    // with a single thread.
+    parallelRun(nthreads, [&] (uint32_t threadIndex) {
+        uint32_t begin = nverts * threadIndex / nthreads, end = nverts * (threadIndex + 1) / nthreads;
+        for (uint32_t i = begin; i < end; ++i) {
+            Vec3f vertex(cowVertsX[i], cowVertsY[i], cowVertsZ[i]);
+            worldToCamera.multVecMatrix(vertex, verticesCamera[i]);
+            convertToRaster(vertex, worldToCamera, l, r, t, b, nearClippingPlane, imageWidth, imageHeight, verticesRaster[i]);
+            verticesRaster[i].z = 1 / verticesRaster[i].z;
+        }
+    });
+    parallelRun(nthreads, [&] (uint32_t threadIndex) {
+        uint32_t begin = ntris * threadIndex / nthreads, end = ntris * (threadIndex + 1) / nthreads;
+        std::vector<uint32_t> *threadBins = &bins[threadIndex * ntilesX * ntilesY];
+        for (uint32_t i = begin; i < end; ++i) {
+            Triangle &tri = triangles[i];
+            tri.v0Raster = verticesRaster[cowVertsIndex[i * 3]];
+            tri.v1Raster = verticesRaster[cowVertsIndex[i * 3 + 1]];
+            tri.v2Raster = verticesRaster[cowVertsIndex[i * 3 + 2]];
+
+            tri.st0 = Vec2f(cowStX[cowStIndex[i * 3]], cowStY[cowStIndex[i * 3]]) * tri.v0Raster.z;
+            tri.st1 = Vec2f(cowStX[cowStIndex[i * 3 + 1]], cowStY[cowStIndex[i * 3 + 1]]) * tri.v1Raster.z;
+            tri.st2 = Vec2f(cowStX[cowStIndex[i * 3 + 2]], cowStY[cowStIndex[i * 3 + 2]]) * tri.v2Raster.z;
+
+            float xmin = min3(tri.v0Raster.x, tri.v1Raster.x, tri.v2Raster.x);
+            float ymin = min3(tri.v0Raster.y, tri.v1Raster.y, tri.v2Raster.y);
+            float xmax = max3(tri.v0Raster.x, tri.v1Raster.x, tri.v2Raster.x);
+            float ymax = max3(tri.v0Raster.y, tri.v1Raster.y, tri.v2Raster.y);
+            
+            if (xmin > imageWidth - 1 || xmax < 0 || ymin > imageHeight - 1 || ymax < 0) continue;
+
+            tri.x0 = std::max(int32_t(0), (int32_t)(std::floor(xmin)));
+            tri.x1 = std::min(int32_t(imageWidth) - 1, (int32_t)(std::floor(xmax)));
+            tri.y0 = std::max(int32_t(0), (int32_t)(std::floor(ymin)));
+            tri.y1 = std::min(int32_t(imageHeight) - 1, (int32_t)(std::floor(ymax)));
+
+            if (std::max(-xmin, xmax) > guardBand || std::max(-ymin, ymax) > guardBand) continue;
+
+            // snap the vertices to the sub-pixel grid and set up the edge equations
+            int64_t fx[3], fy[3];
+            const Vec3f *v[3] = {&tri.v0Raster, &tri.v1Raster, &tri.v2Raster};
+            for (uint32_t k = 0; k < 3; ++k) {
+                fx[k] = (int64_t)std::floor(v[k]->x * subPixelScale + 0.5f);
+                fy[k] = (int64_t)std::floor(v[k]->y * subPixelScale + 0.5f);
+            }
+            int64_t area = (fx[2] - fx[0]) * (fy[1] - fy[0]) - (fy[2] - fy[0]) * (fx[1] - fx[0]);
+            // back-facing and degenerate triangles can't pass the coverage test
+            if (area <= 0) continue;
+            tri.invArea = 1.f / area;
+            setupEdge(fx[1], fy[1], fx[2], fy[2], tri.edges[0]);
+            setupEdge(fx[2], fy[2], fx[0], fy[0], tri.edges[1]);
+            setupEdge(fx[0], fy[0], fx[1], fy[1], tri.edges[2]);
+            // Because of rounding errors, the depth interpolated at a pixel can be slightly smaller
+            // than the smallest vertex depth: keep the hierarchical depth test conservative.
+            tri.zMin = 1 / max3(tri.v0Raster.z, tri.v1Raster.z, tri.v2Raster.z) * (1 - 1e-5f);
+
+            // camera space data needed for shading
+            const Vec3f &v0Cam = verticesCamera[cowVertsIndex[i * 3]];
+            const Vec3f &v1Cam = verticesCamera[cowVertsIndex[i * 3 + 1]];
+            const Vec3f &v2Cam = verticesCamera[cowVertsIndex[i * 3 + 2]];
+            tri.p0 = Vec2f(v0Cam.x / -v0Cam.z, v0Cam.y / -v0Cam.z);
+            tri.p1 = Vec2f(v1Cam.x / -v1Cam.z, v1Cam.y / -v1Cam.z);
+            tri.p2 = Vec2f(v2Cam.x / -v2Cam.z, v2Cam.y / -v2Cam.z);
+            tri.n = (v1Cam - v0Cam).crossProduct(v2Cam - v0Cam);
+            tri.n.normalize();
+
+            for (uint32_t ty = tri.y0 / tileSize; ty <= tri.y1 / tileSize; ++ty) {
+                for (uint32_t tx = tri.x0 / tileSize; tx <= tri.x1 / tileSize; ++tx) {
+                    threadBins[ty * ntilesX + tx].push_back(i);
+                }
+            }
+        }
+    });
+
+    auto t_geometry = std::chrono::high_resolution_clock::now();
+
+    // Raster pass. Threads grab the next tile to process until there are none left. Triangles
+    // hidden by what was already drawn in the tile are culled before being rasterized.
+    std::atomic<uint32_t> nextTile(0), numCulled(0), numBinned(0);
+    parallelRun(nthreads, [&] (uint32_t) {
+        uint32_t culled = 0, binned = 0;
+        for (uint32_t tile = nextTile++; tile < ntilesX * ntilesY; tile = nextTile++) {
+            uint32_t tx0 = (tile % ntilesX) * tileSize, ty0 = (tile / ntilesX) * tileSize;
+            uint32_t tx1 = std::min(tx0 + tileSize, imageWidth) - 1, ty1 = std::min(ty0 + tileSize, imageHeight) - 1;
+            for (uint32_t i = 0; i < nthreads; ++i) {
+                for (uint32_t triIndex : bins[i * ntilesX * ntilesY + tile]) {
+                    binned++;
+                    if (triangles[triIndex].zMin >= hiZBuffer.tileZMax[tile]) {
+                        culled++;
+                        continue;
                     }
+                    rasterizeTriangle(triIndex, triangles[triIndex], tx0, ty0, tx1, ty1, depthBuffer, hiZBuffer, frameBuffer,
+                        deferred ? &visibilityBuffer : nullptr);
                 }
             }
         }
+        numCulled += culled;
+        numBinned += binned;
+    });
+
+    auto t_raster = std::chrono::high_resolution_clock::now();
+
+    // Shading pass (deferred shading only). Each pixel covered by a triangle is shaded exactly once.
+    if (deferred) {
+        std::atomic<uint32_t> nextRow(0);
+        parallelRun(nthreads, [&] (uint32_t) {
+            for (uint32_t y = nextRow++; y < imageHeight; y = nextRow++) {
+                for (uint32_t x = 0; x < imageWidth; ++x) {
+                    uint32_t triIndex = visibilityBuffer.triangleIds[y * imageWidth + x];
+                    if (triIndex == noTriangle) continue;
+                    const Vec2f &w = visibilityBuffer.barycentrics[y * imageWidth + x];
+                    frameBuffer[y * imageWidth + x] = shadeFragment(triangles[triIndex], 1 - w.x - w.y, w.x, w.y, depthBuffer[y * imageWidth + x]);
+                }
+            }
+        });
     }
     
 	auto t_end = std::chrono::high_resolution_clock::now();
 	auto passedTime = std::chrono::duration<double, std::milli>(t_end - t_start).count();
-	std::cerr << "Wall passed time: " << passedTime << "ms" << std::endl;
+	std::cerr << "Geometry pass time: " << std::chrono::duration<double, std::milli>(t_geometry - t_start).count() << "ms" << std::endl;
+	std::cerr << "Raster pass time: " << std::chrono::duration<double, std::milli>(t_raster - t_geometry).count() << "ms" << std::endl;
+	std::cerr << "Hi-Z culled " << numCulled << " of " << numBinned << " binned triangles" << std::endl;
+	if (deferred) std::cerr << "Shading pass time: " << std::chrono::duration<double, std::milli>(t_end - t_raster).count() << "ms" << std::endl;
+	std::cerr << "Wall passed time: " << passedTime << "ms (" << nthreads << " threads)" << std::endl;
     
 	std::ofstream ofs;
 	ofs.open("./output.ppm", std::ios::binary);
 	ofs << "P6\n" << imageWidth << " " << imageHeight << "\n255\n";
-	ofs.write((char*)frameBuffer, imageWidth * imageWidth * 3);
+	ofs.write((char*)frameBuffer, imageWidth * imageHeight * 3);
 	ofs.close();
     
 	delete [] frameBuffer;
 	delete [] depthBuffer;
+	delete [] verticesCamera;
+	delete [] verticesRaster;
+	delete [] visibilityBuffer.triangleIds;
+	delete [] visibilityBuffer.barycentrics;
+	delete [] triangles;
     
     return 0;
-}
\ No newline at end of file
+}
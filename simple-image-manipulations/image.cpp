@@ -5,12 +5,13 @@
 // Download the image.cpp and test images (zip file) to a folder.
 // Open a shell/terminal, and run the following command where the files is saved:
 //
-// clang++ -o image image.cpp -std=c++11 -O3
+// clang++ -o image image.cpp -std=c++11 -O3 -pthread
 //
 // You can use c++ if you don't use clang++
 //
 // Run with: ./image. Open the resulting image (ppm) in Photoshop or any program
-// reading PPM files.
+// reading PPM files. You can also pass the image, the kernel and the convolution
+// method (auto, direct, fft or shift): ./image xmas.ppm star.ppm fft
 //[/compile]
 //[ignore]
 // Copyright (C) 2016  www.scratchapixel.com
@@ -32,17 +33,291 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
+#include <cstdint>
 #include <algorithm>
 #include <fstream>
 #include <cassert>
 #include <exception>
+#include <cmath>
+#include <complex>
+#include <thread>
+#include <chrono>
 
 #include <vector>
 
 // [comment]
-// The main Image class
+// Call func(i) for i in [0, count), splitting the range between the hardware threads
 // [/comment]
-class Image
+template<typename Func>
+void parallelFor(unsigned int count, const Func &func)
+{
+    unsigned int numThreads = std::max(1u, std::min(count, std::thread::hardware_concurrency()));
+    if (numThreads == 1) {
+        for (unsigned int i = 0; i < count; ++i) func(i);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (unsigned int i = count * t / numThreads; i < count * (t + 1) / numThreads; ++i) func(i);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+}
+
+// [comment]
+// A complex FFT of any size, with the mixed-radix Cooley-Tukey algorithm (decimation in time).
+// The size is factored into 4s, 2s and then odd factors: radix 2 and 4 have their own butterfly,
+// the other factors use a generic (O(p^2)) one. This is the structure of KISS FFT. The
+// transforms are not normalized: the inverse transform of the forward transform of a signal is
+// the signal times n.
+// [/comment]
+class FFT
+{
+public:
+    typedef std::complex<float> Complex;
+    FFT(const unsigned int &_n, bool _inverse) : n(_n), inverse(_inverse), twiddles(_n)
+    {
+        double sign = inverse ? 1 : -1;
+        for (unsigned int i = 0; i < n; ++i) {
+            double phase = sign * 2 * M_PI * i / n;
+            twiddles[i] = Complex(cos(phase), sin(phase));
+        }
+        unsigned int m = n, p = 4;
+        while (m > 1) {
+            while (m % p) {
+                switch (p) {
+                    case 4: p = 2; break;
+                    case 2: p = 3; break;
+                    default: p += 2; break;
+                }
+                if (p * p > m) p = m; // no factor left below sqrt(m): m is prime
+            }
+            m /= p;
+            factors.push_back(p);
+            factors.push_back(m);
+        }
+        // the transform of a single value is the value itself
+        if (n == 1) factors = {1, 1};
+    }
+    // [comment]
+    // Transform the n values of in (stride apart) into out (contiguous). scratch holds at least
+    // as many values as the largest factor of n.
+    // [/comment]
+    void transform(const Complex *in, unsigned int stride, Complex *out, Complex *scratch) const
+    { work(out, in, 1, stride, 0, scratch); }
+    unsigned int maxFactor() const
+    {
+        unsigned int p = 1;
+        for (size_t i = 0; i < factors.size(); i += 2) p = std::max(p, factors[i]);
+        return p;
+    }
+    unsigned int n;
+    bool inverse;
+private:
+    void work(Complex *out, const Complex *in, unsigned int fstride, unsigned int stride, unsigned int f, Complex *scratch) const
+    {
+        const unsigned int p = factors[f], m = factors[f + 1];
+        Complex *outEnd = out + p * m;
+        if (m == 1) {
+            for (Complex *o = out; o != outEnd; ++o, in += fstride * stride) *o = *in;
+        }
+        else {
+            // p transforms of size m, of the values m * fstride apart
+            for (Complex *o = out; o != outEnd; o += m, in += fstride * stride)
+                work(o, in, fstride * p, stride, f + 2, scratch);
+        }
+        switch (p) {
+            case 2: butterfly2(out, fstride, m); break;
+            case 4: butterfly4(out, fstride, m); break;
+            default: butterflyGeneric(out, fstride, m, p, scratch); break;
+        }
+    }
+    void butterfly2(Complex *out, unsigned int fstride, unsigned int m) const
+    {
+        for (unsigned int k = 0; k < m; ++k) {
+            Complex t = out[k + m] * twiddles[k * fstride];
+            out[k + m] = out[k] - t;
+            out[k] += t;
+        }
+    }
+    void butterfly4(Complex *out, unsigned int fstride, unsigned int m) const
+    {
+        for (unsigned int k = 0; k < m; ++k) {
+            Complex s0 = out[k + m] * twiddles[k * fstride];
+            Complex s1 = out[k + 2 * m] * twiddles[2 * k * fstride];
+            Complex s2 = out[k + 3 * m] * twiddles[3 * k * fstride];
+            Complex s5 = out[k] - s1;
+            out[k] += s1;
+            Complex s3 = s0 + s2, s4 = s0 - s2;
+            out[k + 2 * m] = out[k] - s3;
+            out[k] += s3;
+            // s4 times -i (forward) or i (inverse)
+            Complex s4i = inverse ? Complex(-s4.imag(), s4.real()) : Complex(s4.imag(), -s4.real());
+            out[k + m] = s5 + s4i;
+            out[k + 3 * m] = s5 - s4i;
+        }
+    }
+    void butterflyGeneric(Complex *out, unsigned int fstride, unsigned int m, unsigned int p, Complex *scratch) const
+    {
+        for (unsigned int u = 0; u < m; ++u) {
+            for (unsigned int q = 0, k = u; q < p; ++q, k += m) scratch[q] = out[k];
+            for (unsigned int q1 = 0, k = u; q1 < p; ++q1, k += m) {
+                unsigned int twiddle = 0;
+                out[k] = scratch[0];
+                for (unsigned int q = 1; q < p; ++q) {
+                    twiddle += fstride * k;
+                    if (twiddle >= n) twiddle -= n;
+                    out[k] += scratch[q] * twiddles[twiddle];
+                }
+            }
+        }
+    }
+    std::vector<Complex> twiddles;
+    std::vector<unsigned int> factors; // pairs of (radix, size of the sub-transforms)
+};
+
+// [comment]
+// How the channels of the pixels are arranged in memory: interleaved (r g b r g b ..., the way
+// the PPM format stores them) or planar (all the red values of the image, then all the green
+// values, then all the blue values). With the planar layout each channel of a row is a
+// contiguous array of floats, which is what SIMD instructions want.
+// [/comment]
+enum ImageLayout { kInterleaved, kPlanar };
+
+// [comment]
+// A w x h RGB image in memory that the view doesn't own. The value of channel c of the pixel
+// (x, y) is at data[y * rowStride + c * planeStride + x * kPixelStride]: sub-images and rows of
+// an image are views of the same memory, nothing is copied.
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageView
+{
+public:
+    static const unsigned int kNumChannels = 3;
+    static const unsigned int kPixelStride = (layout == kInterleaved) ? kNumChannels : 1;
+    ImageView() : w(0), h(0), rowStride(0), planeStride(0), data(nullptr) {}
+    ImageView(T *_data, const unsigned int &_w, const unsigned int &_h, const size_t &_rowStride, const size_t &_planeStride) :
+        w(_w), h(_h), rowStride(_rowStride), planeStride(_planeStride), data(_data) {}
+    T& operator () (const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    {
+        assert(x < w && y < h && c < kNumChannels);
+        return data[y * rowStride + c * planeStride + x * kPixelStride];
+    }
+    // the values of channel c along row y, kPixelStride apart
+    T* scanline(const unsigned int &y, const unsigned int &c = 0) const
+    { return data + y * rowStride + c * planeStride; }
+    ImageView view(const unsigned int &x, const unsigned int &y, const unsigned int &_w, const unsigned int &_h) const
+    {
+        assert(x + _w <= w && y + _h <= h);
+        return ImageView(data + y * rowStride + x * kPixelStride, _w, _h, rowStride, planeStride);
+    }
+    ImageView rowView(const unsigned int &y) const { return view(0, y, w, 1); }
+    // set every pixel to values (one value per channel)
+    void fill(const T *values) const
+    {
+        for (unsigned int y = 0; y < h; ++y) {
+            for (unsigned int c = 0; c < kNumChannels; ++c) {
+                T *row = scanline(y, c);
+                for (unsigned int x = 0; x < w; ++x) row[x * kPixelStride] = values[c];
+            }
+        }
+    }
+    unsigned int w, h;
+    size_t rowStride, planeStride; // in number of values
+    T *data;
+};
+
+// [comment]
+// An image that owns its pixels. Every row (of every plane with the planar layout) starts on a
+// 64-byte boundary, the size of a cache line and of an AVX-512 register: rows are padded to a
+// multiple of 64 bytes, which is why the distance between rows (the stride) can be larger than
+// the width. Copying an image is expensive, so images can be moved but not copied (copy() makes
+// a copy explicitly).
+// [/comment]
+template<typename T, ImageLayout layout>
+class ImageBuffer : public ImageView<T, layout>
+{
+public:
+    static const size_t kAlignment = 64;
+    ImageBuffer() : memory(nullptr) {}
+    ImageBuffer(const unsigned int &_w, const unsigned int &_h) : memory(nullptr)
+    {
+        const unsigned int numChannels = ImageView<T, layout>::kNumChannels;
+        const size_t valuesPerLine = kAlignment / sizeof(T);
+        size_t rowSize = (layout == kInterleaved) ? _w * numChannels : _w;
+        rowSize = (rowSize + valuesPerLine - 1) / valuesPerLine * valuesPerLine;
+        size_t size = rowSize * _h * ((layout == kInterleaved) ? 1 : numChannels);
+        memory = new char[size * sizeof(T) + kAlignment - 1]; // this throws an exception if bad_alloc
+        T *data = reinterpret_cast<T *>((reinterpret_cast<uintptr_t>(memory) + kAlignment - 1) & ~(uintptr_t)(kAlignment - 1));
+        std::fill(data, data + size, T(0));
+        static_cast<ImageView<T, layout> &>(*this) =
+            ImageView<T, layout>(data, _w, _h, rowSize, (layout == kInterleaved) ? 1 : rowSize * _h);
+    }
+    ImageBuffer(const ImageBuffer &) = delete;
+    ImageBuffer& operator = (const ImageBuffer &) = delete;
+    ImageBuffer(ImageBuffer &&img) : ImageView<T, layout>(img), memory(img.memory)
+    {
+        img.memory = nullptr;
+        static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
+    }
+    ImageBuffer& operator = (ImageBuffer &&img)
+    {
+        if (this != &img) {
+            delete [] memory;
+            static_cast<ImageView<T, layout> &>(*this) = img;
+            memory = img.memory;
+            img.memory = nullptr;
+            static_cast<ImageView<T, layout> &>(img) = ImageView<T, layout>();
+        }
+        return *this;
+    }
+    ~ImageBuffer() { delete [] memory; }
+    ImageBuffer copy() const
+    {
+        ImageBuffer img(this->w, this->h);
+        size_t size = this->rowStride * this->h * ((layout == kInterleaved) ? 1 : ImageView<T, layout>::kNumChannels);
+        std::copy(this->data, this->data + size, img.data);
+        return img;
+    }
+private:
+    char *memory;
+};
+
+class Image;
+template<typename E> class ImageShiftExpr;
+
+// [comment]
+// Base class of the image expressions (expression templates): the arithmetic operators on
+// images don't compute anything, they return an object that describes the operation (the
+// operands and the operator), and the whole expression is evaluated in a single loop when it is
+// assigned to an image (with =, +=, *= or the Image constructor). So K += c * circshift(I, s)
+// reads I and K and writes K once, without any temporary image. Each expression E provides:
+//
+// - width() and height(),
+// - runEnd(x): the pixels of a row from x to runEnd(x) (excluded) are read from contiguous
+//   memory (a shifted image wraps around at some point along the row),
+// - row(x, y, c): a cursor (of type E::Row) whose element i is the value of the channel c of
+//   the pixel (x + i, y), for x + i < runEnd(x),
+// - aliases(img): whether the expression reads img at other pixels than the one it computes
+//   (in that case the expression can't be evaluated in img directly).
+//
+// Evaluating run by run and channel by channel, with cursors that are pointers in the end, rather
+// than pixel by pixel with (x, y) coordinates, is what lets the compiler vectorize the loop: each
+// channel of a row is a contiguous array of floats in a planar image.
+// [/comment]
+template<typename E>
+class ImageExpr
+{
+public:
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+// [comment]
+// The main Image class. The pixels are stored with the planar layout: the expressions and the
+// convolutions work one channel at a time on contiguous floats.
+// [/comment]
+class Image : public ImageExpr<Image>, public ImageBuffer<float, kPlanar>
 {
 public:
     
@@ -54,101 +329,336 @@ public:
         bool operator != (const Rgb &c) const { return c.r != r && c.g != g && c.b != b; }
         Rgb& operator *= (const Rgb &rgb) { r *= rgb.r, g *= rgb.g, b *= rgb.b; return *this; }
         Rgb& operator += (const Rgb &rgb) { r += rgb.r, g += rgb.g, b += rgb.b; return *this; }
+        friend Rgb operator * (const Rgb &a, const Rgb &b) { return Rgb(a.r * b.r, a.g * b.g, a.b * b.b); }
+        friend Rgb operator + (const Rgb &a, const Rgb &b) { return Rgb(a.r + b.r, a.g + b.g, a.b + b.b); }
+        friend Rgb operator - (const Rgb &a, const Rgb &b) { return Rgb(a.r - b.r, a.g - b.g, a.b - b.b); }
         friend float& operator += (float &f, const Rgb rgb)
         { f += (rgb.r + rgb.g + rgb.b) / 3.f; return f; }
+        float operator [] (const unsigned int &c) const { return (c == 0) ? r : ((c == 1) ? g : b); }
         float r, g, b;
     };
     
-    Image() : w(0), h(0), pixels(nullptr)
-    { /* empty image */ }
+    Image() { /* empty image */ }
 
-    Image(const unsigned int &_w, const unsigned int &_h, const Rgb &c = kBlack) :
-        w(_w), h(_h), pixels(nullptr)
+    Image(const unsigned int &_w, const unsigned int &_h, const Rgb &c = kBlack) : ImageBuffer<float, kPlanar>(_w, _h)
     {
-        pixels = new Rgb[w * h];
-        for (int i = 0; i < w * h; ++i) pixels[i] = c;
+        const float values[3] = {c.r, c.g, c.b};
+        fill(values);
     }
-    Image(const Image &img) : w(img.w), h(img.h), pixels(nullptr)
+    // images can be moved but not copied (see ImageBuffer)
+    Image(Image &&img) = default;
+    Image& operator = (Image &&img) = default;
+    using ImageBuffer<float, kPlanar>::operator ();
+    Rgb operator () (const unsigned &x, const unsigned int &y) const
+    { return Rgb((*this)(x, y, 0), (*this)(x, y, 1), (*this)(x, y, 2)); }
+    // evaluate an image expression
+    template<typename E>
+    Image(const ImageExpr<E> &expr) : ImageBuffer<float, kPlanar>(expr.self().width(), expr.self().height())
     {
-        pixels = new Rgb[w * h];
-        memcpy(pixels, img.pixels, sizeof(Rgb) * w * h);
+        evaluate(expr.self(), [](float &p, const float &v) { p = v; });
     }
-    // move constructor
-    Image(Image &&img) : w(0), h(0), pixels(nullptr)
+    template<typename E>
+    Image& operator = (const ImageExpr<E> &expr)
     {
-        w = img.w;
-        h = img.h;
-        pixels = img.pixels;
-        img.pixels = nullptr;
-        img.w = img.h = 0;
+        if (expr.self().aliases(*this) || expr.self().width() != w || expr.self().height() != h)
+            return *this = Image(expr);
+        evaluate(expr.self(), [](float &p, const float &v) { p = v; });
+        return *this;
     }
-    // move assignment operator
-    Image& operator = (Image &&img)
+    Image& operator *= (const Rgb &rgb)
     {
-        if (this != &img) {
-            if (pixels != nullptr) delete [] pixels;
-            w = img.w, h = img.h;
-            pixels = img.pixels;
-            img.pixels = nullptr;
-            img.w = img.h = 0;
+        const float values[3] = {rgb.r, rgb.g, rgb.b};
+        for (unsigned int y = 0; y < h; ++y) {
+            for (unsigned int c = 0; c < 3; ++c) {
+                float *row = scanline(y, c);
+                for (unsigned int x = 0; x < w; ++x) row[x] *= values[c];
+            }
         }
         return *this;
     }
-    Rgb& operator () (const unsigned &x, const unsigned int &y) const
+    template<typename E>
+    Image& operator *= (const ImageExpr<E> &expr)
     {
-        assert(x < w && y < h);
-        return pixels[y * w + x];
+        if (expr.self().aliases(*this)) return *this *= Image(expr);
+        evaluate(expr.self(), [](float &p, const float &v) { p *= v; });
+        return *this;
     }
-    Image& operator *= (const Rgb &rgb)
+    template<typename E>
+    Image& operator += (const ImageExpr<E> &expr)
     {
-        for (int i = 0; i < w * h; ++i) pixels[i] *= rgb;
+        if (expr.self().aliases(*this)) return *this += Image(expr);
+        evaluate(expr.self(), [](float &p, const float &v) { p += v; });
         return *this;
     }
-    Image& operator += (const Image &img)
+    Image& operator /= (const float &div) { return *this *= Rgb(1 / div); }
+    // [comment]
+    // The image shifted by (shift.first, shift.second) pixels, wrapping around the edges. This is
+    // an expression: nothing is copied until it's assigned to an image.
+    // [/comment]
+    template<typename E>
+    static ImageShiftExpr<E> circshift(const ImageExpr<E> &img, const std::pair<int,int> &shift)
+    { return ImageShiftExpr<E>(img.self(), shift); }
+    unsigned int width() const { return w; }
+    unsigned int height() const { return h; }
+    struct Row
     {
-        for (int i = 0; i < w * h; ++i) pixels[i] += img[i];
-        return *this;
+        float operator [] (const unsigned int &i) const { return p[i]; }
+        const float *p;
+    };
+    unsigned int runEnd(const unsigned int &) const { return w; }
+    Row row(const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    { return Row{scanline(y, c) + x}; }
+    bool aliases(const Image &) const { return false; } // reads (x, y) only
+    // [comment]
+    // Circular convolution of img by kernel: the result is the sum, over the kernel pixels
+    // (i, j), of kernel(i, j) * circshift(img, (i, j)). The kernel can be of any size (it wraps
+    // around the image). The direct method loops over the non-black kernel pixels and costs
+    // O(w * h * taps). The FFT method multiplies the spectra of the image and of the kernel and
+    // costs O(w * h * log(w * h)) whatever the kernel. kConvolutionAuto picks the cheapest.
+    // [/comment]
+    enum ConvolutionMethod { kConvolutionAuto, kConvolutionDirect, kConvolutionFFT };
+    static Image convolve(const Image &img, const Image &kernel, ConvolutionMethod method = kConvolutionAuto)
+    {
+        struct Tap { unsigned int x, y; Rgb c; };
+        std::vector<Tap> taps;
+        for (unsigned int j = 0; j < kernel.h; ++j) {
+            for (unsigned int i = 0; i < kernel.w; ++i) {
+                Rgb c = kernel(i, j);
+                if (c.r != 0 || c.g != 0 || c.b != 0) taps.push_back({i % img.w, j % img.h, c});
+            }
+        }
+        if (method == kConvolutionAuto) {
+            // [comment]
+            // The FFT method does 5 2D transforms of O(log(w * h)) per pixel, the direct method
+            // 6 flops per tap per pixel. The constant was measured on the 400x304 test images
+            // (both methods take about 60 ms with a kernel of 270 pixels).
+            // [/comment]
+            method = (taps.size() < 16 * std::log2(float(img.w) * img.h)) ? kConvolutionDirect : kConvolutionFFT;
+        }
+        return (method == kConvolutionDirect) ? convolveDirect(img, taps) : convolveFFT(img, taps);
     }
-    Image& operator /= (const float &div)
+    static const Rgb kBlack, kWhite, kRed, kGreen, kBlue;
+private:
+    // [comment]
+    // The single loop in which expressions are evaluated: op(pixel, value) for each pixel and
+    // each channel, run by run (see ImageExpr). A run of a channel has one destination, which
+    // keeps the number of aliasing checks the compiler adds before vectorizing the loop small.
+    // [/comment]
+    template<typename E, typename Op>
+    void evaluate(const E &expr, const Op &op)
     {
-        float invDiv = 1 / div;
-        for (int i = 0; i < w * h; ++i) pixels[i] *= invDiv;
-        return *this;
+        assert(expr.width() == w && expr.height() == h);
+        for (unsigned int y = 0; y < h; ++y) {
+            for (unsigned int x = 0, end; x < w; x = end) {
+                end = expr.runEnd(x);
+                for (unsigned int c = 0; c < 3; ++c) {
+                    typename E::Row src = expr.row(x, y, c);
+                    float *dst = scanline(y, c) + x;
+                    for (unsigned int i = 0; i < end - x; ++i) op(dst[i], src[i]);
+                }
+            }
+        }
     }
-    friend Image operator * (const Rgb &rgb, const Image &img)
+    template<typename Tap>
+    static Image convolveDirect(const Image &img, const std::vector<Tap> &taps)
     {
-        Image tmp(img); 
-        tmp *= rgb;
-        return tmp;
+        Image out(img.w, img.h);
+        const unsigned int w = img.w, h = img.h;
+        // each output row gathers the image rows the taps shift onto it, no temporary image
+        parallelFor(h, [&](unsigned int y) {
+            for (const Tap &tap : taps) {
+                const float values[3] = {tap.c.r, tap.c.g, tap.c.b};
+                for (unsigned int c = 0; c < 3; ++c) {
+                    float *dst = out.scanline(y, c);
+                    const float *src = img.scanline((y + h - tap.y) % h, c);
+                    // dst[x] += value * src[x - tap.x] (mod w), in two runs to avoid the modulo
+                    for (unsigned int x = 0; x < tap.x; ++x) dst[x] += values[c] * src[x + w - tap.x];
+                    for (unsigned int x = tap.x; x < w; ++x) dst[x] += values[c] * src[x - tap.x];
+                }
+            }
+        });
+        return out;
     }
-    Image operator * (const Image &img)
+    // [comment]
+    // 2D FFT of the w * h values of data, in place: the rows and then the columns (each one
+    // copied to a contiguous buffer) are transformed in parallel.
+    // [/comment]
+    static void fft2D(std::vector<FFT::Complex> &data, const FFT &rowFFT, const FFT &columnFFT)
     {
-        Image tmp(*this); 
-        // multiply pixels together
-        for (int i = 0; i < w * h; ++i) tmp[i] *= img[i];
-        return tmp;
+        const unsigned int w = rowFFT.n, h = columnFFT.n;
+        const unsigned int scratchSize = std::max(rowFFT.maxFactor(), columnFFT.maxFactor());
+        parallelFor(h, [&](unsigned int y) {
+            std::vector<FFT::Complex> row(w), scratch(scratchSize);
+            rowFFT.transform(&data[y * w], 1, row.data(), scratch.data());
+            std::copy(row.begin(), row.end(), data.begin() + y * w);
+        });
+        parallelFor(w, [&](unsigned int x) {
+            std::vector<FFT::Complex> column(h), scratch(scratchSize);
+            columnFFT.transform(&data[x], w, column.data(), scratch.data());
+            for (unsigned int y = 0; y < h; ++y) data[y * w + x] = column[y];
+        });
     }
-    static Image circshift(const Image &img, const std::pair<int,int> &shift)
+    // [comment]
+    // All the signals are real, which lets us transform them two at a time: the transform of
+    // a + ib is A + iB, and since the transform of a real signal is conjugate-symmetric
+    // (A[-k] = conj(A[k])), A[k] = (Z[k] + conj(Z[-k])) / 2 and B[k] = (Z[k] - conj(Z[-k])) / 2i.
+    // Each channel of the image is transformed with the same channel of the kernel, and the
+    // inverse transforms of the red and green products are done together (their results are
+    // real, so they end up in the real and imaginary parts): 5 2D transforms instead of 9.
+    // [/comment]
+    template<typename Tap>
+    static Image convolveFFT(const Image &img, const std::vector<Tap> &taps)
     {
-        Image tmp(img.w, img.h);
-        int w = img.w, h = img.h;
-        for (int j = 0; j < h; ++j) {
-            int jmod = (j + shift.second) % h;
-            for (int i = 0; i < w; ++i) {
-                int imod = (i + shift.first) % w;
-                tmp[jmod * w + imod] = img[j * w + i];
-            }    
+        typedef FFT::Complex Complex;
+        const unsigned int w = img.w, h = img.h;
+        FFT rowFFT(w, false), columnFFT(h, false), rowIFFT(w, true), columnIFFT(h, true);
+        std::vector<Complex> Z(w * h), products[3];
+        float Rgb::*channels[3] = {&Rgb::r, &Rgb::g, &Rgb::b};
+        for (unsigned int c = 0; c < 3; ++c) {
+            for (unsigned int y = 0; y < h; ++y) {
+                const float *row = img.scanline(y, c);
+                for (unsigned int x = 0; x < w; ++x) Z[y * w + x] = row[x];
+            }
+            for (const Tap &tap : taps) Z[tap.y * w + tap.x] += Complex(0, tap.c.*channels[c]);
+            fft2D(Z, rowFFT, columnFFT);
+            // I[k] * K[k] = (Z[k]^2 - conj(Z[-k])^2) / 4i
+            products[c].resize(w * h);
+            for (unsigned int y = 0; y < h; ++y) {
+                for (unsigned int x = 0; x < w; ++x) {
+                    Complex a = Z[y * w + x], b = std::conj(Z[((h - y) % h) * w + (w - x) % w]);
+                    Complex d = (a * a - b * b) * 0.25f;
+                    products[c][y * w + x] = Complex(d.imag(), -d.real());
+                }
+            }
         }
-        return tmp;
+        for (unsigned int i = 0; i < w * h; ++i) products[0][i] += Complex(0, 1) * products[1][i];
+        fft2D(products[0], rowIFFT, columnIFFT);
+        fft2D(products[2], rowIFFT, columnIFFT);
+        Image out(w, h);
+        float scale = 1.f / (w * h);
+        for (unsigned int y = 0; y < h; ++y) {
+            float *r = out.scanline(y, 0), *g = out.scanline(y, 1), *b = out.scanline(y, 2);
+            for (unsigned int x = 0; x < w; ++x) {
+                r[x] = products[0][y * w + x].real() * scale;
+                g[x] = products[0][y * w + x].imag() * scale;
+                b[x] = products[2][y * w + x].real() * scale;
+            }
+        }
+        return out;
     }
-    const Rgb& operator [] (const unsigned int &i) const { return pixels[i]; }
-    Rgb& operator [] (const unsigned int &i) { return pixels[i]; }
-    ~Image() { if (pixels != nullptr) delete [] pixels; }
-    unsigned int w, h;
-    Rgb *pixels;
-    static const Rgb kBlack, kWhite, kRed, kGreen, kBlue;
 };
 
+// [comment]
+// Images are referenced by the expressions that use them, the expressions themselves (which are
+// temporaries) are copied
+// [/comment]
+template<typename E> struct ImageOperand { typedef const E type; };
+template<> struct ImageOperand<Image> { typedef const Image &type; };
+
+struct ImageMul { static float apply(const float &a, const float &b) { return a * b; } };
+struct ImageAdd { static float apply(const float &a, const float &b) { return a + b; } };
+struct ImageSub { static float apply(const float &a, const float &b) { return a - b; } };
+
+template<typename L, typename R, typename Op>
+class ImageBinaryExpr : public ImageExpr<ImageBinaryExpr<L, R, Op>>
+{
+public:
+    struct Row
+    {
+        float operator [] (const unsigned int &i) const { return Op::apply(l[i], r[i]); }
+        typename L::Row l;
+        typename R::Row r;
+    };
+    ImageBinaryExpr(const L &l, const R &r) : lhs(l), rhs(r)
+    { assert(l.width() == r.width() && l.height() == r.height()); }
+    unsigned int width() const { return lhs.width(); }
+    unsigned int height() const { return lhs.height(); }
+    unsigned int runEnd(const unsigned int &x) const { return std::min(lhs.runEnd(x), rhs.runEnd(x)); }
+    Row row(const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    { return Row{lhs.row(x, y, c), rhs.row(x, y, c)}; }
+    bool aliases(const Image &img) const { return lhs.aliases(img) || rhs.aliases(img); }
+private:
+    typename ImageOperand<L>::type lhs;
+    typename ImageOperand<R>::type rhs;
+};
+
+template<typename E>
+class ImageScaleExpr : public ImageExpr<ImageScaleExpr<E>>
+{
+public:
+    struct Row
+    {
+        float operator [] (const unsigned int &i) const { return s * e[i]; }
+        float s;
+        typename E::Row e;
+    };
+    ImageScaleExpr(const Image::Rgb &c, const E &e) : rgb(c), expr(e) {}
+    unsigned int width() const { return expr.width(); }
+    unsigned int height() const { return expr.height(); }
+    unsigned int runEnd(const unsigned int &x) const { return expr.runEnd(x); }
+    Row row(const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    { return Row{rgb[c], expr.row(x, y, c)}; }
+    bool aliases(const Image &img) const { return expr.aliases(img); }
+private:
+    Image::Rgb rgb;
+    typename ImageOperand<E>::type expr;
+};
+
+template<typename E>
+class ImageShiftExpr : public ImageExpr<ImageShiftExpr<E>>
+{
+public:
+    ImageShiftExpr(const E &e, const std::pair<int,int> &shift) : expr(e)
+    {
+        // pixel (x, y) comes from (x - shift.first, y - shift.second)
+        int w = e.width(), h = e.height();
+        sx = ((shift.first % w) + w) % w;
+        sy = ((shift.second % h) + h) % h;
+    }
+    typedef typename E::Row Row;
+    unsigned int width() const { return expr.width(); }
+    unsigned int height() const { return expr.height(); }
+    // the source pixels are contiguous up to the point where they wrap around
+    unsigned int runEnd(const unsigned int &x) const
+    {
+        unsigned int src = sourceX(x);
+        return std::min(x < sx ? sx : expr.width(), x + expr.runEnd(src) - src);
+    }
+    Row row(const unsigned int &x, const unsigned int &y, const unsigned int &c) const
+    { return expr.row(sourceX(x), y >= sy ? y - sy : y + expr.height() - sy, c); }
+    bool aliases(const Image &img) const { return reads(expr, img); }
+private:
+    static bool reads(const Image &src, const Image &img) { return &src == &img; }
+    template<typename S> static bool reads(const S &src, const Image &img) { return src.aliases(img); }
+    unsigned int sourceX(const unsigned int &x) const { return x >= sx ? x - sx : x + expr.width() - sx; }
+    typename ImageOperand<E>::type expr;
+    unsigned int sx, sy;
+};
+
+template<typename L, typename R>
+ImageBinaryExpr<L, R, ImageMul> operator * (const ImageExpr<L> &l, const ImageExpr<R> &r)
+{ return ImageBinaryExpr<L, R, ImageMul>(l.self(), r.self()); }
+
+template<typename L, typename R>
+ImageBinaryExpr<L, R, ImageAdd> operator + (const ImageExpr<L> &l, const ImageExpr<R> &r)
+{ return ImageBinaryExpr<L, R, ImageAdd>(l.self(), r.self()); }
+
+template<typename L, typename R>
+ImageBinaryExpr<L, R, ImageSub> operator - (const ImageExpr<L> &l, const ImageExpr<R> &r)
+{ return ImageBinaryExpr<L, R, ImageSub>(l.self(), r.self()); }
+
+template<typename E>
+ImageScaleExpr<E> operator * (const Image::Rgb &rgb, const ImageExpr<E> &e)
+{ return ImageScaleExpr<E>(rgb, e.self()); }
+
+template<typename E>
+ImageScaleExpr<E> operator * (const ImageExpr<E> &e, const Image::Rgb &rgb)
+{ return ImageScaleExpr<E>(rgb, e.self()); }
+
+template<typename E>
+ImageScaleExpr<E> operator / (const ImageExpr<E> &e, const float &div)
+{ return ImageScaleExpr<E>(1 / div, e.self()); }
+
 const Image::Rgb Image::kBlack = Image::Rgb(0);
 const Image::Rgb Image::kWhite = Image::Rgb(1);
 const Image::Rgb Image::kRed = Image::Rgb(1,0,0);
@@ -166,13 +676,15 @@ void savePPM(const Image &img, const char *filename)
         ofs.open(filename, std::ios::binary); // need to spec. binary mode for Windows users
         if (ofs.fail()) throw("Can't open output file");
         ofs << "P6\n" << img.w << " " << img.h << "\n255\n";
-        unsigned char r, g, b;
-        // loop over each pixel in the image, clamp and convert to byte format
-        for (int i = 0; i < img.w * img.h; ++i) {
-            r = static_cast<unsigned char>(std::min(1.f, img.pixels[i].r) * 255);
-            g = static_cast<unsigned char>(std::min(1.f, img.pixels[i].g) * 255);
-            b = static_cast<unsigned char>(std::min(1.f, img.pixels[i].b) * 255);
-            ofs << r << g << b;
+        std::vector<unsigned char> bytes(img.w * 3);
+        // loop over each row of the image, clamp and convert to byte format
+        for (unsigned int y = 0; y < img.h; ++y) {
+            for (unsigned int c = 0; c < 3; ++c) {
+                const float *row = img.scanline(y, c);
+                for (unsigned int x = 0; x < img.w; ++x)
+                    bytes[x * 3 + c] = static_cast<unsigned char>(std::min(1.f, row[x]) * 255);
+            }
+            ofs.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
         }
         ofs.close();
     }
@@ -197,23 +709,22 @@ Image readPPM(const char *filename)
         ifs >> header;
         if (strcmp(header.c_str(), "P6") != 0) throw("Can't read input file");
         ifs >> w >> h >> b;
-        img.w = w; img.h = h;
-        img.pixels = new Image::Rgb[w * h]; // this is throw an exception if bad_alloc
+        img = Image(w, h); // this is throw an exception if bad_alloc
         ifs.ignore(256, '\n'); // skip empty lines in necessary until we get to the binary data
-        unsigned char pix[3];
-        // read each pixel one by one and convert bytes to floats
-        for (int i = 0; i < w * h; ++i) {
-            ifs.read(reinterpret_cast<char *>(pix), 3);
-            img.pixels[i].r = pix[0] / 255.f;
-            img.pixels[i].g = pix[1] / 255.f;
-            img.pixels[i].b = pix[2] / 255.f;
-            
-            // [comment]
-            // This is just to make the bokeh effect more visible, book high value pixels brightness
-            // [/comment]
-            if (img.pixels[i].r > 0.7) img.pixels[i].r *= 3;
-            if (img.pixels[i].g > 0.7) img.pixels[i].g *= 3;
-            if (img.pixels[i].b > 0.7) img.pixels[i].b *= 3;
+        std::vector<unsigned char> bytes(w * 3);
+        // read the image row by row and convert bytes to floats
+        for (int y = 0; y < h; ++y) {
+            ifs.read(reinterpret_cast<char *>(bytes.data()), bytes.size());
+            for (unsigned int c = 0; c < 3; ++c) {
+                float *row = img.scanline(y, c);
+                for (int x = 0; x < w; ++x) {
+                    row[x] = bytes[x * 3 + c] / 255.f;
+                    // [comment]
+                    // This is just to make the bokeh effect more visible, book high value pixels brightness
+                    // [/comment]
+                    if (row[x] > 0.7) row[x] *= 3;
+                }
+            }
         }
         ifs.close();
     }
@@ -231,19 +742,35 @@ Image readPPM(const char *filename)
 int main(int argc, char **argv)
 {
     try {
-        Image I = readPPM("./xmas.ppm");
-        Image J = readPPM("./heart.ppm");
-        int w = J.w, h = J.h;
-        Image K(w, h);
-        float total = 0;
-        for (int j = 0; j < h; ++j) {
-            for (int i = 0; i < w; ++i) {
-                if (J(i, j) != Image::kBlack) {
-                    K += J(i, j) * Image::circshift(I, std::pair<int, int>(i, j));
-                    total += J(i, j);
+        Image I = readPPM(argc > 1 ? argv[1] : "./xmas.ppm");
+        Image J = readPPM(argc > 2 ? argv[2] : "./heart.ppm");
+        Image::ConvolutionMethod method = Image::kConvolutionAuto;
+        if (argc > 3 && !strcmp(argv[3], "direct")) method = Image::kConvolutionDirect;
+        if (argc > 3 && !strcmp(argv[3], "fft")) method = Image::kConvolutionFFT;
+        bool shiftAdd = argc > 3 && !strcmp(argv[3], "shift");
+        // [comment]
+        // The bokeh is the convolution of the image by the shape of the aperture. The "shift"
+        // method adds the image shifted by each pixel of the kernel one by one (with circshift).
+        // Each step is an expression evaluated in a single loop over K, without any temporary
+        // image, but the cost is still proportional to the number of pixels of the kernel.
+        // [/comment]
+        auto timeStart = std::chrono::high_resolution_clock::now();
+        Image K;
+        if (shiftAdd) {
+            K = Image(I.w, I.h);
+            for (unsigned int j = 0; j < J.h; ++j) {
+                for (unsigned int i = 0; i < J.w; ++i) {
+                    if (J(i, j) != Image::kBlack)
+                        K += J(i, j) * Image::circshift(I, std::pair<int, int>(i, j));
                 }
             }
         }
+        else K = Image::convolve(I, J, method);
+        auto timeEnd = std::chrono::high_resolution_clock::now();
+        fprintf(stderr, "Convolution: %.2f ms\n", std::chrono::duration<double, std::milli>(timeEnd - timeStart).count());
+        float total = 0;
+        for (unsigned int j = 0; j < J.h; ++j)
+            for (unsigned int i = 0; i < J.w; ++i) total += J(i, j);
         K /= total;
         savePPM(K, "./out.ppm");
     }
@@ -32,12 +32,21 @@
 #include <cstdlib>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <utility>
 #include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <cmath>
 #include <sstream>
+#include <cstring>
+#include <iterator>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <chrono>
 
 #include "geometry.h"
@@ -105,6 +114,36 @@ bool rayTriangleIntersect(
     return true;
 }
 
+// [comment]
+// A vertex of an indexed mesh: the index of its position, and the value of its other attributes.
+// Two vertices are the same if all their attributes are bitwise identical.
+// [/comment]
+struct MeshVertex
+{
+    uint32_t vertIndex;
+    Vec3f normal;
+    Vec2f st;
+    bool operator == (const MeshVertex &v) const
+    {
+        return vertIndex == v.vertIndex &&
+            memcmp(&normal, &v.normal, sizeof(Vec3f)) == 0 &&
+            memcmp(&st, &v.st, sizeof(Vec2f)) == 0;
+    }
+};
+
+struct MeshVertexHash
+{
+    size_t operator () (const MeshVertex &v) const
+    {
+        uint32_t bits[5];
+        memcpy(bits, &v.normal, sizeof(Vec3f));
+        memcpy(bits + 3, &v.st, sizeof(Vec2f));
+        uint64_t h = v.vertIndex;
+        for (uint32_t i = 0; i < 5; ++i) h = (h ^ bits[i]) * 0x100000001b3ULL;
+        return size_t(h ^ (h >> 32));
+    }
+};
+
 class TriangleMesh : public Object
 {
 public:
@@ -112,73 +151,70 @@ public:
     TriangleMesh(
         const Matrix44f &o2w,
         const uint32_t nfaces,
-        const std::unique_ptr<uint32_t []> &faceIndex,
-        const std::unique_ptr<uint32_t []> &vertsIndex,
-        const std::unique_ptr<Vec3f []> &verts,
-        std::unique_ptr<Vec3f []> &normals,
-        std::unique_ptr<Vec2f []> &st) :
+        const uint32_t *faceIndex,
+        const uint32_t *vertsIndex,
+        const Vec3f *verts,
+        const Vec3f *normals,
+        const Vec2f *st) :
         Object(o2w),
         numTris(0)
     {
-        uint32_t k = 0, maxVertIndex = 0;
+        uint32_t numFaceVerts = 0;
         // find out how many triangles we need to create for this mesh
         for (uint32_t i = 0; i < nfaces; ++i) {
             numTris += faceIndex[i] - 2;
-            for (uint32_t j = 0; j < faceIndex[i]; ++j)
-                if (vertsIndex[k + j] > maxVertIndex)
-                    maxVertIndex = vertsIndex[k + j];
-            k += faceIndex[i];
-        }
-        maxVertIndex += 1;
-        
-        // allocate memory to store the position of the mesh vertices
-        P = std::unique_ptr<Vec3f []>(new Vec3f[maxVertIndex]);
-        for (uint32_t i = 0; i < maxVertIndex; ++i) {
-            // [comment]
-            // Transforming vertices to world space
-            // [/comment]
-            objectToWorld.multVecMatrix(verts[i], P[i]);
+            numFaceVerts += faceIndex[i];
         }
-        
-        // allocate memory to store triangle indices
-        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
-        uint32_t l = 0;
+
         // [comment]
-        // Generate the triangle index array
-        // Keep in mind that there is generally 1 vertex attribute for each vertex of each face.
-        // So for example if you have 2 quads, you only have 6 vertices but you have 2 * 4
-        // vertex attributes (that is 8 normals, 8 texture coordinates, etc.). So the easiest
-        // lazziest method in our triangle mesh, is to create a new array for each supported
-        // vertex attribute (st, normals, etc.) whose size is equal to the number of triangles
-        // multiplied by 3, and then set the value of the vertex attribute at each vertex
-        // of each triangle using the input array (normals[], st[], etc.)
+        // Build an indexed mesh. Keep in mind that there is generally 1 vertex attribute for each
+        // vertex of each face. So for example if you have 2 quads, you only have 6 vertices but you
+        // have 2 * 4 vertex attributes (that is 8 normals, 8 texture coordinates, etc.). Vertices
+        // sharing a position but not their normal or texture coordinates (along a hard edge or a
+        // texture seam) need to be split. So we create one mesh vertex for each distinct (position,
+        // normal, texture coordinates) tuple, which we find with a hash table. Each attribute is then
+        // stored once per mesh vertex rather than once per triangle vertex, and a single index array
+        // gives the position, normal and texture coordinates of the vertices of each triangle.
         // [/comment]
-        N = std::unique_ptr<Vec3f []>(new Vec3f[numTris * 3]);
-        texCoordinates = std::unique_ptr<Vec2f []>(new Vec2f[numTris * 3]);
+        std::unordered_map<MeshVertex, uint32_t, MeshVertexHash> vertexMap;
+        std::vector<uint32_t> firstFaceVert; // the face vertex each mesh vertex was created from
+        std::unique_ptr<uint32_t []> meshVertIndex(new uint32_t[numFaceVerts]);
+        for (uint32_t i = 0; i < numFaceVerts; ++i) {
+            MeshVertex v = {vertsIndex[i], normals[i], st[i]};
+            auto inserted = vertexMap.insert(std::make_pair(v, (uint32_t)firstFaceVert.size()));
+            if (inserted.second) firstFaceVert.push_back(i);
+            meshVertIndex[i] = inserted.first->second;
+        }
+        numVerts = firstFaceVert.size();
+
+        // allocate memory to store the position, normal and texture coordinates of the mesh vertices
+        P = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        N = std::unique_ptr<Vec3f []>(new Vec3f[numVerts]);
+        texCoordinates = std::unique_ptr<Vec2f []>(new Vec2f[numVerts]);
         // [comment]
         // Computing the transpose of the object-to-world inverse matrix
         // [/comment]
         Matrix44f transformNormals = worldToObject.transpose();
-        // generate the triangle index array and set normals and st coordinates
-        for (uint32_t i = 0, k = 0; i < nfaces; ++i) { // for each  face
+        for (uint32_t i = 0; i < numVerts; ++i) {
+            uint32_t faceVert = firstFaceVert[i];
+            // [comment]
+            // Transforming vertices and normals to world space
+            // [/comment]
+            objectToWorld.multVecMatrix(verts[vertsIndex[faceVert]], P[i]);
+            transformNormals.multDirMatrix(normals[faceVert], N[i]);
+            N[i].normalize();
+            texCoordinates[i] = st[faceVert];
+        }
+
+        // generate the triangle index array
+        trisIndex = std::unique_ptr<uint32_t []>(new uint32_t [numTris * 3]);
+        for (uint32_t i = 0, k = 0, l = 0; i < nfaces; ++i) { // for each  face
             for (uint32_t j = 0; j < faceIndex[i] - 2; ++j) { // for each triangle in the face
-                trisIndex[l] = vertsIndex[k];
-                trisIndex[l + 1] = vertsIndex[k + j + 1];
-                trisIndex[l + 2] = vertsIndex[k + j + 2];
-                // [comment]
-                // Transforming normals
-                // [/comment]
-                transformNormals.multDirMatrix(normals[k], N[l]);
-                transformNormals.multDirMatrix(normals[k + j + 1], N[l + 1]);
-                transformNormals.multDirMatrix(normals[k + j + 2], N[l + 2]);
-                N[l].normalize();
-                N[l + 1].normalize();
-                N[l + 2].normalize();
-                texCoordinates[l] = st[k];
-                texCoordinates[l + 1] = st[k + j + 1];
-                texCoordinates[l + 2] = st[k + j + 2];
+                trisIndex[l] = meshVertIndex[k];
+                trisIndex[l + 1] = meshVertIndex[k + j + 1];
+                trisIndex[l + 2] = meshVertIndex[k + j + 2];
                 l += 3;
-            }                                                                                                                                                                                                                                
+            }
             k += faceIndex[i];
         }
     }
@@ -220,16 +256,16 @@ public:
         hitNormal.normalize();
         
         // texture coordinates
-        const Vec2f &st0 = texCoordinates[triIndex * 3];
-        const Vec2f &st1 = texCoordinates[triIndex * 3 + 1];
-        const Vec2f &st2 = texCoordinates[triIndex * 3 + 2];
+        const Vec2f &st0 = texCoordinates[trisIndex[triIndex * 3]];
+        const Vec2f &st1 = texCoordinates[trisIndex[triIndex * 3 + 1]];
+        const Vec2f &st2 = texCoordinates[trisIndex[triIndex * 3 + 2]];
         hitTextureCoordinates = (1 - uv.x - uv.y) * st0 + uv.x * st1 + uv.y * st2;
 
         // vertex normal
 #if 0
-        const Vec3f &n0 = N[triIndex * 3];
-        const Vec3f &n1 = N[triIndex * 3 + 1];
-        const Vec3f &n2 = N[triIndex * 3 + 2];
+        const Vec3f &n0 = N[trisIndex[triIndex * 3]];
+        const Vec3f &n1 = N[trisIndex[triIndex * 3 + 1]];
+        const Vec3f &n2 = N[trisIndex[triIndex * 3 + 2]];
         hitNormal = (1 - uv.x - uv.y) * n0 + uv.x * n1 + uv.y * n2;
         // doesn't need to be normalized as the N's are normalized but just for safety
         hitNormal.normalize();
@@ -237,14 +273,159 @@ public:
     }
     // member variables
     uint32_t numTris;                         // number of triangles
-    std::unique_ptr<Vec3f []> P;              // triangles vertex position
+    uint32_t numVerts;                        // number of vertices
+    std::unique_ptr<Vec3f []> P;              // vertex positions
     std::unique_ptr<uint32_t []> trisIndex;   // vertex index array
-    std::unique_ptr<Vec3f []> N;              // triangles vertex normals
-    std::unique_ptr<Vec2f []> texCoordinates; // triangles texture coordinates
+    std::unique_ptr<Vec3f []> N;              // vertex normals
+    std::unique_ptr<Vec2f []> texCoordinates; // vertex texture coordinates
 };
 
+// [comment]
+// Binary version of the geo file (geob), see polygon-mesh/convertgeometry.cpp. The header gives
+// the offset of each array from the start of the file, so loading the mesh is just mapping the
+// file in memory and adding these offsets to the address of the mapping, there's nothing to parse.
+// Only the index arrays need decoding when the file is compressed.
+// [/comment]
+static const char kGeoBinMagic[4] = {'G', 'E', 'O', 'B'};
+static const uint32_t kGeoBinVersion = 1;
+static const uint32_t kGeoBinCompressedIndices = 1;
+
+struct GeoBinHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t numFaces;
+    uint32_t vertsIndexArraySize;
+    uint32_t vertsArraySize;
+    uint64_t faceIndexOffset, faceIndexBytes;
+    uint64_t vertsIndexOffset, vertsIndexBytes;
+    uint64_t vertsOffset;
+    uint64_t normalsOffset;
+    uint64_t stOffset;
+};
+
+struct MappedFile
+{
+    MappedFile(const char *file)
+    {
+#ifdef _WIN32
+        std::ifstream ifs(file, std::ios::binary);
+        if (ifs.fail()) return;
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data = (const uint8_t*)contents.data();
+        size = contents.size();
+#else
+        int fd = open(file, O_RDONLY);
+        struct stat st;
+        if (fd == -1) return;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data = (const uint8_t*)mapping;
+                size = st.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data) munmap((void*)data, size);
+#endif
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::string contents;
+#endif
+};
+
+// decode the delta encoded, variable length indices of a compressed file
+bool decodeIndices(const uint8_t *p, const uint8_t *end, uint32_t count, uint32_t *indices)
+{
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t v = 0;
+        for (uint32_t shift = 0; ; shift += 7) {
+            if (p == end || shift > 28) return false;
+            uint8_t byte = *p++;
+            v |= uint32_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        prev += (v >> 1) ^ (0u - (v & 1));
+        indices[i] = prev;
+    }
+    return true;
+}
+
+TriangleMesh* loadPolyMeshFromBinaryFile(const char *file, const Matrix44f &o2w)
+{
+    MappedFile mapped(file);
+    const GeoBinHeader *header = (const GeoBinHeader*)mapped.data;
+    if (mapped.size < sizeof(GeoBinHeader) || memcmp(header->magic, kGeoBinMagic, 4) != 0 ||
+        header->version != kGeoBinVersion) {
+        std::cerr << "Error: " << file << " is not a geob file" << std::endl;
+        return nullptr;
+    }
+    // check that the arrays are within the file
+    bool compressed = header->flags & kGeoBinCompressedIndices;
+    uint64_t faceIndexBytes = compressed ? header->faceIndexBytes : header->numFaces * sizeof(uint32_t);
+    uint64_t vertsIndexBytes = compressed ? header->vertsIndexBytes : header->vertsIndexArraySize * sizeof(uint32_t);
+    const uint64_t arrays[5][2] = {
+        {header->faceIndexOffset, faceIndexBytes},
+        {header->vertsIndexOffset, vertsIndexBytes},
+        {header->vertsOffset, header->vertsArraySize * sizeof(Vec3f)},
+        {header->normalsOffset, header->vertsIndexArraySize * sizeof(Vec3f)},
+        {header->stOffset, header->vertsIndexArraySize * sizeof(Vec2f)}};
+    for (uint32_t i = 0; i < 5; ++i) {
+        if (arrays[i][0] % 4 != 0 || arrays[i][0] > mapped.size || arrays[i][1] > mapped.size - arrays[i][0]) {
+            std::cerr << "Error: " << file << " is truncated" << std::endl;
+            return nullptr;
+        }
+    }
+    const uint32_t *faceIndex = (const uint32_t*)(mapped.data + header->faceIndexOffset);
+    const uint32_t *vertsIndex = (const uint32_t*)(mapped.data + header->vertsIndexOffset);
+    std::unique_ptr<uint32_t []> decodedFaceIndex, decodedVertsIndex;
+    if (compressed) {
+        decodedFaceIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->numFaces]);
+        decodedVertsIndex = std::unique_ptr<uint32_t []>(new uint32_t[header->vertsIndexArraySize]);
+        if (!decodeIndices(mapped.data + header->faceIndexOffset, mapped.data + header->faceIndexOffset + faceIndexBytes,
+                           header->numFaces, decodedFaceIndex.get()) ||
+            !decodeIndices(mapped.data + header->vertsIndexOffset, mapped.data + header->vertsIndexOffset + vertsIndexBytes,
+                           header->vertsIndexArraySize, decodedVertsIndex.get())) {
+            std::cerr << "Error: " << file << " is corrupted" << std::endl;
+            return nullptr;
+        }
+        faceIndex = decodedFaceIndex.get();
+        vertsIndex = decodedVertsIndex.get();
+    }
+    // the constructor reads the indices without checking them
+    uint64_t numFaceVerts = 0;
+    bool valid = true;
+    for (uint32_t i = 0; i < header->numFaces; ++i) {
+        valid &= faceIndex[i] >= 3;
+        numFaceVerts += faceIndex[i];
+    }
+    valid &= numFaceVerts == header->vertsIndexArraySize;
+    for (uint32_t i = 0; i < header->vertsIndexArraySize; ++i)
+        valid &= vertsIndex[i] < header->vertsArraySize;
+    if (!valid) {
+        std::cerr << "Error: " << file << " is corrupted" << std::endl;
+        return nullptr;
+    }
+
+    return new TriangleMesh(o2w, header->numFaces, faceIndex, vertsIndex,
+        (const Vec3f*)(mapped.data + header->vertsOffset),
+        (const Vec3f*)(mapped.data + header->normalsOffset),
+        (const Vec2f*)(mapped.data + header->stOffset));
+}
+
 TriangleMesh* loadPolyMeshFromFile(const char *file, const Matrix44f &o2w)
 {
+    const char *ext = strrchr(file, '.');
+    if (ext && strcmp(ext, ".geob") == 0) return loadPolyMeshFromBinaryFile(file, o2w);
     std::ifstream ifs;
     try {
         ifs.open(file);
@@ -284,7 +465,7 @@ TriangleMesh* loadPolyMeshFromFile(const char *file, const Matrix44f &o2w)
             ss >> st[i].x >> st[i].y;
         }
         
-        return new TriangleMesh(o2w, numFaces, faceIndex, vertsIndex, verts, normals, st);
+        return new TriangleMesh(o2w, numFaces, faceIndex.get(), vertsIndex.get(), verts.get(), normals.get(), st.get());
     }
     catch (...) {
         ifs.close();